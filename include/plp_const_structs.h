@@ -50,6 +50,26 @@ extern const plp_cfft_instance_q32 plp_cfft_sR_q32_len1024;
 extern const plp_cfft_instance_q32 plp_cfft_sR_q32_len2048;
 extern const plp_cfft_instance_q32 plp_cfft_sR_q32_len4096;
 
+/* Fixed-point rfft */
+
+extern const plp_rfft_instance_q16 plp_rfft_sR_q16_len32;
+extern const plp_rfft_instance_q16 plp_rfft_sR_q16_len64;
+extern const plp_rfft_instance_q16 plp_rfft_sR_q16_len128;
+extern const plp_rfft_instance_q16 plp_rfft_sR_q16_len256;
+extern const plp_rfft_instance_q16 plp_rfft_sR_q16_len512;
+extern const plp_rfft_instance_q16 plp_rfft_sR_q16_len1024;
+extern const plp_rfft_instance_q16 plp_rfft_sR_q16_len2048;
+extern const plp_rfft_instance_q16 plp_rfft_sR_q16_len4096;
+
+extern const plp_rfft_instance_q32 plp_rfft_sR_q32_len32;
+extern const plp_rfft_instance_q32 plp_rfft_sR_q32_len64;
+extern const plp_rfft_instance_q32 plp_rfft_sR_q32_len128;
+extern const plp_rfft_instance_q32 plp_rfft_sR_q32_len256;
+extern const plp_rfft_instance_q32 plp_rfft_sR_q32_len512;
+extern const plp_rfft_instance_q32 plp_rfft_sR_q32_len1024;
+extern const plp_rfft_instance_q32 plp_rfft_sR_q32_len2048;
+extern const plp_rfft_instance_q32 plp_rfft_sR_q32_len4096;
+
 /* Floating-point cfft */
 
 extern const plp_cfft_instance_f32 plp_cfft_sR_f32_len16;
@@ -86,6 +106,7 @@ extern const plp_fft_instance_f32 plp_rfft_sR_f32_len1024;
 extern const plp_fft_instance_f32 plp_rfft_sR_f32_len2048;
 
 extern const plp_triangular_filter_f32 plp_triangular_filter_f32_32;
+extern const plp_triangular_filter_q16 plp_triangular_filter_q16_32;
 
 extern const plp_dwt_wavelet_f32 PLP_DWT_COIF1_f32;
 extern const plp_dwt_wavelet_f32 PLP_DWT_COIF2_f32;
@@ -308,6 +308,26 @@ typedef struct {
     uint32_t nPE;
 } plp_cfft_instance_q16_parallel;
 
+/**
+ * @brief Instance structure for the parallel block floating point CFFT Q16
+ * @param[in]       S                   cfft_q16 struct
+ * @param[in/out]   p1                  points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]       bitReverseFlag      flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]       nPE                 number of cores to use
+ * @param[in]       pHeadroom           buffer of 2*nPE words to combine the headroom of the cores
+ * @param[out]      exponent            block exponent of the output
+ */
+typedef struct {
+    const plp_cfft_instance_q16 *S;
+    int16_t *p1;
+    uint8_t bitReverseFlag;
+    uint32_t nPE;
+    uint32_t *pHeadroom;
+    int32_t exponent;
+} plp_cfft_bfp_instance_q16_parallel;
+
 /**
  * @brief Instance structure for the fixed-point CFFT/CIFFT function.
  * @param[in]   fftLen              length of the FFT
@@ -343,6 +363,64 @@ typedef struct {
     uint32_t nPE;
 } plp_cfft_instance_q32_parallel;
 
+/**
+ * @brief Instance structure for the 16-bit fixed-point real FFT.
+ * @param[in]   fftLenReal      length N of the real sequence
+ * @param[in]   pCfft           points to the instance of the complex FFT of N/2 points
+ * @param[in]   pTwiddleRFFT    points to the twiddle factors (cos, sin)(2*pi*k/N), k = 0 .. N/2 - 1,
+ *                              e.g., the twiddle table of the complex FFT of N points
+ */
+typedef struct {
+    uint32_t fftLenReal;
+    const plp_cfft_instance_q16 *pCfft;
+    const int16_t *pTwiddleRFFT;
+} plp_rfft_instance_q16;
+
+/**
+ * @brief Instance structure for the parallel 16-bit fixed-point real FFT.
+ * @param[in]   S           points to the real FFT instance
+ * @param[in]   pSrc        points to the input buffer
+ * @param[out]  pDst        points to the output buffer
+ * @param[in]   ifftFlag    flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]   nPE         number of cores to use
+ */
+typedef struct {
+    const plp_rfft_instance_q16 *S;
+    int16_t *pSrc;
+    int16_t *pDst;
+    uint8_t ifftFlag;
+    uint32_t nPE;
+} plp_rfft_instance_q16_parallel;
+
+/**
+ * @brief Instance structure for the 32-bit fixed-point real FFT.
+ * @param[in]   fftLenReal      length N of the real sequence
+ * @param[in]   pCfft           points to the instance of the complex FFT of N/2 points
+ * @param[in]   pTwiddleRFFT    points to the twiddle factors (cos, sin)(2*pi*k/N), k = 0 .. N/2 - 1,
+ *                              e.g., the twiddle table of the complex FFT of N points
+ */
+typedef struct {
+    uint32_t fftLenReal;
+    const plp_cfft_instance_q32 *pCfft;
+    const int32_t *pTwiddleRFFT;
+} plp_rfft_instance_q32;
+
+/**
+ * @brief Instance structure for the parallel 32-bit fixed-point real FFT.
+ * @param[in]   S           points to the real FFT instance
+ * @param[in]   pSrc        points to the input buffer
+ * @param[out]  pDst        points to the output buffer
+ * @param[in]   ifftFlag    flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]   nPE         number of cores to use
+ */
+typedef struct {
+    const plp_rfft_instance_q32 *S;
+    int32_t *pSrc;
+    int32_t *pDst;
+    uint8_t ifftFlag;
+    uint32_t nPE;
+} plp_rfft_instance_q32_parallel;
+
 
 /**
  * @brief Instance structure for the floating-point CFFT/CIFFT function.
@@ -455,6 +533,466 @@ typedef struct {
     float32_t *pDst;
 } plp_fft_instance_f32_parallel;
 
+/** -------------------------------------------------------
+    @struct plp_cfft_instance_f32_batch
+    @brief Instance structure for a batch of floating-point complex FFTs.
+    @param[in]      S               points to the floating-point CFFT instance
+    @param[in,out]  pSrc            points to the frames, processing occurs in-place
+    @param[in]      nFrames         number of frames
+    @param[in]      ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+    @param[in]      bitReverseFlag  flag that enables bit reversal of the output
+    @param[in]      nPE             number of cores
+*/
+typedef struct {
+    const plp_cfft_instance_f32 *S;
+    float32_t *pSrc;
+    uint32_t nFrames;
+    uint8_t ifftFlag;
+    uint8_t bitReverseFlag;
+    uint32_t nPE;
+} plp_cfft_instance_f32_batch;
+
+/** -------------------------------------------------------
+    @struct plp_cfft_instance_q16_batch
+    @brief Instance structure for a batch of 16-bit fixed-point complex FFTs.
+    @param[in]      S               points to the 16-bit CFFT instance
+    @param[in,out]  p1              points to the frames, processing occurs in-place
+    @param[in]      nFrames         number of frames
+    @param[in]      ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+    @param[in]      bitReverseFlag  flag that enables bit reversal of the output
+    @param[in]      deciPoint       decimal point for right shift
+    @param[in]      nPE             number of cores
+*/
+typedef struct {
+    const plp_cfft_instance_q16 *S;
+    int16_t *p1;
+    uint32_t nFrames;
+    uint8_t ifftFlag;
+    uint8_t bitReverseFlag;
+    uint32_t deciPoint;
+    uint32_t nPE;
+} plp_cfft_instance_q16_batch;
+
+/** -------------------------------------------------------
+    @struct plp_rfft_instance_f32_batch
+    @brief Instance structure for a batch of floating-point real FFTs.
+    @param[in]  S        points to the floating-point FFT instance
+    @param[in]  pSrc     points to the real input frames
+    @param[out] pDst     points to the complex output frames
+    @param[in]  nFrames  number of frames
+    @param[in]  nPE      number of cores
+*/
+typedef struct {
+    const plp_fft_instance_f32 *S;
+    const float32_t *pSrc;
+    float32_t *pDst;
+    uint32_t nFrames;
+    uint32_t nPE;
+} plp_rfft_instance_f32_batch;
+
+/** -------------------------------------------------------
+    @struct plp_rfft_instance_q16_batch
+    @brief Instance structure for a batch of 16-bit fixed-point real FFTs.
+    @param[in]  S         points to the 16-bit real FFT instance
+    @param[in]  pSrc      points to the input frames
+    @param[out] pDst      points to the output frames
+    @param[in]  nFrames   number of frames
+    @param[in]  ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+    @param[in]  nPE       number of cores
+*/
+typedef struct {
+    const plp_rfft_instance_q16 *S;
+    int16_t *pSrc;
+    int16_t *pDst;
+    uint32_t nFrames;
+    uint8_t ifftFlag;
+    uint32_t nPE;
+} plp_rfft_instance_q16_batch;
+
+/** -------------------------------------------------------
+    @struct plp_cfft2d_instance_f32_parallel
+    @brief Instance structure for the parallel floating-point 2D CFFT.
+    @param[in]      SRow      points to the CFFT instance of the row length
+    @param[in]      SCol      points to the CFFT instance of the column length
+    @param[in,out]  pSrc      points to the complex matrix, processing occurs in-place
+    @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+    @param[in]      pBuffer   points to a buffer of 2*rows values per core
+    @param[in]      nPE       number of cores
+*/
+typedef struct {
+    const plp_cfft_instance_f32 *SRow;
+    const plp_cfft_instance_f32 *SCol;
+    float32_t *pSrc;
+    uint8_t ifftFlag;
+    float32_t *pBuffer;
+    uint32_t nPE;
+} plp_cfft2d_instance_f32_parallel;
+
+/** -------------------------------------------------------
+    @struct plp_cfft2d_instance_q16_parallel
+    @brief Instance structure for the parallel 16-bit fixed-point 2D CFFT.
+    @param[in]      SRow      points to the CFFT instance of the row length
+    @param[in]      SCol      points to the CFFT instance of the column length
+    @param[in,out]  pSrc      points to the complex matrix, processing occurs in-place
+    @param[in]      ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+    @param[in]      pBuffer   points to a buffer of 2*rows values per core
+    @param[in]      nPE       number of cores
+*/
+typedef struct {
+    const plp_cfft_instance_q16 *SRow;
+    const plp_cfft_instance_q16 *SCol;
+    int16_t *pSrc;
+    uint8_t ifftFlag;
+    int16_t *pBuffer;
+    uint32_t nPE;
+} plp_cfft2d_instance_q16_parallel;
+
+/** -------------------------------------------------------
+    @struct plp_rfft2d_instance_f32_parallel
+    @brief Instance structure for the parallel floating-point 2D FFT of real input.
+    @param[in]  SRow     points to the real FFT instance of the row length
+    @param[in]  SCol     points to the CFFT instance of the column length
+    @param[in]  pSrc     points to the real matrix
+    @param[out] pDst     points to the complex output matrix
+    @param[in]  pBuffer  points to a buffer of 2*rows values per core
+    @param[in]  nPE      number of cores
+*/
+typedef struct {
+    const plp_fft_instance_f32 *SRow;
+    const plp_cfft_instance_f32 *SCol;
+    const float32_t *pSrc;
+    float32_t *pDst;
+    float32_t *pBuffer;
+    uint32_t nPE;
+} plp_rfft2d_instance_f32_parallel;
+
+/** -------------------------------------------------------
+    @struct plp_stft_instance_f32
+    @brief State of the floating-point streaming STFT, set up by plp_stft_f32_init.
+    @param[in]  S          points to the real FFT instance of the frame length
+    @param[in]  pWindow    points to the window, FFTLength values
+    @param[in]  hop        number of samples between the starts of consecutive frames
+    @param[in]  nPE        number of cores transforming frames together
+    @param[in]  ringLength length of the ring buffer, <code>FFTLength + (nPE - 1) * hop</code>
+    @param[in]  pRing      points to the ring buffer of input samples
+    @param[in]  pScratch   points to <code>3 * FFTLength</code> values of scratch per core
+    @param[in]  readPos    position in the ring buffer of the first sample of the next frame
+    @param[in]  nBuffered  number of samples in the ring buffer from readPos on
+*/
+typedef struct {
+    const plp_fft_instance_f32 *S;
+    const float32_t *pWindow;
+    uint32_t hop;
+    uint32_t nPE;
+    uint32_t ringLength;
+    float32_t *pRing;
+    float32_t *pScratch;
+    uint32_t readPos;
+    uint32_t nBuffered;
+} plp_stft_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_stft_instance_f32_parallel
+    @brief Frames of the floating-point streaming STFT transformed by the cluster team.
+    @param[in]  S        points to the STFT state
+    @param[in]  nFrames  number of frames ready in the ring buffer
+    @param[in]  nPE      number of cores
+    @param[out] pDst     points to the output, <code>FFTLength + 2</code> values per frame
+*/
+typedef struct {
+    const plp_stft_instance_f32 *S;
+    uint32_t nFrames;
+    uint32_t nPE;
+    float32_t *pDst;
+} plp_stft_instance_f32_parallel;
+
+/** Smallest and largest lengths of the FFT plans. The fixed-point bit reversal tables store
+    8 times the index of each complex sample in 16 bits, which limits q16 and q32 to 8192 points.
+    The f32 and q16 plans also accept lengths 2^a 3^b 5^c in this range (mixed radix). */
+#define PLP_CFFT_PLAN_MIN_LEN 16
+#define PLP_CFFT_PLAN_MAX_LEN_F32 32768
+#define PLP_CFFT_PLAN_MAX_LEN_Q 8192
+
+/** -------------------------------------------------------
+    @brief Memory in which an FFT plan generates its tables.
+ */
+typedef enum {
+    PLP_FFT_PLAN_L2, // accessible from the fabric controller and the cluster
+    PLP_FFT_PLAN_L1  // cluster L1, must be created from the cluster
+} plp_fft_plan_mem;
+
+/** -------------------------------------------------------
+    @struct plp_cfft_plan_f32
+    @brief Floating-point CFFT instance with tables generated at runtime (see
+    plp_cfft_plan_create_f32)
+    @param[in]  S    instance passed to plp_cfft_f32 and plp_cfft_f32_parallel
+    @param[in]  mem  memory holding the tables
+*/
+typedef struct {
+    plp_cfft_instance_f32 S;
+    plp_fft_plan_mem mem;
+} plp_cfft_plan_f32;
+
+/** -------------------------------------------------------
+    @struct plp_cfft_plan_q16
+    @brief 16-bit fixed-point CFFT instance with tables generated at runtime (see
+    plp_cfft_plan_create_q16)
+    @param[in]  S    instance passed to plp_cfft_q16 and plp_cfft_q16_parallel
+    @param[in]  mem  memory holding the tables
+*/
+typedef struct {
+    plp_cfft_instance_q16 S;
+    plp_fft_plan_mem mem;
+} plp_cfft_plan_q16;
+
+/** -------------------------------------------------------
+    @struct plp_cfft_plan_q32
+    @brief 32-bit fixed-point CFFT instance with tables generated at runtime (see
+    plp_cfft_plan_create_q32)
+    @param[in]  S    instance passed to plp_cfft_q32 and plp_cfft_q32_parallel
+    @param[in]  mem  memory holding the tables
+*/
+typedef struct {
+    plp_cfft_instance_q32 S;
+    plp_fft_plan_mem mem;
+} plp_cfft_plan_q32;
+
+/** -------------------------------------------------------
+    @brief Radix of the next stage of a mixed-radix CFFT (fftLen = 2^a 3^b 5^c, but not a power of
+    two), for a stage spanning len samples. The stages take the factors 4, 2, 3 and 5 in this
+    order, which also defines the digit reversal generated by the plans.
+    @param[in]  len  span of the stage, the first stage spans fftLen samples
+    @return     4, 2, 3 or 5, or 0 if len has another prime factor
+*/
+static inline uint32_t plp_cfft_mixed_radix(uint32_t len) {
+    if (len % 4 == 0) {
+        return 4;
+    } else if (len % 2 == 0) {
+        return 2;
+    } else if (len % 3 == 0) {
+        return 3;
+    } else if (len % 5 == 0) {
+        return 5;
+    }
+    return 0;
+}
+
+/** -------------------------------------------------------
+    @struct plp_czt_plan_f32
+    @brief Floating-point chirp-z transform (Bluestein), created with plp_czt_plan_create_f32 or
+    plp_czt_plan_create_dft_f32
+    @param[in]  len      number of input samples
+    @param[in]  numBins  number of output bins
+    @param[in]  fft      power-of-two CFFT plan of at least len + numBins - 1 points
+    @param[in]  pChirp   input chirp, len complex values
+    @param[in]  pKernel  FFT of the convolution chirp divided by fft.S.fftLen, fft.S.fftLen
+                         complex values
+    @param[in]  pPost    output chirp, numBins complex values
+*/
+typedef struct {
+    uint32_t len;
+    uint32_t numBins;
+    plp_cfft_plan_f32 fft;
+    float32_t *pChirp;
+    float32_t *pKernel;
+    float32_t *pPost;
+} plp_czt_plan_f32;
+
+/** -------------------------------------------------------
+    @struct plp_czt_instance_f32_parallel
+    @brief Instance structure for the floating-point chirp-z transform (parallel version)
+    @param[in]  plan  points to the plan
+    @param[in]  pSrc  points to the input samples
+    @param[in]  pBuf  points to the work buffer
+    @param[in]  pDst  points to the output bins
+    @param[in]  nPE   number of cores
+*/
+typedef struct {
+    const plp_czt_plan_f32 *plan;
+    const float32_t *pSrc;
+    float32_t *pBuf;
+    float32_t *pDst;
+    uint32_t nPE;
+} plp_czt_instance_f32_parallel;
+
+/** -------------------------------------------------------
+    @struct plp_dct_plan_f32
+    @brief Floating-point DCT-III and DCT-IV of len points, created with plp_dct_plan_create_f32.
+    Both are computed with a complex FFT of len/2 points. The tables hold exp(-j angle) for the
+    given angles.
+    @param[in]  len     number of points N
+    @param[in]  fft     CFFT plan of N/2 points
+    @param[in]  pSplit  angles 2 pi k / N, k = 0 .. N/2 - 1
+    @param[in]  pShift  angles pi k / (2N), k = 0 .. N/2
+    @param[in]  pPre    angles pi (4n + 1) / (4N), n = 0 .. N/2 - 1
+    @param[in]  pPost   angles pi k / N, k = 0 .. N/2 - 1
+*/
+typedef struct {
+    uint32_t len;
+    plp_cfft_plan_f32 fft;
+    float32_t *pSplit;
+    float32_t *pShift;
+    float32_t *pPre;
+    float32_t *pPost;
+} plp_dct_plan_f32;
+
+/** -------------------------------------------------------
+    @struct plp_dct_plan_q16
+    @brief 16-bit fixed-point DCT-II, DCT-III and DCT-IV of len points, created with
+    plp_dct_plan_create_q16. The tables hold (cos, sin) in Q15 of the angles of plp_dct_plan_f32.
+    @param[in]  len     number of points N
+    @param[in]  fft     CFFT plan of N/2 points
+    @param[in]  pSplit  angles 2 pi k / N, k = 0 .. N/2 - 1
+    @param[in]  pShift  angles pi k / (2N), k = 0 .. N/2
+    @param[in]  pPre    angles pi (4n + 1) / (4N), n = 0 .. N/2 - 1
+    @param[in]  pPost   angles pi k / N, k = 0 .. N/2 - 1
+*/
+typedef struct {
+    uint32_t len;
+    plp_cfft_plan_q16 fft;
+    int16_t *pSplit;
+    int16_t *pShift;
+    int16_t *pPre;
+    int16_t *pPost;
+} plp_dct_plan_q16;
+
+/** -------------------------------------------------------
+    @struct plp_dct_plan_q32
+    @brief 32-bit fixed-point DCT-II, DCT-III and DCT-IV of len points, created with
+    plp_dct_plan_create_q32. The tables hold (cos, sin) in Q31 of the angles of plp_dct_plan_f32.
+    @param[in]  len     number of points N
+    @param[in]  fft     CFFT plan of N/2 points
+    @param[in]  pSplit  angles 2 pi k / N, k = 0 .. N/2 - 1
+    @param[in]  pShift  angles pi k / (2N), k = 0 .. N/2
+    @param[in]  pPre    angles pi (4n + 1) / (4N), n = 0 .. N/2 - 1
+    @param[in]  pPost   angles pi k / N, k = 0 .. N/2 - 1
+*/
+typedef struct {
+    uint32_t len;
+    plp_cfft_plan_q32 fft;
+    int32_t *pSplit;
+    int32_t *pShift;
+    int32_t *pPre;
+    int32_t *pPost;
+} plp_dct_plan_q32;
+
+/** -------------------------------------------------------
+    @struct plp_dct_instance_f32_parallel
+    @brief Instance structure for the floating-point DCT-III and DCT-IV (parallel version)
+    @param[in]  plan       points to the plan
+    @param[in]  orthoNorm  whether to use the orthonormal scaling
+    @param[in]  pSrc       points to the input
+    @param[in]  pBuf       points to the work buffer
+    @param[out] pDst       points to the output
+    @param[in]  nPE        number of cores
+*/
+typedef struct {
+    const plp_dct_plan_f32 *plan;
+    uint8_t orthoNorm;
+    const float32_t *pSrc;
+    float32_t *pBuf;
+    float32_t *pDst;
+    uint32_t nPE;
+} plp_dct_instance_f32_parallel;
+
+/** -------------------------------------------------------
+    @struct plp_dct_instance_q16_parallel
+    @brief Instance structure for the 16-bit fixed-point DCTs (parallel version)
+    @param[in]  plan  points to the plan
+    @param[in]  pSrc  points to the input
+    @param[in]  pBuf  points to the work buffer
+    @param[out] pDst  points to the output
+    @param[in]  nPE   number of cores
+*/
+typedef struct {
+    const plp_dct_plan_q16 *plan;
+    const int16_t *pSrc;
+    int16_t *pBuf;
+    int16_t *pDst;
+    uint32_t nPE;
+} plp_dct_instance_q16_parallel;
+
+/** -------------------------------------------------------
+    @struct plp_dct_instance_q32_parallel
+    @brief Instance structure for the 32-bit fixed-point DCTs (parallel version)
+    @param[in]  plan  points to the plan
+    @param[in]  pSrc  points to the input
+    @param[in]  pBuf  points to the work buffer
+    @param[out] pDst  points to the output
+    @param[in]  nPE   number of cores
+*/
+typedef struct {
+    const plp_dct_plan_q32 *plan;
+    const int32_t *pSrc;
+    int32_t *pBuf;
+    int32_t *pDst;
+    uint32_t nPE;
+} plp_dct_instance_q32_parallel;
+
+/** -------------------------------------------------------
+    @struct plp_mdct_instance_f32
+    @brief Floating-point MDCT or IMDCT of frames of 2M samples with a hop of M samples, see
+    plp_mdct_f32_init. An instance is used either for the MDCT or for the IMDCT.
+    @param[in]  plan     DCT plan of M points, the DCT-IV runs on its FFT of M/2 points
+    @param[in]  pWindow  window of 2M values, w[n]^2 + w[n+M]^2 = 1 for the reconstruction
+    @param[in]  pState   M values, the previous input block (MDCT) or the overlap of the
+                         previous frame (IMDCT)
+*/
+typedef struct {
+    const plp_dct_plan_f32 *plan;
+    const float32_t *pWindow;
+    float32_t *pState;
+} plp_mdct_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_mdct_instance_q16
+    @brief 16-bit fixed-point MDCT or IMDCT, see plp_mdct_instance_f32 and plp_mdct_q16_init
+    @param[in]  plan     DCT plan of M points, M/2 must be a power of two
+    @param[in]  pWindow  window of 2M values in Q15
+    @param[in]  pState   M values in Q15, the previous input block (MDCT) or half the overlap (IMDCT)
+*/
+typedef struct {
+    const plp_dct_plan_q16 *plan;
+    const int16_t *pWindow;
+    int16_t *pState;
+} plp_mdct_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_mdct_instance_f32_parallel
+    @brief Instance structure for the floating-point MDCT and IMDCT (parallel version)
+    @param[in]  S     points to the MDCT instance
+    @param[in]  pSrc  points to the input block
+    @param[in]  pBuf  points to the work buffer
+    @param[out] pDst  points to the output block
+    @param[in]  nPE   number of cores
+*/
+typedef struct {
+    plp_mdct_instance_f32 *S;
+    const float32_t *pSrc;
+    float32_t *pBuf;
+    float32_t *pDst;
+    uint32_t nPE;
+} plp_mdct_instance_f32_parallel;
+
+/** -------------------------------------------------------
+    @struct plp_mdct_instance_q16_parallel
+    @brief Instance structure for the 16-bit fixed-point MDCT and IMDCT (parallel version)
+    @param[in]  S     points to the MDCT instance
+    @param[in]  pSrc  points to the input block
+    @param[in]  pBuf  points to the work buffer
+    @param[out] pDst  points to the output block
+    @param[in]  nPE   number of cores
+    @param[in]  fft   block floating point FFT shared by the cores (IMDCT)
+*/
+typedef struct {
+    plp_mdct_instance_q16 *S;
+    const int16_t *pSrc;
+    int16_t *pBuf;
+    int16_t *pDst;
+    uint32_t nPE;
+    plp_cfft_bfp_instance_q16_parallel fft;
+} plp_mdct_instance_q16_parallel;
+
 /** -------------------------------------------------------
     @struct plp_triangular_filter_f32
     @brief structure containing non-zero values of triangular filterbanks
@@ -473,6 +1011,54 @@ typedef struct {
     const uint8_t nFilters;
 } plp_triangular_filter_f32;
 
+/** -------------------------------------------------------
+    @struct plp_triangular_filter_q16
+    @brief structure containing non-zero values of 16-bit fixed-point triangular filterbanks
+    @param  V               pointer to an array containing all non-zero filter
+                            coefficients of the triangular filters, in Q15
+    @param  firstValue      pointer to array containing indexes of the
+                            first non-zero coefficients of the filters
+    @param  filterLength    pointer to array containing lengths of the
+                            non-zero region of each filter
+    @param  nFilters        total amount of triangular filters (n_mels)
+*/
+typedef struct {
+    const int16_t *V;
+    const uint16_t *firstValue;
+    const uint16_t *filterLength;
+    const uint8_t nFilters;
+} plp_triangular_filter_q16;
+
+/** -------------------------------------------------------
+    @struct plp_mel_fbank_instance_f32_parallel
+    @brief Instance structure for the parallel floating-point mel filterbank.
+    @param[in]  filterBank  points to the triangular filterbank
+    @param[in]  pSrc        points to the complex spectrum
+    @param[in]  nPE         number of cores
+    @param[out] pDst        points to the filterbank energies
+*/
+typedef struct {
+    const plp_triangular_filter_f32 *filterBank;
+    const float32_t *pSrc;
+    uint32_t nPE;
+    float32_t *pDst;
+} plp_mel_fbank_instance_f32_parallel;
+
+/** -------------------------------------------------------
+    @struct plp_mel_fbank_instance_q16_parallel
+    @brief Instance structure for the parallel 16-bit fixed-point mel filterbank.
+    @param[in]  filterBank  points to the triangular filterbank
+    @param[in]  pSrc        points to the complex spectrum
+    @param[in]  nPE         number of cores
+    @param[out] pDst        points to the filterbank energies
+*/
+typedef struct {
+    const plp_triangular_filter_q16 *filterBank;
+    const int16_t *pSrc;
+    uint32_t nPE;
+    int32_t *pDst;
+} plp_mel_fbank_instance_q16_parallel;
+
 /** -------------------------------------------------------
     @struct Complex_type_f32
     @brief Helper type to represent complex values with float32 components.
@@ -1600,62 +2186,504 @@ typedef struct {
     float32_t *resBuffer;   // pointer to result vector
 } plp_power_instance_f32;
 
+/** -------------------------------------------------------
+    @struct plp_l1_arena
+    @brief Bump allocator on a user-provided memory region (see plp_l1_arena_init).
+    @param[in]  pBase   points to the start of the memory region
+    @param[in]  size    size of the memory region in bytes
+    @param[in]  offset  number of bytes currently allocated
+*/
+typedef struct {
+    uint8_t *pBase;  // start of the memory region
+    uint32_t size;   // size of the memory region in bytes
+    uint32_t offset; // number of allocated bytes
+} plp_l1_arena;
+
+#define PLP_L1_ARENA_ALIGN 4
+#define PLP_L1_ARENA_SIZE(SIZE) (((SIZE) + PLP_L1_ARENA_ALIGN - 1) & ~(PLP_L1_ARENA_ALIGN - 1))
+
+/** -------------------------------------------------------
+    @struct plp_cl_op
+    @brief One stage of an operation list: a parallel kernel and its instance structure.
+    @param[in]  kernel  parallel kernel, executed by each core of the team
+    @param[in]  args    points to the instance structure passed to the kernel
+*/
+typedef struct {
+    void (*kernel)(void *); // parallel kernel
+    void *args;             // instance structure of the kernel
+} plp_cl_op;
+
+/** -------------------------------------------------------
+    @struct plp_cl_oplist
+    @brief Sequence of parallel kernels executed with a single fork (see plp_cl_oplist_run).
+    @param[in]  pOps    points to the array of operations
+    @param[in]  numOps  number of operations in the list
+    @param[in]  maxOps  capacity of the pOps array
+*/
+typedef struct {
+    plp_cl_op *pOps; // array of operations
+    uint32_t numOps; // number of operations
+    uint32_t maxOps; // capacity of the array
+} plp_cl_oplist;
+
+/** -------------------------------------------------------
+    @struct plp_stream_op
+    @brief Operation applied by plp_stream to each tile of the input vectors.
+    @param[in]  kernel   processes blockSize elements of one tile. For elementwise operations, the
+                         results are written to pDst. For reductions, the result is written to
+                         pAcc if first is set, and accumulated into pAcc otherwise.
+    @param[in]  combine  combines the partial result of another core into pAcc (reductions only)
+    @param[in]  numSrc   number of input vectors (1 or 2)
+    @param[in]  srcSize  size of an input element in bytes
+    @param[in]  dstSize  size of an output element in bytes, 0 for reductions
+    @param[in]  accSize  size of the result in bytes, 0 for elementwise operations
+*/
+typedef struct {
+    void (*kernel)(const void *, const void *, void *, uint32_t, void *, uint32_t);
+    void (*combine)(void *, const void *);
+    uint8_t numSrc;  // number of input vectors
+    uint8_t srcSize; // bytes per input element
+    uint8_t dstSize; // bytes per output element
+    uint8_t accSize; // bytes of the result
+} plp_stream_op;
 
+/** Size in bytes of each L1 tile buffer used by plp_stream. */
+#ifndef PLP_STREAM_TILE_SIZE
+#define PLP_STREAM_TILE_SIZE 2048
+#endif
 
+/** -------------------------------------------------------
+    @brief Elementwise operations of a fused pipeline (see plp_pipeline_f32). x is the value
+    computed by the previous stages, n the index of the element.
+*/
 typedef enum {
-    PLP_DWT_WAVELET_OTHER,
-    PLP_DWT_WAVELET_HAAR,
+    PLP_PIPELINE_SCALE,  // x = (x * value) >> shift
+    PLP_PIPELINE_OFFSET, // x = x + value
+    PLP_PIPELINE_MULT,   // x = (x * pSrc[n]) >> shift
+    PLP_PIPELINE_ADD,    // x = x + pSrc[n]
+    PLP_PIPELINE_SUB,    // x = x - pSrc[n]
+    PLP_PIPELINE_ABS,    // x = |x|
+    PLP_PIPELINE_NEGATE  // x = -x
+} plp_pipeline_opcode;
+
+/** Maximum number of stages of a fused pipeline. */
+#ifndef PLP_PIPELINE_MAX_OPS
+#define PLP_PIPELINE_MAX_OPS 8
+#endif
+
+/** -------------------------------------------------------
+    @struct plp_pipeline_op_f32
+    @brief One stage of a fused elementwise pipeline for 32-bit floats.
+    @param[in]  op     operation
+    @param[in]  pSrc   points to the second operand vector (PLP_PIPELINE_MULT, _ADD and _SUB)
+    @param[in]  value  scalar operand (PLP_PIPELINE_SCALE and _OFFSET)
+*/
+typedef struct {
+    plp_pipeline_opcode op;
+    const float32_t *pSrc; // second operand vector
+    float32_t value;       // scalar operand
+} plp_pipeline_op_f32;
 
-    PLP_DWT_WAVELET_DB1,
-    PLP_DWT_WAVELET_DB2,
-    PLP_DWT_WAVELET_DB3,
-    PLP_DWT_WAVELET_DB4,
-    PLP_DWT_WAVELET_DB5,
-    PLP_DWT_WAVELET_DB6,
-    PLP_DWT_WAVELET_DB7,
-    PLP_DWT_WAVELET_DB8,
-    PLP_DWT_WAVELET_DB9,
-    PLP_DWT_WAVELET_DB10,
-    PLP_DWT_WAVELET_DB11,
-    PLP_DWT_WAVELET_DB12,
-    PLP_DWT_WAVELET_DB13,
-    PLP_DWT_WAVELET_DB14,
-    PLP_DWT_WAVELET_DB15,
-    PLP_DWT_WAVELET_DB16,
-    PLP_DWT_WAVELET_DB17,
-    PLP_DWT_WAVELET_DB18,
-    PLP_DWT_WAVELET_DB19,
-    PLP_DWT_WAVELET_DB20,
+/** -------------------------------------------------------
+    @struct plp_pipeline_op_i16
+    @brief One stage of a fused elementwise pipeline for 16-bit integers.
+    @param[in]  op     operation
+    @param[in]  pSrc   points to the second operand vector (PLP_PIPELINE_MULT, _ADD and _SUB)
+    @param[in]  value  scalar operand (PLP_PIPELINE_SCALE and _OFFSET)
+    @param[in]  shift  right shift applied after the multiplication (PLP_PIPELINE_SCALE and _MULT)
+*/
+typedef struct {
+    plp_pipeline_opcode op;
+    const int16_t *pSrc; // second operand vector
+    int16_t value;       // scalar operand
+    int32_t shift;       // right shift after multiplications
+} plp_pipeline_op_i16;
 
-    PLP_DWT_WAVELET_SYM2,
-    PLP_DWT_WAVELET_SYM3,
-    PLP_DWT_WAVELET_SYM4,
-    PLP_DWT_WAVELET_SYM5,
-    PLP_DWT_WAVELET_SYM6,
-    PLP_DWT_WAVELET_SYM7,
-    PLP_DWT_WAVELET_SYM8,
-    PLP_DWT_WAVELET_SYM9,
-    PLP_DWT_WAVELET_SYM10,
-    PLP_DWT_WAVELET_SYM11,
-    PLP_DWT_WAVELET_SYM12,
-    PLP_DWT_WAVELET_SYM13,
-    PLP_DWT_WAVELET_SYM14,
-    PLP_DWT_WAVELET_SYM15,
-    PLP_DWT_WAVELET_SYM16,
-    PLP_DWT_WAVELET_SYM17,
-    PLP_DWT_WAVELET_SYM18,
-    PLP_DWT_WAVELET_SYM19,
-    PLP_DWT_WAVELET_SYM20,
+/** -------------------------------------------------------
+    @struct plp_pipeline_op_i8
+    @brief One stage of a fused elementwise pipeline for 8-bit integers.
+    @param[in]  op     operation
+    @param[in]  pSrc   points to the second operand vector (PLP_PIPELINE_MULT, _ADD and _SUB)
+    @param[in]  value  scalar operand (PLP_PIPELINE_SCALE and _OFFSET)
+    @param[in]  shift  right shift applied after the multiplication (PLP_PIPELINE_SCALE and _MULT)
+*/
+typedef struct {
+    plp_pipeline_opcode op;
+    const int8_t *pSrc; // second operand vector
+    int8_t value;       // scalar operand
+    int32_t shift;      // right shift after multiplications
+} plp_pipeline_op_i8;
 
-    PLP_DWT_WAVELET_COIF1,
-    PLP_DWT_WAVELET_COIF2,
-    PLP_DWT_WAVELET_COIF3,
-    PLP_DWT_WAVELET_COIF4,
-    PLP_DWT_WAVELET_COIF5,
-    PLP_DWT_WAVELET_COIF6,
-    PLP_DWT_WAVELET_COIF7,
-    PLP_DWT_WAVELET_COIF8,
-    PLP_DWT_WAVELET_COIF9,
+/** -------------------------------------------------------
+    @struct plp_pipeline_instance_f32
+    @brief Instance structure for the parallel fused pipeline of 32-bit floats.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  pOps       points to the stages of the pipeline
+    @param[in]  numOps     number of stages
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+*/
+typedef struct {
+    const float32_t *pSrc;
+    const plp_pipeline_op_f32 *pOps;
+    uint32_t numOps;
+    uint32_t blockSize;
+    uint32_t nPE;
+    float32_t *pDst;
+} plp_pipeline_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_pipeline_instance_i16
+    @brief Instance structure for the parallel fused pipeline of 16-bit integers.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  pOps       points to the stages of the pipeline
+    @param[in]  numOps     number of stages
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+*/
+typedef struct {
+    const int16_t *pSrc;
+    const plp_pipeline_op_i16 *pOps;
+    uint32_t numOps;
+    uint32_t blockSize;
+    uint32_t nPE;
+    int16_t *pDst;
+} plp_pipeline_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_pipeline_instance_i8
+    @brief Instance structure for the parallel fused pipeline of 8-bit integers.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  pOps       points to the stages of the pipeline
+    @param[in]  numOps     number of stages
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pDst       points to the output vector
+*/
+typedef struct {
+    const int8_t *pSrc;
+    const plp_pipeline_op_i8 *pOps;
+    uint32_t numOps;
+    uint32_t blockSize;
+    uint32_t nPE;
+    int8_t *pDst;
+} plp_pipeline_instance_i8;
+
+/** Number of cores for which plp_profile keeps per-core counters of the parallel kernels. */
+#ifndef PLP_PROFILE_NB_PE
+#define PLP_PROFILE_NB_PE 8
+#endif
+
+/** Performance counters configured by plp_profile_start. On the boards, only one counter exists. */
+#ifndef PLP_PROFILE_EVENTS
+#define PLP_PROFILE_EVENTS                                                                         \
+    ((1 << HAL_PERF_CYCLES) | (1 << HAL_PERF_INSTR) | (1 << HAL_PERF_LD_STALL) |                   \
+     (1 << HAL_PERF_TCDM_CONT) | (1 << HAL_PERF_IMISS))
+#endif
+
+#define PLP_PROFILE_NB_COUNTERS 5
+
+/** -------------------------------------------------------
+    @struct plp_profile_entry
+    @brief Counters accumulated by the profiling hook of one glue function (see plp_profile_dump).
+    @param[in]  name          name of the function
+    @param[in]  next          next entry of the profiling table
+    @param[in]  registered    set when the entry has been added to the table
+    @param[in]  calls         number of calls
+    @param[in]  counters      cycles, instructions, load stalls, TCDM contentions and instruction
+                              cache misses, summed over all calls
+    @param[in]  coreCalls     number of parallel kernels executed by each core
+    @param[in]  coreCounters  counters of each core, summed over its parallel kernels
+*/
+typedef struct plp_profile_entry {
+    const char *name;
+    struct plp_profile_entry *next;
+    uint32_t registered;
+    uint32_t calls;
+    uint32_t counters[PLP_PROFILE_NB_COUNTERS];
+    uint32_t coreCalls[PLP_PROFILE_NB_PE];
+    uint32_t coreCounters[PLP_PROFILE_NB_PE][PLP_PROFILE_NB_COUNTERS];
+} plp_profile_entry;
+
+/** -------------------------------------------------------
+    @struct plp_profile_scope
+    @brief State of one profiled call, kept on the stack of the glue function.
+    @param[in]  entry     entry of the called function
+    @param[in]  parent    entry of the enclosing profiled call, if any
+    @param[in]  counters  counter values at the beginning of the call
+*/
+typedef struct {
+    plp_profile_entry *entry;
+    plp_profile_entry *parent;
+    uint32_t counters[PLP_PROFILE_NB_COUNTERS];
+} plp_profile_scope;
+
+/** -------------------------------------------------------
+    @struct plp_profile_kernel_args
+    @brief Parallel kernel wrapped by plp_profile_kernel.
+    @param[in]  kernel  parallel kernel
+    @param[in]  args    points to the instance structure of the kernel
+    @param[in]  entry   entry of the glue function which forked the kernel
+*/
+typedef struct {
+    void (*kernel)(void *);
+    void *args;
+    plp_profile_entry *entry;
+} plp_profile_kernel_args;
+
+/** Profiling hook placed at the beginning of each glue function. When the library is built with
+ * PLP_PROFILE, it counts the call and the performance counters until the function returns. */
+#ifdef PLP_PROFILE
+#define PLP_PROFILE_FUNC()                                                                         \
+    static plp_profile_entry plp_profile_entry_ = { __func__ };                                    \
+    plp_profile_scope plp_profile_scope_ __attribute__((cleanup(plp_profile_end))) =               \
+        plp_profile_begin(&plp_profile_entry_)
+#else
+#define PLP_PROFILE_FUNC() ((void)0)
+#endif
+
+/** Number of cores for which plp_trace records events. */
+#ifndef PLP_TRACE_NB_PE
+#define PLP_TRACE_NB_PE 8
+#endif
+
+/** Number of events each core can record after plp_trace_start. Each event takes 8 bytes of L1. */
+#ifndef PLP_TRACE_NB_EVENTS
+#define PLP_TRACE_NB_EVENTS 64
+#endif
+
+/** Number of forks for which plp_trace keeps the name of the forking function. */
+#ifndef PLP_TRACE_NB_FORKS
+#define PLP_TRACE_NB_FORKS 32
+#endif
+
+/** Fork index of the kernels forked while the tracing is stopped. */
+#define PLP_TRACE_NO_FORK 0xFFFF
+
+/** -------------------------------------------------------
+    @brief Events recorded by plp_trace.
+ */
+typedef enum {
+    PLP_TRACE_FORK,          // the calling core forks the kernel
+    PLP_TRACE_JOIN,          // the calling core returns from the fork
+    PLP_TRACE_START,         // a core starts the kernel
+    PLP_TRACE_END,           // a core finishes the kernel
+    PLP_TRACE_BARRIER_ENTER, // a core arrives at a barrier inside the kernel
+    PLP_TRACE_BARRIER_LEAVE  // a core leaves the barrier
+} plp_trace_event_type;
+
+/** -------------------------------------------------------
+    @struct plp_trace_event
+    @brief Event recorded by plp_trace.
+    @param[in]  fork  index of the fork since plp_trace_start
+    @param[in]  type  type of the event, see plp_trace_event_type
+    @param[in]  time  cluster timer, relative to plp_trace_start
+*/
+typedef struct {
+    uint16_t fork;
+    uint16_t type;
+    uint32_t time;
+} plp_trace_event;
+
+/** -------------------------------------------------------
+    @struct plp_trace_kernel_args
+    @brief Parallel kernel wrapped by plp_trace_kernel.
+    @param[in]  kernel  parallel kernel
+    @param[in]  args    points to the instance structure of the kernel
+    @param[in]  fork    index of the fork, returned by plp_trace_fork
+*/
+typedef struct {
+    void (*kernel)(void *);
+    void *args;
+    uint32_t fork;
+} plp_trace_kernel_args;
+
+/** -------------------------------------------------------
+    @brief Kernels selected at runtime through the dispatch table (see plp_dispatch_register).
+ */
+typedef enum {
+    PLP_KERNEL_DOT_PROD_I32,
+    PLP_KERNEL_DOT_PROD_I16,
+    PLP_KERNEL_DOT_PROD_I8,
+    PLP_KERNEL_DOT_PROD_Q32,
+    PLP_KERNEL_DOT_PROD_Q16,
+    PLP_KERNEL_DOT_PROD_Q8,
+    PLP_KERNEL_DOT_PROD_F32,
+    PLP_KERNEL_ADD_I32,
+    PLP_KERNEL_ADD_I16,
+    PLP_KERNEL_ADD_I8,
+    PLP_KERNEL_SUB_I32,
+    PLP_KERNEL_SUB_I16,
+    PLP_KERNEL_SUB_I8,
+    PLP_KERNEL_MULT_I32,
+    PLP_KERNEL_MULT_I16,
+    PLP_KERNEL_MULT_I8,
+    PLP_KERNEL_NB
+} plp_kernel_id;
+
+/** -------------------------------------------------------
+    @brief Domain of the core calling a dispatched function.
+ */
+typedef enum {
+    PLP_DISPATCH_FC, // fabric controller (RV32IM kernels by default)
+    PLP_DISPATCH_CL, // cluster cores (XPULPV2 kernels by default)
+    PLP_DISPATCH_NB_DOMAINS
+} plp_dispatch_domain;
+
+/** Number of size classes (variants) of each kernel and domain. */
+#ifndef PLP_DISPATCH_NB_VARIANTS
+#define PLP_DISPATCH_NB_VARIANTS 4
+#endif
+
+/** Largest size of the default variant, which handles all the sizes. */
+#define PLP_DISPATCH_ALL_SIZES 0xFFFFFFFFU
+
+/** Generic kernel pointer stored in the dispatch table, cast to the signature of the kernel. */
+typedef void (*plp_kernel_fn)(void);
+
+/** -------------------------------------------------------
+    @struct plp_dispatch_variant
+    @brief Kernel variant used up to a maximum size.
+    @param[in]  maxSize  largest blockSize handled by the variant
+    @param[in]  kernel   kernel called for this size class
+*/
+typedef struct {
+    uint32_t maxSize;
+    plp_kernel_fn kernel;
+} plp_dispatch_variant;
+
+/** -------------------------------------------------------
+    @struct plp_dispatch_entry
+    @brief Variants of one kernel in one domain, sorted by increasing maxSize. The last variant
+    always has maxSize PLP_DISPATCH_ALL_SIZES.
+*/
+typedef struct {
+    uint32_t numVariants;
+    plp_dispatch_variant variants[PLP_DISPATCH_NB_VARIANTS];
+} plp_dispatch_entry;
+
+/** Signatures of the dispatched kernels. */
+typedef void (*plp_dot_prod_i32_kernel)(const int32_t *, const int32_t *, uint32_t, int32_t *);
+typedef void (*plp_dot_prod_i16_kernel)(const int16_t *, const int16_t *, uint32_t, int32_t *);
+typedef void (*plp_dot_prod_i8_kernel)(const int8_t *, const int8_t *, uint32_t, int32_t *);
+typedef void (*plp_dot_prod_q32_kernel)(const int32_t *, const int32_t *, uint32_t, uint32_t,
+                                        int32_t *);
+typedef void (*plp_dot_prod_q16_kernel)(const int16_t *, const int16_t *, uint32_t, uint32_t,
+                                        int32_t *);
+typedef void (*plp_dot_prod_q8_kernel)(const int8_t *, const int8_t *, uint32_t, uint32_t,
+                                       int32_t *);
+typedef void (*plp_dot_prod_f32_kernel)(const float32_t *, const float32_t *, uint32_t,
+                                        float32_t *);
+typedef void (*plp_elementwise_i32_kernel)(const int32_t *, const int32_t *, int32_t *, uint32_t);
+typedef void (*plp_elementwise_i16_kernel)(const int16_t *, const int16_t *, int32_t *, uint32_t);
+typedef void (*plp_elementwise_i8_kernel)(const int8_t *, const int8_t *, int32_t *, uint32_t);
+
+/** -------------------------------------------------------
+    @brief Parallel functions which select the number of cores themselves when called with nPE = 0
+    (see plp_auto_npe).
+ */
+typedef enum {
+    PLP_COST_DOT_PROD_I32,
+    PLP_COST_DOT_PROD_Q32,
+    PLP_COST_DOT_PROD_F32,
+    PLP_COST_MULT_F32,
+    PLP_COST_MAT_MULT_I32,
+    PLP_COST_MAT_MULT_I16,
+    PLP_COST_MAT_MULT_I8,
+    PLP_COST_MAT_MULT_Q32,
+    PLP_COST_MAT_MULT_Q16,
+    PLP_COST_MAT_MULT_Q8,
+    PLP_COST_MAT_MULT_F32,
+    PLP_COST_NB
+} plp_cost_model_id;
+
+/** -------------------------------------------------------
+    @struct plp_cost_model
+    @brief Cycles of a parallel function on nPE cores, for numChunks chunks of chunkSize units of
+    work, which are distributed among the cores:
+    fixed + perCore * nPE + (perUnit * ceil(numChunks / nPE) * chunkSize) / 256
+    @param[in]  fixed    cycles which do not depend on nPE
+    @param[in]  perCore  cycles added by each core (fork, reduction of the partial results)
+    @param[in]  perUnit  cycles per unit of work on one core, in 1/256 cycles
+*/
+typedef struct {
+    uint32_t fixed;
+    uint32_t perCore;
+    uint32_t perUnit;
+} plp_cost_model;
+
+/** -------------------------------------------------------
+    @brief How the parallel functions proceed when they are called from the fabric controller.
+ */
+typedef enum {
+    PLP_FC_SEQUENTIAL, // run the single-core (RV32IM) kernel on the fabric controller
+    PLP_FC_OFFLOAD     // power up the cluster (once) and run the parallel kernels on it
+} plp_fc_mode;
+
+/** Mode of the fabric controller until plp_fc_set_mode is called (PLP_FC_OFFLOAD=1 in the
+    Makefile selects PLP_FC_OFFLOAD). */
+#ifndef PLP_FC_DEFAULT_MODE
+#define PLP_FC_DEFAULT_MODE PLP_FC_SEQUENTIAL
+#endif
+
+
+
+typedef enum {
+    PLP_DWT_WAVELET_OTHER,
+    PLP_DWT_WAVELET_HAAR,
+
+    PLP_DWT_WAVELET_DB1,
+    PLP_DWT_WAVELET_DB2,
+    PLP_DWT_WAVELET_DB3,
+    PLP_DWT_WAVELET_DB4,
+    PLP_DWT_WAVELET_DB5,
+    PLP_DWT_WAVELET_DB6,
+    PLP_DWT_WAVELET_DB7,
+    PLP_DWT_WAVELET_DB8,
+    PLP_DWT_WAVELET_DB9,
+    PLP_DWT_WAVELET_DB10,
+    PLP_DWT_WAVELET_DB11,
+    PLP_DWT_WAVELET_DB12,
+    PLP_DWT_WAVELET_DB13,
+    PLP_DWT_WAVELET_DB14,
+    PLP_DWT_WAVELET_DB15,
+    PLP_DWT_WAVELET_DB16,
+    PLP_DWT_WAVELET_DB17,
+    PLP_DWT_WAVELET_DB18,
+    PLP_DWT_WAVELET_DB19,
+    PLP_DWT_WAVELET_DB20,
+
+    PLP_DWT_WAVELET_SYM2,
+    PLP_DWT_WAVELET_SYM3,
+    PLP_DWT_WAVELET_SYM4,
+    PLP_DWT_WAVELET_SYM5,
+    PLP_DWT_WAVELET_SYM6,
+    PLP_DWT_WAVELET_SYM7,
+    PLP_DWT_WAVELET_SYM8,
+    PLP_DWT_WAVELET_SYM9,
+    PLP_DWT_WAVELET_SYM10,
+    PLP_DWT_WAVELET_SYM11,
+    PLP_DWT_WAVELET_SYM12,
+    PLP_DWT_WAVELET_SYM13,
+    PLP_DWT_WAVELET_SYM14,
+    PLP_DWT_WAVELET_SYM15,
+    PLP_DWT_WAVELET_SYM16,
+    PLP_DWT_WAVELET_SYM17,
+    PLP_DWT_WAVELET_SYM18,
+    PLP_DWT_WAVELET_SYM19,
+    PLP_DWT_WAVELET_SYM20,
+
+    PLP_DWT_WAVELET_COIF1,
+    PLP_DWT_WAVELET_COIF2,
+    PLP_DWT_WAVELET_COIF3,
+    PLP_DWT_WAVELET_COIF4,
+    PLP_DWT_WAVELET_COIF5,
+    PLP_DWT_WAVELET_COIF6,
+    PLP_DWT_WAVELET_COIF7,
+    PLP_DWT_WAVELET_COIF8,
+    PLP_DWT_WAVELET_COIF9,
     PLP_DWT_WAVELET_COIF10,
     PLP_DWT_WAVELET_COIF11,
     PLP_DWT_WAVELET_COIF12,
@@ -1813,15 +2841,432 @@ typedef struct {
     int8_t *pDstD;   // ouput buffer with Detailed coefficients
 } plp_dwt_instance_q8;
 
+/** -------------------------------------------------------
+    @struct plp_idwt_instance_f32
+    @brief Instance structure for F32 parallel inverse dwt.
+    @param[in]  pSrcA     points to the Approximate coefficients
+    @param[in]  pSrcD     points to the Detailed coefficients
+    @param[in]  length    length of the output buffer
+    @param[in]  wavelet   wavelet structure used for the decomposition
+    @param[in]  nPE       number of parallel processing units
+
+    @param[out] pDst      points to the output buffer with the reconstructed signal
+*/
+typedef struct {
+    const float32_t *pSrcA;  // points to the Approximate coefficients
+    const float32_t *pSrcD;  // points to the Detailed coefficients
+    uint32_t length;        // length of output buffer
+    plp_dwt_wavelet_f32 wavelet; // wavelet structure used for the decomposition
+    uint32_t nPE;           // number of processing units
+
+    float32_t *pDst;   // output buffer with the reconstructed signal
+} plp_idwt_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_idwt_instance_q32
+    @brief Instance structure for Q32 parallel inverse dwt.
+    @param[in]  pSrcA     points to the Approximate coefficients
+    @param[in]  pSrcD     points to the Detailed coefficients
+    @param[in]  length    length of the output buffer
+    @param[in]  wavelet   wavelet structure used for the decomposition
+    @param[in]  nPE       number of parallel processing units
+
+    @param[out] pDst      points to the output buffer with the reconstructed signal
+*/
+typedef struct {
+    const int32_t *pSrcA;  // points to the Approximate coefficients
+    const int32_t *pSrcD;  // points to the Detailed coefficients
+    uint32_t length;        // length of output buffer
+    plp_dwt_wavelet_q32 wavelet; // wavelet structure used for the decomposition
+    uint32_t nPE;           // number of processing units
+
+    int32_t *pDst;   // output buffer with the reconstructed signal
+} plp_idwt_instance_q32;
+
+/** -------------------------------------------------------
+    @struct plp_idwt_instance_q16
+    @brief Instance structure for Q16 parallel inverse dwt.
+    @param[in]  pSrcA     points to the Approximate coefficients
+    @param[in]  pSrcD     points to the Detailed coefficients
+    @param[in]  length    length of the output buffer
+    @param[in]  wavelet   wavelet structure used for the decomposition
+    @param[in]  nPE       number of parallel processing units
+
+    @param[out] pDst      points to the output buffer with the reconstructed signal
+*/
+typedef struct {
+    const int16_t *pSrcA;  // points to the Approximate coefficients
+    const int16_t *pSrcD;  // points to the Detailed coefficients
+    uint32_t length;        // length of output buffer
+    plp_dwt_wavelet_q16 wavelet; // wavelet structure used for the decomposition
+    uint32_t nPE;           // number of processing units
+
+    int16_t *pDst;   // output buffer with the reconstructed signal
+} plp_idwt_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_idwt_instance_q8
+    @brief Instance structure for Q8 parallel inverse dwt.
+    @param[in]  pSrcA     points to the Approximate coefficients
+    @param[in]  pSrcD     points to the Detailed coefficients
+    @param[in]  length    length of the output buffer
+    @param[in]  wavelet   wavelet structure used for the decomposition
+    @param[in]  nPE       number of parallel processing units
+
+    @param[out] pDst      points to the output buffer with the reconstructed signal
+*/
+typedef struct {
+    const int8_t *pSrcA;  // points to the Approximate coefficients
+    const int8_t *pSrcD;  // points to the Detailed coefficients
+    uint32_t length;        // length of output buffer
+    plp_dwt_wavelet_q8 wavelet; // wavelet structure used for the decomposition
+    uint32_t nPE;           // number of processing units
+
+    int8_t *pDst;   // output buffer with the reconstructed signal
+} plp_idwt_instance_q8;
+
+/** -------------------------------------------------------
+    @struct plp_dwt_stream_level_f32
+    @brief State of one level of the streaming multilevel DWT (see plp_dwt_dec_f32_stream).
+           The window holds the part of the edge extended level input which is still needed.
+    @param[in]  pWin      points to the window on the extended input of the level (L1)
+    @param[in]  pDstD     points to the Detailed coefficients of the level
+    @param[in]  inLen     length of the input of the level
+    @param[in]  outLen    number of coefficients of the level
+    @param[in]  base      index of the first window sample in the extended input
+    @param[in]  fill      number of samples in the window
+    @param[in]  pushed    number of input samples received so far
+    @param[in]  next      index of the next coefficient to compute
+    @param[in]  ready     set once the left edge extension is in the window
+    @param[in]  done      set once the right edge extension is in the window
+*/
+typedef struct {
+    float32_t *pWin;   // window on the extended level input
+    float32_t *pDstD;  // Detailed coefficients of the level
+    uint32_t inLen;    // length of the level input
+    uint32_t outLen;   // number of coefficients of the level
+    uint32_t base;     // index of the first window sample in the extended input
+    uint32_t fill;     // number of samples in the window
+    uint32_t pushed;   // number of input samples received
+    uint32_t next;     // index of the next coefficient
+    uint8_t ready;     // left edge extension done
+    uint8_t done;      // right edge extension done
+} plp_dwt_stream_level_f32;
+
+/** -------------------------------------------------------
+    @struct plp_dwt_dec_stream_instance_f32
+    @brief Instance structure for the streaming multilevel DWT (see plp_dwt_dec_f32_stream).
+    @param[in]  pSrc      points to the input signal (L2)
+    @param[in]  length    length of the input signal
+    @param[in]  wavelet   wavelet structure with the filters in L1
+    @param[in]  mode      boundary extension mode
+    @param[in]  levels    number of decomposition levels
+    @param[in]  nPE       number of parallel processing units
+    @param[in]  pLevels   points to the state of each level
+    @param[in]  pTile     points to the two L1 buffers the input tiles are loaded into
+    @param[in]  tileLen   number of samples of a full input tile
+    @param[out] pDstA     points to the final Approximate coefficients
+
+    @param[in]  pIn       input of the current step, set by core 0
+    @param[in]  pOutA     Approximate output of the current step, set by core 0
+    @param[in]  pOutD     Detailed output of the current step, set by core 0
+    @param[in]  count     number of samples of the current step, set by core 0
+*/
+typedef struct {
+    const float32_t *pSrc;          // input signal (L2)
+    uint32_t length;                // length of the input signal
+    plp_dwt_wavelet_f32 wavelet;    // wavelet with the filters in L1
+    plp_dwt_extension_mode mode;    // boundary extension mode
+    uint32_t levels;                // number of decomposition levels
+    uint32_t nPE;                   // number of processing units
+    plp_dwt_stream_level_f32 *pLevels; // state of each level
+    float32_t *pTile[2];            // input tile buffers (L1)
+    uint32_t tileLen;               // samples of a full input tile
+    float32_t *pDstA;               // final Approximate coefficients
+
+    const float32_t *pIn;           // input of the current step
+    float32_t *pOutA;               // Approximate output of the current step
+    float32_t *pOutD;               // Detailed output of the current step
+    uint32_t count;                 // samples of the current step
+} plp_dwt_dec_stream_instance_f32;
+
+
+/** -------------------------------------------------------
+    @struct plp_dwt2d_instance_f32
+    @brief Instance structure for F32 parallel 2D dwt.
+    @param[in]  pSrc      points to the input image (L2)
+    @param[in]  rows      number of rows of the image
+    @param[in]  cols      number of columns of the image
+    @param[in]  wavelet   wavelet structure for calculating DWT
+    @param[in]  mode      boundary extension mode
+    @param[in]  nPE       number of parallel processing units
+    @param[in]  pBuffer   points to PLP_DWT2D_BUFFER_LENGTH values per core (L1)
+    @param[in]  pTemp     points to the row pass result of 2*rows*PLP_DWT_OUTPUT_LENGTH(cols) values (L2)
+
+    @param[out] pDstA     points to the Approximate coefficients (LL)
+    @param[out] pDstH     points to the Horizontal detail coefficients (LH)
+    @param[out] pDstV     points to the Vertical detail coefficients (HL)
+    @param[out] pDstD     points to the Diagonal detail coefficients (HH)
+*/
+typedef struct {
+    const float32_t *pSrc;  // points to the input image
+    uint32_t rows;          // number of rows of the image
+    uint32_t cols;          // number of columns of the image
+    plp_dwt_wavelet_f32 wavelet; // wavelet structure for calculating DWT
+    plp_dwt_extension_mode mode; // boundary extension mode
+    uint32_t nPE;           // number of processing units
+    float32_t *pBuffer;    // tile and line buffers of the cores
+    float32_t *pTemp;      // result of the row pass
+
+    float32_t *pDstA;   // Approximate coefficients
+    float32_t *pDstH;   // Horizontal detail coefficients
+    float32_t *pDstV;   // Vertical detail coefficients
+    float32_t *pDstD;   // Diagonal detail coefficients
+} plp_dwt2d_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_idwt2d_instance_f32
+    @brief Instance structure for F32 parallel inverse 2D dwt.
+    @param[in]  pSrcA     points to the Approximate coefficients (L2)
+    @param[in]  pSrcH     points to the Horizontal detail coefficients (L2)
+    @param[in]  pSrcV     points to the Vertical detail coefficients (L2)
+    @param[in]  pSrcD     points to the Diagonal detail coefficients (L2)
+    @param[in]  rows      number of rows of each coefficient matrix
+    @param[in]  cols      number of columns of each coefficient matrix
+    @param[in]  wavelet   wavelet structure used for the decomposition
+    @param[in]  nPE       number of parallel processing units
+    @param[in]  pBuffer   points to PLP_IDWT2D_BUFFER_LENGTH values per core (L1)
+    @param[in]  pTemp     points to the column pass result of 2*PLP_IDWT_OUTPUT_LENGTH(rows)*cols values (L2)
+
+    @param[out] pDst      points to the reconstructed image (L2)
+*/
+typedef struct {
+    const float32_t *pSrcA;  // Approximate coefficients
+    const float32_t *pSrcH;  // Horizontal detail coefficients
+    const float32_t *pSrcV;  // Vertical detail coefficients
+    const float32_t *pSrcD;  // Diagonal detail coefficients
+    uint32_t rows;          // number of rows of each coefficient matrix
+    uint32_t cols;          // number of columns of each coefficient matrix
+    plp_dwt_wavelet_f32 wavelet; // wavelet structure used for the decomposition
+    uint32_t nPE;           // number of processing units
+    float32_t *pBuffer;    // tile and line buffers of the cores
+    float32_t *pTemp;      // result of the column pass
+
+    float32_t *pDst;   // reconstructed image
+} plp_idwt2d_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_dwt2d_instance_q16
+    @brief Instance structure for Q16 parallel 2D dwt.
+    @param[in]  pSrc      points to the input image (L2)
+    @param[in]  rows      number of rows of the image
+    @param[in]  cols      number of columns of the image
+    @param[in]  wavelet   wavelet structure for calculating DWT
+    @param[in]  mode      boundary extension mode
+    @param[in]  nPE       number of parallel processing units
+    @param[in]  pBuffer   points to PLP_DWT2D_BUFFER_LENGTH values per core (L1)
+    @param[in]  pTemp     points to the row pass result of 2*rows*PLP_DWT_OUTPUT_LENGTH(cols) values (L2)
+
+    @param[out] pDstA     points to the Approximate coefficients (LL)
+    @param[out] pDstH     points to the Horizontal detail coefficients (LH)
+    @param[out] pDstV     points to the Vertical detail coefficients (HL)
+    @param[out] pDstD     points to the Diagonal detail coefficients (HH)
+*/
+typedef struct {
+    const int16_t *pSrc;  // points to the input image
+    uint32_t rows;          // number of rows of the image
+    uint32_t cols;          // number of columns of the image
+    plp_dwt_wavelet_q16 wavelet; // wavelet structure for calculating DWT
+    plp_dwt_extension_mode mode; // boundary extension mode
+    uint32_t nPE;           // number of processing units
+    int16_t *pBuffer;    // tile and line buffers of the cores
+    int16_t *pTemp;      // result of the row pass
+
+    int16_t *pDstA;   // Approximate coefficients
+    int16_t *pDstH;   // Horizontal detail coefficients
+    int16_t *pDstV;   // Vertical detail coefficients
+    int16_t *pDstD;   // Diagonal detail coefficients
+} plp_dwt2d_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_idwt2d_instance_q16
+    @brief Instance structure for Q16 parallel inverse 2D dwt.
+    @param[in]  pSrcA     points to the Approximate coefficients (L2)
+    @param[in]  pSrcH     points to the Horizontal detail coefficients (L2)
+    @param[in]  pSrcV     points to the Vertical detail coefficients (L2)
+    @param[in]  pSrcD     points to the Diagonal detail coefficients (L2)
+    @param[in]  rows      number of rows of each coefficient matrix
+    @param[in]  cols      number of columns of each coefficient matrix
+    @param[in]  wavelet   wavelet structure used for the decomposition
+    @param[in]  nPE       number of parallel processing units
+    @param[in]  pBuffer   points to PLP_IDWT2D_BUFFER_LENGTH values per core (L1)
+    @param[in]  pTemp     points to the column pass result of 2*PLP_IDWT_OUTPUT_LENGTH(rows)*cols values (L2)
+
+    @param[out] pDst      points to the reconstructed image (L2)
+*/
+typedef struct {
+    const int16_t *pSrcA;  // Approximate coefficients
+    const int16_t *pSrcH;  // Horizontal detail coefficients
+    const int16_t *pSrcV;  // Vertical detail coefficients
+    const int16_t *pSrcD;  // Diagonal detail coefficients
+    uint32_t rows;          // number of rows of each coefficient matrix
+    uint32_t cols;          // number of columns of each coefficient matrix
+    plp_dwt_wavelet_q16 wavelet; // wavelet structure used for the decomposition
+    uint32_t nPE;           // number of processing units
+    int16_t *pBuffer;    // tile and line buffers of the cores
+    int16_t *pTemp;      // result of the column pass
+
+    int16_t *pDst;   // reconstructed image
+} plp_idwt2d_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_dwt2d_instance_q8
+    @brief Instance structure for Q8 parallel 2D dwt.
+    @param[in]  pSrc      points to the input image (L2)
+    @param[in]  rows      number of rows of the image
+    @param[in]  cols      number of columns of the image
+    @param[in]  wavelet   wavelet structure for calculating DWT
+    @param[in]  mode      boundary extension mode
+    @param[in]  nPE       number of parallel processing units
+    @param[in]  pBuffer   points to PLP_DWT2D_BUFFER_LENGTH values per core (L1)
+    @param[in]  pTemp     points to the row pass result of 2*rows*PLP_DWT_OUTPUT_LENGTH(cols) values (L2)
+
+    @param[out] pDstA     points to the Approximate coefficients (LL)
+    @param[out] pDstH     points to the Horizontal detail coefficients (LH)
+    @param[out] pDstV     points to the Vertical detail coefficients (HL)
+    @param[out] pDstD     points to the Diagonal detail coefficients (HH)
+*/
+typedef struct {
+    const int8_t *pSrc;  // points to the input image
+    uint32_t rows;          // number of rows of the image
+    uint32_t cols;          // number of columns of the image
+    plp_dwt_wavelet_q8 wavelet; // wavelet structure for calculating DWT
+    plp_dwt_extension_mode mode; // boundary extension mode
+    uint32_t nPE;           // number of processing units
+    int8_t *pBuffer;    // tile and line buffers of the cores
+    int8_t *pTemp;      // result of the row pass
+
+    int8_t *pDstA;   // Approximate coefficients
+    int8_t *pDstH;   // Horizontal detail coefficients
+    int8_t *pDstV;   // Vertical detail coefficients
+    int8_t *pDstD;   // Diagonal detail coefficients
+} plp_dwt2d_instance_q8;
+
+/** -------------------------------------------------------
+    @struct plp_idwt2d_instance_q8
+    @brief Instance structure for Q8 parallel inverse 2D dwt.
+    @param[in]  pSrcA     points to the Approximate coefficients (L2)
+    @param[in]  pSrcH     points to the Horizontal detail coefficients (L2)
+    @param[in]  pSrcV     points to the Vertical detail coefficients (L2)
+    @param[in]  pSrcD     points to the Diagonal detail coefficients (L2)
+    @param[in]  rows      number of rows of each coefficient matrix
+    @param[in]  cols      number of columns of each coefficient matrix
+    @param[in]  wavelet   wavelet structure used for the decomposition
+    @param[in]  nPE       number of parallel processing units
+    @param[in]  pBuffer   points to PLP_IDWT2D_BUFFER_LENGTH values per core (L1)
+    @param[in]  pTemp     points to the column pass result of 2*PLP_IDWT_OUTPUT_LENGTH(rows)*cols values (L2)
+
+    @param[out] pDst      points to the reconstructed image (L2)
+*/
+typedef struct {
+    const int8_t *pSrcA;  // Approximate coefficients
+    const int8_t *pSrcH;  // Horizontal detail coefficients
+    const int8_t *pSrcV;  // Vertical detail coefficients
+    const int8_t *pSrcD;  // Diagonal detail coefficients
+    uint32_t rows;          // number of rows of each coefficient matrix
+    uint32_t cols;          // number of columns of each coefficient matrix
+    plp_dwt_wavelet_q8 wavelet; // wavelet structure used for the decomposition
+    uint32_t nPE;           // number of processing units
+    int8_t *pBuffer;    // tile and line buffers of the cores
+    int8_t *pTemp;      // result of the column pass
+
+    int8_t *pDst;   // reconstructed image
+} plp_idwt2d_instance_q8;
 
 #define PLP_DWT_DEC_LEN(SIG_LEN, WAVELET, LEVEL) plp_dwt_dec_len(SIG_LEN, WAVELET.length, LEVEL)
 #define PLP_DWT_DEC_TEMP_LEN(SRC_LEN, WAVELET_LEN) (((SRC_LEN+WAVELET_LEN-1)/2 + ((SRC_LEN+WAVELET_LEN-1)/2 + WAVELET_LEN-1))/2)
 #define PLP_DWT_OUTPUT_LENGTH(SIG_LEN, WAVELET_LEN) ((SIG_LEN + WAVELET_LEN - 1) >> 1)
+#define PLP_IDWT_OUTPUT_LENGTH(COEF_LEN, WAVELET_LEN) (2 * (COEF_LEN) - (WAVELET_LEN) + 2)
+
+/* Values of a line buffer, rounded up such that every line starts word aligned */
+#define PLP_DWT2D_LINE_LENGTH(LEN) (((LEN) + 3) & ~3U)
+#define PLP_DWT2D_MAX_DIM(ROWS, COLS) ((ROWS) > (COLS) ? (ROWS) : (COLS))
+/* Adjacent columns moved by each 2D transfer of plp_dwt2d_* and plp_idwt2d_* */
+#ifndef PLP_DWT2D_TILE_COLS
+#define PLP_DWT2D_TILE_COLS 4
+#endif
+#define PLP_DWT2D_TILE_LENGTH(LEN) PLP_DWT2D_LINE_LENGTH(PLP_DWT2D_TILE_COLS * (LEN))
+/* Values of pBuffer needed per core by plp_dwt2d_* (two input tiles, two output tiles and the
+ * input and output lines of one column) */
+#define PLP_DWT2D_BUFFER_LENGTH(ROWS, COLS, WAVELET_LEN)                                           \
+    (2 * PLP_DWT2D_TILE_LENGTH(PLP_DWT2D_MAX_DIM(ROWS, COLS)) +                                    \
+     2 * PLP_DWT2D_TILE_LENGTH(                                                                    \
+         PLP_DWT_OUTPUT_LENGTH(PLP_DWT2D_MAX_DIM(ROWS, COLS), WAVELET_LEN)) +                      \
+     PLP_DWT2D_LINE_LENGTH(PLP_DWT2D_MAX_DIM(ROWS, COLS)) +                                        \
+     2 * PLP_DWT2D_LINE_LENGTH(PLP_DWT_OUTPUT_LENGTH(PLP_DWT2D_MAX_DIM(ROWS, COLS), WAVELET_LEN)))
+/* Values of pBuffer needed per core by plp_idwt2d_* (two pairs of input tiles, an output tile and
+ * the input and output lines of one column) */
+#define PLP_IDWT2D_BUFFER_LENGTH(ROWS, COLS, WAVELET_LEN)                                          \
+    (4 * PLP_DWT2D_TILE_LENGTH(PLP_DWT2D_MAX_DIM(ROWS, COLS)) +                                    \
+     PLP_DWT2D_TILE_LENGTH(PLP_IDWT_OUTPUT_LENGTH(PLP_DWT2D_MAX_DIM(ROWS, COLS), WAVELET_LEN)) +   \
+     2 * PLP_DWT2D_LINE_LENGTH(PLP_DWT2D_MAX_DIM(ROWS, COLS)) +                                    \
+     PLP_DWT2D_LINE_LENGTH(PLP_IDWT_OUTPUT_LENGTH(PLP_DWT2D_MAX_DIM(ROWS, COLS), WAVELET_LEN)))
 
 uint32_t plp_dwt_max_level(uint32_t sig_len, uint32_t wavelet_len);
 
 uint32_t plp_dwt_dec_len(uint32_t sig_len, uint32_t wavelet_len, uint32_t level);
 
+uint32_t plp_dwt_levels(uint32_t sig_len, uint32_t wavelet_len, uint32_t level);
+
+uint32_t plp_dwt_level_len(uint32_t sig_len, uint32_t wavelet_len, uint32_t level);
+
+/** -------------------------------------------------------
+    @brief      Scratch memory needed by plp_dwt_f32, plp_dwt_dec_f32, plp_idwt_f32,
+                plp_dwt_rec_f32 and their parallel variants (see plp_l1_arena_use).
+    @param[in]  wavelet  wavelet structure for calculating DWT
+    @return     number of bytes
+*/
+
+uint32_t plp_dwt_f32_get_workspace_size(const plp_dwt_wavelet_f32 wavelet);
+
+/** -------------------------------------------------------
+    @brief      Scratch memory needed by plp_dwt_q32, plp_dwt_dec_q32, plp_idwt_q32,
+                plp_dwt_rec_q32 and their parallel variants (see plp_l1_arena_use).
+    @param[in]  wavelet  wavelet structure for calculating DWT
+    @return     number of bytes
+*/
+
+uint32_t plp_dwt_q32_get_workspace_size(const plp_dwt_wavelet_q32 wavelet);
+
+/** -------------------------------------------------------
+    @brief      Scratch memory needed by plp_dwt_q16, plp_dwt_dec_q16, plp_idwt_q16,
+                plp_dwt_rec_q16 and their parallel variants (see plp_l1_arena_use).
+    @param[in]  wavelet  wavelet structure for calculating DWT
+    @return     number of bytes
+*/
+
+uint32_t plp_dwt_q16_get_workspace_size(const plp_dwt_wavelet_q16 wavelet);
+
+/** -------------------------------------------------------
+    @brief      Scratch memory needed by plp_dwt_q8, plp_dwt_dec_q8, plp_idwt_q8,
+                plp_dwt_rec_q8 and their parallel variants (see plp_l1_arena_use).
+    @param[in]  wavelet  wavelet structure for calculating DWT
+    @return     number of bytes
+*/
+
+uint32_t plp_dwt_q8_get_workspace_size(const plp_dwt_wavelet_q8 wavelet);
+
+/** -------------------------------------------------------
+    @brief      Scratch memory needed by plp_dwt_dec_f32_stream (see plp_l1_arena_use).
+    @param[in]  length   length of the input signal
+    @param[in]  wavelet  wavelet structure for calculating DWT
+    @param[in]  level    levels of wavelet decomposition (0 for maximal decomposition)
+    @return     number of bytes
+*/
+uint32_t plp_dwt_dec_f32_stream_get_workspace_size(uint32_t length,
+                                                   const plp_dwt_wavelet_f32 wavelet,
+                                                   uint32_t level);
+
 /** -------------------------------------------------------
     @brief Glue code for parallel dot product of 32-bit integer vectors.
     @param[in]  pSrcA      points to the first input vector
@@ -1838,6 +3283,22 @@ void plp_dot_prod_i32_parallel(const int32_t *__restrict__ pSrcA,
                                uint32_t nPE,
                                int32_t *__restrict__ pRes);
 
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 32-bit integer vectors in L2.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_i32_stream(const int32_t *__restrict__ pSrcA,
+                             const int32_t *__restrict__ pSrcB,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             int32_t *__restrict__ pRes);
+
 /** -------------------------------------------------------
     @brief Glue code for parallel dot product of 32-bit fixed point vectors.
     @param[in]  pSrcA      points to the first input vector
@@ -1873,9 +3334,25 @@ void plp_dot_prod_f32_parallel(const float32_t *__restrict__ pSrcA,
                                float32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Parallel dot product with interleaved access of 32-bit integer vectors kernel for XPULPV2
-    extension.
-    @param[in]  S     points to the instance structure for integer parallel dot product
+    @brief Glue code for dot product of 32-bit float vectors in L2.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_f32_stream(const float32_t *__restrict__ pSrcA,
+                             const float32_t *__restrict__ pSrcB,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Parallel dot product with interleaved access of 32-bit integer vectors kernel for XPULPV2
+    extension.
+    @param[in]  S     points to the instance structure for integer parallel dot product
     @return     none
 */
 
@@ -2379,6 +3856,22 @@ void plp_add_i32(const int32_t * pSrcA,
                  int32_t * pDst,
                  uint32_t blockSize);
 
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element addition of 32-bit integer vectors in L2.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @return     none
+*/
+
+void plp_add_i32_stream(const int32_t *pSrcA,
+                        const int32_t *pSrcB,
+                        int32_t *pDst,
+                        uint32_t blockSize,
+                        uint32_t nPE);
+
 /** -------------------------------------------------------
     @brief Element-by-element addition of 32-bit integer vectors kernel for RV32IM extension.
     @param[in]     pSrcA      points to first input vector
@@ -2505,6 +3998,22 @@ void plp_mult_i32(const int32_t * pSrcA,
                  int32_t * pDst,
                  uint32_t blockSize);
 
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element multiplication of 32-bit integer vectors in L2.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @return     none
+*/
+
+void plp_mult_i32_stream(const int32_t *pSrcA,
+                         const int32_t *pSrcB,
+                         int32_t *pDst,
+                         uint32_t blockSize,
+                         uint32_t nPE);
+
 /** -------------------------------------------------------
     @brief Element-by-element multiplication of 32-bit integer vectors kernel for RV32IM extension.
     @param[in]     pSrcA      points to first input vector
@@ -2631,6 +4140,22 @@ void plp_mult_f32(const float32_t * pSrcA,
                  float32_t * pDst,
                  uint32_t blockSize);
 
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element multiplication of 32-bit float vectors in L2.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[out] pDst       points to the output vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @return     none
+*/
+
+void plp_mult_f32_stream(const float32_t *pSrcA,
+                         const float32_t *pSrcB,
+                         float32_t *pDst,
+                         uint32_t blockSize,
+                         uint32_t nPE);
+
 /** -------------------------------------------------------
     @brief Element-by-element multiplication of 32-bit float vectors kernel for XPULPV2 extension.
     @param[in]     pSrcA      points to first input vector
@@ -3206,6 +4731,220 @@ void plp_scale_f32(const float32_t *__restrict__ pSrc, float32_t scaleFactor, fl
 
 void plp_scale_f32s_xpulpv2(const float32_t *__restrict__ pSrc, float32_t scaleFactor, float32_t *__restrict__ pDst, uint32_t blockSize);
 
+/** -------------------------------------------------------
+  @brief      Glue code of the fused elementwise pipeline for 32-bit floats
+  @param[in]     pSrc       points to the input vector
+  @param[in]     pOps       points to the stages of the pipeline
+  @param[in]     numOps     number of stages
+  @param[in]     blockSize  number of samples in each vector
+  @param[out]    pDst       points to the output vector
+  @return     none
+*/
+
+void plp_pipeline_f32(const float32_t *pSrc,
+                      const plp_pipeline_op_f32 *pOps,
+                      uint32_t numOps,
+                      uint32_t blockSize,
+                      float32_t *pDst);
+
+/** -------------------------------------------------------
+  @brief      Fused elementwise pipeline for 32-bit floats on XpulpV2
+  @param[in]     pSrc       points to the input vector
+  @param[in]     pOps       points to the stages of the pipeline
+  @param[in]     numOps     number of stages
+  @param[in]     blockSize  number of samples in each vector
+  @param[out]    pDst       points to the output vector
+  @return     none
+*/
+
+void plp_pipeline_f32s_xpulpv2(const float32_t *pSrc,
+                               const plp_pipeline_op_f32 *pOps,
+                               uint32_t numOps,
+                               uint32_t blockSize,
+                               float32_t *pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code of the parallel fused elementwise pipeline for 32-bit floats
+  @param[in]     pSrc       points to the input vector
+  @param[in]     pOps       points to the stages of the pipeline
+  @param[in]     numOps     number of stages, at most PLP_PIPELINE_MAX_OPS
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     nPE        number of parallel processing units
+  @param[out]    pDst       points to the output vector
+  @return     none
+*/
+
+void plp_pipeline_f32_parallel(const float32_t *pSrc,
+                               const plp_pipeline_op_f32 *pOps,
+                               uint32_t numOps,
+                               uint32_t blockSize,
+                               uint32_t nPE,
+                               float32_t *pDst);
+
+/** -------------------------------------------------------
+  @brief      Parallel fused elementwise pipeline for 32-bit floats on XpulpV2
+  @param[in]  S     points to the instance structure plp_pipeline_instance_f32
+  @return     none
+*/
+
+void plp_pipeline_f32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+  @brief      Glue code of the fused elementwise pipeline for 16-bit integers
+  @param[in]     pSrc       points to the input vector
+  @param[in]     pOps       points to the stages of the pipeline
+  @param[in]     numOps     number of stages
+  @param[in]     blockSize  number of samples in each vector
+  @param[out]    pDst       points to the output vector
+  @return     none
+*/
+
+void plp_pipeline_i16(const int16_t *pSrc,
+                      const plp_pipeline_op_i16 *pOps,
+                      uint32_t numOps,
+                      uint32_t blockSize,
+                      int16_t *pDst);
+
+/** -------------------------------------------------------
+  @brief      Fused elementwise pipeline for 16-bit integers on RV32IM
+  @param[in]     pSrc       points to the input vector
+  @param[in]     pOps       points to the stages of the pipeline
+  @param[in]     numOps     number of stages
+  @param[in]     blockSize  number of samples in each vector
+  @param[out]    pDst       points to the output vector
+  @return     none
+*/
+
+void plp_pipeline_i16s_rv32im(const int16_t *pSrc,
+                              const plp_pipeline_op_i16 *pOps,
+                              uint32_t numOps,
+                              uint32_t blockSize,
+                              int16_t *pDst);
+
+/** -------------------------------------------------------
+  @brief      Fused elementwise pipeline for 16-bit integers on XpulpV2
+  @param[in]     pSrc       points to the input vector
+  @param[in]     pOps       points to the stages of the pipeline
+  @param[in]     numOps     number of stages
+  @param[in]     blockSize  number of samples in each vector
+  @param[out]    pDst       points to the output vector
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors, additions, subtractions, absolute
+  values and negations are computed on both lanes with a single instruction.
+*/
+
+void plp_pipeline_i16s_xpulpv2(const int16_t *pSrc,
+                               const plp_pipeline_op_i16 *pOps,
+                               uint32_t numOps,
+                               uint32_t blockSize,
+                               int16_t *pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code of the parallel fused elementwise pipeline for 16-bit integers
+  @param[in]     pSrc       points to the input vector
+  @param[in]     pOps       points to the stages of the pipeline
+  @param[in]     numOps     number of stages, at most PLP_PIPELINE_MAX_OPS
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     nPE        number of parallel processing units
+  @param[out]    pDst       points to the output vector
+  @return     none
+*/
+
+void plp_pipeline_i16_parallel(const int16_t *pSrc,
+                               const plp_pipeline_op_i16 *pOps,
+                               uint32_t numOps,
+                               uint32_t blockSize,
+                               uint32_t nPE,
+                               int16_t *pDst);
+
+/** -------------------------------------------------------
+  @brief      Parallel fused elementwise pipeline for 16-bit integers on XpulpV2
+  @param[in]  S     points to the instance structure plp_pipeline_instance_i16
+  @return     none
+*/
+
+void plp_pipeline_i16p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+  @brief      Glue code of the fused elementwise pipeline for 8-bit integers
+  @param[in]     pSrc       points to the input vector
+  @param[in]     pOps       points to the stages of the pipeline
+  @param[in]     numOps     number of stages
+  @param[in]     blockSize  number of samples in each vector
+  @param[out]    pDst       points to the output vector
+  @return     none
+*/
+
+void plp_pipeline_i8(const int8_t *pSrc,
+                     const plp_pipeline_op_i8 *pOps,
+                     uint32_t numOps,
+                     uint32_t blockSize,
+                     int8_t *pDst);
+
+/** -------------------------------------------------------
+  @brief      Fused elementwise pipeline for 8-bit integers on RV32IM
+  @param[in]     pSrc       points to the input vector
+  @param[in]     pOps       points to the stages of the pipeline
+  @param[in]     numOps     number of stages
+  @param[in]     blockSize  number of samples in each vector
+  @param[out]    pDst       points to the output vector
+  @return     none
+*/
+
+void plp_pipeline_i8s_rv32im(const int8_t *pSrc,
+                             const plp_pipeline_op_i8 *pOps,
+                             uint32_t numOps,
+                             uint32_t blockSize,
+                             int8_t *pDst);
+
+/** -------------------------------------------------------
+  @brief      Fused elementwise pipeline for 8-bit integers on XpulpV2
+  @param[in]     pSrc       points to the input vector
+  @param[in]     pOps       points to the stages of the pipeline
+  @param[in]     numOps     number of stages
+  @param[in]     blockSize  number of samples in each vector
+  @param[out]    pDst       points to the output vector
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors, additions, subtractions, absolute
+  values and negations are computed on all four lanes with a single instruction.
+*/
+
+void plp_pipeline_i8s_xpulpv2(const int8_t *pSrc,
+                              const plp_pipeline_op_i8 *pOps,
+                              uint32_t numOps,
+                              uint32_t blockSize,
+                              int8_t *pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code of the parallel fused elementwise pipeline for 8-bit integers
+  @param[in]     pSrc       points to the input vector
+  @param[in]     pOps       points to the stages of the pipeline
+  @param[in]     numOps     number of stages, at most PLP_PIPELINE_MAX_OPS
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     nPE        number of parallel processing units
+  @param[out]    pDst       points to the output vector
+  @return     none
+*/
+
+void plp_pipeline_i8_parallel(const int8_t *pSrc,
+                              const plp_pipeline_op_i8 *pOps,
+                              uint32_t numOps,
+                              uint32_t blockSize,
+                              uint32_t nPE,
+                              int8_t *pDst);
+
+/** -------------------------------------------------------
+  @brief      Parallel fused elementwise pipeline for 8-bit integers on XpulpV2
+  @param[in]  S     points to the instance structure plp_pipeline_instance_i8
+  @return     none
+*/
+
+void plp_pipeline_i8p_xpulpv2(void *S);
+
 /** -------------------------------------------------------
     @brief      Glue code for filling a constant value into a 32-bit integer vector.
     @param[in]  value      input value to be filled
@@ -3305,3809 +5044,3559 @@ void plp_copy_f32s_rv32im(float32_t *__restrict__ pSrc,
                            uint32_t blockSize);
 
 /** -------------------------------------------------------
-    @brief      Glue code for mean value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
+    @brief      Initialize an arena on a user-provided memory region.
+    @param[out] arena  points to the arena
+    @param[in]  pMem   points to the memory region, should be aligned to PLP_L1_ARENA_ALIGN
+    @param[in]  size   size of the memory region in bytes
     @return     none
 */
 
-void plp_mean_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_l1_arena_init(plp_l1_arena *arena, void *pMem, uint32_t size);
 
 /** -------------------------------------------------------
-    @brief      Glue code for mean value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
+    @brief      Allocate memory from the arena.
+    @param[in]  arena  points to the arena
+    @param[in]  size   number of bytes, rounded up to PLP_L1_ARENA_ALIGN
+    @return     pointer to the allocated memory, or NULL if the arena is too small
 */
 
-void plp_mean_f32s_xpulpv2(const float *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           float *__restrict__ pRes);
+void *plp_l1_arena_alloc(plp_l1_arena *arena, uint32_t size);
 
 /** -------------------------------------------------------
-    @brief      Glue code for mean value of a 32-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
+    @brief      Release all memory allocated from the arena.
+    @param[in]  arena  points to the arena
     @return     none
 */
 
-void plp_mean_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+void plp_l1_arena_reset(plp_l1_arena *arena);
 
 /** -------------------------------------------------------
-    @brief      Mean value of a 32-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
+    @brief      Select the arena from which the library allocates its scratch buffers.
+    @param[in]  arena  points to the arena, or NULL to use hal_cl_l1_malloc (default)
     @return     none
 */
 
-void plp_mean_i32s_rv32im(const int32_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int32_t *__restrict__ pRes);
+void plp_l1_arena_use(plp_l1_arena *arena);
 
 /** -------------------------------------------------------
-    @brief      Mean value of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    mean value returned here
-    @return     none
+    @brief      Allocate a scratch buffer for a library function (used internally).
+    @param[in]  size  number of bytes
+    @return     pointer to the buffer, or NULL if there is not enough memory
 */
 
-void plp_mean_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           int32_t *__restrict__ pRes);
+void *plp_l1_scratch_alloc(uint32_t size);
 
 /** -------------------------------------------------------
-    @brief      Glue code for mean value of a 16-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
+    @brief      Free a scratch buffer allocated with plp_l1_scratch_alloc (used internally).
+    @param[in]  ptr   points to the buffer
+    @param[in]  size  number of bytes, same as for plp_l1_scratch_alloc
     @return     none
 */
 
-void plp_mean_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+void plp_l1_scratch_free(void *ptr, uint32_t size);
 
 /** -------------------------------------------------------
-    @brief      Mean value of a 16-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
+    @brief      Run a function on core 0 while the other cores of the team stay parked.
+    @param[in]  nPE    number of cores in the team
+    @param[in]  entry  function executed by core 0
+    @param[in]  arg    argument passed to entry
     @return     none
 */
 
-void plp_mean_i16s_rv32im(const int16_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int16_t *__restrict__ pRes);
+void plp_cl_team_run(uint32_t nPE, void (*entry)(void *), void *arg);
 
 /** -------------------------------------------------------
-    @brief      Mean value of a 16-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    mean value returned here
-    @return     none
+    @brief      Number of cores of the persistent team of the caller.
+    @return     number of cores of the team when called by core 0 inside plp_cl_team_run, 0
+                otherwise
 */
 
-void plp_mean_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           int16_t *__restrict__ pRes);
+uint32_t plp_cl_team_size(void);
 
 /** -------------------------------------------------------
-    @brief      Glue code for mean value of a 8-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
+    @brief      Execute a parallel kernel on nPE cores (used by the parallel glue code).
+    @param[in]  nPE     number of cores executing the kernel
+    @param[in]  kernel  parallel kernel
+    @param[in]  args    points to the instance structure passed to the kernel
     @return     none
 */
 
-void plp_mean_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+void plp_cl_team_fork(uint32_t nPE, void (*kernel)(void *), void *args);
 
 /** -------------------------------------------------------
-    @brief      Mean value of a 8-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
+    @brief      Initialize an empty operation list.
+    @param[out] list    points to the operation list
+    @param[in]  pOps    points to the array holding the operations
+    @param[in]  maxOps  capacity of the pOps array
     @return     none
 */
 
-void plp_mean_i8s_rv32im(const int8_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int8_t *__restrict__ pRes);
+void plp_cl_oplist_init(plp_cl_oplist *list, plp_cl_op *pOps, uint32_t maxOps);
 
 /** -------------------------------------------------------
-    @brief      Mean value of a 8-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    mean value returned here
-    @return     none
+    @brief      Append a parallel kernel to an operation list.
+    @param[in]  list    points to the operation list
+    @param[in]  kernel  parallel kernel
+    @param[in]  args    points to the instance structure passed to the kernel
+    @return     0 on success, -1 if the list is full
 */
 
-void plp_mean_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int8_t *__restrict__ pRes);
+int32_t plp_cl_oplist_add(plp_cl_oplist *list, void (*kernel)(void *), void *args);
 
 /** -------------------------------------------------------
-    @brief      Glue code for max value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
+    @brief      Execute all kernels of an operation list on nPE cores with a single fork.
+    @param[in]  list  points to the operation list
+    @param[in]  nPE   number of cores executing the kernels
     @return     none
 */
 
-void plp_max_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_cl_oplist_run(const plp_cl_oplist *list, uint32_t nPE);
 
 /** -------------------------------------------------------
-    @brief      Kernel for max value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
+    @brief      Apply an operation to vectors in L2, streaming them through L1 with double buffering.
+    @param[in]  op         points to the operation
+    @param[in]  pSrcA      points to the first input vector (L2)
+    @param[in]  pSrcB      points to the second input vector (L2), NULL if op->numSrc is 1
+    @param[out] pDst       points to the output vector (L2), NULL for reductions
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of cores processing each tile
+    @param[out] pRes       result of reductions returned here, NULL for elementwise operations
     @return     none
 */
 
-void plp_max_f32s_xpulpv2(const float *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          float *__restrict__ pRes);
+void plp_stream(const plp_stream_op *op,
+                const void *pSrcA,
+                const void *pSrcB,
+                void *pDst,
+                uint32_t blockSize,
+                uint32_t nPE,
+                void *pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for max value of a 32-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
-    @return     none
+    @brief      Scratch memory needed by plp_stream (see plp_l1_arena_use).
+    @param[in]  op   points to the operation
+    @param[in]  nPE  number of cores processing each tile
+    @return     size in bytes
 */
 
-void plp_max_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+uint32_t plp_stream_get_workspace_size(const plp_stream_op *op, uint32_t nPE);
 
 /** -------------------------------------------------------
-    @brief      Max value of a 32-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
-    @return     none
+  @brief      Configure and start the performance counters used by the profiling hooks.
+  @return     none
 */
 
-void plp_max_i32s_rv32im(const int32_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int32_t *__restrict__ pRes);
+void plp_profile_start();
 
 /** -------------------------------------------------------
-    @brief      Max value of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    max value returned here
-    @return     none
+  @brief      Stop the performance counters used by the profiling hooks.
+  @return     none
 */
 
-void plp_max_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int32_t *__restrict__ pRes);
+void plp_profile_stop();
 
 /** -------------------------------------------------------
-    @brief      Glue code for max value of a 16-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
-    @return     none
+  @brief      Clear the counters of all profiled functions.
+  @return     none
 */
 
-void plp_max_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+void plp_profile_reset();
 
 /** -------------------------------------------------------
-    @brief      Max value of a 16-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
-    @return     none
+  @brief      Print the profiling table in CSV format.
+  @return     none
 */
 
-void plp_max_i16s_rv32im(const int16_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int16_t *__restrict__ pRes);
+void plp_profile_dump();
 
 /** -------------------------------------------------------
-    @brief      Max value of a 16-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    max value returned here
-    @return     none
+  @brief      Begin a profiled call (used by PLP_PROFILE_FUNC).
+  @param[in]  entry  entry of the called function
+  @return     state of the call, passed to plp_profile_end
 */
 
-void plp_max_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int16_t *__restrict__ pRes);
+plp_profile_scope plp_profile_begin(plp_profile_entry *entry);
 
 /** -------------------------------------------------------
-    @brief      Glue code for max value of a 8-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
-    @return     none
+  @brief      End a profiled call (used by PLP_PROFILE_FUNC).
+  @param[in]  scope  state returned by plp_profile_begin
+  @return     none
 */
 
-void plp_max_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+void plp_profile_end(plp_profile_scope *scope);
 
 /** -------------------------------------------------------
-    @brief      Max value of a 8-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
-    @return     none
+  @brief      Entry of the innermost profiled call which is running (used by plp_cl_team_fork).
+  @return     points to the entry, or NULL outside of profiled calls
 */
 
-void plp_max_i8s_rv32im(const int8_t *__restrict__ pSrc,
-                        uint32_t blockSize,
-                        int8_t *__restrict__ pRes);
+plp_profile_entry *plp_profile_current();
 
 /** -------------------------------------------------------
-    @brief      Max value of a 8-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    max value returned here
-    @return     none
+  @brief      Wrap a parallel kernel such that each core counts its execution (used by
+              plp_cl_team_fork).
+  @param[in]  args  points to a plp_profile_kernel_args structure
+  @return     none
 */
 
-void plp_max_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int8_t *__restrict__ pRes);
+void plp_profile_kernel(void *args);
 
 /** -------------------------------------------------------
-    @brief      Glue code for min value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
-    @return     none
+  @brief      Clear the recorded events and start recording the parallel kernels.
+  @return     none
 */
 
-void plp_min_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_trace_start();
 
 /** -------------------------------------------------------
-    @brief      Kernel for min value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
-    @return     none
+  @brief      Stop recording the parallel kernels.
+  @return     none
 */
 
-void plp_min_f32s_xpulpv2(const float *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          float *__restrict__ pRes);
+void plp_trace_stop();
 
 /** -------------------------------------------------------
-    @brief      Glue code for min value of a 32-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
-    @return     none
+  @brief      Print the recorded events in CSV format.
+  @return     none
 */
 
-void plp_min_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+void plp_trace_dump();
 
 /** -------------------------------------------------------
-    @brief      Min value of a 32-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
-    @return     none
+  @brief      Read the events recorded by one core, e.g. to check them in a test.
+  @param[in]  core_id  core which recorded the events
+  @param[out] pEvents  receives the address of the events of the core
+  @return     number of events recorded by the core
 */
 
-void plp_min_i32s_rv32im(const int32_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int32_t *__restrict__ pRes);
+uint32_t plp_trace_read(uint32_t core_id, const plp_trace_event **pEvents);
 
 /** -------------------------------------------------------
-    @brief      Min value of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    min value returned here
-    @return     none
+  @brief      Record the fork of a parallel kernel (used by plp_cl_team_fork).
+  @param[in]  kernel  parallel kernel which is forked
+  @return     index of the fork, PLP_TRACE_NO_FORK if the tracing is stopped
 */
 
-void plp_min_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int32_t *__restrict__ pRes);
+uint32_t plp_trace_fork(void (*kernel)(void *));
 
 /** -------------------------------------------------------
-    @brief      Glue code for min value of a 16-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
-    @return     none
+  @brief      Record the end of a fork (used by plp_cl_team_fork).
+  @param[in]  fork  index returned by plp_trace_fork
+  @return     none
 */
 
-void plp_min_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+void plp_trace_join(uint32_t fork);
 
 /** -------------------------------------------------------
-    @brief      Min value of a 16-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
-    @return     none
+  @brief      Wrap a parallel kernel such that each core records when it starts and finishes it
+              (used by plp_cl_team_fork).
+  @param[in]  args  points to a plp_trace_kernel_args structure
+  @return     none
 */
 
-void plp_min_i16s_rv32im(const int16_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int16_t *__restrict__ pRes);
+void plp_trace_kernel(void *args);
 
 /** -------------------------------------------------------
-    @brief      Min value of a 16-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    min value returned here
-    @return     none
+  @brief      Team barrier which records the arrival and the departure of the core.
+  @return     none
 */
 
-void plp_min_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int16_t *__restrict__ pRes);
+void plp_trace_barrier();
+
+/* With PLP_TRACE, the barriers of the parallel kernels are recorded */
+#ifdef PLP_TRACE
+#define hal_team_barrier() plp_trace_barrier()
+#endif
 
 /** -------------------------------------------------------
-    @brief      Glue code for min value of a 8-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
-    @return     none
+  @brief      Restore the default kernels of all dispatched functions.
+  @return     none
 */
 
-void plp_min_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+void plp_dispatch_init();
 
 /** -------------------------------------------------------
-    @brief      Min value of a 8-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
-    @return     none
+  @brief      Restore the default kernels of one dispatched function, in both domains.
+  @param[in]  id  kernel to restore
+  @return     none
 */
 
-void plp_min_i8s_rv32im(const int8_t *__restrict__ pSrc,
-                        uint32_t blockSize,
-                        int8_t *__restrict__ pRes);
+void plp_dispatch_reset(plp_kernel_id id);
 
 /** -------------------------------------------------------
-    @brief      Min value of a 8-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    min value returned here
-    @return     none
+  @brief      Register a kernel variant used for the sizes up to maxSize.
+  @param[in]  id       dispatched function
+  @param[in]  domain   domain in which the variant is used
+  @param[in]  maxSize  largest size handled by the variant, PLP_DISPATCH_ALL_SIZES to replace the
+                       default kernel
+  @param[in]  kernel   kernel with the signature of the dispatched function, e.g.
+                       plp_dot_prod_i16_kernel
+  @return     0 on success, -1 if the arguments are invalid or all variants are used
 */
 
-void plp_min_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int8_t *__restrict__ pRes);
+int32_t plp_dispatch_register(plp_kernel_id id,
+                              plp_dispatch_domain domain,
+                              uint32_t maxSize,
+                              plp_kernel_fn kernel);
 
-/**
-  @brief Glue code for parallel power of 32-bit floating point vectors.
-  @param[in]  pSrc       points to the input vector
-  @param[in]  blockSize  number of samples in each vector
-  @param[in]  fracBits   number of fixed point fractional bits
-  @param[in]  nPE        number of parallel processing units
-  @param[out] pRes       output result returned here
-  @return     none
- */
+/** Dispatch table, indexed by domain and kernel (use plp_dispatch_register to modify it). */
+extern plp_dispatch_entry plp_dispatch_table[PLP_DISPATCH_NB_DOMAINS][PLP_KERNEL_NB];
 
-void plp_power_f32_parallel(const float32_t *__restrict__ pSrc,
-                            uint32_t blockSize,
-                            uint32_t nPE,
-                            float32_t *__restrict__ pRes);
+/** -------------------------------------------------------
+  @brief      Kernel of a dispatched function for the calling core and the given size (used by the
+              glue code).
+  @param[in]  id    dispatched function
+  @param[in]  size  size of the call, usually blockSize
+  @return     kernel to call
+*/
 
-/**
-   @brief          Parallel sum of squares of a 32-bit float vector for XPULPV2 extension.
-   @param[in]  S   points to the instance structure for floating-point parallel power
-   @return         none
+static inline plp_kernel_fn plp_dispatch(plp_kernel_id id, uint32_t size) {
+    const plp_dispatch_entry *entry =
+        &plp_dispatch_table[hal_cluster_id() == ARCHI_FC_CID ? PLP_DISPATCH_FC : PLP_DISPATCH_CL][id];
+    const plp_dispatch_variant *variant = entry->variants;
+
+    /* the last variant handles all the sizes */
+    while (size > variant->maxSize) {
+        variant++;
+    }
+    return variant->kernel;
+}
+
+/** Cost models used by plp_auto_npe, uncalibrated estimates until regenerated with
+    test/mrWolf/cost_model.py. */
+extern plp_cost_model plp_cost_models[PLP_COST_NB];
+
+/** -------------------------------------------------------
+  @brief      Predicted cycles of a parallel function.
+  @param[in]  id         parallel function
+  @param[in]  numChunks  number of chunks distributed among the cores (e.g. rows, samples)
+  @param[in]  chunkSize  units of work in each chunk
+  @param[in]  nPE        number of cores
+  @return     predicted number of cycles
 */
 
-void plp_power_f32p_xpulpv2(void* S);
+uint32_t plp_auto_npe_cost(plp_cost_model_id id,
+                           uint32_t numChunks,
+                           uint32_t chunkSize,
+                           uint32_t nPE);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
+  @brief      Number of cores which minimizes the predicted cycles of a parallel function (used
+              by the parallel glue code when called with nPE = 0).
+  @param[in]  id         parallel function
+  @param[in]  numChunks  number of chunks distributed among the cores (e.g. rows, samples)
+  @param[in]  chunkSize  units of work in each chunk
+  @return     number of cores, between 1 and the number of cores of the cluster (or of the
+              persistent team inside plp_cl_team_run)
 */
 
-void plp_power_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+uint32_t plp_auto_npe(plp_cost_model_id id, uint32_t numChunks, uint32_t chunkSize);
 
 /** -------------------------------------------------------
-    @brief      Kernel for Sum of squares of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
+  @brief      Replace the cost model of a parallel function, e.g. after a calibration at runtime.
+  @param[in]  id     parallel function
+  @param[in]  model  points to the new cost model
+  @return     none
 */
 
-void plp_power_f32s_xpulpv2(const float *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           float *__restrict__ pRes);
+void plp_auto_npe_set_model(plp_cost_model_id id, const plp_cost_model *model);
 
-/**
-   @brief         Sum of squares of a 32-bit float vector for RV32IM.
-   @param[in]     pSrc       points to the input vector
-   @param[in]     blockSize  number of samples in input vector
-   @param[out]    pRes    sum of squares returned here
-   @return        none
+/** -------------------------------------------------------
+  @brief      Select how the parallel functions proceed when called from the fabric controller.
+  @param[in]  mode  PLP_FC_SEQUENTIAL or PLP_FC_OFFLOAD
+  @return     none
 */
 
-void plp_power_f32s_rv32im(const float *__restrict__ pSrc,
-                            uint32_t blockSize,
-                            float *__restrict__ pRes);
+void plp_fc_set_mode(plp_fc_mode mode);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 32-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
+  @brief      Current mode of the fabric controller.
+  @return     mode selected with plp_fc_set_mode, or PLP_FC_DEFAULT_MODE
 */
 
-void plp_power_i32(const int32_t *__restrict__ pSrc,
-                   uint32_t blockSize,
-                   int32_t *__restrict__ pRes);
+plp_fc_mode plp_fc_get_mode(void);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 32-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
+  @brief      Power up the cluster for the offloaded kernels, unless it is already running.
+  @return     0 on success, -1 if the cluster cannot be opened
 */
 
-void plp_power_i32s_rv32im(const int32_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           int32_t *__restrict__ pRes);
+int32_t plp_fc_cluster_open(void);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    Sum of squares returned here
-    @return     none
+  @brief      Power down the cluster opened by plp_fc_cluster_open.
+  @return     none
 */
 
-void plp_power_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                            uint32_t blockSize,
-                            int32_t *__restrict__ pRes);
+void plp_fc_cluster_close(void);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 16-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
+  @brief      Decide if a parallel function called from the fabric controller offloads its kernels
+              to the cluster (used by the parallel glue code).
+  @return     1 if the mode is PLP_FC_OFFLOAD and the cluster is running, 0 to run the
+              single-core kernel on the fabric controller
 */
 
-void plp_power_i16(const int16_t *__restrict__ pSrc,
-                   uint32_t blockSize,
-                   int32_t *__restrict__ pRes);
+int32_t plp_fc_offload(void);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 16-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
+  @brief      Execute a function on core 0 of the cluster and wait until it returns.
+  @param[in]  entry  function executed on the cluster
+  @param[in]  arg    argument passed to entry
+  @return     0 on success, -1 if the cluster cannot be opened
 */
 
-void plp_power_i16s_rv32im(const int16_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           int32_t *__restrict__ pRes);
+int32_t plp_fc_cluster_call(void (*entry)(void *), void *arg);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 16-bit integer vector for XPULPV2 extension.
+    @brief      Glue code for mean value of a 32-bit float vector.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    Sum of squares returned here
+    @param[out] pResult    mean value returned here
     @return     none
 */
 
-void plp_power_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                            uint32_t blockSize,
-                            int32_t *__restrict__ pRes);
+void plp_mean_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 8-bit integer vector.
+    @brief      Glue code for mean value of a 32-bit float vector.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
+    @param[out] pResult    mean value returned here
     @return     none
 */
 
-void plp_power_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+void plp_mean_f32s_xpulpv2(const float *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           float *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 8-bit integer vector for RV32IM extension.
+    @brief      Glue code for mean value of a 32-bit integer vector.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
+    @param[out] pResult    mean value returned here
     @return     none
 */
 
-void plp_power_i8s_rv32im(const int8_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int32_t *__restrict__ pRes);
+void plp_mean_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 8-bit integer vector for XPULPV2 extension.
+    @brief      Mean value of a 32-bit integer vector for RV32IM extension.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    Sum of squares value returned here
+    @param[out] pResult    mean value returned here
     @return     none
 */
 
-void plp_power_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           int32_t *__restrict__ pRes);
-
-/**
-  @brief Glue code for parallel power of 32-bit fixed point vectors.
-  @param[in]  pSrc       points to the input vector
-  @param[in]  blockSize  number of samples in each vector
-  @param[in]  fracBits   number of fixed point fractional bits
-  @param[in]  nPE        number of parallel processing units
-  @param[out] pRes       output result returned here
-  @return     none
- */
-
-void plp_power_q32_parallel(const int32_t *__restrict__ pSrc,
-                            uint32_t blockSize,
-                            uint32_t fracBits,
-                            uint32_t nPE,
-                            int32_t *__restrict__ pRes);
-
-/**
-   @brief          Parallel sum of squares of a 32-bit fixed-point vector for XPULPV2 extension.
-   @param[in]  S   points to the instance structure for fixed-point parallel power
-   @return         none
-*/
-
-void plp_power_q32p_xpulpv2(void *S);
+void plp_mean_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 32-bit fixed point vector.
+    @brief      Mean value of a 32-bit integer vector for XPULPV2 extension.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
+    @param[out] pRes    mean value returned here
     @return     none
 */
 
-void plp_power_q32(const int32_t *__restrict__ pSrc,
-                   uint32_t blockSize,
-                   uint32_t fracBits,
-                   int32_t *__restrict__ pRes);
+void plp_mean_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 32-bit fixed point vector for RV32IM extension.
+    @brief      Glue code for mean value of a 16-bit integer vector.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares value returned here
+    @param[out] pResult    mean value returned here
     @return     none
 */
 
-void plp_power_q32s_rv32im(const int32_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           uint32_t fracBits,
-                           int32_t *__restrict__ pRes);
+void plp_mean_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 32-bit fixed point vector for XPULPV2 extension.
+    @brief      Mean value of a 16-bit integer vector for RV32IM extension.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Sum of squares returned here
+    @param[out] pResult    mean value returned here
     @return     none
 */
 
-void plp_power_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                            uint32_t blockSize,
-                            uint32_t fracBits,
-                            int32_t *__restrict__ pRes);
+void plp_mean_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 16-bit fixed point vector.
+    @brief      Mean value of a 16-bit integer vector for XPULPV2 extension.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
+    @param[out] pRes    mean value returned here
     @return     none
 */
 
-void plp_power_q16(const int16_t *__restrict__ pSrc,
-                   uint32_t blockSize,
-                   uint32_t fracBits,
-                   int32_t *__restrict__ pRes);
+void plp_mean_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 16-bit fixed point vector for RV32IM extension.
+    @brief      Glue code for mean value of a 8-bit integer vector.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
+    @param[out] pResult    mean value returned here
     @return     none
 */
 
-void plp_power_q16s_rv32im(const int16_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           uint32_t fracBits,
-                           int32_t *__restrict__ pRes);
+void plp_mean_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 16-bit fixed point vector for XPULPV2 extension.
+    @brief      Mean value of a 8-bit integer vector for RV32IM extension.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Sum of squares returned here
+    @param[out] pResult    mean value returned here
     @return     none
 */
 
-void plp_power_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                            uint32_t blockSize,
-                            uint32_t fracBits,
-                            int32_t *__restrict__ pRes);
+void plp_mean_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int8_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 8-bit fixed point vector.
+    @brief      Mean value of a 8-bit integer vector for XPULPV2 extension.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
+    @param[out] pRes    mean value returned here
     @return     none
 */
 
-void plp_power_q8(const int8_t *__restrict__ pSrc,
-                  uint32_t blockSize,
-                  uint32_t fracBits,
-                  int32_t *__restrict__ pRes);
+void plp_mean_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int8_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 8-bit fixed point vector for RV32IM extension.
+    @brief      Glue code for max value of a 32-bit float vector.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
+    @param[out] pResult    max value returned here
     @return     none
 */
 
-void plp_power_q8s_rv32im(const int8_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          uint32_t fracBits,
-                          int32_t *__restrict__ pRes);
+void plp_max_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 8-bit fixed point vector for XPULPV2 extension.
+    @brief Glue code for max value of 32-bit float vector in L2.
     @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Sum of squares value returned here
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       max value returned here
     @return     none
 */
 
-void plp_power_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           uint32_t fracBits,
-                           int32_t *__restrict__ pRes);
+void plp_max_f32_stream(const float32_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t nPE,
+                        float32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical variance of a 32-bit float vector.
+    @brief      Kernel for max value of a 32-bit float vector.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
+    @param[out] pResult    max value returned here
     @return     none
 */
 
-void plp_var_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_max_f32s_xpulpv2(const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Kernel for Statisical variance of a 32-bit float vector.
+    @brief      Glue code for max value of a 32-bit integer vector.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
+    @param[out] pResult    max value returned here
     @return     none
 */
 
-void plp_var_f32s_xpulpv2(const float *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         float *__restrict__ pRes);
+void plp_max_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical variance of a 32-bit fixed point vector.
+    @brief Glue code for max value of 32-bit integer vector in L2.
     @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       max value returned here
     @return     none
 */
 
-void plp_var_q32(const int32_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int32_t *__restrict__ pRes);
+void plp_max_i32_stream(const int32_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t nPE,
+                        int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 32-bit fixed point vector for RV32IM extension.
+    @brief      Max value of a 32-bit integer vector for RV32IM extension.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance value returned here
+    @param[out] pResult    max value returned here
     @return     none
 */
 
-void plp_var_q32s_rv32im(const int32_t *__restrict__ pSrc,
+void plp_max_i32s_rv32im(const int32_t *__restrict__ pSrc,
                          uint32_t blockSize,
-                         uint32_t fracBits,
                          int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 32-bit fixed point vector for XPULPV2 extension.
+    @brief      Max value of a 32-bit integer vector for XPULPV2 extension.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical variance returned here
+    @param[out] pRes    max value returned here
     @return     none
 */
 
-void plp_var_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+void plp_max_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
                           uint32_t blockSize,
-                          uint32_t fracBits,
                           int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical variance of a 16-bit fixed point vector.
+    @brief      Glue code for max value of a 16-bit integer vector.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
+    @param[out] pResult    max value returned here
     @return     none
 */
 
-void plp_var_q16(const int16_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int16_t *__restrict__ pRes);
+void plp_max_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 16-bit fixed point vector for RV32IM extension.
+    @brief      Max value of a 16-bit integer vector for RV32IM extension.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
+    @param[out] pResult    max value returned here
     @return     none
 */
 
-void plp_var_q16s_rv32im(const int16_t *__restrict__ pSrc,
+void plp_max_i16s_rv32im(const int16_t *__restrict__ pSrc,
                          uint32_t blockSize,
-                         uint32_t fracBits,
                          int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 16-bit fixed point vector for XPULPV2 extension.
+    @brief      Max value of a 16-bit integer vector for XPULPV2 extension.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical variance returned here
+    @param[out] pRes    max value returned here
     @return     none
 */
 
-void plp_var_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+void plp_max_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
                           uint32_t blockSize,
-                          uint32_t fracBits,
                           int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical variance of a 8-bit fixed point vector.
+    @brief      Glue code for max value of a 8-bit integer vector.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
+    @param[out] pResult    max value returned here
     @return     none
 */
 
-void plp_var_q8(const int8_t *__restrict__ pSrc,
-                uint32_t blockSize,
-                uint32_t fracBits,
-                int8_t *__restrict__ pRes);
+void plp_max_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 8-bit fixed point vector for RV32IM extension.
+    @brief      Max value of a 8-bit integer vector for RV32IM extension.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
+    @param[out] pResult    max value returned here
     @return     none
 */
 
-void plp_var_q8s_rv32im(const int8_t *__restrict__ pSrc,
+void plp_max_i8s_rv32im(const int8_t *__restrict__ pSrc,
                         uint32_t blockSize,
-                        uint32_t fracBits,
                         int8_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 8-bit fixed point vector for XPULPV2 extension.
+    @brief      Max value of a 8-bit integer vector for XPULPV2 extension.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical variance value returned here
+    @param[out] pRes    max value returned here
     @return     none
 */
 
-void plp_var_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+void plp_max_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
                          uint32_t blockSize,
-                         uint32_t fracBits,
                          int8_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 32-bit floating point vector.
+    @brief      Glue code for min value of a 32-bit float vector.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @param[out] pResult    min value returned here
     @return     none
 */
 
-void plp_std_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_min_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Kernel for Statisical standard deviation of a 32-bit float vector.
+    @brief Glue code for min value of 32-bit float vector in L2.
     @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       min value returned here
     @return     none
 */
 
-void plp_std_f32s_xpulpv2(const float *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         float *__restrict__ pRes);
+void plp_min_f32_stream(const float32_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t nPE,
+                        float32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 32-bit fixed point vector.
+    @brief      Kernel for min value of a 32-bit float vector.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @param[out] pResult    min value returned here
     @return     none
 */
 
-void plp_std_q32(const int32_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int32_t *__restrict__ pRes);
+void plp_min_f32s_xpulpv2(const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 32-bit fixed point vector for RV32IM extension.
+    @brief      Glue code for min value of a 32-bit integer vector.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation value returned here
+    @param[out] pResult    min value returned here
     @return     none
 */
 
-void plp_std_q32s_rv32im(const int32_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
+void plp_min_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for min value of 32-bit integer vector in L2.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       min value returned here
+    @return     none
+*/
+
+void plp_min_i32_stream(const int32_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t nPE,
+                        int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
                          int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 32-bit fixed point vector for XPULPV2
-    extension.
+    @brief      Min value of a 32-bit integer vector for XPULPV2 extension.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation returned here
+    @param[out] pRes    min value returned here
     @return     none
 */
 
-void plp_std_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+void plp_min_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
                           uint32_t blockSize,
-                          uint32_t fracBits,
                           int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 16-bit fixed point vector.
+    @brief      Glue code for min value of a 16-bit integer vector.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @param[out] pResult    min value returned here
     @return     none
 */
 
-void plp_std_q16(const int16_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int16_t *__restrict__ pRes);
+void plp_min_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 16-bit fixed point vector for RV32IM extension.
+    @brief      Min value of a 16-bit integer vector for RV32IM extension.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @param[out] pResult    min value returned here
     @return     none
 */
 
-void plp_std_q16s_rv32im(const int16_t *__restrict__ pSrc,
+void plp_min_i16s_rv32im(const int16_t *__restrict__ pSrc,
                          uint32_t blockSize,
-                         uint32_t fracBits,
                          int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 16-bit fixed point vector for XPULPV2
-    extension.
+    @brief      Min value of a 16-bit integer vector for XPULPV2 extension.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation returned here
+    @param[out] pRes    min value returned here
     @return     none
 */
 
-void plp_std_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+void plp_min_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
                           uint32_t blockSize,
-                          uint32_t fracBits,
                           int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 8-bit fixed point vector.
+    @brief      Glue code for min value of a 8-bit integer vector.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @param[out] pResult    min value returned here
     @return     none
 */
 
-void plp_std_q8(const int8_t *__restrict__ pSrc,
-                uint32_t blockSize,
-                uint32_t fracBits,
-                int8_t *__restrict__ pRes);
+void plp_min_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 8-bit fixed point vector for RV32IM extension.
+    @brief      Min value of a 8-bit integer vector for RV32IM extension.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @param[out] pResult    min value returned here
     @return     none
 */
 
-void plp_std_q8s_rv32im(const int8_t *__restrict__ pSrc,
+void plp_min_i8s_rv32im(const int8_t *__restrict__ pSrc,
                         uint32_t blockSize,
-                        uint32_t fracBits,
                         int8_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 8-bit fixed point vector for XPULPV2 extension.
+    @brief      Min value of a 8-bit integer vector for XPULPV2 extension.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation value returned here
+    @param[out] pRes    min value returned here
     @return     none
 */
 
-void plp_std_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+void plp_min_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
                          uint32_t blockSize,
-                         uint32_t fracBits,
                          int8_t *__restrict__ pRes);
+
+/**
+  @brief Glue code for parallel power of 32-bit floating point vectors.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  fracBits   number of fixed point fractional bits
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pRes       output result returned here
+  @return     none
+ */
+
+void plp_power_f32_parallel(const float32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t nPE,
+                            float32_t *__restrict__ pRes);
+
+/**
+   @brief          Parallel sum of squares of a 32-bit float vector for XPULPV2 extension.
+   @param[in]  S   points to the instance structure for floating-point parallel power
+   @return         none
+*/
+
+void plp_power_f32p_xpulpv2(void* S);
+
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 32-bit floating point vector.
+    @brief      Glue code for Sum of squares of a 32-bit float vector.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @param[out] pResult    Sum of squares returned here
     @return     none
 */
 
-void plp_rms_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_power_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Kernel for Statisical standard deviation of a 32-bit float vector.
+    @brief Glue code for sum of squares of 32-bit float vector in L2.
     @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       sum of squares returned here
     @return     none
 */
 
-void plp_rms_f32s_xpulpv2(const float *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         float *__restrict__ pRes);
+void plp_power_f32_stream(const float32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          float32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 32-bit fixed point vector.
+    @brief      Kernel for Sum of squares of a 32-bit float vector.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @param[out] pResult    Sum of squares returned here
     @return     none
 */
 
-void plp_rms_q32(const int32_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int32_t *__restrict__ pRes);
+void plp_power_f32s_xpulpv2(const float *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           float *__restrict__ pRes);
+
+/**
+   @brief         Sum of squares of a 32-bit float vector for RV32IM.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[out]    pRes    sum of squares returned here
+   @return        none
+*/
+
+void plp_power_f32s_rv32im(const float *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            float *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 32-bit fixed point vector for RV32IM extension.
+    @brief      Glue code for Sum of squares of a 32-bit integer vector.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation value returned here
+    @param[out] pResult    Sum of squares returned here
     @return     none
 */
 
-void plp_rms_q32s_rv32im(const int32_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int32_t *__restrict__ pRes);
+void plp_power_i32(const int32_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 32-bit fixed point vector for XPULPV2
-    extension.
+    @brief Glue code for sum of squares of 32-bit integer vector in L2.
     @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation returned here
+    @param[in]  blockSize  number of samples in the vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       sum of squares returned here
     @return     none
 */
 
-void plp_rms_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+void plp_power_i32_stream(const int32_t *__restrict__ pSrc,
                           uint32_t blockSize,
-                          uint32_t fracBits,
+                          uint32_t nPE,
                           int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 16-bit fixed point vector.
+    @brief      Sum of squares of a 32-bit integer vector for RV32IM extension.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @param[out] pResult    Sum of squares returned here
     @return     none
 */
 
-void plp_rms_q16(const int16_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int16_t *__restrict__ pRes);
+void plp_power_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 16-bit fixed point vector for RV32IM extension.
+    @brief      Sum of squares of a 32-bit integer vector for XPULPV2 extension.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @param[out] pRes    Sum of squares returned here
     @return     none
 */
 
-void plp_rms_q16s_rv32im(const int16_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int16_t *__restrict__ pRes);
+void plp_power_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 16-bit fixed point vector for XPULPV2
-    extension.
+    @brief      Glue code for Sum of squares of a 16-bit integer vector.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation returned here
+    @param[out] pResult    Sum of squares returned here
     @return     none
 */
 
-void plp_rms_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          uint32_t fracBits,
-                          int16_t *__restrict__ pRes);
+void plp_power_i16(const int16_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 8-bit fixed point vector.
+    @brief      Sum of squares of a 16-bit integer vector for RV32IM extension.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @param[out] pResult    Sum of squares returned here
     @return     none
 */
 
-void plp_rms_q8(const int8_t *__restrict__ pSrc,
-                uint32_t blockSize,
-                uint32_t fracBits,
-                int8_t *__restrict__ pRes);
+void plp_power_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 8-bit fixed point vector for RV32IM extension.
+    @brief      Sum of squares of a 16-bit integer vector for XPULPV2 extension.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
+    @param[out] pRes    Sum of squares returned here
     @return     none
 */
 
-void plp_rms_q8s_rv32im(const int8_t *__restrict__ pSrc,
-                        uint32_t blockSize,
-                        uint32_t fracBits,
-                        int8_t *__restrict__ pRes);
+void plp_power_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 8-bit fixed point vector for XPULPV2 extension.
+    @brief      Glue code for Sum of squares of a 8-bit integer vector.
     @param[in]  pSrc       points to the input vector
     @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation value returned here
-    @return     none
-*/
-
-void plp_rms_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int8_t *__restrict__ pRes);
-
-/** -------------------------------------------------------
-    @brief      Glue code for square root of a 32-bit fixed point number.
-    @param[in]  in   32-Bit input integer
-    @param[out] out  Square root of the input
+    @param[out] pResult    Sum of squares returned here
     @return     none
 */
 
-void plp_sqrt_q32(const int32_t *__restrict__ pSrc,
-                  const uint32_t fracBits,
-                  int32_t *__restrict__ pRes);
+void plp_power_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Square root of a 32-bit fixed point number for XPULPV2 extension.
-    @param[in]  in   32-Bit input integer
-    @param[out] out  Square root of the input
+    @brief      Sum of squares of a 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
     @return     none
 */
 
-void plp_sqrt_q32s_rv32im(const int32_t *__restrict__ pSrc,
-                          const uint32_t fracBits,
+void plp_power_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                          uint32_t blockSize,
                           int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Square root of a 32-bit fixed point number for XPULPV2 extension.
-    @param[in]  in   32-Bit input integer
-    @param[out] out  Square root of the input
+    @brief      Sum of squares of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    Sum of squares value returned here
     @return     none
 */
 
-void plp_sqrt_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                           const uint32_t fracBits,
+void plp_power_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                           uint32_t blockSize,
                            int32_t *__restrict__ pRes);
 
-/** -------------------------------------------------------
-    @brief      Glue code for square root of a 16-bit fixed point number.
-    @param[in]  in   16-Bit input integer
-    @param[out] out  Square root of the input
-    @return     none
+/**
+  @brief Glue code for parallel power of 32-bit fixed point vectors.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  fracBits   number of fixed point fractional bits
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pRes       output result returned here
+  @return     none
+ */
+
+void plp_power_q32_parallel(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pRes);
+
+/**
+   @brief          Parallel sum of squares of a 32-bit fixed-point vector for XPULPV2 extension.
+   @param[in]  S   points to the instance structure for fixed-point parallel power
+   @return         none
 */
 
-void plp_sqrt_q16(const int16_t *__restrict__ pSrc,
-                  const uint32_t fracBits,
-                  int16_t *__restrict__ pRes);
+void plp_power_q32p_xpulpv2(void *S);
 
 /** -------------------------------------------------------
-    @brief      Square root of a 16-bit fixed point number for XPULPV2 extension.
-    @param[in]  in   16-Bit input integer
-    @param[out] out  Square root of the input
+    @brief      Glue code for Sum of squares of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
     @return     none
 */
 
-void plp_sqrt_q16s_rv32im(const int16_t *__restrict__ pSrc,
-                          const uint32_t fracBits,
-                          int16_t *__restrict__ pRes);
+void plp_power_q32(const int32_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   uint32_t fracBits,
+                   int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Square root of a 16-bit fixed point number for XPULPV2 extension.
-    @param[in]  in   16-Bit input integer
-    @param[out] out  Square root of the input
+    @brief      Sum of squares of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares value returned here
     @return     none
 */
 
-void plp_sqrt_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                           const uint32_t fracBits,
-                           int16_t *__restrict__ pRes);
-
+void plp_power_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           int32_t *__restrict__ pRes);
 
-/**
-   @brief         Glue code for square root of a 32-bit floating point number.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pRes    Square root returned here
-   @return        none
- */
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 32-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Sum of squares returned here
+    @return     none
+*/
 
-void plp_sqrt_f32(const float *__restrict__ pSrc, 
-                  float *__restrict__ pRes);
+void plp_power_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            int32_t *__restrict__ pRes);
 
-/**
-   @brief         Square root of a 32-bit floating point number for RV32IM.
-   @param[in]     pSrc    points to the input vector
-   @param[out]    pRes    Square root returned here
-   @return        none
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
 */
 
-void plp_sqrt_f32s_rv32im(const float *__restrict__ pSrc, float *__restrict__ pRes);
+void plp_power_q16(const int16_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   uint32_t fracBits,
+                   int32_t *__restrict__ pRes);
 
-/**
-   @brief         Kernel for square root of a 32-bit floating point number.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pRes    Square root returned here
-   @return        none
- */
-void plp_sqrt_f32s_xpulpv2(const float *__restrict__ pSrc,
-                           float *__restrict__ pRes);
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
 
+void plp_power_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           int32_t *__restrict__ pRes);
 
-/**
-   @brief         Glue code for square root of a 32-bit floating point number.
-   @param[in]     pSrc       points to the input vectoro
-   @param[out]    pRes    Square root returned here
-   @return        none
- */
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 16-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Sum of squares returned here
+    @return     none
+*/
 
+void plp_power_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            int32_t *__restrict__ pRes);
 
-/**
- * @brief Macros required for SINE and COSINE Fast math approximations
- */
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
 
-#define FAST_MATH_TABLE_SIZE 512
-#define FAST_MATH_Q32_SHIFT (32 - 10)
-#define FAST_MATH_Q16_SHIFT (16 - 10)
-#define CONTROLLER_Q32_SHIFT (32 - 9)
-#define TABLE_SPACING_Q32 0x400000
-#define TABLE_SPACING_Q16 0x80
+void plp_power_q8(const int8_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  uint32_t fracBits,
+                  int32_t *__restrict__ pRes);
 
-/**
- * @brief      Glue code for q32 cosine function
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
- */
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 8-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
 
-int32_t plp_cos_q32(int32_t x);
+void plp_power_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
 
-/**
- * @brief      q32 cosine function for RV32IM
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
- */
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 8-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Sum of squares value returned here
+    @return     none
+*/
 
-int32_t plp_cos_q32s_rv32im(int32_t x);
+void plp_power_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           int32_t *__restrict__ pRes);
 
-/**
- * @brief      q32 cosine function for XPULPV2
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
- */
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical variance of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
 
-int32_t plp_cos_q32s_xpulpv2(int32_t x);
+void plp_var_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
 
-/**
- * @brief      Glue code for q16 cosine function
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
- */
+/** -------------------------------------------------------
+    @brief      Kernel for Statisical variance of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
 
-int16_t plp_cos_q16(int16_t x);
+void plp_var_f32s_xpulpv2(const float *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         float *__restrict__ pRes);
 
-/**
- * @brief      q16 cosine function for RV32IM
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
- */
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical variance of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
 
-int16_t plp_cos_q16s_rv32im(int16_t x);
+void plp_var_q32(const int32_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int32_t *__restrict__ pRes);
 
-/**
- * @brief      q16 cosine function for XPULPV2
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
- */
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance value returned here
+    @return     none
+*/
 
-int16_t plp_cos_q16s_xpulpv2(int16_t x);
-
-/**
- * @brief      Glue code for f32 cosine function
- *
- * @param[in]  x     input value in radians
- *
- * @return     cos(x)
- */
-
-float32_t plp_cos_f32(float32_t x);
+void plp_var_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int32_t *__restrict__ pRes);
 
-/**
- * @brief      F32 cosine function for XPULPV2
- *
- * @param[in]  x     input value in radians
- *
- * @return     cos(x)
- */
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 32-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical variance returned here
+    @return     none
+*/
 
-float32_t plp_cos_f32s_xpulpv2(float32_t x);
+void plp_var_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
 
-/**
- * @brief      Glue code for q32 sine function
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
- */
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical variance of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
 
-int32_t plp_sin_q32(int32_t x);
+void plp_var_q16(const int16_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int16_t *__restrict__ pRes);
 
-/**
- * @brief      q32 sine function for RV32IM
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
- */
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
 
-int32_t plp_sin_q32s_rv32im(int32_t x);
+void plp_var_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int16_t *__restrict__ pRes);
 
-/**
- * @brief      q32 sine function for XPULPV2
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
- */
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 16-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical variance returned here
+    @return     none
+*/
 
-int32_t plp_sin_q32s_xpulpv2(int32_t x);
+void plp_var_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int16_t *__restrict__ pRes);
 
-/**
- * @brief      Glue code for q16 sine function
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
- */
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical variance of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
 
-int16_t plp_sin_q16(int16_t x);
+void plp_var_q8(const int8_t *__restrict__ pSrc,
+                uint32_t blockSize,
+                uint32_t fracBits,
+                int8_t *__restrict__ pRes);
 
-/**
- * @brief      q16 sine function for RV32IM
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
- */
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 8-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
 
-int16_t plp_sin_q16s_rv32im(int16_t x);
+void plp_var_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t fracBits,
+                        int8_t *__restrict__ pRes);
 
-/**
- * @brief      q16 sine function for XPULPV2
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
- */
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 8-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical variance value returned here
+    @return     none
+*/
 
-int16_t plp_sin_q16s_xpulpv2(int16_t x);
+void plp_var_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int8_t *__restrict__ pRes);
 
-/**
- * @brief      Glue code for f32 sine function
- *
- * @param[in]  x     input value in radians
- *
- * @return     sin(x)
- */
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
 
-float32_t plp_sin_f32(float32_t x);
+void plp_std_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
 
-/**
- * @brief      F32 sine function for XPULPV2
- *
- * @param[in]  x     input value in radians
- *
- * @return     sin(x)
- */
+/** -------------------------------------------------------
+    @brief      Kernel for Statisical standard deviation of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
 
-float32_t plp_sin_f32s_xpulpv2(float32_t x);
+void plp_std_f32s_xpulpv2(const float *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         float *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Glue code for correlation of 32-bit integer vectors.
-    @param[in]  pSrcA   points to the first input vector
-    @param[in]  srcALen Length of the first input vector
-    @param[in]  pSrcB   points to the second input vector
-    @param[in]  srcBLen Length of the second input vector
-    @param[out] pRes    output result returned here
+    @brief      Glue code for Statisical standard deviation of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
     @return     none
 */
 
-void plp_correlate_i32(const int32_t *pSrcA,
-                       const uint32_t srcALen,
-                       const int32_t *pSrcB,
-                       const uint32_t srcBLen,
-                       int32_t *pRes);
+void plp_std_q32(const int32_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Correlation of 32-bit integer vectors kernel for RV32IM extension.
-    @param[in]  pSrcA   points to the first input vector
-    @param[in]  srcALen Length of the first input vector
-    @param[in]  pSrcB   points to the second input vector
-    @param[in]  srcBLen Length of the second input vector
-    @param[out] pRes    output result returned here
+    @brief      Statisical standard deviation of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation value returned here
     @return     none
 */
 
-void plp_correlate_i32s_rv32im(const int32_t *pSrcA,
-                               const uint32_t srcALen,
-                               const int32_t *pSrcB,
-                               const uint32_t srcBLen,
-                               int32_t *pRes);
+void plp_std_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Correlation of 32-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]  pSrcA   points to the first input vector
-    @param[in]  srcALen Length of the first input vector
-    @param[in]  pSrcB   points to the second input vector
-    @param[in]  srcBLen Length of the second input vector
-    @param[out] pRes    output result returned here
-    @return     none */
+    @brief      Statisical standard deviation of a 32-bit fixed point vector for XPULPV2
+    extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation returned here
+    @return     none
+*/
 
-void plp_correlate_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                const uint32_t srcALen,
-                                const int32_t *__restrict__ pSrcB,
-                                const uint32_t srcBLen,
-                                int32_t *__restrict__ pRes);
+void plp_std_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-  @brief Glue code for correlation of 16-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    result returned here
-  @return     none
- */
+    @brief      Glue code for Statisical standard deviation of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
 
-void plp_correlate_i16(const int16_t *pSrcA,
-                       const uint32_t srcALen,
-                       const int16_t *pSrcB,
-                       const uint32_t srcBLen,
-                       int32_t *pRes);
+void plp_std_q16(const int16_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-   @brief Correlation of 16-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Statisical standard deviation of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
 */
 
-void plp_correlate_i16s_xpulpv2(const int16_t *pSrcA,
-                                const uint32_t srcALen,
-                                const int16_t *pSrcB,
-                                const uint32_t srcBLen,
-                                int32_t *pRes);
+void plp_std_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-   @brief Correlation of 16-bit integer vectors kernel for RV32IM extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Statisical standard deviation of a 16-bit fixed point vector for XPULPV2
+    extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation returned here
+    @return     none
 */
 
-void plp_correlate_i16s_rv32im(const int16_t *pSrcA,
-                               const uint32_t srcALen,
-                               const int16_t *pSrcB,
-                               const uint32_t srcBLen,
-                               int32_t *pRes);
+void plp_std_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-  @brief Glue code for correlation of 8-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
-  @return     none
- */
+    @brief      Glue code for Statisical standard deviation of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
 
-void plp_correlate_i8(const int8_t *pSrcA,
-                      const uint32_t srcALen,
-                      const int8_t *pSrcB,
-                      const uint32_t srcBLen,
-                      int32_t *pRes);
+void plp_std_q8(const int8_t *__restrict__ pSrc,
+                uint32_t blockSize,
+                uint32_t fracBits,
+                int8_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-  @brief Glue code for correlation (valid) of 8-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
-  @return     none
- */
+    @brief      Statisical standard deviation of a 8-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
 
-void plp_correlate_valid_i8(const int8_t *pSrcA,
-                            const uint32_t srcALen,
-                            const int8_t *pSrcB,
-                            const uint32_t srcBLen,
-                            int32_t *pRes);
+void plp_std_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t fracBits,
+                        int8_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-   @brief Correlation of 8-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Statisical standard deviation of a 8-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation value returned here
+    @return     none
 */
 
-void plp_correlate_i8s_xpulpv2(const int8_t *pSrcA,
-                               const uint32_t srcALen,
-                               const int8_t *pSrcB,
-                               const uint32_t srcBLen,
-                               int32_t *pRes);
-
+void plp_std_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int8_t *__restrict__ pRes);
 /** -------------------------------------------------------
-   @brief Correlation of 8-bit integer vectors kernel for RV32IM extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Glue code for Statisical standard deviation of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
 */
 
-void plp_correlate_i8s_rv32im(const int8_t *pSrcA,
-                              const uint32_t srcALen,
-                              const int8_t *pSrcB,
-                              const uint32_t srcBLen,
-                              int32_t *pRes);
-
+void plp_rms_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Glue code for correlation of 32-bit integer vectors.
-    @param[in]  pSrcA   points to the first input vector
-    @param[in]  srcALen Length of the first input vector
-    @param[in]  pSrcB   points to the second input vector
-    @param[in]  srcBLen Length of the second input vector
-    @param[out] pRes    output result returned here
+    @brief      Kernel for Statisical standard deviation of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
     @return     none
 */
 
-void plp_correlate_q32(const int32_t *pSrcA,
-                       const uint32_t srcALen,
-                       const int32_t *pSrcB,
-                       const uint32_t srcBLen,
-		       const uint32_t fracBits,
-                       int32_t *pRes);
+void plp_rms_f32s_xpulpv2(const float *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         float *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Correlation of 32-bit integer vectors kernel for RV32IM extension.
-    @param[in]  pSrcA   points to the first input vector
-    @param[in]  srcALen Length of the first input vector
-    @param[in]  pSrcB   points to the second input vector
-    @param[in]  srcBLen Length of the second input vector
-    @param[out] pRes    output result returned here
+    @brief      Glue code for Statisical standard deviation of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
     @return     none
 */
 
-void plp_correlate_q32s_rv32im(const int32_t *pSrcA,
-                               const uint32_t srcALen,
-                               const int32_t *pSrcB,
-                               const uint32_t srcBLen,
-			       const uint32_t fracBits,
-                               int32_t *pRes);
+void plp_rms_q32(const int32_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Correlation of 32-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]  pSrcA   points to the first input vector
-    @param[in]  srcALen Length of the first input vector
-    @param[in]  pSrcB   points to the second input vector
-    @param[in]  srcBLen Length of the second input vector
-    @param[out] pRes    output result returned here
-    @return     none */
+    @brief      Statisical standard deviation of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation value returned here
+    @return     none
+*/
 
-void plp_correlate_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                const uint32_t srcALen,
-                                const int32_t *__restrict__ pSrcB,
-                                const uint32_t srcBLen,
-				const uint32_t fracBits,
-                                int32_t *__restrict__ pRes);
+void plp_rms_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-  @brief Glue code for correlation of 16-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    result returned here
-  @return     none
- */
+    @brief      Statisical standard deviation of a 32-bit fixed point vector for XPULPV2
+    extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation returned here
+    @return     none
+*/
 
-void plp_correlate_q16(const int16_t *pSrcA,
-                       const uint32_t srcALen,
-                       const int16_t *pSrcB,
-                       const uint32_t srcBLen,
-		       const uint32_t fracBits,
-                       int32_t *pRes);
+void plp_rms_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-   @brief Correlation of 16-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Glue code for Statisical standard deviation of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
 */
 
-void plp_correlate_q16s_xpulpv2(const int16_t *pSrcA,
-                                const uint32_t srcALen,
-                                const int16_t *pSrcB,
-                                const uint32_t srcBLen,
-				const uint32_t fracBits,
-                                int32_t *pRes);
+void plp_rms_q16(const int16_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-   @brief Correlation of 16-bit integer vectors kernel for RV32IM extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Statisical standard deviation of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
 */
 
-void plp_correlate_q16s_rv32im(const int16_t *pSrcA,
-                               const uint32_t srcALen,
-                               const int16_t *pSrcB,
-                               const uint32_t srcBLen,
-			       const uint32_t fracBits,
-                               int32_t *pRes);
+void plp_rms_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-  @brief Glue code for correlation of 8-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
-  @return     none
- */
+    @brief      Statisical standard deviation of a 16-bit fixed point vector for XPULPV2
+    extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation returned here
+    @return     none
+*/
 
-void plp_correlate_q8(const int8_t *pSrcA,
-                      const uint32_t srcALen,
-                      const int8_t *pSrcB,
-                      const uint32_t srcBLen,
-		      const uint32_t fracBits,
-                      int32_t *pRes);
+void plp_rms_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-  @brief Glue code for correlation (valid) of 8-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
-  @return     none
- */
+    @brief      Glue code for Statisical standard deviation of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
 
-void plp_correlate_valid_q8(const int8_t *pSrcA,
-                            const uint32_t srcALen,
-                            const int8_t *pSrcB,
-                            const uint32_t srcBLen,
-			    const uint32_t fracBits,
-                            int32_t *pRes);
+void plp_rms_q8(const int8_t *__restrict__ pSrc,
+                uint32_t blockSize,
+                uint32_t fracBits,
+                int8_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-   @brief Correlation of 8-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Statisical standard deviation of a 8-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
 */
 
-void plp_correlate_q8s_xpulpv2(const int8_t *pSrcA,
-                               const uint32_t srcALen,
-                               const int8_t *pSrcB,
-                               const uint32_t srcBLen,
-			       const uint32_t fracBits,
-                               int32_t *pRes);
+void plp_rms_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t fracBits,
+                        int8_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-   @brief Correlation of 8-bit integer vectors kernel for RV32IM extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Statisical standard deviation of a 8-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation value returned here
+    @return     none
 */
 
-void plp_correlate_q8s_rv32im(const int8_t *pSrcA,
-                              const uint32_t srcALen,
-                              const int8_t *pSrcB,
-                              const uint32_t srcBLen,
-			      const uint32_t fracBits,
-                              int32_t *pRes);
-
+void plp_rms_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int8_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-  @brief Glue code for convolution of 32-bit integer vectors.
-  @param[in]  pSrcA    points to the first input vector
-  @param[in]  srcALen  Length of the first input vector
-  @param[in]  pSrcB    points to the second input vector
-  @param[in]  srcBLen  Length of the second input vector
-  @param[out] pRes     result returned here
-  @return     none
- */
+    @brief      Glue code for square root of a 32-bit fixed point number.
+    @param[in]  in   32-Bit input integer
+    @param[out] out  Square root of the input
+    @return     none
+*/
 
-void plp_conv_i32(const int32_t *pSrcA,
-                  const uint32_t srcALen,
-                  const int32_t *pSrcB,
-                  const uint32_t srcBLen,
-                  int32_t *pRes);
+void plp_sqrt_q32(const int32_t *__restrict__ pSrc,
+                  const uint32_t fracBits,
+                  int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-  @brief Glue code for convolution (valid) of 32-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
-  @return     none
- */
+    @brief      Square root of a 32-bit fixed point number for XPULPV2 extension.
+    @param[in]  in   32-Bit input integer
+    @param[out] out  Square root of the input
+    @return     none
+*/
 
-void plp_conv_valid_i32(const int32_t *pSrcA,
-                        const uint32_t srcALen,
-                        const int32_t *pSrcB,
-                        const uint32_t srcBLen,
-                        int32_t *pRes);
+void plp_sqrt_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                          const uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-   @brief Convolution of 32-bit integer vectors kernel for RV32IM extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Square root of a 32-bit fixed point number for XPULPV2 extension.
+    @param[in]  in   32-Bit input integer
+    @param[out] out  Square root of the input
+    @return     none
 */
 
-void plp_conv_i32s_rv32im(const int32_t *pSrcA,
-                          const uint32_t srcALen,
-                          const int32_t *pSrcB,
-                          const uint32_t srcBLen,
-                          int32_t *pRes);
+void plp_sqrt_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                           const uint32_t fracBits,
+                           int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-   @brief Convolution of 32-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+    @brief      Glue code for square root of a 16-bit fixed point number.
+    @param[in]  in   16-Bit input integer
+    @param[out] out  Square root of the input
+    @return     none
 */
 
-void plp_conv_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                           const uint32_t srcALen,
-                           const int32_t *__restrict__ pSrcB,
-                           const uint32_t srcBLen,
-                           int32_t *__restrict__ pRes);
+void plp_sqrt_q16(const int16_t *__restrict__ pSrc,
+                  const uint32_t fracBits,
+                  int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-   @brief Convolution (valid) of 32-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none */
+    @brief      Square root of a 16-bit fixed point number for XPULPV2 extension.
+    @param[in]  in   16-Bit input integer
+    @param[out] out  Square root of the input
+    @return     none
+*/
 
-void plp_conv_valid_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                 const uint32_t srcALen,
-                                 const int32_t *__restrict__ pSrcB,
-                                 const uint32_t srcBLen,
-                                 int32_t *__restrict__ pRes);
+void plp_sqrt_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                          const uint32_t fracBits,
+                          int16_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-  @brief Glue code for convolution of 16-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
-  @return     none
- */
+    @brief      Square root of a 16-bit fixed point number for XPULPV2 extension.
+    @param[in]  in   16-Bit input integer
+    @param[out] out  Square root of the input
+    @return     none
+*/
 
-void plp_conv_i16(const int16_t *pSrcA,
-                  const uint32_t srcALen,
-                  const int16_t *pSrcB,
-                  const uint32_t srcBLen,
-                  int32_t *pRes);
+void plp_sqrt_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                           const uint32_t fracBits,
+                           int16_t *__restrict__ pRes);
 
-/** -------------------------------------------------------
-  @brief Glue code for convolution (valid) of 16-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
-  @return     none
- */
 
-void plp_conv_valid_i16(const int16_t *pSrcA,
-                        const uint32_t srcALen,
-                        const int16_t *pSrcB,
-                        const uint32_t srcBLen,
-                        int32_t *pRes);
+/**
+   @brief         Glue code for square root of a 32-bit floating point number.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pRes    Square root returned here
+   @return        none
+ */
 
-/** -------------------------------------------------------
-  @brief Glue code for convolution (valid with replication) of 16-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
-  @return     none
- */
-
-void plp_conv_valid_rep_i16(const int16_t *pSrcA,
-                            const uint32_t srcALen,
-                            const int16_t *pSrcB,
-                            const uint32_t srcBLen,
-                            int32_t *pRes);
+void plp_sqrt_f32(const float *__restrict__ pSrc, 
+                  float *__restrict__ pRes);
 
-/** -------------------------------------------------------
-   @brief Convolution of 16-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
+/**
+   @brief         Square root of a 32-bit floating point number for RV32IM.
+   @param[in]     pSrc    points to the input vector
+   @param[out]    pRes    Square root returned here
+   @return        none
 */
 
-void plp_conv_i16s_xpulpv2(const int16_t *pSrcA,
-                           const uint32_t srcALen,
-                           const int16_t *pSrcB,
-                           const uint32_t srcBLen,
-                           int32_t *pRes);
+void plp_sqrt_f32s_rv32im(const float *__restrict__ pSrc, float *__restrict__ pRes);
 
-/** -------------------------------------------------------
-   @brief Convolution (valid) of 16-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
-*/
+/**
+   @brief         Kernel for square root of a 32-bit floating point number.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pRes    Square root returned here
+   @return        none
+ */
+void plp_sqrt_f32s_xpulpv2(const float *__restrict__ pSrc,
+                           float *__restrict__ pRes);
 
-void plp_conv_valid_i16s_xpulpv2(const int16_t *pSrcA,
-                                 const uint32_t srcALen,
-                                 const int16_t *pSrcB,
-                                 const uint32_t srcBLen,
-                                 int32_t *pRes);
 
-/** -------------------------------------------------------
-   @brief Convolution (valid with data replication) of 16-bit integer vectors kernel for XPULPV2
-   extension.
-   @param[in]  pSrcA   points to the first input vector of the replicated data
-   @param[in]  srcALen Number of elements in (unreplicated) vector a
-   @param[in]  srcAMem Number of elements between each replication
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
-*/
+/**
+   @brief         Glue code for square root of a 32-bit floating point number.
+   @param[in]     pSrc       points to the input vectoro
+   @param[out]    pRes    Square root returned here
+   @return        none
+ */
 
-void plp_conv_valid_rep_i16s_xpulpv2(const int16_t *pSrcA,
-                                     const uint32_t srcALen,
-                                     const uint32_t srcAMem,
-                                     const int16_t *pSrcB,
-                                     const uint32_t srcBLen,
-                                     int32_t *pRes);
 
-/** -------------------------------------------------------
-   @brief Convolution of 16-bit integer vectors kernel for RV32IM extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
-*/
+/**
+ * @brief Macros required for SINE and COSINE Fast math approximations
+ */
 
-void plp_conv_i16s_rv32im(const int16_t *pSrcA,
-                          const uint32_t srcALen,
-                          const int16_t *pSrcB,
-                          const uint32_t srcBLen,
-                          int32_t *pRes);
+#define FAST_MATH_TABLE_SIZE 512
+#define FAST_MATH_Q32_SHIFT (32 - 10)
+#define FAST_MATH_Q16_SHIFT (16 - 10)
+#define CONTROLLER_Q32_SHIFT (32 - 9)
+#define TABLE_SPACING_Q32 0x400000
+#define TABLE_SPACING_Q16 0x80
 
-/** -------------------------------------------------------
-  @brief Glue code for convolution of 8-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
-  @return     none
+/**
+ * @brief      Glue code for q32 cosine function
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
  */
 
-void plp_conv_i8(const int8_t *pSrcA,
-                 const uint32_t srcALen,
-                 const int8_t *pSrcB,
-                 const uint32_t srcBLen,
-                 int32_t *pRes);
+int32_t plp_cos_q32(int32_t x);
 
-/** -------------------------------------------------------
-  @brief Glue code for convolution (valid) of 8-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
-  @return     none
+/**
+ * @brief      q32 cosine function for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
  */
 
-void plp_conv_valid_i8(const int8_t *pSrcA,
-                       const uint32_t srcALen,
-                       const int8_t *pSrcB,
-                       const uint32_t srcBLen,
-                       int32_t *pRes);
+int32_t plp_cos_q32s_rv32im(int32_t x);
 
-/** -------------------------------------------------------
-  @brief Glue code for convolution (valid with data replication) of 8-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector (in L2)
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector (in L2)
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here (preferably in L1)
-  @return     none
+/**
+ * @brief      q32 cosine function for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
  */
 
-void plp_conv_valid_rep_i8(const int8_t *pSrcA,
-                           const uint32_t srcALen,
-                           const int8_t *pSrcB,
-                           const uint32_t srcBLen,
-                           int32_t *pRes);
+int32_t plp_cos_q32s_xpulpv2(int32_t x);
 
-/** -------------------------------------------------------
-   @brief Convolution of 8-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
-*/
+/**
+ * @brief      Glue code for q16 cosine function
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
 
-void plp_conv_i8s_xpulpv2(const int8_t *pSrcA,
-                          const uint32_t srcALen,
-                          const int8_t *pSrcB,
-                          const uint32_t srcBLen,
-                          int32_t *pRes);
+int16_t plp_cos_q16(int16_t x);
 
-/** -------------------------------------------------------
-   @brief Convolution (valid) of 8-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
-*/
+/**
+ * @brief      q16 cosine function for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
 
-void plp_conv_valid_i8s_xpulpv2(const int8_t *pSrcA,
-                                const uint32_t srcALen,
-                                const int8_t *pSrcB,
-                                const uint32_t srcBLen,
-                                int32_t *pRes);
+int16_t plp_cos_q16s_rv32im(int16_t x);
 
-/** -------------------------------------------------------
-   @brief Convolution (valid with data replication) of 8-bit integer vectors kernel for XPULPV2
-   extension.
-   @param[in]  pSrcA   points to the first input vector of the replicated data
-   @param[in]  srcALen Number of elements in (unreplicated) vector a
-   @param[in]  srcAMem Number of elements between each replication
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
-*/
+/**
+ * @brief      q16 cosine function for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
 
-void plp_conv_valid_rep_i8s_xpulpv2(const int8_t *pSrcA,
-                                    const uint32_t srcALen,
-                                    const uint32_t srcAMem,
-                                    const int8_t *pSrcB,
-                                    const uint32_t srcBLen,
-                                    int32_t *pRes);
+int16_t plp_cos_q16s_xpulpv2(int16_t x);
 
-/** -------------------------------------------------------
-   @brief Convolution of 8-bit integer vectors kernel for RV32IM extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
-*/
+/**
+ * @brief      Glue code for f32 cosine function
+ *
+ * @param[in]  x     input value in radians
+ *
+ * @return     cos(x)
+ */
 
-void plp_conv_i8s_rv32im(const int8_t *pSrcA,
-                         const uint32_t srcALen,
-                         const int8_t *pSrcB,
-                         const uint32_t srcBLen,
-                         int32_t *pRes);
+float32_t plp_cos_f32(float32_t x);
+
+/**
+ * @brief      F32 cosine function for XPULPV2
+ *
+ * @param[in]  x     input value in radians
+ *
+ * @return     cos(x)
+ */
+
+float32_t plp_cos_f32s_xpulpv2(float32_t x);
+
+/**
+ * @brief      Glue code for q32 sine function
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int32_t plp_sin_q32(int32_t x);
+
+/**
+ * @brief      q32 sine function for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int32_t plp_sin_q32s_rv32im(int32_t x);
+
+/**
+ * @brief      q32 sine function for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int32_t plp_sin_q32s_xpulpv2(int32_t x);
+
+/**
+ * @brief      Glue code for q16 sine function
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int16_t plp_sin_q16(int16_t x);
+
+/**
+ * @brief      q16 sine function for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int16_t plp_sin_q16s_rv32im(int16_t x);
+
+/**
+ * @brief      q16 sine function for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int16_t plp_sin_q16s_xpulpv2(int16_t x);
+
+/**
+ * @brief      Glue code for f32 sine function
+ *
+ * @param[in]  x     input value in radians
+ *
+ * @return     sin(x)
+ */
+
+float32_t plp_sin_f32(float32_t x);
+
+/**
+ * @brief      F32 sine function for XPULPV2
+ *
+ * @param[in]  x     input value in radians
+ *
+ * @return     sin(x)
+ */
+
+float32_t plp_sin_f32s_xpulpv2(float32_t x);
 
 /** -------------------------------------------------------
-  @brief Glue code for parallel convolution of 32-bit integer vectors.
+    @brief Glue code for correlation of 32-bit integer vectors.
+    @param[in]  pSrcA   points to the first input vector
+    @param[in]  srcALen Length of the first input vector
+    @param[in]  pSrcB   points to the second input vector
+    @param[in]  srcBLen Length of the second input vector
+    @param[out] pRes    output result returned here
+    @return     none
+*/
+
+void plp_correlate_i32(const int32_t *pSrcA,
+                       const uint32_t srcALen,
+                       const int32_t *pSrcB,
+                       const uint32_t srcBLen,
+                       int32_t *pRes);
+
+/** -------------------------------------------------------
+    @brief Correlation of 32-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA   points to the first input vector
+    @param[in]  srcALen Length of the first input vector
+    @param[in]  pSrcB   points to the second input vector
+    @param[in]  srcBLen Length of the second input vector
+    @param[out] pRes    output result returned here
+    @return     none
+*/
+
+void plp_correlate_i32s_rv32im(const int32_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int32_t *pSrcB,
+                               const uint32_t srcBLen,
+                               int32_t *pRes);
+
+/** -------------------------------------------------------
+    @brief Correlation of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  pSrcA   points to the first input vector
+    @param[in]  srcALen Length of the first input vector
+    @param[in]  pSrcB   points to the second input vector
+    @param[in]  srcBLen Length of the second input vector
+    @param[out] pRes    output result returned here
+    @return     none */
+
+void plp_correlate_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                const uint32_t srcALen,
+                                const int32_t *__restrict__ pSrcB,
+                                const uint32_t srcBLen,
+                                int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for correlation of 16-bit integer vectors.
   @param[in]  pSrcA   points to the first input vector
   @param[in]  srcALen Length of the first input vector
   @param[in]  pSrcB   points to the second input vector
   @param[in]  srcBLen Length of the second input vector
-  @param[in]  nPE     Number of cores to compute on
-  @param[out] pRes    output result returned here
+  @param[out] pRes    result returned here
   @return     none
  */
 
-void plp_conv_i32_parallel(const int32_t *pSrcA,
-                           const uint32_t srcALen,
-                           const int32_t *pSrcB,
-                           const uint32_t srcBLen,
-                           const uint8_t nPE,
-                           int32_t *pRes);
+void plp_correlate_i16(const int16_t *pSrcA,
+                       const uint32_t srcALen,
+                       const int16_t *pSrcB,
+                       const uint32_t srcBLen,
+                       int32_t *pRes);
 
 /** -------------------------------------------------------
-  @brief Setup code for parallel convolution of 32-bit integer vectors.
-  @param[in]  task_args      pointer to plp_conv_instance_i32 struct initialized by
-                             plp_conv_i32_parallel
-  @return     none
- */
+   @brief Correlation of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
 
-void plp_conv_i32p_xpulpv2(void *task_args);
+void plp_correlate_i16s_xpulpv2(const int16_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int16_t *pSrcB,
+                                const uint32_t srcBLen,
+                                int32_t *pRes);
 
 /** -------------------------------------------------------
-  @brief Glue code for parallel convolution of 16-bit integer vectors.
+   @brief Correlation of 16-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
+*/
+
+void plp_correlate_i16s_rv32im(const int16_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int16_t *pSrcB,
+                               const uint32_t srcBLen,
+                               int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for correlation of 8-bit integer vectors.
   @param[in]  pSrcA   points to the first input vector
   @param[in]  srcALen Length of the first input vector
   @param[in]  pSrcB   points to the second input vector
   @param[in]  srcBLen Length of the second input vector
-  @param[in]  nPE     Number of cores to compute on
   @param[out] pRes    output result returned here
   @return     none
  */
 
-void plp_conv_i16_parallel(const int16_t *pSrcA,
-                           const uint32_t srcALen,
-                           const int16_t *pSrcB,
-                           const uint32_t srcBLen,
-                           const uint8_t nPE,
-                           int32_t *pRes);
-/** -------------------------------------------------------
-  @brief Setup code for parallel convolution of 16-bit integer vectors.
-  @param[in]  task_args  pointer to plp_conv_instance_i16 struct initialized by
-                         plp_conv_i16_parallel
-  @return     none
- */
-
-void plp_conv_i16p_xpulpv2(void *task_args);
+void plp_correlate_i8(const int8_t *pSrcA,
+                      const uint32_t srcALen,
+                      const int8_t *pSrcB,
+                      const uint32_t srcBLen,
+                      int32_t *pRes);
 
 /** -------------------------------------------------------
-  @brief Glue code for parallel convolution of 8-bit integer vectors.
+  @brief Glue code for correlation (valid) of 8-bit integer vectors.
   @param[in]  pSrcA   points to the first input vector
   @param[in]  srcALen Length of the first input vector
   @param[in]  pSrcB   points to the second input vector
   @param[in]  srcBLen Length of the second input vector
-  @param[in]  nPE     Number of cores to compute on
   @param[out] pRes    output result returned here
   @return     none
  */
 
-void plp_conv_i8_parallel(const int8_t *pSrcA,
-                          const uint32_t srcALen,
-                          const int8_t *pSrcB,
-                          const uint32_t srcBLen,
-                          const uint8_t nPE,
-                          int32_t *pRes);
-/** -------------------------------------------------------
-  @brief Setup code for parallel convolution of 8-bit integer vectors.
-  @param[in]  task_args  pointer to plp_conv_instance_i8 struct initialized by
-                         plp_conv_i8_parallel
-  @return     none
- */
-
-void plp_conv_i8p_xpulpv2(void *task_args);
+void plp_correlate_valid_i8(const int8_t *pSrcA,
+                            const uint32_t srcALen,
+                            const int8_t *pSrcB,
+                            const uint32_t srcBLen,
+                            int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief Helper function for parallelized overlap-adding of partial convolution results
-   @param[in] nPE Number of processing cores
-   @param[in] srcALen Length of the first original input vector
-   @param[in] srcBLen Length of the second original input vector
-   @param[in] resultsBuffer resultsBuffer array from plp_conv_i[XX]_parallel
-   @return none
+   @brief Correlation of 8-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
 */
 
-void plp_conv_parallel_OLA(uint32_t nPE,
-                           uint32_t srcALen,
-                           uint32_t srcBLen,
-                           int32_t *resultsBuffer);
-
-/** -------------------------------------------------------
-   @brief Helper function for parallelized overlap-adding of partial convolution results
-   @param[in] task_args  Holds the plp_conv_tree_add_instance that describes the vector parameters
-   @return none
-*/
-void plp_conv_parallel_OLA_kernel(void *task_args);
+void plp_correlate_i8s_xpulpv2(const int8_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int8_t *pSrcB,
+                               const uint32_t srcBLen,
+                               int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix matrix multiplication of a 32-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
+   @brief Correlation of 8-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
    @return     none
 */
 
-void plp_mat_mult_i32(const int32_t *__restrict__ pSrcA,
-                      const int32_t *__restrict__ pSrcB,
-                      uint32_t M,
-                      uint32_t N,
-                      uint32_t O,
-                      int32_t *__restrict__ pDstC);
-
-/** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 32-bit integer matrices for RV32IM extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+void plp_correlate_i8s_rv32im(const int8_t *pSrcA,
+                              const uint32_t srcALen,
+                              const int8_t *pSrcB,
+                              const uint32_t srcBLen,
+                              int32_t *pRes);
 
-void plp_mat_mult_i32s_rv32im(const int32_t *__restrict__ pSrcA,
-                              const int32_t *__restrict__ pSrcB,
-                              uint32_t M,
-                              uint32_t N,
-                              uint32_t O,
-                              int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 32-bit integer matrices for XPULPV2 extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
+    @brief Glue code for correlation of 32-bit integer vectors.
+    @param[in]  pSrcA   points to the first input vector
+    @param[in]  srcALen Length of the first input vector
+    @param[in]  pSrcB   points to the second input vector
+    @param[in]  srcBLen Length of the second input vector
+    @param[out] pRes    output result returned here
+    @return     none
 */
 
-void plp_mat_mult_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               int32_t *__restrict__ pDstC);
+void plp_correlate_q32(const int32_t *pSrcA,
+                       const uint32_t srcALen,
+                       const int32_t *pSrcB,
+                       const uint32_t srcBLen,
+		       const uint32_t fracBits,
+                       int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix matrix multiplication of a 16-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
+    @brief Correlation of 32-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA   points to the first input vector
+    @param[in]  srcALen Length of the first input vector
+    @param[in]  pSrcB   points to the second input vector
+    @param[in]  srcBLen Length of the second input vector
+    @param[out] pRes    output result returned here
+    @return     none
 */
 
-void plp_mat_mult_i16(const int16_t *__restrict__ pSrcA,
-                      const int16_t *__restrict__ pSrcB,
-                      uint32_t M,
-                      uint32_t N,
-                      uint32_t O,
-                      int32_t *__restrict__ pDstC);
+void plp_correlate_q32s_rv32im(const int32_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int32_t *pSrcB,
+                               const uint32_t srcBLen,
+			       const uint32_t fracBits,
+                               int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 16-bit integer matrices for RV32IM extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+    @brief Correlation of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  pSrcA   points to the first input vector
+    @param[in]  srcALen Length of the first input vector
+    @param[in]  pSrcB   points to the second input vector
+    @param[in]  srcBLen Length of the second input vector
+    @param[out] pRes    output result returned here
+    @return     none */
 
-void plp_mat_mult_i16s_rv32im(const int16_t *__restrict__ pSrcA,
-                              const int16_t *__restrict__ pSrcB,
-                              uint32_t M,
-                              uint32_t N,
-                              uint32_t O,
-                              int32_t *__restrict__ pDstC);
+void plp_correlate_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                const uint32_t srcALen,
+                                const int32_t *__restrict__ pSrcB,
+                                const uint32_t srcBLen,
+				const uint32_t fracBits,
+                                int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 16-bit integer matrices for XPULPV2 extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-
-   @par Exploiting SIMD instructions
-   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-   performed on 32 bit vectors, with 32 bit accumulator.
-*/
+  @brief Glue code for correlation of 16-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    result returned here
+  @return     none
+ */
 
-void plp_mat_mult_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                               const int16_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               int32_t *__restrict__ pDstC);
+void plp_correlate_q16(const int16_t *pSrcA,
+                       const uint32_t srcALen,
+                       const int16_t *pSrcB,
+                       const uint32_t srcBLen,
+		       const uint32_t fracBits,
+                       int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix matrix multiplication of a 8-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
+   @brief Correlation of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
    @return     none
 */
 
-void plp_mat_mult_i8(const int8_t *__restrict__ pSrcA,
-                     const int8_t *__restrict__ pSrcB,
-                     uint32_t M,
-                     uint32_t N,
-                     uint32_t O,
-                     int32_t *__restrict__ pDstC);
+void plp_correlate_q16s_xpulpv2(const int16_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int16_t *pSrcB,
+                                const uint32_t srcBLen,
+				const uint32_t fracBits,
+                                int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 8-bit integer matrices for RV32IM extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
+   @brief Correlation of 16-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
    @return     none
 */
 
-void plp_mat_mult_i8s_rv32im(const int8_t *__restrict__ pSrcA,
-                             const int8_t *__restrict__ pSrcB,
-                             uint32_t M,
-                             uint32_t N,
-                             uint32_t O,
-                             int32_t *__restrict__ pDstC);
+void plp_correlate_q16s_rv32im(const int16_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int16_t *pSrcB,
+                               const uint32_t srcBLen,
+			       const uint32_t fracBits,
+                               int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 8-bit integer matrices for XPULPV2 extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-
-   @par Exploiting SIMD instructions
-   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-   performed on 32 bit vectors, with 32 bit accumulator.
-*/
+  @brief Glue code for correlation of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
 
-void plp_mat_mult_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                              const int8_t *__restrict__ pSrcB,
-                              uint32_t M,
-                              uint32_t N,
-                              uint32_t O,
-                              int32_t *__restrict__ pDstC);
+void plp_correlate_q8(const int8_t *pSrcA,
+                      const uint32_t srcALen,
+                      const int8_t *pSrcB,
+                      const uint32_t srcBLen,
+		      const uint32_t fracBits,
+                      int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+  @brief Glue code for correlation (valid) of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
 
-void plp_mat_mult_i32_parallel(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               uint32_t nPE,
-                               int32_t *__restrict__ pDstC);
+void plp_correlate_valid_q8(const int8_t *pSrcA,
+                            const uint32_t srcALen,
+                            const int8_t *pSrcB,
+                            const uint32_t srcBLen,
+			    const uint32_t fracBits,
+                            int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief      Parallel matrix matrix multiplication of a 32-bit integer matrices for XPULPV2
-               extension.
-   @param[in]  args  pointer to plp_mat_mult_instance_i32 struct initialized by
-                     plp_mat_mult_i32_parallel
+   @brief Correlation of 8-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
    @return     none
 */
 
-void plp_mat_mult_i32p_xpulpv2(void *args);
+void plp_correlate_q8s_xpulpv2(const int8_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int8_t *pSrcB,
+                               const uint32_t srcBLen,
+			       const uint32_t fracBits,
+                               int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 16-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
+   @brief Correlation of 8-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
    @return     none
 */
 
-void plp_mat_mult_i16_parallel(const int16_t *__restrict__ pSrcA,
-                               const int16_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               uint32_t nPE,
-                               int32_t *__restrict__ pDstC);
+void plp_correlate_q8s_rv32im(const int8_t *pSrcA,
+                              const uint32_t srcALen,
+                              const int8_t *pSrcB,
+                              const uint32_t srcBLen,
+			      const uint32_t fracBits,
+                              int32_t *pRes);
 
-/** -------------------------------------------------------
-    @brief Parallel matrix multiplication of 16-bit integer matrices kernel for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_i16 struct initialized by
-                      plp_mat_mult_i16_parallel
-    @return     none
 
-    @par Exploiting SIMD instructions
-    The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-    performed on 32 bit vectors, with 32 bit accumulator.
-*/
+/** -------------------------------------------------------
+  @brief Glue code for convolution of 32-bit integer vectors.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[out] pRes     result returned here
+  @return     none
+ */
 
-void plp_mat_mult_i16p_xpulpv2(void *args);
+void plp_conv_i32(const int32_t *pSrcA,
+                  const uint32_t srcALen,
+                  const int32_t *pSrcB,
+                  const uint32_t srcBLen,
+                  int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 8-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+  @brief Scratch memory needed by plp_conv_i32 (see plp_l1_arena_use).
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @return     number of bytes
+ */
 
-void plp_mat_mult_i8_parallel(const int8_t *__restrict__ pSrcA,
-                              const int8_t *__restrict__ pSrcB,
-                              uint32_t M,
-                              uint32_t N,
-                              uint32_t O,
-                              uint32_t nPE,
-                              int32_t *__restrict__ pDstC);
+uint32_t plp_conv_i32_get_workspace_size(const uint32_t srcALen, const uint32_t srcBLen);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix matrix multiplication of a 32-bit floating-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+  @brief Glue code for convolution (valid) of 32-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
 
-void plp_mat_mult_f32(const float *__restrict__ pSrcA,
-                      const float *__restrict__ pSrcB,
-                      uint32_t M,
-                      uint32_t N,
-                      uint32_t O,
-                      float *__restrict__ pDstC);
+void plp_conv_valid_i32(const int32_t *pSrcA,
+                        const uint32_t srcALen,
+                        const int32_t *pSrcB,
+                        const uint32_t srcBLen,
+                        int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 32-bit floating-point matrices for XPULPV2
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
+   @brief Convolution of 32-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
    @return     none
 */
 
-void plp_mat_mult_f32s_xpulpv2(const float *__restrict__ pSrcA,
-                               const float *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               float *__restrict__ pDstC);
+void plp_conv_i32s_rv32im(const int32_t *pSrcA,
+                          const uint32_t srcALen,
+                          const int32_t *pSrcB,
+                          const uint32_t srcBLen,
+                          int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit floating-point
-   matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
+   @brief Convolution of 32-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
    @return     none
 */
 
-void plp_mat_mult_f32_parallel(const float *__restrict__ pSrcA,
-                               const float *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               uint32_t nPE,
-                               float *__restrict__ pDstC);
+void plp_conv_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                           const uint32_t srcALen,
+                           const int32_t *__restrict__ pSrcB,
+                           const uint32_t srcBLen,
+                           int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Parallel matrix multiplication of 32-bit floating-point matrices kernel for XPULPV2
-                extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_f32 struct initialized by
-                      plp_mat_mult_f32_parallel
-    @return     none
-*/
+   @brief Convolution (valid) of 32-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none */
 
-void plp_mat_mult_f32p_xpulpv2(void *args);
+void plp_conv_valid_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                 const uint32_t srcALen,
+                                 const int32_t *__restrict__ pSrcB,
+                                 const uint32_t srcBLen,
+                                 int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-   @brief      Parallel matrix multiplication of 8-bit integer matrices kernel for XPULPV2
-               extension.
-   @param[in]  args  pointer to plp_mat_mult_instance_i8 struct initialized by
-                     plp_mat_mult_i8_parallel
-   @return     none
-
-   @par Exploiting SIMD instructions
-   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-   performed on 32 bit vectors, with 32 bit accumulator.
-*/
+  @brief Glue code for convolution of 16-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
 
-void plp_mat_mult_i8p_xpulpv2(void *args);
+void plp_conv_i16(const int16_t *pSrcA,
+                  const uint32_t srcALen,
+                  const int16_t *pSrcB,
+                  const uint32_t srcBLen,
+                  int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix matrix multiplication of a 32-bit fix-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief Scratch memory needed by plp_conv_i16 (see plp_l1_arena_use).
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @return     number of bytes
+ */
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+uint32_t plp_conv_i16_get_workspace_size(const uint32_t srcALen, const uint32_t srcBLen);
+
+/** -------------------------------------------------------
+  @brief Glue code for convolution (valid) of 16-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
  */
 
-void plp_mat_mult_q32(const int32_t *__restrict__ pSrcA,
-                      const int32_t *__restrict__ pSrcB,
-                      uint32_t M,
-                      uint32_t N,
-                      uint32_t O,
-                      uint32_t shift,
-                      int32_t *__restrict__ pDstC);
+void plp_conv_valid_i16(const int16_t *pSrcA,
+                        const uint32_t srcALen,
+                        const int16_t *pSrcB,
+                        const uint32_t srcBLen,
+                        int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit fix-point
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief Glue code for convolution (valid with replication) of 16-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_conv_valid_rep_i16(const int16_t *pSrcA,
+                            const uint32_t srcALen,
+                            const int16_t *pSrcB,
+                            const uint32_t srcBLen,
+                            int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Scratch memory needed by plp_conv_valid_rep_i16 (see plp_l1_arena_use).
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @return     number of bytes
  */
 
-void plp_mat_mult_q32_parallel(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               uint32_t shift,
-                               uint32_t nPE,
-                               int32_t *__restrict__ pDstC);
+uint32_t plp_conv_valid_rep_i16_get_workspace_size(const uint32_t srcALen,
+                                                   const uint32_t srcBLen);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 32-bit fix-point matrices for RV32IM extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
+   @brief Convolution of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
    @return     none
-
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 */
 
-void plp_mat_mult_q32s_rv32im(const int32_t *__restrict__ pSrcA,
-                              const int32_t *__restrict__ pSrcB,
-                              uint32_t M,
-                              uint32_t N,
-                              uint32_t O,
-                              uint32_t shift,
-                              int32_t *__restrict__ pDstC);
+void plp_conv_i16s_xpulpv2(const int16_t *pSrcA,
+                           const uint32_t srcALen,
+                           const int16_t *pSrcB,
+                           const uint32_t srcBLen,
+                           int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 32-bit fix-point matrices for XPULPV2 extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
+   @brief Convolution (valid) of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
    @return     none
-
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 */
 
-void plp_mat_mult_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               uint32_t shift,
-                               int32_t *__restrict__ pDstC);
+void plp_conv_valid_i16s_xpulpv2(const int16_t *pSrcA,
+                                 const uint32_t srcALen,
+                                 const int16_t *pSrcB,
+                                 const uint32_t srcBLen,
+                                 int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief Parallel matrix multiplication of 32-bit fix-point matrices kernel for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_q32 struct initialized by
-                      plp_mat_mult_q32_parallel
-    @return     none
+   @brief Convolution (valid with data replication) of 16-bit integer vectors kernel for XPULPV2
+   extension.
+   @param[in]  pSrcA   points to the first input vector of the replicated data
+   @param[in]  srcALen Number of elements in (unreplicated) vector a
+   @param[in]  srcAMem Number of elements between each replication
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
 */
 
-void plp_mat_mult_q32p_xpulpv2(void *args);
+void plp_conv_valid_rep_i16s_xpulpv2(const int16_t *pSrcA,
+                                     const uint32_t srcALen,
+                                     const uint32_t srcAMem,
+                                     const int16_t *pSrcB,
+                                     const uint32_t srcBLen,
+                                     int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix matrix multiplication of a 16-bit fix-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
+   @brief Convolution of 16-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
    @return     none
+*/
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_conv_i16s_rv32im(const int16_t *pSrcA,
+                          const uint32_t srcALen,
+                          const int16_t *pSrcB,
+                          const uint32_t srcBLen,
+                          int32_t *pRes);
 
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
+/** -------------------------------------------------------
+  @brief Glue code for convolution of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
  */
 
-void plp_mat_mult_q16(const int16_t *__restrict__ pSrcA,
-                      const int16_t *__restrict__ pSrcB,
-                      uint32_t M,
-                      uint32_t N,
-                      uint32_t O,
-                      uint32_t shift,
-                      int16_t *__restrict__ pDstC);
+void plp_conv_i8(const int8_t *pSrcA,
+                 const uint32_t srcALen,
+                 const int8_t *pSrcB,
+                 const uint32_t srcBLen,
+                 int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 16-bit fix-point
-  matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief Scratch memory needed by plp_conv_i8 (see plp_l1_arena_use).
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @return     number of bytes
+ */
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+uint32_t plp_conv_i8_get_workspace_size(const uint32_t srcALen, const uint32_t srcBLen);
 
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
+/** -------------------------------------------------------
+  @brief Glue code for convolution (valid) of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
  */
 
-void plp_mat_mult_q16_parallel(const int16_t *__restrict__ pSrcA,
-                               const int16_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               uint32_t shift,
-                               uint32_t nPE,
-                               int16_t *__restrict__ pDstC);
+void plp_conv_valid_i8(const int8_t *pSrcA,
+                       const uint32_t srcALen,
+                       const int8_t *pSrcB,
+                       const uint32_t srcBLen,
+                       int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 16-bit fix-point matrices for RV32IM extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief Glue code for convolution (valid with data replication) of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector (in L2)
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector (in L2)
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here (preferably in L1)
+  @return     none
+ */
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_conv_valid_rep_i8(const int8_t *pSrcA,
+                           const uint32_t srcALen,
+                           const int8_t *pSrcB,
+                           const uint32_t srcBLen,
+                           int32_t *pRes);
 
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
-*/
+/** -------------------------------------------------------
+  @brief Scratch memory needed by plp_conv_valid_rep_i8 (see plp_l1_arena_use).
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @return     number of bytes
+ */
 
-void plp_mat_mult_q16s_rv32im(const int16_t *__restrict__ pSrcA,
-                              const int16_t *__restrict__ pSrcB,
-                              uint32_t M,
-                              uint32_t N,
-                              uint32_t O,
-                              uint32_t shift,
-                              int16_t *__restrict__ pDstC);
+uint32_t plp_conv_valid_rep_i8_get_workspace_size(const uint32_t srcALen,
+                                                  const uint32_t srcBLen);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 16-bit fix-point matrices for XPULPV2 extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
+   @brief Convolution of 8-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
    @return     none
-
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
-
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
 */
 
-void plp_mat_mult_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                               const int16_t *__restrict__ pSrcB,
-                               uint32_t M,
-                               uint32_t N,
-                               uint32_t O,
-                               uint32_t shift,
-                               int16_t *__restrict__ pDstC);
+void plp_conv_i8s_xpulpv2(const int8_t *pSrcA,
+                          const uint32_t srcALen,
+                          const int8_t *pSrcB,
+                          const uint32_t srcBLen,
+                          int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief Parallel matrix multiplication of 16-bit fix-point matrices kernel for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_q16 struct initialized by
-                      plp_mat_mult_q16_parallel
-    @return     none
+   @brief Convolution (valid) of 8-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
 */
 
-void plp_mat_mult_q16p_xpulpv2(void *args);
+void plp_conv_valid_i8s_xpulpv2(const int8_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int8_t *pSrcB,
+                                const uint32_t srcBLen,
+                                int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix matrix multiplication of a 8-bit fix-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
+   @brief Convolution (valid with data replication) of 8-bit integer vectors kernel for XPULPV2
+   extension.
+   @param[in]  pSrcA   points to the first input vector of the replicated data
+   @param[in]  srcALen Number of elements in (unreplicated) vector a
+   @param[in]  srcAMem Number of elements between each replication
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
    @return     none
+*/
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
-
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
- */
-
-void plp_mat_mult_q8(const int8_t *__restrict__ pSrcA,
-                     const int8_t *__restrict__ pSrcB,
-                     uint32_t M,
-                     uint32_t N,
-                     uint32_t O,
-                     uint32_t shift,
-                     int8_t *__restrict__ pDstC);
+void plp_conv_valid_rep_i8s_xpulpv2(const int8_t *pSrcA,
+                                    const uint32_t srcALen,
+                                    const uint32_t srcAMem,
+                                    const int8_t *pSrcB,
+                                    const uint32_t srcBLen,
+                                    int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 8-bit fix-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
+   @brief Convolution of 8-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
    @return     none
+*/
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_conv_i8s_rv32im(const int8_t *pSrcA,
+                         const uint32_t srcALen,
+                         const int8_t *pSrcB,
+                         const uint32_t srcBLen,
+                         int32_t *pRes);
 
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
+/** -------------------------------------------------------
+  @brief Glue code for parallel convolution of 32-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[in]  nPE     Number of cores to compute on
+  @param[out] pRes    output result returned here
+  @return     none
  */
 
-void plp_mat_mult_q8_parallel(const int8_t *__restrict__ pSrcA,
-                              const int8_t *__restrict__ pSrcB,
-                              uint32_t M,
-                              uint32_t N,
-                              uint32_t O,
-                              uint32_t shift,
-                              uint32_t nPE,
-                              int8_t *__restrict__ pDstC);
+void plp_conv_i32_parallel(const int32_t *pSrcA,
+                           const uint32_t srcALen,
+                           const int32_t *pSrcB,
+                           const uint32_t srcBLen,
+                           const uint8_t nPE,
+                           int32_t *pRes);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 8-bit fix-point matrices for RV32IM extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief Scratch memory needed by plp_conv_i32_parallel (see plp_l1_arena_use).
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  nPE      Number of cores to compute on
+  @return     number of bytes
+ */
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+uint32_t plp_conv_i32_parallel_get_workspace_size(const uint32_t srcALen,
+                                                  const uint32_t srcBLen,
+                                                  const uint8_t nPE);
 
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
-*/
+/** -------------------------------------------------------
+  @brief Setup code for parallel convolution of 32-bit integer vectors.
+  @param[in]  task_args      pointer to plp_conv_instance_i32 struct initialized by
+                             plp_conv_i32_parallel
+  @return     none
+ */
 
-void plp_mat_mult_q8s_rv32im(const int8_t *__restrict__ pSrcA,
-                             const int8_t *__restrict__ pSrcB,
-                             uint32_t M,
-                             uint32_t N,
-                             uint32_t O,
-                             uint32_t shift,
-                             int8_t *__restrict__ pDstC);
+void plp_conv_i32p_xpulpv2(void *task_args);
 
 /** -------------------------------------------------------
-   @brief      Matrix matrix multiplication of a 8-bit fix-point matrices for XPULPV2 extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
-
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+  @brief Glue code for parallel convolution of 16-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[in]  nPE     Number of cores to compute on
+  @param[out] pRes    output result returned here
+  @return     none
+ */
 
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
-*/
+void plp_conv_i16_parallel(const int16_t *pSrcA,
+                           const uint32_t srcALen,
+                           const int16_t *pSrcB,
+                           const uint32_t srcBLen,
+                           const uint8_t nPE,
+                           int32_t *pRes);
 
-void plp_mat_mult_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                              const int8_t *__restrict__ pSrcB,
-                              uint32_t M,
-                              uint32_t N,
-                              uint32_t O,
-                              uint32_t shift,
-                              int8_t *__restrict__ pDstC);
+/** -------------------------------------------------------
+  @brief Scratch memory needed by plp_conv_i16_parallel (see plp_l1_arena_use).
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  nPE      Number of cores to compute on
+  @return     number of bytes
+ */
 
+uint32_t plp_conv_i16_parallel_get_workspace_size(const uint32_t srcALen,
+                                                  const uint32_t srcBLen,
+                                                  const uint8_t nPE);
 /** -------------------------------------------------------
-    @brief Parallel matrix multiplication of 8-bit fix-point matrices kernel for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_q8 struct initialized by
-                      plp_mat_mult_q8_parallel
-    @return     none
-*/
+  @brief Setup code for parallel convolution of 16-bit integer vectors.
+  @param[in]  task_args  pointer to plp_conv_instance_i16 struct initialized by
+                         plp_conv_i16_parallel
+  @return     none
+ */
 
-void plp_mat_mult_q8p_xpulpv2(void *args);
+void plp_conv_i16p_xpulpv2(void *task_args);
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix matrix multiplication for complex 32-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief Glue code for parallel convolution of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[in]  nPE     Number of cores to compute on
+  @param[out] pRes    output result returned here
   @return     none
-*/
+ */
 
-void plp_mat_mult_cmplx_i32(const int32_t *__restrict__ pSrcA,
-                            const int32_t *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            int32_t *__restrict__ pDstC);
+void plp_conv_i8_parallel(const int8_t *pSrcA,
+                          const uint32_t srcALen,
+                          const int8_t *pSrcB,
+                          const uint32_t srcBLen,
+                          const uint8_t nPE,
+                          int32_t *pRes);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 32-bit integers on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
+  @brief Scratch memory needed by plp_conv_i8_parallel (see plp_l1_arena_use).
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  nPE      Number of cores to compute on
+  @return     number of bytes
+ */
+
+uint32_t plp_conv_i8_parallel_get_workspace_size(const uint32_t srcALen,
+                                                 const uint32_t srcBLen,
+                                                 const uint8_t nPE);
+/** -------------------------------------------------------
+  @brief Setup code for parallel convolution of 8-bit integer vectors.
+  @param[in]  task_args  pointer to plp_conv_instance_i8 struct initialized by
+                         plp_conv_i8_parallel
   @return     none
-*/
+ */
 
-void plp_mat_mult_cmplx_i32s_rv32im(const int32_t *__restrict__ pSrcA,
-                                    const int32_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    int32_t *__restrict__ pDstC);
+void plp_conv_i8p_xpulpv2(void *task_args);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 32-bit integers on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief Helper function for parallelized overlap-adding of partial convolution results
+   @param[in] nPE Number of processing cores
+   @param[in] srcALen Length of the first original input vector
+   @param[in] srcBLen Length of the second original input vector
+   @param[in] resultsBuffer resultsBuffer array from plp_conv_i[XX]_parallel
+   @return none
 */
 
-void plp_mat_mult_cmplx_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                     const int32_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     int32_t *__restrict__ pDstC);
+void plp_conv_parallel_OLA(uint32_t nPE,
+                           uint32_t srcALen,
+                           uint32_t srcBLen,
+                           int32_t *resultsBuffer);
 
 /** -------------------------------------------------------
-  @brief      Glue code of parallel matrix matrix multiplication for complex 32-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief Helper function for parallelized overlap-adding of partial convolution results
+   @param[in] task_args  Holds the plp_conv_tree_add_instance that describes the vector parameters
+   @return none
 */
-
-void plp_mat_mult_cmplx_i32_parallel(const int32_t *__restrict__ pSrcA,
-                                     const int32_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t nPE,
-                                     int32_t *__restrict__ pDstC);
+void plp_conv_parallel_OLA_kernel(void *task_args);
 
 /** -------------------------------------------------------
-  @brief      parallel matrix matrix multiplication for complex 32-bit integers on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i32 struct initialized by
-                    plp_mat_mult_cmplx_i32_parallel
-  @return     none
+   @brief      Glue code for matrix matrix multiplication of a 32-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mat_mult_cmplx_i32p_xpulpv2(void *args);
+void plp_mat_mult_i32(const int32_t *__restrict__ pSrcA,
+                      const int32_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix matrix multiplication for complex 16-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Matrix matrix multiplication of a 32-bit integer matrices for RV32IM extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mat_mult_cmplx_i16(const int16_t *__restrict__ pSrcA,
-                            const int16_t *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            int32_t *__restrict__ pDstC);
+void plp_mat_mult_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 16-bit integers on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Matrix matrix multiplication of a 32-bit integer matrices for XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mat_mult_cmplx_i16s_rv32im(const int16_t *__restrict__ pSrcA,
-                                    const int16_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    int32_t *__restrict__ pDstC);
+void plp_mat_mult_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 16-bit integers on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+   @brief      Glue code for matrix matrix multiplication of a 16-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mat_mult_cmplx_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                                     const int16_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     int32_t *__restrict__ pDstC);
+void plp_mat_mult_i16(const int16_t *__restrict__ pSrcA,
+                      const int16_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Glue code of parallel matrix matrix multiplication for complex 16-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Matrix matrix multiplication of a 16-bit integer matrices for RV32IM extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mat_mult_cmplx_i16_parallel(const int16_t *__restrict__ pSrcA,
-                                     const int16_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t nPE,
-                                     int32_t *__restrict__ pDstC);
+void plp_mat_mult_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      parallel matrix matrix multiplication for complex 16-bit integers on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i16 struct initialized by
-                    plp_mat_mult_cmplx_i16_parallel
-  @return     none
+   @brief      Matrix matrix multiplication of a 16-bit integer matrices for XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+   @par Exploiting SIMD instructions
+   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_mat_mult_cmplx_i16p_xpulpv2(void *args);
-
-/** -------------------------------------------------------
-  @brief      Glue code of matrix matrix multiplication for complex 8-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+void plp_mat_mult_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix matrix multiplication of a 8-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mat_mult_cmplx_i8(const int8_t *__restrict__ pSrcA,
-                           const int8_t *__restrict__ pSrcB,
-                           uint32_t M,
-                           uint32_t N,
-                           uint32_t O,
-                           int32_t *__restrict__ pDstC);
+void plp_mat_mult_i8(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t M,
+                     uint32_t N,
+                     uint32_t O,
+                     int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 8-bit integers on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Matrix matrix multiplication of a 8-bit integer matrices for RV32IM extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mat_mult_cmplx_i8s_rv32im(const int8_t *__restrict__ pSrcA,
-                                   const int8_t *__restrict__ pSrcB,
-                                   uint32_t M,
-                                   uint32_t N,
-                                   uint32_t O,
-                                   int32_t *__restrict__ pDstC);
+void plp_mat_mult_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 8-bit integers on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Matrix matrix multiplication of a 8-bit integer matrices for XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+   @par Exploiting SIMD instructions
+   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_mat_mult_cmplx_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                                    const int8_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    int32_t *__restrict__ pDstC);
+void plp_mat_mult_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Glue code of parallel matrix matrix multiplication for complex 8-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mat_mult_cmplx_i8_parallel(const int8_t *__restrict__ pSrcA,
-                                    const int8_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t nPE,
-                                    int32_t *__restrict__ pDstC);
+void plp_mat_mult_i32_parallel(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      parallel matrix matrix multiplication for complex 8-bit integers on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i8 struct initialized by
-                    plp_mat_mult_cmplx_i8_parallel
-  @return     none
-
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+   @brief      Parallel matrix matrix multiplication of a 32-bit integer matrices for XPULPV2
+               extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_i32 struct initialized by
+                     plp_mat_mult_i32_parallel
+   @return     none
 */
 
-void plp_mat_mult_cmplx_i8p_xpulpv2(void *args);
+void plp_mat_mult_i32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix matrix multiplication for complex 32-bit floats
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Glue code for parallel matrix matrix multiplication of a 16-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mat_mult_cmplx_f32(const float *__restrict__ pSrcA,
-                            const float *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            float *__restrict__ pDstC);
+void plp_mat_mult_i16_parallel(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 32-bit floats on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+    @brief Parallel matrix multiplication of 16-bit integer matrices kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_i16 struct initialized by
+                      plp_mat_mult_i16_parallel
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+    performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_mat_mult_cmplx_f32s_xpulpv2(const float *__restrict__ pSrcA,
-                                     const float *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     float *__restrict__ pDstC);
+void plp_mat_mult_i16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief      Glue code of parallel matrix matrix multiplication for complex 32-bit floats
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Glue code for parallel matrix matrix multiplication of a 8-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mat_mult_cmplx_f32_parallel(const float *__restrict__ pSrcA,
-                                     const float *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t nPE,
-                                     float *__restrict__ pDstC);
+void plp_mat_mult_i8_parallel(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t nPE,
+                              int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      parallel matrix matrix multiplication for complex 32-bit floats on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_f32 struct initialized by
-                    plp_mat_mult_cmplx_f32_parallel
-  @return     none
+   @brief      Glue code for matrix matrix multiplication of a 32-bit floating-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mat_mult_cmplx_f32p_xpulpv2(void *args);
+void plp_mat_mult_f32(const float *__restrict__ pSrcA,
+                      const float *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix matrix multiplication for complex 32-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+   @brief      Matrix matrix multiplication of a 32-bit floating-point matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mat_mult_cmplx_q32(const int32_t *__restrict__ pSrcA,
-                            const int32_t *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            uint32_t shift,
-                            int32_t *__restrict__ pDstC);
+void plp_mat_mult_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                               const float *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 32-bit fix-point on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit floating-point
+   matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
 */
 
-void plp_mat_mult_cmplx_q32s_rv32im(const int32_t *__restrict__ pSrcA,
-                                    const int32_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t shift,
-                                    int32_t *__restrict__ pDstC);
+void plp_mat_mult_f32_parallel(const float *__restrict__ pSrcA,
+                               const float *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t nPE,
+                               float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 32-bit fix-point on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+    @brief      Parallel matrix multiplication of 32-bit floating-point matrices kernel for XPULPV2
+                extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_f32 struct initialized by
+                      plp_mat_mult_f32_parallel
+    @return     none
 */
 
-void plp_mat_mult_cmplx_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                     const int32_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t shift,
-                                     int32_t *__restrict__ pDstC);
+void plp_mat_mult_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief      Glue code of parallel matrix matrix multiplication for complex 32-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Parallel matrix multiplication of 8-bit integer matrices kernel for XPULPV2
+               extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_i8 struct initialized by
+                     plp_mat_mult_i8_parallel
+   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+   @par Exploiting SIMD instructions
+   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_mat_mult_cmplx_q32_parallel(const int32_t *__restrict__ pSrcA,
-                                     const int32_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t shift,
-                                     uint32_t nPE,
-                                     int32_t *__restrict__ pDstC);
+void plp_mat_mult_i8p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief      parallel matrix matrix multiplication for complex 32-bit fix-point on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q32 struct initialized by
-                    plp_mat_mult_cmplx_q32_parallel
-  @return     none
+   @brief      Glue code for matrix matrix multiplication of a 32-bit fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+ */
 
-void plp_mat_mult_cmplx_q32p_xpulpv2(void *args);
+void plp_mat_mult_q32(const int32_t *__restrict__ pSrcA,
+                      const int32_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      uint32_t shift,
+                      int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix matrix multiplication for complex 16-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit fix-point
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+ */
 
-void plp_mat_mult_cmplx_q16(const int16_t *__restrict__ pSrcA,
-                            const int16_t *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            uint32_t shift,
-                            int16_t *__restrict__ pDstC);
+void plp_mat_mult_q32_parallel(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t shift,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 16-bit fix-point on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Matrix matrix multiplication of a 32-bit fix-point matrices for RV32IM extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 */
 
-void plp_mat_mult_cmplx_q16s_rv32im(const int16_t *__restrict__ pSrcA,
-                                    const int16_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t shift,
-                                    int16_t *__restrict__ pDstC);
+void plp_mat_mult_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t shift,
+                              int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 16-bit fix-point on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+   @brief      Matrix matrix multiplication of a 32-bit fix-point matrices for XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
 
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 */
 
-void plp_mat_mult_cmplx_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                                     const int16_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t shift,
-                                     int16_t *__restrict__ pDstC);
+void plp_mat_mult_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t shift,
+                               int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Glue code of parallel matrix matrix multiplication for complex 16-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
-
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+    @brief Parallel matrix multiplication of 32-bit fix-point matrices kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q32 struct initialized by
+                      plp_mat_mult_q32_parallel
+    @return     none
 */
 
-void plp_mat_mult_cmplx_q16_parallel(const int16_t *__restrict__ pSrcA,
-                                     const int16_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t shift,
-                                     uint32_t nPE,
-                                     int16_t *__restrict__ pDstC);
+void plp_mat_mult_q32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief      parallel matrix matrix multiplication for complex 16-bit fix-point on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q16 struct initialized by
-                    plp_mat_mult_cmplx_q16_parallel
-  @return     none
+   @brief      Glue code for matrix matrix multiplication of a 16-bit fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
-*/
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
 
-void plp_mat_mult_cmplx_q16p_xpulpv2(void *args);
+void plp_mat_mult_q16(const int16_t *__restrict__ pSrcA,
+                      const int16_t *__restrict__ pSrcB,
+                      uint32_t M,
+                      uint32_t N,
+                      uint32_t O,
+                      uint32_t shift,
+                      int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Glue code of matrix matrix multiplication for complex 8-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Glue code for parallel matrix matrix multiplication of a 16-bit fix-point
+  matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-*/
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 
-void plp_mat_mult_cmplx_q8(const int8_t *__restrict__ pSrcA,
-                           const int8_t *__restrict__ pSrcB,
-                           uint32_t M,
-                           uint32_t N,
-                           uint32_t O,
-                           uint32_t shift,
-                           int8_t *__restrict__ pDstC);
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_q16_parallel(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t shift,
+                               uint32_t nPE,
+                               int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 8-bit fix-point on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Matrix matrix multiplication of a 16-bit fix-point matrices for RV32IM extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
 */
 
-void plp_mat_mult_cmplx_q8s_rv32im(const int8_t *__restrict__ pSrcA,
-                                   const int8_t *__restrict__ pSrcB,
-                                   uint32_t M,
-                                   uint32_t N,
-                                   uint32_t O,
-                                   uint32_t shift,
-                                   int8_t *__restrict__ pDstC);
+void plp_mat_mult_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t shift,
+                              int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      Matrix matrix multiplication for complex 8-bit fix-point on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @brief      Matrix matrix multiplication of a 16-bit fix-point matrices for XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
-*/
-
-void plp_mat_mult_cmplx_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                                    const int8_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t shift,
-                                    int8_t *__restrict__ pDstC);
-
-/** -------------------------------------------------------
-  @brief      Glue code of parallel matrix matrix multiplication for complex 8-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape NxO
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
-  @param[in]  O     Width of matrix SrcB and DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
 */
 
-void plp_mat_mult_cmplx_q8_parallel(const int8_t *__restrict__ pSrcA,
-                                    const int8_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t shift,
-                                    uint32_t nPE,
-                                    int8_t *__restrict__ pDstC);
+void plp_mat_mult_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t M,
+                               uint32_t N,
+                               uint32_t O,
+                               uint32_t shift,
+                               int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-  @brief      parallel matrix matrix multiplication for complex 8-bit fix-point on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q8 struct initialized by
-                    plp_mat_mult_cmplx_q8_parallel
-  @return     none
-
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
-
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+    @brief Parallel matrix multiplication of 16-bit fix-point matrices kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q16 struct initialized by
+                      plp_mat_mult_q16_parallel
+    @return     none
 */
 
-void plp_mat_mult_cmplx_q8p_xpulpv2(void *args);
+void plp_mat_mult_q16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix transposed matrix multiplication of a 32-bit integer
-               matrices.
+   @brief      Glue code for matrix matrix multiplication of a 8-bit fix-point matrices.
    @param[in]  pSrcA points to first the input matrix
    @param[in]  pSrcB points to second the input matrix
    @param[in]  M     Height of first matrix
    @param[in]  N     Width of first and heigt of second matrix
    @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
    @param[out] pDstC Output is written here
    @return     none
-*/
 
-void plp_mat_mult_trans_i32(const int32_t *__restrict__ pSrcA,
-                            const int32_t *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            int32_t *__restrict__ pDstC);
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_q8(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t M,
+                     uint32_t N,
+                     uint32_t O,
+                     uint32_t shift,
+                     int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Matrix transposed matrix multiplication of a 32-bit integer matrices for RV32IM
-               extension.
+   @brief      Glue code for parallel matrix matrix multiplication of a 8-bit fix-point matrices.
    @param[in]  pSrcA points to first the input matrix
    @param[in]  pSrcB points to second the input matrix
    @param[in]  M     Height of first matrix
    @param[in]  N     Width of first and heigt of second matrix
    @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use
    @param[out] pDstC Output is written here
    @return     none
-*/
 
-void plp_mat_mult_trans_i32s_rv32im(const int32_t *__restrict__ pSrcA,
-                                    const int32_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    int32_t *__restrict__ pDstC);
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_q8_parallel(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t shift,
+                              uint32_t nPE,
+                              int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Matrix transposed matrix multiplication of a 32-bit integer matrices for XPULPV2
-               extension.
+   @brief      Matrix matrix multiplication of a 8-bit fix-point matrices for RV32IM extension.
    @param[in]  pSrcA points to first the input matrix
    @param[in]  pSrcB points to second the input matrix
    @param[in]  M     Height of first matrix
    @param[in]  N     Width of first and heigt of second matrix
    @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
    @param[out] pDstC Output is written here
    @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
 */
 
-void plp_mat_mult_trans_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                     const int32_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     int32_t *__restrict__ pDstC);
+void plp_mat_mult_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t M,
+                             uint32_t N,
+                             uint32_t O,
+                             uint32_t shift,
+                             int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix transposed matrix multiplication of a 16-bit integer
-               matrices.
+   @brief      Matrix matrix multiplication of a 8-bit fix-point matrices for XPULPV2 extension.
    @param[in]  pSrcA points to first the input matrix
    @param[in]  pSrcB points to second the input matrix
    @param[in]  M     Height of first matrix
    @param[in]  N     Width of first and heigt of second matrix
    @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
    @param[out] pDstC Output is written here
    @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
 */
 
-void plp_mat_mult_trans_i16(const int16_t *__restrict__ pSrcA,
-                            const int16_t *__restrict__ pSrcB,
+void plp_mat_mult_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t M,
+                              uint32_t N,
+                              uint32_t O,
+                              uint32_t shift,
+                              int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief Parallel matrix multiplication of 8-bit fix-point matrices kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q8 struct initialized by
+                      plp_mat_mult_q8_parallel
+    @return     none
+*/
+
+void plp_mat_mult_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix matrix multiplication for complex 32-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i32(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
                             uint32_t M,
                             uint32_t N,
                             uint32_t O,
                             int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Matrix transposed matrix multiplication of a 16-bit integer matrices for RV32IM
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Matrix matrix multiplication for complex 32-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_mat_mult_trans_i16s_rv32im(const int16_t *__restrict__ pSrcA,
-                                    const int16_t *__restrict__ pSrcB,
+void plp_mat_mult_cmplx_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcB,
                                     uint32_t M,
                                     uint32_t N,
                                     uint32_t O,
                                     int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Matrix transposed matrix multiplication of a 16-bit integer matrices for XPULPV2
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
-
-   @par Exploiting SIMD instructions
-   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-   performed on 32 bit vectors, with 32 bit accumulator.
+  @brief      Matrix matrix multiplication for complex 32-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_mat_mult_trans_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                                     const int16_t *__restrict__ pSrcB,
+void plp_mat_mult_cmplx_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
                                      uint32_t M,
                                      uint32_t N,
                                      uint32_t O,
                                      int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix transposed matrix multiplication of a 8-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Glue code of parallel matrix matrix multiplication for complex 32-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_mat_mult_trans_i8(const int8_t *__restrict__ pSrcA,
-                           const int8_t *__restrict__ pSrcB,
-                           uint32_t M,
-                           uint32_t N,
-                           uint32_t O,
-                           int32_t *__restrict__ pDstC);
+void plp_mat_mult_cmplx_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Matrix transposed matrix multiplication of a 8-bit integer matrices for RV32IM
-   extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      parallel matrix matrix multiplication for complex 32-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i32 struct initialized by
+                    plp_mat_mult_cmplx_i32_parallel
+  @return     none
 */
 
-void plp_mat_mult_trans_i8s_rv32im(const int8_t *__restrict__ pSrcA,
-                                   const int8_t *__restrict__ pSrcB,
-                                   uint32_t M,
-                                   uint32_t N,
-                                   uint32_t O,
-                                   int32_t *__restrict__ pDstC);
+void plp_mat_mult_cmplx_i32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief      Matrix transposed matrix multiplication of a 8-bit integer matrices for XPULPV2
-   extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Glue code of matrix matrix multiplication for complex 16-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
 
-   @par Exploiting SIMD instructions
-   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-   performed on 32 bit vectors, with 32 bit accumulator.
+void plp_mat_mult_cmplx_i16(const int16_t *__restrict__ pSrcA,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 16-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_mat_mult_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                                    const int8_t *__restrict__ pSrcB,
+void plp_mat_mult_cmplx_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcB,
                                     uint32_t M,
                                     uint32_t N,
                                     uint32_t O,
                                     int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit integer matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Matrix matrix multiplication for complex 16-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_mat_mult_trans_i32_parallel(const int32_t *__restrict__ pSrcA,
-                                     const int32_t *__restrict__ pSrcB,
+void plp_mat_mult_cmplx_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
                                      uint32_t M,
                                      uint32_t N,
                                      uint32_t O,
-                                     uint32_t nPE,
                                      int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Parallel matrix transposed matrix multiplication of a 32-bit integer matrices for
-               RV32IM extension.
-   @param[in]  args  pointer to plp_mat_mult_instance_i32 struct initialized by
-                     plp_mat_mult_i32_parallel
-   @return     none
-*/
-
-void plp_mat_mult_trans_i32p_xpulpv2(void *args);
-
-/** -------------------------------------------------------
-   @brief      Glue code for parallel matrix transposed matrix multiplication of a 16-bit integer
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Glue code of parallel matrix matrix multiplication for complex 16-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_mat_mult_trans_i16_parallel(const int16_t *__restrict__ pSrcA,
+void plp_mat_mult_cmplx_i16_parallel(const int16_t *__restrict__ pSrcA,
                                      const int16_t *__restrict__ pSrcB,
                                      uint32_t M,
                                      uint32_t N,
@@ -7116,130 +8605,225 @@ void plp_mat_mult_trans_i16_parallel(const int16_t *__restrict__ pSrcA,
                                      int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Parallel matrix transposed matrix multiplication of a 16-bit integer matrices for
-               XPULPV2 extension.
-   @param[in]  args  pointer to plp_mat_mult_instance_i16 struct initialized by
-                     plp_mat_mult_i16_parallel
-   @return     none
+  @brief      parallel matrix matrix multiplication for complex 16-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i16 struct initialized by
+                    plp_mat_mult_cmplx_i16_parallel
+  @return     none
 
-   @par Exploiting SIMD instructions
-   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-   performed on 32 bit vectors, with 32 bit accumulator.
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_mat_mult_trans_i16p_xpulpv2(void *args);
+void plp_mat_mult_cmplx_i16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix transposed matrix multiplication of a 8-bit integer
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Glue code of matrix matrix multiplication for complex 8-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_mat_mult_trans_i8_parallel(const int8_t *__restrict__ pSrcA,
+void plp_mat_mult_cmplx_i8(const int8_t *__restrict__ pSrcA,
+                           const int8_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 8-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 8-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
                                     const int8_t *__restrict__ pSrcB,
                                     uint32_t M,
                                     uint32_t N,
                                     uint32_t O,
-                                    uint32_t nPE,
                                     int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Parallel matrix transposed matrix multiplication of a 8-bit integer matrices for
-               XPULPV2 extension.
-   @param[in]  args  pointer to plp_mat_mult_instance_i8 struct initialized by
-                     plp_mat_mult_i8_parallel
-   @return     none
-
-   @par Exploiting SIMD instructions
-   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-   performed on 32 bit vectors, with 32 bit accumulator.
+  @brief      Glue code of parallel matrix matrix multiplication for complex 8-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 */
 
-void plp_mat_mult_trans_i8p_xpulpv2(void *args);
+void plp_mat_mult_cmplx_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t nPE,
+                                    int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix transposed matrix multiplication of a 32-bit fix-point
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      parallel matrix matrix multiplication for complex 8-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i8 struct initialized by
+                    plp_mat_mult_cmplx_i8_parallel
+  @return     none
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
- */
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
 
-void plp_mat_mult_trans_q32(const int32_t *__restrict__ pSrcA,
-                            const int32_t *__restrict__ pSrcB,
+void plp_mat_mult_cmplx_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix matrix multiplication for complex 32-bit floats
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_f32(const float *__restrict__ pSrcA,
+                            const float *__restrict__ pSrcB,
                             uint32_t M,
                             uint32_t N,
                             uint32_t O,
-                            uint32_t shift,
-                            int32_t *__restrict__ pDstC);
+                            float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix transposed matrix multiplication of a 32-bit
-               fix-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Matrix matrix multiplication for complex 32-bit floats on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
- */
+void plp_mat_mult_cmplx_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     float *__restrict__ pDstC);
 
-void plp_mat_mult_trans_q32_parallel(const int32_t *__restrict__ pSrcA,
-                                     const int32_t *__restrict__ pSrcB,
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix matrix multiplication for complex 32-bit floats
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_cmplx_f32_parallel(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
                                      uint32_t M,
                                      uint32_t N,
                                      uint32_t O,
-                                     uint32_t shift,
                                      uint32_t nPE,
-                                     int32_t *__restrict__ pDstC);
+                                     float *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      matrix transposed matrix multiplication of a 32-bit fix-point matrices for RV32IM
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      parallel matrix matrix multiplication for complex 32-bit floats on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_f32 struct initialized by
+                    plp_mat_mult_cmplx_f32_parallel
+  @return     none
+*/
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_mat_mult_cmplx_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix matrix multiplication for complex 32-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_mat_mult_trans_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+void plp_mat_mult_cmplx_q32(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t shift,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 32-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q32s_rv32im(const int32_t *__restrict__ pSrcA,
                                     const int32_t *__restrict__ pSrcB,
                                     uint32_t M,
                                     uint32_t N,
@@ -7248,25 +8832,27 @@ void plp_mat_mult_trans_q32s_rv32im(const int32_t *__restrict__ pSrcA,
                                     int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      matrix transposed matrix multiplication of a 32-bit fix-point matrices for XPULPV2
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Matrix matrix multiplication for complex 32-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_mat_mult_trans_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+void plp_mat_mult_cmplx_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
                                      const int32_t *__restrict__ pSrcB,
                                      uint32_t M,
                                      uint32_t N,
@@ -7275,38 +8861,76 @@ void plp_mat_mult_trans_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
                                      int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Parallel matrix transposed matrix multiplication of 32-bit fix-point matrices kernel
-                for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_q32 struct initialized by
-                      plp_mat_mult_trans_q32_parallel
-    @return     none
+  @brief      Glue code of parallel matrix matrix multiplication for complex 32-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_mat_mult_trans_q32p_xpulpv2(void *args);
+void plp_mat_mult_cmplx_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix transposed matrix multiplication of a 16-bit fix-point
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
-
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+  @brief      parallel matrix matrix multiplication for complex 32-bit fix-point on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q32 struct initialized by
+                    plp_mat_mult_cmplx_q32_parallel
+  @return     none
 
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
- */
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
 
-void plp_mat_mult_trans_q16(const int16_t *__restrict__ pSrcA,
+void plp_mat_mult_cmplx_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix matrix multiplication for complex 16-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q16(const int16_t *__restrict__ pSrcA,
                             const int16_t *__restrict__ pSrcB,
                             uint32_t M,
                             uint32_t N,
@@ -7315,60 +8939,27 @@ void plp_mat_mult_trans_q16(const int16_t *__restrict__ pSrcA,
                             int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix transposed matrix multiplication of a 16-bit
-               fix-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
-
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
-
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
- */
-
-void plp_mat_mult_trans_q16_parallel(const int16_t *__restrict__ pSrcA,
-                                     const int16_t *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t shift,
-                                     uint32_t nPE,
-                                     int16_t *__restrict__ pDstC);
-
-/** -------------------------------------------------------
-   @brief      matrix transposed matrix multiplication of a 16-bit fix-point matrices for RV32IM
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
-
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+  @brief      Matrix matrix multiplication for complex 16-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_mat_mult_trans_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+void plp_mat_mult_cmplx_q16s_rv32im(const int16_t *__restrict__ pSrcA,
                                     const int16_t *__restrict__ pSrcB,
                                     uint32_t M,
                                     uint32_t N,
@@ -7377,28 +8968,31 @@ void plp_mat_mult_trans_q16s_rv32im(const int16_t *__restrict__ pSrcA,
                                     int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      matrix transposed matrix multiplication of a 16-bit fix-point matrices for XPULPV2
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Matrix matrix multiplication for complex 16-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 
-   The output of the matrix multiplication will also be stored as an 16-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
 */
 
-void plp_mat_mult_trans_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+void plp_mat_mult_cmplx_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
                                      const int16_t *__restrict__ pSrcB,
                                      uint32_t M,
                                      uint32_t N,
@@ -7407,38 +9001,80 @@ void plp_mat_mult_trans_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
                                      int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-    @brief      Parallel matrix transposed matrix multiplication of 16-bit fix-point matrices kernel
-                for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_q16 struct initialized by
-                      plp_mat_mult_trans_q16_parallel
-    @return     none
+  @brief      Glue code of parallel matrix matrix multiplication for complex 16-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 */
 
-void plp_mat_mult_trans_q16p_xpulpv2(void *args);
+void plp_mat_mult_cmplx_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     uint32_t nPE,
+                                     int16_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Glue code for matrix transposed matrix multiplication of a 8-bit fix-point
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      parallel matrix matrix multiplication for complex 16-bit fix-point on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q16 struct initialized by
+                    plp_mat_mult_cmplx_q16_parallel
+  @return     none
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
 
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
- */
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
 
-void plp_mat_mult_trans_q8(const int8_t *__restrict__ pSrcA,
+void plp_mat_mult_cmplx_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix matrix multiplication for complex 8-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q8(const int8_t *__restrict__ pSrcA,
                            const int8_t *__restrict__ pSrcB,
                            uint32_t M,
                            uint32_t N,
@@ -7447,29 +9083,90 @@ void plp_mat_mult_trans_q8(const int8_t *__restrict__ pSrcA,
                            int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      Glue code for parallel matrix transposed matrix multiplication of a 8-bit
-               fix-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
+  @brief      Matrix matrix multiplication for complex 8-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
 
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
- */
+void plp_mat_mult_cmplx_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t shift,
+                                   int8_t *__restrict__ pDstC);
 
-void plp_mat_mult_trans_q8_parallel(const int8_t *__restrict__ pSrcA,
+/** -------------------------------------------------------
+  @brief      Matrix matrix multiplication for complex 8-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix matrix multiplication for complex 8-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape NxO
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and height of matrix SrcB
+  @param[in]  O     Width of matrix SrcB and DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_cmplx_q8_parallel(const int8_t *__restrict__ pSrcA,
                                     const int8_t *__restrict__ pSrcB,
                                     uint32_t M,
                                     uint32_t N,
@@ -7479,2198 +9176,5503 @@ void plp_mat_mult_trans_q8_parallel(const int8_t *__restrict__ pSrcA,
                                     int8_t *__restrict__ pDstC);
 
 /** -------------------------------------------------------
-   @brief      matrix transposed matrix multiplication of a 8-bit fix-point matrices for RV32IM
+  @brief      parallel matrix matrix multiplication for complex 8-bit fix-point on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q8 struct initialized by
+                    plp_mat_mult_cmplx_q8_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_cmplx_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix transposed matrix multiplication of a 32-bit integer
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i32(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix transposed matrix multiplication of a 32-bit integer matrices for RV32IM
                extension.
    @param[in]  pSrcA points to first the input matrix
    @param[in]  pSrcB points to second the input matrix
    @param[in]  M     Height of first matrix
    @param[in]  N     Width of first and heigt of second matrix
    @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
    @param[out] pDstC Output is written here
    @return     none
+*/
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+void plp_mat_mult_trans_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix transposed matrix multiplication of a 32-bit integer matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix transposed matrix multiplication of a 16-bit integer
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i16(const int16_t *__restrict__ pSrcA,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix transposed matrix multiplication of a 16-bit integer matrices for RV32IM
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix transposed matrix multiplication of a 16-bit integer matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix transposed matrix multiplication of a 8-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i8(const int8_t *__restrict__ pSrcA,
+                           const int8_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix transposed matrix multiplication of a 8-bit integer matrices for RV32IM
+   extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Matrix transposed matrix multiplication of a 8-bit integer matrices for XPULPV2
+   extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix matrix multiplication of a 32-bit integer matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel matrix transposed matrix multiplication of a 32-bit integer matrices for
+               RV32IM extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_i32 struct initialized by
+                     plp_mat_mult_i32_parallel
+   @return     none
+*/
+
+void plp_mat_mult_trans_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 16-bit integer
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel matrix transposed matrix multiplication of a 16-bit integer matrices for
+               XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_i16 struct initialized by
+                     plp_mat_mult_i16_parallel
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 8-bit integer
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t nPE,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Parallel matrix transposed matrix multiplication of a 8-bit integer matrices for
+               XPULPV2 extension.
+   @param[in]  args  pointer to plp_mat_mult_instance_i8 struct initialized by
+                     plp_mat_mult_i8_parallel
+   @return     none
+
+   @par Exploiting SIMD instructions
+   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+   performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix transposed matrix multiplication of a 32-bit fix-point
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+ */
+
+void plp_mat_mult_trans_q32(const int32_t *__restrict__ pSrcA,
+                            const int32_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t shift,
+                            int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 32-bit
+               fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+ */
+
+void plp_mat_mult_trans_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      matrix transposed matrix multiplication of a 32-bit fix-point matrices for RV32IM
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+*/
+
+void plp_mat_mult_trans_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                    const int32_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      matrix transposed matrix multiplication of a 32-bit fix-point matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+*/
+
+void plp_mat_mult_trans_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                     const int32_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel matrix transposed matrix multiplication of 32-bit fix-point matrices kernel
+                for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q32 struct initialized by
+                      plp_mat_mult_trans_q32_parallel
+    @return     none
+*/
+
+void plp_mat_mult_trans_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix transposed matrix multiplication of a 16-bit fix-point
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_trans_q16(const int16_t *__restrict__ pSrcA,
+                            const int16_t *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            uint32_t shift,
+                            int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 16-bit
+               fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_trans_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     uint32_t nPE,
+                                     int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      matrix transposed matrix multiplication of a 16-bit fix-point matrices for RV32IM
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_trans_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                    const int16_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      matrix transposed matrix multiplication of a 16-bit fix-point matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 16-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_trans_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t shift,
+                                     int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel matrix transposed matrix multiplication of 16-bit fix-point matrices kernel
+                for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q16 struct initialized by
+                      plp_mat_mult_trans_q16_parallel
+    @return     none
+*/
+
+void plp_mat_mult_trans_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix transposed matrix multiplication of a 8-bit fix-point
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_trans_q8(const int8_t *__restrict__ pSrcA,
+                           const int8_t *__restrict__ pSrcB,
+                           uint32_t M,
+                           uint32_t N,
+                           uint32_t O,
+                           uint32_t shift,
+                           int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 8-bit
+               fix-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+ */
+
+void plp_mat_mult_trans_q8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    uint32_t nPE,
+                                    int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      matrix transposed matrix multiplication of a 8-bit fix-point matrices for RV32IM
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_trans_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                   const int8_t *__restrict__ pSrcB,
+                                   uint32_t M,
+                                   uint32_t N,
+                                   uint32_t O,
+                                   uint32_t shift,
+                                   int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      matrix transposed matrix multiplication of a 8-bit fix-point matrices for XPULPV2
+               extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  shift Amount to shift the result of each multiplication.
+   @param[out] pDstC Output is written here
+   @return     none
+
+   @par Fix-Point and Shifting
+   The result will be shifted by the parameter `shift` to the right (multiplied
+   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
+   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
+   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+
+   The output of the matrix multiplication will also be stored as an 8-bit array.
+   Set the `shift` parameter such that no overflow ocurrs.
+*/
+
+void plp_mat_mult_trans_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t shift,
+                                    int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel matrix transposed matrix multiplication of 8-bit fix-point matrices kernel
+                for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_q8 struct initialized by
+                      plp_mat_mult_trans_q8_parallel
+    @return     none
+*/
+
+void plp_mat_mult_trans_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for matrix transposed matrix multiplication of a 32-bit floating-point
+               matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_f32(const float *__restrict__ pSrcA,
+                            const float *__restrict__ pSrcB,
+                            uint32_t M,
+                            uint32_t N,
+                            uint32_t O,
+                            float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      matrix transposed matrix multiplication of a 32-bit floating-point matrices for
+               XPULPV2 extension.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix transposed matrix multiplication of a 32-bit
+               floating-point matrices.
+   @param[in]  pSrcA points to first the input matrix
+   @param[in]  pSrcB points to second the input matrix
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here
+   @return     none
+*/
+
+void plp_mat_mult_trans_f32_parallel(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel matrix transposed matrix multiplication of 32-bit floating-point matrices
+                kernel for XPULPV2 extension.
+    @param[in]  args  pointer to plp_mat_mult_instance_f32 struct initialized by
+                      plp_mat_mult_trans_f32_parallel
+    @return     none
+*/
+
+void plp_mat_mult_trans_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix transpose matrix multiplication for complex 32-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i32(const int32_t *__restrict__ pSrcA,
+                                  const int32_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 32-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                          const int32_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 32-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                           const int32_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 32-bit
+              integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i32_parallel(const int32_t *__restrict__ pSrcA,
+                                           const int32_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t nPE,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix transpose matrix multiplication for complex 32-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i32 struct initialized by
+                    plp_mat_mult_trans_cmplx_i32_parallel
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix transpose matrix multiplication for complex 16-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i16(const int16_t *__restrict__ pSrcA,
+                                  const int16_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 16-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                          const int16_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 16-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                           const int16_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 16-bit
+              integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                           const int16_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t nPE,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix transpose matrix multiplication for complex 16-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i16 struct initialized by
+                    plp_mat_mult_trans_cmplx_i16_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix transpose matrix multiplication for complex 8-bit integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i8(const int8_t *__restrict__ pSrcA,
+                                 const int8_t *__restrict__ pSrcB,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t O,
+                                 int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 8-bit integers on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                         const int8_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 8-bit integers on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                          const int8_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 8-bit
+              integers
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                          const int8_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t nPE,
+                                          int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix transpose matrix multiplication for complex 8-bit integers on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i8 struct initialized by
+                    plp_mat_mult_trans_cmplx_i8_parallel
+  @return     none
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix transpose matrix multiplication for complex 32-bit floats
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_f32(const float *__restrict__ pSrcA,
+                                  const float *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 32-bit floats on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_f32s_xpulpv2(const float *__restrict__ pSrcA,
+                                           const float *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 32-bit floats
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_f32_parallel(const float *__restrict__ pSrcA,
+                                           const float *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t nPE,
+                                           float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix transpose matrix multiplication for complex 32-bit floats on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_f32 struct initialized by
+                    plp_mat_mult_trans_cmplx_f32_parallel
+  @return     none
+*/
+
+void plp_mat_mult_trans_cmplx_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix transpose matrix multiplication for complex 32-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q32(const int32_t *__restrict__ pSrcA,
+                                  const int32_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint32_t shift,
+                                  int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 32-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                                          const int32_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t shift,
+                                          int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 32-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                           const int32_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t shift,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 32-bit
+              fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q32_parallel(const int32_t *__restrict__ pSrcA,
+                                           const int32_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t shift,
+                                           uint32_t nPE,
+                                           int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix transpose matrix multiplication for complex 32-bit fix-point on
+              XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q32 struct initialized by
+                    plp_mat_mult_trans_cmplx_q32_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix transpose matrix multiplication for complex 16-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q16(const int16_t *__restrict__ pSrcA,
+                                  const int16_t *__restrict__ pSrcB,
+                                  uint32_t M,
+                                  uint32_t N,
+                                  uint32_t O,
+                                  uint32_t shift,
+                                  int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 16-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                                          const int16_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t shift,
+                                          int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 16-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                                           const int16_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t shift,
+                                           int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 16-bit
+              fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q16_parallel(const int16_t *__restrict__ pSrcA,
+                                           const int16_t *__restrict__ pSrcB,
+                                           uint32_t M,
+                                           uint32_t N,
+                                           uint32_t O,
+                                           uint32_t shift,
+                                           uint32_t nPE,
+                                           int16_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix transpose matrix multiplication for complex 16-bit fix-point on
+              XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q16 struct initialized by
+                    plp_mat_mult_trans_cmplx_q16_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code of matrix transpose matrix multiplication for complex 8-bit fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q8(const int8_t *__restrict__ pSrcA,
+                                 const int8_t *__restrict__ pSrcB,
+                                 uint32_t M,
+                                 uint32_t N,
+                                 uint32_t O,
+                                 uint32_t shift,
+                                 int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 8-bit fix-point on RV32IM
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                                         const int8_t *__restrict__ pSrcB,
+                                         uint32_t M,
+                                         uint32_t N,
+                                         uint32_t O,
+                                         uint32_t shift,
+                                         int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      matrix transpose matrix multiplication for complex 8-bit fix-point on XpulpV2
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                                          const int8_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t shift,
+                                          int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 8-bit
+              fix-point
+  @param[in]  pSrcA Points to the first input matrix of shape MxN
+  @param[in]  pSrcB Points to the second input matrix of shape OxN
+  @param[in]  M     Height of matrix SrcA and DstC
+  @param[in]  N     Width of matrix SrcA and SrcB
+  @param[in]  O     Height of matrix SrcB and width of matrix DstC
+  @param[in]  shift Amount to shift the result of each multiplication ot the right
+  @param[in]  nPE   Number of cores to use for computation
+  @param[out] pDstC Points to the output matrix of shape MxO
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+*/
+
+void plp_mat_mult_trans_cmplx_q8_parallel(const int8_t *__restrict__ pSrcA,
+                                          const int8_t *__restrict__ pSrcB,
+                                          uint32_t M,
+                                          uint32_t N,
+                                          uint32_t O,
+                                          uint32_t shift,
+                                          uint32_t nPE,
+                                          int8_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+  @brief      parallel matrix transpose matrix multiplication for complex 8-bit fix-point on XpulpV2
+  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q8 struct initialized by
+                    plp_mat_mult_trans_cmplx_q8_parallel
+  @return     none
+
+  @par Fix-Point
+  Fix-Point and Shifting
+  The result will be shifted by the parameter `shift` to the right (which corresponds to a
+  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
+  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
+  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
+  The output matrix is also stored with the same number of bits as the inputs. Set the
+  `shift` parameter such that no overflow occurrs.
+
+  @par Exploiting SIMD instructions
+  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
+  performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_mat_mult_trans_cmplx_q8p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for complex magnitude calculation in float32
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_f32(const float32_t *pSrc,
+                       float32_t *pRes,
+                       uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for float32 on XPULPV2
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_f32s_xpulpv2(const float32_t *pSrc,
+                                float32_t *pRes,
+                                uint32_t numSamples);
+
+/**
+ * @brief      Glue code for complex magnitude calculation for 32 bit fixpoint
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_q32(const int32_t *pSrc,
+                       const uint32_t fracBits,
+                       int32_t *pRes,
+                       uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for q32 on RV32IM
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_q32s_rv32im(const int32_t *pSrc,
+                               const uint32_t fracBits,
+                               int32_t *pRes,
+                               uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for q32 on XPULPV2
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_q32s_xpulpv2(const int32_t *pSrc,
+                                const uint32_t fracBits,
+                                int32_t *pRes,
+                                uint32_t numSamples);
+
+/**
+ * @brief      Glue code for complex magnitude calculation for 8 bit fixpoint
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param[in]  fracBits    fractional bits -> Q(8-fracBits).fracBits
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_q8(const int8_t *pSrc,
+                       const uint32_t fracBits,
+                       int8_t *pRes,
+                       uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for q8 on RV32IM
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param[in]  fracBits    fractional bits -> Q(8-fracBits).fracBits
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_q8s_rv32im(const int8_t *pSrc,
+                               const uint32_t fracBits,
+                               int8_t *pRes,
+                               uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for q8 on XPULPV2
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param[in]  fracBits    fractional bits -> Q(8-fracBits).fracBits
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_q8s_xpulpv2(const int8_t *pSrc,
+                                const uint32_t fracBits,
+                                int8_t *pRes,
+                                uint32_t numSamples);
+
+/**
+ * @brief      Glue code for complex magnitude calculation in 16-bit integer
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_i16(const int16_t *pSrc,
+                       int16_t *pRes,
+                       uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for i16 on RV32IM
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_i16s_rv32im(const int16_t *pSrc,
+                               int16_t *pRes,
+                               uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for i16 on XPULPV2
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_i16s_xpulpv2(const int16_t *pSrc,
+                                int16_t *pRes,
+                                uint32_t numSamples);
+
+/**
+ * @brief      Glue code for complex magnitude calculation in 32-bit integer
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_i32(const int32_t *pSrc,
+                       int32_t *pRes,
+                       uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for i32 on RV32IM
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_i32s_rv32im(const int32_t *pSrc,
+                               int32_t *pRes,
+                               uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for i32 on XPULPV2
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_i32s_xpulpv2(const int32_t *pSrc,
+                                int32_t *pRes,
+                                uint32_t numSamples);
+
+/**
+ * @brief      Glue code for complex magnitude calculation in 8-bit integer
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_i8(const int8_t *pSrc,
+                      int8_t *pRes,
+                      uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for i8 on RV32IM
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_i8s_rv32im(const int8_t *pSrc,
+                              int8_t *pRes,
+                              uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for i8 on XPULPV2
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number samples
+ */
+
+void plp_cmplx_mag_i8s_xpulpv2(const int8_t *pSrc,
+                               int8_t *pRes,
+                               uint32_t numSamples);
+
+/**
+ * @brief      Glue code for complex magnitude calculation in 16-bit quantized integer
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number of samples
+ */
+
+void plp_cmplx_mag_q16(const int16_t *pSrc,
+                       const uint32_t fracBits,
+                       int16_t *pRes,
+                       uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for q16 on RV32IM
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number of samples
+ */
+
+void plp_cmplx_mag_q16s_rv32im(const int16_t *pSrc,
+                               const uint32_t fracBits,
+                               int16_t *pRes,
+                               uint32_t numSamples);
+
+/**
+ * @brief      complex magnitude for q16 on XPULPV2
+ *
+ * @param[in]  pSrc        pointer to source
+ * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
+ * @param      pRes        pointer to result
+ * @param[in]  numSamples  The number of samples
+ */
+
+void plp_cmplx_mag_q16s_xpulpv2(const int16_t *pSrc,
+                                const uint32_t fracBits,
+                                int16_t *pRes,
+                                uint32_t numSamples);
+
+/**
+  @brief      In-place 16 bit reversal function for RV32IM
+  @param[in,out] pSrc        points to in-place buffer of unknown 16-bit data type
+  @param[in]  bitRevLen   bit reversal table length
+  @param[in]  pBitRevTab  points to bit reversal table
+  @return     none
+*/
+
+void plp_bitreversal_16s_rv32im(uint16_t *pSrc,
+                                const uint16_t bitRevLen,
+                                const uint16_t *pBitRevTab);
+
+/**
+  @brief      In-place 16 bit reversal function for XPULPV2
+  @param[in,out] pSrc        points to in-place buffer of unknown 16-bit data type
+  @param[in]  bitRevLen   bit reversal table length
+  @param[in]  pBitRevTab  points to bit reversal table
+  @return     none
+*/
+
+void plp_bitreversal_16s_xpulpv2(uint16_t *pSrc,
+                                 const uint16_t bitRevLen,
+                                 const uint16_t *pBitRevTab);
+
+/**
+  @brief         In-place 16 bit reversal function.
+  @param[in,out] pSrc        points to in-place buffer of unknown 16-bit data type
+  @param[in]     bitRevLen   bit reversal table length
+  @param[in]     pBitRevTab  points to bit reversal table
+  @param[in]     nPE         number of cores
+  @return        none
+*/
+
+void plp_bitreversal_16p_xpulpv2(uint16_t *pSrc,
+                                 const uint16_t bitRevLen,
+                                 const uint16_t *pBitRevTab,
+                                 uint32_t nPE);
+
+/**
+ * @brief      Glue code for quantized 16 bit complex fast fourier transform
+ *
+ * Fixed point units input -> output dependent on length:
+ * len=16:    Q1.15 -> Q5.11
+ * len=32:    Q1.15 -> Q6.10
+ * len=64:    Q1.15 -> Q7.9
+ * len=128:   Q1.15 -> Q8.8
+ * len=256:   Q1.15 -> Q9.7
+ * len=512:   Q1.15 -> Q10.6
+ * len=1024:  Q1.15 -> Q11.5
+ * len=2048:  Q1.15 -> Q12.4
+ * len=4096:  Q1.15 -> Q13.3
+ * other lengths (plans only): output scaled by 1/len
+ *
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ */
+
+void plp_cfft_q16(const plp_cfft_instance_q16 *S,
+                  int16_t *p1,
+                  uint8_t ifftFlag,
+                  uint8_t bitReverseFlag,
+                  uint32_t deciPoint);
+
+/**
+ * @brief      Glue code for quantized 16 bit complex fast fourier transform
+ *
+ * Fixed point units input -> output dependent on length:
+ * len=16:    Q1.15 -> Q5.11
+ * len=32:    Q1.15 -> Q6.10
+ * len=64:    Q1.15 -> Q7.9
+ * len=128:   Q1.15 -> Q8.8
+ * len=256:   Q1.15 -> Q9.7
+ * len=512:   Q1.15 -> Q10.6
+ * len=1024:  Q1.15 -> Q11.5
+ * len=2048:  Q1.15 -> Q12.4
+ * len=4096:  Q1.15 -> Q13.3
+ * other lengths (plans only): output scaled by 1/len
+ *
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1           points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ * @param[in]  nPE             Number of cores to use
+ */
+
+void plp_cfft_q16_parallel(const plp_cfft_instance_q16 *S,
+                           int16_t *p1,
+                           uint8_t ifftFlag,
+                           uint8_t bitReverseFlag,
+                           uint32_t deciPoint,
+                           uint32_t nPE);
+
+/**
+ * @brief      Quantized 16 bit complex fast fourier transform for RV32IM
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ */
+
+void plp_cfft_q16s_rv32im(const plp_cfft_instance_q16 *S,
+                          int16_t *p1,
+                          uint8_t ifftFlag,
+                          uint8_t bitReverseFlag,
+                          uint32_t deciPoint);
+
+/**
+ * @brief      Quantized 16 bit complex fast fourier transform for XPULPV2
+ * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  deciPoint       decimal point for right shift
+ */
+
+void plp_cfft_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
+                           int16_t *p1,
+                           uint8_t ifftFlag,
+                           uint8_t bitReverseFlag,
+                           uint32_t deciPoint);
+
+/**
+ * @brief      Parallel quantized 16 bit complex fast fourier transform for XPULPV2
+ * @param[in]   args    points to the plp_cfft_instance_q16_parallel
+ */
+
+void plp_cfft_q16p_xpulpv2(void *args);
+
+/**
+ * @brief         Glue code for the 16-bit block floating point complex fast fourier transform
+ *
+ * The data is shifted down only when the headroom left by the previous stage is not sufficient,
+ * and quiet inputs are scaled up to the full range. Only forward transforms of power of two
+ * lengths are supported.
+ *
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @return        block exponent e, the DFT of the input is <code>p1 * 2^e</code>
+ */
+
+int32_t plp_cfft_bfp_q16(const plp_cfft_instance_q16 *S, int16_t *p1, uint8_t bitReverseFlag);
+
+/**
+ * @brief         Glue code for the parallel 16-bit block floating point complex fast fourier
+ * transform
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]     nPE             number of cores to use
+ * @return        block exponent e, the DFT of the input is <code>p1 * 2^e</code>
+ */
+
+int32_t plp_cfft_bfp_q16_parallel(const plp_cfft_instance_q16 *S,
+                                  int16_t *p1,
+                                  uint8_t bitReverseFlag,
+                                  uint32_t nPE);
+
+/**
+ * @brief         16-bit block floating point complex fast fourier transform for RV32IM
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @return        block exponent of the output
+ */
+
+int32_t plp_cfft_bfp_q16s_rv32im(const plp_cfft_instance_q16 *S,
+                                 int16_t *p1,
+                                 uint8_t bitReverseFlag);
+
+/**
+ * @brief         16-bit block floating point complex fast fourier transform for XPULPV2
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @return        block exponent of the output
+ */
+
+int32_t plp_cfft_bfp_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
+                                  int16_t *p1,
+                                  uint8_t bitReverseFlag);
+
+/**
+ * @brief      Parallel 16-bit block floating point complex fast fourier transform for XPULPV2
+ * @param[in]  args    points to the plp_cfft_bfp_instance_q16_parallel
+ */
+
+void plp_cfft_bfp_q16p_xpulpv2(void *args);
+
+/**
+  @brief      In-place 32 bit reversal function for RV32IM
+  @param[in,out] pSrc        points to in-place buffer of unknown 32-bit data type
+  @param[in]  bitRevLen   bit reversal table length
+  @param[in]  pBitRevTab  points to bit reversal table
+  @return     none
+*/
+
+void plp_bitreversal_32s_rv32im(uint32_t *pSrc, const uint16_t bitRevLen, const uint16_t *pBitRevTab);
+
+/**
+  @brief      In-place 32 bit reversal function for XPULPV2
+  @param[in,out] pSrc        points to in-place buffer of unknown 32-bit data type
+  @param[in]  bitRevLen   bit reversal table length
+  @param[in]  pBitRevTab  points to bit reversal table
+  @return     none
+*/
+
+void plp_bitreversal_32s_xpulpv2(uint32_t *pSrc, const uint16_t bitRevLen, const uint16_t *pBitRevTab);
+
+/**
+  @brief      In-place 32 bit reversal function for XPULPV2
+  @param[in,out] pSrc        points to in-place buffer of unknown 32-bit data type
+  @param[in]  bitRevLen   bit reversal table length
+  @param[in]  pBitRevTab  points to bit reversal table
+  @param[in]     nPE         number of cores
+  @return     none
+*/
+
+void plp_bitreversal_32p_xpulpv2(uint32_t *pSrc, const uint16_t bitRevLen, const uint16_t *pBitRevTab, uint32_t nPE);
+
+/**
+ * @brief      Glue code for quantized 32-bit complex fast fourier transform
+ * 
+ * Fixed point units input -> output dependent on length:
+ * len=16:    Q1.31 -> Q5.27
+ * len=32:    Q1.31 -> Q6.26
+ * len=64:    Q1.31 -> Q7.25
+ * len=128:   Q1.31 -> Q8.24
+ * len=256:   Q1.31 -> Q9.23
+ * len=512:   Q1.31 -> Q10.22
+ * len=1024:  Q1.31 -> Q11.21
+ * len=2048:  Q1.31 -> Q12.20
+ * len=4096:  Q1.31 -> Q13.19
+ *
+ * @param[in]  S               points to an instance of the 32bit quantized CFFT structure
+ * @param      p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forwart (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  fracBits        decimal point for right shift (input format Q(32-fracBits).fracBits)
+ */
+
+void plp_cfft_q32(const plp_cfft_instance_q32 *S,
+                      int32_t *p1,
+                      uint8_t ifftFlag,
+                      uint8_t bitReverseFlag,
+                      uint32_t fracBits);
+
+/**
+ * @brief      Quantized 32-bit complex fast fourier transform for XPULPV2
+ *
+ * @param[in]  S               points to an instance of the 32bit quantized CFFT structure
+ * @param      p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forwart (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  fracBits        decimal point for right shift (input format Q(32-fracBits).fracBits)
+ * @param[in]  nPE             Number of cores to use
+ */
+
+void plp_cfft_q32_parallel( const plp_cfft_instance_q32 *S,
+                            int32_t *p1,
+                            uint8_t ifftFlag,
+                            uint8_t bitReverseFlag,
+                            uint32_t fracBits,
+                            uint32_t nPE );
+
+/**
+ * @brief      Quantized 32-bit complex fast fourier transform for RV32IM
+ *
+ * @param[in]  S               points to an instance of the 32bit quantized CFFT structure
+ * @param      p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forwart (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  fracBits        decimal point for right shift (input format Q(32-fracBits).fracBits)
+ */
+
+void plp_cfft_q32s_rv32im(const plp_cfft_instance_q32 *S,
+                      int32_t *p1,
+                      uint8_t ifftFlag,
+                      uint8_t bitReverseFlag,
+                      uint32_t fracBits);
+
+/**
+ * @brief      Quantized 32-bit complex fast fourier transform for XPULPV2
+ *
+ * @param[in]  S               points to an instance of the 32bit quantized CFFT structure
+ * @param      p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forwart (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  fracBits        decimal point for right shift (input format Q(32-fracBits).fracBits)
+ */
+
+void plp_cfft_q32s_xpulpv2(const plp_cfft_instance_q32 *S,
+                      int32_t *p1,
+                      uint8_t ifftFlag,
+                      uint8_t bitReverseFlag,
+                      uint32_t fracBits);
+
+/**
+ * @brief      Parallel quantized 32 bit complex fast fourier transform for XPULPV2
+ * @param[in]   args    points to the plp_cfft_instance_q32_parallel
+ */
+
+void plp_cfft_q32p_xpulpv2(void *args);
+
+/**
+   @brief Floating-point FFT on real input data.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (real data)
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+*/
+void plp_rfft_f32(const plp_fft_instance_f32 *S,
+                  const float32_t *__restrict__ pSrc,
+                  float32_t *__restrict__ pDst);
+
+/**
+   @brief Floating-point FFT on real input data (parallel version).
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (real data)
+   @param[in]   nPE     number of parallel processing units, rounded down to a power of two
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+*/
+void plp_rfft_f32_parallel(const plp_fft_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           const uint32_t nPE,
+                           float32_t *__restrict__ pDst);
+
+/**
+   @brief  Floating-point FFT on real input data for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrcA   points to the input buffer (real data)
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+*/
+void plp_rfft_f32s_xpulpv2(const plp_fft_instance_f32 *S,
+                          const float32_t *__restrict__ pSrc,
+                          float32_t *__restrict__ pDst);
+
+/**
+   @brief  Floating-point FFT on real input data for XPULPV2 extension (parallel version).
+   @param[in]   arg       points to an instance of the floating-point FFT structure
+   @return      none
+*/
+void plp_rfft_f32p_xpulpv2(void *arg);
+
+
+
+
+
+/**
+   @brief Floating-point FFT on real input data.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (real data)
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+*/
+void plp_rfftfast_f32( const plp_fft_fast_instance_f32 *S,
+                        const float32_t *__restrict__ pSrc,
+                        float32_t *__restrict__ pDst);
 
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
+/**
+   @brief Floating-point parallel FFT on real input data.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (real data)
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
 */
+void plp_rfftfast_f32_parallel( const plp_fft_fast_instance_f32 *S,
+                                 float32_t *__restrict__ pSrc,
+                                 float32_t *__restrict__ pDst,
+                                 const uint32_t nPE);
 
-void plp_mat_mult_trans_q8s_rv32im(const int8_t *__restrict__ pSrcA,
-                                   const int8_t *__restrict__ pSrcB,
-                                   uint32_t M,
-                                   uint32_t N,
-                                   uint32_t O,
-                                   uint32_t shift,
-                                   int8_t *__restrict__ pDstC);
+/**
+   @brief  Floating-point FFT on real input data for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrcA   points to the input buffer (real data)
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+*/
+void plp_rfftfast_f32s_xpulpv2( const plp_fft_fast_instance_f32 *S,
+                                 float32_t *pSrc,
+                                 float32_t *pDst);
 
-/** -------------------------------------------------------
-   @brief      matrix transposed matrix multiplication of a 8-bit fix-point matrices for XPULPV2
-               extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  shift Amount to shift the result of each multiplication.
-   @param[out] pDstC Output is written here
-   @return     none
+/**
+   @brief  Floating-point parallel FFT on real input data for XPULPV2 extension.
+   @param[in]   arg       points to an instance of the floating-point FFT structure
+   @return      none
+*/
+void plp_rfftfast_f32p_xpulpv2( void *arg );
 
-   @par Fix-Point and Shifting
-   The result will be shifted by the parameter `shift` to the right (multiplied
-   by 2^-shift). Assume that matrix A is represented as pSrcA * 2^-x, and matrix
-   B as pSrcB * 2^-y (in other words, A has it's x last digits after the binary
-   point). Then, the output is represented as pDstC * 2^-(x + y - shift).
+/**
+   @brief Floating-point inverse FFT with real output data.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer of (FFTLength / 2 + 1) complex values
+   @param[out]  pDst    points to the output buffer of FFTLength real values
+   @return      none
+*/
+void plp_irfft_f32(const plp_fft_instance_f32 *S,
+                   const float32_t *__restrict__ pSrc,
+                   float32_t *__restrict__ pDst);
 
-   The output of the matrix multiplication will also be stored as an 8-bit array.
-   Set the `shift` parameter such that no overflow ocurrs.
+/**
+   @brief Floating-point inverse FFT with real output data (parallel version).
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer of (FFTLength / 2 + 1) complex values
+   @param[in]   nPE     number of parallel processing units
+   @param[out]  pDst    points to the output buffer of FFTLength real values
+   @return      none
 */
+void plp_irfft_f32_parallel(const plp_fft_instance_f32 *S,
+                            const float32_t *__restrict__ pSrc,
+                            const uint32_t nPE,
+                            float32_t *__restrict__ pDst);
 
-void plp_mat_mult_trans_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                                    const int8_t *__restrict__ pSrcB,
-                                    uint32_t M,
-                                    uint32_t N,
-                                    uint32_t O,
-                                    uint32_t shift,
-                                    int8_t *__restrict__ pDstC);
+/**
+   @brief  Floating-point inverse FFT with real output data for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer of (FFTLength / 2 + 1) complex values
+   @param[out]  pDst    points to the output buffer of FFTLength real values
+   @return      none
+*/
+void plp_irfft_f32s_xpulpv2(const plp_fft_instance_f32 *S,
+                            const float32_t *__restrict__ pSrc,
+                            float32_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-    @brief      Parallel matrix transposed matrix multiplication of 8-bit fix-point matrices kernel
-                for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_q8 struct initialized by
-                      plp_mat_mult_trans_q8_parallel
-    @return     none
+/**
+   @brief  Floating-point inverse FFT with real output data for XPULPV2 extension (parallel version).
+   @param[in]   arg       points to an instance of plp_fft_instance_f32_parallel
+   @return      none
 */
+void plp_irfft_f32p_xpulpv2(void *arg);
 
-void plp_mat_mult_trans_q8p_xpulpv2(void *args);
+/**
+   @brief Floating-point inverse FFT with real output data.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer, packed as by plp_rfftfast_f32
+   @param[out]  pDst    points to the output buffer of FFTLengthRFFT real values
+   @return      none
+*/
+void plp_irfftfast_f32(const plp_fft_fast_instance_f32 *S,
+                       const float32_t *__restrict__ pSrc,
+                       float32_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-   @brief      Glue code for matrix transposed matrix multiplication of a 32-bit floating-point
-               matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
+/**
+   @brief Floating-point inverse FFT with real output data (parallel version).
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer, packed as by plp_rfftfast_f32
+   @param[out]  pDst    points to the output buffer of FFTLengthRFFT real values
+   @param[in]   nPE     number of parallel processing units, rounded down to a power of two
+   @return      none
 */
+void plp_irfftfast_f32_parallel(const plp_fft_fast_instance_f32 *S,
+                                const float32_t *__restrict__ pSrc,
+                                float32_t *__restrict__ pDst,
+                                uint32_t nPE);
 
-void plp_mat_mult_trans_f32(const float *__restrict__ pSrcA,
-                            const float *__restrict__ pSrcB,
-                            uint32_t M,
-                            uint32_t N,
-                            uint32_t O,
-                            float *__restrict__ pDstC);
+/**
+   @brief  Floating-point inverse FFT with real output data for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer, packed as by plp_rfftfast_f32
+   @param[out]  pDst    points to the output buffer of FFTLengthRFFT real values
+   @return      none
+*/
+void plp_irfftfast_f32s_xpulpv2(const plp_fft_fast_instance_f32 *S,
+                                const float32_t *__restrict__ pSrc,
+                                float32_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-   @brief      matrix transposed matrix multiplication of a 32-bit floating-point matrices for
-               XPULPV2 extension.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[out] pDstC Output is written here
-   @return     none
+/**
+   @brief  Floating-point inverse FFT with real output data for XPULPV2 extension (parallel version).
+   @param[in]   arg       points to an instance of plp_fft_fast_instance_f32_parallel
+   @return      none
 */
+void plp_irfftfast_f32p_xpulpv2(void *arg);
 
-void plp_mat_mult_trans_f32s_xpulpv2(const float *__restrict__ pSrcA,
-                                     const float *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     float *__restrict__ pDstC);
+/**
+ * @brief      Glue code for the 16-bit fixed-point real FFT
+ *
+ * @param[in]  S          points to an instance of the 16-bit real FFT structure
+ * @param[in]  pSrc       points to the input buffer, N real values (forward, modified) or
+ *                        N/2 + 1 complex values (inverse)
+ * @param[out] pDst       points to the output buffer, N/2 + 1 complex values (forward) or
+ *                        N real values (inverse)
+ * @param[in]  ifftFlag   flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ */
+void plp_rfft_q16(const plp_rfft_instance_q16 *S, int16_t *pSrc, int16_t *pDst, uint8_t ifftFlag);
 
-/** -------------------------------------------------------
-   @brief      Glue code for parallel matrix transposed matrix multiplication of a 32-bit
-               floating-point matrices.
-   @param[in]  pSrcA points to first the input matrix
-   @param[in]  pSrcB points to second the input matrix
-   @param[in]  M     Height of first matrix
-   @param[in]  N     Width of first and heigt of second matrix
-   @param[in]  O     Width of second matrix
-   @param[in]  nPE   Number of cores to use
-   @param[out] pDstC Output is written here
-   @return     none
-*/
+/**
+ * @brief      Glue code for the parallel 16-bit fixed-point real FFT
+ *
+ * @param[in]  S          points to an instance of the 16-bit real FFT structure
+ * @param[in]  pSrc       points to the input buffer, N real values (forward, modified) or
+ *                        N/2 + 1 complex values (inverse)
+ * @param[out] pDst       points to the output buffer, N/2 + 1 complex values (forward) or
+ *                        N real values (inverse)
+ * @param[in]  ifftFlag   flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]  nPE        number of cores to use
+ */
+void plp_rfft_q16_parallel(const plp_rfft_instance_q16 *S,
+                           int16_t *pSrc,
+                           int16_t *pDst,
+                           uint8_t ifftFlag,
+                           uint32_t nPE);
 
-void plp_mat_mult_trans_f32_parallel(const float *__restrict__ pSrcA,
-                                     const float *__restrict__ pSrcB,
-                                     uint32_t M,
-                                     uint32_t N,
-                                     uint32_t O,
-                                     uint32_t nPE,
-                                     float *__restrict__ pDstC);
+/**
+ * @brief      16-bit fixed-point real FFT for RV32IM
+ *
+ * @param[in]  S          points to an instance of the 16-bit real FFT structure
+ * @param[in]  pSrc       points to the input buffer
+ * @param[out] pDst       points to the output buffer
+ * @param[in]  ifftFlag   flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ */
+void plp_rfft_q16s_rv32im(const plp_rfft_instance_q16 *S, int16_t *pSrc, int16_t *pDst, uint8_t ifftFlag);
 
-/** -------------------------------------------------------
-    @brief      Parallel matrix transposed matrix multiplication of 32-bit floating-point matrices
-                kernel for XPULPV2 extension.
-    @param[in]  args  pointer to plp_mat_mult_instance_f32 struct initialized by
-                      plp_mat_mult_trans_f32_parallel
-    @return     none
-*/
+/**
+ * @brief      16-bit fixed-point real FFT for XPULPV2
+ *
+ * @param[in]  S          points to an instance of the 16-bit real FFT structure
+ * @param[in]  pSrc       points to the input buffer
+ * @param[out] pDst       points to the output buffer
+ * @param[in]  ifftFlag   flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ */
+void plp_rfft_q16s_xpulpv2(const plp_rfft_instance_q16 *S, int16_t *pSrc, int16_t *pDst, uint8_t ifftFlag);
 
-void plp_mat_mult_trans_f32p_xpulpv2(void *args);
+/**
+ * @brief      Parallel 16-bit fixed-point real FFT for XPULPV2
+ * @param[in]  args       points to the plp_rfft_instance_q16_parallel
+ */
+void plp_rfft_q16p_xpulpv2(void *args);
 
-/** -------------------------------------------------------
-  @brief      Glue code of matrix transpose matrix multiplication for complex 32-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+ * @brief      Glue code for the 32-bit fixed-point real FFT
+ *
+ * @param[in]  S          points to an instance of the 32-bit real FFT structure
+ * @param[in]  pSrc       points to the input buffer, N real values (forward, modified) or
+ *                        N/2 + 1 complex values (inverse)
+ * @param[out] pDst       points to the output buffer, N/2 + 1 complex values (forward) or
+ *                        N real values (inverse)
+ * @param[in]  ifftFlag   flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ */
+void plp_rfft_q32(const plp_rfft_instance_q32 *S, int32_t *pSrc, int32_t *pDst, uint8_t ifftFlag);
+
+/**
+ * @brief      Glue code for the parallel 32-bit fixed-point real FFT
+ *
+ * @param[in]  S          points to an instance of the 32-bit real FFT structure
+ * @param[in]  pSrc       points to the input buffer, N real values (forward, modified) or
+ *                        N/2 + 1 complex values (inverse)
+ * @param[out] pDst       points to the output buffer, N/2 + 1 complex values (forward) or
+ *                        N real values (inverse)
+ * @param[in]  ifftFlag   flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]  nPE        number of cores to use
+ */
+void plp_rfft_q32_parallel(const plp_rfft_instance_q32 *S,
+                           int32_t *pSrc,
+                           int32_t *pDst,
+                           uint8_t ifftFlag,
+                           uint32_t nPE);
+
+/**
+ * @brief      32-bit fixed-point real FFT for RV32IM
+ *
+ * @param[in]  S          points to an instance of the 32-bit real FFT structure
+ * @param[in]  pSrc       points to the input buffer
+ * @param[out] pDst       points to the output buffer
+ * @param[in]  ifftFlag   flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ */
+void plp_rfft_q32s_rv32im(const plp_rfft_instance_q32 *S, int32_t *pSrc, int32_t *pDst, uint8_t ifftFlag);
+
+/**
+ * @brief      32-bit fixed-point real FFT for XPULPV2
+ *
+ * @param[in]  S          points to an instance of the 32-bit real FFT structure
+ * @param[in]  pSrc       points to the input buffer
+ * @param[out] pDst       points to the output buffer
+ * @param[in]  ifftFlag   flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ */
+void plp_rfft_q32s_xpulpv2(const plp_rfft_instance_q32 *S, int32_t *pSrc, int32_t *pDst, uint8_t ifftFlag);
+
+/**
+ * @brief      Parallel 32-bit fixed-point real FFT for XPULPV2
+ * @param[in]  args       points to the plp_rfft_instance_q32_parallel
+ */
+void plp_rfft_q32p_xpulpv2(void *args);
+
+/**
+   @brief Floating-point FFT on complex input data.
+   @param[in]   S points to an instance of the floating-point FFT structure
+   @param[in]   pSrc points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+   @param[in]   ifftFlag flag that selects forwart (ifftFlag=0) or inverse (ifftFlag=1)
+   @param[in]   bitReverseFlag flag that enables (bitReverseFlag=1) of disables (bitReverseFlag=0) bit reversal of output.
+   @return      none
 */
+void plp_cfft_f32(  const plp_cfft_instance_f32 *S,
+                    float32_t *pSrc,
+                    uint8_t ifftFlag,
+                    uint8_t bitReverseFlag);
 
-void plp_mat_mult_trans_cmplx_i32(const int32_t *__restrict__ pSrcA,
-                                  const int32_t *__restrict__ pSrcB,
-                                  uint32_t M,
-                                  uint32_t N,
-                                  uint32_t O,
-                                  int32_t *__restrict__ pDstC);
+/**
+   @brief Floating-point FFT on complex input data (parallel version).
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+   @param[in]   ifftFlag flag that selects forwart (ifftFlag=0) or inverse (ifftFlag=1)
+   @param[in]   bitReverseFlag flag that enables (bitReverseFlag=1) of disables (bitReverseFlag=0) bit reversal of output.
+   @param[in]   nPE     number of parallel processing units, rounded down to a power of two for
+                        the power-of-two lengths
+   @return      none
+*/
+void plp_cfft_f32_parallel( const plp_cfft_instance_f32 *S,
+                            const float32_t *pSrc,
+                            uint8_t ifftFlag,
+                            uint8_t bitReverseFlag,
+                            const uint32_t nPE);
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 32-bit integers on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief  Floating-point FFT on complex input data for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+   @param[in]   ifftFlag flag that selects forwart (ifftFlag=0) or inverse (ifftFlag=1)
+   @param[in]   bitReverseFlag flag that enables (bitReverseFlag=1) of disables (bitReverseFlag=0) bit reversal of output.
+   @return      none
+*/
+void plp_cfft_f32s_xpulpv2( const plp_cfft_instance_f32 *S,
+                            const float32_t *pSrc,
+                            uint8_t ifftFlag,
+                            uint8_t bitReverseFlag);
+
+/**
+   @brief  Floating-point FFT on complex input data for XPULPV2 extension (parallel version).
+   @param[in]   arg       points to an instance of the floating-point FFT structure
+   @return      none
 */
+void plp_cfft_f32p_xpulpv2(void *arg);
+
+/**
+   @brief  Number of cores with which plp_cfft_f32p_xpulpv2 transforms a length correctly (used by
+           the parallel glue code of the transforms built on it).
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   nPE     number of cores requested
+   @return      nPE for the mixed-radix lengths, the largest power of two not larger than nPE for the
+                power-of-two lengths
+*/
+static inline uint32_t plp_cfft_f32_parallel_npe(const plp_cfft_instance_f32 *S, uint32_t nPE) {
+    /* the radix-2/4/8 kernels distribute the butterflies over a power-of-two number of cores */
+    if ((S->fftLen & (S->fftLen - 1)) == 0) {
+        while (nPE & (nPE - 1)) {
+            nPE &= nPE - 1;
+        }
+    }
+    return nPE;
+}
 
-void plp_mat_mult_trans_cmplx_i32s_rv32im(const int32_t *__restrict__ pSrcA,
-                                          const int32_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          int32_t *__restrict__ pDstC);
+/**
+   @brief Glue code for a batch of floating-point complex FFTs, each core transforming whole frames
+   when there are at least nPE of them.
+   @param[in]     S               points to an instance of the floating-point CFFT structure
+   @param[in,out] pSrc            points to nFrames frames of <code>2*fftLen</code> values
+   @param[in]     nFrames         number of frames
+   @param[in]     ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+   @param[in]     bitReverseFlag  flag that enables bit reversal of the output
+   @param[in]     nPE             number of cores to use
+*/
+void plp_cfft_f32_batch(const plp_cfft_instance_f32 *S,
+                        float32_t *pSrc,
+                        uint32_t nFrames,
+                        uint8_t ifftFlag,
+                        uint8_t bitReverseFlag,
+                        uint32_t nPE);
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 32-bit integers on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief Batch of floating-point complex FFTs for XPULPV2.
+   @param[in]  args  points to the plp_cfft_instance_f32_batch
 */
+void plp_cfft_f32_batch_xpulpv2(void *args);
 
-void plp_mat_mult_trans_cmplx_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                           const int32_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           int32_t *__restrict__ pDstC);
+/**
+   @brief Glue code for a batch of 16-bit fixed-point complex FFTs, each core transforming whole
+   frames when there are at least nPE of them.
+   @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+   @param[in,out] p1              points to nFrames frames of <code>2*fftLen</code> values
+   @param[in]     nFrames         number of frames
+   @param[in]     ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+   @param[in]     bitReverseFlag  flag that enables bit reversal of the output
+   @param[in]     deciPoint       decimal point for right shift
+   @param[in]     nPE             number of cores to use
+*/
+void plp_cfft_q16_batch(const plp_cfft_instance_q16 *S,
+                        int16_t *p1,
+                        uint32_t nFrames,
+                        uint8_t ifftFlag,
+                        uint8_t bitReverseFlag,
+                        uint32_t deciPoint,
+                        uint32_t nPE);
 
-/** -------------------------------------------------------
-  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 32-bit
-              integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief Batch of 16-bit fixed-point complex FFTs for XPULPV2.
+   @param[in]  args  points to the plp_cfft_instance_q16_batch
 */
+void plp_cfft_q16_batch_xpulpv2(void *args);
 
-void plp_mat_mult_trans_cmplx_i32_parallel(const int32_t *__restrict__ pSrcA,
-                                           const int32_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           uint32_t nPE,
-                                           int32_t *__restrict__ pDstC);
+/**
+   @brief Glue code for a batch of floating-point real FFTs, each core transforming whole frames
+   when there are at least nPE of them.
+   @param[in]   S        points to an instance of the floating-point FFT structure
+   @param[in]   pSrc     points to nFrames real frames of FFTLength values
+   @param[in]   nFrames  number of frames
+   @param[in]   nPE      number of cores to use
+   @param[out]  pDst     points to nFrames complex frames of <code>2*FFTLength</code> values
+*/
+void plp_rfft_f32_batch(const plp_fft_instance_f32 *S,
+                        const float32_t *__restrict__ pSrc,
+                        uint32_t nFrames,
+                        uint32_t nPE,
+                        float32_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-  @brief      parallel matrix transpose matrix multiplication for complex 32-bit integers on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i32 struct initialized by
-                    plp_mat_mult_trans_cmplx_i32_parallel
-  @return     none
+/**
+   @brief Batch of floating-point real FFTs for XPULPV2.
+   @param[in]  args  points to the plp_rfft_instance_f32_batch
 */
+void plp_rfft_f32_batch_xpulpv2(void *args);
 
-void plp_mat_mult_trans_cmplx_i32p_xpulpv2(void *args);
+/**
+   @brief Glue code for a batch of 16-bit fixed-point real FFTs, each core transforming whole
+   frames when there are at least nPE of them.
+   @param[in]  S          points to an instance of the 16-bit real FFT structure
+   @param[in]  pSrc       points to the input frames, N reals (forward, modified) or N/2 + 1
+                          complex values (inverse) each
+   @param[out] pDst       points to the output frames, N/2 + 1 complex values (forward) or N reals
+                          (inverse) each
+   @param[in]  nFrames    number of frames
+   @param[in]  ifftFlag   flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+   @param[in]  nPE        number of cores to use
+*/
+void plp_rfft_q16_batch(const plp_rfft_instance_q16 *S,
+                        int16_t *pSrc,
+                        int16_t *pDst,
+                        uint32_t nFrames,
+                        uint8_t ifftFlag,
+                        uint32_t nPE);
 
-/** -------------------------------------------------------
-  @brief      Glue code of matrix transpose matrix multiplication for complex 16-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief Batch of 16-bit fixed-point real FFTs for XPULPV2.
+   @param[in]  args  points to the plp_rfft_instance_q16_batch
 */
+void plp_rfft_q16_batch_xpulpv2(void *args);
 
-void plp_mat_mult_trans_cmplx_i16(const int16_t *__restrict__ pSrcA,
-                                  const int16_t *__restrict__ pSrcB,
-                                  uint32_t M,
-                                  uint32_t N,
-                                  uint32_t O,
-                                  int32_t *__restrict__ pDstC);
+/**
+   @brief Glue code for the floating-point 2D complex FFT. The rows are transformed in-place, then
+   each column through pBuffer. The inverse transform includes the 1/(rows*cols) factor.
+   @param[in]     SRow      points to the CFFT instance of the row length (number of columns)
+   @param[in]     SCol      points to the CFFT instance of the column length (number of rows)
+   @param[in,out] pSrc      points to the complex matrix, row major
+   @param[in]     ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+   @param[in]     pBuffer   points to a buffer of <code>2*rows</code> values
+*/
+void plp_cfft2d_f32(const plp_cfft_instance_f32 *SRow,
+                    const plp_cfft_instance_f32 *SCol,
+                    float32_t *pSrc,
+                    uint8_t ifftFlag,
+                    float32_t *pBuffer);
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 16-bit integers on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief Glue code for the parallel floating-point 2D complex FFT.
+   @param[in]     SRow      points to the CFFT instance of the row length (number of columns)
+   @param[in]     SCol      points to the CFFT instance of the column length (number of rows)
+   @param[in,out] pSrc      points to the complex matrix, row major
+   @param[in]     ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+   @param[in]     pBuffer   points to a buffer of <code>2*rows*nPE</code> values
+   @param[in]     nPE       number of cores to use
+*/
+void plp_cfft2d_f32_parallel(const plp_cfft_instance_f32 *SRow,
+                             const plp_cfft_instance_f32 *SCol,
+                             float32_t *pSrc,
+                             uint8_t ifftFlag,
+                             float32_t *pBuffer,
+                             uint32_t nPE);
+
+/**
+   @brief Floating-point 2D complex FFT for XPULPV2.
+   @param[in]     SRow      points to the CFFT instance of the row length (number of columns)
+   @param[in]     SCol      points to the CFFT instance of the column length (number of rows)
+   @param[in,out] pSrc      points to the complex matrix, row major
+   @param[in]     ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+   @param[in]     pBuffer   points to a buffer of <code>2*rows</code> values
+*/
+void plp_cfft2d_f32s_xpulpv2(const plp_cfft_instance_f32 *SRow,
+                             const plp_cfft_instance_f32 *SCol,
+                             float32_t *pSrc,
+                             uint8_t ifftFlag,
+                             float32_t *pBuffer);
+
+/**
+   @brief Parallel floating-point 2D complex FFT for XPULPV2.
+   @param[in]  args  points to the plp_cfft2d_instance_f32_parallel
 */
+void plp_cfft2d_f32p_xpulpv2(void *args);
 
-void plp_mat_mult_trans_cmplx_i16s_rv32im(const int16_t *__restrict__ pSrcA,
-                                          const int16_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          int32_t *__restrict__ pDstC);
+/**
+   @brief Glue code for the 16-bit fixed-point 2D complex FFT. The output is scaled by
+   1/(rows*cols), the inverse transform includes the 1/(rows*cols) factor.
+   @param[in]     SRow      points to the CFFT instance of the row length (number of columns)
+   @param[in]     SCol      points to the CFFT instance of the column length (number of rows)
+   @param[in,out] pSrc      points to the complex matrix, row major
+   @param[in]     ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+   @param[in]     pBuffer   points to a buffer of <code>2*rows</code> values
+*/
+void plp_cfft2d_q16(const plp_cfft_instance_q16 *SRow,
+                    const plp_cfft_instance_q16 *SCol,
+                    int16_t *pSrc,
+                    uint8_t ifftFlag,
+                    int16_t *pBuffer);
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 16-bit integers on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief Glue code for the parallel 16-bit fixed-point 2D complex FFT.
+   @param[in]     SRow      points to the CFFT instance of the row length (number of columns)
+   @param[in]     SCol      points to the CFFT instance of the column length (number of rows)
+   @param[in,out] pSrc      points to the complex matrix, row major
+   @param[in]     ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+   @param[in]     pBuffer   points to a buffer of <code>2*rows*nPE</code> values
+   @param[in]     nPE       number of cores to use
+*/
+void plp_cfft2d_q16_parallel(const plp_cfft_instance_q16 *SRow,
+                             const plp_cfft_instance_q16 *SCol,
+                             int16_t *pSrc,
+                             uint8_t ifftFlag,
+                             int16_t *pBuffer,
+                             uint32_t nPE);
 
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+/**
+   @brief 16-bit fixed-point 2D complex FFT for RV32IM.
+   @param[in]     SRow      points to the CFFT instance of the row length (number of columns)
+   @param[in]     SCol      points to the CFFT instance of the column length (number of rows)
+   @param[in,out] pSrc      points to the complex matrix, row major
+   @param[in]     ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+   @param[in]     pBuffer   points to a buffer of <code>2*rows</code> values
+*/
+void plp_cfft2d_q16s_rv32im(const plp_cfft_instance_q16 *SRow,
+                            const plp_cfft_instance_q16 *SCol,
+                            int16_t *pSrc,
+                            uint8_t ifftFlag,
+                            int16_t *pBuffer);
+
+/**
+   @brief 16-bit fixed-point 2D complex FFT for XPULPV2.
+   @param[in]     SRow      points to the CFFT instance of the row length (number of columns)
+   @param[in]     SCol      points to the CFFT instance of the column length (number of rows)
+   @param[in,out] pSrc      points to the complex matrix, row major
+   @param[in]     ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+   @param[in]     pBuffer   points to a buffer of <code>2*rows</code> values
+*/
+void plp_cfft2d_q16s_xpulpv2(const plp_cfft_instance_q16 *SRow,
+                             const plp_cfft_instance_q16 *SCol,
+                             int16_t *pSrc,
+                             uint8_t ifftFlag,
+                             int16_t *pBuffer);
+
+/**
+   @brief Parallel 16-bit fixed-point 2D complex FFT for XPULPV2.
+   @param[in]  args  points to the plp_cfft2d_instance_q16_parallel
 */
+void plp_cfft2d_q16p_xpulpv2(void *args);
 
-void plp_mat_mult_trans_cmplx_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                                           const int16_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           int32_t *__restrict__ pDstC);
+/**
+   @brief Glue code for the floating-point 2D FFT of a real matrix, transforming only the columns
+   0 .. cols/2 and filling the other ones from the Hermitian symmetry.
+   @param[in]  SRow     points to the real FFT instance of the row length (number of columns)
+   @param[in]  SCol     points to the CFFT instance of the column length (number of rows)
+   @param[in]  pSrc     points to the real matrix, row major
+   @param[out] pDst     points to the complex output matrix of <code>2*rows*cols</code> values
+   @param[in]  pBuffer  points to a buffer of <code>2*rows</code> values
+*/
+void plp_rfft2d_f32(const plp_fft_instance_f32 *SRow,
+                    const plp_cfft_instance_f32 *SCol,
+                    const float32_t *pSrc,
+                    float32_t *pDst,
+                    float32_t *pBuffer);
 
-/** -------------------------------------------------------
-  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 16-bit
-              integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief Glue code for the parallel floating-point 2D FFT of a real matrix.
+   @param[in]  SRow     points to the real FFT instance of the row length (number of columns)
+   @param[in]  SCol     points to the CFFT instance of the column length (number of rows)
+   @param[in]  pSrc     points to the real matrix, row major
+   @param[out] pDst     points to the complex output matrix of <code>2*rows*cols</code> values
+   @param[in]  pBuffer  points to a buffer of <code>2*rows*nPE</code> values
+   @param[in]  nPE      number of cores to use
+*/
+void plp_rfft2d_f32_parallel(const plp_fft_instance_f32 *SRow,
+                             const plp_cfft_instance_f32 *SCol,
+                             const float32_t *pSrc,
+                             float32_t *pDst,
+                             float32_t *pBuffer,
+                             uint32_t nPE);
+
+/**
+   @brief Floating-point 2D FFT of a real matrix for XPULPV2.
+   @param[in]  SRow     points to the real FFT instance of the row length (number of columns)
+   @param[in]  SCol     points to the CFFT instance of the column length (number of rows)
+   @param[in]  pSrc     points to the real matrix, row major
+   @param[out] pDst     points to the complex output matrix
+   @param[in]  pBuffer  points to a buffer of <code>2*rows</code> values
+*/
+void plp_rfft2d_f32s_xpulpv2(const plp_fft_instance_f32 *SRow,
+                             const plp_cfft_instance_f32 *SCol,
+                             const float32_t *pSrc,
+                             float32_t *pDst,
+                             float32_t *pBuffer);
+
+/**
+   @brief Parallel floating-point 2D FFT of a real matrix for XPULPV2.
+   @param[in]  args  points to the plp_rfft2d_instance_f32_parallel
 */
+void plp_rfft2d_f32p_xpulpv2(void *args);
 
-void plp_mat_mult_trans_cmplx_i16_parallel(const int16_t *__restrict__ pSrcA,
-                                           const int16_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           uint32_t nPE,
-                                           int32_t *__restrict__ pDstC);
+/**
+   @brief  Scratch memory needed by the floating-point streaming STFT.
+   @param[in]  fftLen  frame length
+   @param[in]  hop     number of samples between the starts of consecutive frames
+   @param[in]  nPE     number of cores transforming frames together
+   @return     number of bytes
+*/
+uint32_t plp_stft_f32_get_workspace_size(uint32_t fftLen, uint32_t hop, uint32_t nPE);
 
-/** -------------------------------------------------------
-  @brief      parallel matrix transpose matrix multiplication for complex 16-bit integers on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i16 struct initialized by
-                    plp_mat_mult_trans_cmplx_i16_parallel
-  @return     none
+/**
+   @brief  Set up a floating-point streaming STFT with an empty ring buffer.
+   @param[out] S           points to the STFT state
+   @param[in]  SFFT        points to the real FFT instance of the frame length
+   @param[in]  pWindow     points to the window, FFTLength values
+   @param[in]  hop         number of samples between frames, 1 to FFTLength
+   @param[in]  nPE         number of cores transforming frames together
+   @param[in]  pWorkspace  points to plp_stft_f32_get_workspace_size bytes of memory
+   @return     0 on success, -1 if the hop or the number of cores is not supported
+*/
+int32_t plp_stft_f32_init(plp_stft_instance_f32 *S,
+                          const plp_fft_instance_f32 *SFFT,
+                          const float32_t *pWindow,
+                          uint32_t hop,
+                          uint32_t nPE,
+                          float32_t *pWorkspace);
 
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+/**
+   @brief  Number of frames plp_stft_f32 emits when given the next len samples.
+   @param[in]  S    points to the STFT state
+   @param[in]  len  number of samples of the next chunk
+   @return     number of frames
 */
+uint32_t plp_stft_f32_get_frame_count(const plp_stft_instance_f32 *S, uint32_t len);
 
-void plp_mat_mult_trans_cmplx_i16p_xpulpv2(void *args);
+/**
+   @brief  Push a chunk of samples into a floating-point streaming STFT.
+   @param[in,out] S     points to the STFT state
+   @param[in]     pSrc  points to the chunk
+   @param[in]     len   number of samples of the chunk, any size
+   @param[out]    pDst  points to the spectra of the completed frames, FFTLength / 2 + 1 complex
+                        values each
+   @return        number of frames written to pDst
+*/
+uint32_t plp_stft_f32(plp_stft_instance_f32 *S,
+                      const float32_t *__restrict__ pSrc,
+                      uint32_t len,
+                      float32_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-  @brief      Glue code of matrix transpose matrix multiplication for complex 8-bit integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief  Push a chunk of samples into a floating-point streaming STFT, transforming up to nPE
+   completed frames at once on the cores given to plp_stft_f32_init.
+   @param[in,out] S     points to the STFT state
+   @param[in]     pSrc  points to the chunk
+   @param[in]     len   number of samples of the chunk, any size
+   @param[out]    pDst  points to the spectra of the completed frames, FFTLength / 2 + 1 complex
+                        values each
+   @return        number of frames written to pDst
+*/
+uint32_t plp_stft_f32_parallel(plp_stft_instance_f32 *S,
+                               const float32_t *__restrict__ pSrc,
+                               uint32_t len,
+                               float32_t *__restrict__ pDst);
+
+/**
+   @brief  Windowed real FFT of one frame of the streaming STFT for XPULPV2.
+   @param[in]  S         points to the STFT state
+   @param[in]  start     position of the first sample of the frame in the ring buffer
+   @param[in]  pScratch  points to <code>3 * FFTLength</code> values of scratch
+   @param[out] pDst      points to the spectrum, FFTLength + 2 values
+*/
+void plp_stft_f32s_xpulpv2(const plp_stft_instance_f32 *S,
+                           uint32_t start,
+                           float32_t *__restrict__ pScratch,
+                           float32_t *__restrict__ pDst);
+
+/**
+   @brief  Frames of the streaming STFT transformed in parallel for XPULPV2.
+   @param[in]  args  points to the plp_stft_instance_f32_parallel
 */
+void plp_stft_f32p_xpulpv2(void *args);
 
-void plp_mat_mult_trans_cmplx_i8(const int8_t *__restrict__ pSrcA,
-                                 const int8_t *__restrict__ pSrcB,
-                                 uint32_t M,
-                                 uint32_t N,
-                                 uint32_t O,
-                                 int32_t *__restrict__ pDstC);
+/**
+   @brief  Create a floating-point CFFT plan, generating the twiddle factors and the bit reversal
+   table for the given length.
+   @param[out]  plan    points to the plan, pass &plan->S to plp_cfft_f32
+   @param[in]   fftLen  power of two or 2^a 3^b 5^c between PLP_CFFT_PLAN_MIN_LEN and
+                        PLP_CFFT_PLAN_MAX_LEN_F32
+   @param[in]   mem     memory in which the tables are allocated
+   @return      0 on success, -1 if the length is not supported or the allocation failed
+*/
+int32_t plp_cfft_plan_create_f32(plp_cfft_plan_f32 *plan, uint32_t fftLen, plp_fft_plan_mem mem);
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 8-bit integers on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief  Free the tables of a floating-point CFFT plan.
+   @param[in]   plan    points to a plan created with plp_cfft_plan_create_f32
+   @return      none
 */
+void plp_cfft_plan_destroy_f32(plp_cfft_plan_f32 *plan);
 
-void plp_mat_mult_trans_cmplx_i8s_rv32im(const int8_t *__restrict__ pSrcA,
-                                         const int8_t *__restrict__ pSrcB,
-                                         uint32_t M,
-                                         uint32_t N,
-                                         uint32_t O,
-                                         int32_t *__restrict__ pDstC);
+/**
+   @brief  Create a 16-bit fixed-point CFFT plan, generating the twiddle factors and the bit
+   reversal table for the given length.
+   @param[out]  plan    points to the plan, pass &plan->S to plp_cfft_q16
+   @param[in]   fftLen  power of two or 2^a 3^b 5^c between PLP_CFFT_PLAN_MIN_LEN and
+                        PLP_CFFT_PLAN_MAX_LEN_Q
+   @param[in]   mem     memory in which the tables are allocated
+   @return      0 on success, -1 if the length is not supported or the allocation failed
+*/
+int32_t plp_cfft_plan_create_q16(plp_cfft_plan_q16 *plan, uint32_t fftLen, plp_fft_plan_mem mem);
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 8-bit integers on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief  Free the tables of a 16-bit fixed-point CFFT plan.
+   @param[in]   plan    points to a plan created with plp_cfft_plan_create_q16
+   @return      none
+*/
+void plp_cfft_plan_destroy_q16(plp_cfft_plan_q16 *plan);
 
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+/**
+   @brief  Create a 32-bit fixed-point CFFT plan, generating the twiddle factors and the bit
+   reversal table for the given length.
+   @param[out]  plan    points to the plan, pass &plan->S to plp_cfft_q32
+   @param[in]   fftLen  power of two between PLP_CFFT_PLAN_MIN_LEN and PLP_CFFT_PLAN_MAX_LEN_Q
+   @param[in]   mem     memory in which the tables are allocated
+   @return      0 on success, -1 if the length is not supported or the allocation failed
 */
+int32_t plp_cfft_plan_create_q32(plp_cfft_plan_q32 *plan, uint32_t fftLen, plp_fft_plan_mem mem);
 
-void plp_mat_mult_trans_cmplx_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                                          const int8_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          int32_t *__restrict__ pDstC);
+/**
+   @brief  Free the tables of a 32-bit fixed-point CFFT plan.
+   @param[in]   plan    points to a plan created with plp_cfft_plan_create_q32
+   @return      none
+*/
+void plp_cfft_plan_destroy_q32(plp_cfft_plan_q32 *plan);
 
-/** -------------------------------------------------------
-  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 8-bit
-              integers
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief  Create a chirp-z transform plan, evaluating numBins bins of the spectrum of len samples
+   at the normalized frequencies fStart + k * fStep (in cycles per sample).
+   @param[out]  plan     points to the plan
+   @param[in]   len      number of input samples
+   @param[in]   numBins  number of output bins, len + numBins - 1 <= PLP_CFFT_PLAN_MAX_LEN_F32
+   @param[in]   fStart   frequency of the first bin
+   @param[in]   fStep    distance between the bins
+   @param[in]   mem      memory in which the tables are allocated
+   @return      0 on success, -1 if the dimensions are not supported or the allocation failed
+*/
+int32_t plp_czt_plan_create_f32(plp_czt_plan_f32 *plan,
+                                uint32_t len,
+                                uint32_t numBins,
+                                float32_t fStart,
+                                float32_t fStep,
+                                plp_fft_plan_mem mem);
+
+/**
+   @brief  Create a chirp-z transform plan computing the DFT of any length (e.g. a prime).
+   @param[out]  plan     points to the plan
+   @param[in]   len      length of the DFT, 2 * len - 1 <= PLP_CFFT_PLAN_MAX_LEN_F32
+   @param[in]   mem      memory in which the tables are allocated
+   @return      0 on success, -1 if the length is not supported or the allocation failed
 */
+int32_t plp_czt_plan_create_dft_f32(plp_czt_plan_f32 *plan, uint32_t len, plp_fft_plan_mem mem);
 
-void plp_mat_mult_trans_cmplx_i8_parallel(const int8_t *__restrict__ pSrcA,
-                                          const int8_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          uint32_t nPE,
-                                          int32_t *__restrict__ pDstC);
+/**
+   @brief  Free the tables of a chirp-z transform plan.
+   @param[in]   plan    points to a plan created with plp_czt_plan_create_f32 or
+                        plp_czt_plan_create_dft_f32
+   @return      none
+*/
+void plp_czt_plan_destroy_f32(plp_czt_plan_f32 *plan);
+
+/**
+   @brief  Floating-point chirp-z transform (Bluestein's algorithm).
+   @param[in]   plan    points to the plan
+   @param[in]   pSrc    points to the len complex input samples
+   @param[in]   pBuf    points to a work buffer of 2 * plan->fft.S.fftLen values
+   @param[out]  pDst    points to the numBins complex output bins
+   @return      none
+*/
+void plp_czt_f32(const plp_czt_plan_f32 *plan,
+                 const float32_t *__restrict__ pSrc,
+                 float32_t *__restrict__ pBuf,
+                 float32_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-  @brief      parallel matrix transpose matrix multiplication for complex 8-bit integers on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_i8 struct initialized by
-                    plp_mat_mult_trans_cmplx_i8_parallel
-  @return     none
+/**
+   @brief  Floating-point chirp-z transform (Bluestein's algorithm), parallel version.
+   @param[in]   plan    points to the plan
+   @param[in]   pSrc    points to the len complex input samples
+   @param[in]   pBuf    points to a work buffer of 2 * plan->fft.S.fftLen values
+   @param[out]  pDst    points to the numBins complex output bins
+   @param[in]   nPE     number of cores, rounded down to a power of two for the FFT
+   @return      none
+*/
+void plp_czt_f32_parallel(const plp_czt_plan_f32 *plan,
+                          const float32_t *__restrict__ pSrc,
+                          float32_t *__restrict__ pBuf,
+                          float32_t *__restrict__ pDst,
+                          uint32_t nPE);
 
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+/**
+   @brief  Floating-point chirp-z transform for XPULPV2 extension.
+   @param[in]   plan    points to the plan
+   @param[in]   pSrc    points to the len complex input samples
+   @param[in]   pBuf    points to a work buffer of 2 * plan->fft.S.fftLen values
+   @param[out]  pDst    points to the numBins complex output bins
+   @return      none
 */
+void plp_czt_f32s_xpulpv2(const plp_czt_plan_f32 *plan,
+                          const float32_t *__restrict__ pSrc,
+                          float32_t *__restrict__ pBuf,
+                          float32_t *__restrict__ pDst);
 
-void plp_mat_mult_trans_cmplx_i8p_xpulpv2(void *args);
+/**
+   @brief  Floating-point chirp-z transform for XPULPV2 extension (parallel version).
+   @param[in]   arg     points to a plp_czt_instance_f32_parallel
+   @return      none
+*/
+void plp_czt_f32p_xpulpv2(void *arg);
 
-/** -------------------------------------------------------
-  @brief      Glue code of matrix transpose matrix multiplication for complex 32-bit floats
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief Floating-point DCT on real input data. Implementation of
+                        John Makhoul's "A Fast Cosine Transform in One
+                        and Two Dimensions" 1980 IEEE paper.
+   @param[in]   S       points to an instance of the floating-point FFT
+                        structure with FFTLength = DCTLength
+   @param[in]   pShift  points to twiddle coefficient table of 4*FFTLength,
+                        of which only the first quarter is necessary.
+   @param[in]   pSrc    points to the input buffer (real data) of size
+                        FFTLength 
+   @param[out]  pBuf    points to buffer of size 2*FFTLength, used for 
+                        computation.
+   @param[out]  pDst    points to output buffer (real data) of size FFTLength,
+                        may be the same as pSrc.
+   @return      none
 */
+void plp_dct2_f32(const plp_fft_instance_f32 *S,
+                  const Complex_type_f32 *pShift,
+                  const uint8_t orthoNorm,
+                  const float32_t *__restrict__ pSrc,
+                  float32_t *__restrict__ pBuf,
+                  float32_t *__restrict__ pDst);
 
-void plp_mat_mult_trans_cmplx_f32(const float *__restrict__ pSrcA,
-                                  const float *__restrict__ pSrcB,
-                                  uint32_t M,
-                                  uint32_t N,
-                                  uint32_t O,
-                                  float *__restrict__ pDstC);
+/**
+   @brief Floating-point DCT on real input data. Implementation of
+                        John Makhoul's "A Fast Cosine Transform in One
+                        and Two Dimensions" 1980 IEEE paper.
+   @param[in]   S       points to an instance of the floating-point FFT
+                        structure with FFTLength = DCTLength
+   @param[in]   pShift  points to twiddle coefficient table of 4*FFTLength,
+                        of which only the first quarter is necessary.
+   @param[in]   pSrc    points to the input buffer (real data) of size
+                        FFTLength 
+   @param[in]   nPE     number of parallel processing units
+   @param[out]  pBuf    points to buffer of size 2*FFTLength, used for 
+                        computation.
+   @param[out]  pDst    points to output buffer (real data) of size FFTLength,
+                        may be the same as pSrc.
+   @return      none
+*/
+void plp_dct2_f32_parallel(const plp_fft_instance_f32 *S,
+                  	   const Complex_type_f32 *pShift,
+                  	   const uint8_t orthoNorm,
+                  	   const float32_t *__restrict__ pSrc,
+			   const uint32_t nPE,
+                  	   float32_t *__restrict__ pBuf,
+                  	   float32_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 32-bit floats on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief  Create a floating-point DCT plan (DCT-III and DCT-IV), generating the twiddle factors of
+   the pre- and post-processing and the CFFT plan of len/2 points.
+   @param[out]  plan    points to the plan
+   @param[in]   len     number of points, len/2 must be a length supported by
+                        plp_cfft_plan_create_f32
+   @param[in]   mem     memory in which the tables are allocated
+   @return      0 on success, -1 if the length is not supported or the allocation failed
 */
+int32_t plp_dct_plan_create_f32(plp_dct_plan_f32 *plan, uint32_t len, plp_fft_plan_mem mem);
 
-void plp_mat_mult_trans_cmplx_f32s_xpulpv2(const float *__restrict__ pSrcA,
-                                           const float *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           float *__restrict__ pDstC);
+/**
+   @brief  Free the tables of a floating-point DCT plan.
+   @param[in]   plan    points to a plan created with plp_dct_plan_create_f32
+   @return      none
+*/
+void plp_dct_plan_destroy_f32(plp_dct_plan_f32 *plan);
 
-/** -------------------------------------------------------
-  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 32-bit floats
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief  Create a 16-bit fixed-point DCT plan (DCT-II, DCT-III and DCT-IV), generating the
+   twiddle factors of the pre- and post-processing and the CFFT plan of len/2 points.
+   @param[out]  plan    points to the plan
+   @param[in]   len     number of points, len/2 must be a length supported by
+                        plp_cfft_plan_create_q16
+   @param[in]   mem     memory in which the tables are allocated
+   @return      0 on success, -1 if the length is not supported or the allocation failed
 */
+int32_t plp_dct_plan_create_q16(plp_dct_plan_q16 *plan, uint32_t len, plp_fft_plan_mem mem);
 
-void plp_mat_mult_trans_cmplx_f32_parallel(const float *__restrict__ pSrcA,
-                                           const float *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           uint32_t nPE,
-                                           float *__restrict__ pDstC);
+/**
+   @brief  Free the tables of a 16-bit fixed-point DCT plan.
+   @param[in]   plan    points to a plan created with plp_dct_plan_create_q16
+   @return      none
+*/
+void plp_dct_plan_destroy_q16(plp_dct_plan_q16 *plan);
 
-/** -------------------------------------------------------
-  @brief      parallel matrix transpose matrix multiplication for complex 32-bit floats on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_f32 struct initialized by
-                    plp_mat_mult_trans_cmplx_f32_parallel
-  @return     none
+/**
+   @brief  Create a 32-bit fixed-point DCT plan (DCT-II, DCT-III and DCT-IV), generating the
+   twiddle factors of the pre- and post-processing and the CFFT plan of len/2 points.
+   @param[out]  plan    points to the plan
+   @param[in]   len     number of points, len/2 must be a length supported by
+                        plp_cfft_plan_create_q32
+   @param[in]   mem     memory in which the tables are allocated
+   @return      0 on success, -1 if the length is not supported or the allocation failed
 */
+int32_t plp_dct_plan_create_q32(plp_dct_plan_q32 *plan, uint32_t len, plp_fft_plan_mem mem);
 
-void plp_mat_mult_trans_cmplx_f32p_xpulpv2(void *args);
+/**
+   @brief  Free the tables of a 32-bit fixed-point DCT plan.
+   @param[in]   plan    points to a plan created with plp_dct_plan_create_q32
+   @return      none
+*/
+void plp_dct_plan_destroy_q32(plp_dct_plan_q32 *plan);
 
-/** -------------------------------------------------------
-  @brief      Glue code of matrix transpose matrix multiplication for complex 32-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief  Glue code for the 16-bit fixed-point DCT-II,
+   X[k] = 1/N sum_n x[n] cos(pi k (2n + 1) / (2N)).
+   @param[in]   plan    points to a plan created with plp_dct_plan_create_q16
+   @param[in]   pSrc    points to the N input values in Q15
+   @param[in]   pBuf    points to a work buffer of N values, word aligned
+   @param[out]  pDst    points to the N output values in Q15, may be the same as pSrc
+   @return      none
+*/
+void plp_dct2_q16(const plp_dct_plan_q16 *plan,
+                  const int16_t *pSrc,
+                  int16_t *__restrict__ pBuf,
+                  int16_t *pDst);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+/**
+   @brief  Glue code for the 16-bit fixed-point DCT-II (parallel version).
+   @param[in]   plan    points to a plan created with plp_dct_plan_create_q16
+   @param[in]   pSrc    points to the N input values in Q15
+   @param[in]   nPE     number of parallel processing units
+   @param[in]   pBuf    points to a work buffer of N values, word aligned
+   @param[out]  pDst    points to the N output values in Q15, may be the same as pSrc
+   @return      none
 */
+void plp_dct2_q16_parallel(const plp_dct_plan_q16 *plan,
+                           const int16_t *pSrc,
+                           uint32_t nPE,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *pDst);
 
-void plp_mat_mult_trans_cmplx_q32(const int32_t *__restrict__ pSrcA,
-                                  const int32_t *__restrict__ pSrcB,
-                                  uint32_t M,
-                                  uint32_t N,
-                                  uint32_t O,
-                                  uint32_t shift,
-                                  int32_t *__restrict__ pDstC);
+/**
+   @brief  16-bit fixed-point DCT-II for RV32IM.
+   @param[in]   plan    points to the plan
+   @param[in]   pSrc    points to the N input values
+   @param[in]   pBuf    points to a work buffer of N values
+   @param[out]  pDst    points to the N output values
+   @return      none
+*/
+void plp_dct2_q16s_rv32im(const plp_dct_plan_q16 *plan,
+                          const int16_t *pSrc,
+                          int16_t *__restrict__ pBuf,
+                          int16_t *pDst);
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 32-bit fix-point on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief  16-bit fixed-point DCT-II for XPULPV2 extension.
+   @param[in]   plan    points to the plan
+   @param[in]   pSrc    points to the N input values
+   @param[in]   pBuf    points to a work buffer of N values
+   @param[out]  pDst    points to the N output values
+   @return      none
+*/
+void plp_dct2_q16s_xpulpv2(const plp_dct_plan_q16 *plan,
+                           const int16_t *pSrc,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *pDst);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+/**
+   @brief  16-bit fixed-point DCT-II for XPULPV2 extension (parallel version).
+   @param[in]   args    points to a plp_dct_instance_q16_parallel
+   @return      none
 */
+void plp_dct2_q16p_xpulpv2(void *args);
 
-void plp_mat_mult_trans_cmplx_q32s_rv32im(const int32_t *__restrict__ pSrcA,
-                                          const int32_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          uint32_t shift,
-                                          int32_t *__restrict__ pDstC);
+/**
+   @brief  Glue code for the 16-bit fixed-point DCT-III, the inverse of the DCT-II,
+   x[n] = 1/N X[0] + 2/N sum_{k>0} X[k] cos(pi k (2n + 1) / (2N)).
+   A DCT-II followed by a DCT-III gives x/N, like plp_rfft_q16.
+   @param[in]   plan    points to a plan created with plp_dct_plan_create_q16
+   @param[in]   pSrc    points to the N input values in Q15
+   @param[in]   pBuf    points to a work buffer of N values, word aligned
+   @param[out]  pDst    points to the N output values in Q15, may be the same as pSrc
+   @return      none
+*/
+void plp_dct3_q16(const plp_dct_plan_q16 *plan,
+                  const int16_t *pSrc,
+                  int16_t *__restrict__ pBuf,
+                  int16_t *pDst);
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 32-bit fix-point on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief  Glue code for the 16-bit fixed-point DCT-III (parallel version).
+   @param[in]   plan    points to a plan created with plp_dct_plan_create_q16
+   @param[in]   pSrc    points to the N input values in Q15
+   @param[in]   nPE     number of parallel processing units
+   @param[in]   pBuf    points to a work buffer of N values, word aligned
+   @param[out]  pDst    points to the N output values in Q15, may be the same as pSrc
+   @return      none
+*/
+void plp_dct3_q16_parallel(const plp_dct_plan_q16 *plan,
+                           const int16_t *pSrc,
+                           uint32_t nPE,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *pDst);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+/**
+   @brief  16-bit fixed-point DCT-III for RV32IM.
+   @param[in]   plan    points to the plan
+   @param[in]   pSrc    points to the N input values
+   @param[in]   pBuf    points to a work buffer of N values
+   @param[out]  pDst    points to the N output values
+   @return      none
 */
+void plp_dct3_q16s_rv32im(const plp_dct_plan_q16 *plan,
+                          const int16_t *pSrc,
+                          int16_t *__restrict__ pBuf,
+                          int16_t *pDst);
 
-void plp_mat_mult_trans_cmplx_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                           const int32_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           uint32_t shift,
-                                           int32_t *__restrict__ pDstC);
+/**
+   @brief  16-bit fixed-point DCT-III for XPULPV2 extension.
+   @param[in]   plan    points to the plan
+   @param[in]   pSrc    points to the N input values
+   @param[in]   pBuf    points to a work buffer of N values
+   @param[out]  pDst    points to the N output values
+   @return      none
+*/
+void plp_dct3_q16s_xpulpv2(const plp_dct_plan_q16 *plan,
+                           const int16_t *pSrc,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *pDst);
 
-/** -------------------------------------------------------
-  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 32-bit
-              fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief  16-bit fixed-point DCT-III for XPULPV2 extension (parallel version).
+   @param[in]   args    points to a plp_dct_instance_q16_parallel
+   @return      none
+*/
+void plp_dct3_q16p_xpulpv2(void *args);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+/**
+   @brief  Glue code for the 16-bit fixed-point DCT-IV,
+   X[k] = 1/N sum_n x[n] cos(pi (2k + 1) (2n + 1) / (4N)).
+   @param[in]   plan    points to a plan created with plp_dct_plan_create_q16
+   @param[in]   pSrc    points to the N input values in Q15
+   @param[in]   pBuf    points to a work buffer of N values, word aligned
+   @param[out]  pDst    points to the N output values in Q15, may be the same as pSrc
+   @return      none
 */
+void plp_dct4_q16(const plp_dct_plan_q16 *plan,
+                  const int16_t *pSrc,
+                  int16_t *__restrict__ pBuf,
+                  int16_t *pDst);
 
-void plp_mat_mult_trans_cmplx_q32_parallel(const int32_t *__restrict__ pSrcA,
-                                           const int32_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           uint32_t shift,
-                                           uint32_t nPE,
-                                           int32_t *__restrict__ pDstC);
-
-/** -------------------------------------------------------
-  @brief      parallel matrix transpose matrix multiplication for complex 32-bit fix-point on
-              XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q32 struct initialized by
-                    plp_mat_mult_trans_cmplx_q32_parallel
-  @return     none
+/**
+   @brief  Glue code for the 16-bit fixed-point DCT-IV (parallel version).
+   @param[in]   plan    points to a plan created with plp_dct_plan_create_q16
+   @param[in]   pSrc    points to the N input values in Q15
+   @param[in]   nPE     number of parallel processing units
+   @param[in]   pBuf    points to a work buffer of N values, word aligned
+   @param[out]  pDst    points to the N output values in Q15, may be the same as pSrc
+   @return      none
+*/
+void plp_dct4_q16_parallel(const plp_dct_plan_q16 *plan,
+                           const int16_t *pSrc,
+                           uint32_t nPE,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *pDst);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+/**
+   @brief  16-bit fixed-point DCT-IV for RV32IM.
+   @param[in]   plan    points to the plan
+   @param[in]   pSrc    points to the N input values
+   @param[in]   pBuf    points to a work buffer of N values
+   @param[out]  pDst    points to the N output values
+   @return      none
 */
+void plp_dct4_q16s_rv32im(const plp_dct_plan_q16 *plan,
+                          const int16_t *pSrc,
+                          int16_t *__restrict__ pBuf,
+                          int16_t *pDst);
 
-void plp_mat_mult_trans_cmplx_q32p_xpulpv2(void *args);
+/**
+   @brief  16-bit fixed-point DCT-IV for XPULPV2 extension.
+   @param[in]   plan    points to the plan
+   @param[in]   pSrc    points to the N input values
+   @param[in]   pBuf    points to a work buffer of N values
+   @param[out]  pDst    points to the N output values
+   @return      none
+*/
+void plp_dct4_q16s_xpulpv2(const plp_dct_plan_q16 *plan,
+                           const int16_t *pSrc,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *pDst);
 
-/** -------------------------------------------------------
-  @brief      Glue code of matrix transpose matrix multiplication for complex 16-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief  16-bit fixed-point DCT-IV for XPULPV2 extension (parallel version).
+   @param[in]   args    points to a plp_dct_instance_q16_parallel
+   @return      none
+*/
+void plp_dct4_q16p_xpulpv2(void *args);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+/**
+   @brief  Glue code for the 32-bit fixed-point DCT-II,
+   X[k] = 1/N sum_n x[n] cos(pi k (2n + 1) / (2N)).
+   @param[in]   plan    points to a plan created with plp_dct_plan_create_q32
+   @param[in]   pSrc    points to the N input values in Q31
+   @param[in]   pBuf    points to a work buffer of N values, word aligned
+   @param[out]  pDst    points to the N output values in Q31, may be the same as pSrc
+   @return      none
 */
+void plp_dct2_q32(const plp_dct_plan_q32 *plan,
+                  const int32_t *pSrc,
+                  int32_t *__restrict__ pBuf,
+                  int32_t *pDst);
 
-void plp_mat_mult_trans_cmplx_q16(const int16_t *__restrict__ pSrcA,
-                                  const int16_t *__restrict__ pSrcB,
-                                  uint32_t M,
-                                  uint32_t N,
-                                  uint32_t O,
-                                  uint32_t shift,
-                                  int16_t *__restrict__ pDstC);
+/**
+   @brief  Glue code for the 32-bit fixed-point DCT-II (parallel version).
+   @param[in]   plan    points to a plan created with plp_dct_plan_create_q32
+   @param[in]   pSrc    points to the N input values in Q31
+   @param[in]   nPE     number of parallel processing units
+   @param[in]   pBuf    points to a work buffer of N values, word aligned
+   @param[out]  pDst    points to the N output values in Q31, may be the same as pSrc
+   @return      none
+*/
+void plp_dct2_q32_parallel(const plp_dct_plan_q32 *plan,
+                           const int32_t *pSrc,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pBuf,
+                           int32_t *pDst);
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 16-bit fix-point on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief  32-bit fixed-point DCT-II for RV32IM.
+   @param[in]   plan    points to the plan
+   @param[in]   pSrc    points to the N input values
+   @param[in]   pBuf    points to a work buffer of N values
+   @param[out]  pDst    points to the N output values
+   @return      none
+*/
+void plp_dct2_q32s_rv32im(const plp_dct_plan_q32 *plan,
+                          const int32_t *pSrc,
+                          int32_t *__restrict__ pBuf,
+                          int32_t *pDst);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+/**
+   @brief  32-bit fixed-point DCT-II for XPULPV2 extension.
+   @param[in]   plan    points to the plan
+   @param[in]   pSrc    points to the N input values
+   @param[in]   pBuf    points to a work buffer of N values
+   @param[out]  pDst    points to the N output values
+   @return      none
 */
+void plp_dct2_q32s_xpulpv2(const plp_dct_plan_q32 *plan,
+                           const int32_t *pSrc,
+                           int32_t *__restrict__ pBuf,
+                           int32_t *pDst);
 
-void plp_mat_mult_trans_cmplx_q16s_rv32im(const int16_t *__restrict__ pSrcA,
-                                          const int16_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          uint32_t shift,
-                                          int16_t *__restrict__ pDstC);
+/**
+   @brief  32-bit fixed-point DCT-II for XPULPV2 extension (parallel version).
+   @param[in]   args    points to a plp_dct_instance_q32_parallel
+   @return      none
+*/
+void plp_dct2_q32p_xpulpv2(void *args);
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 16-bit fix-point on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief  Glue code for the 32-bit fixed-point DCT-III, the inverse of the DCT-II,
+   x[n] = 1/N X[0] + 2/N sum_{k>0} X[k] cos(pi k (2n + 1) / (2N)).
+   A DCT-II followed by a DCT-III gives x/N, like plp_rfft_q32.
+   @param[in]   plan    points to a plan created with plp_dct_plan_create_q32
+   @param[in]   pSrc    points to the N input values in Q31
+   @param[in]   pBuf    points to a work buffer of N values, word aligned
+   @param[out]  pDst    points to the N output values in Q31, may be the same as pSrc
+   @return      none
+*/
+void plp_dct3_q32(const plp_dct_plan_q32 *plan,
+                  const int32_t *pSrc,
+                  int32_t *__restrict__ pBuf,
+                  int32_t *pDst);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+/**
+   @brief  Glue code for the 32-bit fixed-point DCT-III (parallel version).
+   @param[in]   plan    points to a plan created with plp_dct_plan_create_q32
+   @param[in]   pSrc    points to the N input values in Q31
+   @param[in]   nPE     number of parallel processing units
+   @param[in]   pBuf    points to a work buffer of N values, word aligned
+   @param[out]  pDst    points to the N output values in Q31, may be the same as pSrc
+   @return      none
+*/
+void plp_dct3_q32_parallel(const plp_dct_plan_q32 *plan,
+                           const int32_t *pSrc,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pBuf,
+                           int32_t *pDst);
 
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+/**
+   @brief  32-bit fixed-point DCT-III for RV32IM.
+   @param[in]   plan    points to the plan
+   @param[in]   pSrc    points to the N input values
+   @param[in]   pBuf    points to a work buffer of N values
+   @param[out]  pDst    points to the N output values
+   @return      none
 */
+void plp_dct3_q32s_rv32im(const plp_dct_plan_q32 *plan,
+                          const int32_t *pSrc,
+                          int32_t *__restrict__ pBuf,
+                          int32_t *pDst);
 
-void plp_mat_mult_trans_cmplx_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                                           const int16_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           uint32_t shift,
-                                           int16_t *__restrict__ pDstC);
+/**
+   @brief  32-bit fixed-point DCT-III for XPULPV2 extension.
+   @param[in]   plan    points to the plan
+   @param[in]   pSrc    points to the N input values
+   @param[in]   pBuf    points to a work buffer of N values
+   @param[out]  pDst    points to the N output values
+   @return      none
+*/
+void plp_dct3_q32s_xpulpv2(const plp_dct_plan_q32 *plan,
+                           const int32_t *pSrc,
+                           int32_t *__restrict__ pBuf,
+                           int32_t *pDst);
 
-/** -------------------------------------------------------
-  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 16-bit
-              fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief  32-bit fixed-point DCT-III for XPULPV2 extension (parallel version).
+   @param[in]   args    points to a plp_dct_instance_q32_parallel
+   @return      none
+*/
+void plp_dct3_q32p_xpulpv2(void *args);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+/**
+   @brief  Glue code for the 32-bit fixed-point DCT-IV,
+   X[k] = 1/N sum_n x[n] cos(pi (2k + 1) (2n + 1) / (4N)).
+   @param[in]   plan    points to a plan created with plp_dct_plan_create_q32
+   @param[in]   pSrc    points to the N input values in Q31
+   @param[in]   pBuf    points to a work buffer of N values, word aligned
+   @param[out]  pDst    points to the N output values in Q31, may be the same as pSrc
+   @return      none
 */
+void plp_dct4_q32(const plp_dct_plan_q32 *plan,
+                  const int32_t *pSrc,
+                  int32_t *__restrict__ pBuf,
+                  int32_t *pDst);
 
-void plp_mat_mult_trans_cmplx_q16_parallel(const int16_t *__restrict__ pSrcA,
-                                           const int16_t *__restrict__ pSrcB,
-                                           uint32_t M,
-                                           uint32_t N,
-                                           uint32_t O,
-                                           uint32_t shift,
-                                           uint32_t nPE,
-                                           int16_t *__restrict__ pDstC);
+/**
+   @brief  Glue code for the 32-bit fixed-point DCT-IV (parallel version).
+   @param[in]   plan    points to a plan created with plp_dct_plan_create_q32
+   @param[in]   pSrc    points to the N input values in Q31
+   @param[in]   nPE     number of parallel processing units
+   @param[in]   pBuf    points to a work buffer of N values, word aligned
+   @param[out]  pDst    points to the N output values in Q31, may be the same as pSrc
+   @return      none
+*/
+void plp_dct4_q32_parallel(const plp_dct_plan_q32 *plan,
+                           const int32_t *pSrc,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pBuf,
+                           int32_t *pDst);
 
-/** -------------------------------------------------------
-  @brief      parallel matrix transpose matrix multiplication for complex 16-bit fix-point on
-              XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q16 struct initialized by
-                    plp_mat_mult_trans_cmplx_q16_parallel
-  @return     none
+/**
+   @brief  32-bit fixed-point DCT-IV for RV32IM.
+   @param[in]   plan    points to the plan
+   @param[in]   pSrc    points to the N input values
+   @param[in]   pBuf    points to a work buffer of N values
+   @param[out]  pDst    points to the N output values
+   @return      none
+*/
+void plp_dct4_q32s_rv32im(const plp_dct_plan_q32 *plan,
+                          const int32_t *pSrc,
+                          int32_t *__restrict__ pBuf,
+                          int32_t *pDst);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+/**
+   @brief  32-bit fixed-point DCT-IV for XPULPV2 extension.
+   @param[in]   plan    points to the plan
+   @param[in]   pSrc    points to the N input values
+   @param[in]   pBuf    points to a work buffer of N values
+   @param[out]  pDst    points to the N output values
+   @return      none
+*/
+void plp_dct4_q32s_xpulpv2(const plp_dct_plan_q32 *plan,
+                           const int32_t *pSrc,
+                           int32_t *__restrict__ pBuf,
+                           int32_t *pDst);
 
-  @par Exploiting SIMD instructions
-  The 16 bit values are packed two each into 32 bit vectors and then the two dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+/**
+   @brief  32-bit fixed-point DCT-IV for XPULPV2 extension (parallel version).
+   @param[in]   args    points to a plp_dct_instance_q32_parallel
+   @return      none
 */
+void plp_dct4_q32p_xpulpv2(void *args);
 
-void plp_mat_mult_trans_cmplx_q16p_xpulpv2(void *args);
+/**
+   @brief  Glue code for the floating-point DCT-III, the inverse of plp_dct2_f32 with the same
+   orthoNorm flag.
+   @param[in]   plan        points to a plan created with plp_dct_plan_create_f32
+   @param[in]   orthoNorm   whether to use the orthonormal scaling
+   @param[in]   pSrc        points to the N input values
+   @param[in]   pBuf        points to a work buffer of N values
+   @param[out]  pDst        points to the N output values, may be the same as pSrc
+   @return      none
+*/
+void plp_dct3_f32(const plp_dct_plan_f32 *plan,
+                  const uint8_t orthoNorm,
+                  const float32_t *pSrc,
+                  float32_t *__restrict__ pBuf,
+                  float32_t *pDst);
 
-/** -------------------------------------------------------
-  @brief      Glue code of matrix transpose matrix multiplication for complex 8-bit fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief  Glue code for the floating-point DCT-III (parallel version).
+   @param[in]   plan        points to a plan created with plp_dct_plan_create_f32
+   @param[in]   orthoNorm   whether to use the orthonormal scaling
+   @param[in]   pSrc        points to the N input values
+   @param[in]   nPE         number of parallel processing units, rounded down to a power of two
+                            when N/2 is a power of two
+   @param[in]   pBuf        points to a work buffer of N values
+   @param[out]  pDst        points to the N output values, may be the same as pSrc
+   @return      none
+*/
+void plp_dct3_f32_parallel(const plp_dct_plan_f32 *plan,
+                           const uint8_t orthoNorm,
+                           const float32_t *pSrc,
+                           uint32_t nPE,
+                           float32_t *__restrict__ pBuf,
+                           float32_t *pDst);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+/**
+   @brief  Floating-point DCT-III for XPULPV2 extension.
+   @param[in]   plan        points to the plan
+   @param[in]   orthoNorm   whether to use the orthonormal scaling
+   @param[in]   pSrc        points to the N input values
+   @param[in]   pBuf        points to a work buffer of N values
+   @param[out]  pDst        points to the N output values
+   @return      none
 */
+void plp_dct3_f32s_xpulpv2(const plp_dct_plan_f32 *plan,
+                           const uint8_t orthoNorm,
+                           const float32_t *pSrc,
+                           float32_t *__restrict__ pBuf,
+                           float32_t *pDst);
 
-void plp_mat_mult_trans_cmplx_q8(const int8_t *__restrict__ pSrcA,
-                                 const int8_t *__restrict__ pSrcB,
-                                 uint32_t M,
-                                 uint32_t N,
-                                 uint32_t O,
-                                 uint32_t shift,
-                                 int8_t *__restrict__ pDstC);
+/**
+   @brief  Floating-point DCT-III for XPULPV2 extension (parallel version).
+   @param[in]   args    points to a plp_dct_instance_f32_parallel
+   @return      none
+*/
+void plp_dct3_f32p_xpulpv2(void *args);
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 8-bit fix-point on RV32IM
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief  Glue code for the floating-point DCT-IV,
+   X[k] = 2 sum_n x[n] cos(pi (2k + 1) (2n + 1) / (4N)), with the factor sqrt(2/N) instead of 2
+   for orthoNorm (then the DCT-IV is its own inverse).
+   @param[in]   plan        points to a plan created with plp_dct_plan_create_f32
+   @param[in]   orthoNorm   whether to use the orthonormal scaling
+   @param[in]   pSrc        points to the N input values
+   @param[in]   pBuf        points to a work buffer of N values
+   @param[out]  pDst        points to the N output values, may be the same as pSrc
+   @return      none
+*/
+void plp_dct4_f32(const plp_dct_plan_f32 *plan,
+                  const uint8_t orthoNorm,
+                  const float32_t *pSrc,
+                  float32_t *__restrict__ pBuf,
+                  float32_t *pDst);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+/**
+   @brief  Glue code for the floating-point DCT-IV (parallel version).
+   @param[in]   plan        points to a plan created with plp_dct_plan_create_f32
+   @param[in]   orthoNorm   whether to use the orthonormal scaling
+   @param[in]   pSrc        points to the N input values
+   @param[in]   nPE         number of parallel processing units, rounded down to a power of two
+                            when N/2 is a power of two
+   @param[in]   pBuf        points to a work buffer of N values
+   @param[out]  pDst        points to the N output values, may be the same as pSrc
+   @return      none
 */
+void plp_dct4_f32_parallel(const plp_dct_plan_f32 *plan,
+                           const uint8_t orthoNorm,
+                           const float32_t *pSrc,
+                           uint32_t nPE,
+                           float32_t *__restrict__ pBuf,
+                           float32_t *pDst);
 
-void plp_mat_mult_trans_cmplx_q8s_rv32im(const int8_t *__restrict__ pSrcA,
-                                         const int8_t *__restrict__ pSrcB,
-                                         uint32_t M,
-                                         uint32_t N,
-                                         uint32_t O,
-                                         uint32_t shift,
-                                         int8_t *__restrict__ pDstC);
+/**
+   @brief  Floating-point DCT-IV for XPULPV2 extension.
+   @param[in]   plan        points to the plan
+   @param[in]   orthoNorm   whether to use the orthonormal scaling
+   @param[in]   pSrc        points to the N input values
+   @param[in]   pBuf        points to a work buffer of N values
+   @param[out]  pDst        points to the N output values
+   @return      none
+*/
+void plp_dct4_f32s_xpulpv2(const plp_dct_plan_f32 *plan,
+                           const uint8_t orthoNorm,
+                           const float32_t *pSrc,
+                           float32_t *__restrict__ pBuf,
+                           float32_t *pDst);
 
-/** -------------------------------------------------------
-  @brief      matrix transpose matrix multiplication for complex 8-bit fix-point on XpulpV2
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief  Floating-point DCT-IV for XPULPV2 extension (parallel version).
+   @param[in]   args    points to a plp_dct_instance_f32_parallel
+   @return      none
+*/
+void plp_dct4_f32p_xpulpv2(void *args);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+/**
+   @brief  Set up a floating-point MDCT or IMDCT and clear its state.
+   @param[out]  S        points to the instance
+   @param[in]   plan     points to a DCT plan of M points
+   @param[in]   pWindow  points to the window of 2M values
+   @param[in]   pState   points to the state of M values
+   @return      none
+*/
+void plp_mdct_f32_init(plp_mdct_instance_f32 *S,
+                       const plp_dct_plan_f32 *plan,
+                       const float32_t *pWindow,
+                       float32_t *pState);
 
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+/**
+   @brief  Glue code for the floating-point MDCT.
+   @param[in,out] S       points to the instance
+   @param[in]   pSrc    points to the M new input samples
+   @param[in]   pBuf    points to a work buffer of M values
+   @param[out]  pDst    points to the M coefficients
+   @return      none
 */
+void plp_mdct_f32(plp_mdct_instance_f32 *S,
+                  const float32_t *__restrict__ pSrc,
+                  float32_t *__restrict__ pBuf,
+                  float32_t *__restrict__ pDst);
 
-void plp_mat_mult_trans_cmplx_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                                          const int8_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          uint32_t shift,
-                                          int8_t *__restrict__ pDstC);
+/**
+   @brief  Glue code for the floating-point MDCT (parallel version).
+   @param[in,out] S       points to the instance
+   @param[in]   pSrc    points to the M new input samples
+   @param[in]   nPE     number of parallel processing units, rounded down to a power of two
+                        when M/2 is a power of two
+   @param[in]   pBuf    points to a work buffer of M values
+   @param[out]  pDst    points to the M coefficients
+   @return      none
+*/
+void plp_mdct_f32_parallel(plp_mdct_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           uint32_t nPE,
+                           float32_t *__restrict__ pBuf,
+                           float32_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-  @brief      Glue code of parallel matrix transpose matrix multiplication for complex 8-bit
-              fix-point
-  @param[in]  pSrcA Points to the first input matrix of shape MxN
-  @param[in]  pSrcB Points to the second input matrix of shape OxN
-  @param[in]  M     Height of matrix SrcA and DstC
-  @param[in]  N     Width of matrix SrcA and SrcB
-  @param[in]  O     Height of matrix SrcB and width of matrix DstC
-  @param[in]  shift Amount to shift the result of each multiplication ot the right
-  @param[in]  nPE   Number of cores to use for computation
-  @param[out] pDstC Points to the output matrix of shape MxO
-  @return     none
+/**
+   @brief  Floating-point MDCT for XPULPV2 extension.
+   @param[in,out] S       points to the instance
+   @param[in]   pSrc    points to the M new input samples
+   @param[in]   pBuf    points to a work buffer of M values
+   @param[out]  pDst    points to the M coefficients
+   @return      none
+*/
+void plp_mdct_f32s_xpulpv2(plp_mdct_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           float32_t *__restrict__ pBuf,
+                           float32_t *__restrict__ pDst);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+/**
+   @brief  Floating-point MDCT for XPULPV2 extension (parallel version).
+   @param[in]   args    points to a plp_mdct_instance_f32_parallel
+   @return      none
 */
+void plp_mdct_f32p_xpulpv2(void *args);
 
-void plp_mat_mult_trans_cmplx_q8_parallel(const int8_t *__restrict__ pSrcA,
-                                          const int8_t *__restrict__ pSrcB,
-                                          uint32_t M,
-                                          uint32_t N,
-                                          uint32_t O,
-                                          uint32_t shift,
-                                          uint32_t nPE,
-                                          int8_t *__restrict__ pDstC);
+/**
+   @brief  Glue code for the floating-point IMDCT with overlap-add.
+   @param[in,out] S       points to the instance
+   @param[in]   pSrc    points to the M coefficients
+   @param[in]   pBuf    points to a work buffer of M values
+   @param[out]  pDst    points to the M output samples
+   @return      none
+*/
+void plp_imdct_f32(plp_mdct_instance_f32 *S,
+                   const float32_t *__restrict__ pSrc,
+                   float32_t *__restrict__ pBuf,
+                   float32_t *__restrict__ pDst);
 
-/** -------------------------------------------------------
-  @brief      parallel matrix transpose matrix multiplication for complex 8-bit fix-point on XpulpV2
-  @param[in]  args  pointer to plp_mat_mult_cmplx_instance_q8 struct initialized by
-                    plp_mat_mult_trans_cmplx_q8_parallel
-  @return     none
+/**
+   @brief  Glue code for the floating-point IMDCT (parallel version).
+   @param[in,out] S       points to the instance
+   @param[in]   pSrc    points to the M coefficients
+   @param[in]   nPE     number of parallel processing units, rounded down to a power of two
+                        when M/2 is a power of two
+   @param[in]   pBuf    points to a work buffer of M values
+   @param[out]  pDst    points to the M output samples
+   @return      none
+*/
+void plp_imdct_f32_parallel(plp_mdct_instance_f32 *S,
+                            const float32_t *__restrict__ pSrc,
+                            uint32_t nPE,
+                            float32_t *__restrict__ pBuf,
+                            float32_t *__restrict__ pDst);
 
-  @par Fix-Point
-  Fix-Point and Shifting
-  The result will be shifted by the parameter `shift` to the right (which corresponds to a
-  multiplication by `2^-shift`). Assume that matrix A is represente as `pSrcA * 2^-x` and matrix B
-  as `pSrcB * 2^-y` (which means that A has `x`, and B has `y` bits after the binary point). Then,
-  the output matrix C is represented as `pDstC * 2^-(x + y - shift)`.
-  The output matrix is also stored with the same number of bits as the inputs. Set the
-  `shift` parameter such that no overflow occurrs.
+/**
+   @brief  Floating-point IMDCT for XPULPV2 extension.
+   @param[in,out] S       points to the instance
+   @param[in]   pSrc    points to the M coefficients
+   @param[in]   pBuf    points to a work buffer of M values
+   @param[out]  pDst    points to the M output samples
+   @return      none
+*/
+void plp_imdct_f32s_xpulpv2(plp_mdct_instance_f32 *S,
+                            const float32_t *__restrict__ pSrc,
+                            float32_t *__restrict__ pBuf,
+                            float32_t *__restrict__ pDst);
 
-  @par Exploiting SIMD instructions
-  The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-  performed on 32 bit vectors, with 32 bit accumulator.
+/**
+   @brief  Floating-point IMDCT for XPULPV2 extension (parallel version).
+   @param[in]   args    points to a plp_mdct_instance_f32_parallel
+   @return      none
 */
+void plp_imdct_f32p_xpulpv2(void *args);
 
-void plp_mat_mult_trans_cmplx_q8p_xpulpv2(void *args);
+/**
+   @brief  Set up a 16-bit fixed-point MDCT or IMDCT and clear its state, M/2 must be a power of two.
+   @param[out]  S        points to the instance
+   @param[in]   plan     points to a DCT plan of M points
+   @param[in]   pWindow  points to the window of 2M values in Q15
+   @param[in]   pState   points to the state of M values
+   @return      none
+*/
+void plp_mdct_q16_init(plp_mdct_instance_q16 *S,
+                       const plp_dct_plan_q16 *plan,
+                       const int16_t *pWindow,
+                       int16_t *pState);
 
 /**
- * @brief      Glue code for complex magnitude calculation in float32
- *
- * @param[in]  pSrc        pointer to source
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief  Glue code for the 16-bit fixed-point MDCT, the coefficients are divided by 2M.
+   @param[in,out] S       points to the instance
+   @param[in]   pSrc    points to the M new input samples in Q15
+   @param[in]   pBuf    points to a work buffer of M values, word aligned
+   @param[out]  pDst    points to the M coefficients in Q15
+   @return      none
+*/
+void plp_mdct_q16(plp_mdct_instance_q16 *S,
+                  const int16_t *__restrict__ pSrc,
+                  int16_t *__restrict__ pBuf,
+                  int16_t *__restrict__ pDst);
 
-void plp_cmplx_mag_f32(const float32_t *pSrc,
-                       float32_t *pRes,
-                       uint32_t numSamples);
+/**
+   @brief  Glue code for the 16-bit fixed-point MDCT (parallel version).
+   @param[in,out] S       points to the instance
+   @param[in]   pSrc    points to the M new input samples in Q15
+   @param[in]   nPE     number of parallel processing units
+   @param[in]   pBuf    points to a work buffer of M values, word aligned
+   @param[out]  pDst    points to the M coefficients in Q15
+   @return      none
+*/
+void plp_mdct_q16_parallel(plp_mdct_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t nPE,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *__restrict__ pDst);
 
 /**
- * @brief      complex magnitude for float32 on XPULPV2
- *
- * @param[in]  pSrc        pointer to source
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief  16-bit fixed-point MDCT for RV32IM.
+   @param[in,out] S       points to the instance
+   @param[in]   pSrc    points to the M new input samples in Q15
+   @param[in]   pBuf    points to a work buffer of M values, word aligned
+   @param[out]  pDst    points to the M coefficients in Q15
+   @return      none
+*/
+void plp_mdct_q16s_rv32im(plp_mdct_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          int16_t *__restrict__ pBuf,
+                          int16_t *__restrict__ pDst);
 
-void plp_cmplx_mag_f32s_xpulpv2(const float32_t *pSrc,
-                                float32_t *pRes,
-                                uint32_t numSamples);
+/**
+   @brief  16-bit fixed-point MDCT for XPULPV2 extension.
+   @param[in,out] S       points to the instance
+   @param[in]   pSrc    points to the M new input samples in Q15
+   @param[in]   pBuf    points to a work buffer of M values, word aligned
+   @param[out]  pDst    points to the M coefficients in Q15
+   @return      none
+*/
+void plp_mdct_q16s_xpulpv2(plp_mdct_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *__restrict__ pDst);
 
 /**
- * @brief      Glue code for complex magnitude calculation for 32 bit fixpoint
- *
- * @param[in]  pSrc        pointer to source
- * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief  16-bit fixed-point MDCT for XPULPV2 extension (parallel version).
+   @param[in]   args    points to a plp_mdct_instance_q16_parallel
+   @return      none
+*/
+void plp_mdct_q16p_xpulpv2(void *args);
 
-void plp_cmplx_mag_q32(const int32_t *pSrc,
-                       const uint32_t fracBits,
-                       int32_t *pRes,
-                       uint32_t numSamples);
+/**
+   @brief  Glue code for the 16-bit fixed-point IMDCT with overlap-add of the coefficients of
+   plp_mdct_q16, scaled by 1/(2M), to unscaled output samples.
+   @param[in,out] S       points to the instance
+   @param[in]   pSrc    points to the M coefficients in Q15
+   @param[in]   pBuf    points to a work buffer of M values, word aligned
+   @param[out]  pDst    points to the M output samples in Q15
+   @return      none
+*/
+void plp_imdct_q16(plp_mdct_instance_q16 *S,
+                   const int16_t *__restrict__ pSrc,
+                   int16_t *__restrict__ pBuf,
+                   int16_t *__restrict__ pDst);
 
 /**
- * @brief      complex magnitude for q32 on RV32IM
- *
- * @param[in]  pSrc        pointer to source
- * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief  Glue code for the 16-bit fixed-point IMDCT (parallel version).
+   @param[in,out] S       points to the instance
+   @param[in]   pSrc    points to the M coefficients in Q15
+   @param[in]   nPE     number of parallel processing units
+   @param[in]   pBuf    points to a work buffer of M values, word aligned
+   @param[out]  pDst    points to the M output samples in Q15
+   @return      none
+*/
+void plp_imdct_q16_parallel(plp_mdct_instance_q16 *S,
+                            const int16_t *__restrict__ pSrc,
+                            uint32_t nPE,
+                            int16_t *__restrict__ pBuf,
+                            int16_t *__restrict__ pDst);
 
-void plp_cmplx_mag_q32s_rv32im(const int32_t *pSrc,
-                               const uint32_t fracBits,
-                               int32_t *pRes,
-                               uint32_t numSamples);
+/**
+   @brief  16-bit fixed-point IMDCT for RV32IM.
+   @param[in,out] S       points to the instance
+   @param[in]   pSrc    points to the M coefficients in Q15
+   @param[in]   pBuf    points to a work buffer of M values, word aligned
+   @param[out]  pDst    points to the M output samples in Q15
+   @return      none
+*/
+void plp_imdct_q16s_rv32im(plp_mdct_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *__restrict__ pDst);
 
 /**
- * @brief      complex magnitude for q32 on XPULPV2
- *
- * @param[in]  pSrc        pointer to source
- * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief  16-bit fixed-point IMDCT for XPULPV2 extension.
+   @param[in,out] S       points to the instance
+   @param[in]   pSrc    points to the M coefficients in Q15
+   @param[in]   pBuf    points to a work buffer of M values, word aligned
+   @param[out]  pDst    points to the M output samples in Q15
+   @return      none
+*/
+void plp_imdct_q16s_xpulpv2(plp_mdct_instance_q16 *S,
+                            const int16_t *__restrict__ pSrc,
+                            int16_t *__restrict__ pBuf,
+                            int16_t *__restrict__ pDst);
 
-void plp_cmplx_mag_q32s_xpulpv2(const int32_t *pSrc,
-                                const uint32_t fracBits,
-                                int32_t *pRes,
-                                uint32_t numSamples);
+/**
+   @brief  16-bit fixed-point IMDCT for XPULPV2 extension (parallel version).
+   @param[in]   args    points to a plp_mdct_instance_q16_parallel
+   @return      none
+*/
+void plp_imdct_q16p_xpulpv2(void *args);
 
 /**
- * @brief      Glue code for complex magnitude calculation for 8 bit fixpoint
- *
- * @param[in]  pSrc        pointer to source
- * @param[in]  fracBits    fractional bits -> Q(8-fracBits).fracBits
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief Floating-point mel filterbank energies of a complex spectrum. The squared magnitude of
+   each bin is computed while it is accumulated into the filters, without storing the power
+   spectrum.
+   @param[in]   filterBank  points to plp_triangular_filter_f32 instance
+   @param[in]   pSrc        points to the complex spectrum, e.g., the output of plp_rfft_f32
+   @param[out]  pDst        points to the nFilters energies
+   @return      none
+*/
+void plp_mel_fbank_f32(const plp_triangular_filter_f32 *filterBank,
+                       const float32_t *__restrict__ pSrc,
+                       float32_t *__restrict__ pDst);
 
-void plp_cmplx_mag_q8(const int8_t *pSrc,
-                       const uint32_t fracBits,
-                       int8_t *pRes,
-                       uint32_t numSamples);
+/**
+   @brief Parallel floating-point mel filterbank energies of a complex spectrum, distributing the
+   filters across the cores.
+   @param[in]   filterBank  points to plp_triangular_filter_f32 instance
+   @param[in]   pSrc        points to the complex spectrum, e.g., the output of plp_rfft_f32
+   @param[in]   nPE         number of parallel processing units
+   @param[out]  pDst        points to the nFilters energies
+   @return      none
+*/
+void plp_mel_fbank_f32_parallel(const plp_triangular_filter_f32 *filterBank,
+                                const float32_t *__restrict__ pSrc,
+                                uint32_t nPE,
+                                float32_t *__restrict__ pDst);
 
 /**
- * @brief      complex magnitude for q8 on RV32IM
- *
- * @param[in]  pSrc        pointer to source
- * @param[in]  fracBits    fractional bits -> Q(8-fracBits).fracBits
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief Floating-point mel filterbank energies for XPULPV2 extension.
+   @param[in]   filterBank  points to plp_triangular_filter_f32 instance
+   @param[in]   pSrc        points to the complex spectrum
+   @param[out]  pDst        points to the nFilters energies
+   @return      none
+*/
+void plp_mel_fbank_f32s_xpulpv2(const plp_triangular_filter_f32 *filterBank,
+                                const float32_t *__restrict__ pSrc,
+                                float32_t *__restrict__ pDst);
 
-void plp_cmplx_mag_q8s_rv32im(const int8_t *pSrc,
-                               const uint32_t fracBits,
-                               int8_t *pRes,
-                               uint32_t numSamples);
+/**
+   @brief Floating-point mel filterbank energies for XPULPV2 extension (parallel version).
+   @param[in]   args  points to the plp_mel_fbank_instance_f32_parallel
+   @return      none
+*/
+void plp_mel_fbank_f32p_xpulpv2(void *args);
+
+/**
+   @brief 16-bit fixed-point mel filterbank energies of a complex spectrum. The squared magnitude
+   of each bin is computed while it is accumulated into the filters, in 64 bits.
+   @param[in]   filterBank  points to plp_triangular_filter_q16 instance
+   @param[in]   pSrc        points to the complex spectrum in Q15, e.g., the output of
+                            plp_rfft_q16
+   @param[out]  pDst        points to the nFilters energies in Q31, saturated
+   @return      none
+*/
+void plp_mel_fbank_q16(const plp_triangular_filter_q16 *filterBank,
+                       const int16_t *__restrict__ pSrc,
+                       int32_t *__restrict__ pDst);
+
+/**
+   @brief Parallel 16-bit fixed-point mel filterbank energies of a complex spectrum, distributing
+   the filters across the cores.
+   @param[in]   filterBank  points to plp_triangular_filter_q16 instance
+   @param[in]   pSrc        points to the complex spectrum in Q15
+   @param[in]   nPE         number of parallel processing units
+   @param[out]  pDst        points to the nFilters energies in Q31, saturated
+   @return      none
+*/
+void plp_mel_fbank_q16_parallel(const plp_triangular_filter_q16 *filterBank,
+                                const int16_t *__restrict__ pSrc,
+                                uint32_t nPE,
+                                int32_t *__restrict__ pDst);
 
 /**
- * @brief      complex magnitude for q8 on XPULPV2
- *
- * @param[in]  pSrc        pointer to source
- * @param[in]  fracBits    fractional bits -> Q(8-fracBits).fracBits
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
-
-void plp_cmplx_mag_q8s_xpulpv2(const int8_t *pSrc,
-                                const uint32_t fracBits,
-                                int8_t *pRes,
-                                uint32_t numSamples);
+   @brief 16-bit fixed-point mel filterbank energies for RV32IM extension.
+   @param[in]   filterBank  points to plp_triangular_filter_q16 instance
+   @param[in]   pSrc        points to the complex spectrum in Q15
+   @param[out]  pDst        points to the nFilters energies in Q31
+   @return      none
+*/
+void plp_mel_fbank_q16s_rv32im(const plp_triangular_filter_q16 *filterBank,
+                               const int16_t *__restrict__ pSrc,
+                               int32_t *__restrict__ pDst);
 
 /**
- * @brief      Glue code for complex magnitude calculation in 16-bit integer
- *
- * @param[in]  pSrc        pointer to source
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief 16-bit fixed-point mel filterbank energies for XPULPV2 extension.
+   @param[in]   filterBank  points to plp_triangular_filter_q16 instance
+   @param[in]   pSrc        points to the complex spectrum in Q15
+   @param[out]  pDst        points to the nFilters energies in Q31
+   @return      none
+*/
+void plp_mel_fbank_q16s_xpulpv2(const plp_triangular_filter_q16 *filterBank,
+                                const int16_t *__restrict__ pSrc,
+                                int32_t *__restrict__ pDst);
 
-void plp_cmplx_mag_i16(const int16_t *pSrc,
-                       int16_t *pRes,
-                       uint32_t numSamples);
+/**
+   @brief 16-bit fixed-point mel filterbank energies for XPULPV2 extension (parallel version).
+   @param[in]   args  points to the plp_mel_fbank_instance_q16_parallel
+   @return      none
+*/
+void plp_mel_fbank_q16p_xpulpv2(void *args);
 
 /**
- * @brief      complex magnitude for i16 on RV32IM
- *
- * @param[in]  pSrc        pointer to source
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief MFCC on real input data.
+   @param[in]   SFFT        points to an instance of the floating-point FFT
+                            structure for the initial FFT (with FFTLength = n_fft).
+                            bitReverseFlag should be on.
+   @param[in]   SDCT        points to an instance of the floating-point FFT
+                            structure for the DCT (with FFTLength = n_mels).
+                            bitReverseFlag should be on.
+   @param[in]   pShift      points to twiddle coefficient table with
+                            FFTLength = 4*n_mels. Only first quarter necessary.
+   @param[in]   filterBank  points to plp_triangular_filter_f32 instance with 
+                            nFilters = n_mels.
+   @param[in]   window      vector to use for windowing
+   @param[in]   orthoNorm   whether to use dct orthonormalisation or not
+   @param[in]   pSrc        points to the input buffer (real data, size n_fft)
+   @param[out]  pDst        points to the output buffer 
+                            of length at least 3*n_fft, the minimum for
+                            plp_rfft_f32: 2*n_fft FFT values and the n_fft
+                            windowed samples. pSrc and pDst must not overlap, the
+                            calculation can not be done in place.
+                            MFCCs are returned in the first n_mels spots.
+   @return      none
+*/
 
-void plp_cmplx_mag_i16s_rv32im(const int16_t *pSrc,
-                               int16_t *pRes,
-                               uint32_t numSamples);
+
+void plp_mfcc_f32(const plp_fft_instance_f32 *SFFT,
+                  const plp_fft_instance_f32 *SDCT,
+                  const Complex_type_f32 *pShift,
+                  const plp_triangular_filter_f32 *filterBank,
+		  const float32_t *window,
+		  const uint8_t *orthoNorm,
+                  const float32_t *__restrict__ pSrc,
+                  float32_t *__restrict__ pDst);
 
 /**
- * @brief      complex magnitude for i16 on XPULPV2
- *
- * @param[in]  pSrc        pointer to source
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief MFCC on real input data.
+   @param[in]   SFFT        points to an instance of the floating-point FFT
+                            structure for the initial FFT (with FFTLength = n_fft).
+                            bitReverseFlag should be on.
+   @param[in]   SDCT        points to an instance of the floating-point FFT
+                            structure for the DCT (with FFTLength = n_mels).
+                            bitReverseFlag should be on.
+   @param[in]   pShift      points to twiddle coefficient table with
+                            FFTLength = 4*n_mels. Only first quarter necessary.
+   @param[in]   filterBank  points to plp_triangular_filter_f32 instance with 
+                            nFilters = n_mels.
+   @param[in]   window      vector to use for windowing
+   @param[in]   orthoNorm   whether to use dct orthonormalisation or not
+   @param[in]   pSrc        points to the input buffer (real data, size n_fft)
+   @param[in]   nPE         number of parallel processing units
+   @param[out]  pDst        points to the output buffer 
+                            of length at least 3*n_fft, the minimum for
+                            plp_rfft_f32: 2*n_fft FFT values and the n_fft
+                            windowed samples. pSrc and pDst must not overlap, the
+                            calculation can not be done in place.
+                            MFCCs are returned in the first n_mels spots.
+   @return      none
+*/
 
-void plp_cmplx_mag_i16s_xpulpv2(const int16_t *pSrc,
-                                int16_t *pRes,
-                                uint32_t numSamples);
+
+void plp_mfcc_f32_parallel(const plp_fft_instance_f32 *SFFT,
+                	   const plp_fft_instance_f32 *SDCT,
+                	   const Complex_type_f32 *pShift,
+                	   const plp_triangular_filter_f32 *filterBank,
+			   const float32_t *window,
+			   const uint8_t *orthoNorm,
+                	   const float32_t *__restrict__ pSrc,
+			   const uint32_t nPE,
+                	   float32_t *__restrict__ pDst);
 
 /**
- * @brief      Glue code for complex magnitude calculation in 32-bit integer
- *
- * @param[in]  pSrc        pointer to source
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief 16-bit fixed-point MFCC on real input data.
+   @param[in]   SFFT        points to an instance of the 16-bit real FFT
+                            structure (with fftLenReal = n_fft).
+   @param[in]   filterBank  points to plp_triangular_filter_q16 instance with
+                            nFilters = n_mels, at most n_fft/2.
+   @param[in]   window      vector to use for windowing, in Q15
+   @param[in]   pDctCoefs   points to the nDct x n_mels DCT matrix in Q15, row major,
+                            with coefficients of at most 1 in magnitude (e.g. the
+                            orthonormal DCT-II)
+   @param[in]   nDct        number of MFCCs
+   @param[in]   pSrc        points to the input buffer (real data in Q15, size n_fft)
+   @param[in]   pBuffer     points to a word aligned buffer of 2*n_fft + 2 values
+   @param[out]  pDst        points to the nDct MFCCs in Q7, saturated
+   @return      none
+*/
+void plp_mfcc_q16(const plp_rfft_instance_q16 *SFFT,
+                  const plp_triangular_filter_q16 *filterBank,
+                  const int16_t *window,
+                  const int16_t *pDctCoefs,
+                  uint32_t nDct,
+                  const int16_t *__restrict__ pSrc,
+                  int16_t *__restrict__ pBuffer,
+                  int16_t *__restrict__ pDst);
+
+/**
+   @brief Parallel 16-bit fixed-point MFCC on real input data.
+   @param[in]   SFFT        points to an instance of the 16-bit real FFT
+                            structure (with fftLenReal = n_fft).
+   @param[in]   filterBank  points to plp_triangular_filter_q16 instance with
+                            nFilters = n_mels, at most n_fft/2.
+   @param[in]   window      vector to use for windowing, in Q15
+   @param[in]   pDctCoefs   points to the nDct x n_mels DCT matrix in Q15, row major,
+                            with coefficients of at most 1 in magnitude (e.g. the
+                            orthonormal DCT-II)
+   @param[in]   nDct        number of MFCCs
+   @param[in]   pSrc        points to the input buffer (real data in Q15, size n_fft)
+   @param[in]   nPE         number of parallel processing units
+   @param[in]   pBuffer     points to a word aligned buffer of 2*n_fft + 2 values
+   @param[out]  pDst        points to the nDct MFCCs in Q7, saturated
+   @return      none
+*/
+void plp_mfcc_q16_parallel(const plp_rfft_instance_q16 *SFFT,
+                           const plp_triangular_filter_q16 *filterBank,
+                           const int16_t *window,
+                           const int16_t *pDctCoefs,
+                           uint32_t nDct,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t nPE,
+                           int16_t *__restrict__ pBuffer,
+                           int16_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix addition of a 32-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
 
-void plp_cmplx_mag_i32(const int32_t *pSrc,
-                       int32_t *pRes,
-                       uint32_t numSamples);
 
 /**
- * @brief      complex magnitude for i32 on RV32IM
- *
- * @param[in]  pSrc        pointer to source
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief  Floating-point DWT on real input data for XPULPV2 extension.
+   @param[in]   pSrc     points to the input buffer (real data)
+   @param[in]   length   length of input buffer
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @param[in]   mode     boundary extension mode
+
+   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
+   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @return      none
+*/
+void plp_dwt_f32(const float32_t *__restrict__ pSrc,
+                  uint32_t length,
+                  const plp_dwt_wavelet_f32 wavelet,
+                  plp_dwt_extension_mode mode,
+                  float32_t *__restrict__ pDstA,
+                  float32_t *__restrict__ pDstD);
 
-void plp_cmplx_mag_i32s_rv32im(const int32_t *pSrc,
-                               int32_t *pRes,
-                               uint32_t numSamples);
 
 /**
- * @brief      complex magnitude for i32 on XPULPV2
- *
- * @param[in]  pSrc        pointer to source
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief  32bit Fixed-point DWT  for XPULPV2 extension.
+   @param[in]   pSrc     points to the input buffer (real data)
+   @param[in]   length   length of input buffer
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @param[in]   mode     boundary extension mode
+
+   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
+   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @return      none
+*/
+void plp_dwt_q32(const int32_t *__restrict__ pSrc,
+                  uint32_t length,
+                  const plp_dwt_wavelet_q32 wavelet,
+                  plp_dwt_extension_mode mode,
+                  int32_t *__restrict__ pDstA,
+                  int32_t *__restrict__ pDstD);
 
-void plp_cmplx_mag_i32s_xpulpv2(const int32_t *pSrc,
-                                int32_t *pRes,
-                                uint32_t numSamples);
 
 /**
- * @brief      Glue code for complex magnitude calculation in 8-bit integer
- *
- * @param[in]  pSrc        pointer to source
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief  16bit Fixed-point DWT for XPULPV2 extension.
+   @param[in]   pSrc     points to the input buffer (real data)
+   @param[in]   length   length of input buffer
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @param[in]   mode     boundary extension mode
 
-void plp_cmplx_mag_i8(const int8_t *pSrc,
-                      int8_t *pRes,
-                      uint32_t numSamples);
+   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
+   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @return      none
+*/
+void plp_dwt_q16(const int16_t *__restrict__ pSrc,
+                  uint32_t length,
+                  const plp_dwt_wavelet_q16 wavelet,
+                  plp_dwt_extension_mode mode,
+                  int16_t *__restrict__ pDstA,
+                  int16_t *__restrict__ pDstD);
 
 /**
- * @brief      complex magnitude for i8 on RV32IM
- *
- * @param[in]  pSrc        pointer to source
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief  8bit Fixed-point DWT for XPULPV2 extension.
+   @param[in]   pSrc     points to the input buffer (real data)
+   @param[in]   length   length of input buffer
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @param[in]   mode     boundary extension mode
+
+   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
+   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @return      none
+*/
+void plp_dwt_q8(const int8_t *__restrict__ pSrc,
+                  uint32_t length,
+                  const plp_dwt_wavelet_q8 wavelet,
+                  plp_dwt_extension_mode mode,
+                  int8_t *__restrict__ pDstA,
+                  int8_t *__restrict__ pDstD);
 
-void plp_cmplx_mag_i8s_rv32im(const int8_t *pSrc,
-                              int8_t *pRes,
-                              uint32_t numSamples);
 
 /**
- * @brief      complex magnitude for i8 on XPULPV2
- *
- * @param[in]  pSrc        pointer to source
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number samples
- */
+   @brief  Floating-point n-level DWT for XPULPV2 extension.
+   @param[in]   pSrc     points to the input buffer (real data)
+   @param[in]   length   length of input buffer
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @param[in]   mode     boundary extension mode
+   @param[in]   level    Levels of Wavelet decomposition
 
-void plp_cmplx_mag_i8s_xpulpv2(const int8_t *pSrc,
-                               int8_t *pRes,
-                               uint32_t numSamples);
+   @param[out]  pDst     points to ouput buffer with Detailed coefficients and final approximate
+   @return      none
+*/
+void plp_dwt_dec_f32(const float32_t *__restrict__ pSrc,
+                     uint32_t length,
+                     const plp_dwt_wavelet_f32 wavelet,
+                     plp_dwt_extension_mode mode,
+                     uint32_t level,
+                     float32_t *__restrict__ pTmp,
+                     float32_t *__restrict__ pDst);
 
 /**
- * @brief      Glue code for complex magnitude calculation in 16-bit quantized integer
- *
- * @param[in]  pSrc        pointer to source
- * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number of samples
- */
+   @brief  Floating-point parallel n-level DWT for XPULPV2 extension.
+   @param[in]   pSrc     points to the input buffer (real data)
+   @param[in]   length   length of input buffer
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @param[in]   mode     boundary extension mode
+   @param[in]   level    Levels of Wavelet decomposition
 
-void plp_cmplx_mag_q16(const int16_t *pSrc,
-                       const uint32_t fracBits,
-                       int16_t *pRes,
-                       uint32_t numSamples);
+   @param[out]  pDst     points to ouput buffer with Detailed coefficients and final approximate
+   @return      none
+*/
+void plp_dwt_dec_f32_parallel(const float32_t *__restrict__ pSrc,
+                     uint32_t length,
+                     const plp_dwt_wavelet_f32 wavelet,
+                     plp_dwt_extension_mode mode,
+                     uint32_t level,
+                     uint32_t nPE,
+                     float32_t *__restrict__ pTemp,
+                     float32_t *__restrict__ pDst);
 
 /**
- * @brief      complex magnitude for q16 on RV32IM
- *
- * @param[in]  pSrc        pointer to source
- * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number of samples
- */
+   @brief  Floating-point n-level DWT streamed through L1 in a single pass.
+   @param[in]   pSrc     points to the input buffer (L2)
+   @param[in]   length   length of input buffer
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @param[in]   mode     boundary extension mode
+   @param[in]   level    Levels of Wavelet decomposition
+   @param[in]   nPE      Number of cores to use
 
-void plp_cmplx_mag_q16s_rv32im(const int16_t *pSrc,
-                               const uint32_t fracBits,
-                               int16_t *pRes,
-                               uint32_t numSamples);
+   @param[out]  pDst     points to ouput buffer with Detailed coefficients and final approximate
+   @return      none
+*/
+void plp_dwt_dec_f32_stream(const float32_t *__restrict__ pSrc,
+                     uint32_t length,
+                     const plp_dwt_wavelet_f32 wavelet,
+                     plp_dwt_extension_mode mode,
+                     uint32_t level,
+                     uint32_t nPE,
+                     float32_t *__restrict__ pDst);
 
 /**
- * @brief      complex magnitude for q16 on XPULPV2
- *
- * @param[in]  pSrc        pointer to source
- * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
- * @param      pRes        pointer to result
- * @param[in]  numSamples  The number of samples
- */
+   @brief  Floating-point DWT on real input data for XPULPV2 extension.
+   @param[in]   pSrc     points to the input buffer (real data)
+   @param[in]   length   length of input buffer
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @param[in]   mode     boundary extension mode
 
-void plp_cmplx_mag_q16s_xpulpv2(const int16_t *pSrc,
-                                const uint32_t fracBits,
-                                int16_t *pRes,
-                                uint32_t numSamples);
+   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
+   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @return      none
+*/
+void plp_dwt_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                  uint32_t length,
+                  const plp_dwt_wavelet_f32 wavelet,
+                  plp_dwt_extension_mode mode,
+                  float32_t *__restrict__ pDstA,
+                  float32_t *__restrict__ pDstD);
 
 /**
-  @brief      In-place 16 bit reversal function for RV32IM
-  @param[in,out] pSrc        points to in-place buffer of unknown 16-bit data type
-  @param[in]  bitRevLen   bit reversal table length
-  @param[in]  pBitRevTab  points to bit reversal table
-  @return     none
+   @brief  Floating-point DWT kernel optimized for Haar Wavelet on real input data for XPULPV2 extension.
+   @param[in]   pSrc     points to the input buffer (real data)
+   @param[in]   length   length of input buffer
+   @param[in]   mode     boundary extension mode
+
+   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
+   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @return      none
 */
+void plp_dwt_haar_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                         uint32_t length,
+                         plp_dwt_extension_mode mode,
+                         float32_t *__restrict__ pDstA,
+                         float32_t *__restrict__ pDstD);
 
-void plp_bitreversal_16s_rv32im(uint16_t *pSrc,
-                                const uint16_t bitRevLen,
-                                const uint16_t *pBitRevTab);
 
-/**
-  @brief      In-place 16 bit reversal function for XPULPV2
-  @param[in,out] pSrc        points to in-place buffer of unknown 16-bit data type
-  @param[in]  bitRevLen   bit reversal table length
-  @param[in]  pBitRevTab  points to bit reversal table
-  @return     none
-*/
 
-void plp_bitreversal_16s_xpulpv2(uint16_t *pSrc,
-                                 const uint16_t bitRevLen,
-                                 const uint16_t *pBitRevTab);
 
 /**
-  @brief         In-place 16 bit reversal function.
-  @param[in,out] pSrc        points to in-place buffer of unknown 16-bit data type
-  @param[in]     bitRevLen   bit reversal table length
-  @param[in]     pBitRevTab  points to bit reversal table
-  @param[in]     nPE         number of cores
-  @return        none
-*/
+   @brief  32bit Fixed-point DWT for XPULPV2 extension.
+   @param[in]   pSrc     points to the input buffer (real data)
+   @param[in]   length   length of input buffer
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @param[in]   mode     boundary extension mode
 
-void plp_bitreversal_16p_xpulpv2(uint16_t *pSrc,
-                                 const uint16_t bitRevLen,
-                                 const uint16_t *pBitRevTab,
-                                 uint32_t nPE);
+   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
+   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @return      none
+*/
+void plp_dwt_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                  uint32_t length,
+                  const plp_dwt_wavelet_q32 wavelet,
+                  plp_dwt_extension_mode mode,
+                  int32_t *__restrict__ pDstA,
+                  int32_t *__restrict__ pDstD);
 
 /**
- * @brief      Glue code for quantized 16 bit complex fast fourier transform
- *
- * Fixed point units input -> output dependent on length:
- * len=16:    Q1.15 -> Q5.11
- * len=32:    Q1.15 -> Q6.10
- * len=64:    Q1.15 -> Q7.9
- * len=128:   Q1.15 -> Q8.8
- * len=256:   Q1.15 -> Q9.7
- * len=512:   Q1.15 -> Q10.6
- * len=1024:  Q1.15 -> Q11.5
- * len=2048:  Q1.15 -> Q12.4
- * len=4096:  Q1.15 -> Q13.3
- *
- * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
- * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
- * Processing occurs in-place.
- * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
- * transform.
- * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
- * (bitReverseFlag=0) bit reversal of output.
- * @param[in]  deciPoint       decimal point for right shift
- */
+   @brief  32bit Fixed-point DWT  kernel optimized for Haar Wavelet on real input data for XPULPV2 extension.
+   @param[in]   pSrc     points to the input buffer (real data)
+   @param[in]   length   length of input buffer
+   @param[in]   mode     boundary extension mode
 
-void plp_cfft_q16(const plp_cfft_instance_q16 *S,
-                  int16_t *p1,
-                  uint8_t ifftFlag,
-                  uint8_t bitReverseFlag,
-                  uint32_t deciPoint);
+   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
+   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @return      none
+*/
+void plp_dwt_haar_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                         uint32_t length,
+                         plp_dwt_extension_mode mode,
+                         int32_t *__restrict__ pDstA,
+                         int32_t *__restrict__ pDstD);
 
-/**
- * @brief      Glue code for quantized 16 bit complex fast fourier transform
- *
- * Fixed point units input -> output dependent on length:
- * len=16:    Q1.15 -> Q5.11
- * len=32:    Q1.15 -> Q6.10
- * len=64:    Q1.15 -> Q7.9
- * len=128:   Q1.15 -> Q8.8
- * len=256:   Q1.15 -> Q9.7
- * len=512:   Q1.15 -> Q10.6
- * len=1024:  Q1.15 -> Q11.5
- * len=2048:  Q1.15 -> Q12.4
- * len=4096:  Q1.15 -> Q13.3
- *
- * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
- * @param[in,out] p1           points to the complex data buffer of size <code>2*fftLen</code>.
- * Processing occurs in-place.
- * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
- * transform.
- * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
- * (bitReverseFlag=0) bit reversal of output.
- * @param[in]  deciPoint       decimal point for right shift
- * @param[in]  nPE             Number of cores to use
- */
 
-void plp_cfft_q16_parallel(const plp_cfft_instance_q16 *S,
-                           int16_t *p1,
-                           uint8_t ifftFlag,
-                           uint8_t bitReverseFlag,
-                           uint32_t deciPoint,
-                           uint32_t nPE);
 
 /**
- * @brief      Quantized 16 bit complex fast fourier transform for RV32IM
- * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
- * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
- * Processing occurs in-place.
- * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
- * transform.
- * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
- * (bitReverseFlag=0) bit reversal of output.
- * @param[in]  deciPoint       decimal point for right shift
- */
+   @brief  16bit Fixed-point DWT for XPULPV2 extension.
+   @param[in]   pSrc     points to the input buffer (real data)
+   @param[in]   length   length of input buffer
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @param[in]   mode     boundary extension mode
 
-void plp_cfft_q16s_rv32im(const plp_cfft_instance_q16 *S,
-                          int16_t *p1,
-                          uint8_t ifftFlag,
-                          uint8_t bitReverseFlag,
-                          uint32_t deciPoint);
+   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
+   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @return      none
+*/
+void plp_dwt_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                  uint32_t length,
+                  const plp_dwt_wavelet_q16 wavelet,
+                  plp_dwt_extension_mode mode,
+                  int16_t *__restrict__ pDstA,
+                  int16_t *__restrict__ pDstD);
 
 /**
- * @brief      Quantized 16 bit complex fast fourier transform for XPULPV2
- * @param[in]  S               points to an instance of the 16bit quantized CFFT structure
- * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
- * Processing occurs in-place.
- * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
- * transform.
- * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
- * (bitReverseFlag=0) bit reversal of output.
- * @param[in]  deciPoint       decimal point for right shift
- */
+   @brief  16bit Fixed-point DWT kernel optimized for Haar Wavelet on real input data for XPULPV2 extension.
+   @param[in]   pSrc     points to the input buffer (real data)
+   @param[in]   length   length of input buffer
+   @param[in]   mode     boundary extension mode
+
+   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
+   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @return      none
+*/
+void plp_dwt_haar_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                         uint32_t length,
+                         plp_dwt_extension_mode mode,
+                         int16_t *__restrict__ pDstA,
+                         int16_t *__restrict__ pDstD);
 
-void plp_cfft_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
-                           int16_t *p1,
-                           uint8_t ifftFlag,
-                           uint8_t bitReverseFlag,
-                           uint32_t deciPoint);
 
 /**
- * @brief      Parallel quantized 16 bit complex fast fourier transform for XPULPV2
- * @param[in]   args    points to the plp_cfft_instance_q16_parallel
- */
+   @brief  8bit Fixed-point DWT for XPULPV2 extension.
+   @param[in]   pSrc     points to the input buffer (real data)
+   @param[in]   length   length of input buffer
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @param[in]   mode     boundary extension mode
 
-void plp_cfft_q16p_xpulpv2(void *args);
+   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
+   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @return      none
+*/
+void plp_dwt_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                  uint32_t length,
+                  const plp_dwt_wavelet_q8 wavelet,
+                  plp_dwt_extension_mode mode,
+                  int8_t *__restrict__ pDstA,
+                  int8_t *__restrict__ pDstD);
 
 /**
-  @brief      In-place 32 bit reversal function for RV32IM
-  @param[in,out] pSrc        points to in-place buffer of unknown 32-bit data type
-  @param[in]  bitRevLen   bit reversal table length
-  @param[in]  pBitRevTab  points to bit reversal table
-  @return     none
+   @brief  8bit Fixed-point DWT kernel optimized for Haar Wavelet on real input data for XPULPV2 extension.
+   @param[in]   pSrc     points to the input buffer (real data)
+   @param[in]   length   length of input buffer
+   @param[in]   mode     boundary extension mode
+
+   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
+   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @return      none
 */
+void plp_dwt_haar_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t length,
+                         plp_dwt_extension_mode mode,
+                         int8_t *__restrict__ pDstA,
+                         int8_t *__restrict__ pDstD);
 
-void plp_bitreversal_32s_rv32im(uint32_t *pSrc, const uint16_t bitRevLen, const uint16_t *pBitRevTab);
 
 /**
-  @brief      In-place 32 bit reversal function for XPULPV2
-  @param[in,out] pSrc        points to in-place buffer of unknown 32-bit data type
-  @param[in]  bitRevLen   bit reversal table length
-  @param[in]  pBitRevTab  points to bit reversal table
-  @return     none
+   @brief  Parallel Floating-point DWT on real input data for XPULPV2 extension.
+   @param[in]   pSrc     points to the input buffer (real data)
+   @param[in]   length   length of input buffer
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @param[in]   mode     boundary extension mode
+   @param[in]   nPE      Number of cores to use
+
+   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
+   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @return      none
 */
+void plp_dwt_f32_parallel(const float32_t *__restrict__ pSrc,
+                 uint32_t length,
+                 const plp_dwt_wavelet_f32 wavelet,
+                 plp_dwt_extension_mode mode,
+                 uint32_t nPE,
+                 float32_t *__restrict__ pDstA,
+                 float32_t *__restrict__ pDstD);
 
-void plp_bitreversal_32s_xpulpv2(uint32_t *pSrc, const uint16_t bitRevLen, const uint16_t *pBitRevTab);
 
 /**
-  @brief      In-place 32 bit reversal function for XPULPV2
-  @param[in,out] pSrc        points to in-place buffer of unknown 32-bit data type
-  @param[in]  bitRevLen   bit reversal table length
-  @param[in]  pBitRevTab  points to bit reversal table
-  @param[in]     nPE         number of cores
-  @return     none
+   @brief  8bit Parallel Fixed-point DWT on real input data for XPULPV2 extension.
+   @param[in]   pSrc     points to the input buffer (q8)
+   @param[in]   length   length of input buffer
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @param[in]   mode     boundary extension mode
+   @param[in]   nPE      Number of cores to use
+
+   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
+   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @return      none
 */
+void plp_dwt_q8_parallel(const int8_t *__restrict__ pSrc,
+                 uint32_t length,
+                 const plp_dwt_wavelet_q8 wavelet,
+                 plp_dwt_extension_mode mode,
+                 uint32_t nPE,
+                 int8_t *__restrict__ pDstA,
+                 int8_t *__restrict__ pDstD);
 
-void plp_bitreversal_32p_xpulpv2(uint32_t *pSrc, const uint16_t bitRevLen, const uint16_t *pBitRevTab, uint32_t nPE);
 
 /**
- * @brief      Glue code for quantized 32-bit complex fast fourier transform
- * 
- * Fixed point units input -> output dependent on length:
- * len=16:    Q1.31 -> Q5.27
- * len=32:    Q1.31 -> Q6.26
- * len=64:    Q1.31 -> Q7.25
- * len=128:   Q1.31 -> Q8.24
- * len=256:   Q1.31 -> Q9.23
- * len=512:   Q1.31 -> Q10.22
- * len=1024:  Q1.31 -> Q11.21
- * len=2048:  Q1.31 -> Q12.20
- * len=4096:  Q1.31 -> Q13.19
- *
- * @param[in]  S               points to an instance of the 32bit quantized CFFT structure
- * @param      p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
- * @param[in]  ifftFlag        flag that selects forwart (ifftFlag=0) or inverse (ifftFlag=1)
- * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
- * (bitReverseFlag=0) bit reversal of output.
- * @param[in]  fracBits        decimal point for right shift (input format Q(32-fracBits).fracBits)
- */
+   @brief  16bit Parallel Fixed-point DWT on real input data for XPULPV2 extension.
+   @param[in]   pSrc     points to the input buffer (q16)
+   @param[in]   length   length of input buffer
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @param[in]   mode     boundary extension mode
+   @param[in]   nPE      Number of cores to use
 
-void plp_cfft_q32(const plp_cfft_instance_q32 *S,
-                      int32_t *p1,
-                      uint8_t ifftFlag,
-                      uint8_t bitReverseFlag,
-                      uint32_t fracBits);
+   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
+   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @return      none
+*/
+void plp_dwt_q16_parallel(const int16_t *__restrict__ pSrc,
+                 uint32_t length,
+                 const plp_dwt_wavelet_q16 wavelet,
+                 plp_dwt_extension_mode mode,
+                 uint32_t nPE,
+                 int16_t *__restrict__ pDstA,
+                 int16_t *__restrict__ pDstD);
 
 /**
- * @brief      Quantized 32-bit complex fast fourier transform for XPULPV2
- *
- * @param[in]  S               points to an instance of the 32bit quantized CFFT structure
- * @param      p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
- * @param[in]  ifftFlag        flag that selects forwart (ifftFlag=0) or inverse (ifftFlag=1)
- * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables (bitReverseFlag=0) bit reversal of output.
- * @param[in]  fracBits        decimal point for right shift (input format Q(32-fracBits).fracBits)
- * @param[in]  nPE             Number of cores to use
- */
+   @brief  32bit Parallel Fixed-point DWT on real input data for XPULPV2 extension.
+   @param[in]   pSrc     points to the input buffer (q32)
+   @param[in]   length   length of input buffer
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @param[in]   mode     boundary extension mode
+   @param[in]   nPE      Number of cores to use
+
+   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
+   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @return      none
+*/
+void plp_dwt_q32_parallel(const int32_t *__restrict__ pSrc,
+                 uint32_t length,
+                 const plp_dwt_wavelet_q32 wavelet,
+                 plp_dwt_extension_mode mode,
+                 uint32_t nPE,
+                 int32_t *__restrict__ pDstA,
+                 int32_t *__restrict__ pDstD);
 
-void plp_cfft_q32_parallel( const plp_cfft_instance_q32 *S,
-                            int32_t *p1,
-                            uint8_t ifftFlag,
-                            uint8_t bitReverseFlag,
-                            uint32_t fracBits,
-                            uint32_t nPE );
 
 /**
- * @brief      Quantized 32-bit complex fast fourier transform for RV32IM
- *
- * @param[in]  S               points to an instance of the 32bit quantized CFFT structure
- * @param      p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
- * @param[in]  ifftFlag        flag that selects forwart (ifftFlag=0) or inverse (ifftFlag=1)
- * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
- * (bitReverseFlag=0) bit reversal of output.
- * @param[in]  fracBits        decimal point for right shift (input format Q(32-fracBits).fracBits)
- */
+   @brief  Floating-point DWT on real input data for XPULPV2 extension.
+   @param[in]   args     points to the plp_dwt_instance_f32
+   @return      none
+*/
+void plp_dwt_f32p_xpulpv2(void *args);
 
-void plp_cfft_q32s_rv32im(const plp_cfft_instance_q32 *S,
-                      int32_t *p1,
-                      uint8_t ifftFlag,
-                      uint8_t bitReverseFlag,
-                      uint32_t fracBits);
 
 /**
- * @brief      Quantized 32-bit complex fast fourier transform for XPULPV2
- *
- * @param[in]  S               points to an instance of the 32bit quantized CFFT structure
- * @param      p1              points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
- * @param[in]  ifftFlag        flag that selects forwart (ifftFlag=0) or inverse (ifftFlag=1)
- * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
- * (bitReverseFlag=0) bit reversal of output.
- * @param[in]  fracBits        decimal point for right shift (input format Q(32-fracBits).fracBits)
- */
+   @brief  Floating-point DWT kernel optimized for Haar Wavelet on real input data for XPULPV2 extension.
+   @param[in]   args     points to the plp_dwt_instance_f32
+   @return      none
+*/
+void plp_dwt_haar_f32p_xpulpv2(void *args);
 
-void plp_cfft_q32s_xpulpv2(const plp_cfft_instance_q32 *S,
-                      int32_t *p1,
-                      uint8_t ifftFlag,
-                      uint8_t bitReverseFlag,
-                      uint32_t fracBits);
 
 /**
- * @brief      Parallel quantized 32 bit complex fast fourier transform for XPULPV2
- * @param[in]   args    points to the plp_cfft_instance_q32_parallel
- */
+   @brief  Floating-point streaming n-level DWT for XPULPV2 extension.
+   @param[in]   args     points to the plp_dwt_dec_stream_instance_f32
+   @return      none
+*/
+void plp_dwt_dec_stream_f32p_xpulpv2(void *args);
 
-void plp_cfft_q32p_xpulpv2(void *args);
 
 /**
-   @brief Floating-point FFT on real input data.
-   @param[in]   S       points to an instance of the floating-point FFT structure
-   @param[in]   pSrc    points to the input buffer (real data)
-   @param[out]  pDst    points to the output buffer (complex data)
+   @brief  Q7 fixed-point DWT for XPULPV2 extension.
+   @param[in]   args     points to the plp_dwt_instance_q8
    @return      none
 */
-void plp_rfft_f32(const plp_fft_instance_f32 *S,
-                  const float32_t *__restrict__ pSrc,
-                  float32_t *__restrict__ pDst);
+void plp_dwt_q8p_xpulpv2(void *args);
+
+
 
 /**
-   @brief Floating-point FFT on real input data (parallel version).
-   @param[in]   S       points to an instance of the floating-point FFT structure
-   @param[in]   pSrc    points to the input buffer (real data)
-   @param[in]   nPE     number of parallel processing units
-   @param[out]  pDst    points to the output buffer (complex data)
+   @brief q7 fixed-point DWT kernel optimized for Haar Wavelet for XPULPV2 extension.
+   @param[in]   args     points to the plp_dwt_instance_q8
    @return      none
 */
-void plp_rfft_f32_parallel(const plp_fft_instance_f32 *S,
-                           const float32_t *__restrict__ pSrc,
-                           const uint32_t nPE,
-                           float32_t *__restrict__ pDst);
+void plp_dwt_haar_q8p_xpulpv2(void *args);
+
+
 
 /**
-   @brief  Floating-point FFT on real input data for XPULPV2 extension.
-   @param[in]   S       points to an instance of the floating-point FFT structure
-   @param[in]   pSrcA   points to the input buffer (real data)
-   @param[out]  pDst    points to the output buffer (complex data)
+   @brief  Q15 fixed-point DWT for XPULPV2 extension.
+   @param[in]   args     points to the plp_dwt_instance_q16
+   @return      none
+*/
+void plp_dwt_q16p_xpulpv2(void *args);
+
+
+/**
+   @brief q15 fixed-point DWT kernel optimized for Haar Wavelet for XPULPV2 extension.
+   @param[in]   args     points to the plp_dwt_instance_q16
+   @return      none
+*/
+void plp_dwt_haar_q16p_xpulpv2(void *args);
+
+/**
+   @brief  Q31 fixed-point DWT on real input data for XPULPV2 extension.
+   @param[in]   args     points to the plp_dwt_instance_q32
    @return      none
 */
-void plp_rfft_f32s_xpulpv2(const plp_fft_instance_f32 *S,
-                          const float32_t *__restrict__ pSrc,
-                          float32_t *__restrict__ pDst);
+void plp_dwt_q32p_xpulpv2(void *arg);
 
 /**
-   @brief  Floating-point FFT on real input data for XPULPV2 extension (parallel version).
-   @param[in]   arg       points to an instance of the floating-point FFT structure
+   @brief  Q31 Fixed-point DWT kernel optimized for Haar Wavelet for XPULPV2 extension.
+   @param[in]   args     points to the plp_dwt_instance_q32
    @return      none
 */
-void plp_rfft_f32p_xpulpv2(void *arg);
+void plp_dwt_haar_q32p_xpulpv2(void *args);
 
 
 
 
 
 /**
-   @brief Floating-point FFT on real input data.
-   @param[in]   S       points to an instance of the floating-point FFT structure
-   @param[in]   pSrc    points to the input buffer (real data)
-   @param[out]  pDst    points to the output buffer (complex data)
+   @brief  32bit Fixed-point DWT.
+   @param[in]   pSrc     points to the input buffer (real data)
+   @param[in]   length   length of input buffer
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @param[in]   mode     boundary extension mode
+
+   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
+   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
    @return      none
 */
-void plp_rfftfast_f32( const plp_fft_fast_instance_f32 *S,
-                        const float32_t *__restrict__ pSrc,
-                        float32_t *__restrict__ pDst);
+void plp_dwt_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                  uint32_t length,
+                  const plp_dwt_wavelet_q32 wavelet,
+                  plp_dwt_extension_mode mode,
+                  int32_t *__restrict__ pDstA,
+                  int32_t *__restrict__ pDstD);
 
 /**
-   @brief Floating-point parallel FFT on real input data.
-   @param[in]   S       points to an instance of the floating-point FFT structure
-   @param[in]   pSrc    points to the input buffer (real data)
-   @param[out]  pDst    points to the output buffer (complex data)
+   @brief  32bit Fixed-point DWT  kernel optimized for Haar Wavelet on real input data.
+   @param[in]   pSrc     points to the input buffer (real data)
+   @param[in]   length   length of input buffer
+   @param[in]   mode     boundary extension mode
+
+   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
+   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
    @return      none
 */
-void plp_rfftfast_f32_parallel( const plp_fft_fast_instance_f32 *S,
-                                 float32_t *__restrict__ pSrc,
-                                 float32_t *__restrict__ pDst,
-                                 const uint32_t nPE);
+void plp_dwt_haar_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t length,
+                         plp_dwt_extension_mode mode,
+                         int32_t *__restrict__ pDstA,
+                         int32_t *__restrict__ pDstD);
+
+
 
 /**
-   @brief  Floating-point FFT on real input data for XPULPV2 extension.
-   @param[in]   S       points to an instance of the floating-point FFT structure
-   @param[in]   pSrcA   points to the input buffer (real data)
-   @param[out]  pDst    points to the output buffer (complex data)
+   @brief  16bit Fixed-point DWT.
+   @param[in]   pSrc     points to the input buffer (real data)
+   @param[in]   length   length of input buffer
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @param[in]   mode     boundary extension mode
+
+   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
+   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
    @return      none
 */
-void plp_rfftfast_f32s_xpulpv2( const plp_fft_fast_instance_f32 *S,
-                                 float32_t *pSrc,
-                                 float32_t *pDst);
+void plp_dwt_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                  uint32_t length,
+                  const plp_dwt_wavelet_q16 wavelet,
+                  plp_dwt_extension_mode mode,
+                  int16_t *__restrict__ pDstA,
+                  int16_t *__restrict__ pDstD);
 
 /**
-   @brief  Floating-point parallel FFT on real input data for XPULPV2 extension.
-   @param[in]   arg       points to an instance of the floating-point FFT structure
+   @brief  16bit Fixed-point DWT kernel optimized for Haar Wavelet on real input data.
+   @param[in]   pSrc     points to the input buffer (real data)
+   @param[in]   length   length of input buffer
+   @param[in]   mode     boundary extension mode
+
+   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
+   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
    @return      none
 */
-void plp_rfftfast_f32p_xpulpv2( void *arg );
+void plp_dwt_haar_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t length,
+                         plp_dwt_extension_mode mode,
+                         int16_t *__restrict__ pDstA,
+                         int16_t *__restrict__ pDstD);
+
 
 /**
-   @brief Floating-point FFT on complex input data.
-   @param[in]   S points to an instance of the floating-point FFT structure
-   @param[in]   pSrc points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
-   @param[in]   ifftFlag flag that selects forwart (ifftFlag=0) or inverse (ifftFlag=1)
-   @param[in]   bitReverseFlag flag that enables (bitReverseFlag=1) of disables (bitReverseFlag=0) bit reversal of output.
+   @brief  8bit Fixed-point DWT.
+   @param[in]   pSrc     points to the input buffer (real data)
+   @param[in]   length   length of input buffer
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @param[in]   mode     boundary extension mode
+
+   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
+   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
    @return      none
 */
-void plp_cfft_f32(  const plp_cfft_instance_f32 *S,
-                    float32_t *pSrc,
-                    uint8_t ifftFlag,
-                    uint8_t bitReverseFlag);
+void plp_dwt_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                  uint32_t length,
+                  const plp_dwt_wavelet_q8 wavelet,
+                  plp_dwt_extension_mode mode,
+                  int8_t *__restrict__ pDstA,
+                  int8_t *__restrict__ pDstD);
 
 /**
-   @brief Floating-point FFT on complex input data (parallel version).
-   @param[in]   S       points to an instance of the floating-point FFT structure
-   @param[in]   pSrc    points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
-   @param[in]   ifftFlag flag that selects forwart (ifftFlag=0) or inverse (ifftFlag=1)
-   @param[in]   bitReverseFlag flag that enables (bitReverseFlag=1) of disables (bitReverseFlag=0) bit reversal of output.
-   @param[in]   nPE     number of parallel processing units
+   @brief  8bit Fixed-point DWT kernel optimized for Haar Wavelet on real input data.
+   @param[in]   pSrc     points to the input buffer (real data)
+   @param[in]   length   length of input buffer
+   @param[in]   mode     boundary extension mode
+
+   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
+   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
    @return      none
 */
-void plp_cfft_f32_parallel( const plp_cfft_instance_f32 *S,
-                            const float32_t *pSrc,
-                            uint8_t ifftFlag,
-                            uint8_t bitReverseFlag,
-                            const uint32_t nPE);
+void plp_dwt_haar_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                         uint32_t length,
+                         plp_dwt_extension_mode mode,
+                         int8_t *__restrict__ pDstA,
+                         int8_t *__restrict__ pDstD);
 
 /**
-   @brief  Floating-point FFT on complex input data for XPULPV2 extension.
-   @param[in]   S       points to an instance of the floating-point FFT structure
-   @param[in]   pSrc    points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
-   @param[in]   ifftFlag flag that selects forwart (ifftFlag=0) or inverse (ifftFlag=1)
-   @param[in]   bitReverseFlag flag that enables (bitReverseFlag=1) of disables (bitReverseFlag=0) bit reversal of output.
+   @brief  Floating-point inverse DWT on real data.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   number of coefficients in each of pSrcA and pSrcD
+   @param[in]   wavelet  wavelet structure used for the decomposition
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
    @return      none
 */
-void plp_cfft_f32s_xpulpv2( const plp_cfft_instance_f32 *S,
-                            const float32_t *pSrc,
-                            uint8_t ifftFlag,
-                            uint8_t bitReverseFlag);
+void plp_idwt_f32(const float32_t *__restrict__ pSrcA,
+                  const float32_t *__restrict__ pSrcD,
+                  uint32_t length,
+                  const plp_dwt_wavelet_f32 wavelet,
+                  float32_t *__restrict__ pDst);
 
 /**
-   @brief  Floating-point FFT on complex input data for XPULPV2 extension (parallel version).
-   @param[in]   arg       points to an instance of the floating-point FFT structure
+   @brief  Parallel Floating-point inverse DWT on real data.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   number of coefficients in each of pSrcA and pSrcD
+   @param[in]   wavelet  wavelet structure used for the decomposition
+   @param[in]   nPE      Number of cores to use
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
    @return      none
 */
-void plp_cfft_f32p_xpulpv2(void *arg);
+void plp_idwt_f32_parallel(const float32_t *__restrict__ pSrcA,
+                  const float32_t *__restrict__ pSrcD,
+                  uint32_t length,
+                  const plp_dwt_wavelet_f32 wavelet,
+                  uint32_t nPE,
+                  float32_t *__restrict__ pDst);
 
 /**
-   @brief Floating-point DCT on real input data. Implementation of
-                        John Makhoul's "A Fast Cosine Transform in One
-                        and Two Dimensions" 1980 IEEE paper.
-   @param[in]   S       points to an instance of the floating-point FFT
-                        structure with FFTLength = DCTLength
-   @param[in]   pShift  points to twiddle coefficient table of 4*FFTLength,
-                        of which only the first quarter is necessary.
-   @param[in]   pSrc    points to the input buffer (real data) of size
-                        FFTLength 
-   @param[out]  pBuf    points to buffer of size 2*FFTLength, used for 
-                        computation.
-   @param[out]  pDst    points to output buffer (real data) of size FFTLength,
-                        may be the same as pSrc.
+   @brief  Floating-point multilevel wavelet reconstruction on real data.
+   @param[in]   pSrc     points to the coefficient buffer [D1 D2 ... DL AL]
+   @param[in]   length   length of the original signal
+   @param[in]   wavelet  orthogonal wavelet structure used for the decomposition
+   @param[in]   level    levels of the decomposition (0 for maximal decomposition)
+   @param[in]   pTemp    points to a temporary buffer of PLP_DWT_OUTPUT_LENGTH(length, wavelet.length) values
+   @param[out]  pDst     points to the output buffer of length values
    @return      none
 */
-void plp_dct2_f32(const plp_fft_instance_f32 *S,
-                  const Complex_type_f32 *pShift,
-                  const uint8_t orthoNorm,
-                  const float32_t *__restrict__ pSrc,
-                  float32_t *__restrict__ pBuf,
-                  float32_t *__restrict__ pDst);
+void plp_dwt_rec_f32(const float32_t *__restrict__ pSrc,
+                     uint32_t length,
+                     const plp_dwt_wavelet_f32 wavelet,
+                     uint32_t level,
+                     float32_t *__restrict__ pTemp,
+                     float32_t *__restrict__ pDst);
 
 /**
-   @brief Floating-point DCT on real input data. Implementation of
-                        John Makhoul's "A Fast Cosine Transform in One
-                        and Two Dimensions" 1980 IEEE paper.
-   @param[in]   S       points to an instance of the floating-point FFT
-                        structure with FFTLength = DCTLength
-   @param[in]   pShift  points to twiddle coefficient table of 4*FFTLength,
-                        of which only the first quarter is necessary.
-   @param[in]   pSrc    points to the input buffer (real data) of size
-                        FFTLength 
-   @param[in]   nPE     number of parallel processing units
-   @param[out]  pBuf    points to buffer of size 2*FFTLength, used for 
-                        computation.
-   @param[out]  pDst    points to output buffer (real data) of size FFTLength,
-                        may be the same as pSrc.
+   @brief  Parallel Floating-point multilevel wavelet reconstruction on real data.
+   @param[in]   pSrc     points to the coefficient buffer [D1 D2 ... DL AL]
+   @param[in]   length   length of the original signal
+   @param[in]   wavelet  orthogonal wavelet structure used for the decomposition
+   @param[in]   level    levels of the decomposition (0 for maximal decomposition)
+   @param[in]   nPE      Number of cores to use
+   @param[in]   pTemp    points to a temporary buffer of PLP_DWT_OUTPUT_LENGTH(length, wavelet.length) values
+   @param[out]  pDst     points to the output buffer of length values
    @return      none
 */
-void plp_dct2_f32_parallel(const plp_fft_instance_f32 *S,
-                  	   const Complex_type_f32 *pShift,
-                  	   const uint8_t orthoNorm,
-                  	   const float32_t *__restrict__ pSrc,
-			   const uint32_t nPE,
-                  	   float32_t *__restrict__ pBuf,
-                  	   float32_t *__restrict__ pDst);
+void plp_dwt_rec_f32_parallel(const float32_t *__restrict__ pSrc,
+                     uint32_t length,
+                     const plp_dwt_wavelet_f32 wavelet,
+                     uint32_t level,
+                     uint32_t nPE,
+                     float32_t *__restrict__ pTemp,
+                     float32_t *__restrict__ pDst);
 
 /**
-   @brief MFCC on real input data.
-   @param[in]   SFFT        points to an instance of the floating-point FFT
-                            structure for the initial FFT (with FFTLength = n_fft).
-                            bitReverseFlag should be on.
-   @param[in]   SDCT        points to an instance of the floating-point FFT
-                            structure for the DCT (with FFTLength = n_mels).
-                            bitReverseFlag should be on.
-   @param[in]   pShift      points to twiddle coefficient table with
-                            FFTLength = 4*n_mels. Only first quarter necessary.
-   @param[in]   filterBank  points to plp_triangular_filter_f32 instance with 
-                            nFilters = n_mels.
-   @param[in]   window      vector to use for windowing
-   @param[in]   orthoNorm   whether to use dct orthonormalisation or not
-   @param[in]   pSrc        points to the input buffer (real data, size n_fft)
-   @param[out]  pDst        points to the output buffer 
-                            of length at least 3*n_fft.
-                            pSrc and pDst must not overlap, the calculation can
-                            not be done in place. 
-                            MFCCs are returned in the first n_mels spots.
+   @brief  Floating-point inverse DWT for XPULPV2 extension.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   length of the output buffer
+   @param[in]   wavelet  orthogonal wavelet structure the coefficients were computed with
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
    @return      none
 */
-
-
-void plp_mfcc_f32(const plp_fft_instance_f32 *SFFT,
-                  const plp_fft_instance_f32 *SDCT,
-                  const Complex_type_f32 *pShift,
-                  const plp_triangular_filter_f32 *filterBank,
-		  const float32_t *window,
-		  const uint8_t *orthoNorm,
-                  const float32_t *__restrict__ pSrc,
+void plp_idwt_f32s_xpulpv2(const float32_t *__restrict__ pSrcA,
+                  const float32_t *__restrict__ pSrcD,
+                  uint32_t length,
+                  const plp_dwt_wavelet_f32 wavelet,
                   float32_t *__restrict__ pDst);
 
-/**
-   @brief MFCC on real input data.
-   @param[in]   SFFT        points to an instance of the floating-point FFT
-                            structure for the initial FFT (with FFTLength = n_fft).
-                            bitReverseFlag should be on.
-   @param[in]   SDCT        points to an instance of the floating-point FFT
-                            structure for the DCT (with FFTLength = n_mels).
-                            bitReverseFlag should be on.
-   @param[in]   pShift      points to twiddle coefficient table with
-                            FFTLength = 4*n_mels. Only first quarter necessary.
-   @param[in]   filterBank  points to plp_triangular_filter_f32 instance with 
-                            nFilters = n_mels.
-   @param[in]   window      vector to use for windowing
-   @param[in]   orthoNorm   whether to use dct orthonormalisation or not
-   @param[in]   pSrc        points to the input buffer (real data, size n_fft)
-   @param[in]   nPE         number of parallel processing units
-   @param[out]  pDst        points to the output buffer 
-                            of length at least 3*n_fft.
-                            pSrc and pDst must not overlap, the calculation can
-                            not be done in place. 
-                            MFCCs are returned in the first n_mels spots.
+/**
+   @brief  Floating-point inverse DWT kernel optimized for Haar Wavelet for XPULPV2 extension.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   length of the output buffer
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
    @return      none
 */
+void plp_idwt_haar_f32s_xpulpv2(const float32_t *__restrict__ pSrcA,
+                       const float32_t *__restrict__ pSrcD,
+                       uint32_t length,
+                       float32_t *__restrict__ pDst);
 
+/**
+   @brief  Parallel Floating-point inverse DWT for XPULPV2 extension.
+   @param[in]   args     points to the plp_idwt_instance_f32
+   @return      none
+*/
+void plp_idwt_f32p_xpulpv2(void *args);
 
-void plp_mfcc_f32_parallel(const plp_fft_instance_f32 *SFFT,
-                	   const plp_fft_instance_f32 *SDCT,
-                	   const Complex_type_f32 *pShift,
-                	   const plp_triangular_filter_f32 *filterBank,
-			   const float32_t *window,
-			   const uint8_t *orthoNorm,
-                	   const float32_t *__restrict__ pSrc,
-			   const uint32_t nPE,
-                	   float32_t *__restrict__ pDst);
+/**
+   @brief  Parallel Floating-point inverse DWT kernel optimized for Haar Wavelet for XPULPV2 extension.
+   @param[in]   args     points to the plp_idwt_instance_f32
+   @return      none
+*/
+void plp_idwt_haar_f32p_xpulpv2(void *args);
 
-/** -------------------------------------------------------
-  @brief      Glue code for matrix addition of a 32-bit integer matrices.
-  @param[in]  pSrcA   Points to the first input matrix
-  @param[in]  pSrcB   Points to the second input matrix
-  @param[in]  M       Height of the matrices
-  @param[in]  N       Width of the matrices
-  @param[out] pDst    Points to the output matrix
-  @return     none
+/**
+   @brief  32bit Fixed-point inverse DWT on real data.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   number of coefficients in each of pSrcA and pSrcD
+   @param[in]   wavelet  wavelet structure used for the decomposition
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
+   @return      none
+*/
+void plp_idwt_q32(const int32_t *__restrict__ pSrcA,
+                  const int32_t *__restrict__ pSrcD,
+                  uint32_t length,
+                  const plp_dwt_wavelet_q32 wavelet,
+                  int32_t *__restrict__ pDst);
+
+/**
+   @brief  Parallel 32bit Fixed-point inverse DWT on real data.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   number of coefficients in each of pSrcA and pSrcD
+   @param[in]   wavelet  wavelet structure used for the decomposition
+   @param[in]   nPE      Number of cores to use
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
+   @return      none
 */
+void plp_idwt_q32_parallel(const int32_t *__restrict__ pSrcA,
+                  const int32_t *__restrict__ pSrcD,
+                  uint32_t length,
+                  const plp_dwt_wavelet_q32 wavelet,
+                  uint32_t nPE,
+                  int32_t *__restrict__ pDst);
 
+/**
+   @brief  32bit Fixed-point multilevel wavelet reconstruction on real data.
+   @param[in]   pSrc     points to the coefficient buffer [D1 D2 ... DL AL]
+   @param[in]   length   length of the original signal
+   @param[in]   wavelet  orthogonal wavelet structure used for the decomposition
+   @param[in]   level    levels of the decomposition (0 for maximal decomposition)
+   @param[in]   pTemp    points to a temporary buffer of PLP_DWT_OUTPUT_LENGTH(length, wavelet.length) values
+   @param[out]  pDst     points to the output buffer of length values
+   @return      none
+*/
+void plp_dwt_rec_q32(const int32_t *__restrict__ pSrc,
+                     uint32_t length,
+                     const plp_dwt_wavelet_q32 wavelet,
+                     uint32_t level,
+                     int32_t *__restrict__ pTemp,
+                     int32_t *__restrict__ pDst);
 
 /**
-   @brief  Floating-point DWT on real input data for XPULPV2 extension.
-   @param[in]   pSrc     points to the input buffer (real data)
-   @param[in]   length   length of input buffer
-   @param[in]   wavelet  wavelet structure for calculating DWT
-   @param[in]   mode     boundary extension mode
+   @brief  Parallel 32bit Fixed-point multilevel wavelet reconstruction on real data.
+   @param[in]   pSrc     points to the coefficient buffer [D1 D2 ... DL AL]
+   @param[in]   length   length of the original signal
+   @param[in]   wavelet  orthogonal wavelet structure used for the decomposition
+   @param[in]   level    levels of the decomposition (0 for maximal decomposition)
+   @param[in]   nPE      Number of cores to use
+   @param[in]   pTemp    points to a temporary buffer of PLP_DWT_OUTPUT_LENGTH(length, wavelet.length) values
+   @param[out]  pDst     points to the output buffer of length values
+   @return      none
+*/
+void plp_dwt_rec_q32_parallel(const int32_t *__restrict__ pSrc,
+                     uint32_t length,
+                     const plp_dwt_wavelet_q32 wavelet,
+                     uint32_t level,
+                     uint32_t nPE,
+                     int32_t *__restrict__ pTemp,
+                     int32_t *__restrict__ pDst);
 
-   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
-   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+/**
+   @brief  Q31 fixed-point inverse DWT for XPULPV2 extension.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   length of the output buffer
+   @param[in]   wavelet  orthogonal wavelet structure the coefficients were computed with
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
    @return      none
 */
-void plp_dwt_f32(const float32_t *__restrict__ pSrc,
+void plp_idwt_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                  const int32_t *__restrict__ pSrcD,
                   uint32_t length,
-                  const plp_dwt_wavelet_f32 wavelet,
-                  plp_dwt_extension_mode mode,
-                  float32_t *__restrict__ pDstA,
-                  float32_t *__restrict__ pDstD);
-
+                  const plp_dwt_wavelet_q32 wavelet,
+                  int32_t *__restrict__ pDst);
 
 /**
-   @brief  32bit Fixed-point DWT  for XPULPV2 extension.
-   @param[in]   pSrc     points to the input buffer (real data)
-   @param[in]   length   length of input buffer
-   @param[in]   wavelet  wavelet structure for calculating DWT
-   @param[in]   mode     boundary extension mode
+   @brief  Q31 fixed-point inverse DWT kernel optimized for Haar Wavelet for XPULPV2 extension.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   length of the output buffer
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
+   @return      none
+*/
+void plp_idwt_haar_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                       const int32_t *__restrict__ pSrcD,
+                       uint32_t length,
+                       int32_t *__restrict__ pDst);
 
-   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
-   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+/**
+   @brief  Q31 fixed-point inverse DWT.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   length of the output buffer
+   @param[in]   wavelet  orthogonal wavelet structure the coefficients were computed with
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
    @return      none
 */
-void plp_dwt_q32(const int32_t *__restrict__ pSrc,
+void plp_idwt_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                  const int32_t *__restrict__ pSrcD,
                   uint32_t length,
                   const plp_dwt_wavelet_q32 wavelet,
-                  plp_dwt_extension_mode mode,
-                  int32_t *__restrict__ pDstA,
-                  int32_t *__restrict__ pDstD);
+                  int32_t *__restrict__ pDst);
 
+/**
+   @brief  Q31 fixed-point inverse DWT kernel optimized for Haar Wavelet.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   length of the output buffer
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
+   @return      none
+*/
+void plp_idwt_haar_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                       const int32_t *__restrict__ pSrcD,
+                       uint32_t length,
+                       int32_t *__restrict__ pDst);
 
 /**
-   @brief  16bit Fixed-point DWT for XPULPV2 extension.
-   @param[in]   pSrc     points to the input buffer (real data)
-   @param[in]   length   length of input buffer
-   @param[in]   wavelet  wavelet structure for calculating DWT
-   @param[in]   mode     boundary extension mode
+   @brief  Parallel Q31 fixed-point inverse DWT for XPULPV2 extension.
+   @param[in]   args     points to the plp_idwt_instance_q32
+   @return      none
+*/
+void plp_idwt_q32p_xpulpv2(void *args);
 
-   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
-   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+/**
+   @brief  Parallel Q31 fixed-point inverse DWT kernel optimized for Haar Wavelet for XPULPV2 extension.
+   @param[in]   args     points to the plp_idwt_instance_q32
    @return      none
 */
-void plp_dwt_q16(const int16_t *__restrict__ pSrc,
+void plp_idwt_haar_q32p_xpulpv2(void *args);
+
+/**
+   @brief  16bit Fixed-point inverse DWT on real data.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   number of coefficients in each of pSrcA and pSrcD
+   @param[in]   wavelet  wavelet structure used for the decomposition
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
+   @return      none
+*/
+void plp_idwt_q16(const int16_t *__restrict__ pSrcA,
+                  const int16_t *__restrict__ pSrcD,
                   uint32_t length,
                   const plp_dwt_wavelet_q16 wavelet,
-                  plp_dwt_extension_mode mode,
-                  int16_t *__restrict__ pDstA,
-                  int16_t *__restrict__ pDstD);
+                  int16_t *__restrict__ pDst);
 
 /**
-   @brief  8bit Fixed-point DWT for XPULPV2 extension.
-   @param[in]   pSrc     points to the input buffer (real data)
-   @param[in]   length   length of input buffer
-   @param[in]   wavelet  wavelet structure for calculating DWT
-   @param[in]   mode     boundary extension mode
-
-   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
-   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @brief  Parallel 16bit Fixed-point inverse DWT on real data.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   number of coefficients in each of pSrcA and pSrcD
+   @param[in]   wavelet  wavelet structure used for the decomposition
+   @param[in]   nPE      Number of cores to use
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
    @return      none
 */
-void plp_dwt_q8(const int8_t *__restrict__ pSrc,
+void plp_idwt_q16_parallel(const int16_t *__restrict__ pSrcA,
+                  const int16_t *__restrict__ pSrcD,
                   uint32_t length,
-                  const plp_dwt_wavelet_q8 wavelet,
-                  plp_dwt_extension_mode mode,
-                  int8_t *__restrict__ pDstA,
-                  int8_t *__restrict__ pDstD);
-
+                  const plp_dwt_wavelet_q16 wavelet,
+                  uint32_t nPE,
+                  int16_t *__restrict__ pDst);
 
 /**
-   @brief  Floating-point n-level DWT for XPULPV2 extension.
-   @param[in]   pSrc     points to the input buffer (real data)
-   @param[in]   length   length of input buffer
-   @param[in]   wavelet  wavelet structure for calculating DWT
-   @param[in]   mode     boundary extension mode
-   @param[in]   level    Levels of Wavelet decomposition
-
-   @param[out]  pDst     points to ouput buffer with Detailed coefficients and final approximate
+   @brief  16bit Fixed-point multilevel wavelet reconstruction on real data.
+   @param[in]   pSrc     points to the coefficient buffer [D1 D2 ... DL AL]
+   @param[in]   length   length of the original signal
+   @param[in]   wavelet  orthogonal wavelet structure used for the decomposition
+   @param[in]   level    levels of the decomposition (0 for maximal decomposition)
+   @param[in]   pTemp    points to a temporary buffer of PLP_DWT_OUTPUT_LENGTH(length, wavelet.length) values
+   @param[out]  pDst     points to the output buffer of length values
    @return      none
 */
-void plp_dwt_dec_f32(const float32_t *__restrict__ pSrc,
+void plp_dwt_rec_q16(const int16_t *__restrict__ pSrc,
                      uint32_t length,
-                     const plp_dwt_wavelet_f32 wavelet,
-                     plp_dwt_extension_mode mode,
+                     const plp_dwt_wavelet_q16 wavelet,
                      uint32_t level,
-                     float32_t *__restrict__ pTmp,
-                     float32_t *__restrict__ pDst);
+                     int16_t *__restrict__ pTemp,
+                     int16_t *__restrict__ pDst);
 
 /**
-   @brief  Floating-point parallel n-level DWT for XPULPV2 extension.
-   @param[in]   pSrc     points to the input buffer (real data)
-   @param[in]   length   length of input buffer
-   @param[in]   wavelet  wavelet structure for calculating DWT
-   @param[in]   mode     boundary extension mode
-   @param[in]   level    Levels of Wavelet decomposition
-
-   @param[out]  pDst     points to ouput buffer with Detailed coefficients and final approximate
+   @brief  Parallel 16bit Fixed-point multilevel wavelet reconstruction on real data.
+   @param[in]   pSrc     points to the coefficient buffer [D1 D2 ... DL AL]
+   @param[in]   length   length of the original signal
+   @param[in]   wavelet  orthogonal wavelet structure used for the decomposition
+   @param[in]   level    levels of the decomposition (0 for maximal decomposition)
+   @param[in]   nPE      Number of cores to use
+   @param[in]   pTemp    points to a temporary buffer of PLP_DWT_OUTPUT_LENGTH(length, wavelet.length) values
+   @param[out]  pDst     points to the output buffer of length values
    @return      none
 */
-void plp_dwt_dec_f32_parallel(const float32_t *__restrict__ pSrc,
+void plp_dwt_rec_q16_parallel(const int16_t *__restrict__ pSrc,
                      uint32_t length,
-                     const plp_dwt_wavelet_f32 wavelet,
-                     plp_dwt_extension_mode mode,
+                     const plp_dwt_wavelet_q16 wavelet,
                      uint32_t level,
                      uint32_t nPE,
-                     float32_t *__restrict__ pTemp,
-                     float32_t *__restrict__ pDst);
+                     int16_t *__restrict__ pTemp,
+                     int16_t *__restrict__ pDst);
 
 /**
-   @brief  Floating-point DWT on real input data for XPULPV2 extension.
-   @param[in]   pSrc     points to the input buffer (real data)
-   @param[in]   length   length of input buffer
-   @param[in]   wavelet  wavelet structure for calculating DWT
-   @param[in]   mode     boundary extension mode
-
-   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
-   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @brief  Q15 fixed-point inverse DWT for XPULPV2 extension.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   length of the output buffer
+   @param[in]   wavelet  orthogonal wavelet structure the coefficients were computed with
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
    @return      none
 */
-void plp_dwt_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+void plp_idwt_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                  const int16_t *__restrict__ pSrcD,
                   uint32_t length,
-                  const plp_dwt_wavelet_f32 wavelet,
-                  plp_dwt_extension_mode mode,
-                  float32_t *__restrict__ pDstA,
-                  float32_t *__restrict__ pDstD);
+                  const plp_dwt_wavelet_q16 wavelet,
+                  int16_t *__restrict__ pDst);
 
 /**
-   @brief  Floating-point DWT kernel optimized for Haar Wavelet on real input data for XPULPV2 extension.
-   @param[in]   pSrc     points to the input buffer (real data)
-   @param[in]   length   length of input buffer
-   @param[in]   mode     boundary extension mode
-
-   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
-   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @brief  Q15 fixed-point inverse DWT kernel optimized for Haar Wavelet for XPULPV2 extension.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   length of the output buffer
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
    @return      none
 */
-void plp_dwt_haar_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
-                         uint32_t length,
-                         plp_dwt_extension_mode mode,
-                         float32_t *__restrict__ pDstA,
-                         float32_t *__restrict__ pDstD);
+void plp_idwt_haar_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                       const int16_t *__restrict__ pSrcD,
+                       uint32_t length,
+                       int16_t *__restrict__ pDst);
 
+/**
+   @brief  Q15 fixed-point inverse DWT.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   length of the output buffer
+   @param[in]   wavelet  orthogonal wavelet structure the coefficients were computed with
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
+   @return      none
+*/
+void plp_idwt_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                  const int16_t *__restrict__ pSrcD,
+                  uint32_t length,
+                  const plp_dwt_wavelet_q16 wavelet,
+                  int16_t *__restrict__ pDst);
 
+/**
+   @brief  Q15 fixed-point inverse DWT kernel optimized for Haar Wavelet.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   length of the output buffer
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
+   @return      none
+*/
+void plp_idwt_haar_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                       const int16_t *__restrict__ pSrcD,
+                       uint32_t length,
+                       int16_t *__restrict__ pDst);
 
+/**
+   @brief  Parallel Q15 fixed-point inverse DWT for XPULPV2 extension.
+   @param[in]   args     points to the plp_idwt_instance_q16
+   @return      none
+*/
+void plp_idwt_q16p_xpulpv2(void *args);
 
 /**
-   @brief  32bit Fixed-point DWT for XPULPV2 extension.
-   @param[in]   pSrc     points to the input buffer (real data)
-   @param[in]   length   length of input buffer
-   @param[in]   wavelet  wavelet structure for calculating DWT
-   @param[in]   mode     boundary extension mode
+   @brief  Parallel Q15 fixed-point inverse DWT kernel optimized for Haar Wavelet for XPULPV2 extension.
+   @param[in]   args     points to the plp_idwt_instance_q16
+   @return      none
+*/
+void plp_idwt_haar_q16p_xpulpv2(void *args);
 
-   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
-   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+/**
+   @brief  8bit Fixed-point inverse DWT on real data.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   number of coefficients in each of pSrcA and pSrcD
+   @param[in]   wavelet  wavelet structure used for the decomposition
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
    @return      none
 */
-void plp_dwt_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+void plp_idwt_q8(const int8_t *__restrict__ pSrcA,
+                  const int8_t *__restrict__ pSrcD,
                   uint32_t length,
-                  const plp_dwt_wavelet_q32 wavelet,
-                  plp_dwt_extension_mode mode,
-                  int32_t *__restrict__ pDstA,
-                  int32_t *__restrict__ pDstD);
+                  const plp_dwt_wavelet_q8 wavelet,
+                  int8_t *__restrict__ pDst);
 
 /**
-   @brief  32bit Fixed-point DWT  kernel optimized for Haar Wavelet on real input data for XPULPV2 extension.
-   @param[in]   pSrc     points to the input buffer (real data)
-   @param[in]   length   length of input buffer
-   @param[in]   mode     boundary extension mode
+   @brief  Parallel 8bit Fixed-point inverse DWT on real data.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   number of coefficients in each of pSrcA and pSrcD
+   @param[in]   wavelet  wavelet structure used for the decomposition
+   @param[in]   nPE      Number of cores to use
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
+   @return      none
+*/
+void plp_idwt_q8_parallel(const int8_t *__restrict__ pSrcA,
+                  const int8_t *__restrict__ pSrcD,
+                  uint32_t length,
+                  const plp_dwt_wavelet_q8 wavelet,
+                  uint32_t nPE,
+                  int8_t *__restrict__ pDst);
 
-   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
-   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+/**
+   @brief  8bit Fixed-point multilevel wavelet reconstruction on real data.
+   @param[in]   pSrc     points to the coefficient buffer [D1 D2 ... DL AL]
+   @param[in]   length   length of the original signal
+   @param[in]   wavelet  orthogonal wavelet structure used for the decomposition
+   @param[in]   level    levels of the decomposition (0 for maximal decomposition)
+   @param[in]   pTemp    points to a temporary buffer of PLP_DWT_OUTPUT_LENGTH(length, wavelet.length) values
+   @param[out]  pDst     points to the output buffer of length values
    @return      none
 */
-void plp_dwt_haar_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                         uint32_t length,
-                         plp_dwt_extension_mode mode,
-                         int32_t *__restrict__ pDstA,
-                         int32_t *__restrict__ pDstD);
+void plp_dwt_rec_q8(const int8_t *__restrict__ pSrc,
+                     uint32_t length,
+                     const plp_dwt_wavelet_q8 wavelet,
+                     uint32_t level,
+                     int8_t *__restrict__ pTemp,
+                     int8_t *__restrict__ pDst);
 
+/**
+   @brief  Parallel 8bit Fixed-point multilevel wavelet reconstruction on real data.
+   @param[in]   pSrc     points to the coefficient buffer [D1 D2 ... DL AL]
+   @param[in]   length   length of the original signal
+   @param[in]   wavelet  orthogonal wavelet structure used for the decomposition
+   @param[in]   level    levels of the decomposition (0 for maximal decomposition)
+   @param[in]   nPE      Number of cores to use
+   @param[in]   pTemp    points to a temporary buffer of PLP_DWT_OUTPUT_LENGTH(length, wavelet.length) values
+   @param[out]  pDst     points to the output buffer of length values
+   @return      none
+*/
+void plp_dwt_rec_q8_parallel(const int8_t *__restrict__ pSrc,
+                     uint32_t length,
+                     const plp_dwt_wavelet_q8 wavelet,
+                     uint32_t level,
+                     uint32_t nPE,
+                     int8_t *__restrict__ pTemp,
+                     int8_t *__restrict__ pDst);
 
+/**
+   @brief  Q7 fixed-point inverse DWT for XPULPV2 extension.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   length of the output buffer
+   @param[in]   wavelet  orthogonal wavelet structure the coefficients were computed with
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
+   @return      none
+*/
+void plp_idwt_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                  const int8_t *__restrict__ pSrcD,
+                  uint32_t length,
+                  const plp_dwt_wavelet_q8 wavelet,
+                  int8_t *__restrict__ pDst);
 
 /**
-   @brief  16bit Fixed-point DWT for XPULPV2 extension.
-   @param[in]   pSrc     points to the input buffer (real data)
-   @param[in]   length   length of input buffer
-   @param[in]   wavelet  wavelet structure for calculating DWT
-   @param[in]   mode     boundary extension mode
+   @brief  Q7 fixed-point inverse DWT kernel optimized for Haar Wavelet for XPULPV2 extension.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   length of the output buffer
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
+   @return      none
+*/
+void plp_idwt_haar_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                       const int8_t *__restrict__ pSrcD,
+                       uint32_t length,
+                       int8_t *__restrict__ pDst);
 
-   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
-   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+/**
+   @brief  Q7 fixed-point inverse DWT.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   length of the output buffer
+   @param[in]   wavelet  orthogonal wavelet structure the coefficients were computed with
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
    @return      none
 */
-void plp_dwt_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+void plp_idwt_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                  const int8_t *__restrict__ pSrcD,
                   uint32_t length,
-                  const plp_dwt_wavelet_q16 wavelet,
-                  plp_dwt_extension_mode mode,
-                  int16_t *__restrict__ pDstA,
-                  int16_t *__restrict__ pDstD);
+                  const plp_dwt_wavelet_q8 wavelet,
+                  int8_t *__restrict__ pDst);
 
 /**
-   @brief  16bit Fixed-point DWT kernel optimized for Haar Wavelet on real input data for XPULPV2 extension.
-   @param[in]   pSrc     points to the input buffer (real data)
-   @param[in]   length   length of input buffer
-   @param[in]   mode     boundary extension mode
+   @brief  Q7 fixed-point inverse DWT kernel optimized for Haar Wavelet.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   length of the output buffer
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
+   @return      none
+*/
+void plp_idwt_haar_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                       const int8_t *__restrict__ pSrcD,
+                       uint32_t length,
+                       int8_t *__restrict__ pDst);
 
-   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
-   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+/**
+   @brief  Parallel Q7 fixed-point inverse DWT for XPULPV2 extension.
+   @param[in]   args     points to the plp_idwt_instance_q8
    @return      none
 */
-void plp_dwt_haar_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                         uint32_t length,
-                         plp_dwt_extension_mode mode,
-                         int16_t *__restrict__ pDstA,
-                         int16_t *__restrict__ pDstD);
+void plp_idwt_q8p_xpulpv2(void *args);
 
+/**
+   @brief  Parallel Q7 fixed-point inverse DWT kernel optimized for Haar Wavelet for XPULPV2 extension.
+   @param[in]   args     points to the plp_idwt_instance_q8
+   @return      none
+*/
+void plp_idwt_haar_q8p_xpulpv2(void *args);
 
 /**
-   @brief  8bit Fixed-point DWT for XPULPV2 extension.
-   @param[in]   pSrc     points to the input buffer (real data)
-   @param[in]   length   length of input buffer
+   @brief  Floating-point 2D DWT of an image.
+   @param[in]   pSrc     points to the input image, row major (L2)
+   @param[in]   rows     number of rows of the image
+   @param[in]   cols     number of columns of the image
    @param[in]   wavelet  wavelet structure for calculating DWT
    @param[in]   mode     boundary extension mode
-
-   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
-   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @param[in]   pBuffer  points to a buffer of PLP_DWT2D_BUFFER_LENGTH(rows, cols, wavelet.length) values (L1)
+   @param[in]   pTemp    points to a buffer of 2*rows*PLP_DWT_OUTPUT_LENGTH(cols, wavelet.length) values (L2)
+   @param[out]  pDstA    points to the Approximate coefficients (LL)
+   @param[out]  pDstH    points to the Horizontal detail coefficients (LH)
+   @param[out]  pDstV    points to the Vertical detail coefficients (HL)
+   @param[out]  pDstD    points to the Diagonal detail coefficients (HH)
    @return      none
 */
-void plp_dwt_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                  uint32_t length,
-                  const plp_dwt_wavelet_q8 wavelet,
+void plp_dwt2d_f32(const float32_t *__restrict__ pSrc,
+                  uint32_t rows,
+                  uint32_t cols,
+                  const plp_dwt_wavelet_f32 wavelet,
                   plp_dwt_extension_mode mode,
-                  int8_t *__restrict__ pDstA,
-                  int8_t *__restrict__ pDstD);
+                  float32_t *__restrict__ pBuffer,
+                  float32_t *__restrict__ pTemp,
+                  float32_t *__restrict__ pDstA,
+                  float32_t *__restrict__ pDstH,
+                  float32_t *__restrict__ pDstV,
+                  float32_t *__restrict__ pDstD);
 
 /**
-   @brief  8bit Fixed-point DWT kernel optimized for Haar Wavelet on real input data for XPULPV2 extension.
-   @param[in]   pSrc     points to the input buffer (real data)
-   @param[in]   length   length of input buffer
+   @brief  Parallel Floating-point 2D DWT of an image.
+   @param[in]   pSrc     points to the input image, row major (L2)
+   @param[in]   rows     number of rows of the image
+   @param[in]   cols     number of columns of the image
+   @param[in]   wavelet  wavelet structure for calculating DWT
    @param[in]   mode     boundary extension mode
-
-   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
-   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @param[in]   nPE      Number of cores to use
+   @param[in]   pBuffer  points to a buffer of nPE*PLP_DWT2D_BUFFER_LENGTH(rows, cols, wavelet.length) values (L1)
+   @param[in]   pTemp    points to a buffer of 2*rows*PLP_DWT_OUTPUT_LENGTH(cols, wavelet.length) values (L2)
+   @param[out]  pDstA    points to the Approximate coefficients (LL)
+   @param[out]  pDstH    points to the Horizontal detail coefficients (LH)
+   @param[out]  pDstV    points to the Vertical detail coefficients (HL)
+   @param[out]  pDstD    points to the Diagonal detail coefficients (HH)
    @return      none
 */
-void plp_dwt_haar_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                         uint32_t length,
-                         plp_dwt_extension_mode mode,
-                         int8_t *__restrict__ pDstA,
-                         int8_t *__restrict__ pDstD);
+void plp_dwt2d_f32_parallel(const float32_t *__restrict__ pSrc,
+                  uint32_t rows,
+                  uint32_t cols,
+                  const plp_dwt_wavelet_f32 wavelet,
+                  plp_dwt_extension_mode mode,
+                  uint32_t nPE,
+                  float32_t *__restrict__ pBuffer,
+                  float32_t *__restrict__ pTemp,
+                  float32_t *__restrict__ pDstA,
+                  float32_t *__restrict__ pDstH,
+                  float32_t *__restrict__ pDstV,
+                  float32_t *__restrict__ pDstD);
 
+/**
+   @brief  Floating-point inverse 2D DWT.
+   @param[in]   pSrcA    points to the Approximate coefficients (L2)
+   @param[in]   pSrcH    points to the Horizontal detail coefficients (L2)
+   @param[in]   pSrcV    points to the Vertical detail coefficients (L2)
+   @param[in]   pSrcD    points to the Diagonal detail coefficients (L2)
+   @param[in]   rows     number of rows of each coefficient matrix
+   @param[in]   cols     number of columns of each coefficient matrix
+   @param[in]   wavelet  wavelet structure used for the decomposition
+   @param[in]   pBuffer  points to a buffer of PLP_IDWT2D_BUFFER_LENGTH(rows, cols, wavelet.length) values (L1)
+   @param[in]   pTemp    points to a buffer of 2*PLP_IDWT_OUTPUT_LENGTH(rows, wavelet.length)*cols values (L2)
+   @param[out]  pDst     points to the reconstructed image (L2)
+   @return      none
+*/
+void plp_idwt2d_f32(const float32_t *__restrict__ pSrcA,
+                  const float32_t *__restrict__ pSrcH,
+                  const float32_t *__restrict__ pSrcV,
+                  const float32_t *__restrict__ pSrcD,
+                  uint32_t rows,
+                  uint32_t cols,
+                  const plp_dwt_wavelet_f32 wavelet,
+                  float32_t *__restrict__ pBuffer,
+                  float32_t *__restrict__ pTemp,
+                  float32_t *__restrict__ pDst);
 
 /**
-   @brief  Parallel Floating-point DWT on real input data for XPULPV2 extension.
-   @param[in]   pSrc     points to the input buffer (real data)
-   @param[in]   length   length of input buffer
-   @param[in]   wavelet  wavelet structure for calculating DWT
-   @param[in]   mode     boundary extension mode
+   @brief  Parallel Floating-point inverse 2D DWT.
+   @param[in]   pSrcA    points to the Approximate coefficients (L2)
+   @param[in]   pSrcH    points to the Horizontal detail coefficients (L2)
+   @param[in]   pSrcV    points to the Vertical detail coefficients (L2)
+   @param[in]   pSrcD    points to the Diagonal detail coefficients (L2)
+   @param[in]   rows     number of rows of each coefficient matrix
+   @param[in]   cols     number of columns of each coefficient matrix
+   @param[in]   wavelet  wavelet structure used for the decomposition
    @param[in]   nPE      Number of cores to use
-
-   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
-   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @param[in]   pBuffer  points to a buffer of nPE*PLP_IDWT2D_BUFFER_LENGTH(rows, cols, wavelet.length) values (L1)
+   @param[in]   pTemp    points to a buffer of 2*PLP_IDWT_OUTPUT_LENGTH(rows, wavelet.length)*cols values (L2)
+   @param[out]  pDst     points to the reconstructed image (L2)
    @return      none
 */
-void plp_dwt_f32_parallel(const float32_t *__restrict__ pSrc,
-                 uint32_t length,
-                 const plp_dwt_wavelet_f32 wavelet,
-                 plp_dwt_extension_mode mode,
-                 uint32_t nPE,
-                 float32_t *__restrict__ pDstA,
-                 float32_t *__restrict__ pDstD);
+void plp_idwt2d_f32_parallel(const float32_t *__restrict__ pSrcA,
+                  const float32_t *__restrict__ pSrcH,
+                  const float32_t *__restrict__ pSrcV,
+                  const float32_t *__restrict__ pSrcD,
+                  uint32_t rows,
+                  uint32_t cols,
+                  const plp_dwt_wavelet_f32 wavelet,
+                  uint32_t nPE,
+                  float32_t *__restrict__ pBuffer,
+                  float32_t *__restrict__ pTemp,
+                  float32_t *__restrict__ pDst);
 
+/**
+   @brief  Floating-point 2D DWT of an image for XPULPV2 extension.
+   @param[in]   S        points to the plp_dwt2d_instance_f32
+   @return      none
+*/
+void plp_dwt2d_f32s_xpulpv2(const plp_dwt2d_instance_f32 *S);
 
 /**
-   @brief  8bit Parallel Fixed-point DWT on real input data for XPULPV2 extension.
-   @param[in]   pSrc     points to the input buffer (q8)
-   @param[in]   length   length of input buffer
-   @param[in]   wavelet  wavelet structure for calculating DWT
-   @param[in]   mode     boundary extension mode
-   @param[in]   nPE      Number of cores to use
+   @brief  Floating-point inverse 2D DWT for XPULPV2 extension.
+   @param[in]   S        points to the plp_idwt2d_instance_f32
+   @return      none
+*/
+void plp_idwt2d_f32s_xpulpv2(const plp_idwt2d_instance_f32 *S);
 
-   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
-   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+/**
+   @brief  Parallel Floating-point 2D DWT of an image for XPULPV2 extension.
+   @param[in]   args     points to the plp_dwt2d_instance_f32
    @return      none
 */
-void plp_dwt_q8_parallel(const int8_t *__restrict__ pSrc,
-                 uint32_t length,
-                 const plp_dwt_wavelet_q8 wavelet,
-                 plp_dwt_extension_mode mode,
-                 uint32_t nPE,
-                 int8_t *__restrict__ pDstA,
-                 int8_t *__restrict__ pDstD);
+void plp_dwt2d_f32p_xpulpv2(void *args);
 
+/**
+   @brief  Parallel Floating-point inverse 2D DWT for XPULPV2 extension.
+   @param[in]   args     points to the plp_idwt2d_instance_f32
+   @return      none
+*/
+void plp_idwt2d_f32p_xpulpv2(void *args);
 
 /**
-   @brief  16bit Parallel Fixed-point DWT on real input data for XPULPV2 extension.
-   @param[in]   pSrc     points to the input buffer (q16)
-   @param[in]   length   length of input buffer
+   @brief  16bit Fixed-point 2D DWT of an image.
+   @param[in]   pSrc     points to the input image, row major (L2)
+   @param[in]   rows     number of rows of the image
+   @param[in]   cols     number of columns of the image
    @param[in]   wavelet  wavelet structure for calculating DWT
    @param[in]   mode     boundary extension mode
-   @param[in]   nPE      Number of cores to use
-
-   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
-   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @param[in]   pBuffer  points to a buffer of PLP_DWT2D_BUFFER_LENGTH(rows, cols, wavelet.length) values (L1)
+   @param[in]   pTemp    points to a buffer of 2*rows*PLP_DWT_OUTPUT_LENGTH(cols, wavelet.length) values (L2)
+   @param[out]  pDstA    points to the Approximate coefficients (LL)
+   @param[out]  pDstH    points to the Horizontal detail coefficients (LH)
+   @param[out]  pDstV    points to the Vertical detail coefficients (HL)
+   @param[out]  pDstD    points to the Diagonal detail coefficients (HH)
    @return      none
 */
-void plp_dwt_q16_parallel(const int16_t *__restrict__ pSrc,
-                 uint32_t length,
-                 const plp_dwt_wavelet_q16 wavelet,
-                 plp_dwt_extension_mode mode,
-                 uint32_t nPE,
-                 int16_t *__restrict__ pDstA,
-                 int16_t *__restrict__ pDstD);
+void plp_dwt2d_q16(const int16_t *__restrict__ pSrc,
+                  uint32_t rows,
+                  uint32_t cols,
+                  const plp_dwt_wavelet_q16 wavelet,
+                  plp_dwt_extension_mode mode,
+                  int16_t *__restrict__ pBuffer,
+                  int16_t *__restrict__ pTemp,
+                  int16_t *__restrict__ pDstA,
+                  int16_t *__restrict__ pDstH,
+                  int16_t *__restrict__ pDstV,
+                  int16_t *__restrict__ pDstD);
 
 /**
-   @brief  32bit Parallel Fixed-point DWT on real input data for XPULPV2 extension.
-   @param[in]   pSrc     points to the input buffer (q32)
-   @param[in]   length   length of input buffer
+   @brief  Parallel 16bit Fixed-point 2D DWT of an image.
+   @param[in]   pSrc     points to the input image, row major (L2)
+   @param[in]   rows     number of rows of the image
+   @param[in]   cols     number of columns of the image
    @param[in]   wavelet  wavelet structure for calculating DWT
    @param[in]   mode     boundary extension mode
    @param[in]   nPE      Number of cores to use
-
-   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
-   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @param[in]   pBuffer  points to a buffer of nPE*PLP_DWT2D_BUFFER_LENGTH(rows, cols, wavelet.length) values (L1)
+   @param[in]   pTemp    points to a buffer of 2*rows*PLP_DWT_OUTPUT_LENGTH(cols, wavelet.length) values (L2)
+   @param[out]  pDstA    points to the Approximate coefficients (LL)
+   @param[out]  pDstH    points to the Horizontal detail coefficients (LH)
+   @param[out]  pDstV    points to the Vertical detail coefficients (HL)
+   @param[out]  pDstD    points to the Diagonal detail coefficients (HH)
    @return      none
 */
-void plp_dwt_q32_parallel(const int32_t *__restrict__ pSrc,
-                 uint32_t length,
-                 const plp_dwt_wavelet_q32 wavelet,
-                 plp_dwt_extension_mode mode,
-                 uint32_t nPE,
-                 int32_t *__restrict__ pDstA,
-                 int32_t *__restrict__ pDstD);
-
+void plp_dwt2d_q16_parallel(const int16_t *__restrict__ pSrc,
+                  uint32_t rows,
+                  uint32_t cols,
+                  const plp_dwt_wavelet_q16 wavelet,
+                  plp_dwt_extension_mode mode,
+                  uint32_t nPE,
+                  int16_t *__restrict__ pBuffer,
+                  int16_t *__restrict__ pTemp,
+                  int16_t *__restrict__ pDstA,
+                  int16_t *__restrict__ pDstH,
+                  int16_t *__restrict__ pDstV,
+                  int16_t *__restrict__ pDstD);
 
 /**
-   @brief  Floating-point DWT on real input data for XPULPV2 extension.
-   @param[in]   args     points to the plp_dwt_instance_f32
+   @brief  16bit Fixed-point inverse 2D DWT.
+   @param[in]   pSrcA    points to the Approximate coefficients (L2)
+   @param[in]   pSrcH    points to the Horizontal detail coefficients (L2)
+   @param[in]   pSrcV    points to the Vertical detail coefficients (L2)
+   @param[in]   pSrcD    points to the Diagonal detail coefficients (L2)
+   @param[in]   rows     number of rows of each coefficient matrix
+   @param[in]   cols     number of columns of each coefficient matrix
+   @param[in]   wavelet  wavelet structure used for the decomposition
+   @param[in]   pBuffer  points to a buffer of PLP_IDWT2D_BUFFER_LENGTH(rows, cols, wavelet.length) values (L1)
+   @param[in]   pTemp    points to a buffer of 2*PLP_IDWT_OUTPUT_LENGTH(rows, wavelet.length)*cols values (L2)
+   @param[out]  pDst     points to the reconstructed image (L2)
    @return      none
 */
-void plp_dwt_f32p_xpulpv2(void *args);
-
+void plp_idwt2d_q16(const int16_t *__restrict__ pSrcA,
+                  const int16_t *__restrict__ pSrcH,
+                  const int16_t *__restrict__ pSrcV,
+                  const int16_t *__restrict__ pSrcD,
+                  uint32_t rows,
+                  uint32_t cols,
+                  const plp_dwt_wavelet_q16 wavelet,
+                  int16_t *__restrict__ pBuffer,
+                  int16_t *__restrict__ pTemp,
+                  int16_t *__restrict__ pDst);
 
 /**
-   @brief  Floating-point DWT kernel optimized for Haar Wavelet on real input data for XPULPV2 extension.
-   @param[in]   args     points to the plp_dwt_instance_f32
+   @brief  Parallel 16bit Fixed-point inverse 2D DWT.
+   @param[in]   pSrcA    points to the Approximate coefficients (L2)
+   @param[in]   pSrcH    points to the Horizontal detail coefficients (L2)
+   @param[in]   pSrcV    points to the Vertical detail coefficients (L2)
+   @param[in]   pSrcD    points to the Diagonal detail coefficients (L2)
+   @param[in]   rows     number of rows of each coefficient matrix
+   @param[in]   cols     number of columns of each coefficient matrix
+   @param[in]   wavelet  wavelet structure used for the decomposition
+   @param[in]   nPE      Number of cores to use
+   @param[in]   pBuffer  points to a buffer of nPE*PLP_IDWT2D_BUFFER_LENGTH(rows, cols, wavelet.length) values (L1)
+   @param[in]   pTemp    points to a buffer of 2*PLP_IDWT_OUTPUT_LENGTH(rows, wavelet.length)*cols values (L2)
+   @param[out]  pDst     points to the reconstructed image (L2)
    @return      none
 */
-void plp_dwt_haar_f32p_xpulpv2(void *args);
-
+void plp_idwt2d_q16_parallel(const int16_t *__restrict__ pSrcA,
+                  const int16_t *__restrict__ pSrcH,
+                  const int16_t *__restrict__ pSrcV,
+                  const int16_t *__restrict__ pSrcD,
+                  uint32_t rows,
+                  uint32_t cols,
+                  const plp_dwt_wavelet_q16 wavelet,
+                  uint32_t nPE,
+                  int16_t *__restrict__ pBuffer,
+                  int16_t *__restrict__ pTemp,
+                  int16_t *__restrict__ pDst);
 
 /**
-   @brief  Q7 fixed-point DWT for XPULPV2 extension.
-   @param[in]   args     points to the plp_dwt_instance_q8
+   @brief  16bit Fixed-point 2D DWT of an image for RV32IM extension.
+   @param[in]   S        points to the plp_dwt2d_instance_q16
    @return      none
 */
-void plp_dwt_q8p_xpulpv2(void *args);
-
-
+void plp_dwt2d_q16s_rv32im(const plp_dwt2d_instance_q16 *S);
 
 /**
-   @brief q7 fixed-point DWT kernel optimized for Haar Wavelet for XPULPV2 extension.
-   @param[in]   args     points to the plp_dwt_instance_q8
+   @brief  16bit Fixed-point inverse 2D DWT for RV32IM extension.
+   @param[in]   S        points to the plp_idwt2d_instance_q16
    @return      none
 */
-void plp_dwt_haar_q8p_xpulpv2(void *args);
-
-
+void plp_idwt2d_q16s_rv32im(const plp_idwt2d_instance_q16 *S);
 
 /**
-   @brief  Q15 fixed-point DWT for XPULPV2 extension.
-   @param[in]   args     points to the plp_dwt_instance_q16
+   @brief  16bit Fixed-point 2D DWT of an image for XPULPV2 extension.
+   @param[in]   S        points to the plp_dwt2d_instance_q16
    @return      none
 */
-void plp_dwt_q16p_xpulpv2(void *args);
-
+void plp_dwt2d_q16s_xpulpv2(const plp_dwt2d_instance_q16 *S);
 
 /**
-   @brief q15 fixed-point DWT kernel optimized for Haar Wavelet for XPULPV2 extension.
-   @param[in]   args     points to the plp_dwt_instance_q16
+   @brief  16bit Fixed-point inverse 2D DWT for XPULPV2 extension.
+   @param[in]   S        points to the plp_idwt2d_instance_q16
    @return      none
 */
-void plp_dwt_haar_q16p_xpulpv2(void *args);
+void plp_idwt2d_q16s_xpulpv2(const plp_idwt2d_instance_q16 *S);
 
 /**
-   @brief  Q31 fixed-point DWT on real input data for XPULPV2 extension.
-   @param[in]   args     points to the plp_dwt_instance_q32
+   @brief  Parallel 16bit Fixed-point 2D DWT of an image for XPULPV2 extension.
+   @param[in]   args     points to the plp_dwt2d_instance_q16
    @return      none
 */
-void plp_dwt_q32p_xpulpv2(void *arg);
+void plp_dwt2d_q16p_xpulpv2(void *args);
 
 /**
-   @brief  Q31 Fixed-point DWT kernel optimized for Haar Wavelet for XPULPV2 extension.
-   @param[in]   args     points to the plp_dwt_instance_q32
+   @brief  Parallel 16bit Fixed-point inverse 2D DWT for XPULPV2 extension.
+   @param[in]   args     points to the plp_idwt2d_instance_q16
    @return      none
 */
-void plp_dwt_haar_q32p_xpulpv2(void *args);
-
-
-
-
+void plp_idwt2d_q16p_xpulpv2(void *args);
 
 /**
-   @brief  32bit Fixed-point DWT.
-   @param[in]   pSrc     points to the input buffer (real data)
-   @param[in]   length   length of input buffer
+   @brief  8bit Fixed-point 2D DWT of an image.
+   @param[in]   pSrc     points to the input image, row major (L2)
+   @param[in]   rows     number of rows of the image
+   @param[in]   cols     number of columns of the image
    @param[in]   wavelet  wavelet structure for calculating DWT
    @param[in]   mode     boundary extension mode
-
-   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
-   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @param[in]   pBuffer  points to a buffer of PLP_DWT2D_BUFFER_LENGTH(rows, cols, wavelet.length) values (L1)
+   @param[in]   pTemp    points to a buffer of 2*rows*PLP_DWT_OUTPUT_LENGTH(cols, wavelet.length) values (L2)
+   @param[out]  pDstA    points to the Approximate coefficients (LL)
+   @param[out]  pDstH    points to the Horizontal detail coefficients (LH)
+   @param[out]  pDstV    points to the Vertical detail coefficients (HL)
+   @param[out]  pDstD    points to the Diagonal detail coefficients (HH)
    @return      none
 */
-void plp_dwt_q32s_rv32im(const int32_t *__restrict__ pSrc,
-                  uint32_t length,
-                  const plp_dwt_wavelet_q32 wavelet,
+void plp_dwt2d_q8(const int8_t *__restrict__ pSrc,
+                  uint32_t rows,
+                  uint32_t cols,
+                  const plp_dwt_wavelet_q8 wavelet,
                   plp_dwt_extension_mode mode,
-                  int32_t *__restrict__ pDstA,
-                  int32_t *__restrict__ pDstD);
+                  int8_t *__restrict__ pBuffer,
+                  int8_t *__restrict__ pTemp,
+                  int8_t *__restrict__ pDstA,
+                  int8_t *__restrict__ pDstH,
+                  int8_t *__restrict__ pDstV,
+                  int8_t *__restrict__ pDstD);
 
 /**
-   @brief  32bit Fixed-point DWT  kernel optimized for Haar Wavelet on real input data.
-   @param[in]   pSrc     points to the input buffer (real data)
-   @param[in]   length   length of input buffer
+   @brief  Parallel 8bit Fixed-point 2D DWT of an image.
+   @param[in]   pSrc     points to the input image, row major (L2)
+   @param[in]   rows     number of rows of the image
+   @param[in]   cols     number of columns of the image
+   @param[in]   wavelet  wavelet structure for calculating DWT
    @param[in]   mode     boundary extension mode
-
-   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
-   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @param[in]   nPE      Number of cores to use
+   @param[in]   pBuffer  points to a buffer of nPE*PLP_DWT2D_BUFFER_LENGTH(rows, cols, wavelet.length) values (L1)
+   @param[in]   pTemp    points to a buffer of 2*rows*PLP_DWT_OUTPUT_LENGTH(cols, wavelet.length) values (L2)
+   @param[out]  pDstA    points to the Approximate coefficients (LL)
+   @param[out]  pDstH    points to the Horizontal detail coefficients (LH)
+   @param[out]  pDstV    points to the Vertical detail coefficients (HL)
+   @param[out]  pDstD    points to the Diagonal detail coefficients (HH)
    @return      none
 */
-void plp_dwt_haar_q32s_rv32im(const int32_t *__restrict__ pSrc,
-                         uint32_t length,
-                         plp_dwt_extension_mode mode,
-                         int32_t *__restrict__ pDstA,
-                         int32_t *__restrict__ pDstD);
-
-
+void plp_dwt2d_q8_parallel(const int8_t *__restrict__ pSrc,
+                  uint32_t rows,
+                  uint32_t cols,
+                  const plp_dwt_wavelet_q8 wavelet,
+                  plp_dwt_extension_mode mode,
+                  uint32_t nPE,
+                  int8_t *__restrict__ pBuffer,
+                  int8_t *__restrict__ pTemp,
+                  int8_t *__restrict__ pDstA,
+                  int8_t *__restrict__ pDstH,
+                  int8_t *__restrict__ pDstV,
+                  int8_t *__restrict__ pDstD);
 
 /**
-   @brief  16bit Fixed-point DWT.
-   @param[in]   pSrc     points to the input buffer (real data)
-   @param[in]   length   length of input buffer
-   @param[in]   wavelet  wavelet structure for calculating DWT
-   @param[in]   mode     boundary extension mode
-
-   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
-   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+   @brief  8bit Fixed-point inverse 2D DWT.
+   @param[in]   pSrcA    points to the Approximate coefficients (L2)
+   @param[in]   pSrcH    points to the Horizontal detail coefficients (L2)
+   @param[in]   pSrcV    points to the Vertical detail coefficients (L2)
+   @param[in]   pSrcD    points to the Diagonal detail coefficients (L2)
+   @param[in]   rows     number of rows of each coefficient matrix
+   @param[in]   cols     number of columns of each coefficient matrix
+   @param[in]   wavelet  wavelet structure used for the decomposition
+   @param[in]   pBuffer  points to a buffer of PLP_IDWT2D_BUFFER_LENGTH(rows, cols, wavelet.length) values (L1)
+   @param[in]   pTemp    points to a buffer of 2*PLP_IDWT_OUTPUT_LENGTH(rows, wavelet.length)*cols values (L2)
+   @param[out]  pDst     points to the reconstructed image (L2)
    @return      none
 */
-void plp_dwt_q16s_rv32im(const int16_t *__restrict__ pSrc,
-                  uint32_t length,
-                  const plp_dwt_wavelet_q16 wavelet,
-                  plp_dwt_extension_mode mode,
-                  int16_t *__restrict__ pDstA,
-                  int16_t *__restrict__ pDstD);
+void plp_idwt2d_q8(const int8_t *__restrict__ pSrcA,
+                  const int8_t *__restrict__ pSrcH,
+                  const int8_t *__restrict__ pSrcV,
+                  const int8_t *__restrict__ pSrcD,
+                  uint32_t rows,
+                  uint32_t cols,
+                  const plp_dwt_wavelet_q8 wavelet,
+                  int8_t *__restrict__ pBuffer,
+                  int8_t *__restrict__ pTemp,
+                  int8_t *__restrict__ pDst);
 
 /**
-   @brief  16bit Fixed-point DWT kernel optimized for Haar Wavelet on real input data.
-   @param[in]   pSrc     points to the input buffer (real data)
-   @param[in]   length   length of input buffer
-   @param[in]   mode     boundary extension mode
+   @brief  Parallel 8bit Fixed-point inverse 2D DWT.
+   @param[in]   pSrcA    points to the Approximate coefficients (L2)
+   @param[in]   pSrcH    points to the Horizontal detail coefficients (L2)
+   @param[in]   pSrcV    points to the Vertical detail coefficients (L2)
+   @param[in]   pSrcD    points to the Diagonal detail coefficients (L2)
+   @param[in]   rows     number of rows of each coefficient matrix
+   @param[in]   cols     number of columns of each coefficient matrix
+   @param[in]   wavelet  wavelet structure used for the decomposition
+   @param[in]   nPE      Number of cores to use
+   @param[in]   pBuffer  points to a buffer of nPE*PLP_IDWT2D_BUFFER_LENGTH(rows, cols, wavelet.length) values (L1)
+   @param[in]   pTemp    points to a buffer of 2*PLP_IDWT_OUTPUT_LENGTH(rows, wavelet.length)*cols values (L2)
+   @param[out]  pDst     points to the reconstructed image (L2)
+   @return      none
+*/
+void plp_idwt2d_q8_parallel(const int8_t *__restrict__ pSrcA,
+                  const int8_t *__restrict__ pSrcH,
+                  const int8_t *__restrict__ pSrcV,
+                  const int8_t *__restrict__ pSrcD,
+                  uint32_t rows,
+                  uint32_t cols,
+                  const plp_dwt_wavelet_q8 wavelet,
+                  uint32_t nPE,
+                  int8_t *__restrict__ pBuffer,
+                  int8_t *__restrict__ pTemp,
+                  int8_t *__restrict__ pDst);
 
-   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
-   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+/**
+   @brief  8bit Fixed-point 2D DWT of an image for RV32IM extension.
+   @param[in]   S        points to the plp_dwt2d_instance_q8
    @return      none
 */
-void plp_dwt_haar_q16s_rv32im(const int16_t *__restrict__ pSrc,
-                         uint32_t length,
-                         plp_dwt_extension_mode mode,
-                         int16_t *__restrict__ pDstA,
-                         int16_t *__restrict__ pDstD);
+void plp_dwt2d_q8s_rv32im(const plp_dwt2d_instance_q8 *S);
 
+/**
+   @brief  8bit Fixed-point inverse 2D DWT for RV32IM extension.
+   @param[in]   S        points to the plp_idwt2d_instance_q8
+   @return      none
+*/
+void plp_idwt2d_q8s_rv32im(const plp_idwt2d_instance_q8 *S);
 
 /**
-   @brief  8bit Fixed-point DWT.
-   @param[in]   pSrc     points to the input buffer (real data)
-   @param[in]   length   length of input buffer
-   @param[in]   wavelet  wavelet structure for calculating DWT
-   @param[in]   mode     boundary extension mode
+   @brief  8bit Fixed-point 2D DWT of an image for XPULPV2 extension.
+   @param[in]   S        points to the plp_dwt2d_instance_q8
+   @return      none
+*/
+void plp_dwt2d_q8s_xpulpv2(const plp_dwt2d_instance_q8 *S);
 
-   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
-   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+/**
+   @brief  8bit Fixed-point inverse 2D DWT for XPULPV2 extension.
+   @param[in]   S        points to the plp_idwt2d_instance_q8
    @return      none
 */
-void plp_dwt_q8s_rv32im(const int8_t *__restrict__ pSrc,
-                  uint32_t length,
-                  const plp_dwt_wavelet_q8 wavelet,
-                  plp_dwt_extension_mode mode,
-                  int8_t *__restrict__ pDstA,
-                  int8_t *__restrict__ pDstD);
+void plp_idwt2d_q8s_xpulpv2(const plp_idwt2d_instance_q8 *S);
 
 /**
-   @brief  8bit Fixed-point DWT kernel optimized for Haar Wavelet on real input data.
-   @param[in]   pSrc     points to the input buffer (real data)
-   @param[in]   length   length of input buffer
-   @param[in]   mode     boundary extension mode
+   @brief  Parallel 8bit Fixed-point 2D DWT of an image for XPULPV2 extension.
+   @param[in]   args     points to the plp_dwt2d_instance_q8
+   @return      none
+*/
+void plp_dwt2d_q8p_xpulpv2(void *args);
 
-   @param[out]  pDstA    points to ouput buffer with Approximate coefficients
-   @param[out]  pDstD    points to ouput buffer with Detailed coefficients
+/**
+   @brief  Parallel 8bit Fixed-point inverse 2D DWT for XPULPV2 extension.
+   @param[in]   args     points to the plp_idwt2d_instance_q8
    @return      none
 */
-void plp_dwt_haar_q8s_rv32im(const int8_t *__restrict__ pSrc,
-                         uint32_t length,
-                         plp_dwt_extension_mode mode,
-                         int8_t *__restrict__ pDstA,
-                         int8_t *__restrict__ pDstD);
+void plp_idwt2d_q8p_xpulpv2(void *args);
 
 
 void plp_mat_add_i32(const int32_t *__restrict__ pSrcA,
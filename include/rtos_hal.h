@@ -46,6 +46,16 @@ static inline void hal_cl_l1_free(void *chunk, int size)
   pi_cl_l1_free(0, chunk, size);
 }
 
+static inline void * hal_l2_malloc(int size)
+{
+  return pi_l2_malloc(size);
+}
+
+static inline void hal_l2_free(void *chunk, int size)
+{
+  pi_l2_free(chunk, size);
+}
+
 
 /* DMA */
 
@@ -61,6 +71,11 @@ static inline void hal_cl_dma_cmd(uint32_t ext, uint32_t loc, uint32_t size, hal
   pi_cl_dma_cmd(ext, loc, size, dir, cmd);
 }
 
+static inline void hal_cl_dma_cmd_2d(uint32_t ext, uint32_t loc, uint32_t size, uint32_t stride, uint32_t length, hal_cl_dma_dir_e dir, int merge __attribute__((unused)), hal_cl_dma_cmd_t * cmd)
+{
+  pi_cl_dma_cmd_2d(ext, loc, size, stride, length, dir, cmd);
+}
+
 static inline void hal_cl_dma_cmd_wait(hal_cl_dma_cmd_t * cmd)
 {
   pi_cl_dma_cmd_wait(cmd);
@@ -120,6 +135,250 @@ static inline unsigned int hal_perf_read(int id)
 }
 
 
+/* CLUSTER TIMER (shared by all cores, used to compare timestamps across cores) */
+
+static inline void hal_cl_timer_start()
+{
+  timer_conf_set(timer_base_cl(0, 0, 0), TIMER_CFG_LO_ENABLE(1) | TIMER_CFG_LO_RESET(1));
+}
+
+static inline unsigned int hal_cl_timer_read()
+{
+  return timer_count_get(timer_base_cl(0, 0, 0));
+}
+
+
+/* CLUSTER OFFLOAD (called from the fabric controller) */
+
+typedef struct pi_device hal_cluster_t;
+
+static inline int hal_cluster_open(hal_cluster_t *cluster)
+{
+  struct pi_cluster_conf conf;
+  pi_cluster_conf_init(&conf);
+  pi_open_from_conf(cluster, &conf);
+  return pi_cluster_open(cluster);
+}
+
+static inline void hal_cluster_close(hal_cluster_t *cluster)
+{
+  pi_cluster_close(cluster);
+}
+
+static inline void hal_cluster_call(hal_cluster_t *cluster, void (*entry)(void *), void *arg)
+{
+  struct pi_cluster_task task;
+  pi_cluster_send_task_to_cl(cluster, pi_cluster_task(&task, entry, arg));
+}
+
+
+
+
+
+#elif defined(RTOS_HOST)
+
+#include "rtos_hal_host.h"
+
+#define HAL_L1
+#define HAL_CL_L1
+#define HAL_L2
+
+static inline uint32_t hal_cl_nb_pe_cores(){
+  return PLP_HOST_NB_PE;
+}
+
+static inline void hal_team_barrier()
+{
+  plp_host_team_barrier();
+}
+
+static inline void hal_cl_team_fork(int nb_cores, void (*entry)(void *), void *arg)
+{
+  plp_host_team_fork(nb_cores, entry, arg);
+}
+
+
+/* MEMORY ALLOCATION */
+
+static inline void * hal_fc_l1_malloc(int size)
+{
+  return plp_host_l1_malloc(size);
+}
+
+static inline void hal_fc_l1_free(void *chunk, int size)
+{
+  plp_host_l1_free(chunk, size);
+}
+
+static inline void * hal_cl_l1_malloc(int size)
+{
+  return plp_host_l1_malloc(size);
+}
+
+static inline void hal_cl_l1_free(void *chunk, int size)
+{
+  plp_host_l1_free(chunk, size);
+}
+
+static inline void * hal_l2_malloc(int size)
+{
+  return malloc(size);
+}
+
+static inline void hal_l2_free(void *chunk, int size __attribute__((unused)))
+{
+  free(chunk);
+}
+
+
+/* DMA */
+
+typedef enum {
+  HAL_CL_DMA_DIR_LOC2EXT = 0,
+  HAL_CL_DMA_DIR_EXT2LOC = 1
+} hal_cl_dma_dir_e;
+
+typedef int hal_cl_dma_cmd_t;
+
+static inline void hal_cl_dma_cmd(uintptr_t ext, uintptr_t loc, uint32_t size, hal_cl_dma_dir_e dir, int merge __attribute__((unused)), hal_cl_dma_cmd_t * cmd)
+{
+  if (dir == HAL_CL_DMA_DIR_EXT2LOC)
+    memcpy((void *)loc, (const void *)ext, size);
+  else
+    memcpy((void *)ext, (const void *)loc, size);
+  *cmd = 0;
+}
+
+/* size bytes in total, length contiguous bytes per line, lines stride bytes apart in ext */
+static inline void hal_cl_dma_cmd_2d(uintptr_t ext, uintptr_t loc, uint32_t size, uint32_t stride, uint32_t length, hal_cl_dma_dir_e dir, int merge __attribute__((unused)), hal_cl_dma_cmd_t * cmd)
+{
+  for (uint32_t i = 0; i < size; i += length) {
+    if (dir == HAL_CL_DMA_DIR_EXT2LOC)
+      memcpy((void *)(loc + i), (const void *)ext, length);
+    else
+      memcpy((void *)ext, (const void *)(loc + i), length);
+    ext += stride;
+  }
+  *cmd = 0;
+}
+
+static inline void hal_cl_dma_cmd_wait(hal_cl_dma_cmd_t * cmd __attribute__((unused)))
+{
+}
+
+
+/* PERFORMANCE COUNTERS */
+
+#define HAL_PERF_CYCLES 0
+#define HAL_PERF_ACTIVE_CYCLES 1
+#define HAL_PERF_INSTR 2
+#define HAL_PERF_LD_STALL 3
+#define HAL_PERF_JR_STALL 4
+#define HAL_PERF_IMISS 5
+#define HAL_PERF_WBRANCH 6
+#define HAL_PERF_WBRANCH_CYC 7
+#define HAL_PERF_LD 8
+#define HAL_PERF_ST 9
+#define HAL_PERF_JUMP 10
+#define HAL_PERF_BRANCH 11
+#define HAL_PERF_DELAY_NOP 12
+#define HAL_PERF_LD_EXT_CYC 13
+#define HAL_PERF_ST_EXT_CYC 14
+#define HAL_PERF_TCDM_CONT 15
+
+typedef struct {
+  uint32_t events;
+  uint32_t start;
+  uint32_t cycles;
+  uint32_t running;
+} hal_perf_t;
+
+extern __thread hal_perf_t *plp_host_perf_current;
+
+static inline void hal_perf_init(hal_perf_t * perf)
+{
+  perf->events = 0;
+  perf->start = 0;
+  perf->cycles = 0;
+  perf->running = 0;
+  plp_host_perf_current = perf;
+}
+
+static inline void hal_perf_conf(hal_perf_t * perf, unsigned events)
+{
+  perf->events = events;
+  plp_host_perf_current = perf;
+}
+
+static inline void hal_perf_reset(hal_perf_t * perf)
+{
+  perf->cycles = 0;
+  perf->start = plp_host_perf_cycles();
+}
+
+static inline void hal_perf_start(hal_perf_t * perf)
+{
+  perf->start = plp_host_perf_cycles();
+  perf->running = 1;
+  plp_host_perf_current = perf;
+}
+
+
+static inline void hal_perf_stop(hal_perf_t * perf)
+{
+  if (perf->running)
+    perf->cycles += plp_host_perf_cycles() - perf->start;
+  perf->running = 0;
+}
+
+static inline unsigned int hal_perf_read(int id)
+{
+  hal_perf_t *perf = plp_host_perf_current;
+  if ((id != HAL_PERF_CYCLES && id != HAL_PERF_ACTIVE_CYCLES) || perf == NULL)
+    return 0;
+  /* like the hardware counters, a running counter can be read */
+  return perf->cycles + (perf->running ? plp_host_perf_cycles() - perf->start : 0);
+}
+
+
+/* CLUSTER TIMER (shared by all cores, used to compare timestamps across cores) */
+
+static inline void hal_cl_timer_start()
+{
+}
+
+static inline unsigned int hal_cl_timer_read()
+{
+  return plp_host_perf_cycles();
+}
+
+
+/* CLUSTER OFFLOAD (called from the fabric controller) */
+
+typedef int hal_cluster_t;
+
+static inline int hal_cluster_open(hal_cluster_t *cluster __attribute__((unused)))
+{
+  return 0;
+}
+
+static inline void hal_cluster_close(hal_cluster_t *cluster __attribute__((unused)))
+{
+}
+
+static inline void hal_cluster_call(hal_cluster_t *cluster __attribute__((unused)), void (*entry)(void *), void *arg)
+{
+  /* the calling thread becomes core 0 of the cluster while executing entry */
+  int caller_core_id = plp_host_core_id;
+  int caller_cluster_id = plp_host_cluster_id;
+  plp_host_core_id = 0;
+  plp_host_cluster_id = 0;
+  entry(arg);
+  plp_host_core_id = caller_core_id;
+  plp_host_cluster_id = caller_cluster_id;
+}
+
+
 
 
 
@@ -169,6 +428,16 @@ static inline void hal_cl_l1_free(void *chunk, int size)
   rt_free(RT_ALLOC_CL_DATA, chunk, size);
 }
 
+static inline void * hal_l2_malloc(int size)
+{
+  return rt_alloc(RT_ALLOC_L2_CL_DATA, size);
+}
+
+static inline void hal_l2_free(void *chunk, int size)
+{
+  rt_free(RT_ALLOC_L2_CL_DATA, chunk, size);
+}
+
 
 /* DMA */
 
@@ -184,6 +453,11 @@ static inline void hal_cl_dma_cmd(uint32_t ext, uint32_t loc, uint32_t size, hal
   rt_dma_memcpy(ext, loc, size, dir, merge, cmd);
 }
 
+static inline void hal_cl_dma_cmd_2d(uint32_t ext, uint32_t loc, uint32_t size, uint32_t stride, uint32_t length, hal_cl_dma_dir_e dir, int merge, hal_cl_dma_cmd_t * cmd)
+{
+  rt_dma_memcpy_2d(ext, loc, size, stride, length, dir, merge, cmd);
+}
+
 static inline void hal_cl_dma_cmd_wait(hal_cl_dma_cmd_t * cmd)
 {
   rt_dma_wait(cmd);
@@ -243,6 +517,40 @@ static inline unsigned int hal_perf_read(int id)
 }
 
 
+/* CLUSTER TIMER (shared by all cores, used to compare timestamps across cores) */
+
+static inline void hal_cl_timer_start()
+{
+  timer_conf_set(timer_base_cl(0, 0, 0), TIMER_CFG_LO_ENABLE(1) | TIMER_CFG_LO_RESET(1));
+}
+
+static inline unsigned int hal_cl_timer_read()
+{
+  return timer_count_get(timer_base_cl(0, 0, 0));
+}
+
+
+/* CLUSTER OFFLOAD (called from the fabric controller) */
+
+typedef int hal_cluster_t;
+
+static inline int hal_cluster_open(hal_cluster_t *cluster __attribute__((unused)))
+{
+  rt_cluster_mount(1, 0, 0, NULL);
+  return 0;
+}
+
+static inline void hal_cluster_close(hal_cluster_t *cluster __attribute__((unused)))
+{
+  rt_cluster_mount(0, 0, 0, NULL);
+}
+
+static inline void hal_cluster_call(hal_cluster_t *cluster __attribute__((unused)), void (*entry)(void *), void *arg)
+{
+  rt_cluster_call(NULL, 0, entry, arg, NULL, 0, 0, rt_nb_pe(), NULL);
+}
+
+
 #endif /* PULP-RT */
 
 #endif
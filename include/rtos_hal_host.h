@@ -0,0 +1,183 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        rtos_hal_host.h
+ * Description:  Native host (Linux, pthreads) runtime backing rtos_hal.h
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: x86/ARM hosts running Linux
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * This header is only included by rtos_hal.h when RTOS_HOST is defined. It replaces the parts of
+ * the pulp-sdk that the library relies on:
+ *
+ * - the cluster is emulated by a pool of PLP_HOST_NB_PE pthreads, with the calling thread acting
+ *   as core 0 of the team,
+ * - L1 (TCDM) is a statically allocated, 8-byte aligned arena of PLP_HOST_L1_SIZE bytes,
+ * - the cluster DMA is a synchronous memcpy,
+ * - the performance counters only count cycles, which are nanoseconds of CLOCK_MONOTONIC,
+ * - the XPULPV2 builtins (SIMD, MAC, clip and normalization instructions) are emulated in C.
+ *
+ * By default, the calling thread behaves as a cluster core, such that the glue code selects the
+ * XPULPV2 kernels. Call plp_host_set_cluster_id(ARCHI_FC_CID) to select the RV32IM kernels.
+ */
+
+#ifndef _RTOS_HAL_HOST_H
+#define _RTOS_HAL_HOST_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef PLP_HOST_NB_PE
+#define PLP_HOST_NB_PE 8
+#endif
+
+#ifndef PLP_HOST_L1_SIZE
+#define PLP_HOST_L1_SIZE (1024 * 1024)
+#endif
+
+#define ARCHI_FC_CID 32
+
+/* RUNTIME (implemented in src/HostHal/rtos_hal_host.c) */
+
+extern __thread int plp_host_core_id;
+extern __thread int plp_host_cluster_id;
+
+void plp_host_team_fork(int nb_cores, void (*entry)(void *), void *arg);
+void plp_host_team_barrier(void);
+
+void *plp_host_l1_malloc(int size);
+void plp_host_l1_free(void *chunk, int size);
+
+uint32_t plp_host_perf_cycles(void);
+
+static inline int hal_core_id() {
+    return plp_host_core_id;
+}
+
+static inline int hal_cluster_id() {
+    return plp_host_cluster_id;
+}
+
+/**
+  @brief Select on which domain the calling thread runs.
+  @param[in]  cluster_id  ARCHI_FC_CID to emulate the fabric controller, 0 for the cluster
+  @return     none
+ */
+static inline void plp_host_set_cluster_id(int cluster_id) {
+    plp_host_cluster_id = cluster_id;
+}
+
+/* XPULPV2 BUILTINS */
+
+typedef signed short v2s __attribute__((vector_size(4)));
+typedef unsigned short v2u __attribute__((vector_size(4)));
+typedef signed char v4s __attribute__((vector_size(4)));
+typedef unsigned char v4u __attribute__((vector_size(4)));
+
+static inline int32_t __plp_host_dotsp2(v2s x, v2s y) {
+    return (int32_t)x[0] * y[0] + (int32_t)x[1] * y[1];
+}
+
+static inline int32_t __plp_host_dotsp4(v4s x, v4s y) {
+    return (int32_t)x[0] * y[0] + (int32_t)x[1] * y[1] + (int32_t)x[2] * y[2] +
+           (int32_t)x[3] * y[3];
+}
+
+static inline int32_t __plp_host_sdotsp2(v2s x, v2s y, int32_t acc) {
+    return acc + __plp_host_dotsp2(x, y);
+}
+
+static inline int32_t __plp_host_sdotsp4(v4s x, v4s y, int32_t acc) {
+    return acc + __plp_host_dotsp4(x, y);
+}
+
+static inline int32_t __plp_host_clip(int32_t x, int32_t low, int32_t high) {
+    return x < low ? low : x > high ? high : x;
+}
+
+static inline int32_t __plp_host_addRN(int32_t x, int32_t y, uint32_t scale) {
+    int32_t sum = x + y;
+    return scale ? (sum + (1 << (scale - 1))) >> scale : sum;
+}
+
+static inline v2s __plp_host_abs2(v2s x) {
+    return (v2s){ (signed short)__builtin_abs(x[0]), (signed short)__builtin_abs(x[1]) };
+}
+
+static inline v4s __plp_host_abs4(v4s x) {
+    return (v4s){ (signed char)__builtin_abs(x[0]), (signed char)__builtin_abs(x[1]),
+                  (signed char)__builtin_abs(x[2]), (signed char)__builtin_abs(x[3]) };
+}
+
+static inline int32_t __plp_host_clb(int32_t x) {
+    return x == 0 ? 0 : __builtin_clrsb(x);
+}
+
+#define __builtin_pulp_dotsp2(x, y) __plp_host_dotsp2((x), (y))
+#define __builtin_pulp_dotsp4(x, y) __plp_host_dotsp4((x), (y))
+#define __builtin_pulp_sdotsp2(x, y, z) __plp_host_sdotsp2((x), (y), (z))
+#define __builtin_pulp_sdotsp4(x, y, z) __plp_host_sdotsp4((x), (y), (z))
+
+#define __MAC(Acc, x, y) ((Acc) + (x) * (y))
+#define __MSU(Acc, x, y) ((Acc) - (x) * (y))
+#define __MACS(Acc, x, y) ((Acc) + (int32_t)(int16_t)(x) * (int16_t)(y))
+#define __MACSN(Acc, x, y, n) (((Acc) + (int32_t)(int16_t)(x) * (int16_t)(y)) >> (n))
+#define __MULSN(x, y, n) (((int32_t)(int16_t)(x) * (int16_t)(y)) >> (n))
+
+#define __DOTP2(x, y) __plp_host_dotsp2((x), (y))
+#define __DOTP4(x, y) __plp_host_dotsp4((x), (y))
+#define __SUMDOTP2(x, y, z) __plp_host_sdotsp2((x), (y), (z))
+#define __SUMDOTP4(x, y, z) __plp_host_sdotsp4((x), (y), (z))
+
+#define __ADD2(x, y) ((v2s)(x) + (v2s)(y))
+#define __ADD4(x, y) ((v4s)(x) + (v4s)(y))
+#define __SUB2(x, y) ((v2s)(x) - (v2s)(y))
+#define __SUB4(x, y) ((v4s)(x) - (v4s)(y))
+#define __NEG2(x) (-(v2s)(x))
+#define __NEG4(x) (-(v4s)(x))
+#define __ABS2(x) __plp_host_abs2((x))
+#define __ABS4(x) __plp_host_abs4((x))
+#define __AND2(x, y) ((v2s)(x) & (v2s)(y))
+#define __AND4(x, y) ((v4s)(x) & (v4s)(y))
+#define __SRA2(x, y) ((v2s)(x) >> (v2s)(y))
+#define __SRA4(x, y) ((v4s)(x) >> (v4s)(y))
+#define __SLL2(x, y) ((v2s)(x) << (v2s)(y))
+#define __SLL4(x, y) ((v4s)(x) << (v4s)(y))
+#define __PACK2(x, y) ((v2s){ (signed short)(x), (signed short)(y) })
+#define __PACK4(x, y, z, t) ((v4s){ (signed char)(x), (signed char)(y), (signed char)(z), (signed char)(t) })
+
+#define __MIN(x, y) ((x) < (y) ? (x) : (y))
+#define __MAX(x, y) ((x) > (y) ? (x) : (y))
+#define __ABS(x) ((x) < 0 ? -(x) : (x))
+#define __CLIP(x, precision) __plp_host_clip((x), -(1 << (precision)), (1 << (precision)) - 1)
+#define __CLIPU(x, precision) __plp_host_clip((x), 0, (1 << (precision)) - 1)
+#define __CLB(x) __plp_host_clb(x)
+#define __FL1(x) (31 - __builtin_clz(x))
+
+#define __ROUNDNORM_REG(x, scale) __plp_host_addRN((x), 0, (scale))
+#define __ADDROUNDNORM_REG(x, y, scale) __plp_host_addRN((x), (y), (scale))
+#define __ADDNORMU_REG(x, y, scale) ((int32_t)((uint32_t)((x) + (y)) >> (scale)))
+
+#endif
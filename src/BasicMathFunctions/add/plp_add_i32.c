@@ -90,12 +90,11 @@ void plp_add_i32(const int32_t * pSrcA,
                  const int32_t * pSrcB,
                  int32_t * pDst,
                  uint32_t blockSize) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-      plp_add_i32s_rv32im(pSrcA, pSrcB, pDst, blockSize);
-    } else {
-      plp_add_i32s_xpulpv2(pSrcA, pSrcB, pDst, blockSize);
-    }
+    plp_elementwise_i32_kernel kernel =
+        (plp_elementwise_i32_kernel)plp_dispatch(PLP_KERNEL_ADD_I32, blockSize);
+    kernel(pSrcA, pSrcB, pDst, blockSize);
 }
 
 /**
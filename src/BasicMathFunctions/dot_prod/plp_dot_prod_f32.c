@@ -57,13 +57,11 @@ void plp_dot_prod_f32(const float32_t *__restrict__ pSrcA,
                       const float32_t *__restrict__ pSrcB,
                       uint32_t blockSize,
                       float32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        //printf("Note: FC doesn't have FPU\n");
-        plp_dot_prod_f32s_rv32im(pSrcA, pSrcB, blockSize, pRes);
-    } else {
-        plp_dot_prod_f32s_xpulpv2(pSrcA, pSrcB, blockSize, pRes);
-    }
+    plp_dot_prod_f32_kernel kernel =
+        (plp_dot_prod_f32_kernel)plp_dispatch(PLP_KERNEL_DOT_PROD_F32, blockSize);
+    kernel(pSrcA, pSrcB, blockSize, pRes);
 }
 
 /**
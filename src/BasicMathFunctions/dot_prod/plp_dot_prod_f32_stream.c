@@ -0,0 +1,90 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_dot_prod_f32_stream.c
+ * Description:  32-bit float streamed dot product glue code
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicDotProd
+  @{
+ */
+
+static void plp_dot_prod_f32_stream_tile(const void *pSrcA,
+                                         const void *pSrcB,
+                                         void *pDst __attribute__((unused)),
+                                         uint32_t blockSize,
+                                         void *pAcc,
+                                         uint32_t first) {
+    float32_t res;
+
+    plp_dot_prod_f32s_xpulpv2((const float32_t *)pSrcA, (const float32_t *)pSrcB, blockSize, &res);
+
+    if (first) {
+        *(float32_t *)pAcc = res;
+    } else {
+        *(float32_t *)pAcc += res;
+    }
+}
+
+static void plp_dot_prod_f32_stream_combine(void *pAcc, const void *pPartial) {
+    *(float32_t *)pAcc += *(const float32_t *)pPartial;
+}
+
+static const plp_stream_op plp_dot_prod_f32_stream_op = {
+    plp_dot_prod_f32_stream_tile, plp_dot_prod_f32_stream_combine, 2, sizeof(float32_t), 0, sizeof(float32_t)
+};
+
+/**
+  @brief Glue code for dot product of 32-bit float vectors in L2.
+  @param[in]  pSrcA      points to the first input vector
+  @param[in]  pSrcB      points to the second input vector
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pRes       output result returned here
+  @return     none
+
+  @par
+  The vectors may be stored in L2, they are streamed through L1 with the cluster DMA (see
+  plp_stream).
+ */
+void plp_dot_prod_f32_stream(const float32_t *__restrict__ pSrcA,
+                             const float32_t *__restrict__ pSrcB,
+                             uint32_t blockSize,
+                             uint32_t nPE,
+                             float32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNC();
+
+    plp_stream(&plp_dot_prod_f32_stream_op, pSrcA, pSrcB, NULL, blockSize, nPE, pRes);
+}
+
+/**
+  @} end of BasicDotProd group
+ */
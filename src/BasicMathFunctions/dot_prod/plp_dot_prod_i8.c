@@ -61,12 +61,11 @@ void plp_dot_prod_i8(const int8_t *__restrict__ pSrcA,
                      const int8_t *__restrict__ pSrcB,
                      uint32_t blockSize,
                      int32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        plp_dot_prod_i8s_rv32im(pSrcA, pSrcB, blockSize, pRes);
-    } else {
-        plp_dot_prod_i8s_xpulpv2(pSrcA, pSrcB, blockSize, pRes);
-    }
+    plp_dot_prod_i8_kernel kernel =
+        (plp_dot_prod_i8_kernel)plp_dispatch(PLP_KERNEL_DOT_PROD_I8, blockSize);
+    kernel(pSrcA, pSrcB, blockSize, pRes);
 }
 
 /**
@@ -59,12 +59,11 @@ void plp_dot_prod_q32(const int32_t *__restrict__ pSrcA,
                       uint32_t blockSize,
                       uint32_t deciPoint,
                       int32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        plp_dot_prod_q32s_rv32im(pSrcA, pSrcB, blockSize, deciPoint, pRes);
-    } else {
-        plp_dot_prod_q32s_xpulpv2(pSrcA, pSrcB, blockSize, deciPoint, pRes);
-    }
+    plp_dot_prod_q32_kernel kernel =
+        (plp_dot_prod_q32_kernel)plp_dispatch(PLP_KERNEL_DOT_PROD_Q32, blockSize);
+    kernel(pSrcA, pSrcB, blockSize, deciPoint, pRes);
 }
 
 /**
@@ -50,7 +50,7 @@
   @param[in]  pSrcB      points to the second input vector
   @param[in]  blockSize  number of samples in each vector
   @param[in]  deciPoint  decimal point for right shift
-  @param[in]  nPE        number of parallel processing units
+  @param[in]  nPE        number of parallel processing units, 0 to select it automatically (see plp_auto_npe)
   @param[out] pRes     output result returned here
   @return        none
  */
@@ -61,12 +61,17 @@ void plp_dot_prod_q32_parallel(const int32_t *__restrict__ pSrcA,
                                uint32_t deciPoint,
                                uint32_t nPE,
                                int32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_dot_prod_q32(pSrcA, pSrcB, blockSize, deciPoint, pRes);
         return;
     } else {
 
+        if (nPE == 0) {
+            nPE = plp_auto_npe(PLP_COST_DOT_PROD_Q32, blockSize, 1);
+        }
+
         uint32_t i;
         int32_t resBuffer[hal_cl_nb_pe_cores()];
 
@@ -81,7 +86,7 @@ void plp_dot_prod_q32_parallel(const int32_t *__restrict__ pSrcA,
         S.resBuffer = resBuffer;
 
         // Fork the dot product to nPE cores (i.e. processing units)
-        hal_cl_team_fork(nPE, plp_dot_prod_q32p_xpulpv2, (void *)&S);
+        plp_cl_team_fork(nPE, plp_dot_prod_q32p_xpulpv2, (void *)&S);
 
         int sum = 0;
         for (i = 0; i < nPE; i++) { // not necessary hal_cl_nb_pe_cores()
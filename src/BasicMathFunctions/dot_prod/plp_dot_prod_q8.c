@@ -63,12 +63,11 @@ void plp_dot_prod_q8(const int8_t *__restrict__ pSrcA,
                      uint32_t blockSize,
                      uint32_t deciPoint,
                      int32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        plp_dot_prod_q8s_rv32im(pSrcA, pSrcB, blockSize, deciPoint, pRes);
-    } else {
-        plp_dot_prod_q8s_xpulpv2(pSrcA, pSrcB, blockSize, deciPoint, pRes);
-    }
+    plp_dot_prod_q8_kernel kernel =
+        (plp_dot_prod_q8_kernel)plp_dispatch(PLP_KERNEL_DOT_PROD_Q8, blockSize);
+    kernel(pSrcA, pSrcB, blockSize, deciPoint, pRes);
 }
 
 /**
@@ -57,8 +57,9 @@ void plp_log_f32_parallel(const float32_t *__restrict__ pSrc,
                                uint32_t blockSize,
                                uint32_t nPE,
                                float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
-    if (rt_cluster_id() == ARCHI_FC_CID) {
+    if (hal_cluster_id() == ARCHI_FC_CID && plp_fc_cluster_open() != 0) {
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
@@ -75,7 +76,7 @@ void plp_log_f32_parallel(const float32_t *__restrict__ pSrc,
         S.pDst = pDst;
 
         // Fork the dot product to nPE cores (i.e. processing units)
-        rt_team_fork(nPE, plp_log_f32p_xpulpv2, (void *)&S);
+        plp_cl_team_fork(nPE, plp_log_f32p_xpulpv2, (void *)&S);
 
         /* #if defined(PLP_MATH_LOOPUNROLL) */
         /* #undef PLP_MATH_LOOPUNROLL */
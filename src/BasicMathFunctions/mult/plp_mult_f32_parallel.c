@@ -49,7 +49,7 @@
   @param[in]  pSrcA      points to the first input vector
   @param[in]  pSrcB      points to the second input vector
   @param[in]  blockSize  number of samples in each vector
-  @param[in]  nPE        number of parallel processing units
+  @param[in]  nPE        number of parallel processing units, 0 to select it automatically (see plp_auto_npe)
   @param[out] pDst       points to output vector
   @return        none
  */
@@ -59,12 +59,17 @@ void plp_mult_f32_parallel(const float32_t *__restrict__ pSrcA,
                                uint32_t blockSize,
                                uint32_t nPE,
                                float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
-    if (rt_cluster_id() == ARCHI_FC_CID) {
+    if (hal_cluster_id() == ARCHI_FC_CID && plp_fc_cluster_open() != 0) {
         printf("parallel processing supported only for cluster side\n");
         return;
     } else {
 
+        if (nPE == 0) {
+            nPE = plp_auto_npe(PLP_COST_MULT_F32, blockSize, 1);
+        }
+
         uint32_t i, tmpblkSizePE = blockSize / nPE;
 
         plp_mult_instance_f32 S;
@@ -78,7 +83,7 @@ void plp_mult_f32_parallel(const float32_t *__restrict__ pSrcA,
         S.pDst = pDst;
 
         // Fork the dot product to nPE cores (i.e. processing units)
-        rt_team_fork(nPE, plp_mult_f32p_xpulpv2, (void *)&S);
+        plp_cl_team_fork(nPE, plp_mult_f32p_xpulpv2, (void *)&S);
 
         /* #if defined(PLP_MATH_LOOPUNROLL) */
         /* #undef PLP_MATH_LOOPUNROLL */
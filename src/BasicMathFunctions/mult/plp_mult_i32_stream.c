@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mult_i32_stream.c
+ * Description:  32-bit integer streamed multiplication glue code
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicMult
+  @{
+ */
+
+static void plp_mult_i32_stream_tile(const void *pSrcA,
+                                     const void *pSrcB,
+                                     void *pDst,
+                                     uint32_t blockSize,
+                                     void *pAcc __attribute__((unused)),
+                                     uint32_t first __attribute__((unused))) {
+    plp_mult_i32s_xpulpv2((const int32_t *)pSrcA, (const int32_t *)pSrcB, (int32_t *)pDst, blockSize);
+}
+
+static const plp_stream_op plp_mult_i32_stream_op = {
+    plp_mult_i32_stream_tile, NULL, 2, sizeof(int32_t), sizeof(int32_t), 0
+};
+
+/**
+  @brief Glue code for element-by-element multiplication of 32-bit integer vectors in L2.
+  @param[in]  pSrcA      points to the first input vector
+  @param[in]  pSrcB      points to the second input vector
+  @param[out] pDst       points to the output vector
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  nPE        number of parallel processing units
+  @return     none
+
+  @par
+  The vectors may be stored in L2, they are streamed through L1 with the cluster DMA (see
+  plp_stream).
+ */
+void plp_mult_i32_stream(const int32_t *pSrcA,
+                         const int32_t *pSrcB,
+                         int32_t *pDst,
+                         uint32_t blockSize,
+                         uint32_t nPE) {
+    PLP_PROFILE_FUNC();
+
+    plp_stream(&plp_mult_i32_stream_op, pSrcA, pSrcB, pDst, blockSize, nPE, NULL);
+}
+
+/**
+  @} end of BasicMult group
+ */
@@ -58,12 +58,11 @@ void plp_mult_i8(const int8_t * pSrcA,
                  const int8_t * pSrcB,
                  int32_t * pDst,
                  uint32_t blockSize) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-      plp_mult_i8s_rv32im(pSrcA, pSrcB, pDst, blockSize);
-    } else {
-      plp_mult_i8s_xpulpv2(pSrcA, pSrcB, pDst, blockSize);
-    }
+    plp_elementwise_i8_kernel kernel =
+        (plp_elementwise_i8_kernel)plp_dispatch(PLP_KERNEL_MULT_I8, blockSize);
+    kernel(pSrcA, pSrcB, pDst, blockSize);
 }
 
 /**
@@ -48,8 +48,9 @@
  */
 
 void plp_negate_f32(const float32_t * pSrc, float32_t * pDst, uint32_t blockSize) {
+    PLP_PROFILE_FUNC();
 
-    if (rt_cluster_id() == ARCHI_FC_CID) {
+    if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
         return;
     } else {
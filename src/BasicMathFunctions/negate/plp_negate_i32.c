@@ -50,8 +50,9 @@
 void plp_negate_i32(const int32_t * pSrc,
                     int32_t * pDst,
                     uint32_t blockSize) {
+    PLP_PROFILE_FUNC();
 
-    if (rt_cluster_id() == ARCHI_FC_CID) {
+    if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_negate_i32s_rv32im(pSrc, pDst, blockSize);
     } else {
         plp_negate_i32s_xpulpv2(pSrc, pDst, blockSize);
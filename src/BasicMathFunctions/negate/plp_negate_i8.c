@@ -48,8 +48,9 @@
  */
 
 void plp_negate_i8(const int8_t * pSrc, int8_t * pDst, uint32_t blockSize) {
+    PLP_PROFILE_FUNC();
 
-    if (rt_cluster_id() == ARCHI_FC_CID) {
+    if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_negate_i8s_rv32im(pSrc, pDst, blockSize);
     } else {
         plp_negate_i8s_xpulpv2(pSrc, pDst, blockSize);
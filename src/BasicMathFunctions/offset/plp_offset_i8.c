@@ -49,8 +49,9 @@
  */
 
 void plp_offset_i8(const int8_t * pSrc,  int8_t offset,  int8_t * pDst, uint32_t blockSize) {
+    PLP_PROFILE_FUNC();
 
-    if (rt_cluster_id() == ARCHI_FC_CID) {
+    if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_offset_i8s_rv32im(pSrc, offset, pDst, blockSize);
     } else {
         plp_offset_i8s_xpulpv2(pSrc, offset, pDst, blockSize);
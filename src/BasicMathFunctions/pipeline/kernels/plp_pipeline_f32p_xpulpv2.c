@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pipeline_f32p_xpulpv2.c
+ * Description:  32-bit float parallel fused elementwise pipeline for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicPipeline
+ */
+
+/**
+  @addtogroup BasicPipelineKernels
+  @{
+ */
+
+/**
+  @brief      Parallel fused elementwise pipeline for 32-bit floats on XpulpV2
+  @param[in]  S     points to the instance structure plp_pipeline_instance_f32
+  @return     none
+
+  @par
+  Each core processes a contiguous chunk of the vectors. The chunks are a multiple of four
+  elements, such that the vector accesses of the sequential kernel stay aligned.
+ */
+
+void plp_pipeline_f32p_xpulpv2(void *S) {
+
+    plp_pipeline_instance_f32 *args = (plp_pipeline_instance_f32 *)S;
+    uint32_t core_id = hal_core_id();
+    uint32_t blockSize = args->blockSize;
+    uint32_t per_core = ((blockSize + args->nPE - 1) / args->nPE + 3) & ~3U;
+    uint32_t start = core_id * per_core;
+    uint32_t k;
+
+    if (start >= blockSize) {
+        return;
+    }
+
+    uint32_t len = blockSize - start < per_core ? blockSize - start : per_core;
+
+    /* the operand vectors of the stages must point to the chunk of this core as well */
+    plp_pipeline_op_f32 ops[PLP_PIPELINE_MAX_OPS];
+    for (k = 0; k < args->numOps; k++) {
+        ops[k] = args->pOps[k];
+        if (ops[k].pSrc != NULL) {
+            ops[k].pSrc += start;
+        }
+    }
+
+    plp_pipeline_f32s_xpulpv2(args->pSrc + start, ops, args->numOps, len, args->pDst + start);
+}
+
+/**
+   @} end of BasicPipelineKernels group
+*/
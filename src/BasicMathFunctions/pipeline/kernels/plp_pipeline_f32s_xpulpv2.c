@@ -0,0 +1,166 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pipeline_f32s_xpulpv2.c
+ * Description:  32-bit float fused elementwise pipeline for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicPipeline
+ */
+
+/**
+  @addtogroup BasicPipelineKernels
+  @{
+ */
+
+static inline float32_t plp_pipeline_f32_stage(const plp_pipeline_op_f32 *op,
+                                                float32_t x,
+                                                uint32_t n) {
+    switch (op->op) {
+    case PLP_PIPELINE_SCALE:
+        return x * op->value;
+    case PLP_PIPELINE_OFFSET:
+        return x + op->value;
+    case PLP_PIPELINE_MULT:
+        return x * op->pSrc[n];
+    case PLP_PIPELINE_ADD:
+        return x + op->pSrc[n];
+    case PLP_PIPELINE_SUB:
+        return x - op->pSrc[n];
+    case PLP_PIPELINE_ABS:
+        return fabsf(x);
+    case PLP_PIPELINE_NEGATE:
+        return -x;
+    default:
+        return x;
+    }
+}
+
+/**
+  @brief      Fused elementwise pipeline for 32-bit floats on XpulpV2
+  @param[in]     pSrc       points to the input vector
+  @param[in]     pOps       points to the stages of the pipeline
+  @param[in]     numOps     number of stages
+  @param[in]     blockSize  number of samples in each vector
+  @param[out]    pDst       points to the output vector
+  @return     none
+
+  @par
+  Four values are kept in registers while all stages are applied to them, such that the stages are
+  decoded once for every four elements.
+ */
+
+void plp_pipeline_f32s_xpulpv2(const float32_t *pSrc,
+                               const plp_pipeline_op_f32 *pOps,
+                               uint32_t numOps,
+                               uint32_t blockSize,
+                               float32_t *pDst) {
+
+    uint32_t i = 0;
+    uint32_t k;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    float32_t x0, x1, x2, x3;
+
+    for (; i < (blockSize & ~3U); i += 4) {
+        x0 = pSrc[i];
+        x1 = pSrc[i + 1];
+        x2 = pSrc[i + 2];
+        x3 = pSrc[i + 3];
+
+        for (k = 0; k < numOps; k++) {
+            const plp_pipeline_op_f32 *op = &pOps[k];
+
+            switch (op->op) {
+            case PLP_PIPELINE_SCALE:
+                x0 *= op->value;
+                x1 *= op->value;
+                x2 *= op->value;
+                x3 *= op->value;
+                break;
+            case PLP_PIPELINE_OFFSET:
+                x0 += op->value;
+                x1 += op->value;
+                x2 += op->value;
+                x3 += op->value;
+                break;
+            case PLP_PIPELINE_MULT:
+                x0 *= op->pSrc[i];
+                x1 *= op->pSrc[i + 1];
+                x2 *= op->pSrc[i + 2];
+                x3 *= op->pSrc[i + 3];
+                break;
+            case PLP_PIPELINE_ADD:
+                x0 += op->pSrc[i];
+                x1 += op->pSrc[i + 1];
+                x2 += op->pSrc[i + 2];
+                x3 += op->pSrc[i + 3];
+                break;
+            case PLP_PIPELINE_SUB:
+                x0 -= op->pSrc[i];
+                x1 -= op->pSrc[i + 1];
+                x2 -= op->pSrc[i + 2];
+                x3 -= op->pSrc[i + 3];
+                break;
+            case PLP_PIPELINE_ABS:
+                x0 = fabsf(x0);
+                x1 = fabsf(x1);
+                x2 = fabsf(x2);
+                x3 = fabsf(x3);
+                break;
+            case PLP_PIPELINE_NEGATE:
+                x0 = -x0;
+                x1 = -x1;
+                x2 = -x2;
+                x3 = -x3;
+                break;
+            }
+        }
+
+        pDst[i] = x0;
+        pDst[i + 1] = x1;
+        pDst[i + 2] = x2;
+        pDst[i + 3] = x3;
+    }
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    for (; i < blockSize; i++) {
+        float32_t x = pSrc[i];
+
+        for (k = 0; k < numOps; k++) {
+            x = plp_pipeline_f32_stage(&pOps[k], x, i);
+        }
+
+        pDst[i] = x;
+    }
+}
+
+/**
+   @} end of BasicPipelineKernels group
+*/
@@ -0,0 +1,101 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pipeline_i16s_rv32im.c
+ * Description:  16-bit integer fused elementwise pipeline for RV32IM
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicPipeline
+ */
+
+/**
+  @defgroup BasicPipelineKernels Fused Elementwise Pipeline Kernels
+  Apply a list of elementwise stages to a vector in a single pass, see the Module Fused Elementwise
+  Pipeline.
+ */
+
+/**
+  @addtogroup BasicPipelineKernels
+  @{
+ */
+
+static inline int16_t plp_pipeline_i16_stage(const plp_pipeline_op_i16 *op,
+                                             int16_t x,
+                                             uint32_t n) {
+    switch (op->op) {
+    case PLP_PIPELINE_SCALE:
+        return (int16_t)(((int32_t)x * op->value) >> op->shift);
+    case PLP_PIPELINE_OFFSET:
+        return (int16_t)(x + op->value);
+    case PLP_PIPELINE_MULT:
+        return (int16_t)(((int32_t)x * op->pSrc[n]) >> op->shift);
+    case PLP_PIPELINE_ADD:
+        return (int16_t)(x + op->pSrc[n]);
+    case PLP_PIPELINE_SUB:
+        return (int16_t)(x - op->pSrc[n]);
+    case PLP_PIPELINE_ABS:
+        return (int16_t)__builtin_abs(x);
+    case PLP_PIPELINE_NEGATE:
+        return (int16_t)(-x);
+    default:
+        return x;
+    }
+}
+
+/**
+  @brief      Fused elementwise pipeline for 16-bit integers on RV32IM
+  @param[in]     pSrc       points to the input vector
+  @param[in]     pOps       points to the stages of the pipeline
+  @param[in]     numOps     number of stages
+  @param[in]     blockSize  number of samples in each vector
+  @param[out]    pDst       points to the output vector
+  @return     none
+ */
+
+void plp_pipeline_i16s_rv32im(const int16_t *pSrc,
+                              const plp_pipeline_op_i16 *pOps,
+                              uint32_t numOps,
+                              uint32_t blockSize,
+                              int16_t *pDst) {
+
+    uint32_t i = 0;
+    uint32_t k;
+
+    for (; i < blockSize; i++) {
+        int16_t x = pSrc[i];
+
+        for (k = 0; k < numOps; k++) {
+            x = plp_pipeline_i16_stage(&pOps[k], x, i);
+        }
+
+        pDst[i] = x;
+    }
+}
+
+/**
+   @} end of BasicPipelineKernels group
+*/
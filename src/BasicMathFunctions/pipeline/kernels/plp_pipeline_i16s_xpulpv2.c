@@ -0,0 +1,156 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pipeline_i16s_xpulpv2.c
+ * Description:  16-bit integer fused elementwise pipeline for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicPipeline
+ */
+
+/**
+  @addtogroup BasicPipelineKernels
+  @{
+ */
+
+static inline int16_t plp_pipeline_i16_stage(const plp_pipeline_op_i16 *op,
+                                             int16_t x,
+                                             uint32_t n) {
+    switch (op->op) {
+    case PLP_PIPELINE_SCALE:
+        return (int16_t)(((int32_t)x * op->value) >> op->shift);
+    case PLP_PIPELINE_OFFSET:
+        return (int16_t)(x + op->value);
+    case PLP_PIPELINE_MULT:
+        return (int16_t)(((int32_t)x * op->pSrc[n]) >> op->shift);
+    case PLP_PIPELINE_ADD:
+        return (int16_t)(x + op->pSrc[n]);
+    case PLP_PIPELINE_SUB:
+        return (int16_t)(x - op->pSrc[n]);
+    case PLP_PIPELINE_ABS:
+        return (int16_t)__builtin_abs(x);
+    case PLP_PIPELINE_NEGATE:
+        return (int16_t)(-x);
+    default:
+        return x;
+    }
+}
+
+/**
+  @brief      Fused elementwise pipeline for 16-bit integers on XpulpV2
+  @param[in]     pSrc       points to the input vector
+  @param[in]     pOps       points to the stages of the pipeline
+  @param[in]     numOps     number of stages
+  @param[in]     blockSize  number of samples in each vector
+  @param[out]    pDst       points to the output vector
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Four values are kept in registers, packed two each into 32 bit vectors, while all stages are
+  applied to them. Additions, subtractions, absolute values and negations are computed on both
+  lanes with a single instruction.
+ */
+
+void plp_pipeline_i16s_xpulpv2(const int16_t *pSrc,
+                               const plp_pipeline_op_i16 *pOps,
+                               uint32_t numOps,
+                               uint32_t blockSize,
+                               int16_t *pDst) {
+
+    uint32_t i = 0;
+    uint32_t k;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    v2s a, b, c, d;
+    int32_t value, shift;
+
+    for (; i < (blockSize & ~3U); i += 4) {
+        a = *((v2s *)(pSrc + i));
+        b = *((v2s *)(pSrc + i + 2));
+
+        for (k = 0; k < numOps; k++) {
+            const plp_pipeline_op_i16 *op = &pOps[k];
+
+            switch (op->op) {
+            case PLP_PIPELINE_SCALE:
+                value = op->value;
+                shift = op->shift;
+                a = __PACK2((a[0] * value) >> shift, (a[1] * value) >> shift);
+                b = __PACK2((b[0] * value) >> shift, (b[1] * value) >> shift);
+                break;
+            case PLP_PIPELINE_OFFSET:
+                c = __PACK2(op->value, op->value);
+                a = __ADD2(a, c);
+                b = __ADD2(b, c);
+                break;
+            case PLP_PIPELINE_MULT:
+                c = *((v2s *)(op->pSrc + i));
+                d = *((v2s *)(op->pSrc + i + 2));
+                shift = op->shift;
+                a = __PACK2((a[0] * c[0]) >> shift, (a[1] * c[1]) >> shift);
+                b = __PACK2((b[0] * d[0]) >> shift, (b[1] * d[1]) >> shift);
+                break;
+            case PLP_PIPELINE_ADD:
+                a = __ADD2(a, *((v2s *)(op->pSrc + i)));
+                b = __ADD2(b, *((v2s *)(op->pSrc + i + 2)));
+                break;
+            case PLP_PIPELINE_SUB:
+                a = __SUB2(a, *((v2s *)(op->pSrc + i)));
+                b = __SUB2(b, *((v2s *)(op->pSrc + i + 2)));
+                break;
+            case PLP_PIPELINE_ABS:
+                a = __ABS2(a);
+                b = __ABS2(b);
+                break;
+            case PLP_PIPELINE_NEGATE:
+                a = __NEG2(a);
+                b = __NEG2(b);
+                break;
+            }
+        }
+
+        *((v2s *)(pDst + i)) = a;
+        *((v2s *)(pDst + i + 2)) = b;
+    }
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    for (; i < blockSize; i++) {
+        int16_t x = pSrc[i];
+
+        for (k = 0; k < numOps; k++) {
+            x = plp_pipeline_i16_stage(&pOps[k], x, i);
+        }
+
+        pDst[i] = x;
+    }
+}
+
+/**
+   @} end of BasicPipelineKernels group
+*/
@@ -0,0 +1,147 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pipeline_i8s_xpulpv2.c
+ * Description:  8-bit integer fused elementwise pipeline for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup BasicPipeline
+ */
+
+/**
+  @addtogroup BasicPipelineKernels
+  @{
+ */
+
+static inline int8_t plp_pipeline_i8_stage(const plp_pipeline_op_i8 *op,
+                                           int8_t x,
+                                           uint32_t n) {
+    switch (op->op) {
+    case PLP_PIPELINE_SCALE:
+        return (int8_t)(((int32_t)x * op->value) >> op->shift);
+    case PLP_PIPELINE_OFFSET:
+        return (int8_t)(x + op->value);
+    case PLP_PIPELINE_MULT:
+        return (int8_t)(((int32_t)x * op->pSrc[n]) >> op->shift);
+    case PLP_PIPELINE_ADD:
+        return (int8_t)(x + op->pSrc[n]);
+    case PLP_PIPELINE_SUB:
+        return (int8_t)(x - op->pSrc[n]);
+    case PLP_PIPELINE_ABS:
+        return (int8_t)__builtin_abs(x);
+    case PLP_PIPELINE_NEGATE:
+        return (int8_t)(-x);
+    default:
+        return x;
+    }
+}
+
+/**
+  @brief      Fused elementwise pipeline for 8-bit integers on XpulpV2
+  @param[in]     pSrc       points to the input vector
+  @param[in]     pOps       points to the stages of the pipeline
+  @param[in]     numOps     number of stages
+  @param[in]     blockSize  number of samples in each vector
+  @param[out]    pDst       points to the output vector
+  @return     none
+
+  @par Exploiting SIMD instructions
+  Four values are kept in registers, packed into one 32 bit vector, while all stages are applied to
+  them. Additions, subtractions, absolute values and negations are computed on all four lanes with
+  a single instruction.
+ */
+
+void plp_pipeline_i8s_xpulpv2(const int8_t *pSrc,
+                              const plp_pipeline_op_i8 *pOps,
+                              uint32_t numOps,
+                              uint32_t blockSize,
+                              int8_t *pDst) {
+
+    uint32_t i = 0;
+    uint32_t k;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    v4s a, c;
+    int32_t value, shift;
+
+    for (; i < (blockSize & ~3U); i += 4) {
+        a = *((v4s *)(pSrc + i));
+
+        for (k = 0; k < numOps; k++) {
+            const plp_pipeline_op_i8 *op = &pOps[k];
+
+            switch (op->op) {
+            case PLP_PIPELINE_SCALE:
+                value = op->value;
+                shift = op->shift;
+                a = __PACK4((a[0] * value) >> shift, (a[1] * value) >> shift,
+                            (a[2] * value) >> shift, (a[3] * value) >> shift);
+                break;
+            case PLP_PIPELINE_OFFSET:
+                a = __ADD4(a, __PACK4(op->value, op->value, op->value, op->value));
+                break;
+            case PLP_PIPELINE_MULT:
+                c = *((v4s *)(op->pSrc + i));
+                shift = op->shift;
+                a = __PACK4((a[0] * c[0]) >> shift, (a[1] * c[1]) >> shift,
+                            (a[2] * c[2]) >> shift, (a[3] * c[3]) >> shift);
+                break;
+            case PLP_PIPELINE_ADD:
+                a = __ADD4(a, *((v4s *)(op->pSrc + i)));
+                break;
+            case PLP_PIPELINE_SUB:
+                a = __SUB4(a, *((v4s *)(op->pSrc + i)));
+                break;
+            case PLP_PIPELINE_ABS:
+                a = __ABS4(a);
+                break;
+            case PLP_PIPELINE_NEGATE:
+                a = __NEG4(a);
+                break;
+            }
+        }
+
+        *((v4s *)(pDst + i)) = a;
+    }
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    for (; i < blockSize; i++) {
+        int8_t x = pSrc[i];
+
+        for (k = 0; k < numOps; k++) {
+            x = plp_pipeline_i8_stage(&pOps[k], x, i);
+        }
+
+        pDst[i] = x;
+    }
+}
+
+/**
+   @} end of BasicPipelineKernels group
+*/
@@ -0,0 +1,91 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pipeline_f32.c
+ * Description:  32-bit float fused elementwise pipeline glue code
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @defgroup BasicPipeline Fused Elementwise Pipeline
+  This module contains the glue code for the fused elementwise pipeline. The kernel codes (kernels)
+  are in the Module Fused Elementwise Pipeline Kernels.
+  A chain of elementwise functions (e.g. plp_mult_f32, plp_offset_f32 and plp_scale_f32) loads and
+  stores the whole vector once per function. The fused pipeline applies a short list of stages
+  (plp_pipeline_op_f32, plp_pipeline_op_i16 or plp_pipeline_op_i8) to the vector in a single pass:
+  the intermediate values stay in registers, such that each element is loaded and stored only once.
+  <pre>
+      // pDst[n] = |pSrc[n] * window[n] + 1e-6| * 0.5
+      plp_pipeline_op_f32 ops[] = {
+          { PLP_PIPELINE_MULT, window, 0 },
+          { PLP_PIPELINE_OFFSET, NULL, 1e-6f },
+          { PLP_PIPELINE_ABS, NULL, 0 },
+          { PLP_PIPELINE_SCALE, NULL, 0.5f },
+      };
+      plp_pipeline_f32(pSrc, ops, 4, blockSize, pDst);
+  </pre>
+  For integers, the result of each stage is truncated to the width of the data type, like with the
+  corresponding plp_scale, plp_offset, plp_add, plp_sub, plp_abs and plp_negate functions. The
+  stages PLP_PIPELINE_SCALE and PLP_PIPELINE_MULT shift the product right by shift bits.
+  pDst can be the same as pSrc.
+ */
+
+/**
+  @addtogroup BasicPipeline
+  @{
+ */
+
+/**
+  @brief      Glue code of the fused elementwise pipeline for 32-bit floats
+  @param[in]     pSrc       points to the input vector
+  @param[in]     pOps       points to the stages of the pipeline
+  @param[in]     numOps     number of stages
+  @param[in]     blockSize  number of samples in each vector
+  @param[out]    pDst       points to the output vector
+  @return     none
+ */
+
+void plp_pipeline_f32(const float32_t *pSrc,
+                      const plp_pipeline_op_f32 *pOps,
+                      uint32_t numOps,
+                      uint32_t blockSize,
+                      float32_t *pDst) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_pipeline_f32s_xpulpv2(pSrc, pOps, numOps, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of BasicPipeline group
+ */
@@ -0,0 +1,83 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pipeline_f32_parallel.c
+ * Description:  32-bit float parallel fused elementwise pipeline glue code
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicPipeline
+  @{
+ */
+
+/**
+  @brief      Glue code of the parallel fused elementwise pipeline for 32-bit floats
+  @param[in]     pSrc       points to the input vector
+  @param[in]     pOps       points to the stages of the pipeline
+  @param[in]     numOps     number of stages, at most PLP_PIPELINE_MAX_OPS
+  @param[in]     blockSize  number of samples in each vector
+  @param[in]     nPE        number of parallel processing units
+  @param[out]    pDst       points to the output vector
+  @return     none
+ */
+
+void plp_pipeline_f32_parallel(const float32_t *pSrc,
+                               const plp_pipeline_op_f32 *pOps,
+                               uint32_t numOps,
+                               uint32_t blockSize,
+                               uint32_t nPE,
+                               float32_t *pDst) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID && plp_fc_cluster_open() != 0) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    if (numOps > PLP_PIPELINE_MAX_OPS) {
+        printf("error: the pipeline has more than PLP_PIPELINE_MAX_OPS stages\n");
+        return;
+    }
+
+    plp_pipeline_instance_f32 S;
+
+    S.pSrc = pSrc;
+    S.pOps = pOps;
+    S.numOps = numOps;
+    S.blockSize = blockSize;
+    S.nPE = nPE;
+    S.pDst = pDst;
+
+    plp_cl_team_fork(nPE, plp_pipeline_f32p_xpulpv2, (void *)&S);
+}
+
+/**
+  @} end of BasicPipeline group
+ */
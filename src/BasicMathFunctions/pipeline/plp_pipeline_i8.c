@@ -0,0 +1,66 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_pipeline_i8.c
+ * Description:  8-bit integer fused elementwise pipeline glue code
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMath
+ */
+
+/**
+  @addtogroup BasicPipeline
+  @{
+ */
+
+/**
+  @brief      Glue code of the fused elementwise pipeline for 8-bit integers
+  @param[in]     pSrc       points to the input vector
+  @param[in]     pOps       points to the stages of the pipeline
+  @param[in]     numOps     number of stages
+  @param[in]     blockSize  number of samples in each vector
+  @param[out]    pDst       points to the output vector
+  @return     none
+ */
+
+void plp_pipeline_i8(const int8_t *pSrc,
+                     const plp_pipeline_op_i8 *pOps,
+                     uint32_t numOps,
+                     uint32_t blockSize,
+                     int8_t *pDst) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_pipeline_i8s_rv32im(pSrc, pOps, numOps, blockSize, pDst);
+    } else {
+        plp_pipeline_i8s_xpulpv2(pSrc, pOps, numOps, blockSize, pDst);
+    }
+}
+
+/**
+  @} end of BasicPipeline group
+ */
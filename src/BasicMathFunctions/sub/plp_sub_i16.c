@@ -59,12 +59,11 @@
  */
 
 void plp_sub_i16(const int16_t * pSrcA, const int16_t * pSrcB, int32_t * pDst, uint32_t blockSize) {
+    PLP_PROFILE_FUNC();
 
-    if (rt_cluster_id() == ARCHI_FC_CID) {
-        plp_sub_i16s_rv32im(pSrcA, pSrcB, pDst, blockSize);
-    } else {
-        plp_sub_i16s_xpulpv2(pSrcA, pSrcB, pDst, blockSize);
-    }
+    plp_elementwise_i16_kernel kernel =
+        (plp_elementwise_i16_kernel)plp_dispatch(PLP_KERNEL_SUB_I16, blockSize);
+    kernel(pSrcA, pSrcB, pDst, blockSize);
 }
 
 /**
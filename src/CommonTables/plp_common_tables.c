@@ -11505,6 +11505,34 @@ const float32_t values_fb_32[245] = {
 	0.60155368f,  0.48124278f,  0.36093184f,  0.24062091f,  0.12030999f
 };
 
+const int16_t values_fb_32_q16[245] = {
+	 8752, 32487,  9519,   281, 23249, 20061, 12707, 31220, 10720,  1548,
+	22048, 23528,  4161,  9240, 28607, 18402,   105, 14366, 32663, 15581,
+	17187, 31157, 14827,  1611, 17941, 31347, 15919,   491,  1421, 16849,
+	32277, 18657,  4081, 14111, 28687, 22854,  9084,  9914, 23684, 28341,
+	15332,  2323,  4427, 17436, 30445, 22673, 10383, 10095, 22385, 30966,
+	19355,  7745,  1802, 13413, 25023, 29115, 18146,  7177,  3653, 14622,
+	25591, 29186, 18823,  8460,  3582, 13945, 24308, 30970, 21180, 11390,
+	 1599,  1798, 11588, 21378, 31169, 25030, 15781,  6532,  7738, 16987,
+	26236, 30201, 21463, 12725,  3987,  2567, 11305, 20043, 28781, 28279,
+	20024, 11769,  3514,  4489, 12744, 20999, 29254, 28289, 20490, 12691,
+	 4892,  4479, 12278, 20077, 27876, 30022, 22654, 15286,  7918,   550,
+	 2746, 10114, 17482, 24850, 32218, 26327, 19367, 12406,  5445,  6441,
+	13401, 20362, 27323, 31336, 24760, 18184, 11608,  5032,  1432,  8008,
+	14584, 21160, 27736, 31309, 25097, 18884, 12672,  6459,   247,  1459,
+	 7671, 13884, 20096, 26309, 32521, 27132, 21262, 15393,  9524,  3655,
+	 5636, 11506, 17375, 23244, 29113, 30676, 25131, 19586, 14041,  8496,
+	 2951,  2092,  7637, 13182, 18727, 24272, 29817, 30318, 25079, 19841,
+	14602,  9364,  4125,  2450,  7689, 12927, 18166, 23404, 28643, 31716,
+	26767, 21819, 16870, 11921,  6972,  2023,  1052,  6000, 10949, 15898,
+	20847, 25796, 30745, 30003, 25328, 20653, 15977, 11302,  6626,  1951,
+	 2765,  7440, 12115, 16791, 21466, 26142, 30817, 30194, 25777, 21360,
+	16943, 12526,  8109,  3691,  2574,  6991, 11408, 15825, 20242, 24659,
+	29077, 32082, 27910, 23737, 19564, 15391, 11218,  7045,  2872,   686,
+	 4858,  9031, 13204, 17377, 21550, 25723, 29896, 31539, 27596, 23654,
+	19712, 15769, 11827,  7885,  3942
+};
+
 // periodic hann window
 const float32_t hannWindow_f32_len512[512] = {
 	0.00000000f,  0.00003764f,  0.00015059f,  0.00033882f,  0.00060228f,
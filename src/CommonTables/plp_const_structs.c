@@ -86,6 +86,42 @@ const plp_cfft_instance_q32 plp_cfft_sR_q32_len4096 = { 4096, twiddleCoef_4096_q
                                                         plpBitRevIndexTable_fixed_4096,
                                                         PLPBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH };
 
+/* rfft q16 and q32, the twiddle factors are the ones of the complex FFT of N points */
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len32 = { 32, &plp_cfft_sR_q16_len16,
+                                                      twiddleCoef_32_q16 };
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len64 = { 64, &plp_cfft_sR_q16_len32,
+                                                      twiddleCoef_64_q16 };
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len128 = { 128, &plp_cfft_sR_q16_len64,
+                                                       twiddleCoef_128_q16 };
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len256 = { 256, &plp_cfft_sR_q16_len128,
+                                                       twiddleCoef_256_q16 };
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len512 = { 512, &plp_cfft_sR_q16_len256,
+                                                       twiddleCoef_512_q16 };
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len1024 = { 1024, &plp_cfft_sR_q16_len512,
+                                                        twiddleCoef_1024_q16 };
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len2048 = { 2048, &plp_cfft_sR_q16_len1024,
+                                                        twiddleCoef_2048_q16 };
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len4096 = { 4096, &plp_cfft_sR_q16_len2048,
+                                                        twiddleCoef_4096_q16 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len32 = { 32, &plp_cfft_sR_q32_len16,
+                                                      twiddleCoef_32_q32 };
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len64 = { 64, &plp_cfft_sR_q32_len32,
+                                                      twiddleCoef_64_q32 };
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len128 = { 128, &plp_cfft_sR_q32_len64,
+                                                       twiddleCoef_128_q32 };
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len256 = { 256, &plp_cfft_sR_q32_len128,
+                                                       twiddleCoef_256_q32 };
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len512 = { 512, &plp_cfft_sR_q32_len256,
+                                                       twiddleCoef_512_q32 };
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len1024 = { 1024, &plp_cfft_sR_q32_len512,
+                                                        twiddleCoef_1024_q32 };
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len2048 = { 2048, &plp_cfft_sR_q32_len1024,
+                                                        twiddleCoef_2048_q32 };
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len4096 = { 4096, &plp_cfft_sR_q32_len2048,
+                                                        twiddleCoef_4096_q32 };
+
 /* cfft f32 */
 
 const plp_cfft_instance_f32 plp_cfft_sR_f32_len16 = {  16, (float32_t *)twiddleCoef_cfft_16,
@@ -147,6 +183,13 @@ const plp_triangular_filter_f32 plp_triangular_filter_f32_32 = {
 	32
 };
 
+const plp_triangular_filter_q16 plp_triangular_filter_q16_32 = {
+	values_fb_32_q16,
+	startingIndices_fb_32,
+	filterLengths_fb_32,
+	32
+};
+
 
 const plp_dwt_wavelet_f32 PLP_DWT_HAAR_f32 = {
     .length = 2,
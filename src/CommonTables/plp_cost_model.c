@@ -0,0 +1,45 @@
+/** ==========================================================================
+ * @file     plp_cost_model.c
+ * @brief    Cost models of the parallel functions, used by plp_auto_npe
+ * @version  V0
+ * @date     17. Oct 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Hand-written estimates, NOT calibrated: the per-unit costs are rough guesses derived from the
+ * dot product cycles of the tutorial, the fixed and per-core costs are guesses. The core counts
+ * chosen with them may be far from the best ones. Replace this file with the output of
+ * test/mrWolf/cost_model.py, fitted to benchmarks of the target sweeping nPE.
+ * { fixed, perCore, perUnit (1/256 cycles) }, see plp_cost_model. */
+
+#include "plp_math.h"
+
+plp_cost_model plp_cost_models[PLP_COST_NB] = {
+    [PLP_COST_DOT_PROD_I32] = { 100, 30, 820 },
+    [PLP_COST_DOT_PROD_Q32] = { 100, 30, 900 },
+    [PLP_COST_DOT_PROD_F32] = { 120, 40, 770 },
+    [PLP_COST_MULT_F32] = { 100, 30, 1020 },
+    [PLP_COST_MAT_MULT_I32] = { 80, 25, 520 },
+    [PLP_COST_MAT_MULT_I16] = { 80, 25, 300 },
+    [PLP_COST_MAT_MULT_I8] = { 80, 25, 170 },
+    [PLP_COST_MAT_MULT_Q32] = { 80, 25, 560 },
+    [PLP_COST_MAT_MULT_Q16] = { 80, 25, 320 },
+    [PLP_COST_MAT_MULT_Q8] = { 80, 25, 180 },
+    [PLP_COST_MAT_MULT_F32] = { 80, 25, 640 },
+};
@@ -81,6 +81,7 @@ void plp_cmplx_dot_prod_i32(const int32_t *__restrict__ pSrcA,
                             uint32_t numSamples,
                             int32_t *__restrict__ realResult,
                             int32_t *__restrict__ imagResult) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_cmplx_dot_prod_i32_rv32im(pSrcA, pSrcB, numSamples, realResult, imagResult);
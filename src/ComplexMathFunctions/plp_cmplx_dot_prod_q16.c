@@ -83,6 +83,7 @@ void plp_cmplx_dot_prod_q16(const int16_t *__restrict__ pSrcA,
                             uint32_t deciPoint,
                             int16_t *__restrict__ realResult,
                             int16_t *__restrict__ imagResult) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_cmplx_dot_prod_q16_rv32im(pSrcA, pSrcB, numSamples, deciPoint, realResult, imagResult);
@@ -79,6 +79,7 @@
 void plp_cmplx_mag_i16(const int16_t *pSrc,
                        int16_t *pRes,
                        uint32_t numSamples){
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID){
         plp_cmplx_mag_i16s_rv32im(pSrc, pRes, numSamples);
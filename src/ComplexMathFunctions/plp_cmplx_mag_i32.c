@@ -79,6 +79,7 @@
 void plp_cmplx_mag_i32(const int32_t *pSrc,
                        int32_t *pRes,
                        uint32_t numSamples){
+    PLP_PROFILE_FUNC();
     if (hal_cluster_id() == ARCHI_FC_CID){
         plp_cmplx_mag_i32s_rv32im(pSrc, pRes, numSamples);
     }
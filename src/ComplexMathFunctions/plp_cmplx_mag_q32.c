@@ -81,6 +81,7 @@ void plp_cmplx_mag_q32(const int32_t *pSrc,
                        const uint32_t fracBits,
                        int32_t *pRes,
                        uint32_t numSamples){
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID){
         plp_cmplx_mag_q32s_rv32im(pSrc, fracBits, pRes, numSamples);
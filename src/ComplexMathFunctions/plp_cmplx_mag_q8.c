@@ -81,6 +81,7 @@ void plp_cmplx_mag_q8(const int8_t *pSrc,
                        const uint32_t fracBits,
                        int8_t *pRes,
                        uint32_t numSamples){
+    PLP_PROFILE_FUNC();
     if (hal_cluster_id() == ARCHI_FC_CID){
         plp_cmplx_mag_q8s_rv32im(pSrc, fracBits, pRes, numSamples);
     }
@@ -77,6 +77,7 @@ void plp_cmplx_mag_squared_q32(const int32_t *__restrict__ pSrc,
                                int32_t *__restrict__ pDst,
                                uint32_t deciPoint,
                                uint32_t numSamples) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_cmplx_mag_squared_q32_rv32im(pSrc, pDst, deciPoint, numSamples);
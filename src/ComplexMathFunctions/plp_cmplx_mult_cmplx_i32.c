@@ -77,6 +77,7 @@ void plp_cmplx_mult_cmplx_i32(const int32_t *__restrict__ pSrcA,
                               const int32_t *__restrict__ pSrcB,
                               int32_t *__restrict__ pDst,
                               uint32_t numSamples) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_cmplx_mult_cmplx_i32_rv32im(pSrcA, pSrcB, pDst, numSamples);
@@ -76,6 +76,7 @@ void plp_cmplx_mult_cmplx_i8(const int8_t *__restrict__ pSrcA,
                              const int8_t *__restrict__ pSrcB,
                              int8_t *__restrict__ pDst,
                              uint32_t numSamples) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_cmplx_mult_cmplx_i8_rv32im(pSrcA, pSrcB, pDst, numSamples);
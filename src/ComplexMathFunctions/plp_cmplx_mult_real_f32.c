@@ -72,6 +72,7 @@ void plp_cmplx_mult_real_f32(const float32_t *__restrict__ pSrcCmplx,
                              const float32_t *__restrict__ pSrcReal,
                              float32_t *__restrict__ pDst,
                              uint32_t numSamples) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("error: FC doesn't have FPU\n");
@@ -59,6 +59,7 @@ void plp_cosine_distance_f32_parallel(  const float32_t *__restrict__ pSrcA,
                                         uint32_t blockSize,
                                         uint32_t nPE,
                                         float32_t *__restrict__ pRes) {
+  PLP_PROFILE_FUNC();
   /*float32_t pwrA, pwrB;
   float32_t dot, tmp;
   plp_power_f32_parallel(pSrcA, blockSize, nPE, &pwrA);
@@ -69,8 +70,8 @@ void plp_cosine_distance_f32_parallel(  const float32_t *__restrict__ pSrcA,
   plp_sqrt_f32(&tmp, &tmp);
   *pRes = 1.0f - dot/tmp;*/
 
-  if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+  if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_cosine_distance_f32(pSrcA, pSrcB, blockSize, pRes);
         return;
     } else {
 
@@ -91,7 +92,7 @@ void plp_cosine_distance_f32_parallel(  const float32_t *__restrict__ pSrcA,
         S.resBuffer_B = resBuffer_B;
         S.resBuffer_dot = resBuffer_dot;
 
-        hal_cl_team_fork(2, plp_cosine_distance_f32p_xpulpv2, (void *)&S);
+        plp_cl_team_fork(2, plp_cosine_distance_f32p_xpulpv2, (void *)&S);
 
         float32_t pwrA = 0, pwrB=0;
         float32_t dot = 0;
@@ -117,7 +118,7 @@ void plp_cosine_distance_f32_parallel(  const float32_t *__restrict__ pSrcA,
         // POWER OF THE FIRST VECTOR
         S_pwr.pSrc = pSrcA;
         // Fork the dot product to nPE cores (i.e. processing units)
-        hal_cl_team_fork(nPEpwr, plp_power_f32p_xpulpv2, (void *)&S_pwr);
+        plp_cl_team_fork(nPEpwr, plp_power_f32p_xpulpv2, (void *)&S_pwr);
         float32_t pwrA = 0, tmpA;
         for (i = 0; i < nPE; i++) { // not necessary hal_cl_nb_pe_cores()
             pwrA += resBuffer_pwr[i];
@@ -130,7 +131,7 @@ void plp_cosine_distance_f32_parallel(  const float32_t *__restrict__ pSrcA,
         // POWER OF THE SECOND VECTOR
         S_pwr.pSrc = pSrcB;
         // Fork the dot product to nPE cores (i.e. processing units)
-        hal_cl_team_fork(nPE, plp_power_f32p_xpulpv2, (void *)&S_pwr);
+        plp_cl_team_fork(nPE, plp_power_f32p_xpulpv2, (void *)&S_pwr);
         float32_t pwrB = 0, tmpB;
         for (i = 0; i < nPE; i++) { // not necessary hal_cl_nb_pe_cores()
             pwrB += resBuffer_pwr[i];
@@ -156,7 +157,7 @@ void plp_cosine_distance_f32_parallel(  const float32_t *__restrict__ pSrcA,
         S_dot.resBuffer = resBuffer_dot;
 
         // Fork the dot product to nPE cores (i.e. processing units)
-        hal_cl_team_fork(nPEdot, plp_dot_prod_f32p_xpulpv2, (void *)&S_dot);
+        plp_cl_team_fork(nPEdot, plp_dot_prod_f32p_xpulpv2, (void *)&S_dot);
         float32_t dot = 0;
         for (i = 0; i < nPEdot; i++) { // not necessary hal_cl_nb_pe_cores()
             dot += resBuffer_dot[i];
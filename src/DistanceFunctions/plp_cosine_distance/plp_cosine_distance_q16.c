@@ -64,6 +64,7 @@ void plp_cosine_distance_q16(   const int16_t *__restrict__ pSrcA,
                                 uint16_t blockSize,
                                 uint16_t fracBits,
                                 int32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_cosine_distance_q16s_rv32im(pSrcA, pSrcB, blockSize, fracBits, pRes);
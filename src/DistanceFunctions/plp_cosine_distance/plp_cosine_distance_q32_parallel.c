@@ -65,6 +65,7 @@ void plp_cosine_distance_q32_parallel(  const int32_t *__restrict__ pSrcA,
                                         uint32_t fracBits,
                                         uint32_t nPE,
                                         int32_t *__restrict__ pRes) {
+  PLP_PROFILE_FUNC();
   int32_t pwrA, pwrB;
   int32_t dot, tmp;
   plp_power_q32_parallel(pSrcA, blockSize, fracBits, nPE, &pwrA);
@@ -64,9 +64,10 @@ void plp_euclidean_distance_f32_parallel( const float32_t *__restrict__ pSrcA,
                                           uint32_t blockSize,
                                           uint32_t nPE,
                                           float32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_euclidean_distance_f32(pSrcA, pSrcB, blockSize, pRes);
         return;
     } else {
 
@@ -83,7 +84,7 @@ void plp_euclidean_distance_f32_parallel( const float32_t *__restrict__ pSrcA,
         S.resBuffer = resBuffer;
 
         // Fork the dot product to nPE cores (i.e. processing units)
-        hal_cl_team_fork(nPE, plp_euclidean_distance_f32p_xpulpv2, (void *)&S);
+        plp_cl_team_fork(nPE, plp_euclidean_distance_f32p_xpulpv2, (void *)&S);
 
         float32_t sum = 0, tmp;
         for (i = 0; i < nPE; i++) { // not necessary hal_cl_nb_pe_cores()
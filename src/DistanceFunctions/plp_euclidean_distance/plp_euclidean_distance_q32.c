@@ -64,6 +64,7 @@ void plp_euclidean_distance_q32(  const int32_t *__restrict__ pSrcA,
                                   uint32_t blockSize,
                                   uint32_t fracBits,
                                   int32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_euclidean_distance_q32s_rv32im(pSrcA, pSrcB, blockSize, fracBits, pRes);
@@ -66,9 +66,10 @@ void plp_euclidean_distance_q32_parallel(   const int32_t *__restrict__ pSrcA,
                                             uint32_t fracBits,
                                             uint32_t nPE,
                                             uint32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_euclidean_distance_q32(pSrcA, pSrcB, blockSize, fracBits, (int32_t *)pRes);
         return;
     } else {
 
@@ -86,7 +87,7 @@ void plp_euclidean_distance_q32_parallel(   const int32_t *__restrict__ pSrcA,
         S.resBuffer = resBuffer;
 
         // Fork the dot product to nPE cores (i.e. processing units)
-        hal_cl_team_fork(nPE, plp_euclidean_distance_q32p_xpulpv2, (void *)&S);
+        plp_cl_team_fork(nPE, plp_euclidean_distance_q32p_xpulpv2, (void *)&S);
         int32_t sum = 0;
         for (i = 0; i < nPE; i++) {
             sum += resBuffer[i];
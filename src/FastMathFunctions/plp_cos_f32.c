@@ -43,6 +43,7 @@
  */
 
 float32_t plp_cos_f32(float32_t x) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         return 0.f;
@@ -58,6 +58,7 @@
 void plp_sqrt_q16(const int16_t *__restrict__ pSrc,
                   const uint32_t fracBits,
                   int16_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_sqrt_q16s_rv32im(pSrc, fracBits, pRes);
@@ -62,6 +62,7 @@ void plp_conv_parallel_OLA(uint32_t nPE,
     uint32_t cycles = nPE;
     uint32_t remainingcycles = cycles;
     uint32_t participants = nPE >> (1);
+    uint32_t addLength, addLengthsecond;
 
     plp_conv_tree_add_instance S = { .addOffset = srcAoffset,
                                      .addLengthfirst = resultsoffset,
@@ -74,8 +75,19 @@ void plp_conv_parallel_OLA(uint32_t nPE,
 
     while (remainingcycles > 1U) {
 
-        hal_cl_team_fork((S.coresPerVector * (S.numVectors >> 1)), plp_conv_parallel_OLA_kernel,
-                     (void *)&S);
+        plp_cl_team_fork(nPE, plp_conv_parallel_OLA_kernel, (void *)&S);
+
+        /* length of the last vector, updated after the fork such that no core reads it while the
+         * step is running */
+        addLengthsecond = (S.numVectors % 2) ? S.addLengthfirst : S.addLengthsecond;
+        addLength = (S.addLengthfirst >= addLengthsecond + S.addOffset)
+                        ? addLengthsecond
+                        : S.addLengthfirst - S.addOffset;
+        if (addLength >= addLengthsecond) {
+            S.addLengthsecond = S.addLengthfirst;
+        } else {
+            S.addLengthsecond = S.addLengthfirst + addLengthsecond - addLength;
+        }
 
         S.numVectors = S.numVectors - participants;
         S.blockOffset *= 2;
@@ -83,7 +95,9 @@ void plp_conv_parallel_OLA(uint32_t nPE,
         S.addOffset *= 2;
         remainingcycles = (remainingcycles + 1) >> 1;
         participants = S.numVectors >> 1;
-        S.coresPerVector = ((2 * nPE) / ((S.numVectors >> 1) << 1));
+        if (participants > 0) {
+            S.coresPerVector = ((2 * nPE) / (participants << 1));
+        }
     }
 }
 
@@ -58,6 +58,14 @@ void plp_conv_parallel_OLA_kernel(void *task_args) {
     const uint32_t addOffset = S->addOffset;
     const uint32_t addLengthfirst = S->addLengthfirst;
     const uint32_t numVectors = S->numVectors;
+
+    /* the team may be larger than the number of cores needed in this step */
+    if (coreId >= (numVectors >> 1) * coresPerVector) {
+        hal_team_barrier();
+        hal_team_barrier();
+        return;
+    }
+
     const uint32_t addLengthsecond =
         (coreId >= ((numVectors >> 1) - 1) * coresPerVector && !(numVectors % 2))
             ? S->addLengthsecond
@@ -83,6 +91,8 @@ void plp_conv_parallel_OLA_kernel(void *task_args) {
     int32_t *_pRes2 = (pRes + (shardId * sharedLength) + addLength + addOffset);
 #endif
 
+    /* add the overlapping part of the second vector to the first one */
+
     if (shardId != coresPerVector - 1) {
 
 #if defined(PLP_MATH_LOOPUNROLL)
@@ -107,38 +117,12 @@ void plp_conv_parallel_OLA_kernel(void *task_args) {
             *_pRes = *pIn1 + *pIn2;
         }
 
-        if (addLength < addLengthsecond && sharedLength > 0) {
-
-            k = sharedLength >> 1U;
-
-            while (k) {
-                temp1 = *pIn3++;
-                temp2 = *pIn3++;
-
-                *_pRes2++ = temp1;
-                *_pRes2++ = temp2;
-
-                k--;
-            }
-
-            k = sharedLength % 0x2U;
-
-            if (k) {
-                *_pRes2 = *pIn3;
-            }
-        }
-
 #else
 
         for (uint32_t i = shardId * stepSize; i < (shardId + 1) * stepSize; i++) {
             pRes[i + addOffset] += pRes[i + blockOffset];
         }
 
-        if (addLength < addLengthsecond && sharedLength > 0) {
-            for (uint32_t i = shardId * sharedLength; i < (shardId + 1) * sharedLength; i++) {
-                pRes[i + addLength + addOffset] = pRes[i + blockOffset + addLength];
-            }
-        }
 #endif // if defined(PLP_MATH_LOOPUNROLL)
 
     } else {
@@ -165,9 +149,26 @@ void plp_conv_parallel_OLA_kernel(void *task_args) {
             *_pRes = *pIn1 + *pIn2;
         }
 
-        if (addLength < addLengthsecond) {
+#else
 
-            k = ((addLengthsecond - addLength) - shardId * sharedLength) >> 1U;
+        for (uint32_t i = shardId * stepSize; i < addLength; i++) {
+            pRes[i + addOffset] += pRes[i + blockOffset];
+        }
+
+#endif // if defined(PLP_MATH_LOOPUNROLL)
+    }
+
+    /* the tail of the second vector is moved over its head, which must have been read by all the
+     * cores before */
+    hal_team_barrier();
+
+    if (shardId != coresPerVector - 1) {
+
+        if (addLength < addLengthsecond && sharedLength > 0) {
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+            k = sharedLength >> 1U;
 
             while (k) {
                 temp1 = *pIn3++;
@@ -179,42 +180,55 @@ void plp_conv_parallel_OLA_kernel(void *task_args) {
                 k--;
             }
 
-            k = ((addLengthsecond - addLength) - shardId * sharedLength) % 0x2U;
+            k = sharedLength % 0x2U;
 
             if (k) {
                 *_pRes2 = *pIn3;
             }
-        }
 
-        if (coreId == (numVectors >> 1) * coresPerVector - 1) {
-            if (addLength >= addLengthsecond) {
-                S->addLengthsecond = addLengthfirst;
-            } else {
-                S->addLengthsecond = addLengthfirst + addLengthsecond - addLength;
+#else
+
+            for (uint32_t i = shardId * sharedLength; i < (shardId + 1) * sharedLength; i++) {
+                pRes[i + addLength + addOffset] = pRes[i + blockOffset + addLength];
             }
-        }
 
-#else
-        for (uint32_t i = shardId * stepSize; i < addLength; i++) {
-            pRes[i + addOffset] += pRes[i + blockOffset];
+#endif // if defined(PLP_MATH_LOOPUNROLL)
         }
 
+    } else {
+
         if (addLength < addLengthsecond) {
-            for (uint32_t i = shardId * sharedLength; i < (addLengthsecond - addLength); i++) {
-                pRes[i + addLength + addOffset] = pRes[i + blockOffset + addLength];
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+            k = ((addLengthsecond - addLength) - shardId * sharedLength) >> 1U;
+
+            while (k) {
+                temp1 = *pIn3++;
+                temp2 = *pIn3++;
+
+                *_pRes2++ = temp1;
+                *_pRes2++ = temp2;
+
+                k--;
             }
-        }
 
-        if (coreId == (numVectors >> 1) * coresPerVector - 1) {
-            if (addLength >= addLengthsecond) {
-                S->addLengthsecond = addLengthfirst;
-            } else {
-                S->addLengthsecond = addLengthfirst + addLengthsecond - addLength;
+            k = ((addLengthsecond - addLength) - shardId * sharedLength) % 0x2U;
+
+            if (k) {
+                *_pRes2 = *pIn3;
+            }
+
+#else
+
+            for (uint32_t i = shardId * sharedLength; i < (addLengthsecond - addLength); i++) {
+                pRes[i + addLength + addOffset] = pRes[i + blockOffset + addLength];
             }
-        }
 
 #endif // if defined(PLP_MATH_LOOPUNROLL)
+        }
     }
+
     hal_team_barrier();
     return;
 }
@@ -31,7 +31,7 @@
 #include "plp_math.h"
 #include "rtos_hal.h"
 
-HAL_CL_L1 int32_t *resultsBuffer;
+HAL_CL_L1 static int32_t *resultsBuffer;
 
 /**
    @ingroup groupFilters
@@ -59,9 +59,10 @@ void plp_conv_i16_parallel(const int16_t *pSrcA,
                            const uint32_t srcBLen,
                            const uint8_t nPE,
                            int32_t *pRes) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_conv_i16(pSrcA, srcALen, pSrcB, srcBLen, pRes);
         return;
     } else {
 
@@ -92,7 +93,7 @@ void plp_conv_i16_parallel(const int16_t *pSrcA,
 
         if (nPE > 1) {
             resultsBuffer =
-                (int32_t *)hal_cl_l1_malloc(sizeof(int32_t) * resultsoffset * nPE);
+                (int32_t *)plp_l1_scratch_alloc(sizeof(int32_t) * resultsoffset * nPE);
             resBuf = resultsBuffer;
             // printf("Address of resultsBuffer: 0x%x, End: 0x%x\n", resultsBuffer, resultsBuffer +
             // sizeof(int32_t)*resultsLen);
@@ -106,7 +107,7 @@ void plp_conv_i16_parallel(const int16_t *pSrcA,
                                     .pRes = resultsBuffer,
                                     .nPE = nPE };
 
-        hal_cl_team_fork(nPE, plp_conv_i16p_xpulpv2, (void *)&S);
+        plp_cl_team_fork(nPE, plp_conv_i16p_xpulpv2, (void *)&S);
         if (nPE > 1) {
 
 #if defined(PLP_CONV_SEQUENTIALADDING)
@@ -160,7 +161,7 @@ void plp_conv_i16_parallel(const int16_t *pSrcA,
                 pRes[i] = resultsBuffer[i];
             }
 #endif
-            hal_cl_l1_free(resBuf, sizeof(int32_t) * resultsoffset * nPE);
+            plp_l1_scratch_free(resBuf, sizeof(int32_t) * resultsoffset * nPE);
 #endif
         }
 
@@ -168,6 +169,30 @@ void plp_conv_i16_parallel(const int16_t *pSrcA,
     }
 }
 
+/**
+   @brief Scratch memory needed by plp_conv_i16_parallel (see plp_l1_arena_use).
+   @param[in]  srcALen   Length of the first input vector
+   @param[in]  srcBLen   Length of the second input vector
+   @param[in]  nPE       Number of cores to compute on
+   @return     number of bytes
+*/
+uint32_t plp_conv_i16_parallel_get_workspace_size(const uint32_t srcALen,
+                                                 const uint32_t srcBLen,
+                                                 const uint8_t nPE) {
+
+    if (nPE <= 1) {
+        return 0;
+    }
+
+    uint32_t pIn1Len = srcALen >= srcBLen ? srcBLen : srcALen;
+    uint32_t pIn2Len = srcALen >= srcBLen ? srcALen : srcBLen;
+
+    uint32_t srcAoffset = ((pIn1Len + nPE - 1) / nPE);
+    uint32_t resultsoffset = srcAoffset + pIn2Len - 1;
+
+    return PLP_L1_ARENA_SIZE(sizeof(int32_t) * resultsoffset * nPE);
+}
+
 /**
    @} end of BasicConvolution group
 */
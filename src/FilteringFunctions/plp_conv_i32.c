@@ -64,6 +64,7 @@ void plp_conv_i32(const int32_t *pSrcA,
                   const int32_t *pSrcB,
                   const uint32_t srcBLen,
                   int32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNC();
 
     uint32_t in1Len, in2Len;
     const int32_t *pIn1;
@@ -95,7 +96,7 @@ void plp_conv_i32(const int32_t *pSrcA,
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
 
-        _pRes1_32 = hal_fc_l1_malloc(sizeof(int32_t) * (resultsoffset));
+        _pRes1_32 = plp_l1_scratch_alloc(sizeof(int32_t) * (resultsoffset));
 
         int32_t *pOut = pRes;
         int32_t *_pRes = _pRes1_32;
@@ -152,7 +153,7 @@ void plp_conv_i32(const int32_t *pSrcA,
 
     } else {
 
-        _pRes1_32 = hal_cl_l1_malloc(sizeof(int32_t) * (resultsoffset));
+        _pRes1_32 = plp_l1_scratch_alloc(sizeof(int32_t) * (resultsoffset));
 
         int32_t *pOut = pRes;
         int32_t *_pRes = _pRes1_32;
@@ -207,7 +208,26 @@ void plp_conv_i32(const int32_t *pSrcA,
             *pOut++ += *_pRes++;
         }
     }
-    hal_cl_l1_free(_pRes1_32, sizeof(int32_t) * (resultsoffset));
+    plp_l1_scratch_free(_pRes1_32, sizeof(int32_t) * (resultsoffset));
+}
+
+/**
+   @brief Scratch memory needed by plp_conv_i32 (see plp_l1_arena_use).
+   @param[in]  srcALen   Length of the first input vector
+   @param[in]  srcBLen   Length of the second input vector
+   @return     number of bytes
+*/
+uint32_t plp_conv_i32_get_workspace_size(const uint32_t srcALen, const uint32_t srcBLen) {
+
+    uint32_t in1Len = srcALen >= srcBLen ? srcALen : srcBLen;
+    uint32_t in2Len = srcALen >= srcBLen ? srcBLen : srcALen;
+
+    uint32_t nPE = (OLARATIO32 / (in1Len / in2Len));
+    nPE = nPE > 0 ? nPE : 1;
+    uint32_t src2Offset = ((in2Len + nPE - 1) / nPE);
+    uint32_t resultsoffset = src2Offset + in1Len - 1;
+
+    return PLP_L1_ARENA_SIZE(sizeof(int32_t) * (resultsoffset));
 }
 
 /**
@@ -55,6 +55,7 @@ void plp_conv_valid_rep_i8(const int8_t *pSrcA,
                            const int8_t *pSrcB,
                            const uint32_t srcBLen,
                            int32_t *pRes) {
+    PLP_PROFILE_FUNC();
 
     uint32_t in1Len, in2Len;
     const int8_t *pIn1;
@@ -88,11 +89,13 @@ void plp_conv_valid_rep_i8(const int8_t *pSrcA,
         uint32_t len_align = ((in1Len + 3) >> 2) << 2; // compute aligned memory size
         uint32_t mem_size = len_align << 2;            // memory size for all 4 replications
 
-        int8_t *p_1_loc = hal_cl_l1_malloc(sizeof(int8_t) * mem_size);
-        int8_t *p_2_loc = hal_cl_l1_malloc(sizeof(int8_t) * in2Len);
+        int8_t *p_1_loc = plp_l1_scratch_alloc(sizeof(int8_t) * mem_size);
+        int8_t *p_2_loc = plp_l1_scratch_alloc(sizeof(int8_t) * in2Len);
 
         if (p_1_loc == NULL || p_2_loc == NULL) {
             printf("Error: insufficient L1 memory!\n");
+            plp_l1_scratch_free(p_2_loc, sizeof(int8_t) * in2Len);
+            plp_l1_scratch_free(p_1_loc, sizeof(int8_t) * mem_size);
             return;
         }
 
@@ -101,23 +104,42 @@ void plp_conv_valid_rep_i8(const int8_t *pSrcA,
         int merge = 0;
 
         for (int i = 0; i < 4; i++) {
-            hal_cl_dma_cmd((unsigned int)(pIn1 + i), (unsigned int)(p_1_loc + i * len_align),
+            hal_cl_dma_cmd((uintptr_t)(pIn1 + i), (uintptr_t)(p_1_loc + i * len_align),
                           sizeof(int8_t) * (in1Len - i), HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
             merge = 1;
         }
 
-        hal_cl_dma_cmd((unsigned int)pIn2, (unsigned int)p_2_loc, sizeof(int8_t) * in2Len,
+        hal_cl_dma_cmd((uintptr_t)pIn2, (uintptr_t)p_2_loc, sizeof(int8_t) * in2Len,
                       HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
 
         hal_cl_dma_cmd_wait(&copy);
 
         plp_conv_valid_rep_i8s_xpulpv2(p_1_loc, in1Len, len_align, p_2_loc, in2Len, pRes);
 
-        hal_cl_l1_free(p_1_loc, sizeof(int8_t) * mem_size);
-        hal_cl_l1_free(p_2_loc, sizeof(int8_t) * in2Len);
+        plp_l1_scratch_free(p_2_loc, sizeof(int8_t) * in2Len);
+        plp_l1_scratch_free(p_1_loc, sizeof(int8_t) * mem_size);
     }
 }
 
+/**
+ * @brief Scratch memory needed by plp_conv_valid_rep_i8 (see plp_l1_arena_use).
+ * @param[in]  srcALen Length of the first input vector
+ * @param[in]  srcBLen Length of the second input vector
+ * @return     number of bytes
+ */
+uint32_t plp_conv_valid_rep_i8_get_workspace_size(const uint32_t srcALen,
+                                                  const uint32_t srcBLen) {
+
+    uint32_t in1Len = srcALen >= srcBLen ? srcALen : srcBLen;
+    uint32_t in2Len = srcALen >= srcBLen ? srcBLen : srcALen;
+
+    uint32_t len_align = ((in1Len + 3) >> 2) << 2;
+    uint32_t mem_size = len_align << 2;
+
+    return PLP_L1_ARENA_SIZE(sizeof(int8_t) * mem_size) +
+           PLP_L1_ARENA_SIZE(sizeof(int8_t) * in2Len);
+}
+
 /**
  * @} end of BasicConvolution group
  */
@@ -60,6 +60,7 @@ void plp_correlate_i16(const int16_t *pSrcA,
                        const int16_t *pSrcB,
                        const uint32_t srcBLen,
                        int32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_correlate_i16s_rv32im(pSrcA, srcALen, pSrcB, srcBLen, pRes);
@@ -60,6 +60,7 @@ void plp_correlate_i8(const int8_t *pSrcA,
                       const int8_t *pSrcB,
                       const uint32_t srcBLen,
                       int32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_correlate_i8s_rv32im(pSrcA, srcALen, pSrcB, srcBLen, pRes);
@@ -61,6 +61,7 @@ void plp_correlate_q16(const int16_t *pSrcA,
                        const uint32_t srcBLen,
                        uint32_t fracBits,
                        int32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_correlate_q16s_rv32im(pSrcA, srcALen, pSrcB, srcBLen, fracBits, pRes);
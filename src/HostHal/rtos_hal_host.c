@@ -0,0 +1,253 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        rtos_hal_host.c
+ * Description:  Native host runtime: pthread team, L1 arena and cycle counter
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: x86/ARM hosts running Linux
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef RTOS_HOST
+
+#include <pthread.h>
+#include <time.h>
+
+#include "plp_math.h"
+
+__thread int plp_host_core_id = 0;
+__thread int plp_host_cluster_id = 0;
+__thread hal_perf_t *plp_host_perf_current = NULL;
+
+/* TEAM */
+
+static pthread_once_t team_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t team_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t team_start = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t team_done = PTHREAD_COND_INITIALIZER;
+
+static void (*team_entry)(void *);
+static void *team_arg;
+static int team_size = 1;
+static uint32_t team_generation = 0;
+static int team_finished = 0;
+
+static pthread_mutex_t barrier_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t barrier_cond = PTHREAD_COND_INITIALIZER;
+static int barrier_count = 0;
+static uint32_t barrier_generation = 0;
+
+static void *team_worker(void *arg) {
+    uint32_t seen = 0;
+
+    plp_host_core_id = (int)(intptr_t)arg;
+    plp_host_cluster_id = 0;
+
+    for (;;) {
+        void (*entry)(void *);
+        void *entry_arg;
+        int size;
+
+        pthread_mutex_lock(&team_lock);
+        while (team_generation == seen) {
+            pthread_cond_wait(&team_start, &team_lock);
+        }
+        seen = team_generation;
+        entry = team_entry;
+        entry_arg = team_arg;
+        size = team_size;
+        pthread_mutex_unlock(&team_lock);
+
+        if (plp_host_core_id < size) {
+            entry(entry_arg);
+
+            pthread_mutex_lock(&team_lock);
+            if (++team_finished == size - 1) {
+                pthread_cond_signal(&team_done);
+            }
+            pthread_mutex_unlock(&team_lock);
+        }
+    }
+
+    return NULL;
+}
+
+static void team_init(void) {
+    for (int i = 1; i < PLP_HOST_NB_PE; i++) {
+        pthread_t thread;
+        pthread_create(&thread, NULL, team_worker, (void *)(intptr_t)i);
+        pthread_detach(thread);
+    }
+}
+
+void plp_host_team_fork(int nb_cores, void (*entry)(void *), void *arg) {
+    int caller_core_id = plp_host_core_id;
+    int caller_cluster_id = plp_host_cluster_id;
+
+    if (nb_cores <= 0 || nb_cores > PLP_HOST_NB_PE) {
+        nb_cores = PLP_HOST_NB_PE;
+    }
+
+    pthread_once(&team_once, team_init);
+
+    pthread_mutex_lock(&team_lock);
+    team_entry = entry;
+    team_arg = arg;
+    team_size = nb_cores;
+    team_finished = 0;
+    barrier_count = 0;
+    team_generation++;
+    pthread_cond_broadcast(&team_start);
+    pthread_mutex_unlock(&team_lock);
+
+    /* the caller is core 0 of the team, like the master core on the cluster */
+    plp_host_core_id = 0;
+    plp_host_cluster_id = 0;
+    entry(arg);
+
+    pthread_mutex_lock(&team_lock);
+    while (team_finished < nb_cores - 1) {
+        pthread_cond_wait(&team_done, &team_lock);
+    }
+    team_size = 1;
+    pthread_mutex_unlock(&team_lock);
+
+    plp_host_core_id = caller_core_id;
+    plp_host_cluster_id = caller_cluster_id;
+}
+
+void plp_host_team_barrier(void) {
+    pthread_mutex_lock(&barrier_lock);
+    uint32_t generation = barrier_generation;
+    if (++barrier_count >= team_size) {
+        barrier_count = 0;
+        barrier_generation++;
+        pthread_cond_broadcast(&barrier_cond);
+    } else {
+        while (generation == barrier_generation) {
+            pthread_cond_wait(&barrier_cond, &barrier_lock);
+        }
+    }
+    pthread_mutex_unlock(&barrier_lock);
+}
+
+/* L1 ARENA */
+
+/* First-fit allocator with address ordered free list, similar to the one of the pulp runtimes. The
+ * free list is stored inside the free chunks themselves. */
+
+typedef struct l1_chunk {
+    uint32_t size;
+    struct l1_chunk *next;
+} l1_chunk_t;
+
+#define L1_ALIGN (sizeof(l1_chunk_t))
+
+static uint8_t l1_arena[PLP_HOST_L1_SIZE] __attribute__((aligned(L1_ALIGN)));
+static l1_chunk_t *l1_free_list = NULL;
+static int l1_initialized = 0;
+static pthread_mutex_t l1_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static inline uint32_t l1_round(int size) {
+    return ((uint32_t)size + L1_ALIGN - 1) & ~(L1_ALIGN - 1);
+}
+
+void *plp_host_l1_malloc(int size) {
+    uint32_t rsize = l1_round(size);
+    l1_chunk_t **prev;
+    l1_chunk_t *chunk;
+    void *result = NULL;
+
+    pthread_mutex_lock(&l1_lock);
+
+    if (!l1_initialized) {
+        l1_free_list = (l1_chunk_t *)l1_arena;
+        l1_free_list->size = PLP_HOST_L1_SIZE;
+        l1_free_list->next = NULL;
+        l1_initialized = 1;
+    }
+
+    for (prev = &l1_free_list, chunk = l1_free_list; chunk != NULL;
+         prev = &chunk->next, chunk = chunk->next) {
+        if (chunk->size == rsize) {
+            *prev = chunk->next;
+            result = chunk;
+            break;
+        } else if (chunk->size > rsize) {
+            /* allocate from the end of the chunk, such that the list does not change */
+            chunk->size -= rsize;
+            result = (uint8_t *)chunk + chunk->size;
+            break;
+        }
+    }
+
+    pthread_mutex_unlock(&l1_lock);
+
+    return result;
+}
+
+void plp_host_l1_free(void *ptr, int size) {
+    uint32_t rsize = l1_round(size);
+    l1_chunk_t *chunk = (l1_chunk_t *)ptr;
+    l1_chunk_t *prev = NULL;
+    l1_chunk_t *next;
+
+    if (ptr == NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&l1_lock);
+
+    for (next = l1_free_list; next != NULL && next < chunk; next = next->next) {
+        prev = next;
+    }
+
+    chunk->size = rsize;
+    chunk->next = next;
+
+    /* merge with the following chunk */
+    if (next != NULL && (uint8_t *)chunk + chunk->size == (uint8_t *)next) {
+        chunk->size += next->size;
+        chunk->next = next->next;
+    }
+
+    /* merge with the preceding chunk */
+    if (prev != NULL && (uint8_t *)prev + prev->size == (uint8_t *)chunk) {
+        prev->size += chunk->size;
+        prev->next = chunk->next;
+    } else if (prev != NULL) {
+        prev->next = chunk;
+    } else {
+        l1_free_list = chunk;
+    }
+
+    pthread_mutex_unlock(&l1_lock);
+}
+
+/* PERFORMANCE COUNTERS */
+
+uint32_t plp_host_perf_cycles(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+}
+
+#endif
@@ -68,6 +68,7 @@
  */
 
 void plp_mat_fill_I_i16(uint32_t N, int16_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_mat_fill_I_i16s_rv32im(N, pDst);
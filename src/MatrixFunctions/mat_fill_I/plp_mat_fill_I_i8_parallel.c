@@ -48,14 +48,15 @@
  */
 
 void plp_mat_fill_I_i8_parallel(uint32_t N, uint32_t nPE, int8_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_mat_fill_I_i8(N, pDst);
         return;
     } else {
         plp_mat_fill_I_instance_i8 args = { .N = N, .nPE = nPE, .pDst = pDst };
 
-        hal_cl_team_fork(nPE, plp_mat_fill_I_i8p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_mat_fill_I_i8p_xpulpv2, (void *)&args);
     }
 }
 
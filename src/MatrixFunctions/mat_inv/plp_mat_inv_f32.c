@@ -75,6 +75,7 @@
  */
 
 int plp_mat_inv_f32(float *__restrict__ pSrc, float *__restrict__ pDst, uint32_t N) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
@@ -55,14 +55,15 @@ int plp_mat_inv_f32_parallel( float *__restrict__ pSrc,
                               float *__restrict__ pDst,
                               uint32_t N,
                               uint32_t nPE) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
+    if (hal_cluster_id() == ARCHI_FC_CID && plp_fc_cluster_open() != 0) {
         printf("parallel and floating-point processing supported only for cluster side\n");
         return 2;
     } else {
         uint32_t* __restrict__ flag = 0U;
         plp_mat_inv_instance_f32 args = {.pSrc = pSrc, .pDst = pDst, .flag = flag, .N = N, .nPE = nPE};
-        hal_cl_team_fork(nPE, plp_mat_inv_f32p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_mat_inv_f32p_xpulpv2, (void *)&args);
     }
 }
 
@@ -46,7 +46,7 @@
   @param[in]  M         height of the first input matrix
   @param[in]  N         width of the first input matrix and hight of the second
   @param[in]  O         width of the second input matrix
-  @param[in]  nPE       Number of cores to use
+  @param[in]  nPE       Number of cores to use, 0 to select it automatically (see plp_auto_npe)
   @param[out] pDstC     points to the output matrix
   @return     none
  */
@@ -58,15 +58,20 @@ void plp_mat_mult_i32_parallel(const int32_t *__restrict__ pSrcA,
                                uint32_t O,
                                uint32_t nPE,
                                int32_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_mat_mult_i32(pSrcA, pSrcB, M, N, O, pDstC);
         return;
     } else {
+        if (nPE == 0) {
+            nPE = plp_auto_npe(PLP_COST_MAT_MULT_I32, O, M * N);
+        }
+
         plp_mat_mult_instance_i32 args = {
             .pSrcA = pSrcA, .pSrcB = pSrcB, .M = M, .N = N, .O = O, .nPE = nPE, .pDstC = pDstC
         };
-        hal_cl_team_fork(nPE, plp_mat_mult_i32p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_mat_mult_i32p_xpulpv2, (void *)&args);
     }
 }
 
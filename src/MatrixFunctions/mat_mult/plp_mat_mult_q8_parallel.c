@@ -47,7 +47,7 @@
   @param[in]  N         width of the first input matrix and hight of the second
   @param[in]  O         width of the second input matrix
   @param[in]  shift     Amount to shift the result of each multiplication.
-  @param[in]  nPE       Number of cores to use
+  @param[in]  nPE       Number of cores to use, 0 to select it automatically (see plp_auto_npe)
   @param[out] pDstC     points to the output matrix
   @return     none
 
@@ -69,11 +69,16 @@ void plp_mat_mult_q8_parallel(const int8_t *__restrict__ pSrcA,
                               uint32_t shift,
                               uint32_t nPE,
                               int8_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_mat_mult_q8(pSrcA, pSrcB, M, N, O, shift, pDstC);
         return;
     } else {
+        if (nPE == 0) {
+            nPE = plp_auto_npe(PLP_COST_MAT_MULT_Q8, M, N * O);
+        }
+
         plp_mat_mult_instance_q8 args = { .pSrcA = pSrcA,
                                           .pSrcB = pSrcB,
                                           .M = M,
@@ -82,7 +87,7 @@ void plp_mat_mult_q8_parallel(const int8_t *__restrict__ pSrcA,
                                           .shift = shift,
                                           .nPE = nPE,
                                           .pDstC = pDstC };
-        hal_cl_team_fork(nPE, plp_mat_mult_q8p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_mat_mult_q8p_xpulpv2, (void *)&args);
     }
 }
 
@@ -58,15 +58,16 @@ void plp_mat_mult_trans_f32_parallel(const float *__restrict__ pSrcA,
                                      uint32_t O,
                                      uint32_t nPE,
                                      float *__restrict__ pDstC) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
+    if (hal_cluster_id() == ARCHI_FC_CID && plp_fc_cluster_open() != 0) {
         printf("parallel and floating-point processing supported only for cluster side\n");
         return;
     } else {
         plp_mat_mult_instance_f32 args = {
             .pSrcA = pSrcA, .pSrcB = pSrcB, .M = M, .N = N, .O = O, .nPE = nPE, .pDstC = pDstC
         };
-        hal_cl_team_fork(nPE, plp_mat_mult_trans_f32p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_mat_mult_trans_f32p_xpulpv2, (void *)&args);
     }
 }
 
@@ -56,6 +56,7 @@ void plp_mat_mult_trans_i16(const int16_t *__restrict__ pSrcA,
                             uint32_t N,
                             uint32_t O,
                             int32_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_mat_mult_trans_i16s_rv32im(pSrcA, pSrcB, M, N, O, pDstC);
@@ -58,15 +58,16 @@ void plp_mat_mult_trans_i16_parallel(const int16_t *__restrict__ pSrcA,
                                      uint32_t O,
                                      uint32_t nPE,
                                      int32_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_mat_mult_trans_i16(pSrcA, pSrcB, M, N, O, pDstC);
         return;
     } else {
         plp_mat_mult_instance_i16 args = {
             .pSrcA = pSrcA, .pSrcB = pSrcB, .M = M, .N = N, .O = O, .nPE = nPE, .pDstC = pDstC
         };
-        hal_cl_team_fork(nPE, plp_mat_mult_trans_i16p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_mat_mult_trans_i16p_xpulpv2, (void *)&args);
     }
 }
 
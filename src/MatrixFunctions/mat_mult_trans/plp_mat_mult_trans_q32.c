@@ -64,6 +64,7 @@ void plp_mat_mult_trans_q32(const int32_t *__restrict__ pSrcA,
                             uint32_t O,
                             uint32_t shift,
                             int32_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_mat_mult_trans_q32s_rv32im(pSrcA, pSrcB, M, N, O, shift, pDstC);
@@ -66,9 +66,10 @@ void plp_mat_mult_trans_q32_parallel(const int32_t *__restrict__ pSrcA,
                                      uint32_t shift,
                                      uint32_t nPE,
                                      int32_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_mat_mult_trans_q32(pSrcA, pSrcB, M, N, O, shift, pDstC);
         return;
     } else {
         plp_mat_mult_instance_q32 args = { .pSrcA = pSrcA,
@@ -79,7 +80,7 @@ void plp_mat_mult_trans_q32_parallel(const int32_t *__restrict__ pSrcA,
                                            .shift = shift,
                                            .nPE = nPE,
                                            .pDstC = pDstC };
-        hal_cl_team_fork(nPE, plp_mat_mult_trans_q32p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_mat_mult_trans_q32p_xpulpv2, (void *)&args);
     }
 }
 
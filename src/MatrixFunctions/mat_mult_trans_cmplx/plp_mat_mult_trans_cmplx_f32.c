@@ -56,6 +56,7 @@ void plp_mat_mult_trans_cmplx_f32(const float *__restrict__ pSrcA,
                                   uint32_t N,
                                   uint32_t O,
                                   float *__restrict__ pDstC) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
@@ -59,16 +59,17 @@ void plp_mat_mult_trans_cmplx_i32_parallel(const int32_t *__restrict__ pSrcA,
                                            uint32_t O,
                                            uint32_t nPE,
                                            int32_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_mat_mult_trans_cmplx_i32(pSrcA, pSrcB, M, N, O, pDstC);
         return;
     } else {
         plp_mat_mult_cmplx_instance_i32 args = {
             .pSrcA = pSrcA, .pSrcB = pSrcB, .M = M, .N = N, .O = O, .nPE = nPE, .pDstC = pDstC
         };
 
-        hal_cl_team_fork(nPE, plp_mat_mult_trans_cmplx_i32p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_mat_mult_trans_cmplx_i32p_xpulpv2, (void *)&args);
     }
 }
 
@@ -70,9 +70,10 @@ void plp_mat_mult_trans_cmplx_q8_parallel(const int8_t *__restrict__ pSrcA,
                                           uint32_t shift,
                                           uint32_t nPE,
                                           int8_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_mat_mult_trans_cmplx_q8(pSrcA, pSrcB, M, N, O, shift, pDstC);
         return;
     } else {
         plp_mat_mult_cmplx_instance_q8 args = { .pSrcA = pSrcA,
@@ -84,7 +85,7 @@ void plp_mat_mult_trans_cmplx_q8_parallel(const int8_t *__restrict__ pSrcA,
                                                 .nPE = nPE,
                                                 .pDstC = pDstC };
 
-        hal_cl_team_fork(nPE, plp_mat_mult_trans_cmplx_q8p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_mat_mult_trans_cmplx_q8p_xpulpv2, (void *)&args);
     }
 }
 
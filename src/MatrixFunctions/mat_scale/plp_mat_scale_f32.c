@@ -54,6 +54,7 @@ void plp_mat_scale_f32(const float *__restrict__ pSrc,
                        uint32_t N,
                        float scaleFactor,
                        float *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
@@ -81,6 +81,7 @@ void plp_mat_scale_i16(const int16_t *__restrict__ pSrc,
                        int16_t scaleFactor,
                        int32_t shift,
                        int16_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_mat_scale_i16s_rv32im(pSrc, M, N, scaleFactor, shift, pDst);
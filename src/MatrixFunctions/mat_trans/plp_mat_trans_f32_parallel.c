@@ -56,8 +56,9 @@ void plp_mat_trans_f32_parallel(const float *__restrict__ pSrc,
                                 uint32_t N,
                                 uint32_t nPE,
                                 float *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
+    if (hal_cluster_id() == ARCHI_FC_CID && plp_fc_cluster_open() != 0) {
         printf("parallel and floating-point processing supported only for cluster side\n");
         return;
     } else {
@@ -65,7 +66,7 @@ void plp_mat_trans_f32_parallel(const float *__restrict__ pSrc,
             .pSrc = (int32_t *)pSrc, .M = M, .N = N, .nPE = nPE, .pDst = (int32_t *)pDst
         };
 
-        hal_cl_team_fork(nPE, plp_mat_trans_i32p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_mat_trans_i32p_xpulpv2, (void *)&args);
     }
 }
 
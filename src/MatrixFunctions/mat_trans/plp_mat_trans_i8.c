@@ -52,6 +52,7 @@ void plp_mat_trans_i8(const int8_t *__restrict__ pSrc,
                       uint32_t M,
                       uint32_t N,
                       int8_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_mat_trans_i8s_rv32im(pSrc, M, N, pDst);
@@ -62,9 +62,10 @@ void plp_mat_add_stride_i16_parallel(const int16_t *__restrict__ pSrcA,
                                      uint32_t strideY,
                                      uint32_t nPE,
                                      int16_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_mat_add_stride_i16(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst);
         return;
     } else {
         plp_mat_add_stride_instance_i16 args = { .pSrcA = pSrcA,
@@ -77,7 +78,7 @@ void plp_mat_add_stride_i16_parallel(const int16_t *__restrict__ pSrcA,
                                                  .nPE = nPE,
                                                  .pDst = pDst };
 
-        hal_cl_team_fork(nPE, plp_mat_add_stride_i16p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_mat_add_stride_i16p_xpulpv2, (void *)&args);
     }
 }
 
@@ -58,9 +58,10 @@ void plp_mat_copy_stride_i32_parallel(const int32_t *__restrict__ pSrc,
                                       uint32_t strideDst,
                                       uint32_t nPE,
                                       int32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_mat_copy_stride_i32(pSrc, M, N, strideSrc, strideDst, pDst);
         return;
     } else {
         plp_mat_copy_stride_instance_i32 args = { .pSrc = pSrc,
@@ -71,7 +72,7 @@ void plp_mat_copy_stride_i32_parallel(const int32_t *__restrict__ pSrc,
                                                   .nPE = nPE,
                                                   .pDst = pDst };
 
-        hal_cl_team_fork(nPE, plp_mat_copy_stride_i32p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_mat_copy_stride_i32p_xpulpv2, (void *)&args);
     }
 }
 
@@ -52,16 +52,17 @@ void plp_mat_fill_I_stride_i32_parallel(uint32_t N,
                                         uint32_t stride,
                                         uint32_t nPE,
                                         int32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_mat_fill_I_stride_i32(N, stride, pDst);
         return;
     } else {
         plp_mat_fill_I_stride_instance_i32 args = {
             .N = N, .stride = stride, .nPE = nPE, .pDst = pDst
         };
 
-        hal_cl_team_fork(nPE, plp_mat_fill_I_stride_i32p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_mat_fill_I_stride_i32p_xpulpv2, (void *)&args);
     }
 }
 
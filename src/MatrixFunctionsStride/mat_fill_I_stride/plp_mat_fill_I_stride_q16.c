@@ -55,6 +55,7 @@ void plp_mat_fill_I_stride_q16(uint32_t N,
                                uint32_t stride,
                                int32_t fracBits,
                                int16_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_mat_fill_I_stride_q16s_rv32im(N, stride, fracBits, pDst);
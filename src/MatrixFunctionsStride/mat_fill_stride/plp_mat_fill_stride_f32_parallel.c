@@ -51,8 +51,9 @@
 
 void plp_mat_fill_stride_f32_parallel(
     uint32_t M, uint32_t N, uint32_t stride, float value, uint32_t nPE, float *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
+    if (hal_cluster_id() == ARCHI_FC_CID && plp_fc_cluster_open() != 0) {
         printf("parallel and floating-point processing supported only for cluster side\n");
         return;
     } else {
@@ -60,7 +61,7 @@ void plp_mat_fill_stride_f32_parallel(
             .M = M, .N = N, .stride = stride, .value = value, .nPE = nPE, .pDst = pDst
         };
 
-        hal_cl_team_fork(nPE, plp_mat_fill_stride_f32p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_mat_fill_stride_f32p_xpulpv2, (void *)&args);
     }
 }
 
@@ -55,16 +55,17 @@ void plp_mat_fill_stride_i16_parallel(uint32_t M,
                                       int16_t value,
                                       uint32_t nPE,
                                       int16_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_mat_fill_stride_i16(M, N, stride, value, pDst);
         return;
     } else {
         plp_mat_fill_stride_instance_i16 args = {
             .M = M, .N = N, .stride = stride, .value = value, .nPE = nPE, .pDst = pDst
         };
 
-        hal_cl_team_fork(nPE, plp_mat_fill_stride_i16p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_mat_fill_stride_i16p_xpulpv2, (void *)&args);
     }
 }
 
@@ -50,6 +50,7 @@
 
 void plp_mat_fill_stride_i8(
     uint32_t M, uint32_t N, uint32_t stride, int8_t value, int8_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_mat_fill_stride_i8s_rv32im(M, N, stride, value, pDst);
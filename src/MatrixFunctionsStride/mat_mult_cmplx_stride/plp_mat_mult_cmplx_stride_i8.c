@@ -62,6 +62,7 @@ void plp_mat_mult_cmplx_stride_i8(const int8_t *__restrict__ pSrcA,
                                   uint32_t strideB,
                                   uint32_t strideC,
                                   int32_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_mat_mult_cmplx_stride_i8s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC,
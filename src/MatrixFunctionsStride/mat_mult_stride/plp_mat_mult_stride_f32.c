@@ -62,6 +62,7 @@ void plp_mat_mult_stride_f32(const float *__restrict__ pSrcA,
                              uint32_t strideB,
                              uint32_t strideC,
                              float *__restrict__ pDstC) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("Floating point is supported only for cluster side\n");
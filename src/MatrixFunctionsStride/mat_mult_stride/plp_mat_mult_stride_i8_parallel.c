@@ -64,9 +64,10 @@ void plp_mat_mult_stride_i8_parallel(const int8_t *__restrict__ pSrcA,
                                      uint32_t strideC,
                                      uint32_t nPE,
                                      int32_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_mat_mult_stride_i8(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, pDstC);
         return;
     } else {
         plp_mat_mult_stride_instance_i8 args = { .pSrcA = pSrcA,
@@ -79,7 +80,7 @@ void plp_mat_mult_stride_i8_parallel(const int8_t *__restrict__ pSrcA,
                                                  .strideC = strideC,
                                                  .nPE = nPE,
                                                  .pDstC = pDstC };
-        hal_cl_team_fork(nPE, plp_mat_mult_stride_i8p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_mat_mult_stride_i8p_xpulpv2, (void *)&args);
     }
 }
 
@@ -72,9 +72,10 @@ void plp_mat_mult_stride_q32_parallel(const int32_t *__restrict__ pSrcA,
                                       uint32_t shift,
                                       uint32_t nPE,
                                       int32_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_mat_mult_stride_q32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift, pDstC);
         return;
     } else {
         plp_mat_mult_stride_instance_q32 args = { .pSrcA = pSrcA,
@@ -88,7 +89,7 @@ void plp_mat_mult_stride_q32_parallel(const int32_t *__restrict__ pSrcA,
                                                   .shift = shift,
                                                   .nPE = nPE,
                                                   .pDstC = pDstC };
-        hal_cl_team_fork(nPE, plp_mat_mult_stride_q32p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_mat_mult_stride_q32p_xpulpv2, (void *)&args);
     }
 }
 
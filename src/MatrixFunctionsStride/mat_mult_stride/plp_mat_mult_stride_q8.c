@@ -73,6 +73,7 @@ void plp_mat_mult_stride_q8(const int8_t *__restrict__ pSrcA,
                             uint32_t strideC,
                             uint32_t shift,
                             int8_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_mat_mult_stride_q8s_rv32im(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift,
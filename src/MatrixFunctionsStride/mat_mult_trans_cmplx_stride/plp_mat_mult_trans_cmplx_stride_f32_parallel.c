@@ -66,8 +66,9 @@ void plp_mat_mult_trans_cmplx_stride_f32_parallel(const float *__restrict__ pSrc
                                                   uint32_t strideC,
                                                   uint32_t nPE,
                                                   float *__restrict__ pDstC) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
+    if (hal_cluster_id() == ARCHI_FC_CID && plp_fc_cluster_open() != 0) {
         printf("parallel and floating-point processing supported only for cluster side\n");
         return;
     } else {
@@ -82,7 +83,7 @@ void plp_mat_mult_trans_cmplx_stride_f32_parallel(const float *__restrict__ pSrc
                                                         .nPE = nPE,
                                                         .pDstC = pDstC };
 
-        hal_cl_team_fork(nPE, plp_mat_mult_trans_cmplx_stride_f32p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_mat_mult_trans_cmplx_stride_f32p_xpulpv2, (void *)&args);
     }
 }
 
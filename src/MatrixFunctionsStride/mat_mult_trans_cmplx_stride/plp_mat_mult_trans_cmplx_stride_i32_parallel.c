@@ -66,9 +66,11 @@ void plp_mat_mult_trans_cmplx_stride_i32_parallel(const int32_t *__restrict__ pS
                                                   uint32_t strideC,
                                                   uint32_t nPE,
                                                   int32_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_mat_mult_trans_cmplx_stride_i32(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC,
+                                            pDstC);
         return;
     } else {
         plp_mat_mult_cmplx_stride_instance_i32 args = { .pSrcA = pSrcA,
@@ -82,7 +84,7 @@ void plp_mat_mult_trans_cmplx_stride_i32_parallel(const int32_t *__restrict__ pS
                                                         .nPE = nPE,
                                                         .pDstC = pDstC };
 
-        hal_cl_team_fork(nPE, plp_mat_mult_trans_cmplx_stride_i32p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_mat_mult_trans_cmplx_stride_i32p_xpulpv2, (void *)&args);
     }
 }
 
@@ -77,9 +77,11 @@ void plp_mat_mult_trans_cmplx_stride_q8_parallel(const int8_t *__restrict__ pSrc
                                                  uint32_t shift,
                                                  uint32_t nPE,
                                                  int8_t *__restrict__ pDstC) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_mat_mult_trans_cmplx_stride_q8(pSrcA, pSrcB, M, N, O, strideA, strideB, strideC, shift,
+                                           pDstC);
         return;
     } else {
         plp_mat_mult_cmplx_stride_instance_q8 args = { .pSrcA = pSrcA,
@@ -94,7 +96,7 @@ void plp_mat_mult_trans_cmplx_stride_q8_parallel(const int8_t *__restrict__ pSrc
                                                        .nPE = nPE,
                                                        .pDstC = pDstC };
 
-        hal_cl_team_fork(nPE, plp_mat_mult_trans_cmplx_stride_q8p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_mat_mult_trans_cmplx_stride_q8p_xpulpv2, (void *)&args);
     }
 }
 
@@ -60,8 +60,9 @@ void plp_mat_scale_stride_f32_parallel(const float *__restrict__ pSrc,
                                        float scaleFactor,
                                        uint32_t nPE,
                                        float *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
+    if (hal_cluster_id() == ARCHI_FC_CID && plp_fc_cluster_open() != 0) {
         printf("parallel and floating-point processing supported only for cluster side\n");
         return;
     } else {
@@ -74,7 +75,7 @@ void plp_mat_scale_stride_f32_parallel(const float *__restrict__ pSrc,
                                                    .nPE = nPE,
                                                    .pDst = pDst };
 
-        hal_cl_team_fork(nPE, plp_mat_scale_stride_f32p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_mat_scale_stride_f32p_xpulpv2, (void *)&args);
     }
 }
 
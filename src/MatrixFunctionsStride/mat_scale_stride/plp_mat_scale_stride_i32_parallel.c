@@ -62,9 +62,10 @@ void plp_mat_scale_stride_i32_parallel(const int32_t *__restrict__ pSrc,
                                        int32_t shift,
                                        uint32_t nPE,
                                        int32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_mat_scale_stride_i32(pSrc, M, N, strideSrc, strideDst, scaleFactor, shift, pDst);
         return;
     } else {
         plp_mat_scale_stride_instance_i32 args = { .pSrc = pSrc,
@@ -77,7 +78,7 @@ void plp_mat_scale_stride_i32_parallel(const int32_t *__restrict__ pSrc,
                                                    .nPE = nPE,
                                                    .pDst = pDst };
 
-        hal_cl_team_fork(nPE, plp_mat_scale_stride_i32p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_mat_scale_stride_i32p_xpulpv2, (void *)&args);
     }
 }
 
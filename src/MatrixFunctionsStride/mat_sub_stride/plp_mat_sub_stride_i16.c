@@ -89,6 +89,7 @@ void plp_mat_sub_stride_i16(const int16_t *__restrict__ pSrcA,
                             uint32_t strideB,
                             uint32_t strideY,
                             int16_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_mat_sub_stride_i16s_rv32im(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst);
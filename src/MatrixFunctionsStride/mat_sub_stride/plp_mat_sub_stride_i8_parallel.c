@@ -62,9 +62,10 @@ void plp_mat_sub_stride_i8_parallel(const int8_t *__restrict__ pSrcA,
                                     uint32_t strideY,
                                     uint32_t nPE,
                                     int8_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_mat_sub_stride_i8(pSrcA, pSrcB, M, N, strideA, strideB, strideY, pDst);
         return;
     } else {
         plp_mat_sub_stride_instance_i8 args = { .pSrcA = pSrcA,
@@ -77,7 +78,7 @@ void plp_mat_sub_stride_i8_parallel(const int8_t *__restrict__ pSrcA,
                                                 .nPE = nPE,
                                                 .pDst = pDst };
 
-        hal_cl_team_fork(nPE, plp_mat_sub_stride_i8p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_mat_sub_stride_i8p_xpulpv2, (void *)&args);
     }
 }
 
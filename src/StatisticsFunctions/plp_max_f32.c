@@ -52,6 +52,7 @@
  */
 
 void plp_max_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         *pRes = -1;
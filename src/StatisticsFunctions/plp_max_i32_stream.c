@@ -0,0 +1,90 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_max_i32_stream.c
+ * Description:  32-bit integer streamed max value glue code
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup max
+  @{
+ */
+
+static void plp_max_i32_stream_tile(const void *pSrcA,
+                                    const void *pSrcB __attribute__((unused)),
+                                    void *pDst __attribute__((unused)),
+                                    uint32_t blockSize,
+                                    void *pAcc,
+                                    uint32_t first) {
+    int32_t res;
+
+    plp_max_i32s_xpulpv2((const int32_t *)pSrcA, blockSize, &res);
+
+    if (first) {
+        *(int32_t *)pAcc = res;
+    } else if (res > *(int32_t *)pAcc) {
+        *(int32_t *)pAcc = res;
+    }
+}
+
+static void plp_max_i32_stream_combine(void *pAcc, const void *pPartial) {
+    if (*(const int32_t *)pPartial > *(int32_t *)pAcc) {
+        *(int32_t *)pAcc = *(const int32_t *)pPartial;
+    }
+}
+
+static const plp_stream_op plp_max_i32_stream_op = {
+    plp_max_i32_stream_tile, plp_max_i32_stream_combine, 1, sizeof(int32_t), 0, sizeof(int32_t)
+};
+
+/**
+  @brief Glue code for max value of a 32-bit integer vector in L2.
+  @param[in]  pSrc       points to the input vector
+  @param[in]  blockSize  number of samples in the vector
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pRes       max value returned here
+  @return     none
+
+  @par
+  The vectors may be stored in L2, they are streamed through L1 with the cluster DMA (see
+  plp_stream).
+ */
+void plp_max_i32_stream(const int32_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t nPE,
+                        int32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNC();
+
+    plp_stream(&plp_max_i32_stream_op, pSrc, NULL, NULL, blockSize, nPE, pRes);
+}
+
+/**
+  @} end of max group
+ */
@@ -51,6 +51,7 @@
  */
 
 void plp_min_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         *pRes = -1;
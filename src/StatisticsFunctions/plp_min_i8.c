@@ -51,6 +51,7 @@
  */
 
 void plp_min_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_min_i8s_rv32im(pSrc, blockSize, pRes);
@@ -70,6 +70,7 @@
  */
 
 void plp_power_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_power_f32s_rv32im(pSrc, blockSize, pRes);
@@ -73,6 +73,7 @@ void plp_power_q32(const int32_t *__restrict__ pSrc,
                    uint32_t blockSize,
                    uint32_t fracBits,
                    int32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         plp_power_q32s_rv32im(pSrc, blockSize, fracBits, pRes);
@@ -82,9 +82,10 @@ void plp_power_q32_parallel(    const int32_t *__restrict__ pSrc,
                                 uint32_t deciPoint,
                                 uint32_t nPE,
                                 int32_t *__restrict__ pRes) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_power_q32(pSrc, blockSize, deciPoint, pRes);
         return;
     } else {
 
@@ -101,7 +102,7 @@ void plp_power_q32_parallel(    const int32_t *__restrict__ pSrc,
         S.resBuffer = resBuffer;
 
         // Fork the dot product to nPE cores (i.e. processing units)
-        hal_cl_team_fork(nPE, plp_power_q32p_xpulpv2, (void *)&S);
+        plp_cl_team_fork(nPE, plp_power_q32p_xpulpv2, (void *)&S);
 
         int sum = 0;
         for (i = 0; i < nPE; i++) { // not necessary hal_cl_nb_pe_cores()
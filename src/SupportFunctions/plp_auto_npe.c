@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_auto_npe.c
+ * Description:  Selection of the number of cores from a cost model
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup AutoNPE Automatic Number of Cores
+  Using all cores is not always the fastest choice: forking the team and combining the partial
+  results of the cores cost cycles which, for small dimensions, are not recovered by the
+  parallel speedup. The parallel functions listed in plp_cost_model_id accept nPE = 0, in which
+  case they select the number of cores with plp_auto_npe:
+
+  <pre>
+      plp_dot_prod_f32_parallel(pSrcA, pSrcB, 32, 0, &res);     // runs on 1 or 2 cores
+      plp_mat_mult_f32_parallel(pSrcA, pSrcB, 4, 64, 64, 0, pC); // at most 4 cores, one per row
+  </pre>
+
+  plp_auto_npe evaluates the cost model of the function (see plp_cost_model) for each number of
+  cores and returns the one with the lowest predicted cycles. The work is split into chunks
+  (samples of a vector, rows of a matrix), so no more cores than chunks are used.
+
+  @par Calibration
+  The models are stored in src/CommonTables/plp_cost_model.c. The shipped models are hand-written
+  estimates which have not been calibrated on any target, so the selected nPE is only a rough
+  guess. To calibrate them, run the tests of the parallel functions on the target (they sweep
+  nPE), then fit the models to the benchmark file and regenerate plp_cost_model.c with:
+
+  <pre>
+      test/mrWolf/cost_model.py -b test/mrWolf/bench_YYYY-MM-DD_hh:mm:ss.csv
+  </pre>
+
+  The models can also be replaced at runtime with plp_auto_npe_set_model.
+  Inside plp_cl_team_run, the selected nPE never exceeds the size of the persistent team, and the
+  functions whose kernels synchronize with hal_team_barrier (the integer matrix multiplications)
+  always use the whole team.
+ */
+
+/**
+  @addtogroup AutoNPE
+  @{
+ */
+
+/**
+  @brief      Predicted cycles of a parallel function.
+  @param[in]  id         parallel function
+  @param[in]  numChunks  number of chunks distributed among the cores (e.g. rows, samples)
+  @param[in]  chunkSize  units of work in each chunk
+  @param[in]  nPE        number of cores
+  @return     predicted number of cycles
+ */
+uint32_t plp_auto_npe_cost(plp_cost_model_id id,
+                           uint32_t numChunks,
+                           uint32_t chunkSize,
+                           uint32_t nPE) {
+    const plp_cost_model *model = &plp_cost_models[id];
+    uint32_t chunksPerCore = (numChunks + nPE - 1) / nPE;
+
+    return model->fixed + model->perCore * nPE +
+           (uint32_t)(((uint64_t)model->perUnit * chunksPerCore * chunkSize) >> 8);
+}
+
+/* Parallel functions whose kernel calls hal_team_barrier, which must be executed by all the cores
+ * of the persistent team */
+static int plp_auto_npe_barrier(plp_cost_model_id id) {
+    switch (id) {
+    case PLP_COST_MAT_MULT_I32:
+    case PLP_COST_MAT_MULT_I16:
+    case PLP_COST_MAT_MULT_I8:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+/**
+  @brief      Number of cores which minimizes the predicted cycles of a parallel function (used
+              by the parallel glue code when called with nPE = 0).
+  @param[in]  id         parallel function
+  @param[in]  numChunks  number of chunks distributed among the cores (e.g. rows, samples)
+  @param[in]  chunkSize  units of work in each chunk
+  @return     number of cores, between 1 and the number of cores of the cluster (or of the
+              persistent team inside plp_cl_team_run)
+ */
+uint32_t plp_auto_npe(plp_cost_model_id id, uint32_t numChunks, uint32_t chunkSize) {
+    uint32_t maxPE = hal_cl_nb_pe_cores();
+    uint32_t teamSize = plp_cl_team_size();
+    uint32_t nPE, bestPE = 1;
+    uint32_t cost, bestCost;
+
+    if (teamSize != 0) {
+        /* the parked cores only join the barriers of the kernel if they all run it */
+        if (plp_auto_npe_barrier(id)) {
+            return teamSize;
+        }
+        maxPE = teamSize;
+    }
+
+    if (id >= PLP_COST_NB) {
+        return maxPE;
+    }
+
+    if (numChunks < maxPE) {
+        maxPE = numChunks;
+    }
+
+    bestCost = plp_auto_npe_cost(id, numChunks, chunkSize, 1);
+    for (nPE = 2; nPE <= maxPE; nPE++) {
+        cost = plp_auto_npe_cost(id, numChunks, chunkSize, nPE);
+        if (cost < bestCost) {
+            bestCost = cost;
+            bestPE = nPE;
+        }
+    }
+
+    return bestPE;
+}
+
+/**
+  @brief      Replace the cost model of a parallel function, e.g. after a calibration at runtime.
+  @param[in]  id     parallel function
+  @param[in]  model  points to the new cost model
+  @return     none
+ */
+void plp_auto_npe_set_model(plp_cost_model_id id, const plp_cost_model *model) {
+    if (id < PLP_COST_NB) {
+        plp_cost_models[id] = *model;
+    }
+}
+
+/**
+  @} end of AutoNPE group
+ */
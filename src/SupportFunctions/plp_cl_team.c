@@ -0,0 +1,324 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cl_team.c
+ * Description:  Persistent cluster team and operation lists
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup ClusterTeam Persistent Cluster Team
+  Every parallel glue function forks the team, runs one kernel and joins again. For short vectors,
+  the cost of the fork dominates the useful work. There are two ways to amortize it:
+
+  <b>Persistent team:</b> plp_cl_team_run forks the team only once. Core 0 executes the given
+  function, while the other cores stay parked on the team barrier (i.e. sleeping on the event
+  unit). Each parallel library function called by core 0 inside this function then posts its
+  kernel to the parked cores instead of forking, which costs two barriers instead of a fork and a
+  join:
+
+  <pre>
+      void process(void *arg) {
+          for (int i = 0; i < 100; i++) {
+              plp_dot_prod_f32_parallel(pA[i], pB[i], 128, 8, &pRes[i]);
+          }
+      }
+
+      plp_cl_team_run(8, process, NULL);
+  </pre>
+
+  <b>Operation list:</b> a sequence of parallel kernels (each one with its instance structure) can
+  be recorded in a plp_cl_oplist and executed with plp_cl_oplist_run. The kernels are executed one
+  after the other with a barrier between them, using a single fork (or no fork at all when called
+  inside plp_cl_team_run).
+
+  @par
+  Inside the persistent team, the parallel functions must be called with nPE not larger than the
+  number of cores of the team. Kernels which synchronize internally with hal_team_barrier (for
+  example the matrix multiplications and the FFTs) must be called with nPE equal to the number of
+  cores of the team.
+  Functions called with nPE = 0 (see plp_auto_npe) select a valid number of cores themselves.
+ */
+
+/**
+  @addtogroup ClusterTeam
+  @{
+ */
+
+typedef struct {
+    const plp_cl_oplist *list; // list posted to the parked cores, NULL to stop
+    uint32_t nPE;              // number of cores executing the list
+    uint32_t teamSize;         // number of cores of the persistent team, 0 if not running
+} plp_cl_team_state;
+
+typedef struct {
+    uint32_t nPE;
+    void (*entry)(void *);
+    void *arg;
+} plp_cl_team_args;
+
+typedef struct {
+    const plp_cl_oplist *list;
+    uint32_t nPE;
+} plp_cl_oplist_args;
+
+HAL_CL_L1 static plp_cl_team_state plp_cl_team = { NULL, 0, 0 };
+
+static void plp_cl_oplist_exec(const plp_cl_oplist *list, uint32_t nPE) {
+    uint32_t i;
+
+    for (i = 0; i < list->numOps; i++) {
+        if ((uint32_t)hal_core_id() < nPE) {
+            list->pOps[i].kernel(list->pOps[i].args);
+        }
+
+        if (i + 1 < list->numOps) {
+            hal_team_barrier();
+        }
+    }
+}
+
+static void plp_cl_oplist_kernel(void *args) {
+    plp_cl_oplist_args *S = (plp_cl_oplist_args *)args;
+    plp_cl_oplist_exec(S->list, S->nPE);
+}
+
+static void plp_cl_team_kernel(void *args) {
+    plp_cl_team_args *T = (plp_cl_team_args *)args;
+    const plp_cl_oplist *list;
+
+    if (hal_core_id() == 0) {
+        plp_cl_team.list = NULL;
+        plp_cl_team.teamSize = T->nPE;
+
+        T->entry(T->arg);
+
+        /* release the parked cores with an empty list */
+        plp_cl_team.teamSize = 0;
+        plp_cl_team.list = NULL;
+        hal_team_barrier();
+    } else {
+        for (;;) {
+            /* parked until core 0 posts a list */
+            hal_team_barrier();
+
+            list = plp_cl_team.list;
+            if (list == NULL) {
+                break;
+            }
+
+            plp_cl_oplist_exec(list, plp_cl_team.nPE);
+
+            /* join */
+            hal_team_barrier();
+        }
+    }
+}
+
+/* Executes the list on the parked cores, must be called by core 0 of the persistent team */
+static void plp_cl_team_post(const plp_cl_oplist *list, uint32_t nPE) {
+    if (nPE > plp_cl_team.teamSize) {
+        printf("error: nPE is larger than the number of cores of the persistent team\n");
+        return;
+    }
+
+    plp_cl_team.list = list;
+    plp_cl_team.nPE = nPE;
+    hal_team_barrier();
+
+    plp_cl_oplist_exec(list, nPE);
+
+    hal_team_barrier();
+}
+
+static inline int plp_cl_team_is_running() {
+    return plp_cl_team.teamSize != 0 && hal_cluster_id() != ARCHI_FC_CID && hal_core_id() == 0;
+}
+
+/**
+  @brief      Number of cores of the persistent team of the caller.
+  @return     number of cores of the team when called by core 0 inside plp_cl_team_run, 0
+              otherwise
+
+  @par
+  The parallel glue code uses it to select nPE automatically (see plp_auto_npe).
+ */
+uint32_t plp_cl_team_size(void) {
+    return plp_cl_team_is_running() ? plp_cl_team.teamSize : 0;
+}
+
+static void plp_cl_team_fork_entry(void *args) {
+    plp_cl_team_args *T = (plp_cl_team_args *)args;
+    hal_cl_team_fork(T->nPE, T->entry, T->arg);
+}
+
+/* Forks the team, which is sent to the cluster when called from the fabric controller (see
+ * plp_fc_set_mode) */
+static void plp_cl_team_fork_any(uint32_t nPE, void (*entry)(void *), void *arg) {
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_cl_team_args T = { nPE, entry, arg };
+        if (plp_fc_cluster_call(plp_cl_team_fork_entry, (void *)&T) != 0) {
+            printf("parallel processing supported only for cluster side\n");
+        }
+    } else {
+        hal_cl_team_fork(nPE, entry, arg);
+    }
+}
+
+/**
+  @brief      Run a function on core 0 while the other cores of the team stay parked.
+  @param[in]  nPE    number of cores in the team
+  @param[in]  entry  function executed by core 0
+  @param[in]  arg    argument passed to entry
+  @return     none
+
+  @par
+  The parallel library functions called by entry are executed by the parked cores, without forking
+  the team again. Must be called outside of a parallel region. Called from the fabric controller,
+  the whole team runs on the cluster in PLP_FC_OFFLOAD mode, while in PLP_FC_SEQUENTIAL mode entry
+  is executed by the fabric controller itself (see plp_fc_set_mode).
+ */
+void plp_cl_team_run(uint32_t nPE, void (*entry)(void *), void *arg) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        entry(arg);
+        return;
+    }
+
+    if (plp_cl_team.teamSize != 0) {
+        printf("error: the persistent team is already running\n");
+        return;
+    }
+
+    plp_cl_team_args T = { nPE, entry, arg };
+
+    plp_cl_team_fork_any(nPE, plp_cl_team_kernel, (void *)&T);
+}
+
+/**
+  @brief      Execute a parallel kernel on nPE cores (used by the parallel glue code).
+  @param[in]  nPE     number of cores executing the kernel
+  @param[in]  kernel  parallel kernel
+  @param[in]  args    points to the instance structure passed to the kernel
+  @return     none
+
+  @par
+  Outside of plp_cl_team_run, this is the same as hal_cl_team_fork. Inside, the kernel is posted to
+  the parked cores. Called from the fabric controller, the kernel is forked on the cluster (see
+  plp_fc_cluster_call).
+ */
+void plp_cl_team_fork(uint32_t nPE, void (*kernel)(void *), void *args) {
+
+#ifdef PLP_TRACE
+    /* record when each core starts and finishes the kernel */
+    plp_trace_kernel_args traceArgs = { kernel, args, plp_trace_fork(kernel) };
+    kernel = plp_trace_kernel;
+    args = (void *)&traceArgs;
+#endif
+
+#ifdef PLP_PROFILE
+    /* count the kernel on each core, for the glue function which forks it */
+    plp_profile_kernel_args profileArgs = { kernel, args, plp_profile_current() };
+    kernel = plp_profile_kernel;
+    args = (void *)&profileArgs;
+#endif
+
+    if (plp_cl_team_is_running()) {
+        plp_cl_op op = { kernel, args };
+        plp_cl_oplist list = { &op, 1, 1 };
+        plp_cl_team_post(&list, nPE);
+    } else {
+        plp_cl_team_fork_any(nPE, kernel, args);
+    }
+
+#ifdef PLP_TRACE
+    plp_trace_join(traceArgs.fork);
+#endif
+}
+
+/**
+  @brief      Initialize an empty operation list.
+  @param[out] list    points to the operation list
+  @param[in]  pOps    points to the array holding the operations
+  @param[in]  maxOps  capacity of the pOps array
+  @return     none
+ */
+void plp_cl_oplist_init(plp_cl_oplist *list, plp_cl_op *pOps, uint32_t maxOps) {
+    list->pOps = pOps;
+    list->numOps = 0;
+    list->maxOps = maxOps;
+}
+
+/**
+  @brief      Append a parallel kernel to an operation list.
+  @param[in]  list    points to the operation list
+  @param[in]  kernel  parallel kernel, e.g. plp_dot_prod_f32p_xpulpv2
+  @param[in]  args    points to the instance structure passed to the kernel, which must stay valid
+                      until the list is executed
+  @return     0 on success, -1 if the list is full
+ */
+int32_t plp_cl_oplist_add(plp_cl_oplist *list, void (*kernel)(void *), void *args) {
+    if (list->numOps >= list->maxOps) {
+        return -1;
+    }
+
+    list->pOps[list->numOps].kernel = kernel;
+    list->pOps[list->numOps].args = args;
+    list->numOps++;
+    return 0;
+}
+
+/**
+  @brief      Execute all kernels of an operation list on nPE cores with a single fork.
+  @param[in]  list  points to the operation list
+  @param[in]  nPE   number of cores executing the kernels
+  @return     none
+
+  @par
+  The kernels are executed in the order in which they were added, with a barrier between two
+  consecutive kernels, such that each kernel can consume the results of the previous ones.
+  Called from the fabric controller, the list is always executed on the cluster.
+ */
+void plp_cl_oplist_run(const plp_cl_oplist *list, uint32_t nPE) {
+
+    if (list->numOps == 0) {
+        return;
+    }
+
+    if (plp_cl_team_is_running()) {
+        plp_cl_team_post(list, nPE);
+    } else {
+        plp_cl_oplist_args S = { list, nPE };
+        plp_cl_team_fork_any(nPE, plp_cl_oplist_kernel, (void *)&S);
+    }
+}
+
+/**
+  @} end of ClusterTeam group
+ */
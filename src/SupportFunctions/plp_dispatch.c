@@ -0,0 +1,182 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_dispatch.c
+ * Description:  Runtime kernel dispatch table
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Dispatch Kernel Dispatch
+  The glue code of the dispatched functions (see plp_kernel_id) does not select the kernel with a
+  branch on the domain, but reads it from a table of function pointers with plp_dispatch. The table
+  is initialized with the default kernels (RV32IM on the fabric controller, XPULPV2 on the
+  cluster), and can be modified at runtime without recompiling the library.
+
+  Each function and domain has up to PLP_DISPATCH_NB_VARIANTS variants, each one used up to a
+  maximum size. For example, the vectorized kernel has a setup cost which does not pay off for very
+  short vectors, which can be computed with the scalar kernel instead:
+
+  <pre>
+      plp_dispatch_register(PLP_KERNEL_DOT_PROD_I16, PLP_DISPATCH_CL, 8,
+                            (plp_kernel_fn)plp_dot_prod_i16s_rv32im);
+  </pre>
+
+  Afterwards, plp_dot_prod_i16 calls plp_dot_prod_i16s_rv32im on the cluster for blockSize up to 8,
+  and plp_dot_prod_i16s_xpulpv2 for larger vectors. Registering a variant with maxSize
+  PLP_DISPATCH_ALL_SIZES replaces the default kernel. plp_dispatch_reset and plp_dispatch_init
+  restore the defaults.
+
+  @par
+  The kernel must have the signature of the dispatched function (e.g. plp_dot_prod_i16_kernel). The
+  table must not be modified while other cores are calling the dispatched functions.
+ */
+
+/**
+  @addtogroup Dispatch
+  @{
+ */
+
+#define PLP_DISPATCH_DEFAULT(kernel)                                                               \
+    {                                                                                              \
+        1, {                                                                                       \
+            { PLP_DISPATCH_ALL_SIZES, (plp_kernel_fn)(kernel) }                                    \
+        }                                                                                          \
+    }
+
+/* default kernels of one domain, in the order of plp_kernel_id */
+#define PLP_DISPATCH_DEFAULTS(isa)                                                                 \
+    {                                                                                              \
+        PLP_DISPATCH_DEFAULT(plp_dot_prod_i32s_##isa),                                             \
+        PLP_DISPATCH_DEFAULT(plp_dot_prod_i16s_##isa),                                             \
+        PLP_DISPATCH_DEFAULT(plp_dot_prod_i8s_##isa),                                              \
+        PLP_DISPATCH_DEFAULT(plp_dot_prod_q32s_##isa),                                             \
+        PLP_DISPATCH_DEFAULT(plp_dot_prod_q16s_##isa),                                             \
+        PLP_DISPATCH_DEFAULT(plp_dot_prod_q8s_##isa),                                              \
+        PLP_DISPATCH_DEFAULT(plp_dot_prod_f32s_##isa),                                             \
+        PLP_DISPATCH_DEFAULT(plp_add_i32s_##isa),                                                  \
+        PLP_DISPATCH_DEFAULT(plp_add_i16s_##isa),                                                  \
+        PLP_DISPATCH_DEFAULT(plp_add_i8s_##isa),                                                   \
+        PLP_DISPATCH_DEFAULT(plp_sub_i32s_##isa),                                                  \
+        PLP_DISPATCH_DEFAULT(plp_sub_i16s_##isa),                                                  \
+        PLP_DISPATCH_DEFAULT(plp_sub_i8s_##isa),                                                   \
+        PLP_DISPATCH_DEFAULT(plp_mult_i32s_##isa),                                                 \
+        PLP_DISPATCH_DEFAULT(plp_mult_i16s_##isa),                                                 \
+        PLP_DISPATCH_DEFAULT(plp_mult_i8s_##isa),                                                  \
+    }
+
+static const plp_dispatch_entry plp_dispatch_defaults[PLP_DISPATCH_NB_DOMAINS][PLP_KERNEL_NB] = {
+    PLP_DISPATCH_DEFAULTS(rv32im), PLP_DISPATCH_DEFAULTS(xpulpv2)
+};
+
+plp_dispatch_entry plp_dispatch_table[PLP_DISPATCH_NB_DOMAINS][PLP_KERNEL_NB] = {
+    PLP_DISPATCH_DEFAULTS(rv32im), PLP_DISPATCH_DEFAULTS(xpulpv2)
+};
+
+/**
+  @brief      Restore the default kernels of all dispatched functions.
+  @return     none
+ */
+void plp_dispatch_init() {
+    uint32_t id;
+
+    for (id = 0; id < PLP_KERNEL_NB; id++) {
+        plp_dispatch_reset((plp_kernel_id)id);
+    }
+}
+
+/**
+  @brief      Restore the default kernels of one dispatched function, in both domains.
+  @param[in]  id  kernel to restore
+  @return     none
+ */
+void plp_dispatch_reset(plp_kernel_id id) {
+    uint32_t domain;
+
+    if (id >= PLP_KERNEL_NB) {
+        return;
+    }
+
+    for (domain = 0; domain < PLP_DISPATCH_NB_DOMAINS; domain++) {
+        plp_dispatch_table[domain][id] = plp_dispatch_defaults[domain][id];
+    }
+}
+
+/**
+  @brief      Register a kernel variant used for the sizes up to maxSize.
+  @param[in]  id       dispatched function
+  @param[in]  domain   domain in which the variant is used
+  @param[in]  maxSize  largest size handled by the variant, PLP_DISPATCH_ALL_SIZES to replace the
+                       default kernel
+  @param[in]  kernel   kernel with the signature of the dispatched function, e.g.
+                       plp_dot_prod_i16_kernel
+  @return     0 on success, -1 if the arguments are invalid or all variants are used
+
+  @par
+  A variant registered with the same maxSize as an existing one replaces it.
+ */
+int32_t plp_dispatch_register(plp_kernel_id id,
+                              plp_dispatch_domain domain,
+                              uint32_t maxSize,
+                              plp_kernel_fn kernel) {
+    plp_dispatch_entry *entry;
+    uint32_t i, j;
+
+    if (id >= PLP_KERNEL_NB || domain >= PLP_DISPATCH_NB_DOMAINS || kernel == NULL) {
+        return -1;
+    }
+
+    entry = &plp_dispatch_table[domain][id];
+
+    /* the variants are sorted by maxSize, and the last one has PLP_DISPATCH_ALL_SIZES */
+    for (i = 0; entry->variants[i].maxSize < maxSize; i++)
+        ;
+
+    if (entry->variants[i].maxSize == maxSize) {
+        entry->variants[i].kernel = kernel;
+        return 0;
+    }
+
+    if (entry->numVariants >= PLP_DISPATCH_NB_VARIANTS) {
+        return -1;
+    }
+
+    for (j = entry->numVariants; j > i; j--) {
+        entry->variants[j] = entry->variants[j - 1];
+    }
+    entry->variants[i].maxSize = maxSize;
+    entry->variants[i].kernel = kernel;
+    entry->numVariants++;
+
+    return 0;
+}
+
+/**
+  @} end of Dispatch group
+ */
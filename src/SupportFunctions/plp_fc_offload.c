@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_fc_offload.c
+ * Description:  Parallel functions called from the fabric controller
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup FCOffload Parallel Functions on the Fabric Controller
+  The parallel functions can be called from the fabric controller as well. The same application
+  code then runs correctly regardless of the domain which calls it, in one of two modes
+  (see plp_fc_set_mode):
+
+  <b>PLP_FC_SEQUENTIAL</b> (default): the parallel function calls its single-core counterpart,
+  which runs the RV32IM kernel on the fabric controller. This avoids powering up the cluster for
+  small amounts of work.
+
+  <b>PLP_FC_OFFLOAD</b>: the cluster is powered up on the first call and stays up until
+  plp_fc_cluster_close. Each parallel kernel forked by the glue code (see plp_cl_team_fork) is
+  sent to core 0 of the cluster, which forks it on nPE cores, while the fabric controller waits.
+
+  <pre>
+      plp_fc_set_mode(PLP_FC_OFFLOAD);
+      plp_mat_mult_i16_parallel(pSrcA, pSrcB, 64, 64, 64, 8, pDstC); // on the cluster
+      plp_fc_cluster_close();
+  </pre>
+
+  The default mode can be changed at compile time with PLP_FC_DEFAULT_MODE, e.g. by building the
+  library with PLP_FC_OFFLOAD=1. If the cluster cannot be opened, the functions fall back to the
+  single-core kernels. Functions without a kernel for the fabric controller (most floating-point
+  ones, which need the FPU of the cluster) always offload their kernels. The buffers passed to an
+  offloaded function must be accessible from the cluster, i.e. in L2 or in the cluster L1. The
+  streaming functions (see plp_stream) use the DMA of the cluster and must still be called
+  from the cluster.
+ */
+
+/**
+  @addtogroup FCOffload
+  @{
+ */
+
+static plp_fc_mode plp_fc_current_mode = PLP_FC_DEFAULT_MODE;
+static hal_cluster_t plp_fc_cluster;
+static int32_t plp_fc_cluster_running = 0;
+
+/**
+  @brief      Select how the parallel functions proceed when called from the fabric controller.
+  @param[in]  mode  PLP_FC_SEQUENTIAL or PLP_FC_OFFLOAD
+  @return     none
+ */
+void plp_fc_set_mode(plp_fc_mode mode) {
+    plp_fc_current_mode = mode;
+}
+
+/**
+  @brief      Current mode of the fabric controller.
+  @return     mode selected with plp_fc_set_mode, or PLP_FC_DEFAULT_MODE
+ */
+plp_fc_mode plp_fc_get_mode(void) {
+    return plp_fc_current_mode;
+}
+
+/**
+  @brief      Power up the cluster for the offloaded kernels, unless it is already running.
+  @return     0 on success, -1 if the cluster cannot be opened
+ */
+int32_t plp_fc_cluster_open(void) {
+    if (!plp_fc_cluster_running) {
+        if (hal_cluster_open(&plp_fc_cluster) != 0) {
+            printf("error: cannot open the cluster\n");
+            return -1;
+        }
+        plp_fc_cluster_running = 1;
+    }
+
+    return 0;
+}
+
+/**
+  @brief      Power down the cluster opened by plp_fc_cluster_open.
+  @return     none
+ */
+void plp_fc_cluster_close(void) {
+    if (plp_fc_cluster_running) {
+        hal_cluster_close(&plp_fc_cluster);
+        plp_fc_cluster_running = 0;
+    }
+}
+
+/**
+  @brief      Decide if a parallel function called from the fabric controller offloads its kernels
+              to the cluster (used by the parallel glue code).
+  @return     1 if the mode is PLP_FC_OFFLOAD and the cluster is running, 0 to run the
+              single-core kernel on the fabric controller
+ */
+int32_t plp_fc_offload(void) {
+    if (plp_fc_current_mode != PLP_FC_OFFLOAD) {
+        return 0;
+    }
+
+    return plp_fc_cluster_open() == 0;
+}
+
+/**
+  @brief      Execute a function on core 0 of the cluster and wait until it returns.
+  @param[in]  entry  function executed on the cluster
+  @param[in]  arg    argument passed to entry
+  @return     0 on success, -1 if the cluster cannot be opened
+
+  @par
+  Called from the cluster, entry is executed directly.
+ */
+int32_t plp_fc_cluster_call(void (*entry)(void *), void *arg) {
+    if (hal_cluster_id() != ARCHI_FC_CID) {
+        entry(arg);
+        return 0;
+    }
+
+    if (plp_fc_cluster_open() != 0) {
+        return -1;
+    }
+
+    hal_cluster_call(&plp_fc_cluster, entry, arg);
+    return 0;
+}
+
+/**
+  @} end of FCOffload group
+ */
@@ -79,6 +79,7 @@
  */
 
 void plp_fill_i32(int32_t value, int32_t *__restrict__ pDst, uint32_t blockSize) {
+    PLP_PROFILE_FUNC();
 
     uint32_t blkCnt; /* Loop counter */
 
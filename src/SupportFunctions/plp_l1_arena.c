@@ -0,0 +1,167 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_l1_arena.c
+ * Description:  User-provided L1 scratch arena and library scratch allocation
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup L1Arena L1 Scratch Arena
+  Some functions need temporary buffers in L1 (for example the convolutions and the DWTs). By
+  default, these buffers are allocated with hal_cl_l1_malloc (or hal_fc_l1_malloc) and freed again
+  on every call. In streaming loops, the allocator cost and the resulting L1 fragmentation can be
+  avoided by handing a user-provided memory region to the library:
+
+  <pre>
+      uint32_t size = plp_conv_i32_parallel_get_workspace_size(lenA, lenB, 8);
+      plp_l1_arena arena;
+      plp_l1_arena_init(&arena, hal_cl_l1_malloc(size), size);
+      plp_l1_arena_use(&arena);
+
+      for (...) {
+          plp_conv_i32_parallel(pA, lenA, pB, lenB, 8, pRes); // no allocation
+      }
+
+      plp_l1_arena_use(NULL);
+  </pre>
+
+  The arena is a bump allocator: the library releases its scratch buffers at the end of each call,
+  such that the arena is back to the state of before the call. The arena can also be used directly
+  with plp_l1_arena_alloc and plp_l1_arena_reset.
+
+  Each function which needs scratch memory has a matching *_get_workspace_size() function, which
+  returns the number of bytes the arena must have available for the call.
+ */
+
+/**
+  @addtogroup L1Arena
+  @{
+ */
+
+static plp_l1_arena *plp_l1_scratch_arena = NULL;
+
+/**
+  @brief      Initialize an arena on a user-provided memory region.
+  @param[out] arena  points to the arena
+  @param[in]  pMem   points to the memory region, should be aligned to PLP_L1_ARENA_ALIGN
+  @param[in]  size   size of the memory region in bytes
+  @return     none
+ */
+void plp_l1_arena_init(plp_l1_arena *arena, void *pMem, uint32_t size) {
+    arena->pBase = (uint8_t *)pMem;
+    arena->size = pMem == NULL ? 0 : size;
+    arena->offset = 0;
+}
+
+/**
+  @brief      Allocate memory from the arena.
+  @param[in]  arena  points to the arena
+  @param[in]  size   number of bytes, rounded up to PLP_L1_ARENA_ALIGN
+  @return     pointer to the allocated memory, or NULL if the arena is too small
+ */
+void *plp_l1_arena_alloc(plp_l1_arena *arena, uint32_t size) {
+    uint32_t rsize = PLP_L1_ARENA_SIZE(size);
+
+    if (arena->size - arena->offset < rsize) {
+        return NULL;
+    }
+
+    void *ptr = arena->pBase + arena->offset;
+    arena->offset += rsize;
+    return ptr;
+}
+
+/**
+  @brief      Release all memory allocated from the arena.
+  @param[in]  arena  points to the arena
+  @return     none
+ */
+void plp_l1_arena_reset(plp_l1_arena *arena) {
+    arena->offset = 0;
+}
+
+/**
+  @brief      Select the arena from which the library allocates its scratch buffers.
+  @param[in]  arena  points to the arena, or NULL to use hal_cl_l1_malloc (default)
+  @return     none
+
+  @par
+  The arena is used both by the fabric controller and by the cluster, so it must be placed in a
+  memory which is accessible by the caller of the library functions.
+ */
+void plp_l1_arena_use(plp_l1_arena *arena) {
+    plp_l1_scratch_arena = arena;
+}
+
+/**
+  @brief      Allocate a scratch buffer for a library function (used internally).
+  @param[in]  size  number of bytes
+  @return     pointer to the buffer, or NULL if there is not enough memory
+ */
+void *plp_l1_scratch_alloc(uint32_t size) {
+    if (plp_l1_scratch_arena != NULL) {
+        return plp_l1_arena_alloc(plp_l1_scratch_arena, size);
+    } else if (hal_cluster_id() == ARCHI_FC_CID) {
+        return hal_fc_l1_malloc(size);
+    } else {
+        return hal_cl_l1_malloc(size);
+    }
+}
+
+/**
+  @brief      Free a scratch buffer allocated with plp_l1_scratch_alloc (used internally).
+  @param[in]  ptr   points to the buffer
+  @param[in]  size  number of bytes, same as for plp_l1_scratch_alloc
+  @return     none
+
+  @par
+  When an arena is used, freeing a buffer also releases all buffers allocated after it.
+ */
+void plp_l1_scratch_free(void *ptr, uint32_t size) {
+    if (ptr == NULL) {
+        return;
+    }
+
+    if (plp_l1_scratch_arena != NULL) {
+        plp_l1_arena *arena = plp_l1_scratch_arena;
+        uint8_t *p = (uint8_t *)ptr;
+        if (p >= arena->pBase && p < arena->pBase + arena->offset) {
+            arena->offset = p - arena->pBase;
+        }
+    } else if (hal_cluster_id() == ARCHI_FC_CID) {
+        hal_fc_l1_free(ptr, size);
+    } else {
+        hal_cl_l1_free(ptr, size);
+    }
+}
+
+/**
+  @} end of L1Arena group
+ */
@@ -0,0 +1,258 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_profile.c
+ * Description:  Profiling hooks of the glue functions
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Profile Profiling
+  When the library is built with PLP_PROFILE defined (`make PLP_PROFILE=1`), every glue function
+  starts with the hook PLP_PROFILE_FUNC, which counts the calls of the function and accumulates
+  the performance counters (cycles, instructions, load stalls, TCDM contentions and instruction
+  cache misses) until it returns. The kernels forked by the parallel glue functions additionally
+  accumulate the counters of each core. Without PLP_PROFILE, the hooks are empty.
+
+  <pre>
+      plp_profile_start();
+
+      application(); // calls the library functions
+
+      plp_profile_stop();
+      plp_profile_dump();
+  </pre>
+
+  plp_profile_dump prints one CSV line for each called function with the totals (core "all"),
+  followed by one line for each core which executed its parallel kernels:
+
+  <pre>
+      function,core,calls,cycles,instructions,ld_stall,tcdm_cont,imiss
+      plp_dot_prod_i32_parallel,all,100,41200,25300,120,310,12
+      plp_dot_prod_i32_parallel,0,100,33100,21200,40,95,10
+      ...
+  </pre>
+
+  @par
+  The counters of a function include the functions it calls. plp_profile_start must be called on
+  the core which calls the library functions (the fabric controller, or core 0 of the cluster). On
+  the boards, only one performance counter exists, define PLP_PROFILE_EVENTS to select it.
+ */
+
+/**
+  @addtogroup Profile
+  @{
+ */
+
+static const int plp_profile_events[PLP_PROFILE_NB_COUNTERS] = {
+    HAL_PERF_CYCLES, HAL_PERF_INSTR, HAL_PERF_LD_STALL, HAL_PERF_TCDM_CONT, HAL_PERF_IMISS
+};
+
+static plp_profile_entry *plp_profile_table = NULL;
+static plp_profile_entry *plp_profile_active = NULL;
+static hal_perf_t plp_profile_perf;
+static hal_perf_t plp_profile_core_perf[PLP_PROFILE_NB_PE];
+
+static inline void plp_profile_read(uint32_t *counters) {
+    uint32_t i;
+
+    for (i = 0; i < PLP_PROFILE_NB_COUNTERS; i++) {
+        counters[i] = hal_perf_read(plp_profile_events[i]);
+    }
+}
+
+/**
+  @brief      Configure and start the performance counters used by the profiling hooks.
+  @return     none
+ */
+void plp_profile_start() {
+    hal_perf_init(&plp_profile_perf);
+    hal_perf_conf(&plp_profile_perf, PLP_PROFILE_EVENTS);
+    hal_perf_reset(&plp_profile_perf);
+    hal_perf_start(&plp_profile_perf);
+}
+
+/**
+  @brief      Stop the performance counters used by the profiling hooks.
+  @return     none
+ */
+void plp_profile_stop() {
+    hal_perf_stop(&plp_profile_perf);
+}
+
+/**
+  @brief      Clear the counters of all profiled functions.
+  @return     none
+ */
+void plp_profile_reset() {
+    plp_profile_entry *entry;
+    uint32_t i, j;
+
+    for (entry = plp_profile_table; entry != NULL; entry = entry->next) {
+        entry->calls = 0;
+        for (i = 0; i < PLP_PROFILE_NB_COUNTERS; i++) {
+            entry->counters[i] = 0;
+        }
+        for (j = 0; j < PLP_PROFILE_NB_PE; j++) {
+            entry->coreCalls[j] = 0;
+            for (i = 0; i < PLP_PROFILE_NB_COUNTERS; i++) {
+                entry->coreCounters[j][i] = 0;
+            }
+        }
+    }
+}
+
+/**
+  @brief      Print the profiling table in CSV format.
+  @return     none
+ */
+void plp_profile_dump() {
+    plp_profile_entry *entry;
+    uint32_t j;
+
+    printf("function,core,calls,cycles,instructions,ld_stall,tcdm_cont,imiss\n");
+
+    for (entry = plp_profile_table; entry != NULL; entry = entry->next) {
+        if (entry->calls == 0) {
+            continue;
+        }
+
+        printf("%s,all,%u,%u,%u,%u,%u,%u\n", entry->name, entry->calls, entry->counters[0],
+               entry->counters[1], entry->counters[2], entry->counters[3], entry->counters[4]);
+
+        for (j = 0; j < PLP_PROFILE_NB_PE; j++) {
+            if (entry->coreCalls[j] != 0) {
+                printf("%s,%u,%u,%u,%u,%u,%u,%u\n", entry->name, j, entry->coreCalls[j],
+                       entry->coreCounters[j][0], entry->coreCounters[j][1],
+                       entry->coreCounters[j][2], entry->coreCounters[j][3],
+                       entry->coreCounters[j][4]);
+            }
+        }
+    }
+}
+
+/**
+  @brief      Begin a profiled call (used by PLP_PROFILE_FUNC).
+  @param[in]  entry  entry of the called function
+  @return     state of the call, passed to plp_profile_end
+ */
+plp_profile_scope plp_profile_begin(plp_profile_entry *entry) {
+    plp_profile_scope scope;
+
+    if (!entry->registered) {
+        entry->registered = 1;
+        entry->next = plp_profile_table;
+        plp_profile_table = entry;
+    }
+
+    scope.entry = entry;
+    scope.parent = plp_profile_active;
+    plp_profile_active = entry;
+
+    plp_profile_read(scope.counters);
+    return scope;
+}
+
+/**
+  @brief      End a profiled call (used by PLP_PROFILE_FUNC).
+  @param[in]  scope  state returned by plp_profile_begin
+  @return     none
+ */
+void plp_profile_end(plp_profile_scope *scope) {
+    uint32_t counters[PLP_PROFILE_NB_COUNTERS];
+    plp_profile_entry *entry = scope->entry;
+    uint32_t i;
+
+    plp_profile_read(counters);
+
+    entry->calls++;
+    for (i = 0; i < PLP_PROFILE_NB_COUNTERS; i++) {
+        entry->counters[i] += counters[i] - scope->counters[i];
+    }
+
+    plp_profile_active = scope->parent;
+}
+
+/**
+  @brief      Entry of the innermost profiled call which is running (used by plp_cl_team_fork).
+  @return     points to the entry, or NULL outside of profiled calls
+ */
+plp_profile_entry *plp_profile_current() {
+    return plp_profile_active;
+}
+
+/**
+  @brief      Wrap a parallel kernel such that each core counts its execution (used by
+              plp_cl_team_fork).
+  @param[in]  args  points to a plp_profile_kernel_args structure
+  @return     none
+
+  @par
+  Core 0 uses the counters started by plp_profile_start, the other cores start their own counters
+  for the duration of the kernel.
+ */
+void plp_profile_kernel(void *args) {
+    plp_profile_kernel_args *P = (plp_profile_kernel_args *)args;
+    uint32_t core_id = hal_core_id();
+    uint32_t start[PLP_PROFILE_NB_COUNTERS];
+    uint32_t stop[PLP_PROFILE_NB_COUNTERS];
+    uint32_t i;
+
+    if (core_id != 0 && core_id < PLP_PROFILE_NB_PE) {
+        hal_perf_t *perf = &plp_profile_core_perf[core_id];
+        hal_perf_init(perf);
+        hal_perf_conf(perf, PLP_PROFILE_EVENTS);
+        hal_perf_reset(perf);
+        hal_perf_start(perf);
+    }
+
+    plp_profile_read(start);
+
+    P->kernel(P->args);
+
+    plp_profile_read(stop);
+
+    if (core_id < PLP_PROFILE_NB_PE) {
+        if (core_id != 0) {
+            hal_perf_stop(&plp_profile_core_perf[core_id]);
+        }
+
+        /* each core writes only its own counters */
+        if (P->entry != NULL) {
+            P->entry->coreCalls[core_id]++;
+            for (i = 0; i < PLP_PROFILE_NB_COUNTERS; i++) {
+                P->entry->coreCounters[core_id][i] += stop[i] - start[i];
+            }
+        }
+    }
+}
+
+/**
+  @} end of Profile group
+ */
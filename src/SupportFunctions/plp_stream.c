@@ -0,0 +1,277 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_stream.c
+ * Description:  Double-buffered L2 to L1 streaming of elementwise operations and reductions
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Stream L2 Streaming
+  The library functions expect their operands in L1. plp_stream processes vectors which are stored
+  in L2 and which can be much larger than L1: the vectors are split into tiles of
+  PLP_STREAM_TILE_SIZE bytes, which are copied to L1 with the cluster DMA into two alternating
+  (ping-pong) buffers. While the cores process one tile, the DMA loads the next one and writes the
+  results of the previous one back to L2.
+
+  Each tile is split among nPE cores. Elementwise operations write their results to the output
+  vector, while reductions keep one partial result per core, which are combined at the end.
+
+  The functions with the suffix _stream (e.g. plp_dot_prod_i32_stream) are built on plp_stream. Other
+  operations can be streamed by describing them with a plp_stream_op:
+
+  <pre>
+      static void scale_tile(const void *pSrcA, const void *pSrcB, void *pDst, uint32_t blockSize,
+                             void *pAcc, uint32_t first) {
+          plp_scale_i32s_xpulpv2(pSrcA, 3, 0, pDst, blockSize);
+      }
+
+      static const plp_stream_op scale_op = { scale_tile, NULL, 1, sizeof(int32_t), sizeof(int32_t), 0 };
+
+      plp_stream(&scale_op, pSrcL2, NULL, pDstL2, blockSize, 8, NULL);
+  </pre>
+
+  The L1 buffers are allocated with plp_l1_scratch_alloc, see plp_stream_get_workspace_size.
+ */
+
+/**
+  @addtogroup Stream
+  @{
+ */
+
+typedef struct {
+    const plp_stream_op *op;
+    const uint8_t *pSrcA; // current tile of the first input (L1)
+    const uint8_t *pSrcB; // current tile of the second input (L1)
+    uint8_t *pDst;        // current output tile (L1)
+    uint8_t *pPartial;    // partial results, one per core
+    uint32_t blockSize;   // number of elements in the current tile
+    uint32_t chunkSize;   // number of elements processed by each core
+    uint32_t first;       // set for the first tile
+} plp_stream_instance;
+
+static void plp_stream_kernel(void *args) {
+    plp_stream_instance *S = (plp_stream_instance *)args;
+    const plp_stream_op *op = S->op;
+    uint32_t core_id = hal_core_id();
+    uint32_t start = core_id * S->chunkSize;
+
+    if (start >= S->blockSize) {
+        return;
+    }
+
+    uint32_t len = S->blockSize - start;
+    if (len > S->chunkSize) {
+        len = S->chunkSize;
+    }
+
+    op->kernel(S->pSrcA + start * op->srcSize,
+               S->pSrcB == NULL ? NULL : S->pSrcB + start * op->srcSize,
+               S->pDst == NULL ? NULL : S->pDst + start * op->dstSize, len,
+               S->pPartial == NULL ? NULL : S->pPartial + core_id * op->accSize, S->first);
+}
+
+static inline uint32_t plp_stream_tile_len(const plp_stream_op *op) {
+    return PLP_STREAM_TILE_SIZE / op->srcSize;
+}
+
+/**
+  @brief      Scratch memory needed by plp_stream (see plp_l1_arena_use).
+  @param[in]  op   points to the operation
+  @param[in]  nPE  number of cores processing each tile
+  @return     size in bytes
+ */
+uint32_t plp_stream_get_workspace_size(const plp_stream_op *op, uint32_t nPE) {
+    uint32_t tileLen = plp_stream_tile_len(op);
+
+    return PLP_L1_ARENA_SIZE(2 * op->numSrc * PLP_STREAM_TILE_SIZE + 2 * tileLen * op->dstSize +
+                             nPE * op->accSize);
+}
+
+/**
+  @brief      Apply an operation to vectors in L2, streaming them through L1 with double buffering.
+  @param[in]  op         points to the operation
+  @param[in]  pSrcA      points to the first input vector (L2)
+  @param[in]  pSrcB      points to the second input vector (L2), NULL if op->numSrc is 1
+  @param[out] pDst       points to the output vector (L2), NULL for reductions
+  @param[in]  blockSize  number of samples in each vector
+  @param[in]  nPE        number of cores processing each tile
+  @param[out] pRes       result of reductions returned here, NULL for elementwise operations
+  @return     none
+
+  @par
+  Must be called from the cluster, since it uses the cluster DMA. The DMA transfers are issued by
+  the calling core, while the tiles are processed with plp_cl_team_fork.
+ */
+void plp_stream(const plp_stream_op *op,
+                const void *pSrcA,
+                const void *pSrcB,
+                void *pDst,
+                uint32_t blockSize,
+                uint32_t nPE,
+                void *pRes) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("streaming supported only for cluster side\n");
+        return;
+    }
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    uint32_t tileLen = plp_stream_tile_len(op);
+    uint32_t srcBytes = tileLen * op->srcSize;
+    uint32_t dstBytes = tileLen * op->dstSize;
+    uint32_t numTiles = (blockSize + tileLen - 1) / tileLen;
+    uint32_t wsSize = plp_stream_get_workspace_size(op, nPE);
+    uint32_t t, i;
+
+    uint8_t *pWs = (uint8_t *)plp_l1_scratch_alloc(wsSize);
+    if (pWs == NULL) {
+        printf("error: not enough L1 memory for streaming\n");
+        return;
+    }
+
+    uint8_t *pBufA[2] = { pWs, pWs + srcBytes };
+    uint8_t *pBufB[2] = { NULL, NULL };
+    uint8_t *pBufDst[2] = { NULL, NULL };
+    uint8_t *pNext = pWs + 2 * srcBytes;
+
+    if (op->numSrc == 2) {
+        pBufB[0] = pNext;
+        pBufB[1] = pNext + srcBytes;
+        pNext += 2 * srcBytes;
+    }
+
+    if (op->dstSize != 0) {
+        pBufDst[0] = pNext;
+        pBufDst[1] = pNext + dstBytes;
+        pNext += 2 * dstBytes;
+    }
+
+    hal_cl_dma_cmd_t loadA, loadB;
+    hal_cl_dma_cmd_t store[2];
+    uint32_t storePending[2] = { 0, 0 };
+
+    plp_stream_instance S;
+    S.op = op;
+    S.pPartial = op->accSize != 0 ? pNext : NULL;
+    S.first = 1;
+
+    /* all the tiles have the same length, except the last one, so the first tile determines which
+     * cores hold a partial result */
+    uint32_t firstLen = blockSize < tileLen ? blockSize : tileLen;
+    S.chunkSize = (((firstLen + nPE - 1) / nPE) + 3) & ~3U;
+
+    /* load the first tile */
+    hal_cl_dma_cmd((uintptr_t)pSrcA, (uintptr_t)pBufA[0], firstLen * op->srcSize,
+                   HAL_CL_DMA_DIR_EXT2LOC, 0, &loadA);
+    if (op->numSrc == 2) {
+        hal_cl_dma_cmd((uintptr_t)pSrcB, (uintptr_t)pBufB[0], firstLen * op->srcSize,
+                       HAL_CL_DMA_DIR_EXT2LOC, 0, &loadB);
+        hal_cl_dma_cmd_wait(&loadB);
+    }
+    hal_cl_dma_cmd_wait(&loadA);
+
+    for (t = 0; t < numTiles; t++) {
+        uint32_t cur = t & 1;
+        uint32_t offset = t * tileLen;
+        uint32_t len = blockSize - offset < tileLen ? blockSize - offset : tileLen;
+
+        /* prefetch the next tile into the other buffer */
+        if (t + 1 < numTiles) {
+            uint32_t nextOffset = offset + tileLen;
+            uint32_t nextLen =
+                blockSize - nextOffset < tileLen ? blockSize - nextOffset : tileLen;
+
+            hal_cl_dma_cmd((uintptr_t)((const uint8_t *)pSrcA + nextOffset * op->srcSize),
+                           (uintptr_t)pBufA[cur ^ 1], nextLen * op->srcSize,
+                           HAL_CL_DMA_DIR_EXT2LOC, 0, &loadA);
+            if (op->numSrc == 2) {
+                hal_cl_dma_cmd((uintptr_t)((const uint8_t *)pSrcB + nextOffset * op->srcSize),
+                               (uintptr_t)pBufB[cur ^ 1], nextLen * op->srcSize,
+                               HAL_CL_DMA_DIR_EXT2LOC, 0, &loadB);
+            }
+        }
+
+        /* the output buffer must have been written back before it is reused */
+        if (storePending[cur]) {
+            hal_cl_dma_cmd_wait(&store[cur]);
+            storePending[cur] = 0;
+        }
+
+        S.pSrcA = pBufA[cur];
+        S.pSrcB = pBufB[cur];
+        S.pDst = pBufDst[cur];
+        S.blockSize = len;
+
+        plp_cl_team_fork(nPE, plp_stream_kernel, (void *)&S);
+
+        S.first = 0;
+
+        if (op->dstSize != 0) {
+            hal_cl_dma_cmd((uintptr_t)((uint8_t *)pDst + offset * op->dstSize),
+                           (uintptr_t)pBufDst[cur], len * op->dstSize, HAL_CL_DMA_DIR_LOC2EXT, 0,
+                           &store[cur]);
+            storePending[cur] = 1;
+        }
+
+        if (t + 1 < numTiles) {
+            if (op->numSrc == 2) {
+                hal_cl_dma_cmd_wait(&loadB);
+            }
+            hal_cl_dma_cmd_wait(&loadA);
+        }
+    }
+
+    for (i = 0; i < 2; i++) {
+        if (storePending[i]) {
+            hal_cl_dma_cmd_wait(&store[i]);
+        }
+    }
+
+    /* combine the partial results of the cores which received data */
+    if (op->accSize != 0) {
+        uint32_t numPartials = (firstLen + S.chunkSize - 1) / S.chunkSize;
+
+        for (i = 0; i < op->accSize; i++) {
+            ((uint8_t *)pRes)[i] = S.pPartial[i];
+        }
+        for (i = 1; i < numPartials; i++) {
+            op->combine(pRes, S.pPartial + i * op->accSize);
+        }
+    }
+
+    plp_l1_scratch_free(pWs, wsSize);
+}
+
+/**
+  @} end of Stream group
+ */
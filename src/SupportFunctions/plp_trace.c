@@ -0,0 +1,279 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_trace.c
+ * Description:  Per-core timeline of the parallel kernels
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/* the tracing barrier calls the barrier of the HAL */
+#undef hal_team_barrier
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Trace Tracing
+  The parallel kernels split their work among the cores, and with small dimensions some cores
+  receive less work (or none at all) and wait at the barriers. When the library is built with
+  PLP_TRACE defined (`make PLP_TRACE=1`), each kernel forked by plp_cl_team_fork records on every
+  core when it starts, when it finishes and when it arrives at and leaves each barrier. The calling
+  core additionally records the fork and the join. The timestamps are read from the cluster timer,
+  which is shared by all cores.
+
+  <pre>
+      plp_trace_start();
+
+      plp_mat_mult_f32_parallel(pSrcA, pSrcB, M, N, O, 8, pDst);
+
+      plp_trace_stop();
+      plp_trace_dump();
+  </pre>
+
+  plp_trace_dump prints one CSV line for each event. The kernel column holds the name of the
+  forking function if the library is also built with PLP_PROFILE, and the address of the kernel
+  otherwise:
+
+  <pre>
+      fork,core,event,time,kernel
+      0,0,fork,12,plp_mat_mult_f32_parallel
+      0,0,start,95,
+      0,1,start,97,
+      0,1,end,610,
+      ...
+  </pre>
+
+  The test framework converts these lines into a Chrome trace (see test/README.md).
+
+  @par
+  Each core records at most PLP_TRACE_NB_EVENTS events in L1, further events are dropped and
+  counted. Without PLP_TRACE, plp_cl_team_fork and the barriers do not record anything.
+ */
+
+/**
+  @addtogroup Trace
+  @{
+ */
+
+static const char *plp_trace_names[] = { "fork", "join", "start", "end", "barrier_enter",
+                                         "barrier_leave" };
+
+HAL_CL_L1 static plp_trace_event plp_trace_events[PLP_TRACE_NB_PE][PLP_TRACE_NB_EVENTS];
+HAL_CL_L1 static uint32_t plp_trace_count[PLP_TRACE_NB_PE];
+HAL_CL_L1 static uint32_t plp_trace_dropped[PLP_TRACE_NB_PE];
+HAL_CL_L1 static uint32_t plp_trace_current[PLP_TRACE_NB_PE]; // fork executed by each core
+HAL_CL_L1 static uint32_t plp_trace_active = 0;
+HAL_CL_L1 static uint32_t plp_trace_nb_forks = 0;
+HAL_CL_L1 static uint32_t plp_trace_t0 = 0;
+
+static void (*plp_trace_kernels[PLP_TRACE_NB_FORKS])(void *);
+static const char *plp_trace_functions[PLP_TRACE_NB_FORKS];
+
+static inline void plp_trace_record(uint32_t core_id, uint32_t fork, uint32_t type) {
+    uint32_t n;
+
+    if (core_id >= PLP_TRACE_NB_PE) {
+        return;
+    }
+
+    n = plp_trace_count[core_id];
+    if (n >= PLP_TRACE_NB_EVENTS) {
+        plp_trace_dropped[core_id]++;
+        return;
+    }
+
+    plp_trace_events[core_id][n].fork = fork;
+    plp_trace_events[core_id][n].type = type;
+    plp_trace_events[core_id][n].time = hal_cl_timer_read() - plp_trace_t0;
+    plp_trace_count[core_id] = n + 1;
+}
+
+/**
+  @brief      Clear the recorded events and start recording the parallel kernels.
+  @return     none
+ */
+void plp_trace_start() {
+    uint32_t i;
+
+    for (i = 0; i < PLP_TRACE_NB_PE; i++) {
+        plp_trace_count[i] = 0;
+        plp_trace_dropped[i] = 0;
+        plp_trace_current[i] = PLP_TRACE_NO_FORK;
+    }
+
+    plp_trace_nb_forks = 0;
+    hal_cl_timer_start();
+    plp_trace_t0 = hal_cl_timer_read();
+    plp_trace_active = 1;
+}
+
+/**
+  @brief      Stop recording the parallel kernels.
+  @return     none
+ */
+void plp_trace_stop() {
+    plp_trace_active = 0;
+}
+
+/**
+  @brief      Print the recorded events in CSV format.
+  @return     none
+ */
+void plp_trace_dump() {
+    uint32_t core_id, i;
+
+    printf("fork,core,event,time,kernel\n");
+
+    for (core_id = 0; core_id < PLP_TRACE_NB_PE; core_id++) {
+        for (i = 0; i < plp_trace_count[core_id]; i++) {
+            const plp_trace_event *event = &plp_trace_events[core_id][i];
+
+            printf("%u,%u,%s,%u,", (unsigned)event->fork, (unsigned)core_id,
+                   plp_trace_names[event->type], (unsigned)event->time);
+
+            if (event->type == PLP_TRACE_FORK && event->fork < PLP_TRACE_NB_FORKS) {
+                if (plp_trace_functions[event->fork] != NULL) {
+                    printf("%s", plp_trace_functions[event->fork]);
+                } else {
+                    printf("%p", (void *)plp_trace_kernels[event->fork]);
+                }
+            }
+            printf("\n");
+        }
+    }
+
+    for (core_id = 0; core_id < PLP_TRACE_NB_PE; core_id++) {
+        if (plp_trace_dropped[core_id] != 0) {
+            printf("warning: %u events dropped on core %u, increase PLP_TRACE_NB_EVENTS\n",
+                   (unsigned)plp_trace_dropped[core_id], (unsigned)core_id);
+        }
+    }
+}
+
+/**
+  @brief      Read the events recorded by one core, e.g. to check them in a test.
+  @param[in]  core_id  core which recorded the events
+  @param[out] pEvents  receives the address of the events of the core
+  @return     number of events recorded by the core
+ */
+uint32_t plp_trace_read(uint32_t core_id, const plp_trace_event **pEvents) {
+    if (core_id >= PLP_TRACE_NB_PE) {
+        *pEvents = NULL;
+        return 0;
+    }
+
+    *pEvents = plp_trace_events[core_id];
+    return plp_trace_count[core_id];
+}
+
+/**
+  @brief      Record the fork of a parallel kernel (used by plp_cl_team_fork).
+  @param[in]  kernel  parallel kernel which is forked
+  @return     index of the fork, PLP_TRACE_NO_FORK if the tracing is stopped
+ */
+uint32_t plp_trace_fork(void (*kernel)(void *)) {
+    uint32_t fork;
+
+    if (!plp_trace_active || plp_trace_nb_forks >= PLP_TRACE_NO_FORK) {
+        return PLP_TRACE_NO_FORK;
+    }
+
+    fork = plp_trace_nb_forks++;
+
+    if (fork < PLP_TRACE_NB_FORKS) {
+        plp_trace_kernels[fork] = kernel;
+        plp_trace_functions[fork] = NULL;
+#ifdef PLP_PROFILE
+        plp_profile_entry *entry = plp_profile_current();
+        if (entry != NULL) {
+            plp_trace_functions[fork] = entry->name;
+        }
+#endif
+    }
+
+    plp_trace_record(hal_core_id(), fork, PLP_TRACE_FORK);
+    return fork;
+}
+
+/**
+  @brief      Record the end of a fork (used by plp_cl_team_fork).
+  @param[in]  fork  index returned by plp_trace_fork
+  @return     none
+ */
+void plp_trace_join(uint32_t fork) {
+    if (fork != PLP_TRACE_NO_FORK) {
+        plp_trace_record(hal_core_id(), fork, PLP_TRACE_JOIN);
+    }
+}
+
+/**
+  @brief      Wrap a parallel kernel such that each core records when it starts and finishes it
+              (used by plp_cl_team_fork).
+  @param[in]  args  points to a plp_trace_kernel_args structure
+  @return     none
+ */
+void plp_trace_kernel(void *args) {
+    plp_trace_kernel_args *T = (plp_trace_kernel_args *)args;
+    uint32_t core_id = hal_core_id();
+
+    if (T->fork == PLP_TRACE_NO_FORK || core_id >= PLP_TRACE_NB_PE) {
+        T->kernel(T->args);
+        return;
+    }
+
+    plp_trace_record(core_id, T->fork, PLP_TRACE_START);
+    plp_trace_current[core_id] = T->fork;
+
+    T->kernel(T->args);
+
+    plp_trace_current[core_id] = PLP_TRACE_NO_FORK;
+    plp_trace_record(core_id, T->fork, PLP_TRACE_END);
+}
+
+/**
+  @brief      Team barrier which records the arrival and the departure of the core.
+  @return     none
+
+  @par
+  Only the barriers inside the traced kernels are recorded.
+ */
+void plp_trace_barrier() {
+    uint32_t core_id = hal_core_id();
+    uint32_t fork = core_id < PLP_TRACE_NB_PE ? plp_trace_current[core_id] : PLP_TRACE_NO_FORK;
+
+    if (!plp_trace_active || fork == PLP_TRACE_NO_FORK) {
+        hal_team_barrier();
+        return;
+    }
+
+    plp_trace_record(core_id, fork, PLP_TRACE_BARRIER_ENTER);
+    hal_team_barrier();
+    plp_trace_record(core_id, fork, PLP_TRACE_BARRIER_LEAVE);
+}
+
+/**
+  @} end of Trace group
+ */
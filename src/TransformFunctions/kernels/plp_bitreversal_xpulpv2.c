@@ -54,13 +54,13 @@ void plp_bitreversal_16s_xpulpv2(uint16_t *pSrc,
                                  const uint16_t *pBitRevTab) {
     uint16_t a, b, i, tmp;
 
-    v2s c;
+    v2u c;
 
     for (i = 0; i < bitRevLen;i += 2) {
         // a = pBitRevTab[i    ] >> 2;
         // b = pBitRevTab[i + 1] >> 2;
 
-        c = __SRA2(*(v2s *)&pBitRevTab[i], ((v2s){ 2, 2 }));
+        c = *(v2u *)&pBitRevTab[i] >> ((v2u){ 2, 2 });
 
         // real
         // tmp = pSrc[a];
@@ -99,7 +99,7 @@ void plp_bitreversal_16p_xpulpv2(uint16_t *pSrc,
                                  uint32_t nPE) {
     uint16_t a, b, i, tmp;
 
-    v2s c;
+    v2u c;
     int core_id = hal_core_id();
     int step = bitRevLen/nPE;
     if(bitRevLen % nPE != 0) {
@@ -112,7 +112,7 @@ void plp_bitreversal_16p_xpulpv2(uint16_t *pSrc,
         // a = pBitRevTab[i    ] >> 2;
         // b = pBitRevTab[i + 1] >> 2;
 
-        c = __SRA2(*(v2s *)&pBitRevTab[i], ((v2s){ 2, 2 }));
+        c = *(v2u *)&pBitRevTab[i] >> ((v2u){ 2, 2 });
 
         // real
         // tmp = pSrc[a];
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft2d_f32p_xpulpv2.c
+ * Description:  Parallel floating-point 2D complex FFT for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Parallel floating-point 2D complex FFT for XPULPV2
+ *
+ * Every core transforms whole rows (core_id, core_id + nPE, ...) and then whole columns, each
+ * column going through the slice of <code>2*rows</code> values of pBuffer owned by the core. The
+ * only barrier is the one between the row and the column pass.
+ *
+ * @param[in]  args  points to the plp_cfft2d_instance_f32_parallel
+ */
+void plp_cfft2d_f32p_xpulpv2(void *args) {
+
+    plp_cfft2d_instance_f32_parallel *a = (plp_cfft2d_instance_f32_parallel *)args;
+    uint32_t C = a->SRow->fftLen;
+    uint32_t R = a->SCol->fftLen;
+    uint32_t nPE = a->nPE;
+    uint32_t core_id = hal_core_id();
+    float32_t *pBuffer = a->pBuffer + 2 * R * core_id;
+    float32_t scale = 1.0f / (float32_t)(R * C);
+    float32_t *pRow, *pCol;
+    uint32_t r, c;
+
+    for (r = core_id; r < R; r += nPE) {
+        pRow = a->pSrc + 2 * C * r;
+        if (a->ifftFlag) {
+            for (c = 0; c < C; c++) {
+                pRow[2 * c + 1] = -pRow[2 * c + 1];
+            }
+        }
+        plp_cfft_f32s_xpulpv2(a->SRow, pRow, 0, 1);
+    }
+    hal_team_barrier();
+
+    for (c = core_id; c < C; c += nPE) {
+        pCol = a->pSrc + 2 * c;
+        for (r = 0; r < R; r++) {
+            pBuffer[2 * r] = pCol[2 * C * r];
+            pBuffer[2 * r + 1] = pCol[2 * C * r + 1];
+        }
+
+        plp_cfft_f32s_xpulpv2(a->SCol, pBuffer, 0, 1);
+
+        if (a->ifftFlag) {
+            for (r = 0; r < R; r++) {
+                pCol[2 * C * r] = pBuffer[2 * r] * scale;
+                pCol[2 * C * r + 1] = -pBuffer[2 * r + 1] * scale;
+            }
+        } else {
+            for (r = 0; r < R; r++) {
+                pCol[2 * C * r] = pBuffer[2 * r];
+                pCol[2 * C * r + 1] = pBuffer[2 * r + 1];
+            }
+        }
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft2d_f32s_xpulpv2.c
+ * Description:  Floating-point 2D complex FFT for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Floating-point 2D complex FFT for XPULPV2
+ *
+ * The rows are transformed in-place. Each column is then copied to pBuffer, transformed and copied
+ * back, so that no transposition of the whole matrix is needed. The inverse transform conjugates
+ * the rows before and the columns after the forward transforms, and scales by 1/(rows*cols).
+ *
+ * @param[in]     SRow      points to the CFFT instance of the row length (number of columns)
+ * @param[in]     SCol      points to the CFFT instance of the column length (number of rows)
+ * @param[in,out] pSrc      points to the complex matrix, row major. Processing occurs in-place.
+ * @param[in]     ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]     pBuffer   points to a buffer of <code>2*rows</code> values
+ */
+void plp_cfft2d_f32s_xpulpv2(const plp_cfft_instance_f32 *SRow,
+                             const plp_cfft_instance_f32 *SCol,
+                             float32_t *pSrc,
+                             uint8_t ifftFlag,
+                             float32_t *pBuffer) {
+
+    uint32_t C = SRow->fftLen;
+    uint32_t R = SCol->fftLen;
+    float32_t scale = 1.0f / (float32_t)(R * C);
+    float32_t *pRow, *pCol;
+    uint32_t r, c;
+
+    for (r = 0; r < R; r++) {
+        pRow = pSrc + 2 * C * r;
+        if (ifftFlag) {
+            for (c = 0; c < C; c++) {
+                pRow[2 * c + 1] = -pRow[2 * c + 1];
+            }
+        }
+        plp_cfft_f32s_xpulpv2(SRow, pRow, 0, 1);
+    }
+
+    for (c = 0; c < C; c++) {
+        pCol = pSrc + 2 * c;
+        for (r = 0; r < R; r++) {
+            pBuffer[2 * r] = pCol[2 * C * r];
+            pBuffer[2 * r + 1] = pCol[2 * C * r + 1];
+        }
+
+        plp_cfft_f32s_xpulpv2(SCol, pBuffer, 0, 1);
+
+        if (ifftFlag) {
+            for (r = 0; r < R; r++) {
+                pCol[2 * C * r] = pBuffer[2 * r] * scale;
+                pCol[2 * C * r + 1] = -pBuffer[2 * r + 1] * scale;
+            }
+        } else {
+            for (r = 0; r < R; r++) {
+                pCol[2 * C * r] = pBuffer[2 * r];
+                pCol[2 * C * r + 1] = pBuffer[2 * r + 1];
+            }
+        }
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
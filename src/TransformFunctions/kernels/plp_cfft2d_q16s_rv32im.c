@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft2d_q16s_rv32im.c
+ * Description:  16-bit fixed-point 2D complex FFT for RV32IM
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+static inline int16_t plp_cfft2d_neg_q16(int16_t x) {
+    return x == -32768 ? 32767 : -x;
+}
+
+/**
+ * @brief      16-bit fixed-point 2D complex FFT for RV32IM
+ *
+ * The rows are transformed in-place. Each column is then copied to pBuffer, transformed and copied
+ * back, so that no transposition of the whole matrix is needed. Both passes scale as
+ * plp_cfft_q16, the output is the DFT scaled by 1/(rows*cols). The inverse transform conjugates
+ * the rows before and the columns after the forward transforms, which gives the inverse DFT
+ * including its 1/(rows*cols) factor.
+ *
+ * @param[in]     SRow      points to the CFFT instance of the row length (number of columns)
+ * @param[in]     SCol      points to the CFFT instance of the column length (number of rows)
+ * @param[in,out] pSrc      points to the complex matrix, row major. Processing occurs in-place.
+ * @param[in]     ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]     pBuffer   points to a buffer of <code>2*rows</code> values
+ */
+void plp_cfft2d_q16s_rv32im(const plp_cfft_instance_q16 *SRow,
+                            const plp_cfft_instance_q16 *SCol,
+                            int16_t *pSrc,
+                            uint8_t ifftFlag,
+                            int16_t *pBuffer) {
+
+    uint32_t C = SRow->fftLen;
+    uint32_t R = SCol->fftLen;
+    int16_t *pRow;
+    int32_t *pCol, *pBuf = (int32_t *)pBuffer;
+    uint32_t r, c;
+
+    for (r = 0; r < R; r++) {
+        pRow = pSrc + 2 * C * r;
+        if (ifftFlag) {
+            for (c = 0; c < C; c++) {
+                pRow[2 * c + 1] = plp_cfft2d_neg_q16(pRow[2 * c + 1]);
+            }
+        }
+        plp_cfft_q16s_rv32im(SRow, pRow, 0, 1, 15);
+    }
+
+    /* one complex sample is one word */
+    for (c = 0; c < C; c++) {
+        pCol = (int32_t *)pSrc + c;
+        for (r = 0; r < R; r++) {
+            pBuf[r] = pCol[C * r];
+        }
+
+        plp_cfft_q16s_rv32im(SCol, pBuffer, 0, 1, 15);
+
+        if (ifftFlag) {
+            for (r = 0; r < R; r++) {
+                pBuffer[2 * r + 1] = plp_cfft2d_neg_q16(pBuffer[2 * r + 1]);
+            }
+        }
+        for (r = 0; r < R; r++) {
+            pCol[C * r] = pBuf[r];
+        }
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
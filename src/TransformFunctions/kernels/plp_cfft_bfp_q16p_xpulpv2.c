@@ -0,0 +1,177 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_bfp_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit block floating point complex FFT for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/* headroom needed before a radix-2 stage: the sum and the twiddled difference of two samples
+ * grow by up to 2 sqrt(2), the sum and difference of the last stage (no twiddles) by up to 2 */
+#define BFP_GUARD 2
+#define BFP_GUARD_LAST 1
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief Publishes the one's complement magnitudes accumulated by this core and returns the
+ * headroom of the whole block. The slots alternate between two halves of pHeadroom, so that a
+ * core cannot overwrite a value which another one has still to read.
+ */
+static uint32_t plp_cfft_bfp_reduce_q16(uint32_t *pHeadroom, v2s acc, uint32_t *phase, uint32_t nPE) {
+    uint32_t *pSlots = pHeadroom + *phase * nPE;
+    int32_t m = 0;
+    uint32_t i;
+
+    pSlots[hal_core_id()] = (uint16_t)acc[0] | (uint16_t)acc[1];
+    hal_team_barrier();
+
+    for (i = 0; i < nPE; i++) {
+        m |= pSlots[i];
+    }
+    *phase ^= 1;
+
+    m <<= 16;
+    return m == 0 ? 15 : __CLB(m);
+}
+
+/**
+ * @brief      Parallel 16-bit block floating point complex FFT for XPULPV2
+ *
+ * Each radix-2 stage is split into contiguous ranges of butterflies, one per core. The headroom
+ * of the stage output is combined across the cores before the next stage, which shifts the data
+ * down only when needed. The block exponent is written to the instance by core 0.
+ *
+ * @param[in]  args  points to the plp_cfft_bfp_instance_q16_parallel
+ */
+void plp_cfft_bfp_q16p_xpulpv2(void *args) {
+
+    plp_cfft_bfp_instance_q16_parallel *a = (plp_cfft_bfp_instance_q16_parallel *)args;
+    const plp_cfft_instance_q16 *S = a->S;
+    uint32_t nPE = a->nPE;
+    uint32_t L = S->fftLen;
+    const int16_t *pCoef = S->pTwiddle;
+    v2s *pData = (v2s *)a->p1;
+
+    uint32_t core_id = hal_core_id();
+    uint32_t step = (L / 2 + nPE - 1) / nPE;
+    uint32_t first = core_id * step;
+    uint32_t last = MIN(L / 2, first + step);
+    uint32_t phase = 0;
+    uint32_t half, twStep, b, i, i0, k, base, h, shift;
+    int32_t exponent = 0;
+    v2s A, B, T, U, D, CoSi, SiCo, acc, sh;
+
+    /* each core owns the samples 2 first .. 2 last - 1 for the scan and the scaling */
+    acc = (v2s){ 0, 0 };
+    for (i = 2 * first; i < 2 * last; i++) {
+        A = pData[i];
+        acc |= A ^ __SRA2(A, ((v2s){ 15, 15 }));
+    }
+    h = plp_cfft_bfp_reduce_q16(a->pHeadroom, acc, &phase, nPE);
+
+    /* quiet input: use the full range */
+    if (h > BFP_GUARD) {
+        shift = h - BFP_GUARD;
+        sh = __PACK2(shift, shift);
+        for (i = 2 * first; i < 2 * last; i++) {
+            pData[i] = __SLL2(pData[i], sh);
+        }
+        exponent -= shift;
+        h = BFP_GUARD;
+        hal_team_barrier();
+    }
+
+    for (half = L >> 1, twStep = 1; half > 1; half >>= 1, twStep <<= 1) {
+        shift = h < BFP_GUARD ? BFP_GUARD - h : 0;
+        exponent += shift;
+        sh = __PACK2(shift, shift);
+        acc = (v2s){ 0, 0 };
+
+        /* butterfly b is the k-th one of the group starting at base */
+        k = first % half;
+        base = (first / half) * 2 * half;
+        for (b = first; b < last; b++) {
+            CoSi = *(v2s *)&pCoef[2 * k * twStep];
+            SiCo = __PACK2(-CoSi[1], CoSi[0]);
+            i0 = base + k;
+
+            A = __SRA2(pData[i0], sh);
+            B = __SRA2(pData[i0 + half], sh);
+
+            T = __ADD2(A, B);
+            D = __SUB2(A, B);
+
+            /* (dr + j di) (c - j s) */
+            U = __PACK2((int16_t)(__DOTP2(D, CoSi) >> 15), (int16_t)(__DOTP2(D, SiCo) >> 15));
+
+            pData[i0] = T;
+            pData[i0 + half] = U;
+
+            acc |= (T ^ __SRA2(T, ((v2s){ 15, 15 }))) | (U ^ __SRA2(U, ((v2s){ 15, 15 })));
+
+            if (++k == half) {
+                k = 0;
+                base += 2 * half;
+            }
+        }
+
+        h = plp_cfft_bfp_reduce_q16(a->pHeadroom, acc, &phase, nPE);
+    }
+
+    /* last stage, the twiddle factors are 1 */
+    shift = h < BFP_GUARD_LAST ? BFP_GUARD_LAST - h : 0;
+    exponent += shift;
+    sh = __PACK2(shift, shift);
+
+    for (b = first; b < last; b++) {
+        A = __SRA2(pData[2 * b], sh);
+        B = __SRA2(pData[2 * b + 1], sh);
+
+        pData[2 * b] = __ADD2(A, B);
+        pData[2 * b + 1] = __SUB2(A, B);
+    }
+    hal_team_barrier();
+
+    if (a->bitReverseFlag)
+        plp_bitreversal_16p_xpulpv2((uint16_t *)a->p1, S->bitRevLength,
+                                    (const uint16_t *)S->pBitRevTable, nPE);
+
+    if (core_id == 0)
+        a->exponent = exponent;
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_bfp_q16s_rv32im.c
+ * Description:  16-bit block floating point complex FFT for RV32IM
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/* headroom needed before a radix-2 stage: the sum and the twiddled difference of two samples
+ * grow by up to 2 sqrt(2), the sum and difference of the last stage (no twiddles) by up to 2 */
+#define BFP_GUARD 2
+#define BFP_GUARD_LAST 1
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief Number of redundant sign bits of the 16-bit samples, from the OR of their one's
+ * complement magnitudes (x ^ (x >> 15)).
+ */
+static uint32_t plp_cfft_bfp_headroom_q16(int32_t m) {
+    uint32_t h = 0;
+
+    while (h < 15 && (m & (0x4000 >> h)) == 0) {
+        h++;
+    }
+    return h;
+}
+
+/**
+ * @brief      16-bit block floating point complex FFT for RV32IM
+ *
+ * Radix-2 decimation-in-frequency FFT which shifts the data down only when the headroom measured
+ * on the output of the previous stage is not sufficient for the next one. Quiet inputs are first
+ * scaled up to the full range.
+ *
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @return        block exponent e, the DFT of the input is p1 * 2^e
+ */
+int32_t plp_cfft_bfp_q16s_rv32im(const plp_cfft_instance_q16 *S,
+                                 int16_t *p1,
+                                 uint8_t bitReverseFlag) {
+
+    uint32_t L = S->fftLen;
+    const int16_t *pCoef = S->pTwiddle;
+    uint32_t half, twStep, i, i0, i1, k, h, shift;
+    int32_t m, exponent = 0;
+    int32_t ar, ai, br, bi, sr, si, dr, di, tr, ti, c, s;
+
+    m = 0;
+    for (i = 0; i < 2 * L; i++) {
+        m |= p1[i] ^ (p1[i] >> 15);
+    }
+    h = plp_cfft_bfp_headroom_q16(m);
+
+    /* quiet input: use the full range */
+    if (h > BFP_GUARD) {
+        shift = h - BFP_GUARD;
+        for (i = 0; i < 2 * L; i++) {
+            p1[i] = (int16_t)(p1[i] << shift);
+        }
+        exponent -= shift;
+        h = BFP_GUARD;
+    }
+
+    for (half = L >> 1, twStep = 1; half > 1; half >>= 1, twStep <<= 1) {
+        shift = h < BFP_GUARD ? BFP_GUARD - h : 0;
+        exponent += shift;
+        m = 0;
+
+        for (k = 0; k < half; k++) {
+            c = pCoef[2 * k * twStep];
+            s = pCoef[2 * k * twStep + 1];
+
+            for (i0 = k; i0 < L; i0 += 2 * half) {
+                i1 = i0 + half;
+
+                ar = p1[2 * i0] >> shift;
+                ai = p1[2 * i0 + 1] >> shift;
+                br = p1[2 * i1] >> shift;
+                bi = p1[2 * i1 + 1] >> shift;
+
+                sr = ar + br;
+                si = ai + bi;
+                dr = ar - br;
+                di = ai - bi;
+
+                /* (dr + j di) (c - j s) */
+                tr = (dr * c + di * s) >> 15;
+                ti = (di * c - dr * s) >> 15;
+
+                p1[2 * i0] = sr;
+                p1[2 * i0 + 1] = si;
+                p1[2 * i1] = tr;
+                p1[2 * i1 + 1] = ti;
+
+                m |= (sr ^ (sr >> 31)) | (si ^ (si >> 31)) | (tr ^ (tr >> 31)) | (ti ^ (ti >> 31));
+            }
+        }
+
+        h = plp_cfft_bfp_headroom_q16(m);
+    }
+
+    /* last stage, the twiddle factors are 1 */
+    shift = h < BFP_GUARD_LAST ? BFP_GUARD_LAST - h : 0;
+    exponent += shift;
+
+    for (i0 = 0; i0 + 1 < L; i0 += 2) {
+        ar = p1[2 * i0] >> shift;
+        ai = p1[2 * i0 + 1] >> shift;
+        br = p1[2 * i0 + 2] >> shift;
+        bi = p1[2 * i0 + 3] >> shift;
+
+        p1[2 * i0] = ar + br;
+        p1[2 * i0 + 1] = ai + bi;
+        p1[2 * i0 + 2] = ar - br;
+        p1[2 * i0 + 3] = ai - bi;
+    }
+
+    if (bitReverseFlag)
+        plp_bitreversal_16s_rv32im((uint16_t *)p1, S->bitRevLength,
+                                   (const uint16_t *)S->pBitRevTable);
+
+    return exponent;
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_bfp_q16s_xpulpv2.c
+ * Description:  16-bit block floating point complex FFT for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/* headroom needed before a radix-2 stage: the sum and the twiddled difference of two samples
+ * grow by up to 2 sqrt(2), the sum and difference of the last stage (no twiddles) by up to 2 */
+#define BFP_GUARD 2
+#define BFP_GUARD_LAST 1
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief Number of redundant sign bits of the 16-bit samples, from the OR of their one's
+ * complement magnitudes (x ^ (x >> 15)) accumulated in both halves of acc.
+ */
+static inline uint32_t plp_cfft_bfp_headroom_q16(v2s acc) {
+    int32_t m = ((uint16_t)acc[0] | (uint16_t)acc[1]) << 16;
+
+    return m == 0 ? 15 : __CLB(m);
+}
+
+/**
+ * @brief      16-bit block floating point complex FFT for XPULPV2
+ *
+ * Radix-2 decimation-in-frequency FFT which shifts the data down only when the headroom measured
+ * on the output of the previous stage is not sufficient for the next one. Quiet inputs are first
+ * scaled up to the full range.
+ *
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @return        block exponent e, the DFT of the input is p1 * 2^e
+ */
+int32_t plp_cfft_bfp_q16s_xpulpv2(const plp_cfft_instance_q16 *S,
+                                  int16_t *p1,
+                                  uint8_t bitReverseFlag) {
+
+    uint32_t L = S->fftLen;
+    const int16_t *pCoef = S->pTwiddle;
+    v2s *pData = (v2s *)p1;
+    uint32_t half, twStep, i, i0, i1, k, h, shift;
+    int32_t exponent = 0;
+    v2s A, B, T, U, D, CoSi, SiCo, acc, sh;
+
+    acc = (v2s){ 0, 0 };
+    for (i = 0; i < L; i++) {
+        A = pData[i];
+        acc |= A ^ __SRA2(A, ((v2s){ 15, 15 }));
+    }
+    h = plp_cfft_bfp_headroom_q16(acc);
+
+    /* quiet input: use the full range */
+    if (h > BFP_GUARD) {
+        shift = h - BFP_GUARD;
+        sh = __PACK2(shift, shift);
+        for (i = 0; i < L; i++) {
+            pData[i] = __SLL2(pData[i], sh);
+        }
+        exponent -= shift;
+        h = BFP_GUARD;
+    }
+
+    for (half = L >> 1, twStep = 1; half > 1; half >>= 1, twStep <<= 1) {
+        shift = h < BFP_GUARD ? BFP_GUARD - h : 0;
+        exponent += shift;
+        sh = __PACK2(shift, shift);
+        acc = (v2s){ 0, 0 };
+
+        for (k = 0; k < half; k++) {
+            CoSi = *(v2s *)&pCoef[2 * k * twStep];
+            SiCo = __PACK2(-CoSi[1], CoSi[0]);
+
+            for (i0 = k; i0 < L; i0 += 2 * half) {
+                i1 = i0 + half;
+
+                A = __SRA2(pData[i0], sh);
+                B = __SRA2(pData[i1], sh);
+
+                T = __ADD2(A, B);
+                D = __SUB2(A, B);
+
+                /* (dr + j di) (c - j s) */
+                U = __PACK2((int16_t)(__DOTP2(D, CoSi) >> 15), (int16_t)(__DOTP2(D, SiCo) >> 15));
+
+                pData[i0] = T;
+                pData[i1] = U;
+
+                acc |= (T ^ __SRA2(T, ((v2s){ 15, 15 }))) | (U ^ __SRA2(U, ((v2s){ 15, 15 })));
+            }
+        }
+
+        h = plp_cfft_bfp_headroom_q16(acc);
+    }
+
+    /* last stage, the twiddle factors are 1 */
+    shift = h < BFP_GUARD_LAST ? BFP_GUARD_LAST - h : 0;
+    exponent += shift;
+    sh = __PACK2(shift, shift);
+
+    for (i0 = 0; i0 + 1 < L; i0 += 2) {
+        A = __SRA2(pData[i0], sh);
+        B = __SRA2(pData[i0 + 1], sh);
+
+        pData[i0] = __ADD2(A, B);
+        pData[i0 + 1] = __SUB2(A, B);
+    }
+
+    if (bitReverseFlag)
+        plp_bitreversal_16s_xpulpv2((uint16_t *)p1, S->bitRevLength,
+                                    (const uint16_t *)S->pBitRevTable);
+
+    return exponent;
+}
+
+/**
+ * @} end of FFT group
+ */
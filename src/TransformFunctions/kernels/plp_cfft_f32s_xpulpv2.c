@@ -31,12 +31,17 @@
 #include "plp_math.h"
 
 static HAL_CL_L1 float32_t ROT_CONST = 0.707106781f;
+static HAL_CL_L1 float32_t SIN_2PI_3 = 0.866025404f;  // radix-3
+static HAL_CL_L1 float32_t COS_2PI_5 = 0.309016994f;  // radix-5
+static HAL_CL_L1 float32_t COS_4PI_5 = -0.809016994f;
+static HAL_CL_L1 float32_t SIN_2PI_5 = 0.951056516f;
+static HAL_CL_L1 float32_t SIN_4PI_5 = 0.587785252f;
 
 /* HELPER FUNCTIONS */
 
-int bit_rev_radix2(int index, int log2FFTLen);
-int bit_rev_radix4(int index, int log2FFTLen);
-int bit_rev_radix8(int index, int log2FFTLen);
+static int bit_rev_radix2(int index, int log2FFTLen);
+static int bit_rev_radix4(int index, int log2FFTLen);
+static int bit_rev_radix8(int index, int log2FFTLen);
 
 static inline Complex_type_f32 complex_mul(Complex_type_f32 A, Complex_type_f32 B);
 
@@ -67,6 +72,31 @@ static inline void process_butterfly_radix8(Complex_type_f32 *input,
 
 static inline void process_butterfly_last_radix8(Complex_type_f32 *input, Complex_type_f32 *output, int outindex);
 
+static inline void process_butterfly_radix3(Complex_type_f32 *input,
+                                            Complex_type_f32 *output,
+                                            int twiddle_index,
+                                            int index,
+                                            int distance,
+                                            Complex_type_f32 *twiddle_ptr);
+
+static inline void process_butterfly_radix5(Complex_type_f32 *input,
+                                            Complex_type_f32 *output,
+                                            int twiddle_index,
+                                            int index,
+                                            int distance,
+                                            Complex_type_f32 *twiddle_ptr);
+
+static void process_stage_mixed(Complex_type_f32 *data,
+                                Complex_type_f32 *twiddle_ptr,
+                                int fftLen,
+                                int radix,
+                                int dist,
+                                int butt,
+                                int first,
+                                int step);
+
+static void process_swaps_mixed(Complex_type_f32 *data, const uint16_t *pTable, int fftLen);
+
 static void plp_cfft_radix2_f32s_xpulpv2(   const plp_cfft_instance_f32 *S,
                                             const float32_t *pSrc,
                                             uint8_t ifftFlag,
@@ -82,6 +112,11 @@ static void plp_cfft_radix8_f32s_xpulpv2(   const plp_cfft_instance_f32 *S,
                                             uint8_t ifftFlag,
                                             uint8_t bitReverseFlag);
 
+static void plp_cfft_mixed_f32s_xpulpv2(    const plp_cfft_instance_f32 *S,
+                                            const float32_t *pSrc,
+                                            uint8_t ifftFlag,
+                                            uint8_t bitReverseFlag);
+
 /**
   @ingroup fft
  */
@@ -94,7 +129,7 @@ static void plp_cfft_radix8_f32s_xpulpv2(   const plp_cfft_instance_f32 *S,
   FFTLen complex values in the form (real part, complex part).
   Input and output can refer to the same memory location (in-place computation).
   The best algorithm is executed based on the val FFTLen.
-  Supported algorithms: radix-2, radix-4, radix-8
+  Supported algorithms: radix-2, radix-4, radix-8, and mixed radix-2/3/4/5 for other lengths
 */
 
 /**
@@ -117,18 +152,25 @@ void plp_cfft_f32s_xpulpv2( const plp_cfft_instance_f32 *S,
     switch(S->fftLen) {
       case 64:
       case 512:
+      case 4096:
+      case 32768:
           plp_cfft_radix8_f32s_xpulpv2(S, pSrc, ifftFlag, bitReverseFlag);
           break;
       case 16:
       case 256:
       case 1024:
+      case 16384:
           plp_cfft_radix4_f32s_xpulpv2(S, pSrc, ifftFlag, bitReverseFlag);
           break;
       case 32:
       case 128:
       case 2048:
+      case 8192:
           plp_cfft_radix2_f32s_xpulpv2(S, pSrc, ifftFlag, bitReverseFlag);
           break;
+      default:
+          plp_cfft_mixed_f32s_xpulpv2(S, pSrc, ifftFlag, bitReverseFlag);
+          break;
     }
 }
 
@@ -428,11 +470,39 @@ static void plp_cfft_radix8_f32s_xpulpv2(   const plp_cfft_instance_f32 *S,
     }
 }
 
+static void plp_cfft_mixed_f32s_xpulpv2(    const plp_cfft_instance_f32 *S,
+                                            const float32_t *pSrc,
+                                            uint8_t ifftFlag,
+                                            uint8_t bitReverseFlag) {
+
+    int span = S->fftLen; // samples combined by the butterflies of a stage
+    int butt = 1;         // stride of the twiddle factors
+    int radix;
+
+    Complex_type_f32 *_in_ptr = (Complex_type_f32 *)pSrc;
+    Complex_type_f32 *_tw_ptr = (Complex_type_f32 *)S->pTwiddle;
+
+    while (span > 1) {
+        radix = plp_cfft_mixed_radix(span);
+        if (radix == 0) {
+            return;
+        }
+        process_stage_mixed(_in_ptr, _tw_ptr, S->fftLen, radix, span / radix, butt, 0, 1);
+        span = span / radix;
+        butt = butt * radix;
+    }
+
+    // ORDER VALUES
+    if (bitReverseFlag && S->pBitRevTable) {
+        process_swaps_mixed(_in_ptr, S->pBitRevTable, S->fftLen);
+    }
+}
+
 /**
    @} end of complexFFTKernels group
 */
 
-int bit_rev_radix2(int index, int log2FFTLen) {
+static int bit_rev_radix2(int index, int log2FFTLen) {
     int i;
     unsigned int revNum = 0;
 
@@ -445,7 +515,7 @@ int bit_rev_radix2(int index, int log2FFTLen) {
     return revNum;
 }
 
-int bit_rev_radix4(int index, int log2FFTLen) //digit reverse 2 bit blocks
+static int bit_rev_radix4(int index, int log2FFTLen) //digit reverse 2 bit blocks
 {
   int i;
   unsigned int revNum = 0;
@@ -459,7 +529,7 @@ int bit_rev_radix4(int index, int log2FFTLen) //digit reverse 2 bit blocks
   return revNum;
 }
 
-int bit_rev_radix8(int index, int log2FFTLen) //digit reverse 3 bit blocks
+static int bit_rev_radix8(int index, int log2FFTLen) //digit reverse 3 bit blocks
 {
   int i;
   unsigned int revNum = 0;
@@ -860,3 +930,137 @@ r7   1.0000 + 0.0000i   0.7071 + 0.7071i  -0.0000 + 1.0000i  -0.7071 + 0.7071i
    output[outindex+6*1] = r6;
    output[outindex+7*1] = r7;
 }
+
+static inline void process_butterfly_radix3(Complex_type_f32 *input,
+                                            Complex_type_f32 *output,
+                                            int twiddle_index,
+                                            int index,
+                                            int distance,
+                                            Complex_type_f32 *twiddle_ptr) {
+
+    Complex_type_f32 r0, r1, r2;
+    Complex_type_f32 a0 = input[index];
+    Complex_type_f32 a1 = input[index + distance];
+    Complex_type_f32 a2 = input[index + 2 * distance];
+
+    // r1 = a0 + a1*exp(-2pi/3 j) + a2*exp(-4pi/3 j) = a0 - (a1 + a2)/2 - j*sin(2pi/3)*(a1 - a2)
+    float32_t s_re = a1.re + a2.re;
+    float32_t s_im = a1.im + a2.im;
+    float32_t m_re = a0.re - 0.5f * s_re;
+    float32_t m_im = a0.im - 0.5f * s_im;
+    float32_t u_re = SIN_2PI_3 * (a1.re - a2.re);
+    float32_t u_im = SIN_2PI_3 * (a1.im - a2.im);
+
+    r0.re = a0.re + s_re;
+    r0.im = a0.im + s_im;
+    r1.re = m_re + u_im;
+    r1.im = m_im - u_re;
+    r2.re = m_re - u_im;
+    r2.im = m_im + u_re;
+
+    output[index] = r0;
+    output[index + distance] = complex_mul(twiddle_ptr[twiddle_index], r1);
+    output[index + 2 * distance] = complex_mul(twiddle_ptr[twiddle_index * 2], r2);
+}
+
+static inline void process_butterfly_radix5(Complex_type_f32 *input,
+                                            Complex_type_f32 *output,
+                                            int twiddle_index,
+                                            int index,
+                                            int distance,
+                                            Complex_type_f32 *twiddle_ptr) {
+
+    Complex_type_f32 r0, r1, r2, r3, r4;
+    Complex_type_f32 a0 = input[index];
+    Complex_type_f32 a1 = input[index + distance];
+    Complex_type_f32 a2 = input[index + 2 * distance];
+    Complex_type_f32 a3 = input[index + 3 * distance];
+    Complex_type_f32 a4 = input[index + 4 * distance];
+
+    // symmetric and antisymmetric parts of the pairs (a1, a4) and (a2, a3)
+    float32_t b1_re = a1.re + a4.re, b1_im = a1.im + a4.im;
+    float32_t b2_re = a2.re + a3.re, b2_im = a2.im + a3.im;
+    float32_t d1_re = a1.re - a4.re, d1_im = a1.im - a4.im;
+    float32_t d2_re = a2.re - a3.re, d2_im = a2.im - a3.im;
+
+    // r1/r4 = m1 -/+ j*n1, r2/r3 = m2 -/+ j*n2
+    float32_t m1_re = a0.re + COS_2PI_5 * b1_re + COS_4PI_5 * b2_re;
+    float32_t m1_im = a0.im + COS_2PI_5 * b1_im + COS_4PI_5 * b2_im;
+    float32_t m2_re = a0.re + COS_4PI_5 * b1_re + COS_2PI_5 * b2_re;
+    float32_t m2_im = a0.im + COS_4PI_5 * b1_im + COS_2PI_5 * b2_im;
+    float32_t n1_re = SIN_2PI_5 * d1_re + SIN_4PI_5 * d2_re;
+    float32_t n1_im = SIN_2PI_5 * d1_im + SIN_4PI_5 * d2_im;
+    float32_t n2_re = SIN_4PI_5 * d1_re - SIN_2PI_5 * d2_re;
+    float32_t n2_im = SIN_4PI_5 * d1_im - SIN_2PI_5 * d2_im;
+
+    r0.re = a0.re + b1_re + b2_re;
+    r0.im = a0.im + b1_im + b2_im;
+    r1.re = m1_re + n1_im;
+    r1.im = m1_im - n1_re;
+    r4.re = m1_re - n1_im;
+    r4.im = m1_im + n1_re;
+    r2.re = m2_re + n2_im;
+    r2.im = m2_im - n2_re;
+    r3.re = m2_re - n2_im;
+    r3.im = m2_im + n2_re;
+
+    output[index] = r0;
+    output[index + distance] = complex_mul(twiddle_ptr[twiddle_index], r1);
+    output[index + 2 * distance] = complex_mul(twiddle_ptr[twiddle_index * 2], r2);
+    output[index + 3 * distance] = complex_mul(twiddle_ptr[twiddle_index * 3], r3);
+    output[index + 4 * distance] = complex_mul(twiddle_ptr[twiddle_index * 4], r4);
+}
+
+/* One decimation-in-frequency stage of a mixed-radix FFT: the butterflies first, first + step, ...
+ * out of the fftLen / radix ones of the stage, each combining radix samples at distance dist
+ * (radix * dist = span of the stage) and applying the twiddle factors of stride butt. */
+static void process_stage_mixed(Complex_type_f32 *data,
+                                Complex_type_f32 *twiddle_ptr,
+                                int fftLen,
+                                int radix,
+                                int dist,
+                                int butt,
+                                int first,
+                                int step) {
+    int span = radix * dist;
+    int j = first / dist;   // group of butterflies
+    int d = first % dist;   // butterfly in the group
+    int b;
+
+    for (b = first; b < fftLen / radix; b += step) {
+        switch (radix) {
+        case 2:
+            process_butterfly_radix2(data, data, d * butt, j * span + d, dist, twiddle_ptr);
+            break;
+        case 3:
+            process_butterfly_radix3(data, data, d * butt, j * span + d, dist, twiddle_ptr);
+            break;
+        case 4:
+            process_butterfly_radix4(data, data, d * butt, j * span + d, dist, twiddle_ptr);
+            break;
+        case 5:
+            process_butterfly_radix5(data, data, d * butt, j * span + d, dist, twiddle_ptr);
+            break;
+        }
+        d += step;
+        while (d >= dist) {
+            d -= dist;
+            j++;
+        }
+    }
+}
+
+/* Reorders the output of a mixed-radix FFT with the swaps generated by plp_cfft_plan_create_f32 */
+static void process_swaps_mixed(Complex_type_f32 *data, const uint16_t *pTable, int fftLen) {
+    Complex_type_f32 temp;
+    int i, j;
+
+    for (i = 0; i < fftLen; i++) {
+        j = pTable[i];
+        if (j != i) {
+            temp = data[i];
+            data[i] = data[j];
+            data[j] = temp;
+        }
+    }
+}
@@ -30,6 +30,15 @@
 
 #include "plp_math.h"
 
+/* q15 constants of the radix-3 and radix-5 butterflies of the mixed-radix FFT */
+#define MIXED_THIRD_Q15 10922      // 1/3, rounded down so that 3 scaled samples cannot overflow
+#define MIXED_FIFTH_Q15 6553       // 1/5
+#define MIXED_SIN_2PI_3_Q15 28378
+#define MIXED_COS_2PI_5_Q15 10126
+#define MIXED_COS_4PI_5_Q15 -26510
+#define MIXED_SIN_2PI_5_Q15 31164
+#define MIXED_SIN_4PI_5_Q15 19261
+
 /**
  * @ingroup groupTransforms
  */
@@ -46,6 +55,19 @@ static void plp_radix4_butterfly_q16(int16_t *pSrc16,
                                      int16_t *pCoef16,
                                      uint32_t twidCoefModifier);
 
+static void plp_cfft_mixed_stage_q16(int16_t *pSrc,
+                                     const int16_t *pCoef,
+                                     uint32_t fftLen,
+                                     uint32_t radix,
+                                     uint32_t dist,
+                                     uint32_t butt,
+                                     uint32_t first,
+                                     uint32_t step);
+
+static void plp_cfft_mixed_swaps_q16(int16_t *pSrc, const uint16_t *pTable, uint32_t fftLen);
+
+static void plp_cfft_mixed_double_q16(int16_t *pSrc, uint32_t fftLen, uint32_t first, uint32_t step);
+
 void plp_cfft_q16s_rv32im(const plp_cfft_instance_q16 *S,
                           int16_t *p1,
                           uint8_t ifftFlag,
@@ -54,6 +76,26 @@ void plp_cfft_q16s_rv32im(const plp_cfft_instance_q16 *S,
 
     uint32_t L = S->fftLen;
 
+    if ((L & (L - 1)) != 0) {
+        /* mixed radix, see plp_cfft_plan_create_q16 */
+        uint32_t span = L, butt = 1, radix;
+
+        if (ifftFlag == 0) {
+            for (; span > 1; span /= radix, butt *= radix) {
+                radix = plp_cfft_mixed_radix(span);
+                if (radix == 0) {
+                    return;
+                }
+                plp_cfft_mixed_stage_q16(p1, S->pTwiddle, L, radix, span / radix, butt, 0, 1);
+            }
+            plp_cfft_mixed_double_q16(p1, L, 0, 1);
+        }
+
+        if (bitReverseFlag)
+            plp_cfft_mixed_swaps_q16(p1, (const uint16_t *)S->pBitRevTable, L);
+        return;
+    }
+
     if (ifftFlag == 0) {
         switch (L) {
         case 16:
@@ -67,6 +109,7 @@ void plp_cfft_q16s_rv32im(const plp_cfft_instance_q16 *S,
         case 128:
         case 512:
         case 2048:
+        case 8192:
             plp_cfft_radix4by2_q16(p1, L, (int16_t *)S->pTwiddle);
             break;
         }
@@ -566,6 +609,175 @@ void plp_radix4_butterfly_q16(int16_t *pSrc16,
     /* output is in 5.11(q11) format for the 16 point  */
 }
 
+/**
+ * @brief Mixed-radix decimation-in-frequency butterfly (radix 2, 3, 4 or 5). The inputs are
+ * divided by the radix, so that the FFT output is scaled by 1/fftLen as for the powers of two, and
+ * the results are saturated. The outputs of the radix-3 and radix-5 butterflies and the rotated
+ * outputs can grow beyond the inputs, so that the first stage, which sees full-scale inputs, divides
+ * them by another 2 and plp_cfft_mixed_double_q16 makes up for it (as in plp_cfft_radix4by2_q16).
+ * @param[in,out] pSrc     points to the complex data buffer
+ * @param[in]     pCoef    points to the fftLen twiddle factors (cos, sin)
+ * @param[in]     radix    radix of the butterfly
+ * @param[in]     index    index of the first sample
+ * @param[in]     dist     distance between the samples
+ * @param[in]     twIndex  index of the twiddle factor of the second output
+ * @param[in]     shift    additional right shift of the inputs
+ */
+static inline void plp_cfft_mixed_butterfly_q16(int16_t *pSrc,
+                                                const int16_t *pCoef,
+                                                uint32_t radix,
+                                                uint32_t index,
+                                                uint32_t dist,
+                                                uint32_t twIndex,
+                                                uint32_t shift) {
+    int32_t xr[5], xi[5], yr[5], yi[5];
+    int32_t sr, si, mr, mi, ur, ui;
+    int32_t m1r, m1i, m2r, m2i, n1r, n1i, n2r, n2i;
+    int32_t cosVal, sinVal;
+    uint32_t m, k;
+
+    for (m = 0; m < radix; m++) {
+        xr[m] = pSrc[2 * (index + m * dist)];
+        xi[m] = pSrc[2 * (index + m * dist) + 1];
+        if (radix == 3) {
+            xr[m] = (xr[m] * MIXED_THIRD_Q15) >> (15 + shift);
+            xi[m] = (xi[m] * MIXED_THIRD_Q15) >> (15 + shift);
+        } else if (radix == 5) {
+            xr[m] = (xr[m] * MIXED_FIFTH_Q15) >> (15 + shift);
+            xi[m] = (xi[m] * MIXED_FIFTH_Q15) >> (15 + shift);
+        } else {
+            xr[m] = xr[m] >> ((radix >> 1) + shift);
+            xi[m] = xi[m] >> ((radix >> 1) + shift);
+        }
+    }
+
+    switch (radix) {
+    case 2:
+        yr[0] = xr[0] + xr[1];
+        yi[0] = xi[0] + xi[1];
+        yr[1] = xr[0] - xr[1];
+        yi[1] = xi[0] - xi[1];
+        break;
+    case 3:
+        /* y1, y2 = x0 - (x1 + x2) / 2 -/+ j sin(2pi/3) (x1 - x2) */
+        sr = xr[1] + xr[2];
+        si = xi[1] + xi[2];
+        mr = xr[0] - (sr >> 1);
+        mi = xi[0] - (si >> 1);
+        ur = ((xr[1] - xr[2]) * MIXED_SIN_2PI_3_Q15) >> 15;
+        ui = ((xi[1] - xi[2]) * MIXED_SIN_2PI_3_Q15) >> 15;
+        yr[0] = xr[0] + sr;
+        yi[0] = xi[0] + si;
+        yr[1] = mr + ui;
+        yi[1] = mi - ur;
+        yr[2] = mr - ui;
+        yi[2] = mi + ur;
+        break;
+    case 4:
+        yr[0] = xr[0] + xr[1] + xr[2] + xr[3];
+        yi[0] = xi[0] + xi[1] + xi[2] + xi[3];
+        yr[1] = (xr[0] - xr[2]) + (xi[1] - xi[3]);
+        yi[1] = (xi[0] - xi[2]) - (xr[1] - xr[3]);
+        yr[2] = xr[0] - xr[1] + xr[2] - xr[3];
+        yi[2] = xi[0] - xi[1] + xi[2] - xi[3];
+        yr[3] = (xr[0] - xr[2]) - (xi[1] - xi[3]);
+        yi[3] = (xi[0] - xi[2]) + (xr[1] - xr[3]);
+        break;
+    case 5:
+        /* y1, y4 = m1 -/+ j n1 and y2, y3 = m2 -/+ j n2, from the sums and differences of the
+         * pairs (x1, x4) and (x2, x3) */
+        m1r = xr[0] + (((xr[1] + xr[4]) * MIXED_COS_2PI_5_Q15 + (xr[2] + xr[3]) * MIXED_COS_4PI_5_Q15) >> 15);
+        m1i = xi[0] + (((xi[1] + xi[4]) * MIXED_COS_2PI_5_Q15 + (xi[2] + xi[3]) * MIXED_COS_4PI_5_Q15) >> 15);
+        m2r = xr[0] + (((xr[1] + xr[4]) * MIXED_COS_4PI_5_Q15 + (xr[2] + xr[3]) * MIXED_COS_2PI_5_Q15) >> 15);
+        m2i = xi[0] + (((xi[1] + xi[4]) * MIXED_COS_4PI_5_Q15 + (xi[2] + xi[3]) * MIXED_COS_2PI_5_Q15) >> 15);
+        n1r = ((xr[1] - xr[4]) * MIXED_SIN_2PI_5_Q15 + (xr[2] - xr[3]) * MIXED_SIN_4PI_5_Q15) >> 15;
+        n1i = ((xi[1] - xi[4]) * MIXED_SIN_2PI_5_Q15 + (xi[2] - xi[3]) * MIXED_SIN_4PI_5_Q15) >> 15;
+        n2r = ((xr[1] - xr[4]) * MIXED_SIN_4PI_5_Q15 - (xr[2] - xr[3]) * MIXED_SIN_2PI_5_Q15) >> 15;
+        n2i = ((xi[1] - xi[4]) * MIXED_SIN_4PI_5_Q15 - (xi[2] - xi[3]) * MIXED_SIN_2PI_5_Q15) >> 15;
+        yr[0] = xr[0] + xr[1] + xr[2] + xr[3] + xr[4];
+        yi[0] = xi[0] + xi[1] + xi[2] + xi[3] + xi[4];
+        yr[1] = m1r + n1i;
+        yi[1] = m1i - n1r;
+        yr[4] = m1r - n1i;
+        yi[4] = m1i + n1r;
+        yr[2] = m2r + n2i;
+        yi[2] = m2i - n2r;
+        yr[3] = m2r - n2i;
+        yi[3] = m2i + n2r;
+        break;
+    }
+
+    pSrc[2 * index] = __CLIP(yr[0], 15);
+    pSrc[2 * index + 1] = __CLIP(yi[0], 15);
+    for (k = 1; k < radix; k++) {
+        /* multiplication with exp(-j 2 pi k twIndex / fftLen) = cos - j sin */
+        yr[k] = __CLIP(yr[k], 15);
+        yi[k] = __CLIP(yi[k], 15);
+        cosVal = pCoef[2 * k * twIndex];
+        sinVal = pCoef[2 * k * twIndex + 1];
+        pSrc[2 * (index + k * dist)] = __CLIP((yr[k] * cosVal + yi[k] * sinVal) >> 15, 15);
+        pSrc[2 * (index + k * dist) + 1] = __CLIP((yi[k] * cosVal - yr[k] * sinVal) >> 15, 15);
+    }
+}
+
+/**
+ * @brief One stage of the mixed-radix FFT: the butterflies first, first + step, ... out of the
+ * fftLen / radix ones of the stage, combining radix samples at distance dist and applying the
+ * twiddle factors of stride butt.
+ */
+static void plp_cfft_mixed_stage_q16(int16_t *pSrc,
+                                     const int16_t *pCoef,
+                                     uint32_t fftLen,
+                                     uint32_t radix,
+                                     uint32_t dist,
+                                     uint32_t butt,
+                                     uint32_t first,
+                                     uint32_t step) {
+    uint32_t span = radix * dist;
+    uint32_t j = first / dist; // group of butterflies
+    uint32_t d = first % dist; // butterfly in the group
+    uint32_t shift = (butt == 1); // headroom of the first stage
+    uint32_t b;
+
+    for (b = first; b < fftLen / radix; b += step) {
+        plp_cfft_mixed_butterfly_q16(pSrc, pCoef, radix, j * span + d, dist, d * butt, shift);
+        d += step;
+        while (d >= dist) {
+            d -= dist;
+            j++;
+        }
+    }
+}
+
+/**
+ * @brief Doubles the values first, first + step, ... out of the 2 fftLen ones with saturation, to
+ * undo the headroom of the first mixed-radix stage.
+ */
+static void plp_cfft_mixed_double_q16(int16_t *pSrc, uint32_t fftLen, uint32_t first, uint32_t step) {
+    uint32_t i;
+
+    for (i = first; i < 2 * fftLen; i += step)
+        pSrc[i] = __CLIP(pSrc[i] << 1, 15);
+}
+
+/**
+ * @brief Reorders the output of the mixed-radix FFT with the swaps generated by
+ * plp_cfft_plan_create_q16.
+ */
+static void plp_cfft_mixed_swaps_q16(int16_t *pSrc, const uint16_t *pTable, uint32_t fftLen) {
+    uint32_t *pSrc32 = (uint32_t *)pSrc;
+    uint32_t i, j, tmp;
+
+    for (i = 0; i < fftLen; i++) {
+        j = pTable[i];
+        if (j != i) {
+            tmp = pSrc32[i];
+            pSrc32[i] = pSrc32[j];
+            pSrc32[j] = tmp;
+        }
+    }
+}
+
 /**
  * @} end of FFT group
  */
@@ -87,6 +87,7 @@ void plp_cfft_q32p_xpulpv2(void *args)
 			case 128:
 			case 512:
 			case 2048:
+			case 8192:
 			plp_cfft_radix4by2_q32(a->p1, L, (int32_t *)a->S->pTwiddle, a->nPE);
 			break;
 		}
@@ -152,7 +153,7 @@ void plp_cfft_radix4by2_q32(int32_t *pSrc,
 		// first col
 		plp_radix4_butterfly_q32 (pSrc, n2, (int32_t*)pCoef, 2U, nPE);
 		// second col
-		plp_radix4_butterfly_q32 (pSrc + fftLen, n2, (int32_t*)pCoef, 2U, nPE - nPE);
+		plp_radix4_butterfly_q32 (pSrc + fftLen, n2, (int32_t*)pCoef, 2U, nPE);
 	}
 	hal_team_barrier();
 
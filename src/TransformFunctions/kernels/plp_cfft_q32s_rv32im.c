@@ -87,6 +87,7 @@ void plp_cfft_q32s_rv32im(const plp_cfft_instance_q32 *S,
 			case 128:
 			case 512:
 			case 2048:
+			case 8192:
 			plp_cfft_radix4by2_q32(p1, L, (int32_t *)S->pTwiddle);
 			break;
 		}
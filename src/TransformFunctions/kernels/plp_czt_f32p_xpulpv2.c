@@ -0,0 +1,109 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_czt_f32p_xpulpv2.c
+ * Description:  Floating-point chirp-z transform for XPULPV2, parallel version
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup czt
+ */
+
+/**
+  @defgroup cztKernels Chirp-z transform kernels
+  The kernels chirp the input, convolve it with the chirp of the plan using two power-of-two
+  FFTs, and chirp the output. The parallel kernel splits the element-wise products between the
+  cores and runs the parallel FFT kernel within the same team.
+ */
+
+/**
+  @addtogroup cztKernels
+  @{
+ */
+
+/**
+   @brief  Floating-point chirp-z transform for XPULPV2 extension (parallel version).
+   @param[in]   arg     points to a plp_czt_instance_f32_parallel
+   @return      none
+*/
+void plp_czt_f32p_xpulpv2(void *arg) {
+    plp_czt_instance_f32_parallel *a = (plp_czt_instance_f32_parallel *)arg;
+    const plp_czt_plan_f32 *plan = a->plan;
+    const Complex_type_f32 *pX = (const Complex_type_f32 *)a->pSrc;
+    const Complex_type_f32 *pChirp = (const Complex_type_f32 *)plan->pChirp;
+    const Complex_type_f32 *pKernel = (const Complex_type_f32 *)plan->pKernel;
+    const Complex_type_f32 *pPost = (const Complex_type_f32 *)plan->pPost;
+    Complex_type_f32 *pY = (Complex_type_f32 *)a->pBuf;
+    Complex_type_f32 *pZ = (Complex_type_f32 *)a->pDst;
+    uint32_t fftLen = plan->fft.S.fftLen;
+    uint32_t nPE = a->nPE;
+    uint32_t core_id = hal_core_id();
+    plp_cfft_instance_f32_parallel fftArg = {
+        (plp_cfft_instance_f32 *)&plan->fft.S, a->pBuf, 0, 1, nPE
+    };
+    Complex_type_f32 x, y;
+    uint32_t i;
+
+    // chirp the input and pad it with zeros
+    for (i = core_id; i < fftLen; i += nPE) {
+        if (i < plan->len) {
+            x = pX[i];
+            y = pChirp[i];
+            pY[i].re = x.re * y.re - x.im * y.im;
+            pY[i].im = x.re * y.im + x.im * y.re;
+        } else {
+            pY[i].re = 0.0f;
+            pY[i].im = 0.0f;
+        }
+    }
+    hal_team_barrier();
+
+    // convolution with the chirp, the inverse FFT is a forward FFT read in reversed order
+    plp_cfft_f32p_xpulpv2(&fftArg);
+    hal_team_barrier();
+    for (i = core_id; i < fftLen; i += nPE) {
+        x = pY[i];
+        y = pKernel[i];
+        pY[i].re = x.re * y.re - x.im * y.im;
+        pY[i].im = x.re * y.im + x.im * y.re;
+    }
+    hal_team_barrier();
+    plp_cfft_f32p_xpulpv2(&fftArg);
+    hal_team_barrier();
+
+    // chirp the output
+    for (i = core_id; i < plan->numBins; i += nPE) {
+        x = pY[(fftLen - i) & (fftLen - 1)];
+        y = pPost[i];
+        pZ[i].re = x.re * y.re - x.im * y.im;
+        pZ[i].im = x.re * y.im + x.im * y.re;
+    }
+}
+
+/**
+  @} end of cztKernels group
+ */
@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_czt_f32s_xpulpv2.c
+ * Description:  Floating-point chirp-z transform for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup czt
+ */
+
+/**
+  @addtogroup cztKernels
+  @{
+ */
+
+/**
+   @brief  Floating-point chirp-z transform for XPULPV2 extension.
+   @param[in]   plan    points to the plan
+   @param[in]   pSrc    points to the len complex input samples
+   @param[in]   pBuf    points to a work buffer of 2 * plan->fft.S.fftLen values
+   @param[out]  pDst    points to the numBins complex output bins
+   @return      none
+*/
+void plp_czt_f32s_xpulpv2(const plp_czt_plan_f32 *plan,
+                          const float32_t *__restrict__ pSrc,
+                          float32_t *__restrict__ pBuf,
+                          float32_t *__restrict__ pDst) {
+    const Complex_type_f32 *pX = (const Complex_type_f32 *)pSrc;
+    const Complex_type_f32 *pChirp = (const Complex_type_f32 *)plan->pChirp;
+    const Complex_type_f32 *pKernel = (const Complex_type_f32 *)plan->pKernel;
+    const Complex_type_f32 *pPost = (const Complex_type_f32 *)plan->pPost;
+    Complex_type_f32 *pY = (Complex_type_f32 *)pBuf;
+    Complex_type_f32 *pZ = (Complex_type_f32 *)pDst;
+    uint32_t fftLen = plan->fft.S.fftLen;
+    Complex_type_f32 a, b;
+    uint32_t i;
+
+    // chirp the input and pad it with zeros
+    for (i = 0; i < plan->len; i++) {
+        a = pX[i];
+        b = pChirp[i];
+        pY[i].re = a.re * b.re - a.im * b.im;
+        pY[i].im = a.re * b.im + a.im * b.re;
+    }
+    for (; i < fftLen; i++) {
+        pY[i].re = 0.0f;
+        pY[i].im = 0.0f;
+    }
+
+    // convolution with the chirp, the inverse FFT is a forward FFT read in reversed order
+    plp_cfft_f32s_xpulpv2(&plan->fft.S, pBuf, 0, 1);
+    for (i = 0; i < fftLen; i++) {
+        a = pY[i];
+        b = pKernel[i];
+        pY[i].re = a.re * b.re - a.im * b.im;
+        pY[i].im = a.re * b.im + a.im * b.re;
+    }
+    plp_cfft_f32s_xpulpv2(&plan->fft.S, pBuf, 0, 1);
+
+    // chirp the output
+    for (i = 0; i < plan->numBins; i++) {
+        a = pY[(fftLen - i) & (fftLen - 1)];
+        b = pPost[i];
+        pZ[i].re = a.re * b.re - a.im * b.im;
+        pZ[i].im = a.re * b.im + a.im * b.re;
+    }
+}
+
+/**
+  @} end of cztKernels group
+ */
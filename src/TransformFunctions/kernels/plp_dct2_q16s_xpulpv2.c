@@ -0,0 +1,62 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_dct2_q16s_xpulpv2.c
+ * Description:  16-bit fixed-point DCT-II for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+#include "plp_dct_common.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      16-bit fixed-point DCT-II for XPULPV2
+ *
+ * The input is reordered while it is written into the FFT buffer, and the split stage of the real
+ * FFT is fused with the phase shift of the DCT, so that the FFT output is read only once.
+ *
+ * @param[in]  plan    points to the plan
+ * @param[in]  pSrc    points to the N input values
+ * @param[in]  pBuf    points to a work buffer of N values
+ * @param[out] pDst    points to the N output values
+ */
+void plp_dct2_q16s_xpulpv2(const plp_dct_plan_q16 *plan,
+                           const int16_t *pSrc,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *pDst) {
+    plp_dct2_seq_q16(plan, pSrc, pBuf, pDst, plp_cfft_q16s_xpulpv2);
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_dct4_f32p_xpulpv2.c
+ * Description:  Parallel floating-point DCT-IV for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+#include "plp_dct_common.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Parallel floating-point DCT-IV for XPULPV2
+ *
+ * The passes before and after the FFT are split in blocks across the cores, and the complex FFT
+ * runs on the whole team in between. See plp_dct4_f32s_xpulpv2 for the algorithm.
+ *
+ * @param[in]  args       points to the plp_dct_instance_f32_parallel
+ */
+void plp_dct4_f32p_xpulpv2(void *args) {
+
+    plp_dct_instance_f32_parallel *a = (plp_dct_instance_f32_parallel *)args;
+    const plp_dct_plan_f32 *plan = a->plan;
+    uint8_t orthoNorm = a->orthoNorm;
+    uint32_t N = plan->len;
+    uint32_t L = N / 2;
+    uint32_t core_id = hal_core_id();
+    uint32_t first, last;
+    float32_t scale = orthoNorm ? sqrtf(2.0f / (float32_t)N) : 2.0f;
+
+    plp_cfft_instance_f32_parallel cfftArgs = { .S = (plp_cfft_instance_f32 *)&plan->fft.S,
+                                                .pSrc = a->pBuf,
+                                                .ifftFlag = 0,
+                                                .bitReverseFlag = 1,
+                                                .nPE = a->nPE };
+
+    plp_dct_range(L, core_id, a->nPE, &first, &last);
+    plp_dct4_pre_f32(plan, a->pSrc, a->pBuf, first, last);
+    hal_team_barrier();
+
+    plp_cfft_f32p_xpulpv2((void *)&cfftArgs);
+    hal_team_barrier();
+
+    plp_dct4_post_f32(plan, a->pBuf, scale, a->pDst, first, last);
+    hal_team_barrier();
+}
+
+/**
+ * @} end of FFT group
+ */
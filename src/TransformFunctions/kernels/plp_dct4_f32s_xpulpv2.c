@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_dct4_f32s_xpulpv2.c
+ * Description:  Floating-point DCT-IV for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+#include "plp_dct_common.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Floating-point DCT-IV for XPULPV2
+ *
+ * The input is folded into N/2 complex values and rotated while it is written into the FFT buffer,
+ * and the output rotation is applied while the FFT output is read.
+ *
+ * @param[in]  plan        points to the plan
+ * @param[in]  orthoNorm   whether to use the orthonormal scaling
+ * @param[in]  pSrc        points to the N input values
+ * @param[in]  pBuf        points to a work buffer of N values
+ * @param[out] pDst        points to the N output values
+ */
+void plp_dct4_f32s_xpulpv2(const plp_dct_plan_f32 *plan,
+                           const uint8_t orthoNorm,
+                           const float32_t *pSrc,
+                           float32_t *__restrict__ pBuf,
+                           float32_t *pDst) {
+
+    uint32_t N = plan->len;
+    uint32_t L = N / 2;
+    float32_t scale = orthoNorm ? sqrtf(2.0f / (float32_t)N) : 2.0f;
+
+    plp_dct4_pre_f32(plan, pSrc, pBuf, 0, L);
+    plp_cfft_f32s_xpulpv2(&plan->fft.S, pBuf, 0, 1);
+    plp_dct4_post_f32(plan, pBuf, scale, pDst, 0, L);
+}
+
+/**
+ * @} end of FFT group
+ */
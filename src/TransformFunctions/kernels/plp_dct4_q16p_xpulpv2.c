@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_dct4_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit fixed-point DCT-IV for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+#include "plp_dct_common.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Parallel 16-bit fixed-point DCT-IV for XPULPV2
+ *
+ * The passes before and after the FFT are split in blocks across the cores, and the complex FFT
+ * runs on the whole team in between. See plp_dct4_q16s_xpulpv2 for the algorithm.
+ *
+ * @param[in]  args       points to the plp_dct_instance_q16_parallel
+ */
+void plp_dct4_q16p_xpulpv2(void *args) {
+
+    plp_dct_instance_q16_parallel *a = (plp_dct_instance_q16_parallel *)args;
+    const plp_dct_plan_q16 *plan = a->plan;
+    uint32_t L = plan->len / 2;
+    uint32_t core_id = hal_core_id();
+    uint32_t first, last;
+
+    plp_cfft_instance_q16_parallel cfftArgs = { .S = (plp_cfft_instance_q16 *)&plan->fft.S,
+                                                .p1 = a->pBuf,
+                                                .ifftFlag = 0,
+                                                .bitReverseFlag = 1,
+                                                .deciPoint = 15,
+                                                .nPE = a->nPE };
+
+    plp_dct_range(L, core_id, a->nPE, &first, &last);
+    plp_dct4_pre_q16(plan, a->pSrc, a->pBuf, first, last);
+    hal_team_barrier();
+
+    plp_cfft_q16p_xpulpv2((void *)&cfftArgs);
+    hal_team_barrier();
+
+    plp_dct_range(L, core_id, a->nPE, &first, &last);
+    plp_dct4_post_q16(plan, a->pBuf, a->pDst, first, last);
+    hal_team_barrier();
+}
+
+/**
+ * @} end of FFT group
+ */
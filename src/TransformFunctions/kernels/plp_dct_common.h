@@ -0,0 +1,570 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_dct_common.h
+ * Description:  Fused pre- and post-processing of the fast DCTs
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+#ifndef __PLP_DCT_COMMON_H
+#define __PLP_DCT_COMMON_H
+
+/* All DCTs of N points run on a complex FFT of L = N/2 points. The passes before and after the
+   FFT work on the index ranges [first, last), so that the parallel kernels can split them across
+   the cores, and each of them reorders, rotates and scales in a single sweep over the data.
+
+   DCT-II and DCT-III (Makhoul): the sequence v[m] = x[2m], v[N-1-m] = x[2m+1] is transformed as
+   z[n] = v[2n] + j v[2n+1]. The split stage of the real FFT then gives V[k] for k = 0 .. L, and
+   X[k] = Re(e^(-j pi k/(2N)) V[k]), X[N-k] = -Im(e^(-j pi k/(2N)) V[k]).
+   DCT-IV: t[n] = (x[2n] + j x[N-1-2n]) e^(-j pi (4n+1)/(4N)), T = FFT(t), u[k] = T[k] e^(-j pi k/N),
+   X[2k] = Re(u[k]), X[N-1-2k] = -Im(u[k]). */
+
+/* Index in x of the sample m of the reordered sequence v */
+static inline uint32_t plp_dct_index(uint32_t m, uint32_t N) {
+    return (m < N / 2) ? 2 * m : 2 * N - 1 - 2 * m;
+}
+
+/* Range [*pFirst, *pLast) of the block of core_id among nPE blocks of len items */
+static inline void plp_dct_range(uint32_t len,
+                                 uint32_t core_id,
+                                 uint32_t nPE,
+                                 uint32_t *pFirst,
+                                 uint32_t *pLast) {
+    uint32_t step = (len + nPE - 1) / nPE;
+
+    *pFirst = core_id * step < len ? core_id * step : len;
+    *pLast = *pFirst + step < len ? *pFirst + step : len;
+}
+
+static inline int16_t plp_dct_sat_q16(int32_t x) {
+    return (int16_t)(x > 32767 ? 32767 : (x < -32768 ? -32768 : x));
+}
+
+static inline int32_t plp_dct_sat_q32(int64_t x) {
+    return (int32_t)(x > 0x7FFFFFFFLL ? 0x7FFFFFFFLL : (x < -0x80000000LL ? -0x80000000LL : x));
+}
+
+/* ---------------------------------------------------------------------------------------------
+   16-bit fixed point, tables (cos, sin)(angle) in Q15
+   --------------------------------------------------------------------------------------------- */
+
+/* DCT-II: z[n] = v[2n] + j v[2n+1], n = first .. last - 1 */
+static inline void plp_dct2_pre_q16(const plp_dct_plan_q16 *plan,
+                                    const int16_t *pSrc,
+                                    int16_t *pBuf,
+                                    uint32_t first,
+                                    uint32_t last) {
+    uint32_t N = plan->len;
+    uint32_t n;
+
+    for (n = first; n < last; n++) {
+        pBuf[2 * n] = pSrc[plp_dct_index(2 * n, N)];
+        pBuf[2 * n + 1] = pSrc[plp_dct_index(2 * n + 1, N)];
+    }
+}
+
+/* DCT-II: X[k] and X[N-k] from the FFT output Z = FFT(z)/L, k = first .. last - 1 (k <= L) */
+static inline void plp_dct2_post_q16(const plp_dct_plan_q16 *plan,
+                                     const int16_t *pBuf,
+                                     int16_t *pDst,
+                                     uint32_t first,
+                                     uint32_t last) {
+    uint32_t N = plan->len;
+    uint32_t L = N / 2;
+    uint32_t k, a, b;
+    int32_t ar, ai, br, bi, mr, mi, cr, ci, c, s;
+
+    for (k = first; k < last; k++) {
+        /* A = Z[k]/2 and B = conj(Z[L-k])/2 */
+        a = (k == L) ? 0 : k;
+        b = (k == 0) ? 0 : L - k;
+        ar = pBuf[2 * a] >> 1;
+        ai = pBuf[2 * a + 1] >> 1;
+        br = pBuf[2 * b] >> 1;
+        bi = -(pBuf[2 * b + 1] >> 1);
+
+        /* V/N = ((A + B) - j W^k (A - B))/2 */
+        c = plan->pSplit[2 * a];
+        s = plan->pSplit[2 * a + 1];
+        if (k == L) {
+            /* W^L = -1 */
+            c = -32768;
+            s = 0;
+        }
+        mr = ar - br;
+        mi = ai - bi;
+        cr = (ar + br + ((c * mi - s * mr) >> 15)) >> 1;
+        ci = (ai + bi - ((c * mr + s * mi) >> 15)) >> 1;
+
+        /* e^(-j pi k/(2N)) V/N */
+        c = plan->pShift[2 * k];
+        s = plan->pShift[2 * k + 1];
+        pDst[k] = plp_dct_sat_q16((c * cr + s * ci + (1 << 14)) >> 15);
+        if (k > 0) {
+            pDst[N - k] = plp_dct_sat_q16((s * cr - c * ci + (1 << 14)) >> 15);
+        }
+    }
+}
+
+/* DCT-III: conj(Z[k])/2, k = first .. last - 1, with Z[k] = Fe[k] + j Fo[k] the spectrum whose
+   inverse FFT gives z[n] = v[2n] + j v[2n+1]. Like the inverse of plp_rfft_q16, the halved
+   spectrum saturates only for inputs close to full scale. */
+static inline void plp_dct3_pre_q16(const plp_dct_plan_q16 *plan,
+                                    const int16_t *pSrc,
+                                    int16_t *pBuf,
+                                    uint32_t first,
+                                    uint32_t last) {
+    uint32_t N = plan->len;
+    uint32_t L = N / 2;
+    uint32_t k;
+    int32_t xa, xb, vr, vi, wr, wi, sr, si, dr, di, er, ei, qr, qi, c, s;
+
+    for (k = first; k < last; k++) {
+        /* V[k] = e^(j pi k/(2N)) (X[k] - j X[N-k]), with X[N] = 0 */
+        xa = pSrc[k];
+        xb = (k == 0) ? 0 : pSrc[N - k];
+        c = plan->pShift[2 * k];
+        s = plan->pShift[2 * k + 1];
+        vr = (c * xa + s * xb) >> 15;
+        vi = (s * xa - c * xb) >> 15;
+
+        /* V[L-k] */
+        xa = pSrc[L - k];
+        xb = pSrc[L + k];
+        c = plan->pShift[2 * (L - k)];
+        s = plan->pShift[2 * (L - k) + 1];
+        wr = (c * xa + s * xb) >> 15;
+        wi = (s * xa - c * xb) >> 15;
+
+        /* Fe = (V[k] + conj(V[L-k]))/2, Fo = W^-k (V[k] - conj(V[L-k]))/2 */
+        sr = vr + wr;
+        si = vi - wi;
+        dr = (vr - wr) >> 1;
+        di = (vi + wi) >> 1;
+        c = plan->pSplit[2 * k];
+        s = plan->pSplit[2 * k + 1];
+        er = (sr + 2) >> 2;
+        ei = (si + 2) >> 2;
+        qr = (c * dr - s * di + (1 << 15)) >> 16;
+        qi = (s * dr + c * di + (1 << 15)) >> 16;
+
+        pBuf[2 * k] = plp_dct_sat_q16(er - qi);
+        pBuf[2 * k + 1] = plp_dct_sat_q16(-ei - qr);
+    }
+}
+
+/* DCT-III: x from the FFT output conj(z)/2, n = first .. last - 1 */
+static inline void plp_dct3_post_q16(const plp_dct_plan_q16 *plan,
+                                     const int16_t *pBuf,
+                                     int16_t *pDst,
+                                     uint32_t first,
+                                     uint32_t last) {
+    uint32_t N = plan->len;
+    uint32_t n;
+
+    for (n = first; n < last; n++) {
+        pDst[plp_dct_index(2 * n, N)] = plp_dct_sat_q16(pBuf[2 * n] * 2);
+        pDst[plp_dct_index(2 * n + 1, N)] = plp_dct_sat_q16(pBuf[2 * n + 1] * -2);
+    }
+}
+
+/* DCT-IV: t[n]/2, n = first .. last - 1 */
+static inline void plp_dct4_pre_q16(const plp_dct_plan_q16 *plan,
+                                    const int16_t *pSrc,
+                                    int16_t *pBuf,
+                                    uint32_t first,
+                                    uint32_t last) {
+    uint32_t N = plan->len;
+    uint32_t n;
+    int32_t a, b, c, s;
+
+    for (n = first; n < last; n++) {
+        a = pSrc[2 * n];
+        b = pSrc[N - 1 - 2 * n];
+        c = plan->pPre[2 * n];
+        s = plan->pPre[2 * n + 1];
+        pBuf[2 * n] = (int16_t)((a * c + b * s + (1 << 15)) >> 16);
+        pBuf[2 * n + 1] = (int16_t)((b * c - a * s + (1 << 15)) >> 16);
+    }
+}
+
+/* DCT-IV: X[2k] and X[N-1-2k] from the FFT output T/N, k = first .. last - 1 */
+static inline void plp_dct4_post_q16(const plp_dct_plan_q16 *plan,
+                                     const int16_t *pBuf,
+                                     int16_t *pDst,
+                                     uint32_t first,
+                                     uint32_t last) {
+    uint32_t N = plan->len;
+    uint32_t k;
+    int32_t tr, ti, c, s;
+
+    for (k = first; k < last; k++) {
+        tr = pBuf[2 * k];
+        ti = pBuf[2 * k + 1];
+        c = plan->pPost[2 * k];
+        s = plan->pPost[2 * k + 1];
+        pDst[2 * k] = plp_dct_sat_q16((c * tr + s * ti + (1 << 14)) >> 15);
+        pDst[N - 1 - 2 * k] = plp_dct_sat_q16((s * tr - c * ti + (1 << 14)) >> 15);
+    }
+}
+
+/* ---------------------------------------------------------------------------------------------
+   32-bit fixed point, same algorithm with tables in Q31 and 64-bit products
+   --------------------------------------------------------------------------------------------- */
+
+static inline void plp_dct2_pre_q32(const plp_dct_plan_q32 *plan,
+                                    const int32_t *pSrc,
+                                    int32_t *pBuf,
+                                    uint32_t first,
+                                    uint32_t last) {
+    uint32_t N = plan->len;
+    uint32_t n;
+
+    for (n = first; n < last; n++) {
+        pBuf[2 * n] = pSrc[plp_dct_index(2 * n, N)];
+        pBuf[2 * n + 1] = pSrc[plp_dct_index(2 * n + 1, N)];
+    }
+}
+
+static inline void plp_dct2_post_q32(const plp_dct_plan_q32 *plan,
+                                     const int32_t *pBuf,
+                                     int32_t *pDst,
+                                     uint32_t first,
+                                     uint32_t last) {
+    uint32_t N = plan->len;
+    uint32_t L = N / 2;
+    uint32_t k, a, b;
+    int64_t ar, ai, br, bi, mr, mi, cr, ci, c, s;
+
+    for (k = first; k < last; k++) {
+        a = (k == L) ? 0 : k;
+        b = (k == 0) ? 0 : L - k;
+        ar = pBuf[2 * a] >> 1;
+        ai = pBuf[2 * a + 1] >> 1;
+        br = pBuf[2 * b] >> 1;
+        bi = -(int64_t)(pBuf[2 * b + 1] >> 1);
+
+        c = plan->pSplit[2 * a];
+        s = plan->pSplit[2 * a + 1];
+        if (k == L) {
+            c = -0x80000000LL;
+            s = 0;
+        }
+        mr = ar - br;
+        mi = ai - bi;
+        cr = (ar + br + ((c * mi - s * mr) >> 31)) >> 1;
+        ci = (ai + bi - ((c * mr + s * mi) >> 31)) >> 1;
+
+        c = plan->pShift[2 * k];
+        s = plan->pShift[2 * k + 1];
+        pDst[k] = plp_dct_sat_q32((c * cr + s * ci + (1LL << 30)) >> 31);
+        if (k > 0) {
+            pDst[N - k] = plp_dct_sat_q32((s * cr - c * ci + (1LL << 30)) >> 31);
+        }
+    }
+}
+
+static inline void plp_dct3_pre_q32(const plp_dct_plan_q32 *plan,
+                                    const int32_t *pSrc,
+                                    int32_t *pBuf,
+                                    uint32_t first,
+                                    uint32_t last) {
+    uint32_t N = plan->len;
+    uint32_t L = N / 2;
+    uint32_t k;
+    int64_t xa, xb, vr, vi, wr, wi, sr, si, dr, di, er, ei, qr, qi, c, s;
+
+    for (k = first; k < last; k++) {
+        xa = pSrc[k];
+        xb = (k == 0) ? 0 : pSrc[N - k];
+        c = plan->pShift[2 * k];
+        s = plan->pShift[2 * k + 1];
+        vr = (c * xa + s * xb) >> 31;
+        vi = (s * xa - c * xb) >> 31;
+
+        xa = pSrc[L - k];
+        xb = pSrc[L + k];
+        c = plan->pShift[2 * (L - k)];
+        s = plan->pShift[2 * (L - k) + 1];
+        wr = (c * xa + s * xb) >> 31;
+        wi = (s * xa - c * xb) >> 31;
+
+        sr = vr + wr;
+        si = vi - wi;
+        dr = (vr - wr) >> 1;
+        di = (vi + wi) >> 1;
+        c = plan->pSplit[2 * k];
+        s = plan->pSplit[2 * k + 1];
+        er = (sr + 2) >> 2;
+        ei = (si + 2) >> 2;
+        qr = (c * dr - s * di + (1LL << 31)) >> 32;
+        qi = (s * dr + c * di + (1LL << 31)) >> 32;
+
+        pBuf[2 * k] = plp_dct_sat_q32(er - qi);
+        pBuf[2 * k + 1] = plp_dct_sat_q32(-ei - qr);
+    }
+}
+
+static inline void plp_dct3_post_q32(const plp_dct_plan_q32 *plan,
+                                     const int32_t *pBuf,
+                                     int32_t *pDst,
+                                     uint32_t first,
+                                     uint32_t last) {
+    uint32_t N = plan->len;
+    uint32_t n;
+
+    for (n = first; n < last; n++) {
+        pDst[plp_dct_index(2 * n, N)] = plp_dct_sat_q32((int64_t)pBuf[2 * n] * 2);
+        pDst[plp_dct_index(2 * n + 1, N)] = plp_dct_sat_q32((int64_t)pBuf[2 * n + 1] * -2);
+    }
+}
+
+static inline void plp_dct4_pre_q32(const plp_dct_plan_q32 *plan,
+                                    const int32_t *pSrc,
+                                    int32_t *pBuf,
+                                    uint32_t first,
+                                    uint32_t last) {
+    uint32_t N = plan->len;
+    uint32_t n;
+    int64_t a, b, c, s;
+
+    for (n = first; n < last; n++) {
+        a = pSrc[2 * n];
+        b = pSrc[N - 1 - 2 * n];
+        c = plan->pPre[2 * n];
+        s = plan->pPre[2 * n + 1];
+        pBuf[2 * n] = (int32_t)((a * c + b * s + (1LL << 31)) >> 32);
+        pBuf[2 * n + 1] = (int32_t)((b * c - a * s + (1LL << 31)) >> 32);
+    }
+}
+
+static inline void plp_dct4_post_q32(const plp_dct_plan_q32 *plan,
+                                     const int32_t *pBuf,
+                                     int32_t *pDst,
+                                     uint32_t first,
+                                     uint32_t last) {
+    uint32_t N = plan->len;
+    uint32_t k;
+    int64_t tr, ti, c, s;
+
+    for (k = first; k < last; k++) {
+        tr = pBuf[2 * k];
+        ti = pBuf[2 * k + 1];
+        c = plan->pPost[2 * k];
+        s = plan->pPost[2 * k + 1];
+        pDst[2 * k] = plp_dct_sat_q32((c * tr + s * ti + (1LL << 30)) >> 31);
+        pDst[N - 1 - 2 * k] = plp_dct_sat_q32((s * tr - c * ti + (1LL << 30)) >> 31);
+    }
+}
+
+/* ---------------------------------------------------------------------------------------------
+   Floating point, tables exp(-j angle) stored as (cos, -sin)(angle)
+   --------------------------------------------------------------------------------------------- */
+
+/* DCT-III: conj(Z[k]) / L, with the input scaled by scale (scale0 for X[0]) */
+static inline void plp_dct3_pre_f32(const plp_dct_plan_f32 *plan,
+                                    const float32_t *pSrc,
+                                    float32_t scale,
+                                    float32_t scale0,
+                                    float32_t *pBuf,
+                                    uint32_t first,
+                                    uint32_t last) {
+    uint32_t N = plan->len;
+    uint32_t L = N / 2;
+    uint32_t k;
+    float32_t xa, xb, vr, vi, wr, wi, sr, si, dr, di, c, s;
+
+    for (k = first; k < last; k++) {
+        /* V[k] = conj(shift[k]) (X[k] - j X[N-k]) */
+        xa = (k == 0) ? pSrc[0] * scale0 : pSrc[k] * scale;
+        xb = (k == 0) ? 0.0f : pSrc[N - k] * scale;
+        c = plan->pShift[2 * k];
+        s = plan->pShift[2 * k + 1];
+        vr = c * xa - s * xb;
+        vi = -s * xa - c * xb;
+
+        xa = pSrc[L - k] * scale;
+        xb = pSrc[L + k] * scale;
+        c = plan->pShift[2 * (L - k)];
+        s = plan->pShift[2 * (L - k) + 1];
+        wr = c * xa - s * xb;
+        wi = -s * xa - c * xb;
+
+        /* Fe = (V[k] + conj(V[L-k]))/2, Fo = conj(W^k) (V[k] - conj(V[L-k]))/2 */
+        sr = 0.5f * (vr + wr);
+        si = 0.5f * (vi - wi);
+        dr = 0.5f * (vr - wr);
+        di = 0.5f * (vi + wi);
+        c = plan->pSplit[2 * k];
+        s = plan->pSplit[2 * k + 1];
+
+        pBuf[2 * k] = sr - (-s * dr + c * di);
+        pBuf[2 * k + 1] = -si - (c * dr + s * di);
+    }
+}
+
+static inline void plp_dct3_post_f32(const plp_dct_plan_f32 *plan,
+                                     const float32_t *pBuf,
+                                     float32_t *pDst,
+                                     uint32_t first,
+                                     uint32_t last) {
+    uint32_t N = plan->len;
+    uint32_t n;
+
+    for (n = first; n < last; n++) {
+        pDst[plp_dct_index(2 * n, N)] = pBuf[2 * n];
+        pDst[plp_dct_index(2 * n + 1, N)] = -pBuf[2 * n + 1];
+    }
+}
+
+static inline void plp_dct4_pre_f32(const plp_dct_plan_f32 *plan,
+                                    const float32_t *pSrc,
+                                    float32_t *pBuf,
+                                    uint32_t first,
+                                    uint32_t last) {
+    uint32_t N = plan->len;
+    uint32_t n;
+    float32_t a, b, c, s;
+
+    for (n = first; n < last; n++) {
+        a = pSrc[2 * n];
+        b = pSrc[N - 1 - 2 * n];
+        c = plan->pPre[2 * n];
+        s = plan->pPre[2 * n + 1];
+        pBuf[2 * n] = a * c - b * s;
+        pBuf[2 * n + 1] = b * c + a * s;
+    }
+}
+
+/* DCT-IV: X[2k] and X[N-1-2k] multiplied by scale */
+static inline void plp_dct4_post_f32(const plp_dct_plan_f32 *plan,
+                                     const float32_t *pBuf,
+                                     float32_t scale,
+                                     float32_t *pDst,
+                                     uint32_t first,
+                                     uint32_t last) {
+    uint32_t N = plan->len;
+    uint32_t k;
+    float32_t tr, ti, c, s;
+
+    for (k = first; k < last; k++) {
+        tr = pBuf[2 * k];
+        ti = pBuf[2 * k + 1];
+        c = plan->pPost[2 * k] * scale;
+        s = plan->pPost[2 * k + 1] * scale;
+        pDst[2 * k] = c * tr - s * ti;
+        pDst[N - 1 - 2 * k] = -(c * ti + s * tr);
+    }
+}
+
+/* ---------------------------------------------------------------------------------------------
+   Sequential fixed-point transforms, shared by the RV32IM and XPULPV2 kernels which only differ in
+   the complex FFT kernel passed as cfft
+   --------------------------------------------------------------------------------------------- */
+
+typedef void (*plp_dct_cfft_q16)(const plp_cfft_instance_q16 *,
+                                 int16_t *,
+                                 uint8_t,
+                                 uint8_t,
+                                 uint32_t);
+typedef void (*plp_dct_cfft_q32)(const plp_cfft_instance_q32 *,
+                                 int32_t *,
+                                 uint8_t,
+                                 uint8_t,
+                                 uint32_t);
+
+static inline void plp_dct2_seq_q16(const plp_dct_plan_q16 *plan,
+                                    const int16_t *pSrc,
+                                    int16_t *pBuf,
+                                    int16_t *pDst,
+                                    plp_dct_cfft_q16 cfft) {
+    uint32_t L = plan->len / 2;
+
+    plp_dct2_pre_q16(plan, pSrc, pBuf, 0, L);
+    cfft(&plan->fft.S, pBuf, 0, 1, 15);
+    plp_dct2_post_q16(plan, pBuf, pDst, 0, L + 1);
+}
+
+static inline void plp_dct3_seq_q16(const plp_dct_plan_q16 *plan,
+                                    const int16_t *pSrc,
+                                    int16_t *pBuf,
+                                    int16_t *pDst,
+                                    plp_dct_cfft_q16 cfft) {
+    uint32_t L = plan->len / 2;
+
+    plp_dct3_pre_q16(plan, pSrc, pBuf, 0, L);
+    cfft(&plan->fft.S, pBuf, 0, 1, 15);
+    plp_dct3_post_q16(plan, pBuf, pDst, 0, L);
+}
+
+static inline void plp_dct4_seq_q16(const plp_dct_plan_q16 *plan,
+                                    const int16_t *pSrc,
+                                    int16_t *pBuf,
+                                    int16_t *pDst,
+                                    plp_dct_cfft_q16 cfft) {
+    uint32_t L = plan->len / 2;
+
+    plp_dct4_pre_q16(plan, pSrc, pBuf, 0, L);
+    cfft(&plan->fft.S, pBuf, 0, 1, 15);
+    plp_dct4_post_q16(plan, pBuf, pDst, 0, L);
+}
+
+static inline void plp_dct2_seq_q32(const plp_dct_plan_q32 *plan,
+                                    const int32_t *pSrc,
+                                    int32_t *pBuf,
+                                    int32_t *pDst,
+                                    plp_dct_cfft_q32 cfft) {
+    uint32_t L = plan->len / 2;
+
+    plp_dct2_pre_q32(plan, pSrc, pBuf, 0, L);
+    cfft(&plan->fft.S, pBuf, 0, 1, 31);
+    plp_dct2_post_q32(plan, pBuf, pDst, 0, L + 1);
+}
+
+static inline void plp_dct3_seq_q32(const plp_dct_plan_q32 *plan,
+                                    const int32_t *pSrc,
+                                    int32_t *pBuf,
+                                    int32_t *pDst,
+                                    plp_dct_cfft_q32 cfft) {
+    uint32_t L = plan->len / 2;
+
+    plp_dct3_pre_q32(plan, pSrc, pBuf, 0, L);
+    cfft(&plan->fft.S, pBuf, 0, 1, 31);
+    plp_dct3_post_q32(plan, pBuf, pDst, 0, L);
+}
+
+static inline void plp_dct4_seq_q32(const plp_dct_plan_q32 *plan,
+                                    const int32_t *pSrc,
+                                    int32_t *pBuf,
+                                    int32_t *pDst,
+                                    plp_dct_cfft_q32 cfft) {
+    uint32_t L = plan->len / 2;
+
+    plp_dct4_pre_q32(plan, pSrc, pBuf, 0, L);
+    cfft(&plan->fft.S, pBuf, 0, 1, 31);
+    plp_dct4_post_q32(plan, pBuf, pDst, 0, L);
+}
+
+#endif // __PLP_DCT_COMMON_H
@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_dwt2d_f32p_xpulpv2.c
+ * Description:  Parallel Floating-point 2D Discrete Wavelet Transform and its inverse
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+#include "plp_math.h"
+#include "plp_dwt2d_lines.h"
+
+
+/**
+  @ingroup dwt
+ */
+
+/**
+  @addtogroup realDWTKernels
+  @{
+ */
+
+/**
+   @brief  Parallel Floating-point 2D DWT of an image for XPULPV2 extension.
+
+   Every core decomposes whole rows (core_id, core_id + nPE, ...) and then whole columns through
+   its own slice of pBuffer. The only barrier is the one between the row and the column pass.
+
+   @param[in]   args     points to the plp_dwt2d_instance_f32
+   @return      none
+*/
+void plp_dwt2d_f32p_xpulpv2(void *args) {
+
+    plp_dwt2d_instance_f32 *S = (plp_dwt2d_instance_f32 *)args;
+
+    const uint32_t rows = S->rows;
+    const uint32_t cols = S->cols;
+    const uint32_t nPE = S->nPE;
+    const uint32_t core_id = hal_core_id();
+    const uint32_t outRows = PLP_DWT_OUTPUT_LENGTH(rows, S->wavelet.length);
+    const uint32_t outCols = PLP_DWT_OUTPUT_LENGTH(cols, S->wavelet.length);
+
+    float32_t *pBuffer = S->pBuffer + core_id * PLP_DWT2D_BUFFER_LENGTH(rows, cols, S->wavelet.length);
+    float32_t *pTempL = S->pTemp;
+    float32_t *pTempH = S->pTemp + rows * outCols;
+
+    plp_dwt2d_pass_f32(S->pSrc, cols, 1, cols, pTempL, pTempH, outCols, 1, outCols, rows, core_id,
+                      nPE, S->wavelet, S->mode, pBuffer);
+
+    hal_team_barrier();
+
+    plp_dwt2d_pass_f32(pTempL, 1, outCols, rows, S->pDstA, S->pDstH, 1, outCols, outRows, outCols,
+                      core_id, nPE, S->wavelet, S->mode, pBuffer);
+    plp_dwt2d_pass_f32(pTempH, 1, outCols, rows, S->pDstV, S->pDstD, 1, outCols, outRows, outCols,
+                      core_id, nPE, S->wavelet, S->mode, pBuffer);
+}
+
+/**
+   @brief  Parallel Floating-point inverse 2D DWT for XPULPV2 extension.
+
+   Every core reconstructs whole columns and then whole rows through its own slice of pBuffer,
+   with a barrier between the column and the row pass.
+
+   @param[in]   args     points to the plp_idwt2d_instance_f32
+   @return      none
+*/
+void plp_idwt2d_f32p_xpulpv2(void *args) {
+
+    plp_idwt2d_instance_f32 *S = (plp_idwt2d_instance_f32 *)args;
+
+    const uint32_t rows = S->rows;
+    const uint32_t cols = S->cols;
+    const uint32_t nPE = S->nPE;
+    const uint32_t core_id = hal_core_id();
+    const uint32_t outRows = PLP_IDWT_OUTPUT_LENGTH(rows, S->wavelet.length);
+    const uint32_t outCols = PLP_IDWT_OUTPUT_LENGTH(cols, S->wavelet.length);
+
+    float32_t *pBuffer = S->pBuffer + core_id * PLP_IDWT2D_BUFFER_LENGTH(rows, cols, S->wavelet.length);
+    float32_t *pTempL = S->pTemp;
+    float32_t *pTempH = S->pTemp + outRows * cols;
+
+    plp_idwt2d_pass_f32(S->pSrcA, S->pSrcH, 1, cols, rows, pTempL, 1, cols, outRows, cols, core_id,
+                       nPE, S->wavelet, pBuffer);
+    plp_idwt2d_pass_f32(S->pSrcV, S->pSrcD, 1, cols, rows, pTempH, 1, cols, outRows, cols, core_id,
+                       nPE, S->wavelet, pBuffer);
+
+    hal_team_barrier();
+
+    plp_idwt2d_pass_f32(pTempL, pTempH, cols, 1, cols, S->pDst, outCols, 1, outCols, outRows,
+                       core_id, nPE, S->wavelet, pBuffer);
+}
+
+/**
+   @} end of realDWTKernels group
+*/
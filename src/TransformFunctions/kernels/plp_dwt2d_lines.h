@@ -0,0 +1,645 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_dwt2d_lines.h
+ * Description:  Line passes of the 2D DWT through L1 with DMA
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+#include "plp_math.h"
+
+#ifndef __PLP_DWT2D_LINES_H
+#define __PLP_DWT2D_LINES_H
+
+/* Line Passes of the 2D DWT
+ * =========================
+ *
+ * The 2D DWT is separable: the 1D DWT is applied to every row and then to every column of the
+ * row pass result. A pass moves a tile of adjacent lines from L2 to the buffer of the core, filters
+ * each line with the 1D kernel and moves the results back. Line i of the input starts at
+ * pSrc + i * inLine and its samples are inStride values apart, the outputs are placed alike. For
+ * rows, the stride is 1 and a tile is a single line moved with a 1D transfer. For columns, the
+ * stride is the width of the matrix and a tile holds PLP_DWT2D_TILE_COLS adjacent columns, which
+ * are gathered and scattered by 2D transfers with one chunk of the tile width per matrix line, so
+ * the matrix never has to be transposed in L2. The columns of a tile are interleaved in L1, each
+ * one is copied to a line buffer before it is filtered and its results are copied back into the
+ * output tile.
+ *
+ * The next input tile is loaded while the current one is filtered, and the outputs are only
+ * waited for before the output tiles are reused. The buffer holds two input tiles followed by the
+ * output tiles and the line buffers, each rounded up to PLP_DWT2D_LINE_LENGTH values.
+ */
+
+static inline void plp_dwt2d_dma(uintptr_t ext,
+                                 uint32_t stride,
+                                 uint32_t count,
+                                 uint32_t size,
+                                 uintptr_t loc,
+                                 hal_cl_dma_dir_e dir,
+                                 hal_cl_dma_cmd_t *cmd) {
+    if (stride == size) {
+        hal_cl_dma_cmd(ext, loc, count * size, dir, 0, cmd);
+    } else {
+        hal_cl_dma_cmd_2d(ext, loc, count * size, stride, size, dir, 0, cmd);
+    }
+}
+
+/* Lines per tile: one row, or PLP_DWT2D_TILE_COLS adjacent columns */
+static inline uint32_t plp_dwt2d_tile(uint32_t stride) {
+    return stride == 1 ? 1 : PLP_DWT2D_TILE_COLS;
+}
+
+/* Lines in tile t of a pass over count lines, the last tile may be narrower */
+static inline uint32_t plp_dwt2d_width(uint32_t t, uint32_t tile, uint32_t count) {
+    return count - t * tile < tile ? count - t * tile : tile;
+}
+
+static inline void plp_dwt2d_line_f32(const float32_t *pSrc,
+                                      uint32_t length,
+                                      const plp_dwt_wavelet_f32 wavelet,
+                                      plp_dwt_extension_mode mode,
+                                      float32_t *pDstA,
+                                      float32_t *pDstD) {
+    switch (wavelet.type) {
+    case PLP_DWT_WAVELET_HAAR:
+    case PLP_DWT_WAVELET_DB1:
+        plp_dwt_haar_f32s_xpulpv2(pSrc, length, mode, pDstA, pDstD);
+        break;
+    default:
+        plp_dwt_f32s_xpulpv2(pSrc, length, wavelet, mode, pDstA, pDstD);
+        break;
+    }
+}
+
+static inline void plp_idwt2d_line_f32(const float32_t *pSrcA,
+                                       const float32_t *pSrcD,
+                                       uint32_t length,
+                                       const plp_dwt_wavelet_f32 wavelet,
+                                       float32_t *pDst) {
+    switch (wavelet.type) {
+    case PLP_DWT_WAVELET_HAAR:
+    case PLP_DWT_WAVELET_DB1:
+        plp_idwt_haar_f32s_xpulpv2(pSrcA, pSrcD, length, pDst);
+        break;
+    default:
+        plp_idwt_f32s_xpulpv2(pSrcA, pSrcD, length, wavelet, pDst);
+        break;
+    }
+}
+
+/* Decomposes the tiles first, first + step, ... of the count lines of pSrc into pDstA and pDstD */
+static inline void plp_dwt2d_pass_f32(const float32_t *pSrc,
+                                      uint32_t inLine,
+                                      uint32_t inStride,
+                                      uint32_t inLen,
+                                      float32_t *pDstA,
+                                      float32_t *pDstD,
+                                      uint32_t outLine,
+                                      uint32_t outStride,
+                                      uint32_t outLen,
+                                      uint32_t count,
+                                      uint32_t first,
+                                      uint32_t step,
+                                      const plp_dwt_wavelet_f32 wavelet,
+                                      plp_dwt_extension_mode mode,
+                                      float32_t *pBuffer) {
+    const uint32_t tile = plp_dwt2d_tile(inStride);
+    const uint32_t numTiles = (count + tile - 1) / tile;
+    float32_t *pIn[2] = { pBuffer, pBuffer + PLP_DWT2D_LINE_LENGTH(tile * inLen) };
+    float32_t *pOutA = pIn[1] + PLP_DWT2D_LINE_LENGTH(tile * inLen);
+    float32_t *pOutD = pOutA + PLP_DWT2D_LINE_LENGTH(tile * outLen);
+    float32_t *pLine = pOutD + PLP_DWT2D_LINE_LENGTH(tile * outLen);
+    float32_t *pLineA = pLine + PLP_DWT2D_LINE_LENGTH(inLen);
+    float32_t *pLineD = pLineA + PLP_DWT2D_LINE_LENGTH(outLen);
+    hal_cl_dma_cmd_t cmdIn, cmdA, cmdD;
+    uint32_t buf = 0;
+    uint32_t j, k;
+
+    if (first >= numTiles) {
+        return;
+    }
+
+    plp_dwt2d_dma((uintptr_t)(pSrc + first * tile * inLine), inStride * sizeof(float32_t), inLen,
+                  plp_dwt2d_width(first, tile, count) * sizeof(float32_t), (uintptr_t)pIn[0],
+                  HAL_CL_DMA_DIR_EXT2LOC, &cmdIn);
+
+    for (uint32_t t = first; t < numTiles; t += step) {
+        uint32_t width = plp_dwt2d_width(t, tile, count);
+
+        hal_cl_dma_cmd_wait(&cmdIn);
+        if (t + step < numTiles) {
+            plp_dwt2d_dma((uintptr_t)(pSrc + (t + step) * tile * inLine), inStride * sizeof(float32_t),
+                          inLen, plp_dwt2d_width(t + step, tile, count) * sizeof(float32_t),
+                          (uintptr_t)pIn[buf ^ 1], HAL_CL_DMA_DIR_EXT2LOC, &cmdIn);
+        }
+        if (t != first) {
+            hal_cl_dma_cmd_wait(&cmdA);
+            hal_cl_dma_cmd_wait(&cmdD);
+        }
+
+        if (width == 1) {
+            plp_dwt2d_line_f32(pIn[buf], inLen, wavelet, mode, pOutA, pOutD);
+        } else {
+            for (j = 0; j < width; j++) {
+                for (k = 0; k < inLen; k++) {
+                    pLine[k] = pIn[buf][k * width + j];
+                }
+                plp_dwt2d_line_f32(pLine, inLen, wavelet, mode, pLineA, pLineD);
+                for (k = 0; k < outLen; k++) {
+                    pOutA[k * width + j] = pLineA[k];
+                    pOutD[k * width + j] = pLineD[k];
+                }
+            }
+        }
+
+        plp_dwt2d_dma((uintptr_t)(pDstA + t * tile * outLine), outStride * sizeof(float32_t), outLen,
+                      width * sizeof(float32_t), (uintptr_t)pOutA, HAL_CL_DMA_DIR_LOC2EXT, &cmdA);
+        plp_dwt2d_dma((uintptr_t)(pDstD + t * tile * outLine), outStride * sizeof(float32_t), outLen,
+                      width * sizeof(float32_t), (uintptr_t)pOutD, HAL_CL_DMA_DIR_LOC2EXT, &cmdD);
+        buf ^= 1;
+    }
+
+    hal_cl_dma_cmd_wait(&cmdA);
+    hal_cl_dma_cmd_wait(&cmdD);
+}
+
+/* Reconstructs the tiles first, first + step, ... of the count lines of pDst from pSrcA and pSrcD */
+static inline void plp_idwt2d_pass_f32(const float32_t *pSrcA,
+                                       const float32_t *pSrcD,
+                                       uint32_t inLine,
+                                       uint32_t inStride,
+                                       uint32_t inLen,
+                                       float32_t *pDst,
+                                       uint32_t outLine,
+                                       uint32_t outStride,
+                                       uint32_t outLen,
+                                       uint32_t count,
+                                       uint32_t first,
+                                       uint32_t step,
+                                       const plp_dwt_wavelet_f32 wavelet,
+                                       float32_t *pBuffer) {
+    const uint32_t tile = plp_dwt2d_tile(inStride);
+    const uint32_t numTiles = (count + tile - 1) / tile;
+    const uint32_t tileLen = PLP_DWT2D_LINE_LENGTH(tile * inLen);
+    float32_t *pInA[2] = { pBuffer, pBuffer + 2 * tileLen };
+    float32_t *pInD[2] = { pInA[0] + tileLen, pInA[1] + tileLen };
+    float32_t *pOut = pBuffer + 4 * tileLen;
+    float32_t *pLineA = pOut + PLP_DWT2D_LINE_LENGTH(tile * outLen);
+    float32_t *pLineD = pLineA + PLP_DWT2D_LINE_LENGTH(inLen);
+    float32_t *pLine = pLineD + PLP_DWT2D_LINE_LENGTH(inLen);
+    hal_cl_dma_cmd_t cmdA, cmdD, cmdOut;
+    uint32_t buf = 0;
+    uint32_t j, k;
+
+    if (first >= numTiles) {
+        return;
+    }
+
+    plp_dwt2d_dma((uintptr_t)(pSrcA + first * tile * inLine), inStride * sizeof(float32_t), inLen,
+                  plp_dwt2d_width(first, tile, count) * sizeof(float32_t), (uintptr_t)pInA[0],
+                  HAL_CL_DMA_DIR_EXT2LOC, &cmdA);
+    plp_dwt2d_dma((uintptr_t)(pSrcD + first * tile * inLine), inStride * sizeof(float32_t), inLen,
+                  plp_dwt2d_width(first, tile, count) * sizeof(float32_t), (uintptr_t)pInD[0],
+                  HAL_CL_DMA_DIR_EXT2LOC, &cmdD);
+
+    for (uint32_t t = first; t < numTiles; t += step) {
+        uint32_t width = plp_dwt2d_width(t, tile, count);
+
+        hal_cl_dma_cmd_wait(&cmdA);
+        hal_cl_dma_cmd_wait(&cmdD);
+        if (t + step < numTiles) {
+            uint32_t next = plp_dwt2d_width(t + step, tile, count);
+            plp_dwt2d_dma((uintptr_t)(pSrcA + (t + step) * tile * inLine), inStride * sizeof(float32_t),
+                          inLen, next * sizeof(float32_t), (uintptr_t)pInA[buf ^ 1],
+                          HAL_CL_DMA_DIR_EXT2LOC, &cmdA);
+            plp_dwt2d_dma((uintptr_t)(pSrcD + (t + step) * tile * inLine), inStride * sizeof(float32_t),
+                          inLen, next * sizeof(float32_t), (uintptr_t)pInD[buf ^ 1],
+                          HAL_CL_DMA_DIR_EXT2LOC, &cmdD);
+        }
+        if (t != first) {
+            hal_cl_dma_cmd_wait(&cmdOut);
+        }
+
+        if (width == 1) {
+            plp_idwt2d_line_f32(pInA[buf], pInD[buf], outLen, wavelet, pOut);
+        } else {
+            for (j = 0; j < width; j++) {
+                for (k = 0; k < inLen; k++) {
+                    pLineA[k] = pInA[buf][k * width + j];
+                    pLineD[k] = pInD[buf][k * width + j];
+                }
+                plp_idwt2d_line_f32(pLineA, pLineD, outLen, wavelet, pLine);
+                for (k = 0; k < outLen; k++) {
+                    pOut[k * width + j] = pLine[k];
+                }
+            }
+        }
+
+        plp_dwt2d_dma((uintptr_t)(pDst + t * tile * outLine), outStride * sizeof(float32_t), outLen,
+                      width * sizeof(float32_t), (uintptr_t)pOut, HAL_CL_DMA_DIR_LOC2EXT, &cmdOut);
+        buf ^= 1;
+    }
+
+    hal_cl_dma_cmd_wait(&cmdOut);
+}
+
+static inline void plp_dwt2d_line_q16(const int16_t *pSrc,
+                                      uint32_t length,
+                                      const plp_dwt_wavelet_q16 wavelet,
+                                      plp_dwt_extension_mode mode,
+                                      int16_t *pDstA,
+                                      int16_t *pDstD) {
+    switch (wavelet.type) {
+    case PLP_DWT_WAVELET_HAAR:
+    case PLP_DWT_WAVELET_DB1:
+        plp_dwt_haar_q16s_xpulpv2(pSrc, length, mode, pDstA, pDstD);
+        break;
+    default:
+        plp_dwt_q16s_xpulpv2(pSrc, length, wavelet, mode, pDstA, pDstD);
+        break;
+    }
+}
+
+static inline void plp_idwt2d_line_q16(const int16_t *pSrcA,
+                                       const int16_t *pSrcD,
+                                       uint32_t length,
+                                       const plp_dwt_wavelet_q16 wavelet,
+                                       int16_t *pDst) {
+    switch (wavelet.type) {
+    case PLP_DWT_WAVELET_HAAR:
+    case PLP_DWT_WAVELET_DB1:
+        plp_idwt_haar_q16s_xpulpv2(pSrcA, pSrcD, length, pDst);
+        break;
+    default:
+        plp_idwt_q16s_xpulpv2(pSrcA, pSrcD, length, wavelet, pDst);
+        break;
+    }
+}
+
+/* Decomposes the tiles first, first + step, ... of the count lines of pSrc into pDstA and pDstD */
+static inline void plp_dwt2d_pass_q16(const int16_t *pSrc,
+                                      uint32_t inLine,
+                                      uint32_t inStride,
+                                      uint32_t inLen,
+                                      int16_t *pDstA,
+                                      int16_t *pDstD,
+                                      uint32_t outLine,
+                                      uint32_t outStride,
+                                      uint32_t outLen,
+                                      uint32_t count,
+                                      uint32_t first,
+                                      uint32_t step,
+                                      const plp_dwt_wavelet_q16 wavelet,
+                                      plp_dwt_extension_mode mode,
+                                      int16_t *pBuffer) {
+    const uint32_t tile = plp_dwt2d_tile(inStride);
+    const uint32_t numTiles = (count + tile - 1) / tile;
+    int16_t *pIn[2] = { pBuffer, pBuffer + PLP_DWT2D_LINE_LENGTH(tile * inLen) };
+    int16_t *pOutA = pIn[1] + PLP_DWT2D_LINE_LENGTH(tile * inLen);
+    int16_t *pOutD = pOutA + PLP_DWT2D_LINE_LENGTH(tile * outLen);
+    int16_t *pLine = pOutD + PLP_DWT2D_LINE_LENGTH(tile * outLen);
+    int16_t *pLineA = pLine + PLP_DWT2D_LINE_LENGTH(inLen);
+    int16_t *pLineD = pLineA + PLP_DWT2D_LINE_LENGTH(outLen);
+    hal_cl_dma_cmd_t cmdIn, cmdA, cmdD;
+    uint32_t buf = 0;
+    uint32_t j, k;
+
+    if (first >= numTiles) {
+        return;
+    }
+
+    plp_dwt2d_dma((uintptr_t)(pSrc + first * tile * inLine), inStride * sizeof(int16_t), inLen,
+                  plp_dwt2d_width(first, tile, count) * sizeof(int16_t), (uintptr_t)pIn[0],
+                  HAL_CL_DMA_DIR_EXT2LOC, &cmdIn);
+
+    for (uint32_t t = first; t < numTiles; t += step) {
+        uint32_t width = plp_dwt2d_width(t, tile, count);
+
+        hal_cl_dma_cmd_wait(&cmdIn);
+        if (t + step < numTiles) {
+            plp_dwt2d_dma((uintptr_t)(pSrc + (t + step) * tile * inLine), inStride * sizeof(int16_t),
+                          inLen, plp_dwt2d_width(t + step, tile, count) * sizeof(int16_t),
+                          (uintptr_t)pIn[buf ^ 1], HAL_CL_DMA_DIR_EXT2LOC, &cmdIn);
+        }
+        if (t != first) {
+            hal_cl_dma_cmd_wait(&cmdA);
+            hal_cl_dma_cmd_wait(&cmdD);
+        }
+
+        if (width == 1) {
+            plp_dwt2d_line_q16(pIn[buf], inLen, wavelet, mode, pOutA, pOutD);
+        } else {
+            for (j = 0; j < width; j++) {
+                for (k = 0; k < inLen; k++) {
+                    pLine[k] = pIn[buf][k * width + j];
+                }
+                plp_dwt2d_line_q16(pLine, inLen, wavelet, mode, pLineA, pLineD);
+                for (k = 0; k < outLen; k++) {
+                    pOutA[k * width + j] = pLineA[k];
+                    pOutD[k * width + j] = pLineD[k];
+                }
+            }
+        }
+
+        plp_dwt2d_dma((uintptr_t)(pDstA + t * tile * outLine), outStride * sizeof(int16_t), outLen,
+                      width * sizeof(int16_t), (uintptr_t)pOutA, HAL_CL_DMA_DIR_LOC2EXT, &cmdA);
+        plp_dwt2d_dma((uintptr_t)(pDstD + t * tile * outLine), outStride * sizeof(int16_t), outLen,
+                      width * sizeof(int16_t), (uintptr_t)pOutD, HAL_CL_DMA_DIR_LOC2EXT, &cmdD);
+        buf ^= 1;
+    }
+
+    hal_cl_dma_cmd_wait(&cmdA);
+    hal_cl_dma_cmd_wait(&cmdD);
+}
+
+/* Reconstructs the tiles first, first + step, ... of the count lines of pDst from pSrcA and pSrcD */
+static inline void plp_idwt2d_pass_q16(const int16_t *pSrcA,
+                                       const int16_t *pSrcD,
+                                       uint32_t inLine,
+                                       uint32_t inStride,
+                                       uint32_t inLen,
+                                       int16_t *pDst,
+                                       uint32_t outLine,
+                                       uint32_t outStride,
+                                       uint32_t outLen,
+                                       uint32_t count,
+                                       uint32_t first,
+                                       uint32_t step,
+                                       const plp_dwt_wavelet_q16 wavelet,
+                                       int16_t *pBuffer) {
+    const uint32_t tile = plp_dwt2d_tile(inStride);
+    const uint32_t numTiles = (count + tile - 1) / tile;
+    const uint32_t tileLen = PLP_DWT2D_LINE_LENGTH(tile * inLen);
+    int16_t *pInA[2] = { pBuffer, pBuffer + 2 * tileLen };
+    int16_t *pInD[2] = { pInA[0] + tileLen, pInA[1] + tileLen };
+    int16_t *pOut = pBuffer + 4 * tileLen;
+    int16_t *pLineA = pOut + PLP_DWT2D_LINE_LENGTH(tile * outLen);
+    int16_t *pLineD = pLineA + PLP_DWT2D_LINE_LENGTH(inLen);
+    int16_t *pLine = pLineD + PLP_DWT2D_LINE_LENGTH(inLen);
+    hal_cl_dma_cmd_t cmdA, cmdD, cmdOut;
+    uint32_t buf = 0;
+    uint32_t j, k;
+
+    if (first >= numTiles) {
+        return;
+    }
+
+    plp_dwt2d_dma((uintptr_t)(pSrcA + first * tile * inLine), inStride * sizeof(int16_t), inLen,
+                  plp_dwt2d_width(first, tile, count) * sizeof(int16_t), (uintptr_t)pInA[0],
+                  HAL_CL_DMA_DIR_EXT2LOC, &cmdA);
+    plp_dwt2d_dma((uintptr_t)(pSrcD + first * tile * inLine), inStride * sizeof(int16_t), inLen,
+                  plp_dwt2d_width(first, tile, count) * sizeof(int16_t), (uintptr_t)pInD[0],
+                  HAL_CL_DMA_DIR_EXT2LOC, &cmdD);
+
+    for (uint32_t t = first; t < numTiles; t += step) {
+        uint32_t width = plp_dwt2d_width(t, tile, count);
+
+        hal_cl_dma_cmd_wait(&cmdA);
+        hal_cl_dma_cmd_wait(&cmdD);
+        if (t + step < numTiles) {
+            uint32_t next = plp_dwt2d_width(t + step, tile, count);
+            plp_dwt2d_dma((uintptr_t)(pSrcA + (t + step) * tile * inLine), inStride * sizeof(int16_t),
+                          inLen, next * sizeof(int16_t), (uintptr_t)pInA[buf ^ 1],
+                          HAL_CL_DMA_DIR_EXT2LOC, &cmdA);
+            plp_dwt2d_dma((uintptr_t)(pSrcD + (t + step) * tile * inLine), inStride * sizeof(int16_t),
+                          inLen, next * sizeof(int16_t), (uintptr_t)pInD[buf ^ 1],
+                          HAL_CL_DMA_DIR_EXT2LOC, &cmdD);
+        }
+        if (t != first) {
+            hal_cl_dma_cmd_wait(&cmdOut);
+        }
+
+        if (width == 1) {
+            plp_idwt2d_line_q16(pInA[buf], pInD[buf], outLen, wavelet, pOut);
+        } else {
+            for (j = 0; j < width; j++) {
+                for (k = 0; k < inLen; k++) {
+                    pLineA[k] = pInA[buf][k * width + j];
+                    pLineD[k] = pInD[buf][k * width + j];
+                }
+                plp_idwt2d_line_q16(pLineA, pLineD, outLen, wavelet, pLine);
+                for (k = 0; k < outLen; k++) {
+                    pOut[k * width + j] = pLine[k];
+                }
+            }
+        }
+
+        plp_dwt2d_dma((uintptr_t)(pDst + t * tile * outLine), outStride * sizeof(int16_t), outLen,
+                      width * sizeof(int16_t), (uintptr_t)pOut, HAL_CL_DMA_DIR_LOC2EXT, &cmdOut);
+        buf ^= 1;
+    }
+
+    hal_cl_dma_cmd_wait(&cmdOut);
+}
+
+static inline void plp_dwt2d_line_q8(const int8_t *pSrc,
+                                      uint32_t length,
+                                      const plp_dwt_wavelet_q8 wavelet,
+                                      plp_dwt_extension_mode mode,
+                                      int8_t *pDstA,
+                                      int8_t *pDstD) {
+    switch (wavelet.type) {
+    case PLP_DWT_WAVELET_HAAR:
+    case PLP_DWT_WAVELET_DB1:
+        plp_dwt_haar_q8s_xpulpv2(pSrc, length, mode, pDstA, pDstD);
+        break;
+    default:
+        plp_dwt_q8s_xpulpv2(pSrc, length, wavelet, mode, pDstA, pDstD);
+        break;
+    }
+}
+
+static inline void plp_idwt2d_line_q8(const int8_t *pSrcA,
+                                       const int8_t *pSrcD,
+                                       uint32_t length,
+                                       const plp_dwt_wavelet_q8 wavelet,
+                                       int8_t *pDst) {
+    switch (wavelet.type) {
+    case PLP_DWT_WAVELET_HAAR:
+    case PLP_DWT_WAVELET_DB1:
+        plp_idwt_haar_q8s_xpulpv2(pSrcA, pSrcD, length, pDst);
+        break;
+    default:
+        plp_idwt_q8s_xpulpv2(pSrcA, pSrcD, length, wavelet, pDst);
+        break;
+    }
+}
+
+/* Decomposes the tiles first, first + step, ... of the count lines of pSrc into pDstA and pDstD */
+static inline void plp_dwt2d_pass_q8(const int8_t *pSrc,
+                                     uint32_t inLine,
+                                     uint32_t inStride,
+                                     uint32_t inLen,
+                                     int8_t *pDstA,
+                                     int8_t *pDstD,
+                                     uint32_t outLine,
+                                     uint32_t outStride,
+                                     uint32_t outLen,
+                                     uint32_t count,
+                                     uint32_t first,
+                                     uint32_t step,
+                                     const plp_dwt_wavelet_q8 wavelet,
+                                     plp_dwt_extension_mode mode,
+                                     int8_t *pBuffer) {
+    const uint32_t tile = plp_dwt2d_tile(inStride);
+    const uint32_t numTiles = (count + tile - 1) / tile;
+    int8_t *pIn[2] = { pBuffer, pBuffer + PLP_DWT2D_LINE_LENGTH(tile * inLen) };
+    int8_t *pOutA = pIn[1] + PLP_DWT2D_LINE_LENGTH(tile * inLen);
+    int8_t *pOutD = pOutA + PLP_DWT2D_LINE_LENGTH(tile * outLen);
+    int8_t *pLine = pOutD + PLP_DWT2D_LINE_LENGTH(tile * outLen);
+    int8_t *pLineA = pLine + PLP_DWT2D_LINE_LENGTH(inLen);
+    int8_t *pLineD = pLineA + PLP_DWT2D_LINE_LENGTH(outLen);
+    hal_cl_dma_cmd_t cmdIn, cmdA, cmdD;
+    uint32_t buf = 0;
+    uint32_t j, k;
+
+    if (first >= numTiles) {
+        return;
+    }
+
+    plp_dwt2d_dma((uintptr_t)(pSrc + first * tile * inLine), inStride * sizeof(int8_t), inLen,
+                  plp_dwt2d_width(first, tile, count) * sizeof(int8_t), (uintptr_t)pIn[0],
+                  HAL_CL_DMA_DIR_EXT2LOC, &cmdIn);
+
+    for (uint32_t t = first; t < numTiles; t += step) {
+        uint32_t width = plp_dwt2d_width(t, tile, count);
+
+        hal_cl_dma_cmd_wait(&cmdIn);
+        if (t + step < numTiles) {
+            plp_dwt2d_dma((uintptr_t)(pSrc + (t + step) * tile * inLine), inStride * sizeof(int8_t),
+                          inLen, plp_dwt2d_width(t + step, tile, count) * sizeof(int8_t),
+                          (uintptr_t)pIn[buf ^ 1], HAL_CL_DMA_DIR_EXT2LOC, &cmdIn);
+        }
+        if (t != first) {
+            hal_cl_dma_cmd_wait(&cmdA);
+            hal_cl_dma_cmd_wait(&cmdD);
+        }
+
+        if (width == 1) {
+            plp_dwt2d_line_q8(pIn[buf], inLen, wavelet, mode, pOutA, pOutD);
+        } else {
+            for (j = 0; j < width; j++) {
+                for (k = 0; k < inLen; k++) {
+                    pLine[k] = pIn[buf][k * width + j];
+                }
+                plp_dwt2d_line_q8(pLine, inLen, wavelet, mode, pLineA, pLineD);
+                for (k = 0; k < outLen; k++) {
+                    pOutA[k * width + j] = pLineA[k];
+                    pOutD[k * width + j] = pLineD[k];
+                }
+            }
+        }
+
+        plp_dwt2d_dma((uintptr_t)(pDstA + t * tile * outLine), outStride * sizeof(int8_t), outLen,
+                      width * sizeof(int8_t), (uintptr_t)pOutA, HAL_CL_DMA_DIR_LOC2EXT, &cmdA);
+        plp_dwt2d_dma((uintptr_t)(pDstD + t * tile * outLine), outStride * sizeof(int8_t), outLen,
+                      width * sizeof(int8_t), (uintptr_t)pOutD, HAL_CL_DMA_DIR_LOC2EXT, &cmdD);
+        buf ^= 1;
+    }
+
+    hal_cl_dma_cmd_wait(&cmdA);
+    hal_cl_dma_cmd_wait(&cmdD);
+}
+
+/* Reconstructs the tiles first, first + step, ... of the count lines of pDst from pSrcA and pSrcD */
+static inline void plp_idwt2d_pass_q8(const int8_t *pSrcA,
+                                      const int8_t *pSrcD,
+                                      uint32_t inLine,
+                                      uint32_t inStride,
+                                      uint32_t inLen,
+                                      int8_t *pDst,
+                                      uint32_t outLine,
+                                      uint32_t outStride,
+                                      uint32_t outLen,
+                                      uint32_t count,
+                                      uint32_t first,
+                                      uint32_t step,
+                                      const plp_dwt_wavelet_q8 wavelet,
+                                      int8_t *pBuffer) {
+    const uint32_t tile = plp_dwt2d_tile(inStride);
+    const uint32_t numTiles = (count + tile - 1) / tile;
+    const uint32_t tileLen = PLP_DWT2D_LINE_LENGTH(tile * inLen);
+    int8_t *pInA[2] = { pBuffer, pBuffer + 2 * tileLen };
+    int8_t *pInD[2] = { pInA[0] + tileLen, pInA[1] + tileLen };
+    int8_t *pOut = pBuffer + 4 * tileLen;
+    int8_t *pLineA = pOut + PLP_DWT2D_LINE_LENGTH(tile * outLen);
+    int8_t *pLineD = pLineA + PLP_DWT2D_LINE_LENGTH(inLen);
+    int8_t *pLine = pLineD + PLP_DWT2D_LINE_LENGTH(inLen);
+    hal_cl_dma_cmd_t cmdA, cmdD, cmdOut;
+    uint32_t buf = 0;
+    uint32_t j, k;
+
+    if (first >= numTiles) {
+        return;
+    }
+
+    plp_dwt2d_dma((uintptr_t)(pSrcA + first * tile * inLine), inStride * sizeof(int8_t), inLen,
+                  plp_dwt2d_width(first, tile, count) * sizeof(int8_t), (uintptr_t)pInA[0],
+                  HAL_CL_DMA_DIR_EXT2LOC, &cmdA);
+    plp_dwt2d_dma((uintptr_t)(pSrcD + first * tile * inLine), inStride * sizeof(int8_t), inLen,
+                  plp_dwt2d_width(first, tile, count) * sizeof(int8_t), (uintptr_t)pInD[0],
+                  HAL_CL_DMA_DIR_EXT2LOC, &cmdD);
+
+    for (uint32_t t = first; t < numTiles; t += step) {
+        uint32_t width = plp_dwt2d_width(t, tile, count);
+
+        hal_cl_dma_cmd_wait(&cmdA);
+        hal_cl_dma_cmd_wait(&cmdD);
+        if (t + step < numTiles) {
+            uint32_t next = plp_dwt2d_width(t + step, tile, count);
+            plp_dwt2d_dma((uintptr_t)(pSrcA + (t + step) * tile * inLine), inStride * sizeof(int8_t),
+                          inLen, next * sizeof(int8_t), (uintptr_t)pInA[buf ^ 1],
+                          HAL_CL_DMA_DIR_EXT2LOC, &cmdA);
+            plp_dwt2d_dma((uintptr_t)(pSrcD + (t + step) * tile * inLine), inStride * sizeof(int8_t),
+                          inLen, next * sizeof(int8_t), (uintptr_t)pInD[buf ^ 1],
+                          HAL_CL_DMA_DIR_EXT2LOC, &cmdD);
+        }
+        if (t != first) {
+            hal_cl_dma_cmd_wait(&cmdOut);
+        }
+
+        if (width == 1) {
+            plp_idwt2d_line_q8(pInA[buf], pInD[buf], outLen, wavelet, pOut);
+        } else {
+            for (j = 0; j < width; j++) {
+                for (k = 0; k < inLen; k++) {
+                    pLineA[k] = pInA[buf][k * width + j];
+                    pLineD[k] = pInD[buf][k * width + j];
+                }
+                plp_idwt2d_line_q8(pLineA, pLineD, outLen, wavelet, pLine);
+                for (k = 0; k < outLen; k++) {
+                    pOut[k * width + j] = pLine[k];
+                }
+            }
+        }
+
+        plp_dwt2d_dma((uintptr_t)(pDst + t * tile * outLine), outStride * sizeof(int8_t), outLen,
+                      width * sizeof(int8_t), (uintptr_t)pOut, HAL_CL_DMA_DIR_LOC2EXT, &cmdOut);
+        buf ^= 1;
+    }
+
+    hal_cl_dma_cmd_wait(&cmdOut);
+}
+
+#endif // __PLP_DWT2D_LINES_H
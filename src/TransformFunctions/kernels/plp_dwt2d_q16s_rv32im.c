@@ -0,0 +1,167 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_dwt2d_q16s_rv32im.c
+ * Description:  16bit Fixed-point 2D Discrete Wavelet Transform and its inverse
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+#include "plp_math.h"
+
+
+/**
+  @ingroup dwt
+ */
+
+/**
+  @addtogroup q16DWTKernels
+  @{
+ */
+
+static inline void plp_dwt2d_line_q16(const int16_t *pSrc,
+                                      uint32_t length,
+                                      const plp_dwt_wavelet_q16 wavelet,
+                                      plp_dwt_extension_mode mode,
+                                      int16_t *pDstA,
+                                      int16_t *pDstD) {
+    switch (wavelet.type) {
+    case PLP_DWT_WAVELET_HAAR:
+    case PLP_DWT_WAVELET_DB1:
+        plp_dwt_haar_q16s_rv32im(pSrc, length, mode, pDstA, pDstD);
+        break;
+    default:
+        plp_dwt_q16s_rv32im(pSrc, length, wavelet, mode, pDstA, pDstD);
+        break;
+    }
+}
+
+static inline void plp_idwt2d_line_q16(const int16_t *pSrcA,
+                                       const int16_t *pSrcD,
+                                       uint32_t length,
+                                       const plp_dwt_wavelet_q16 wavelet,
+                                       int16_t *pDst) {
+    switch (wavelet.type) {
+    case PLP_DWT_WAVELET_HAAR:
+    case PLP_DWT_WAVELET_DB1:
+        plp_idwt_haar_q16s_rv32im(pSrcA, pSrcD, length, pDst);
+        break;
+    default:
+        plp_idwt_q16s_rv32im(pSrcA, pSrcD, length, wavelet, pDst);
+        break;
+    }
+}
+
+/**
+   @brief  Q15 fixed-point 2D DWT of an image for RV32IM extension.
+
+   The rows are decomposed directly into the low and high pass halves of pTemp. Each column of
+   the halves is then copied to pBuffer, decomposed and copied to the output matrices, so that no
+   transposition of the whole matrix is needed.
+
+   @param[in]   S        points to the plp_dwt2d_instance_q16
+   @return      none
+*/
+void plp_dwt2d_q16s_rv32im(const plp_dwt2d_instance_q16 *S) {
+
+    const uint32_t rows = S->rows;
+    const uint32_t cols = S->cols;
+    const uint32_t outRows = PLP_DWT_OUTPUT_LENGTH(rows, S->wavelet.length);
+    const uint32_t outCols = PLP_DWT_OUTPUT_LENGTH(cols, S->wavelet.length);
+
+    int16_t *pTemp[2] = { S->pTemp, S->pTemp + rows * outCols };
+    int16_t *pDstA[2] = { S->pDstA, S->pDstV };
+    int16_t *pDstD[2] = { S->pDstH, S->pDstD };
+    int16_t *pOutA = S->pBuffer + PLP_DWT2D_LINE_LENGTH(rows);
+    int16_t *pOutD = pOutA + PLP_DWT2D_LINE_LENGTH(outRows);
+    uint32_t r, c, h;
+
+    for (r = 0; r < rows; r++) {
+        plp_dwt2d_line_q16(S->pSrc + r * cols, cols, S->wavelet, S->mode, pTemp[0] + r * outCols,
+                          pTemp[1] + r * outCols);
+    }
+
+    for (h = 0; h < 2; h++) {
+        for (c = 0; c < outCols; c++) {
+            for (r = 0; r < rows; r++) {
+                S->pBuffer[r] = pTemp[h][r * outCols + c];
+            }
+
+            plp_dwt2d_line_q16(S->pBuffer, rows, S->wavelet, S->mode, pOutA, pOutD);
+
+            for (r = 0; r < outRows; r++) {
+                pDstA[h][r * outCols + c] = pOutA[r];
+                pDstD[h][r * outCols + c] = pOutD[r];
+            }
+        }
+    }
+}
+
+/**
+   @brief  Q15 fixed-point inverse 2D DWT for RV32IM extension.
+
+   Each column of A and H (V and D) is copied to pBuffer and reconstructed into the low (high)
+   pass half of pTemp, then the rows of both halves are reconstructed into pDst.
+
+   @param[in]   S        points to the plp_idwt2d_instance_q16
+   @return      none
+*/
+void plp_idwt2d_q16s_rv32im(const plp_idwt2d_instance_q16 *S) {
+
+    const uint32_t rows = S->rows;
+    const uint32_t cols = S->cols;
+    const uint32_t outRows = PLP_IDWT_OUTPUT_LENGTH(rows, S->wavelet.length);
+    const uint32_t outCols = PLP_IDWT_OUTPUT_LENGTH(cols, S->wavelet.length);
+
+    int16_t *pTemp[2] = { S->pTemp, S->pTemp + outRows * cols };
+    const int16_t *pSrcA[2] = { S->pSrcA, S->pSrcV };
+    const int16_t *pSrcD[2] = { S->pSrcH, S->pSrcD };
+    int16_t *pInD = S->pBuffer + PLP_DWT2D_LINE_LENGTH(rows);
+    int16_t *pOut = pInD + PLP_DWT2D_LINE_LENGTH(rows);
+    uint32_t r, c, h;
+
+    for (h = 0; h < 2; h++) {
+        for (c = 0; c < cols; c++) {
+            for (r = 0; r < rows; r++) {
+                S->pBuffer[r] = pSrcA[h][r * cols + c];
+                pInD[r] = pSrcD[h][r * cols + c];
+            }
+
+            plp_idwt2d_line_q16(S->pBuffer, pInD, outRows, S->wavelet, pOut);
+
+            for (r = 0; r < outRows; r++) {
+                pTemp[h][r * cols + c] = pOut[r];
+            }
+        }
+    }
+
+    for (r = 0; r < outRows; r++) {
+        plp_idwt2d_line_q16(pTemp[0] + r * cols, pTemp[1] + r * cols, outCols, S->wavelet,
+                           S->pDst + r * outCols);
+    }
+}
+
+/**
+   @} end of q16DWTKernels group
+*/
@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_dwt2d_q16s_xpulpv2.c
+ * Description:  16bit Fixed-point 2D Discrete Wavelet Transform and its inverse
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+#include "plp_math.h"
+#include "plp_dwt2d_lines.h"
+
+
+/**
+  @ingroup dwt
+ */
+
+/**
+  @addtogroup q16DWTKernels
+  @{
+ */
+
+/**
+   @brief  Q15 fixed-point 2D DWT of an image for XPULPV2 extension.
+
+   The rows are decomposed into the low and high pass halves of pTemp, then the columns of each
+   half are decomposed into the output matrices. Lines are moved through pBuffer by DMA, the
+   columns in tiles with 2D transfers (see plp_dwt2d_lines.h).
+
+   @param[in]   S        points to the plp_dwt2d_instance_q16
+   @return      none
+*/
+void plp_dwt2d_q16s_xpulpv2(const plp_dwt2d_instance_q16 *S) {
+
+    const uint32_t rows = S->rows;
+    const uint32_t cols = S->cols;
+    const uint32_t outRows = PLP_DWT_OUTPUT_LENGTH(rows, S->wavelet.length);
+    const uint32_t outCols = PLP_DWT_OUTPUT_LENGTH(cols, S->wavelet.length);
+
+    int16_t *pTempL = S->pTemp;
+    int16_t *pTempH = S->pTemp + rows * outCols;
+
+    plp_dwt2d_pass_q16(S->pSrc, cols, 1, cols, pTempL, pTempH, outCols, 1, outCols, rows, 0, 1,
+                      S->wavelet, S->mode, S->pBuffer);
+
+    plp_dwt2d_pass_q16(pTempL, 1, outCols, rows, S->pDstA, S->pDstH, 1, outCols, outRows, outCols,
+                      0, 1, S->wavelet, S->mode, S->pBuffer);
+    plp_dwt2d_pass_q16(pTempH, 1, outCols, rows, S->pDstV, S->pDstD, 1, outCols, outRows, outCols,
+                      0, 1, S->wavelet, S->mode, S->pBuffer);
+}
+
+/**
+   @brief  Q15 fixed-point inverse 2D DWT for XPULPV2 extension.
+
+   The columns of A and H are reconstructed into the low pass half of pTemp and the columns of V
+   and D into the high pass half, then the rows of both halves are reconstructed into pDst.
+
+   @param[in]   S        points to the plp_idwt2d_instance_q16
+   @return      none
+*/
+void plp_idwt2d_q16s_xpulpv2(const plp_idwt2d_instance_q16 *S) {
+
+    const uint32_t rows = S->rows;
+    const uint32_t cols = S->cols;
+    const uint32_t outRows = PLP_IDWT_OUTPUT_LENGTH(rows, S->wavelet.length);
+    const uint32_t outCols = PLP_IDWT_OUTPUT_LENGTH(cols, S->wavelet.length);
+
+    int16_t *pTempL = S->pTemp;
+    int16_t *pTempH = S->pTemp + outRows * cols;
+
+    plp_idwt2d_pass_q16(S->pSrcA, S->pSrcH, 1, cols, rows, pTempL, 1, cols, outRows, cols, 0, 1,
+                       S->wavelet, S->pBuffer);
+    plp_idwt2d_pass_q16(S->pSrcV, S->pSrcD, 1, cols, rows, pTempH, 1, cols, outRows, cols, 0, 1,
+                       S->wavelet, S->pBuffer);
+
+    plp_idwt2d_pass_q16(pTempL, pTempH, cols, 1, cols, S->pDst, outCols, 1, outCols, outRows, 0, 1,
+                       S->wavelet, S->pBuffer);
+}
+
+/**
+   @} end of q16DWTKernels group
+*/
@@ -0,0 +1,217 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_dwt_dec_stream_f32p_xpulpv2.c
+ * Description:  Floating-point multilevel DWT streamed through L1 for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+#include "plp_dwt_extend.h"
+
+#define MAC(Acc, A, B) Acc += (A * B);
+
+/**
+  @ingroup dwt
+ */
+
+/**
+  @addtogroup realDWTKernels
+  @{
+ */
+
+/* Drops the window samples which are not needed anymore. At least wavelet.length samples are
+ * kept, such that the right edge extension can be computed from the window. */
+static inline void plp_dwt_stream_slide_f32(plp_dwt_stream_level_f32 *lv, uint32_t wlen) {
+    if (!lv->ready) {
+        return;
+    }
+
+    uint32_t drop = 2 * lv->next - lv->base;
+    if (lv->fill < wlen) {
+        drop = 0;
+    } else if (lv->fill - drop < wlen) {
+        drop = lv->fill - wlen;
+    }
+
+    if (drop > 0) {
+        for (uint32_t i = 0; i < lv->fill - drop; i++) {
+            lv->pWin[i] = lv->pWin[i + drop];
+        }
+        lv->base += drop;
+        lv->fill -= drop;
+    }
+}
+
+/* Accounts count new input samples of level l, adds the edge extensions once they can be computed
+ * and sets up the coefficients which can be computed in this step. Runs on core 0 only. */
+static void plp_dwt_stream_prepare_f32(plp_dwt_dec_stream_instance_f32 *S, uint32_t l,
+                                       uint32_t count) {
+    plp_dwt_stream_level_f32 *lv = &S->pLevels[l];
+    const uint32_t wlen = S->wavelet.length;
+
+    lv->fill += count;
+    lv->pushed += count;
+
+    /* The extended input starts with wavelet.length - 2 samples of left extension, for which
+     * window space is reserved when the level is set up. */
+    if (!lv->ready && lv->pushed >= (lv->inLen < wlen ? lv->inLen : wlen)) {
+        plp_dwt_extend_f32(lv->pWin + wlen - 2, 1, lv->inLen, S->mode, lv->pWin + wlen - 3, -1,
+                           wlen - 2);
+        lv->ready = 1;
+    }
+
+    /* The last coefficients read up to wavelet.length - 1 samples of right extension */
+    if (lv->ready && !lv->done && lv->pushed == lv->inLen) {
+        plp_dwt_extend_f32(lv->pWin + wlen - 3 + lv->inLen - lv->base, -1, lv->inLen, S->mode,
+                           lv->pWin + lv->fill, 1, wlen - 1);
+        lv->fill += wlen - 1;
+        lv->done = 1;
+    }
+
+    /* Coefficient i reads the extended input from 2i to 2i + wavelet.length - 1 */
+    uint32_t end = 0;
+    if (lv->ready && lv->base + lv->fill + 2 > wlen) {
+        end = (lv->base + lv->fill + 2 - wlen) >> 1;
+        if (end > lv->outLen) {
+            end = lv->outLen;
+        }
+    }
+
+    S->count = end > lv->next ? end - lv->next : 0;
+    S->pIn = lv->pWin + 2 * lv->next - lv->base;
+    S->pOutD = lv->pDstD + lv->next;
+
+    if (l + 1 == S->levels) {
+        S->pOutA = S->pDstA + lv->next;
+    } else {
+        // The Approximate coefficients are the input of the next level
+        plp_dwt_stream_level_f32 *nl = &S->pLevels[l + 1];
+        plp_dwt_stream_slide_f32(nl, wlen);
+        S->pOutA = nl->pWin + nl->fill;
+    }
+}
+
+/**
+   @brief  Floating-point streaming n-level DWT for XPULPV2 extension.
+
+   Runs all the levels of the decomposition in a single pass over the input. The input is
+   loaded tile by tile into L1 with the cluster DMA, while the previous tile is processed. Every
+   tile is filtered through all the levels before the next one: the Approximate coefficients of
+   a level are written directly into the window of the next level, which only keeps the samples
+   that are still needed by its filter. Core 0 loads the tiles and updates the level state, the
+   coefficients of every step are interleaved between the cores.
+
+   @param[in]   args     points to the plp_dwt_dec_stream_instance_f32
+   @return      none
+*/
+void plp_dwt_dec_stream_f32p_xpulpv2(void *args) {
+
+    plp_dwt_dec_stream_instance_f32 *S = (plp_dwt_dec_stream_instance_f32 *)args;
+
+    const uint32_t core_id = hal_core_id();
+    const uint32_t nPE = S->nPE;
+    const uint32_t levels = S->levels;
+    const uint32_t tileLen = S->tileLen;
+    const uint32_t numTiles = (S->length + tileLen - 1) / tileLen;
+    const plp_dwt_wavelet_f32 wavelet = S->wavelet;
+
+    hal_cl_dma_cmd_t load;
+    uint32_t count = 0;
+
+    for (uint32_t t = 0; t < numTiles; t++) {
+
+        if (core_id == 0) {
+            uint32_t offset = t * tileLen;
+
+            count = S->length - offset < tileLen ? S->length - offset : tileLen;
+
+            if (t == 0) {
+                hal_cl_dma_cmd((uintptr_t)S->pSrc, (uintptr_t)S->pTile[0],
+                               sizeof(float32_t) * count, HAL_CL_DMA_DIR_EXT2LOC, 0, &load);
+            }
+            hal_cl_dma_cmd_wait(&load);
+
+            /* prefetch the next tile into the other buffer */
+            if (t + 1 < numTiles) {
+                uint32_t nextOffset = offset + tileLen;
+                uint32_t nextCount =
+                    S->length - nextOffset < tileLen ? S->length - nextOffset : tileLen;
+
+                hal_cl_dma_cmd((uintptr_t)(S->pSrc + nextOffset), (uintptr_t)S->pTile[(t + 1) & 1],
+                               sizeof(float32_t) * nextCount, HAL_CL_DMA_DIR_EXT2LOC, 0, &load);
+            }
+
+            plp_dwt_stream_slide_f32(&S->pLevels[0], wavelet.length);
+            S->pIn = S->pTile[t & 1];
+            S->pOutA = S->pLevels[0].pWin + S->pLevels[0].fill;
+            S->count = count;
+        }
+        hal_team_barrier();
+
+        // Append the tile to the window of the first level
+        const uint32_t tileCount = S->count;
+        for (uint32_t i = core_id; i < tileCount; i += nPE) {
+            S->pOutA[i] = S->pIn[i];
+        }
+
+        for (uint32_t l = 0; l < levels; l++) {
+
+            hal_team_barrier();
+            if (core_id == 0) {
+                plp_dwt_stream_prepare_f32(S, l, count);
+            }
+            hal_team_barrier();
+
+            const float32_t *pIn = S->pIn;
+            float32_t *pOutA = S->pOutA;
+            float32_t *pOutD = S->pOutD;
+            const uint32_t n = S->count;
+
+            for (uint32_t i = core_id; i < n; i += nPE) {
+                const float32_t *pS = pIn + 2 * i + wavelet.length - 1;
+                float32_t sum_lo = 0.0f;
+                float32_t sum_hi = 0.0f;
+
+                for (uint32_t j = 0; j < wavelet.length; j++) {
+                    MAC(sum_lo, wavelet.dec_lo[j], *pS);
+                    MAC(sum_hi, wavelet.dec_hi[j], *pS--);
+                }
+
+                pOutA[i] = sum_lo;
+                pOutD[i] = sum_hi;
+            }
+
+            if (core_id == 0) {
+                count = n;
+                S->pLevels[l].next += n;
+            }
+        }
+        hal_team_barrier();
+    }
+}
+
+/**
+   @} end of realDWTKernels group
+*/
@@ -0,0 +1,121 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_dwt_extend.h
+ * Description:  Edge extension of a DWT input into a buffer
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+#ifndef __PLP_DWT_EXTEND_H
+#define __PLP_DWT_EXTEND_H
+
+/* Edge Extension into a Buffer
+ * ============================
+ *
+ * Writes the samples beyond one edge of a signal, in the same order as the macros in
+ * plp_dwt_signal_ext.h visit them. This is used where the extension cannot be computed on demand
+ * because the signal is not available as one buffer (e.g. when it is streamed).
+ *
+ * pEdge points to the edge sample and stride walks into the signal: pEdge[k * stride] is the
+ * k-th sample from the edge. For the left edge pEdge = x and stride = 1, for the right edge
+ * pEdge = x + length - 1 and stride = -1. The k-th sample beyond the edge is written to
+ * pExt[k * extStride]. Samples further than length from the edge are only read for short
+ * signals, which wrap around several times.
+ */
+static inline void plp_dwt_extend_f32(const float32_t *pEdge,
+                                      int32_t stride,
+                                      uint32_t length,
+                                      plp_dwt_extension_mode mode,
+                                      float32_t *pExt,
+                                      int32_t extStride,
+                                      uint32_t count) {
+    int32_t j = 0;
+    int32_t k;
+    const int32_t len = (int32_t)length;
+    const int32_t cnt = (int32_t)count;
+    float32_t edge = pEdge[0];
+    float32_t tmp = 0.0f;
+
+    switch (mode) {
+    case PLP_DWT_MODE_CONSTANT:
+        for (; j < cnt; j++) {
+            pExt[j * extStride] = edge;
+        }
+        break;
+    case PLP_DWT_MODE_SYMMETRIC:
+        while (j < cnt) {
+            for (k = 0; k < len && j < cnt; k++, j++) {
+                pExt[j * extStride] = pEdge[k * stride];
+            }
+            for (k = 0; k < len && j < cnt; k++, j++) {
+                pExt[j * extStride] = pEdge[(len - 1 - k) * stride];
+            }
+        }
+        break;
+    case PLP_DWT_MODE_REFLECT:
+        while (j < cnt) {
+            for (k = 1; k < len && j < cnt; k++, j++) {
+                pExt[j * extStride] = pEdge[k * stride];
+            }
+            for (k = 1; k < len && j < cnt; k++, j++) {
+                pExt[j * extStride] = pEdge[(len - 1 - k) * stride];
+            }
+        }
+        break;
+    case PLP_DWT_MODE_ANTISYMMETRIC:
+        while (j < cnt) {
+            for (k = 0; k < len && j < cnt; k++, j++) {
+                pExt[j * extStride] = -pEdge[k * stride];
+            }
+            for (k = 0; k < len && j < cnt; k++, j++) {
+                pExt[j * extStride] = pEdge[(len - 1 - k) * stride];
+            }
+        }
+        break;
+    case PLP_DWT_MODE_ANTIREFLECT:
+        while (j < cnt) {
+            for (k = 1; k < len && j < cnt; k++, j++) {
+                tmp = edge - (pEdge[k * stride] - pEdge[0]);
+                pExt[j * extStride] = tmp;
+            }
+            edge = tmp;
+            for (k = 1; k < len && j < cnt; k++, j++) {
+                tmp = edge + (pEdge[(len - 1 - k) * stride] - pEdge[(len - 1) * stride]);
+                pExt[j * extStride] = tmp;
+            }
+            edge = tmp;
+        }
+        break;
+    case PLP_DWT_MODE_PERIODIC:
+    case PLP_DWT_MODE_ZERO:
+    default:
+        for (; j < cnt; j++) {
+            pExt[j * extStride] = 0.0f;
+        }
+        break;
+    }
+}
+
+#endif // __PLP_DWT_EXTEND_H
@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_idwt_q16s_rv32im.c
+ * Description:  16bit Fixed-point inverse Discrete Wavelet Transform
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+#define HAAR_COEF ((int32_t) 0x5a82)
+
+#define MAC_SHIFT 15U
+
+#define MAC(Acc, A, B) Acc += ((int32_t)A * (int32_t)B);
+
+
+/**
+  @ingroup dwt
+ */
+
+/**
+  @addtogroup q16DWTKernels
+  @{
+ */
+
+/**
+   @brief  Q15 fixed-point inverse DWT.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   length of the output buffer
+   @param[in]   wavelet  orthogonal wavelet structure the coefficients were computed with
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
+   @return      none
+*/
+void plp_idwt_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                  const int16_t *__restrict__ pSrcD,
+                  uint32_t length,
+                  const plp_dwt_wavelet_q16 wavelet,
+                  int16_t *__restrict__ pDst) {
+
+    /***
+     * Every pair of outputs is the sum of the upsampled coefficients filtered by the
+     * reconstruction filters, which are the time reversed decomposition filters:
+     *
+     *  x[2m]     = sum_t A[m + t] * dec_lo[2t + 1] + D[m + t] * dec_hi[2t + 1]
+     *  x[2m + 1] = sum_t A[m + t] * dec_lo[2t]     + D[m + t] * dec_hi[2t]
+     *
+     *  The coefficients cover the whole output, so no boundary extension is needed.
+     */
+    for(uint32_t m = 0; 2 * m < length; m += 1){
+        int32_t sum_even = 0;
+        int32_t sum_odd = 0;
+
+        const int16_t *pA = pSrcA + m;
+        const int16_t *pD = pSrcD + m;
+
+        for(uint32_t filt_j = 0; filt_j < wavelet.length; filt_j += 2){
+            MAC(sum_even, wavelet.dec_lo[filt_j + 1], *pA);
+            MAC(sum_even, wavelet.dec_hi[filt_j + 1], *pD);
+            MAC(sum_odd, wavelet.dec_lo[filt_j], *pA++);
+            MAC(sum_odd, wavelet.dec_hi[filt_j], *pD++);
+        }
+
+        pDst[2 * m] = (int16_t)(sum_even >> MAC_SHIFT);
+        if(2 * m + 1 < length){
+            pDst[2 * m + 1] = (int16_t)(sum_odd >> MAC_SHIFT);
+        }
+    }
+}
+
+/**
+   @brief  Q15 fixed-point inverse DWT kernel optimized for Haar Wavelet.
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   length of the output buffer
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
+   @return      none
+*/
+void plp_idwt_haar_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                       const int16_t *__restrict__ pSrcD,
+                       uint32_t length,
+                       int16_t *__restrict__ pDst) {
+
+    /***
+     * x[2m] = c * (A[m] + D[m]), x[2m + 1] = c * (A[m] - D[m]) with c = 1/sqrt(2)
+     */
+    for(uint32_t m = 0; 2 * m < length; m += 1){
+        pDst[2 * m] = (int16_t)((HAAR_COEF * ((int32_t)pSrcA[m] + pSrcD[m])) >> MAC_SHIFT);
+        if(2 * m + 1 < length){
+            pDst[2 * m + 1] = (int16_t)((HAAR_COEF * ((int32_t)pSrcA[m] - pSrcD[m])) >> MAC_SHIFT);
+        }
+    }
+}
+
+/**
+   @} end of q16DWTKernels group
+*/
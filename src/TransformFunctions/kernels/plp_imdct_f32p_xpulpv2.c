@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_imdct_f32p_xpulpv2.c
+ * Description:  Parallel floating-point IMDCT for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+#include "plp_mdct_common.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Parallel floating-point IMDCT for XPULPV2
+ *
+ * The passes before and after the FFT are split in blocks across the cores, and the complex FFT
+ * runs on the whole team in between. All output samples are written before the overlap is
+ * replaced. See plp_imdct_f32s_xpulpv2 for the algorithm.
+ *
+ * @param[in]  args       points to the plp_mdct_instance_f32_parallel
+ */
+void plp_imdct_f32p_xpulpv2(void *args) {
+
+    plp_mdct_instance_f32_parallel *a = (plp_mdct_instance_f32_parallel *)args;
+    const plp_dct_plan_f32 *plan = a->S->plan;
+    uint32_t M = plan->len;
+    uint32_t core_id = hal_core_id();
+    uint32_t first, last;
+    float32_t scale = 2.0f / (float32_t)M;
+
+    plp_cfft_instance_f32_parallel cfftArgs = { .S = (plp_cfft_instance_f32 *)&plan->fft.S,
+                                                .pSrc = a->pBuf,
+                                                .ifftFlag = 0,
+                                                .bitReverseFlag = 1,
+                                                .nPE = a->nPE };
+
+    plp_dct_range(M / 2, core_id, a->nPE, &first, &last);
+    plp_dct4_pre_f32(plan, a->pSrc, a->pBuf, first, last);
+    hal_team_barrier();
+
+    plp_cfft_f32p_xpulpv2((void *)&cfftArgs);
+    hal_team_barrier();
+
+    plp_imdct_output_f32(a->S, a->pBuf, scale, a->pDst, first, last);
+    hal_team_barrier();
+
+    plp_imdct_overlap_f32(a->S, a->pBuf, scale, first, last);
+    hal_team_barrier();
+}
+
+/**
+ * @} end of FFT group
+ */
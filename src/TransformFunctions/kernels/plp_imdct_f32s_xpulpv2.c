@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_imdct_f32s_xpulpv2.c
+ * Description:  Floating-point IMDCT for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+#include "plp_mdct_common.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Floating-point IMDCT for XPULPV2
+ *
+ * The coefficients go through the DCT-IV of M points on an FFT of M/2 points. Its output rotation
+ * is applied while the frame is unfolded, windowed and added to the overlap, first for the output
+ * samples, which read the old overlap, and then for the new overlap.
+ *
+ * @param[in,out]  S      points to the instance
+ * @param[in]      pSrc   points to the M coefficients
+ * @param[in]      pBuf   points to a work buffer of M values
+ * @param[out]     pDst   points to the M output samples
+ */
+void plp_imdct_f32s_xpulpv2(plp_mdct_instance_f32 *S,
+                            const float32_t *__restrict__ pSrc,
+                            float32_t *__restrict__ pBuf,
+                            float32_t *__restrict__ pDst) {
+
+    const plp_dct_plan_f32 *plan = S->plan;
+    uint32_t M = plan->len;
+    float32_t scale = 2.0f / (float32_t)M;
+
+    plp_dct4_pre_f32(plan, pSrc, pBuf, 0, M / 2);
+    plp_cfft_f32s_xpulpv2(&plan->fft.S, pBuf, 0, 1);
+    plp_imdct_output_f32(S, pBuf, scale, pDst, 0, M / 2);
+    plp_imdct_overlap_f32(S, pBuf, scale, 0, M / 2);
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_imdct_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit fixed-point IMDCT for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+#include "plp_mdct_common.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Parallel 16-bit fixed-point IMDCT for XPULPV2
+ *
+ * The passes before and after the FFT are split in blocks across the cores, and the block floating
+ * point FFT runs on the whole team in between, with the headroom buffer set up by the glue code.
+ * The buffer first combines the largest coefficient of the cores before the FFT uses it. All output
+ * samples are written before the overlap is replaced. See plp_imdct_q16s_xpulpv2 for the
+ * algorithm.
+ *
+ * @param[in]  args       points to the plp_mdct_instance_q16_parallel
+ */
+void plp_imdct_q16p_xpulpv2(void *args) {
+
+    plp_mdct_instance_q16_parallel *a = (plp_mdct_instance_q16_parallel *)args;
+    const plp_dct_plan_q16 *plan = a->S->plan;
+    uint32_t M = plan->len;
+    uint32_t core_id = hal_core_id();
+    uint32_t first, last, maxAbs, i;
+    int32_t norm, shift;
+
+    plp_dct_range(M, core_id, a->nPE, &first, &last);
+    a->fft.pHeadroom[core_id] = plp_imdct_max_q16(a->pSrc, first, last);
+    hal_team_barrier();
+
+    maxAbs = 0;
+    for (i = 0; i < a->nPE; i++) {
+        maxAbs = a->fft.pHeadroom[i] > maxAbs ? a->fft.pHeadroom[i] : maxAbs;
+    }
+    norm = plp_imdct_norm_q16(maxAbs);
+
+    plp_dct_range(M / 2, core_id, a->nPE, &first, &last);
+    plp_imdct_pre_q16(plan, a->pSrc, norm, a->pBuf, first, last);
+    hal_team_barrier();
+
+    plp_cfft_bfp_q16p_xpulpv2((void *)&a->fft);
+    hal_team_barrier();
+
+    shift = plp_imdct_shift_q16(a->fft.exponent, norm);
+    plp_imdct_output_q16(a->S, a->pBuf, shift, a->pDst, first, last);
+    hal_team_barrier();
+
+    plp_imdct_overlap_q16(a->S, a->pBuf, shift, first, last);
+    hal_team_barrier();
+}
+
+/**
+ * @} end of FFT group
+ */
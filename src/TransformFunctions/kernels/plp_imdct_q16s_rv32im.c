@@ -0,0 +1,74 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_imdct_q16s_rv32im.c
+ * Description:  16-bit fixed-point IMDCT for RV32IM
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+#include "plp_mdct_common.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      16-bit fixed-point IMDCT for RV32IM
+ *
+ * The coefficients are scaled up to the full range and go through the DCT-IV of M points on the
+ * block floating point FFT of M/2 points, whose exponent sets the shift of its output back to Q15. The output rotation is applied
+ * while the frame is unfolded, windowed and added to the overlap, first for the output samples,
+ * which read the old overlap, and then for the new overlap.
+ *
+ * @param[in,out]  S      points to the instance
+ * @param[in]      pSrc   points to the M coefficients
+ * @param[in]      pBuf   points to a work buffer of M values
+ * @param[out]     pDst   points to the M output samples
+ */
+void plp_imdct_q16s_rv32im(plp_mdct_instance_q16 *S,
+                           const int16_t *__restrict__ pSrc,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *__restrict__ pDst) {
+
+    const plp_dct_plan_q16 *plan = S->plan;
+    uint32_t M = plan->len;
+    int32_t norm, exponent, shift;
+
+    norm = plp_imdct_norm_q16(plp_imdct_max_q16(pSrc, 0, M));
+    plp_imdct_pre_q16(plan, pSrc, norm, pBuf, 0, M / 2);
+    exponent = plp_cfft_bfp_q16s_rv32im(&plan->fft.S, pBuf, 1);
+    shift = plp_imdct_shift_q16(exponent, norm);
+    plp_imdct_output_q16(S, pBuf, shift, pDst, 0, M / 2);
+    plp_imdct_overlap_q16(S, pBuf, shift, 0, M / 2);
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,147 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_irfft_f32p_xpulpv2.c
+ * Description:  Floating-point parallel inverse FFT with real output for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+  @ingroup fft
+ */
+
+/**
+  @addtogroup realIFFTKernels
+  @{
+ */
+
+/**
+   @brief  Floating-point inverse FFT with real output for XPULPV2 extension (parallel version).
+   @param[in]   arg     points to an instance of plp_fft_instance_f32_parallel
+   @return      none
+*/
+void plp_irfft_f32p_xpulpv2(void *arg) {
+    plp_fft_instance_f32 *S = ((plp_fft_instance_f32_parallel *)arg)->S;
+    const float32_t *pSrc = ((plp_fft_instance_f32_parallel *)arg)->pSrc;
+    const uint32_t nPE = ((plp_fft_instance_f32_parallel *)arg)->nPE;
+    float32_t *pDst = ((plp_fft_instance_f32_parallel *)arg)->pDst;
+
+    const Complex_type_f32 *pX = (const Complex_type_f32 *)pSrc;
+    const Complex_type_f32 *pTw = (const Complex_type_f32 *)S->pTwiddleFactors;
+    Complex_type_f32 *pZ = (Complex_type_f32 *)pDst;
+    uint32_t core_id = hal_core_id();
+    uint32_t fftLen = S->FFTLength >> 1;
+    float32_t scale = 1.0f / S->FFTLength;
+    Complex_type_f32 a, b, e, d, tw;
+    uint32_t k, j, span, dist, log2Dist, stride, rev, bit, first, last, step;
+
+    // Z[k] = (X[k] + conj(X[M - k])) + j W_N^-k (X[k] - conj(X[M - k])) is the spectrum of
+    // x[2n] + j x[2n + 1], stored conjugated and scaled so that a forward FFT inverts it
+    step = (fftLen + nPE - 1) / nPE;
+    first = core_id * step;
+    last = MIN(fftLen, first + step);
+    for (k = first; k < last; k++) {
+        a = pX[k];
+        b = pX[fftLen - k];
+        if (k == 0) {
+            // the DC and Nyquist bins of a real sequence are real, ignore their imaginary parts
+            a.im = 0.0f;
+            b.im = 0.0f;
+        }
+        tw = pTw[k];
+        e.re = a.re + b.re;
+        e.im = a.im - b.im;
+        d.re = a.re - b.re;
+        d.im = a.im + b.im;
+        pZ[k].re = scale * (e.re + tw.im * d.re - tw.re * d.im);
+        pZ[k].im = -scale * (e.im + tw.im * d.im + tw.re * d.re);
+    }
+    hal_team_barrier();
+
+    // radix-2 decimation in frequency, W_M^d = W_N^(2d), the fftLen / 2 butterflies of each
+    // stage are split over the cores
+    for (log2Dist = 0; (2U << log2Dist) < fftLen; log2Dist++)
+        ;
+    step = ((fftLen >> 1) + nPE - 1) / nPE;
+    first = core_id * step;
+    last = MIN(fftLen >> 1, first + step);
+    stride = 2;
+    for (span = fftLen; span > 1; span >>= 1) {
+        dist = span >> 1;
+        for (k = first; k < last; k++) {
+            j = ((k >> log2Dist) << (log2Dist + 1)) + (k & (dist - 1));
+            a = pZ[j];
+            b = pZ[j + dist];
+            tw = pTw[(k & (dist - 1)) * stride];
+            pZ[j].re = a.re + b.re;
+            pZ[j].im = a.im + b.im;
+            e.re = a.re - b.re;
+            e.im = a.im - b.im;
+            pZ[j + dist].re = e.re * tw.re - e.im * tw.im;
+            pZ[j + dist].im = e.re * tw.im + e.im * tw.re;
+        }
+        stride <<= 1;
+        log2Dist--;
+        hal_team_barrier();
+    }
+
+    // bit reversal, the conjugation gives back x[2n] and x[2n + 1]. Each pair of samples is
+    // swapped by the core owning the lower index.
+    step = (fftLen + nPE - 1) / nPE;
+    first = core_id * step;
+    last = MIN(fftLen, first + step);
+    rev = 0;
+    for (bit = fftLen >> 1, j = 1; bit > 0; bit >>= 1, j <<= 1) {
+        if (first & j) {
+            rev |= bit;
+        }
+    }
+    for (k = first; k < last; k++) {
+        if (rev > k) {
+            a = pZ[k];
+            b = pZ[rev];
+            pZ[k].re = b.re;
+            pZ[k].im = -b.im;
+            pZ[rev].re = a.re;
+            pZ[rev].im = -a.im;
+        } else if (rev == k) {
+            pZ[k].im = -pZ[k].im;
+        }
+        bit = fftLen >> 1;
+        while (rev & bit) {
+            rev ^= bit;
+            bit >>= 1;
+        }
+        rev |= bit;
+    }
+    hal_team_barrier();
+}
+
+/**
+   @} end of realIFFTKernels group
+*/
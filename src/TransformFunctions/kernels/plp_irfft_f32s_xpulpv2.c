@@ -0,0 +1,135 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_irfft_f32s_xpulpv2.c
+ * Description:  Floating-point inverse FFT with real output for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup fft
+ */
+
+/**
+  @defgroup realIFFTKernels Inverse FFT kernels with real output values
+  These kernels calculate the inverse FFT of the spectrum of a real sequence of FFTLen values.
+  Only the non-negative frequencies are read, the others follow from the conjugate symmetry
+  of the spectrum, and the imaginary parts of the DC and Nyquist bins are ignored. The even and
+  odd output samples are computed together as the real and imaginary parts of a single complex
+  inverse FFT of (FFTLen / 2) points, so that the cost is about half the one of a complex inverse
+  FFT of FFTLen points.
+  The output is scaled by 1/FFTLen, i.e., the kernels invert the corresponding real FFT kernels.
+  The input buffer is not modified, the output buffer is used for intermediate computations.
+*/
+
+/**
+  @addtogroup realIFFTKernels
+  @{
+ */
+
+/**
+   @brief  Floating-point inverse FFT with real output for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer of (FFTLength / 2 + 1) complex values,
+                        as computed by plp_rfft_f32
+   @param[out]  pDst    points to the output buffer of FFTLength real values
+   @return      none
+*/
+void plp_irfft_f32s_xpulpv2(const plp_fft_instance_f32 *S,
+                            const float32_t *__restrict__ pSrc,
+                            float32_t *__restrict__ pDst) {
+    const Complex_type_f32 *pX = (const Complex_type_f32 *)pSrc;
+    const Complex_type_f32 *pTw = (const Complex_type_f32 *)S->pTwiddleFactors;
+    Complex_type_f32 *pZ = (Complex_type_f32 *)pDst;
+    uint32_t fftLen = S->FFTLength >> 1;
+    float32_t scale = 1.0f / S->FFTLength;
+    Complex_type_f32 a, b, e, d, tw;
+    uint32_t k, j, span, dist, stride, rev, bit;
+
+    // Z[k] = (X[k] + conj(X[M - k])) + j W_N^-k (X[k] - conj(X[M - k])) is the spectrum of
+    // x[2n] + j x[2n + 1], stored conjugated and scaled so that a forward FFT inverts it
+    for (k = 0; k < fftLen; k++) {
+        a = pX[k];
+        b = pX[fftLen - k];
+        if (k == 0) {
+            // the DC and Nyquist bins of a real sequence are real, ignore their imaginary parts
+            a.im = 0.0f;
+            b.im = 0.0f;
+        }
+        tw = pTw[k];
+        e.re = a.re + b.re;
+        e.im = a.im - b.im;
+        d.re = a.re - b.re;
+        d.im = a.im + b.im;
+        pZ[k].re = scale * (e.re + tw.im * d.re - tw.re * d.im);
+        pZ[k].im = -scale * (e.im + tw.im * d.im + tw.re * d.re);
+    }
+
+    // radix-2 decimation in frequency, W_M^d = W_N^(2d)
+    stride = 2;
+    for (span = fftLen; span > 1; span >>= 1) {
+        dist = span >> 1;
+        for (j = 0; j < fftLen; j += span) {
+            for (k = 0; k < dist; k++) {
+                a = pZ[j + k];
+                b = pZ[j + k + dist];
+                tw = pTw[k * stride];
+                pZ[j + k].re = a.re + b.re;
+                pZ[j + k].im = a.im + b.im;
+                e.re = a.re - b.re;
+                e.im = a.im - b.im;
+                pZ[j + k + dist].re = e.re * tw.re - e.im * tw.im;
+                pZ[j + k + dist].im = e.re * tw.im + e.im * tw.re;
+            }
+        }
+        stride <<= 1;
+    }
+
+    // bit reversal, the conjugation gives back x[2n] and x[2n + 1]
+    rev = 0;
+    for (k = 0; k < fftLen; k++) {
+        if (rev > k) {
+            a = pZ[k];
+            b = pZ[rev];
+            pZ[k].re = b.re;
+            pZ[k].im = -b.im;
+            pZ[rev].re = a.re;
+            pZ[rev].im = -a.im;
+        } else if (rev == k) {
+            pZ[k].im = -pZ[k].im;
+        }
+        bit = fftLen >> 1;
+        while (rev & bit) {
+            rev ^= bit;
+            bit >>= 1;
+        }
+        rev |= bit;
+    }
+}
+
+/**
+   @} end of realIFFTKernels group
+*/
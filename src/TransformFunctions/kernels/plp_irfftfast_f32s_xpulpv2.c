@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_irfftfast_f32s_xpulpv2.c
+ * Description:  Floating-point inverse FFT with real output for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup fft
+ */
+
+/**
+  @addtogroup realIFFTKernels
+  @{
+ */
+
+/**
+   @brief  Floating-point inverse FFT with real output for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer of FFTLengthRFFT values, as computed by
+                        plp_rfftfast_f32: the real parts of the bins 0 and FFTLengthRFFT / 2,
+                        followed by the bins 1 .. (FFTLengthRFFT / 2 - 1)
+   @param[out]  pDst    points to the output buffer of FFTLengthRFFT real values
+   @return      none
+*/
+void plp_irfftfast_f32s_xpulpv2(const plp_fft_fast_instance_f32 *S,
+                                const float32_t *__restrict__ pSrc,
+                                float32_t *__restrict__ pDst) {
+    const Complex_type_f32 *pX = (const Complex_type_f32 *)pSrc;
+    const Complex_type_f32 *pTw = (const Complex_type_f32 *)S->pTwiddleFactorsRFFT;
+    Complex_type_f32 *pZ = (Complex_type_f32 *)pDst;
+    uint32_t fftLen = S->Sint->fftLen;
+    float32_t scale = 1.0f / S->FFTLengthRFFT;
+    Complex_type_f32 a, b, e, d, tw;
+    uint32_t k;
+
+    // the bins 0 and N/2 are real and packed together
+    pZ[0].re = scale * (pSrc[0] + pSrc[1]);
+    pZ[0].im = -scale * (pSrc[0] - pSrc[1]);
+
+    // Z[k] = (X[k] + conj(X[M - k])) - conj(TW[k]) (X[k] - conj(X[M - k])) is the spectrum of
+    // x[2n] + j x[2n + 1], stored conjugated and scaled so that a forward FFT inverts it
+    for (k = 1; k < fftLen; k++) {
+        a = pX[k];
+        b = pX[fftLen - k];
+        tw = pTw[k];
+        e.re = a.re + b.re;
+        e.im = a.im - b.im;
+        d.re = a.re - b.re;
+        d.im = a.im + b.im;
+        pZ[k].re = scale * (e.re - tw.re * d.re - tw.im * d.im);
+        pZ[k].im = -scale * (e.im - tw.re * d.im + tw.im * d.re);
+    }
+
+    plp_cfft_f32s_xpulpv2(S->Sint, pDst, 0, 1);
+
+    // the conjugation gives back x[2n] and x[2n + 1]
+    for (k = 0; k < fftLen; k++) {
+        pZ[k].im = -pZ[k].im;
+    }
+}
+
+/**
+   @} end of realIFFTKernels group
+*/
@@ -0,0 +1,335 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mdct_common.h
+ * Description:  Folding and overlap-add passes of the MDCT and IMDCT
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+#include "plp_dct_common.h"
+
+#ifndef __PLP_MDCT_COMMON_H
+#define __PLP_MDCT_COMMON_H
+
+/* The MDCT of the windowed frame z = (a, b, c, d) of 2M samples, in blocks of M/2, is the DCT-IV
+   of the M folded samples u = (-c_R - d, a - b_R), where _R reverses a block. The folding and the
+   window are applied while the DCT-IV pre-twiddle writes the FFT input of M/2 points, the first
+   half of u only reads the new input block and the second half only the previous one (pState).
+
+   The IMDCT of M coefficients is y[n] = g[n + M/2] for n < M/2, -g[3M/2 - 1 - n] for
+   M/2 <= n < 3M/2 and -g[n - 3M/2] above, with g the DCT-IV of the coefficients. The samples
+   g[q], q >= M/2, only fall into the first half of y, which is windowed and added to the overlap
+   to give the output, and the samples q < M/2 only into the second half, which becomes the new
+   overlap. The DCT-IV post-twiddle gives g[2k] and g[M-1-2k], one of each half, so that the two
+   halves are computed in two passes over k, the first one reading the old overlap and the second
+   one replacing it. */
+
+/* ---------------------------------------------------------------------------------------------
+   Floating point
+   --------------------------------------------------------------------------------------------- */
+
+/* Folded sample u[n] of the windowed frame (pState, pSrc) */
+static inline float32_t plp_mdct_fold_f32(const plp_mdct_instance_f32 *S,
+                                          const float32_t *pSrc,
+                                          uint32_t n) {
+    uint32_t M = S->plan->len;
+    const float32_t *pW = S->pWindow;
+    uint32_t i0, i1;
+
+    if (n < M / 2) {
+        /* -c_R - d */
+        i0 = 3 * (M / 2) - 1 - n;
+        i1 = 3 * (M / 2) + n;
+        return -pW[i0] * pSrc[i0 - M] - pW[i1] * pSrc[i1 - M];
+    } else {
+        /* a - b_R */
+        i0 = n - M / 2;
+        i1 = 3 * (M / 2) - 1 - n;
+        return pW[i0] * S->pState[i0] - pW[i1] * S->pState[i1];
+    }
+}
+
+/* MDCT: DCT-IV input t[j] = (u[2j] + j u[M-1-2j]) e^(-j pi (4j+1)/(4M)), j = first .. last - 1 */
+static inline void plp_mdct_pre_f32(const plp_mdct_instance_f32 *S,
+                                    const float32_t *pSrc,
+                                    float32_t *pBuf,
+                                    uint32_t first,
+                                    uint32_t last) {
+    uint32_t M = S->plan->len;
+    uint32_t j;
+    float32_t a, b, c, s;
+
+    for (j = first; j < last; j++) {
+        a = plp_mdct_fold_f32(S, pSrc, 2 * j);
+        b = plp_mdct_fold_f32(S, pSrc, M - 1 - 2 * j);
+        c = S->plan->pPre[2 * j];
+        s = S->plan->pPre[2 * j + 1];
+        pBuf[2 * j] = a * c - b * s;
+        pBuf[2 * j + 1] = b * c + a * s;
+    }
+}
+
+/* MDCT: the new input block becomes the previous one, n = first .. last - 1 */
+static inline void plp_mdct_save_f32(const plp_mdct_instance_f32 *S,
+                                     const float32_t *pSrc,
+                                     uint32_t first,
+                                     uint32_t last) {
+    uint32_t n;
+
+    for (n = first; n < last; n++) {
+        S->pState[n] = pSrc[n];
+    }
+}
+
+/* IMDCT: sample g[q] of the DCT-IV from the FFT output, q = 2k or M-1-2k */
+static inline float32_t plp_imdct_g_f32(const plp_mdct_instance_f32 *S,
+                                        const float32_t *pBuf,
+                                        uint32_t k,
+                                        uint32_t q) {
+    float32_t tr = pBuf[2 * k];
+    float32_t ti = pBuf[2 * k + 1];
+    float32_t c = S->plan->pPost[2 * k];
+    float32_t s = S->plan->pPost[2 * k + 1];
+
+    return (q == 2 * k) ? c * tr - s * ti : -(c * ti + s * tr);
+}
+
+/* IMDCT: output samples from the first half of the frame and the old overlap, k = first .. last - 1 */
+static inline void plp_imdct_output_f32(const plp_mdct_instance_f32 *S,
+                                        const float32_t *pBuf,
+                                        float32_t scale,
+                                        float32_t *pDst,
+                                        uint32_t first,
+                                        uint32_t last) {
+    uint32_t M = S->plan->len;
+    const float32_t *pW = S->pWindow;
+    uint32_t k, q, n0, n1;
+    float32_t g;
+
+    for (k = first; k < last; k++) {
+        q = (2 * k >= M / 2) ? 2 * k : M - 1 - 2 * k;
+        g = scale * plp_imdct_g_f32(S, pBuf, k, q);
+        n0 = q - M / 2;
+        n1 = 3 * (M / 2) - 1 - q;
+        pDst[n0] = S->pState[n0] + pW[n0] * g;
+        pDst[n1] = S->pState[n1] - pW[n1] * g;
+    }
+}
+
+/* IMDCT: new overlap from the second half of the frame, k = first .. last - 1 */
+static inline void plp_imdct_overlap_f32(const plp_mdct_instance_f32 *S,
+                                         const float32_t *pBuf,
+                                         float32_t scale,
+                                         uint32_t first,
+                                         uint32_t last) {
+    uint32_t M = S->plan->len;
+    const float32_t *pW = S->pWindow;
+    uint32_t k, q;
+    float32_t g;
+
+    for (k = first; k < last; k++) {
+        q = (2 * k < M / 2) ? 2 * k : M - 1 - 2 * k;
+        g = scale * plp_imdct_g_f32(S, pBuf, k, q);
+        S->pState[M / 2 - 1 - q] = -pW[3 * (M / 2) - 1 - q] * g;
+        S->pState[M / 2 + q] = -pW[3 * (M / 2) + q] * g;
+    }
+}
+
+/* ---------------------------------------------------------------------------------------------
+   16-bit fixed point, window and data in Q15
+   --------------------------------------------------------------------------------------------- */
+
+/* Folded sample u[n]/2 in Q15 */
+static inline int32_t plp_mdct_fold_q16(const plp_mdct_instance_q16 *S,
+                                        const int16_t *pSrc,
+                                        uint32_t n) {
+    uint32_t M = S->plan->len;
+    const int16_t *pW = S->pWindow;
+    uint32_t i0, i1;
+
+    if (n < M / 2) {
+        i0 = 3 * (M / 2) - 1 - n;
+        i1 = 3 * (M / 2) + n;
+        return (-pW[i0] * pSrc[i0 - M] - pW[i1] * pSrc[i1 - M] + (1 << 15)) >> 16;
+    } else {
+        i0 = n - M / 2;
+        i1 = 3 * (M / 2) - 1 - n;
+        return (pW[i0] * S->pState[i0] - pW[i1] * S->pState[i1] + (1 << 15)) >> 16;
+    }
+}
+
+/* MDCT: t[j]/4, so that the FFT of M/2 points followed by the DCT-IV post-twiddle gives the
+   MDCT divided by the frame length 2M */
+static inline void plp_mdct_pre_q16(const plp_mdct_instance_q16 *S,
+                                    const int16_t *pSrc,
+                                    int16_t *pBuf,
+                                    uint32_t first,
+                                    uint32_t last) {
+    uint32_t M = S->plan->len;
+    uint32_t j;
+    int32_t a, b, c, s;
+
+    for (j = first; j < last; j++) {
+        a = plp_mdct_fold_q16(S, pSrc, 2 * j);
+        b = plp_mdct_fold_q16(S, pSrc, M - 1 - 2 * j);
+        c = S->plan->pPre[2 * j];
+        s = S->plan->pPre[2 * j + 1];
+        pBuf[2 * j] = (int16_t)((a * c + b * s + (1 << 15)) >> 16);
+        pBuf[2 * j + 1] = (int16_t)((b * c - a * s + (1 << 15)) >> 16);
+    }
+}
+
+static inline void plp_mdct_save_q16(const plp_mdct_instance_q16 *S,
+                                     const int16_t *pSrc,
+                                     uint32_t first,
+                                     uint32_t last) {
+    uint32_t n;
+
+    for (n = first; n < last; n++) {
+        S->pState[n] = pSrc[n];
+    }
+}
+
+/* IMDCT: largest magnitude of the coefficients n = first .. last - 1 */
+static inline uint32_t plp_imdct_max_q16(const int16_t *pSrc, uint32_t first, uint32_t last) {
+    uint32_t maxAbs = 0;
+    uint32_t n;
+    int32_t x;
+
+    for (n = first; n < last; n++) {
+        x = pSrc[n];
+        x = x < 0 ? -x : x;
+        maxAbs = (uint32_t)x > maxAbs ? (uint32_t)x : maxAbs;
+    }
+    return maxAbs;
+}
+
+/* IMDCT: number of left shifts that keep the largest coefficient in Q15 */
+static inline int32_t plp_imdct_norm_q16(uint32_t maxAbs) {
+    int32_t norm = 0;
+
+    while (norm < 15 && (maxAbs << (norm + 1)) <= 0x7FFF) {
+        norm++;
+    }
+    return norm;
+}
+
+/* IMDCT: DCT-IV pre-twiddle of the coefficients scaled up by 2^norm, t[j] 2^(norm - 1). The
+   coefficients of plp_mdct_q16 are quiet, and their precision would be lost here before the block
+   floating point FFT could scale them up. */
+static inline void plp_imdct_pre_q16(const plp_dct_plan_q16 *plan,
+                                     const int16_t *pSrc,
+                                     int32_t norm,
+                                     int16_t *pBuf,
+                                     uint32_t first,
+                                     uint32_t last) {
+    uint32_t N = plan->len;
+    uint32_t n;
+    int32_t a, b, c, s;
+
+    for (n = first; n < last; n++) {
+        a = pSrc[2 * n] * (1 << norm);
+        b = pSrc[N - 1 - 2 * n] * (1 << norm);
+        c = plan->pPre[2 * n];
+        s = plan->pPre[2 * n + 1];
+        pBuf[2 * n] = (int16_t)((a * c + b * s + (1 << 15)) >> 16);
+        pBuf[2 * n + 1] = (int16_t)((b * c - a * s + (1 << 15)) >> 16);
+    }
+}
+
+/* IMDCT: right shift of the rotated block floating point FFT output in Q30 to y in Q15. The
+   coefficients are the MDCT divided by 2M and the FFT input t 2^(norm - 1) has the DFT
+   p1 2^exponent, so that y = 2/M 2M g = Re(p1 P) 2^(exponent + 3 - norm). */
+static inline int32_t plp_imdct_shift_q16(int32_t exponent, int32_t norm) {
+    return 12 + norm - exponent;
+}
+
+/* IMDCT: y saturated to +-2 in Q15. A frame sample and its alias add up to twice the input range,
+   and the product with the window still fits in 32 bits. */
+static inline int32_t plp_imdct_sat_y_q16(int32_t x) {
+    return x > 0xFFFF ? 0xFFFF : (x < -0xFFFF ? -0xFFFF : x);
+}
+
+/* IMDCT: sample y in Q15 from the block floating point FFT output, saturated */
+static inline int32_t plp_imdct_y_q16(const plp_mdct_instance_q16 *S,
+                                      const int16_t *pBuf,
+                                      uint32_t k,
+                                      uint32_t q,
+                                      int32_t shift) {
+    int32_t tr = pBuf[2 * k];
+    int32_t ti = pBuf[2 * k + 1];
+    int32_t c = S->plan->pPost[2 * k];
+    int32_t s = S->plan->pPost[2 * k + 1];
+    int32_t g = (q == 2 * k) ? c * tr + s * ti : s * tr - c * ti;
+
+    if (shift > 30) {
+        return 0;
+    }
+    if (shift > 0) {
+        return plp_imdct_sat_y_q16((g + (1 << (shift - 1))) >> shift);
+    }
+    return plp_imdct_sat_y_q16(plp_dct_sat_q32((int64_t)g << (shift < -16 ? 16 : -shift)));
+}
+
+static inline void plp_imdct_output_q16(const plp_mdct_instance_q16 *S,
+                                        const int16_t *pBuf,
+                                        int32_t shift,
+                                        int16_t *pDst,
+                                        uint32_t first,
+                                        uint32_t last) {
+    uint32_t M = S->plan->len;
+    const int16_t *pW = S->pWindow;
+    uint32_t k, q, n0, n1;
+    int32_t y;
+
+    for (k = first; k < last; k++) {
+        q = (2 * k >= M / 2) ? 2 * k : M - 1 - 2 * k;
+        y = plp_imdct_y_q16(S, pBuf, k, q, shift);
+        n0 = q - M / 2;
+        n1 = 3 * (M / 2) - 1 - q;
+        pDst[n0] = plp_dct_sat_q16(2 * S->pState[n0] + ((pW[n0] * y + (1 << 14)) >> 15));
+        pDst[n1] = plp_dct_sat_q16(2 * S->pState[n1] - ((pW[n1] * y + (1 << 14)) >> 15));
+    }
+}
+
+/* IMDCT: overlap stored halved, the windowed frame goes up to 1.21 in Q15 for the sine window */
+static inline void plp_imdct_overlap_q16(const plp_mdct_instance_q16 *S,
+                                         const int16_t *pBuf,
+                                         int32_t shift,
+                                         uint32_t first,
+                                         uint32_t last) {
+    uint32_t M = S->plan->len;
+    const int16_t *pW = S->pWindow;
+    uint32_t k, q;
+    int32_t y;
+
+    for (k = first; k < last; k++) {
+        q = (2 * k < M / 2) ? 2 * k : M - 1 - 2 * k;
+        y = plp_imdct_y_q16(S, pBuf, k, q, shift);
+        S->pState[M / 2 - 1 - q] = plp_dct_sat_q16(-((pW[3 * (M / 2) - 1 - q] * y + (1 << 15)) >> 16));
+        S->pState[M / 2 + q] = plp_dct_sat_q16(-((pW[3 * (M / 2) + q] * y + (1 << 15)) >> 16));
+    }
+}
+
+#endif // __PLP_MDCT_COMMON_H
@@ -0,0 +1,70 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mdct_f32s_xpulpv2.c
+ * Description:  Floating-point MDCT for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+#include "plp_mdct_common.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Floating-point MDCT for XPULPV2
+ *
+ * The windowed frame is folded into the M inputs of a DCT-IV and rotated while it is written into
+ * the FFT buffer of M/2 complex values, and the output rotation is applied while the FFT output
+ * is read. The folding reads the previous block before it is replaced by pSrc.
+ *
+ * @param[in,out]  S      points to the instance
+ * @param[in]      pSrc   points to the M new input samples
+ * @param[in]      pBuf   points to a work buffer of M values
+ * @param[out]     pDst   points to the M coefficients
+ */
+void plp_mdct_f32s_xpulpv2(plp_mdct_instance_f32 *S,
+                           const float32_t *__restrict__ pSrc,
+                           float32_t *__restrict__ pBuf,
+                           float32_t *__restrict__ pDst) {
+
+    const plp_dct_plan_f32 *plan = S->plan;
+    uint32_t M = plan->len;
+
+    plp_mdct_pre_f32(S, pSrc, pBuf, 0, M / 2);
+    plp_mdct_save_f32(S, pSrc, 0, M);
+    plp_cfft_f32s_xpulpv2(&plan->fft.S, pBuf, 0, 1);
+    plp_dct4_post_f32(plan, pBuf, 1.0f, pDst, 0, M / 2);
+}
+
+/**
+ * @} end of FFT group
+ */
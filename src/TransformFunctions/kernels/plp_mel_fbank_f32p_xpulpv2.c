@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mel_fbank_f32p_xpulpv2.c
+ * Description:  Parallel floating-point mel filterbank energies
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup feature
+ * @{
+ */
+
+/**
+ * @brief      Parallel floating-point mel filterbank energies for XPULPV2
+ *
+ * The filters are distributed round-robin, so that every core gets filters from the whole mel
+ * range and the lengths, which grow with the frequency, stay balanced. Each core walks the filter
+ * lengths to find the coefficients of its filters.
+ *
+ * @param[in]  args  points to the plp_mel_fbank_instance_f32_parallel
+ */
+void plp_mel_fbank_f32p_xpulpv2(void *args) {
+
+    plp_mel_fbank_instance_f32_parallel *a = (plp_mel_fbank_instance_f32_parallel *)args;
+    const plp_triangular_filter_f32 *filterBank = a->filterBank;
+    const float32_t *pV = filterBank->V;
+    uint32_t core_id = hal_core_id();
+    uint32_t m, j;
+
+    for (m = 0; m < core_id && m < filterBank->nFilters; m++) {
+        pV += filterBank->filterLength[m];
+    }
+
+    for (m = core_id; m < filterBank->nFilters; m += a->nPE) {
+        const float32_t *pX = a->pSrc + 2 * filterBank->firstValue[m];
+        uint32_t len = filterBank->filterLength[m];
+        float32_t sum = 0.0f;
+
+        for (j = 0; j < len; j++) {
+            float32_t re = pX[2 * j];
+            float32_t im = pX[2 * j + 1];
+            sum += pV[j] * (re * re + im * im);
+        }
+        a->pDst[m] = sum;
+
+        for (j = m; j < m + a->nPE && j < filterBank->nFilters; j++) {
+            pV += filterBank->filterLength[j];
+        }
+    }
+}
+
+/**
+ * @} end of feature group
+ */
@@ -0,0 +1,75 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mel_fbank_f32s_xpulpv2.c
+ * Description:  Floating-point mel filterbank energies of a complex spectrum
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup feature
+ * @{
+ */
+
+/**
+ * @brief      Floating-point mel filterbank energies for XPULPV2
+ *
+ * Every filter accumulates the squared magnitudes of its bins as they are loaded, so the power
+ * spectrum is never stored. The bins shared by two neighbouring filters are squared twice, which
+ * is cheaper than a separate pass over the spectrum.
+ *
+ * @param[in]  filterBank  points to plp_triangular_filter_f32 instance
+ * @param[in]  pSrc        points to the complex spectrum
+ * @param[out] pDst        points to the nFilters energies
+ */
+void plp_mel_fbank_f32s_xpulpv2(const plp_triangular_filter_f32 *filterBank,
+                                const float32_t *__restrict__ pSrc,
+                                float32_t *__restrict__ pDst) {
+
+    const float32_t *pV = filterBank->V;
+    uint32_t m, j;
+
+    for (m = 0; m < filterBank->nFilters; m++) {
+        const float32_t *pX = pSrc + 2 * filterBank->firstValue[m];
+        uint32_t len = filterBank->filterLength[m];
+        float32_t sum = 0.0f;
+
+        for (j = 0; j < len; j++) {
+            float32_t re = pX[2 * j];
+            float32_t im = pX[2 * j + 1];
+            sum += pV[j] * (re * re + im * im);
+        }
+        pDst[m] = sum;
+        pV += len;
+    }
+}
+
+/**
+ * @} end of feature group
+ */
@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mel_fbank_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit fixed-point mel filterbank energies
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup feature
+ * @{
+ */
+
+/**
+ * @brief      Parallel 16-bit fixed-point mel filterbank energies for XPULPV2
+ *
+ * The filters are distributed round-robin as in plp_mel_fbank_f32p_xpulpv2, each computed as in
+ * plp_mel_fbank_q16s_xpulpv2.
+ *
+ * @param[in]  args  points to the plp_mel_fbank_instance_q16_parallel
+ */
+void plp_mel_fbank_q16p_xpulpv2(void *args) {
+
+    plp_mel_fbank_instance_q16_parallel *a = (plp_mel_fbank_instance_q16_parallel *)args;
+    const plp_triangular_filter_q16 *filterBank = a->filterBank;
+    const int16_t *pV = filterBank->V;
+    uint32_t core_id = hal_core_id();
+    uint32_t m, j;
+
+    for (m = 0; m < core_id && m < filterBank->nFilters; m++) {
+        pV += filterBank->filterLength[m];
+    }
+
+    for (m = core_id; m < filterBank->nFilters; m += a->nPE) {
+        const v2s *pX = (const v2s *)(a->pSrc + 2 * filterBank->firstValue[m]);
+        uint32_t len = filterBank->filterLength[m];
+        uint64_t sum = 0;
+
+        for (j = 0; j < len; j++) {
+            v2s x = pX[j];
+            uint32_t pw = (uint32_t)__DOTP2(x, x);
+            sum += (uint64_t)pw * (uint16_t)pV[j];
+        }
+        sum >>= 14;
+        a->pDst[m] = sum > 0x7FFFFFFF ? 0x7FFFFFFF : (int32_t)sum;
+
+        for (j = m; j < m + a->nPE && j < filterBank->nFilters; j++) {
+            pV += filterBank->filterLength[j];
+        }
+    }
+}
+
+/**
+ * @} end of feature group
+ */
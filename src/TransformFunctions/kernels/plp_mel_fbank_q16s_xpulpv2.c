@@ -0,0 +1,76 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mel_fbank_q16s_xpulpv2.c
+ * Description:  16-bit fixed-point mel filterbank energies of a complex spectrum
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup feature
+ * @{
+ */
+
+/**
+ * @brief      16-bit fixed-point mel filterbank energies for XPULPV2
+ *
+ * The squared magnitude of a bin is a single packed dot product of the bin with itself, Q30 read
+ * as unsigned. Weighted by the Q15 coefficients, it is accumulated in Q45 in 64 bits and returned
+ * in Q31.
+ *
+ * @param[in]  filterBank  points to plp_triangular_filter_q16 instance
+ * @param[in]  pSrc        points to the complex spectrum in Q15, word aligned
+ * @param[out] pDst        points to the nFilters energies in Q31
+ */
+void plp_mel_fbank_q16s_xpulpv2(const plp_triangular_filter_q16 *filterBank,
+                                const int16_t *__restrict__ pSrc,
+                                int32_t *__restrict__ pDst) {
+
+    const int16_t *pV = filterBank->V;
+    uint32_t m, j;
+
+    for (m = 0; m < filterBank->nFilters; m++) {
+        const v2s *pX = (const v2s *)(pSrc + 2 * filterBank->firstValue[m]);
+        uint32_t len = filterBank->filterLength[m];
+        uint64_t sum = 0;
+
+        for (j = 0; j < len; j++) {
+            v2s x = pX[j];
+            uint32_t pw = (uint32_t)__DOTP2(x, x);
+            sum += (uint64_t)pw * (uint16_t)pV[j];
+        }
+        sum >>= 14;
+        pDst[m] = sum > 0x7FFFFFFF ? 0x7FFFFFFF : (int32_t)sum;
+        pV += len;
+    }
+}
+
+/**
+ * @} end of feature group
+ */
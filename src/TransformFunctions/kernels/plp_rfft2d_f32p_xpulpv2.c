@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft2d_f32p_xpulpv2.c
+ * Description:  Parallel floating-point 2D FFT of real input for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Parallel floating-point 2D FFT of real input for XPULPV2
+ *
+ * Every core transforms whole rows, then whole columns out of 0 .. cols/2 through its slice of
+ * <code>2*rows</code> values of pBuffer, and finally copies the conjugated columns of its rows.
+ *
+ * @param[in]  args  points to the plp_rfft2d_instance_f32_parallel
+ */
+void plp_rfft2d_f32p_xpulpv2(void *args) {
+
+    plp_rfft2d_instance_f32_parallel *a = (plp_rfft2d_instance_f32_parallel *)args;
+    uint32_t C = a->SRow->FFTLength;
+    uint32_t R = a->SCol->fftLen;
+    uint32_t nPE = a->nPE;
+    uint32_t core_id = hal_core_id();
+    float32_t *pDst = a->pDst;
+    float32_t *pBuffer = a->pBuffer + 2 * R * core_id;
+    float32_t *pCol, *pMirror;
+    uint32_t r, c;
+
+    for (r = core_id; r < R; r += nPE) {
+        plp_rfft_f32s_xpulpv2(a->SRow, a->pSrc + C * r, pDst + 2 * C * r);
+    }
+    hal_team_barrier();
+
+    for (c = core_id; c <= C / 2; c += nPE) {
+        pCol = pDst + 2 * c;
+        for (r = 0; r < R; r++) {
+            pBuffer[2 * r] = pCol[2 * C * r];
+            pBuffer[2 * r + 1] = pCol[2 * C * r + 1];
+        }
+
+        plp_cfft_f32s_xpulpv2(a->SCol, pBuffer, 0, 1);
+
+        for (r = 0; r < R; r++) {
+            pCol[2 * C * r] = pBuffer[2 * r];
+            pCol[2 * C * r + 1] = pBuffer[2 * r + 1];
+        }
+    }
+    hal_team_barrier();
+
+    for (r = core_id; r < R; r += nPE) {
+        pMirror = pDst + 2 * C * ((R - r) % R);
+        for (c = C / 2 + 1; c < C; c++) {
+            pDst[2 * (C * r + c)] = pMirror[2 * (C - c)];
+            pDst[2 * (C * r + c) + 1] = -pMirror[2 * (C - c) + 1];
+        }
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
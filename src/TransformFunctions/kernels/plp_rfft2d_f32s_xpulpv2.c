@@ -0,0 +1,94 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft2d_f32s_xpulpv2.c
+ * Description:  Floating-point 2D FFT of real input for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Floating-point 2D FFT of real input for XPULPV2
+ *
+ * The real rows are transformed with plp_rfft_f32s_xpulpv2. Since the spectrum of a real matrix
+ * is Hermitian, X[r][c] = conj(X[-r][-c]), only the columns 0 .. cols/2 are transformed (through
+ * pBuffer) and the other ones are copied from them.
+ *
+ * @param[in]  SRow     points to the real FFT instance of the row length (number of columns)
+ * @param[in]  SCol     points to the CFFT instance of the column length (number of rows)
+ * @param[in]  pSrc     points to the real matrix, row major
+ * @param[out] pDst     points to the complex output matrix, row major
+ * @param[in]  pBuffer  points to a buffer of <code>2*rows</code> values
+ */
+void plp_rfft2d_f32s_xpulpv2(const plp_fft_instance_f32 *SRow,
+                             const plp_cfft_instance_f32 *SCol,
+                             const float32_t *pSrc,
+                             float32_t *pDst,
+                             float32_t *pBuffer) {
+
+    uint32_t C = SRow->FFTLength;
+    uint32_t R = SCol->fftLen;
+    float32_t *pCol, *pMirror;
+    uint32_t r, c;
+
+    for (r = 0; r < R; r++) {
+        plp_rfft_f32s_xpulpv2(SRow, pSrc + C * r, pDst + 2 * C * r);
+    }
+
+    for (c = 0; c <= C / 2; c++) {
+        pCol = pDst + 2 * c;
+        for (r = 0; r < R; r++) {
+            pBuffer[2 * r] = pCol[2 * C * r];
+            pBuffer[2 * r + 1] = pCol[2 * C * r + 1];
+        }
+
+        plp_cfft_f32s_xpulpv2(SCol, pBuffer, 0, 1);
+
+        for (r = 0; r < R; r++) {
+            pCol[2 * C * r] = pBuffer[2 * r];
+            pCol[2 * C * r + 1] = pBuffer[2 * r + 1];
+        }
+    }
+
+    for (r = 0; r < R; r++) {
+        pMirror = pDst + 2 * C * ((R - r) % R);
+        for (c = C / 2 + 1; c < C; c++) {
+            pDst[2 * (C * r + c)] = pMirror[2 * (C - c)];
+            pDst[2 * (C * r + c) + 1] = -pMirror[2 * (C - c) + 1];
+        }
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -33,10 +33,10 @@ static HAL_CL_L1 float32_t ROT_CONST = 0.707106781f;
 
 /* HELPER FUNCTIONS */
 
-int bit_rev_radix2(int index, int log2FFTLen);
-int bit_rev_radix4(int index, int log2FFTLen);
-int bit_rev_radix8(int index, int log2FFTLen);
-int bit_rev_2_4(int value, int log2FFTLen);
+static int bit_rev_radix2(int index, int log2FFTLen);
+static int bit_rev_radix4(int index, int log2FFTLen);
+static int bit_rev_radix8(int index, int log2FFTLen);
+static int bit_rev_2_4(int value, int log2FFTLen);
 
 static inline Complex_type_f32 complex_mul(Complex_type_f32 A, Complex_type_f32 B) {
     Complex_type_f32 result;
@@ -112,6 +112,12 @@ void plp_rfft_f32p_xpulpv2(void *arg) {
     const uint32_t nPE = ((plp_fft_instance_f32_parallel*)arg)->nPE;
     float32_t *pDst = ((plp_fft_instance_f32_parallel*)arg)->pDst;
 
+    /* the radix-2/4/8 kernels need at least two cores */
+    if (nPE == 1) {
+        plp_rfft_f32s_xpulpv2(S, pSrc, pDst);
+        return;
+    }
+
     switch( S->FFTLength ) {
 
         case 64:
@@ -139,7 +145,7 @@ void plp_rfft_f32p_xpulpv2(void *arg) {
 
 /* RADIX-2 */
 
-int bit_rev_radix2(int index, int log2FFTLen) {
+static int bit_rev_radix2(int index, int log2FFTLen) {
 
     unsigned int revNum = 0;
     unsigned i;
@@ -346,7 +352,7 @@ static void plp_radix2_rfft_f32p_xpulpv2(   const plp_fft_instance_f32 *S,
 
 /* RADIX-4 */
 
-int bit_rev_radix4(int index, int log2FFTLen) //digit reverse 2 bit blocks
+static int bit_rev_radix4(int index, int log2FFTLen) //digit reverse 2 bit blocks
 {
     int i;
     unsigned int revNum = 0;
@@ -630,7 +636,7 @@ static void plp_radix4_rfft_f32p_xpulpv2(   const plp_fft_instance_f32 *S,
 
 /* RADIX-8 */
 
-int bit_rev_radix8(int index, int log2FFTLen) //digit reverse 2 bit blocks
+static int bit_rev_radix8(int index, int log2FFTLen) //digit reverse 2 bit blocks
 {
     int i;
     unsigned int revNum = 0;
@@ -1084,7 +1090,7 @@ static void plp_radix8_rfft_f32p_xpulpv2(   const plp_fft_instance_f32 *S,
 
 /* RADIX_4-2 */
 
-int bit_rev_2_4(int value, int log2FFTLen) {
+static int bit_rev_2_4(int value, int log2FFTLen) {
     int i;
     unsigned int new_value = 0;
     for (i = 0; i < (log2FFTLen - 1)/2; i++)
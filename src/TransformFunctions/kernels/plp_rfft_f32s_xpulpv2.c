@@ -32,10 +32,10 @@
 static HAL_CL_L1 float32_t ROT_CONST = 0.707106781f;
 
 /* HELPER FUNCTIONS */
-int bit_rev_radix2(int index, int log2FFTLen);
-int bit_rev_radix4(int index, int log2FFTLen);
-int bit_rev_radix8(int index, int log2FFTLen);
-int bit_rev_2_4(int value, int log2FFTLen);
+static int bit_rev_radix2(int index, int log2FFTLen);
+static int bit_rev_radix4(int index, int log2FFTLen);
+static int bit_rev_radix8(int index, int log2FFTLen);
+static int bit_rev_2_4(int value, int log2FFTLen);
 
 static inline Complex_type_f32 complex_mul(Complex_type_f32 A, Complex_type_f32 B) {
     Complex_type_f32 result;
@@ -133,7 +133,7 @@ void plp_rfft_f32s_xpulpv2( const plp_fft_instance_f32 *S,
 
 /* RADIX-2 */
 
-int bit_rev_radix2(int index, int log2FFTLen) {
+static int bit_rev_radix2(int index, int log2FFTLen) {
 
     unsigned int revNum = 0;
     unsigned i;
@@ -303,7 +303,7 @@ static void plp_radix2_rfft_f32s_xpulpv2(   const plp_fft_instance_f32 *S,
 
 /* RADIX-4 */
 
-int bit_rev_radix4(int index, int log2FFTLen) //digit reverse 2 bit blocks
+static int bit_rev_radix4(int index, int log2FFTLen) //digit reverse 2 bit blocks
 {
     int i;
     unsigned int revNum = 0;
@@ -554,7 +554,7 @@ static void plp_radix4_rfft_f32s_xpulpv2(   const plp_fft_instance_f32 *S,
 
 /* RADIX-8 */
 
-int bit_rev_radix8(int index, int log2FFTLen) //digit reverse 2 bit blocks
+static int bit_rev_radix8(int index, int log2FFTLen) //digit reverse 2 bit blocks
 {
     int i;
     unsigned int revNum = 0;
@@ -988,7 +988,7 @@ static void plp_radix8_rfft_f32s_xpulpv2(   const plp_fft_instance_f32 *S,
 
 /* RADIX_2_4 */
 
-int bit_rev_2_4(int value, int log2FFTLen) {
+static int bit_rev_2_4(int value, int log2FFTLen) {
     int i;
     unsigned int new_value = 0;
     for (i = 0; i < (log2FFTLen - 1)/2; i++)
@@ -0,0 +1,78 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q16_batch_xpulpv2.c
+ * Description:  Batch of 16-bit fixed-point real FFTs for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Batch of 16-bit fixed-point real FFTs for XPULPV2
+ *
+ * With at least as many frames as cores, every core transforms whole frames (core_id,
+ * core_id + nPE, ...) with the single core kernel and no synchronization. With fewer frames, the
+ * frames are transformed one after the other by the whole team with plp_rfft_q16p_xpulpv2 if nPE is a power of
+ * two, and by one core each otherwise, the other cores staying idle.
+ *
+ * @param[in]  args  points to the plp_rfft_instance_q16_batch
+ */
+void plp_rfft_q16_batch_xpulpv2(void *args) {
+
+    plp_rfft_instance_q16_batch *a = (plp_rfft_instance_q16_batch *)args;
+    uint32_t N = a->S->fftLenReal;
+    uint32_t srcLen = a->ifftFlag ? N + 2 : N;
+    uint32_t dstLen = a->ifftFlag ? N : N + 2;
+    uint32_t nPE = a->nPE;
+    uint32_t f;
+
+    /* the team transforms run on a power-of-two number of cores */
+    if (a->nFrames >= nPE || (nPE & (nPE - 1)) != 0) {
+        for (f = hal_core_id(); f < a->nFrames; f += nPE) {
+            plp_rfft_q16s_xpulpv2(a->S, a->pSrc + f * srcLen, a->pDst + f * dstLen, a->ifftFlag);
+        }
+    } else {
+        for (f = 0; f < a->nFrames; f++) {
+            plp_rfft_instance_q16_parallel frame = { .S = a->S,
+                                                     .pSrc = a->pSrc + f * srcLen,
+                                                     .pDst = a->pDst + f * dstLen,
+                                                     .ifftFlag = a->ifftFlag,
+                                                     .nPE = nPE };
+            plp_rfft_q16p_xpulpv2((void *)&frame);
+        }
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit fixed-point real FFT for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Parallel 16-bit fixed-point real FFT for XPULPV2
+ *
+ * The complex FFT runs on all the cores of the team, and the pairs of bins (k, N/2 - k) of the
+ * split stage are distributed in blocks over the cores.
+ *
+ * @param[in]  args       points to the plp_rfft_instance_q16_parallel
+ */
+void plp_rfft_q16p_xpulpv2(void *args) {
+
+    plp_rfft_instance_q16_parallel *a = (plp_rfft_instance_q16_parallel *)args;
+    const plp_rfft_instance_q16 *S = a->S;
+    int16_t *pSrc = a->pSrc;
+    int16_t *pDst = a->pDst;
+    uint32_t nPE = a->nPE;
+
+    const int16_t *pCoef = S->pTwiddleRFFT;
+    uint32_t L = S->pCfft->fftLen;
+    uint32_t core_id = hal_core_id();
+    uint32_t step = (L / 2 + nPE - 1) / nPE;
+    uint32_t first = 1 + core_id * step;
+    uint32_t last = MIN(L / 2 + 1, first + step);
+    uint32_t k;
+    v2s A, B, P, M, D, CoSi;
+    int32_t sr, si, tr, ti;
+
+    plp_cfft_instance_q16_parallel cfftArgs = { .S = (plp_cfft_instance_q16 *)S->pCfft,
+                                                .ifftFlag = 0,
+                                                .bitReverseFlag = 1,
+                                                .deciPoint = 15,
+                                                .nPE = nPE };
+
+    if (a->ifftFlag == 0) {
+        cfftArgs.p1 = pSrc;
+        plp_cfft_q16p_xpulpv2((void *)&cfftArgs);
+        hal_team_barrier();
+
+        /* the bins 0 and N/2 are real */
+        if (core_id == 0) {
+            sr = pSrc[0];
+            si = pSrc[1];
+            *((v2s *)&pDst[0]) = __PACK2((sr + si) >> 1, 0);
+            *((v2s *)&pDst[2 * L]) = __PACK2((sr - si) >> 1, 0);
+        }
+
+        /* X[k] = (A + B)/2 - j W^k (A - B)/2, with A = Z[k] and B = conj(Z[L-k]) */
+        for (k = first; k < last; k++) {
+            A = __SRA2(*((v2s *)&pSrc[2 * k]), ((v2s){ 1, 1 }));
+            B = __SRA2(*((v2s *)&pSrc[2 * (L - k)]), ((v2s){ 1, 1 }));
+            CoSi = *((v2s *)&pCoef[2 * k]);
+
+            P = __ADD2(A, B);
+            M = __SUB2(A, B);
+            sr = P[0];
+            si = M[1];
+            D = __PACK2(M[0], P[1]);
+            tr = __DOTP2(D, __PACK2(CoSi[1], -CoSi[0])) >> 15;
+            ti = __DOTP2(D, CoSi) >> 15;
+
+            *((v2s *)&pDst[2 * k]) = __PACK2((sr - tr) >> 1, (si - ti) >> 1);
+            *((v2s *)&pDst[2 * (L - k)]) = __PACK2((sr + tr) >> 1, (-si - ti) >> 1);
+        }
+        hal_team_barrier();
+    } else {
+        /* conj(Z[k])/2, with Z[k] = (A + B)/2 + j W^-k (A - B)/2, A = X[k] and B = conj(X[L-k]) */
+        if (core_id == 0) {
+            /* the DC and Nyquist bins of a real sequence are real, their imaginary parts are ignored */
+            A = __PACK2(pSrc[0] >> 1, 0);
+            B = __PACK2(pSrc[2 * L] >> 1, 0);
+            P = __ADD2(A, B);
+            M = __SUB2(A, B);
+            *((v2s *)&pDst[0]) =
+                __PACK2(__CLIP((P[0] - P[1]) >> 1, 15), __CLIP((-M[1] - M[0]) >> 1, 15));
+        }
+
+        for (k = first; k < last; k++) {
+            A = __SRA2(*((v2s *)&pSrc[2 * k]), ((v2s){ 1, 1 }));
+            B = __SRA2(*((v2s *)&pSrc[2 * (L - k)]), ((v2s){ 1, 1 }));
+            CoSi = *((v2s *)&pCoef[2 * k]);
+
+            P = __ADD2(A, B);
+            M = __SUB2(A, B);
+            sr = P[0];
+            si = M[1];
+            D = __PACK2(M[0], P[1]);
+            tr = -__DOTP2(D, __PACK2(CoSi[1], CoSi[0])) >> 15;
+            ti = __DOTP2(D, __PACK2(CoSi[0], -CoSi[1])) >> 15;
+
+            *((v2s *)&pDst[2 * k]) = __PACK2(__CLIP((sr + tr) >> 1, 15), __CLIP((-si - ti) >> 1, 15));
+            *((v2s *)&pDst[2 * (L - k)]) = __PACK2(__CLIP((sr - tr) >> 1, 15), __CLIP((si - ti) >> 1, 15));
+        }
+        hal_team_barrier();
+
+        cfftArgs.p1 = pDst;
+        plp_cfft_q16p_xpulpv2((void *)&cfftArgs);
+        hal_team_barrier();
+
+        /* the FFT gives conj(x[2n] + j x[2n+1])/2 */
+        step = (L + nPE - 1) / nPE;
+        for (k = core_id * step; k < MIN(L, (core_id + 1) * step); k++) {
+            A = *((v2s *)&pDst[2 * k]);
+            *((v2s *)&pDst[2 * k]) = __PACK2(__CLIP(A[0] * 2, 15), __CLIP(A[1] * -2, 15));
+        }
+        hal_team_barrier();
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
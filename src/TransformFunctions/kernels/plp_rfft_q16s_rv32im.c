@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q16s_rv32im.c
+ * Description:  16-bit fixed-point real FFT for RV32IM
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+static inline int16_t plp_rfft_sat_q16(int32_t x) {
+    return (int16_t)(x > 32767 ? 32767 : (x < -32768 ? -32768 : x));
+}
+
+/**
+ * @brief      16-bit fixed-point real FFT for RV32IM
+ *
+ * The forward transform (ifftFlag=0) runs the complex FFT of N/2 points in-place on pSrc, and
+ * splits its result into the bins 0 .. N/2 of the real sequence, scaled by 1/N.
+ * The inverse transform (ifftFlag=1) merges the bins 0 .. N/2 into the conjugated spectrum of
+ * x[2n] + j x[2n+1], on which the forward complex FFT computes the inverse.
+ *
+ * @param[in]  S          points to an instance of the 16-bit real FFT structure
+ * @param[in]  pSrc       points to the input buffer, N real values (forward, modified) or
+ *                        N/2 + 1 complex values (inverse)
+ * @param[out] pDst       points to the output buffer, N/2 + 1 complex values (forward) or
+ *                        N real values (inverse)
+ * @param[in]  ifftFlag   flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ */
+void plp_rfft_q16s_rv32im(const plp_rfft_instance_q16 *S,
+                          int16_t *pSrc,
+                          int16_t *pDst,
+                          uint8_t ifftFlag) {
+
+    const int16_t *pCoef = S->pTwiddleRFFT;
+    uint32_t L = S->pCfft->fftLen;
+    uint32_t k;
+    int32_t ar, ai, br, bi, sr, si, dr, di, tr, ti, c, s;
+
+    if (ifftFlag == 0) {
+        plp_cfft_q16s_rv32im(S->pCfft, pSrc, 0, 1, 15);
+
+        /* the bins 0 and N/2 are real */
+        ar = pSrc[0];
+        ai = pSrc[1];
+        pDst[0] = (int16_t)((ar + ai) >> 1);
+        pDst[1] = 0;
+        pDst[2 * L] = (int16_t)((ar - ai) >> 1);
+        pDst[2 * L + 1] = 0;
+
+        /* X[k] = (A + B)/2 - j W^k (A - B)/2, with A = Z[k] and B = conj(Z[L-k]) */
+        for (k = 1; k <= L / 2; k++) {
+            ar = pSrc[2 * k];
+            ai = pSrc[2 * k + 1];
+            br = pSrc[2 * (L - k)];
+            bi = pSrc[2 * (L - k) + 1];
+            c = pCoef[2 * k];
+            s = pCoef[2 * k + 1];
+
+            sr = (ar + br) >> 1;
+            si = (ai - bi) >> 1;
+            dr = (ar - br) >> 1;
+            di = (ai + bi) >> 1;
+            tr = (s * dr - c * di) >> 15;
+            ti = (s * di + c * dr) >> 15;
+
+            pDst[2 * k] = (int16_t)((sr - tr) >> 1);
+            pDst[2 * k + 1] = (int16_t)((si - ti) >> 1);
+            pDst[2 * (L - k)] = (int16_t)((sr + tr) >> 1);
+            pDst[2 * (L - k) + 1] = (int16_t)((-si - ti) >> 1);
+        }
+    } else {
+        /* conj(Z[k])/2, with Z[k] = (A + B)/2 + j W^-k (A - B)/2, A = X[k] and B = conj(X[L-k]) */
+        /* the DC and Nyquist bins of a real sequence are real, their imaginary parts are ignored */
+        ar = pSrc[0];
+        ai = 0;
+        br = pSrc[2 * L];
+        bi = 0;
+        sr = (ar + br) >> 1;
+        si = (ai - bi) >> 1;
+        dr = (ar - br) >> 1;
+        di = (ai + bi) >> 1;
+        pDst[0] = plp_rfft_sat_q16((sr - di) >> 1);
+        pDst[1] = plp_rfft_sat_q16((-si - dr) >> 1);
+
+        for (k = 1; k <= L / 2; k++) {
+            ar = pSrc[2 * k];
+            ai = pSrc[2 * k + 1];
+            br = pSrc[2 * (L - k)];
+            bi = pSrc[2 * (L - k) + 1];
+            c = pCoef[2 * k];
+            s = pCoef[2 * k + 1];
+
+            sr = (ar + br) >> 1;
+            si = (ai - bi) >> 1;
+            dr = (ar - br) >> 1;
+            di = (ai + bi) >> 1;
+            tr = (-s * dr - c * di) >> 15;
+            ti = (c * dr - s * di) >> 15;
+
+            pDst[2 * k] = plp_rfft_sat_q16((sr + tr) >> 1);
+            pDst[2 * k + 1] = plp_rfft_sat_q16((-si - ti) >> 1);
+            pDst[2 * (L - k)] = plp_rfft_sat_q16((sr - tr) >> 1);
+            pDst[2 * (L - k) + 1] = plp_rfft_sat_q16((si - ti) >> 1);
+        }
+
+        plp_cfft_q16s_rv32im(S->pCfft, pDst, 0, 1, 15);
+
+        /* the FFT gives conj(x[2n] + j x[2n+1])/2 */
+        for (k = 0; k < L; k++) {
+            pDst[2 * k] = plp_rfft_sat_q16((int32_t)pDst[2 * k] * 2);
+            pDst[2 * k + 1] = plp_rfft_sat_q16((int32_t)pDst[2 * k + 1] * -2);
+        }
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,128 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q16s_xpulpv2.c
+ * Description:  16-bit fixed-point real FFT for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      16-bit fixed-point real FFT for XPULPV2
+ *
+ * See plp_rfft_q16s_rv32im for the algorithm.
+ *
+ * @param[in]  S          points to an instance of the 16-bit real FFT structure
+ * @param[in]  pSrc       points to the input buffer, N real values (forward, modified) or
+ *                        N/2 + 1 complex values (inverse)
+ * @param[out] pDst       points to the output buffer, N/2 + 1 complex values (forward) or
+ *                        N real values (inverse)
+ * @param[in]  ifftFlag   flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ */
+void plp_rfft_q16s_xpulpv2(const plp_rfft_instance_q16 *S,
+                           int16_t *pSrc,
+                           int16_t *pDst,
+                           uint8_t ifftFlag) {
+
+    const int16_t *pCoef = S->pTwiddleRFFT;
+    uint32_t L = S->pCfft->fftLen;
+    uint32_t k;
+    v2s A, B, P, M, D, CoSi;
+    int32_t sr, si, tr, ti;
+
+    if (ifftFlag == 0) {
+        plp_cfft_q16s_xpulpv2(S->pCfft, pSrc, 0, 1, 15);
+
+        /* the bins 0 and N/2 are real */
+        sr = pSrc[0];
+        si = pSrc[1];
+        *((v2s *)&pDst[0]) = __PACK2((sr + si) >> 1, 0);
+        *((v2s *)&pDst[2 * L]) = __PACK2((sr - si) >> 1, 0);
+
+        /* X[k] = (A + B)/2 - j W^k (A - B)/2, with A = Z[k] and B = conj(Z[L-k]) */
+        for (k = 1; k <= L / 2; k++) {
+            A = __SRA2(*((v2s *)&pSrc[2 * k]), ((v2s){ 1, 1 }));
+            B = __SRA2(*((v2s *)&pSrc[2 * (L - k)]), ((v2s){ 1, 1 }));
+            CoSi = *((v2s *)&pCoef[2 * k]);
+
+            P = __ADD2(A, B);
+            M = __SUB2(A, B);
+            sr = P[0];
+            si = M[1];
+            D = __PACK2(M[0], P[1]);
+            tr = __DOTP2(D, __PACK2(CoSi[1], -CoSi[0])) >> 15;
+            ti = __DOTP2(D, CoSi) >> 15;
+
+            *((v2s *)&pDst[2 * k]) = __PACK2((sr - tr) >> 1, (si - ti) >> 1);
+            *((v2s *)&pDst[2 * (L - k)]) = __PACK2((sr + tr) >> 1, (-si - ti) >> 1);
+        }
+    } else {
+        /* conj(Z[k])/2, with Z[k] = (A + B)/2 + j W^-k (A - B)/2, A = X[k] and B = conj(X[L-k]) */
+        /* the DC and Nyquist bins of a real sequence are real, their imaginary parts are ignored */
+        A = __PACK2(pSrc[0] >> 1, 0);
+        B = __PACK2(pSrc[2 * L] >> 1, 0);
+        P = __ADD2(A, B);
+        M = __SUB2(A, B);
+        *((v2s *)&pDst[0]) = __PACK2(__CLIP((P[0] - P[1]) >> 1, 15), __CLIP((-M[1] - M[0]) >> 1, 15));
+
+        for (k = 1; k <= L / 2; k++) {
+            A = __SRA2(*((v2s *)&pSrc[2 * k]), ((v2s){ 1, 1 }));
+            B = __SRA2(*((v2s *)&pSrc[2 * (L - k)]), ((v2s){ 1, 1 }));
+            CoSi = *((v2s *)&pCoef[2 * k]);
+
+            P = __ADD2(A, B);
+            M = __SUB2(A, B);
+            sr = P[0];
+            si = M[1];
+            D = __PACK2(M[0], P[1]);
+            tr = -__DOTP2(D, __PACK2(CoSi[1], CoSi[0])) >> 15;
+            ti = __DOTP2(D, __PACK2(CoSi[0], -CoSi[1])) >> 15;
+
+            *((v2s *)&pDst[2 * k]) = __PACK2(__CLIP((sr + tr) >> 1, 15), __CLIP((-si - ti) >> 1, 15));
+            *((v2s *)&pDst[2 * (L - k)]) = __PACK2(__CLIP((sr - tr) >> 1, 15), __CLIP((si - ti) >> 1, 15));
+        }
+
+        plp_cfft_q16s_xpulpv2(S->pCfft, pDst, 0, 1, 15);
+
+        /* the FFT gives conj(x[2n] + j x[2n+1])/2 */
+        for (k = 0; k < L; k++) {
+            A = *((v2s *)&pDst[2 * k]);
+            *((v2s *)&pDst[2 * k]) = __PACK2(__CLIP(A[0] * 2, 15), __CLIP(A[1] * -2, 15));
+        }
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
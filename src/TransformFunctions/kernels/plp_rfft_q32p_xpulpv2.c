@@ -0,0 +1,169 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q32p_xpulpv2.c
+ * Description:  Parallel 32-bit fixed-point real FFT for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+static inline int32_t plp_rfft_sat_q32(int64_t x) {
+    return (int32_t)(x > 0x7FFFFFFFLL ? 0x7FFFFFFFLL : (x < -0x80000000LL ? -0x80000000LL : x));
+}
+
+/**
+ * @brief      Parallel 32-bit fixed-point real FFT for XPULPV2
+ *
+ * The complex FFT runs on all the cores of the team, and the pairs of bins (k, N/2 - k) of the
+ * split stage are distributed in blocks over the cores.
+ *
+ * @param[in]  args       points to the plp_rfft_instance_q32_parallel
+ */
+void plp_rfft_q32p_xpulpv2(void *args) {
+
+    plp_rfft_instance_q32_parallel *a = (plp_rfft_instance_q32_parallel *)args;
+    const plp_rfft_instance_q32 *S = a->S;
+    int32_t *pSrc = a->pSrc;
+    int32_t *pDst = a->pDst;
+    uint32_t nPE = a->nPE;
+
+    const int32_t *pCoef = S->pTwiddleRFFT;
+    uint32_t L = S->pCfft->fftLen;
+    uint32_t core_id = hal_core_id();
+    uint32_t step = (L / 2 + nPE - 1) / nPE;
+    uint32_t first = 1 + core_id * step;
+    uint32_t last = MIN(L / 2 + 1, first + step);
+    uint32_t k;
+    int32_t ar, ai, br, bi, sr, si, dr, di, tr, ti, c, s;
+
+    plp_cfft_instance_q32_parallel cfftArgs = { .S = (plp_cfft_instance_q32 *)S->pCfft,
+                                                .ifftFlag = 0,
+                                                .bitReverseFlag = 1,
+                                                .fracBits = 31,
+                                                .nPE = nPE };
+
+    if (a->ifftFlag == 0) {
+        cfftArgs.p1 = pSrc;
+        plp_cfft_q32p_xpulpv2((void *)&cfftArgs);
+        hal_team_barrier();
+
+        /* the bins 0 and N/2 are real */
+        if (core_id == 0) {
+            ar = pSrc[0] >> 1;
+            ai = pSrc[1] >> 1;
+            pDst[0] = ar + ai;
+            pDst[1] = 0;
+            pDst[2 * L] = ar - ai;
+            pDst[2 * L + 1] = 0;
+        }
+
+        /* X[k] = (A + B)/2 - j W^k (A - B)/2, with A = Z[k] and B = conj(Z[L-k]) */
+        for (k = first; k < last; k++) {
+            ar = pSrc[2 * k] >> 1;
+            ai = pSrc[2 * k + 1] >> 1;
+            br = pSrc[2 * (L - k)] >> 1;
+            bi = pSrc[2 * (L - k) + 1] >> 1;
+            c = pCoef[2 * k];
+            s = pCoef[2 * k + 1];
+
+            sr = ar + br;
+            si = ai - bi;
+            dr = ar - br;
+            di = ai + bi;
+            tr = (int32_t)(((int64_t)s * dr - (int64_t)c * di) >> 31);
+            ti = (int32_t)(((int64_t)s * di + (int64_t)c * dr) >> 31);
+
+            pDst[2 * k] = (sr >> 1) - (tr >> 1);
+            pDst[2 * k + 1] = (si >> 1) - (ti >> 1);
+            pDst[2 * (L - k)] = (sr >> 1) + (tr >> 1);
+            pDst[2 * (L - k) + 1] = -(si >> 1) - (ti >> 1);
+        }
+        hal_team_barrier();
+    } else {
+        /* conj(Z[k])/2, with Z[k] = (A + B)/2 + j W^-k (A - B)/2, A = X[k] and B = conj(X[L-k]) */
+        if (core_id == 0) {
+            /* the DC and Nyquist bins of a real sequence are real, their imaginary parts are ignored */
+            ar = pSrc[0] >> 1;
+            ai = 0;
+            br = pSrc[2 * L] >> 1;
+            bi = 0;
+            sr = ar + br;
+            si = ai - bi;
+            dr = ar - br;
+            di = ai + bi;
+            pDst[0] = plp_rfft_sat_q32(((int64_t)sr - di) >> 1);
+            pDst[1] = plp_rfft_sat_q32(((int64_t)-si - dr) >> 1);
+        }
+
+        for (k = first; k < last; k++) {
+            ar = pSrc[2 * k] >> 1;
+            ai = pSrc[2 * k + 1] >> 1;
+            br = pSrc[2 * (L - k)] >> 1;
+            bi = pSrc[2 * (L - k) + 1] >> 1;
+            c = pCoef[2 * k];
+            s = pCoef[2 * k + 1];
+
+            sr = ar + br;
+            si = ai - bi;
+            dr = ar - br;
+            di = ai + bi;
+            tr = (int32_t)((-(int64_t)s * dr - (int64_t)c * di) >> 31);
+            ti = (int32_t)(((int64_t)c * dr - (int64_t)s * di) >> 31);
+
+            pDst[2 * k] = plp_rfft_sat_q32(((int64_t)sr + tr) >> 1);
+            pDst[2 * k + 1] = plp_rfft_sat_q32(((int64_t)-si - ti) >> 1);
+            pDst[2 * (L - k)] = plp_rfft_sat_q32(((int64_t)sr - tr) >> 1);
+            pDst[2 * (L - k) + 1] = plp_rfft_sat_q32(((int64_t)si - ti) >> 1);
+        }
+        hal_team_barrier();
+
+        cfftArgs.p1 = pDst;
+        plp_cfft_q32p_xpulpv2((void *)&cfftArgs);
+        hal_team_barrier();
+
+        /* the FFT gives conj(x[2n] + j x[2n+1])/2 */
+        step = (L + nPE - 1) / nPE;
+        for (k = core_id * step; k < MIN(L, (core_id + 1) * step); k++) {
+            pDst[2 * k] = plp_rfft_sat_q32((int64_t)pDst[2 * k] * 2);
+            pDst[2 * k + 1] = plp_rfft_sat_q32((int64_t)pDst[2 * k + 1] * -2);
+        }
+        hal_team_barrier();
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q32s_xpulpv2.c
+ * Description:  32-bit fixed-point real FFT for XPULPV2
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+static inline int32_t plp_rfft_sat_q32(int64_t x) {
+    return (int32_t)(x > 0x7FFFFFFFLL ? 0x7FFFFFFFLL : (x < -0x80000000LL ? -0x80000000LL : x));
+}
+
+/**
+ * @brief      32-bit fixed-point real FFT for XPULPV2
+ *
+ * See plp_rfft_q16s_rv32im for the algorithm.
+ *
+ * @param[in]  S          points to an instance of the 32-bit real FFT structure
+ * @param[in]  pSrc       points to the input buffer, N real values (forward, modified) or
+ *                        N/2 + 1 complex values (inverse)
+ * @param[out] pDst       points to the output buffer, N/2 + 1 complex values (forward) or
+ *                        N real values (inverse)
+ * @param[in]  ifftFlag   flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ */
+void plp_rfft_q32s_xpulpv2(const plp_rfft_instance_q32 *S,
+                          int32_t *pSrc,
+                          int32_t *pDst,
+                          uint8_t ifftFlag) {
+
+    const int32_t *pCoef = S->pTwiddleRFFT;
+    uint32_t L = S->pCfft->fftLen;
+    uint32_t k;
+    int32_t ar, ai, br, bi, sr, si, dr, di, tr, ti, c, s;
+
+    if (ifftFlag == 0) {
+        plp_cfft_q32s_xpulpv2(S->pCfft, pSrc, 0, 1, 31);
+
+        /* the bins 0 and N/2 are real */
+        ar = pSrc[0] >> 1;
+        ai = pSrc[1] >> 1;
+        pDst[0] = ar + ai;
+        pDst[1] = 0;
+        pDst[2 * L] = ar - ai;
+        pDst[2 * L + 1] = 0;
+
+        /* X[k] = (A + B)/2 - j W^k (A - B)/2, with A = Z[k] and B = conj(Z[L-k]) */
+        for (k = 1; k <= L / 2; k++) {
+            ar = pSrc[2 * k] >> 1;
+            ai = pSrc[2 * k + 1] >> 1;
+            br = pSrc[2 * (L - k)] >> 1;
+            bi = pSrc[2 * (L - k) + 1] >> 1;
+            c = pCoef[2 * k];
+            s = pCoef[2 * k + 1];
+
+            sr = ar + br;
+            si = ai - bi;
+            dr = ar - br;
+            di = ai + bi;
+            tr = (int32_t)(((int64_t)s * dr - (int64_t)c * di) >> 31);
+            ti = (int32_t)(((int64_t)s * di + (int64_t)c * dr) >> 31);
+
+            pDst[2 * k] = (sr >> 1) - (tr >> 1);
+            pDst[2 * k + 1] = (si >> 1) - (ti >> 1);
+            pDst[2 * (L - k)] = (sr >> 1) + (tr >> 1);
+            pDst[2 * (L - k) + 1] = -(si >> 1) - (ti >> 1);
+        }
+    } else {
+        /* conj(Z[k])/2, with Z[k] = (A + B)/2 + j W^-k (A - B)/2, A = X[k] and B = conj(X[L-k]) */
+        /* the DC and Nyquist bins of a real sequence are real, their imaginary parts are ignored */
+        ar = pSrc[0] >> 1;
+        ai = 0;
+        br = pSrc[2 * L] >> 1;
+        bi = 0;
+        sr = ar + br;
+        si = ai - bi;
+        dr = ar - br;
+        di = ai + bi;
+        pDst[0] = plp_rfft_sat_q32(((int64_t)sr - di) >> 1);
+        pDst[1] = plp_rfft_sat_q32(((int64_t)-si - dr) >> 1);
+
+        for (k = 1; k <= L / 2; k++) {
+            ar = pSrc[2 * k] >> 1;
+            ai = pSrc[2 * k + 1] >> 1;
+            br = pSrc[2 * (L - k)] >> 1;
+            bi = pSrc[2 * (L - k) + 1] >> 1;
+            c = pCoef[2 * k];
+            s = pCoef[2 * k + 1];
+
+            sr = ar + br;
+            si = ai - bi;
+            dr = ar - br;
+            di = ai + bi;
+            tr = (int32_t)((-(int64_t)s * dr - (int64_t)c * di) >> 31);
+            ti = (int32_t)(((int64_t)c * dr - (int64_t)s * di) >> 31);
+
+            pDst[2 * k] = plp_rfft_sat_q32(((int64_t)sr + tr) >> 1);
+            pDst[2 * k + 1] = plp_rfft_sat_q32(((int64_t)-si - ti) >> 1);
+            pDst[2 * (L - k)] = plp_rfft_sat_q32(((int64_t)sr - tr) >> 1);
+            pDst[2 * (L - k) + 1] = plp_rfft_sat_q32(((int64_t)si - ti) >> 1);
+        }
+
+        plp_cfft_q32s_xpulpv2(S->pCfft, pDst, 0, 1, 31);
+
+        /* the FFT gives conj(x[2n] + j x[2n+1])/2 */
+        for (k = 0; k < L; k++) {
+            pDst[2 * k] = plp_rfft_sat_q32((int64_t)pDst[2 * k] * 2);
+            pDst[2 * k + 1] = plp_rfft_sat_q32((int64_t)pDst[2 * k + 1] * -2);
+        }
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -30,7 +30,7 @@
 
 #include "plp_math.h"
 
-void stage_rfft_f32( const plp_fft_fast_instance_f32 * S, float32_t * pSrc, float32_t * pDst, uint32_t nPE);
+static void stage_rfft_f32( const plp_fft_fast_instance_f32 * S, float32_t * pSrc, float32_t * pDst, uint32_t nPE);
 
 #define MAX(x, y) (((x) > (y)) ? (x) : (y))
 #define MIN(x, y) (((x) < (y)) ? (x) : (y))
@@ -53,7 +53,7 @@ void plp_rfftfast_f32p_xpulpv2( void *arg )
       hal_team_barrier();
 }
 
-void stage_rfft_f32( const plp_fft_fast_instance_f32 * S, float32_t * p, float32_t * pDst, uint32_t nPE)
+static void stage_rfft_f32( const plp_fft_fast_instance_f32 * S, float32_t * p, float32_t * pDst, uint32_t nPE)
 {
         uint32_t fftLen = (*(S->Sint)).fftLen;
         uint32_t step;
@@ -31,7 +31,7 @@
 #include "plp_math.h"
 
 void cfft_f32( const plp_cfft_instance_f32 * S, float32_t * pSrc, uint8_t bitReverseFlag);
-void stage_rfft_f32( const plp_fft_fast_instance_f32 * S, float32_t * pSrc, float32_t * pDst);
+static void stage_rfft_f32( const plp_fft_fast_instance_f32 * S, float32_t * pSrc, float32_t * pDst);
 void radix8_butterfly_f32( float32_t * pSrc, uint16_t fftLen, const float32_t * pCoef, uint16_t twidCoefModifier);
 void bitreversal_32( uint32_t *pSrc, const uint16_t bitRevLen, const uint16_t *pBitRevTab);
 
@@ -53,7 +53,7 @@ void plp_rfftfast_f32s_xpulpv2( const plp_fft_fast_instance_f32 *S,
    stage_rfft_f32(S, pSrc, pDst);
 }
 
-void stage_rfft_f32( const plp_fft_fast_instance_f32 * S, float32_t * p, float32_t * pDst)
+static void stage_rfft_f32( const plp_fft_fast_instance_f32 * S, float32_t * p, float32_t * pDst)
 {
         int32_t  k;                                   /* Loop Counter */
         float32_t twR, twI;                           /* RFFT Twiddle coefficients */
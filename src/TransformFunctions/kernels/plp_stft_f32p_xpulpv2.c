@@ -0,0 +1,65 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_stft_f32p_xpulpv2.c
+ * Description:  Frames of the streaming STFT transformed in parallel
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup feature
+ * @{
+ */
+
+/**
+ * @brief      Frames of the streaming STFT transformed in parallel for XPULPV2
+ *
+ * Every core transforms whole frames (core_id, core_id + nPE, ...) in its own part of the scratch,
+ * so no synchronization is needed.
+ *
+ * @param[in]  args  points to the plp_stft_instance_f32_parallel
+ */
+void plp_stft_f32p_xpulpv2(void *args) {
+
+    plp_stft_instance_f32_parallel *a = (plp_stft_instance_f32_parallel *)args;
+    const plp_stft_instance_f32 *S = a->S;
+    uint32_t N = S->S->FFTLength;
+    uint32_t core_id = hal_core_id();
+    float32_t *pScratch = S->pScratch + core_id * 3 * N;
+    uint32_t f, start;
+
+    for (f = core_id; f < a->nFrames; f += a->nPE) {
+        start = (S->readPos + f * S->hop) % S->ringLength;
+        plp_stft_f32s_xpulpv2(S, start, pScratch, a->pDst + f * (N + 2));
+    }
+}
+
+/**
+ * @} end of feature group
+ */
@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_stft_f32s_xpulpv2.c
+ * Description:  Windowed real FFT of one frame of the streaming STFT
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup feature
+ * @{
+ */
+
+/**
+ * @brief      Windowed real FFT of one frame of the streaming STFT for XPULPV2
+ *
+ * The frame may wrap around the end of the ring buffer. Both parts are windowed directly from the
+ * ring buffer into the scratch, which is the only pass over the samples before the FFT.
+ *
+ * @param[in]  S         points to the STFT state
+ * @param[in]  start     position of the first sample of the frame in the ring buffer
+ * @param[in]  pScratch  points to <code>3 * FFTLength</code> values of scratch
+ * @param[out] pDst      points to the spectrum, FFTLength + 2 values
+ */
+void plp_stft_f32s_xpulpv2(const plp_stft_instance_f32 *S,
+                           uint32_t start,
+                           float32_t *__restrict__ pScratch,
+                           float32_t *__restrict__ pDst) {
+
+    uint32_t N = S->S->FFTLength;
+    const float32_t *pRing = S->pRing + start;
+    const float32_t *pWindow = S->pWindow;
+    float32_t *pFrame = pScratch;
+    float32_t *pSpectrum = pScratch + N;
+    uint32_t n0 = S->ringLength - start;
+    uint32_t i;
+
+    if (n0 > N) {
+        n0 = N;
+    }
+
+    for (i = 0; i < n0; i++) {
+        pFrame[i] = pRing[i] * pWindow[i];
+    }
+    pRing = S->pRing - n0;
+    for (i = n0; i < N; i++) {
+        pFrame[i] = pRing[i] * pWindow[i];
+    }
+
+    plp_rfft_f32s_xpulpv2(S->S, pFrame, pSpectrum);
+
+    for (i = 0; i < N + 2; i++) {
+        pDst[i] = pSpectrum[i];
+    }
+}
+
+/**
+ * @} end of feature group
+ */
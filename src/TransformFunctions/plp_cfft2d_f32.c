@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft2d_f32.c
+ * Description:  Floating-point 2D Fast Fourier Transform on Complex Input Data
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief         Glue code for the floating-point 2D complex fast fourier transform
+ *
+ * Transforms the rows in-place, then each column through pBuffer, without transposing the matrix.
+ * The output is in natural order. The inverse transform includes the 1/(rows*cols) factor.
+ *
+ * @param[in]     SRow      points to the CFFT instance of the row length (number of columns)
+ * @param[in]     SCol      points to the CFFT instance of the column length (number of rows)
+ * @param[in,out] pSrc      points to the complex matrix of <code>2*rows*cols</code> values, row
+ * major. Processing occurs in-place.
+ * @param[in]     ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]     pBuffer   points to a buffer of <code>2*rows</code> values
+ */
+
+void plp_cfft2d_f32(const plp_cfft_instance_f32 *SRow,
+                    const plp_cfft_instance_f32 *SCol,
+                    float32_t *pSrc,
+                    uint8_t ifftFlag,
+                    float32_t *pBuffer) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+
+    plp_cfft2d_f32s_xpulpv2(SRow, SCol, pSrc, ifftFlag, pBuffer);
+}
+
+/**
+ * @} end of FFT group
+ */
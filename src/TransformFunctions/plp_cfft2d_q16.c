@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft2d_q16.c
+ * Description:  16-bit fixed-point 2D Fast Fourier Transform on Complex Input Data
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief         Glue code for the 16-bit fixed-point 2D complex fast fourier transform
+ *
+ * Transforms the rows in-place, then each column through pBuffer, without transposing the matrix.
+ * The output is in natural order and scaled by 1/(rows*cols) as plp_cfft_q16 does for each pass.
+ * The inverse transform includes the 1/(rows*cols) factor of the inverse DFT.
+ *
+ * @param[in]     SRow      points to the CFFT instance of the row length (number of columns)
+ * @param[in]     SCol      points to the CFFT instance of the column length (number of rows)
+ * @param[in,out] pSrc      points to the complex matrix of <code>2*rows*cols</code> values, row
+ * major. Processing occurs in-place.
+ * @param[in]     ifftFlag  flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]     pBuffer   points to a buffer of <code>2*rows</code> values
+ */
+
+void plp_cfft2d_q16(const plp_cfft_instance_q16 *SRow,
+                    const plp_cfft_instance_q16 *SCol,
+                    int16_t *pSrc,
+                    uint8_t ifftFlag,
+                    int16_t *pBuffer) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_cfft2d_q16s_rv32im(SRow, SCol, pSrc, ifftFlag, pBuffer);
+    } else {
+        plp_cfft2d_q16s_xpulpv2(SRow, SCol, pSrc, ifftFlag, pBuffer);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,74 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_bfp_q16.c
+ * Description:  16-bit block floating point Fast Fourier Transform on Complex Input Data
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief         Glue code for the 16-bit block floating point complex fast fourier transform
+ *
+ * Instead of scaling down by a fixed amount at every stage as plp_cfft_q16, the data is shifted
+ * only when the headroom left by the previous stage is not sufficient, and quiet inputs are scaled
+ * up to the full range. The accumulated shift is returned as block exponent: the DFT of the input
+ * is <code>p1 * 2^e</code> (for instance e = log2(fftLen) for the scaling of plp_cfft_q16).
+ * Only forward transforms of power of two lengths are supported.
+ *
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @return        block exponent of the output
+ */
+
+int32_t plp_cfft_bfp_q16(const plp_cfft_instance_q16 *S, int16_t *p1, uint8_t bitReverseFlag) {
+    PLP_PROFILE_FUNC();
+
+    if (S->fftLen < 2 || (S->fftLen & (S->fftLen - 1)) != 0) {
+        printf("Block floating point FFT supported only for powers of two\n");
+        return 0;
+    }
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        return plp_cfft_bfp_q16s_rv32im(S, p1, bitReverseFlag);
+    } else {
+        return plp_cfft_bfp_q16s_xpulpv2(S, p1, bitReverseFlag);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
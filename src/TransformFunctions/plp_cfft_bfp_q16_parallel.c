@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_bfp_q16_parallel.c
+ * Description:  Parallel 16-bit block floating point Fast Fourier Transform on Complex Input Data
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief         Glue code for the parallel 16-bit block floating point complex fast fourier
+ * transform, see plp_cfft_bfp_q16.
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]     nPE             number of cores to use
+ * @return        block exponent e, the DFT of the input is <code>p1 * 2^e</code>
+ */
+
+int32_t plp_cfft_bfp_q16_parallel(const plp_cfft_instance_q16 *S,
+                                  int16_t *p1,
+                                  uint8_t bitReverseFlag,
+                                  uint32_t nPE) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        return plp_cfft_bfp_q16(S, p1, bitReverseFlag);
+    } else {
+        if (S->fftLen < 2 || (S->fftLen & (S->fftLen - 1)) != 0) {
+            printf("Block floating point FFT supported only for powers of two\n");
+            return 0;
+        }
+
+        uint32_t headroom[2 * nPE];
+
+        plp_cfft_bfp_instance_q16_parallel args = { .S = S,
+                                                    .p1 = p1,
+                                                    .bitReverseFlag = bitReverseFlag,
+                                                    .nPE = nPE,
+                                                    .pHeadroom = headroom,
+                                                    .exponent = 0 };
+
+        plp_cl_team_fork(nPE, plp_cfft_bfp_q16p_xpulpv2, (void *)&args);
+
+        return args.exponent;
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
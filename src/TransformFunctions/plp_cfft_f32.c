@@ -58,6 +58,7 @@ void plp_cfft_f32(  const plp_cfft_instance_f32 *S,
                     float32_t *pSrc,
                     uint8_t ifftFlag,
                     uint8_t bitReverseFlag) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("F extension is supported only for cluster side\n");
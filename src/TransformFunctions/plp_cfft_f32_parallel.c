@@ -52,7 +52,8 @@
    @param[in]   pSrc    points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
    @param[in]   ifftFlag flag that selects forwart (ifftFlag=0) or inverse (ifftFlag=1)
    @param[in]   bitReverseFlag flag that enables (bitReverseFlag=1) of disables (bitReverseFlag=0) bit reversal of output.
-   @param[in]   nPE     number of parallel processing units
+   @param[in]   nPE     number of parallel processing units, rounded down to a power of two for
+                        the power-of-two lengths
    @return      none
 */
 void plp_cfft_f32_parallel( const plp_cfft_instance_f32 *S,
@@ -60,13 +61,16 @@ void plp_cfft_f32_parallel( const plp_cfft_instance_f32 *S,
                             uint8_t ifftFlag,
                             uint8_t bitReverseFlag,
                             const uint32_t nPE) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
+    if (hal_cluster_id() == ARCHI_FC_CID && plp_fc_cluster_open() != 0) {
         printf("Parallel processing supported only for cluster side\n");
         return;
     }
-    plp_cfft_instance_f32_parallel arg = (plp_cfft_instance_f32_parallel){ S, pSrc, ifftFlag, bitReverseFlag, nPE };
-    hal_cl_team_fork(nPE, plp_cfft_f32p_xpulpv2, (void *)&arg);
+    /* the radix-2/4/8 kernels run on a power-of-two number of cores */
+    uint32_t nCores = plp_cfft_f32_parallel_npe(S, nPE);
+    plp_cfft_instance_f32_parallel arg = (plp_cfft_instance_f32_parallel){ S, pSrc, ifftFlag, bitReverseFlag, nCores };
+    plp_cl_team_fork(nCores, plp_cfft_f32p_xpulpv2, (void *)&arg);
 
 }
 
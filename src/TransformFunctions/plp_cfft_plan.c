@@ -0,0 +1,462 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_plan.c
+ * Description:  CFFT plans with tables generated at runtime
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ *
+ * @par FFT plans
+ * The constant instances (e.g. plp_cfft_sR_q16_len256) point to the tables in
+ * plp_common_tables.c, which exist only up to 2048 (f32) or 4096 (q16, q32) points and are all
+ * linked into L2. A plan generates the twiddle factors and the bit reversal table of one length
+ * at runtime instead, in L2 or directly in the cluster L1:
+ *
+ * <pre>
+ *     plp_cfft_plan_q16 plan;
+ *     if (plp_cfft_plan_create_q16(&plan, 8192, PLP_FFT_PLAN_L2) == 0) {
+ *         plp_cfft_q16(&plan.S, p1, 0, 1, 15);
+ *         plp_cfft_plan_destroy_q16(&plan);
+ *     }
+ * </pre>
+ *
+ * The generated tables are identical to the constant ones (the q32 twiddle factors up to one
+ * LSB), so both can be used interchangeably.
+ *
+ * The f32 and q16 plans also accept lengths which are not a power of two but only have the prime
+ * factors 2, 3 and 5, e.g. 1000 or 1200 points instead of zero padding to 2048. These are computed
+ * with radix-4, 2, 3 and 5 stages, and the q16 output is scaled by 1/fftLen as well.
+ * Only one eighth of the twiddle factors is computed with sin and cos, the others follow from
+ * the symmetries of the unit circle.
+ */
+
+#define PLP_CFFT_PLAN_PI 3.14159265358979323846
+
+typedef enum {
+    PLP_CFFT_PLAN_F32,
+    PLP_CFFT_PLAN_Q16,
+    PLP_CFFT_PLAN_Q32
+} plp_cfft_plan_type;
+
+static void *plp_cfft_plan_alloc(uint32_t size, plp_fft_plan_mem mem) {
+    if (mem == PLP_FFT_PLAN_L1) {
+        return hal_cl_l1_malloc(size);
+    } else {
+        return hal_l2_malloc(size);
+    }
+}
+
+static void plp_cfft_plan_free(void *chunk, uint32_t size, plp_fft_plan_mem mem) {
+    if (chunk == NULL) {
+        return;
+    }
+
+    if (mem == PLP_FFT_PLAN_L1) {
+        hal_cl_l1_free(chunk, size);
+    } else {
+        hal_l2_free(chunk, size);
+    }
+}
+
+/* Returns log2(fftLen) for powers of two, 0 for lengths 2^a 3^b 5^c if allowMixed is set, or -1
+ * if fftLen is not supported */
+static int32_t plp_cfft_plan_log2(uint32_t fftLen, uint32_t maxLen, uint32_t allowMixed) {
+    uint32_t log2Len = 0;
+    uint32_t len = fftLen;
+
+    if (fftLen >= PLP_CFFT_PLAN_MIN_LEN && fftLen <= maxLen) {
+        if ((fftLen & (fftLen - 1)) == 0) {
+            while ((1U << log2Len) < fftLen) {
+                log2Len++;
+            }
+            return log2Len;
+        }
+
+        while (allowMixed && len > 1 && plp_cfft_mixed_radix(len) != 0) {
+            len /= plp_cfft_mixed_radix(len);
+        }
+        if (allowMixed && len == 1) {
+            return 0;
+        }
+    }
+
+    printf("error: FFT plans support %s between %d and %d points\n",
+           allowMixed ? "lengths 2^a 3^b 5^c" : "powers of two", PLP_CFFT_PLAN_MIN_LEN, (int)maxLen);
+    return -1;
+}
+
+/* Fixed-point value of x (-1 <= x <= 1), truncated and saturated like the constant tables */
+static inline int32_t plp_cfft_plan_fixed(double x, uint32_t fracBits) {
+    double one = (double)(1U << fracBits);
+    double val = floor(x * one);
+
+    return (int32_t)(val > one - 1.0 ? one - 1.0 : val);
+}
+
+/* Stores the twiddle factor of index idx, with cosine c and sine s */
+static void plp_cfft_plan_store(void *pTwiddle, plp_cfft_plan_type type, uint32_t idx, double c, double s) {
+    switch (type) {
+    case PLP_CFFT_PLAN_F32:
+        /* exp(-j 2 pi idx / fftLen) */
+        ((float32_t *)pTwiddle)[2 * idx] = (float32_t)c;
+        ((float32_t *)pTwiddle)[2 * idx + 1] = (float32_t)(-s);
+        break;
+    case PLP_CFFT_PLAN_Q16:
+        ((int16_t *)pTwiddle)[2 * idx] = (int16_t)plp_cfft_plan_fixed(c, 15);
+        ((int16_t *)pTwiddle)[2 * idx + 1] = (int16_t)plp_cfft_plan_fixed(s, 15);
+        break;
+    case PLP_CFFT_PLAN_Q32:
+        ((int32_t *)pTwiddle)[2 * idx] = plp_cfft_plan_fixed(c, 31);
+        ((int32_t *)pTwiddle)[2 * idx + 1] = plp_cfft_plan_fixed(s, 31);
+        break;
+    }
+}
+
+/* Stores the twiddle factor of index k (0 <= k < fftLen / 4), with cosine c and sine s, and its
+ * rotations by multiples of pi / 2 at k + fftLen / 4, k + fftLen / 2, ... */
+static void plp_cfft_plan_put(void *pTwiddle,
+                              plp_cfft_plan_type type,
+                              uint32_t fftLen,
+                              uint32_t numTwiddles,
+                              uint32_t k,
+                              double c,
+                              double s) {
+    uint32_t idx;
+    double tmp;
+
+    for (idx = k; idx < numTwiddles; idx += fftLen >> 2) {
+        plp_cfft_plan_store(pTwiddle, type, idx, c, s);
+
+        /* cos(a + pi / 2) = -sin(a), sin(a + pi / 2) = cos(a) */
+        tmp = c;
+        c = -s;
+        s = tmp;
+    }
+}
+
+/* Generates the first numTwiddles twiddle factors of an fftLen point FFT */
+static void plp_cfft_plan_twiddles(void *pTwiddle,
+                                   plp_cfft_plan_type type,
+                                   uint32_t fftLen,
+                                   uint32_t numTwiddles) {
+    uint32_t quarter = fftLen >> 2;
+    uint32_t eighth = fftLen >> 3;
+    uint32_t r;
+    double angle;
+
+    /* mixed-radix lengths which are not a multiple of 8 lack the symmetries used below */
+    if (fftLen % 8 != 0) {
+        for (r = 0; r < numTwiddles; r++) {
+            angle = 2.0 * PLP_CFFT_PLAN_PI * (double)r / (double)fftLen;
+            plp_cfft_plan_store(pTwiddle, type, r, cos(angle), sin(angle));
+        }
+        return;
+    }
+
+    for (r = 0; r <= eighth; r++) {
+        angle = 2.0 * PLP_CFFT_PLAN_PI * (double)r / (double)fftLen;
+
+        plp_cfft_plan_put(pTwiddle, type, fftLen, numTwiddles, r, cos(angle), sin(angle));
+
+        /* cos(pi / 2 - a) = sin(a), sin(pi / 2 - a) = cos(a) */
+        if (r != 0 && r != eighth) {
+            plp_cfft_plan_put(pTwiddle, type, fftLen, numTwiddles, quarter - r, sin(angle),
+                              cos(angle));
+        }
+    }
+}
+
+/* Reverses the order of the digits (of digitBits bits each) of index */
+static uint32_t plp_cfft_plan_digit_reverse(uint32_t index, uint32_t log2Len, uint32_t digitBits) {
+    uint32_t rev = 0;
+    uint32_t d;
+
+    for (d = 0; d < log2Len; d += digitBits) {
+        rev = (rev << digitBits) | (index & ((1U << digitBits) - 1));
+        index >>= digitBits;
+    }
+
+    return rev;
+}
+
+/* Generates the bit reversal table of the fixed-point FFTs: the pairs of samples to swap, as
+ * offsets of 8 bytes per sample. Returns the length of the table. */
+static uint16_t plp_cfft_plan_bitrev_fixed(uint16_t *pBitRevTable, uint32_t fftLen, uint32_t log2Len) {
+    uint32_t i, j;
+    uint16_t length = 0;
+
+    for (i = 0; i < fftLen; i++) {
+        j = plp_cfft_plan_digit_reverse(i, log2Len, 1);
+        if (i < j) {
+            pBitRevTable[length++] = (uint16_t)(i << 3);
+            pBitRevTable[length++] = (uint16_t)(j << 3);
+        }
+    }
+
+    return length;
+}
+
+/* Generates the digit reversal of a mixed-radix FFT (see plp_cfft_mixed_radix) as a sequence of
+ * swaps: the stages leave frequency k at the position with the reversed digits of k, and swapping
+ * sample i with sample pTable[i] (>= i), for i = 0, 1, ..., fftLen - 1 in this order, restores
+ * the natural order. A table of pairs like for powers of two cannot express this permutation,
+ * which is not its own inverse if the factors are not symmetric (e.g. 1000 = 4 * 2 * 5 * 5 * 5).
+ * Returns -1 if the temporary buffers cannot be allocated. */
+static int32_t plp_cfft_plan_mixed_swaps(uint16_t *pTable, uint32_t fftLen) {
+    uint16_t *pWhere = hal_l2_malloc(2 * fftLen * sizeof(uint16_t));
+    uint16_t *pAt = pWhere + fftLen;
+    uint32_t i, k, pos, span, radix, src, other;
+
+    if (pWhere == NULL) {
+        return -1;
+    }
+
+    /* pWhere[p]: current position of the sample left at p by the stages, pAt: its inverse */
+    for (i = 0; i < fftLen; i++) {
+        pWhere[i] = i;
+        pAt[i] = i;
+    }
+
+    for (i = 0; i < fftLen; i++) {
+        /* position of frequency i after the stages */
+        k = i;
+        pos = 0;
+        for (span = fftLen; span > 1; span /= radix) {
+            radix = plp_cfft_mixed_radix(span);
+            pos += (k % radix) * (span / radix);
+            k /= radix;
+        }
+
+        src = pWhere[pos];
+        other = pAt[i];
+        pTable[i] = src;
+        pAt[src] = other;
+        pWhere[other] = src;
+        pAt[i] = pos;
+        pWhere[pos] = i;
+    }
+
+    hal_l2_free(pWhere, 2 * fftLen * sizeof(uint16_t));
+    return 0;
+}
+
+/* Number of q16 twiddle factors: the radix-4 kernels access 3/4 of the circle, the mixed-radix
+ * kernels all of it */
+static inline uint32_t plp_cfft_plan_num_twiddles_q16(uint32_t fftLen) {
+    return ((fftLen & (fftLen - 1)) == 0) ? 3 * fftLen / 4 : fftLen;
+}
+
+/* Number of entries of the fixed-point bit reversal table, i.e. all indices except the
+ * 2^ceil(log2Len / 2) palindromes */
+static inline uint32_t plp_cfft_plan_bitrev_fixed_length(uint32_t fftLen, uint32_t log2Len) {
+    return fftLen - (1U << ((log2Len + 1) >> 1));
+}
+
+/**
+   @brief  Create a floating-point CFFT plan, generating the twiddle factors and the bit reversal
+   table for the given length.
+   @param[out]  plan    points to the plan, pass &plan->S to plp_cfft_f32
+   @param[in]   fftLen  power of two or 2^a 3^b 5^c between PLP_CFFT_PLAN_MIN_LEN and
+                        PLP_CFFT_PLAN_MAX_LEN_F32
+   @param[in]   mem     memory in which the tables are allocated
+   @return      0 on success, -1 if the length is not supported or the allocation failed
+
+   @par
+   For powers of two, the kernels use radix-8 butterflies if log2(fftLen) is a multiple of 3,
+   radix-4 if it is even and radix-2 otherwise, and the bit reversal table reverses the digits of
+   the same radix. Other lengths are computed with radix-4, 2, 3 and 5 stages (see
+   plp_cfft_mixed_radix) and the table lists the swaps which reorder the output.
+*/
+int32_t plp_cfft_plan_create_f32(plp_cfft_plan_f32 *plan, uint32_t fftLen, plp_fft_plan_mem mem) {
+    int32_t log2Len = plp_cfft_plan_log2(fftLen, PLP_CFFT_PLAN_MAX_LEN_F32, 1);
+    uint32_t digitBits, i;
+    float32_t *pTwiddle;
+    uint16_t *pBitRevTable;
+
+    if (log2Len < 0) {
+        return -1;
+    }
+
+    pTwiddle = plp_cfft_plan_alloc(2 * fftLen * sizeof(float32_t), mem);
+    pBitRevTable = plp_cfft_plan_alloc(fftLen * sizeof(uint16_t), mem);
+    if (pTwiddle == NULL || pBitRevTable == NULL ||
+        (log2Len == 0 && plp_cfft_plan_mixed_swaps(pBitRevTable, fftLen) != 0)) {
+        plp_cfft_plan_free(pTwiddle, 2 * fftLen * sizeof(float32_t), mem);
+        plp_cfft_plan_free(pBitRevTable, fftLen * sizeof(uint16_t), mem);
+        return -1;
+    }
+
+    plp_cfft_plan_twiddles(pTwiddle, PLP_CFFT_PLAN_F32, fftLen, fftLen);
+
+    if (log2Len > 0) {
+        digitBits = (log2Len % 3 == 0) ? 3 : ((log2Len % 2 == 0) ? 2 : 1);
+        for (i = 0; i < fftLen; i++) {
+            pBitRevTable[i] = (uint16_t)plp_cfft_plan_digit_reverse(i, log2Len, digitBits);
+        }
+    }
+
+    plan->S.fftLen = fftLen;
+    plan->S.pTwiddle = pTwiddle;
+    plan->S.pBitRevTable = pBitRevTable;
+    plan->S.bitRevLength = fftLen;
+    plan->mem = mem;
+    return 0;
+}
+
+/**
+   @brief  Free the tables of a floating-point CFFT plan.
+   @param[in]   plan    points to a plan created with plp_cfft_plan_create_f32
+   @return      none
+*/
+void plp_cfft_plan_destroy_f32(plp_cfft_plan_f32 *plan) {
+    plp_cfft_plan_free((void *)plan->S.pTwiddle, 2 * plan->S.fftLen * sizeof(float32_t), plan->mem);
+    plp_cfft_plan_free((void *)plan->S.pBitRevTable, plan->S.fftLen * sizeof(uint16_t), plan->mem);
+    plan->S.pTwiddle = NULL;
+    plan->S.pBitRevTable = NULL;
+}
+
+/**
+   @brief  Create a 16-bit fixed-point CFFT plan, generating the twiddle factors and the bit
+   reversal table for the given length.
+   @param[out]  plan    points to the plan, pass &plan->S to plp_cfft_q16
+   @param[in]   fftLen  power of two or 2^a 3^b 5^c between PLP_CFFT_PLAN_MIN_LEN and
+                        PLP_CFFT_PLAN_MAX_LEN_Q
+   @param[in]   mem     memory in which the tables are allocated
+   @return      0 on success, -1 if the length is not supported or the allocation failed
+
+   @par
+   For lengths which are not a power of two, the plan holds all fftLen twiddle factors, and the
+   table lists the swaps which reorder the output as for plp_cfft_plan_create_f32.
+*/
+int32_t plp_cfft_plan_create_q16(plp_cfft_plan_q16 *plan, uint32_t fftLen, plp_fft_plan_mem mem) {
+    int32_t log2Len = plp_cfft_plan_log2(fftLen, PLP_CFFT_PLAN_MAX_LEN_Q, 1);
+    uint32_t numTwiddles = plp_cfft_plan_num_twiddles_q16(fftLen);
+    uint32_t bitRevLength;
+    int16_t *pTwiddle;
+    uint16_t *pBitRevTable;
+
+    if (log2Len < 0) {
+        return -1;
+    }
+
+    bitRevLength = (log2Len == 0) ? fftLen : plp_cfft_plan_bitrev_fixed_length(fftLen, log2Len);
+    pTwiddle = plp_cfft_plan_alloc(2 * numTwiddles * sizeof(int16_t), mem);
+    pBitRevTable = plp_cfft_plan_alloc(bitRevLength * sizeof(uint16_t), mem);
+    if (pTwiddle == NULL || pBitRevTable == NULL ||
+        (log2Len == 0 && plp_cfft_plan_mixed_swaps(pBitRevTable, fftLen) != 0)) {
+        plp_cfft_plan_free(pTwiddle, 2 * numTwiddles * sizeof(int16_t), mem);
+        plp_cfft_plan_free(pBitRevTable, bitRevLength * sizeof(uint16_t), mem);
+        return -1;
+    }
+
+    plp_cfft_plan_twiddles(pTwiddle, PLP_CFFT_PLAN_Q16, fftLen, numTwiddles);
+
+    plan->S.fftLen = fftLen;
+    plan->S.pTwiddle = pTwiddle;
+    plan->S.pBitRevTable = (const int16_t *)pBitRevTable;
+    plan->S.bitRevLength =
+        (log2Len == 0) ? fftLen : plp_cfft_plan_bitrev_fixed(pBitRevTable, fftLen, log2Len);
+    plan->mem = mem;
+    return 0;
+}
+
+/**
+   @brief  Free the tables of a 16-bit fixed-point CFFT plan.
+   @param[in]   plan    points to a plan created with plp_cfft_plan_create_q16
+   @return      none
+*/
+void plp_cfft_plan_destroy_q16(plp_cfft_plan_q16 *plan) {
+    plp_cfft_plan_free((void *)plan->S.pTwiddle,
+                       2 * plp_cfft_plan_num_twiddles_q16(plan->S.fftLen) * sizeof(int16_t),
+                       plan->mem);
+    plp_cfft_plan_free((void *)plan->S.pBitRevTable, plan->S.bitRevLength * sizeof(uint16_t),
+                       plan->mem);
+    plan->S.pTwiddle = NULL;
+    plan->S.pBitRevTable = NULL;
+}
+
+/**
+   @brief  Create a 32-bit fixed-point CFFT plan, generating the twiddle factors and the bit
+   reversal table for the given length.
+   @param[out]  plan    points to the plan, pass &plan->S to plp_cfft_q32
+   @param[in]   fftLen  power of two between PLP_CFFT_PLAN_MIN_LEN and PLP_CFFT_PLAN_MAX_LEN_Q
+   @param[in]   mem     memory in which the tables are allocated
+   @return      0 on success, -1 if the length is not supported or the allocation failed
+*/
+int32_t plp_cfft_plan_create_q32(plp_cfft_plan_q32 *plan, uint32_t fftLen, plp_fft_plan_mem mem) {
+    int32_t log2Len = plp_cfft_plan_log2(fftLen, PLP_CFFT_PLAN_MAX_LEN_Q, 0);
+    uint32_t numTwiddles = 3 * fftLen / 4;
+    uint32_t bitRevLength;
+    int32_t *pTwiddle;
+    uint16_t *pBitRevTable;
+
+    if (log2Len < 0) {
+        return -1;
+    }
+
+    bitRevLength = plp_cfft_plan_bitrev_fixed_length(fftLen, log2Len);
+    pTwiddle = plp_cfft_plan_alloc(2 * numTwiddles * sizeof(int32_t), mem);
+    pBitRevTable = plp_cfft_plan_alloc(bitRevLength * sizeof(uint16_t), mem);
+    if (pTwiddle == NULL || pBitRevTable == NULL) {
+        plp_cfft_plan_free(pTwiddle, 2 * numTwiddles * sizeof(int32_t), mem);
+        plp_cfft_plan_free(pBitRevTable, bitRevLength * sizeof(uint16_t), mem);
+        return -1;
+    }
+
+    plp_cfft_plan_twiddles(pTwiddle, PLP_CFFT_PLAN_Q32, fftLen, numTwiddles);
+
+    plan->S.fftLen = fftLen;
+    plan->S.pTwiddle = pTwiddle;
+    plan->S.pBitRevTable = (const int16_t *)pBitRevTable;
+    plan->S.bitRevLength = plp_cfft_plan_bitrev_fixed(pBitRevTable, fftLen, log2Len);
+    plan->mem = mem;
+    return 0;
+}
+
+/**
+   @brief  Free the tables of a 32-bit fixed-point CFFT plan.
+   @param[in]   plan    points to a plan created with plp_cfft_plan_create_q32
+   @return      none
+*/
+void plp_cfft_plan_destroy_q32(plp_cfft_plan_q32 *plan) {
+    plp_cfft_plan_free((void *)plan->S.pTwiddle, 2 * (3 * plan->S.fftLen / 4) * sizeof(int32_t),
+                       plan->mem);
+    plp_cfft_plan_free((void *)plan->S.pBitRevTable, plan->S.bitRevLength * sizeof(uint16_t),
+                       plan->mem);
+    plan->S.pTwiddle = NULL;
+    plan->S.pBitRevTable = NULL;
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_q16_batch.c
+ * Description:  Batch of 16-bit fixed-point complex FFTs distributed across the cores
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief         Glue code for a batch of 16-bit fixed-point complex FFTs
+ *
+ * The frames are independent transforms of the same length, stored one after the other. When
+ * there are at least nPE frames, every core transforms whole frames without any barrier, which is
+ * faster than splitting each (short) transform across the cores. With fewer frames, each frame is
+ * split across the cores as in plp_cfft_q16_parallel if nPE is a power of two, and
+ * transformed by one core each otherwise. The scaling is the one of plp_cfft_q16.
+ *
+ * @param[in]     S               points to an instance of the 16bit quantized CFFT structure
+ * @param[in,out] p1              points to nFrames complex frames of <code>2*fftLen</code>
+ * values. Processing occurs in-place.
+ * @param[in]     nFrames         number of frames
+ * @param[in]     ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]     bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]     deciPoint       decimal point for right shift
+ * @param[in]     nPE             number of cores to use
+ */
+
+void plp_cfft_q16_batch(const plp_cfft_instance_q16 *S,
+                        int16_t *p1,
+                        uint32_t nFrames,
+                        uint8_t ifftFlag,
+                        uint8_t bitReverseFlag,
+                        uint32_t deciPoint,
+                        uint32_t nPE) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        uint32_t f;
+        for (f = 0; f < nFrames; f++) {
+            plp_cfft_q16(S, p1 + f * 2 * S->fftLen, ifftFlag, bitReverseFlag, deciPoint);
+        }
+        return;
+    } else {
+        plp_cfft_instance_q16_batch args = { .S = S,
+                                             .p1 = p1,
+                                             .nFrames = nFrames,
+                                             .ifftFlag = ifftFlag,
+                                             .bitReverseFlag = bitReverseFlag,
+                                             .deciPoint = deciPoint,
+                                             .nPE = nPE };
+
+        plp_cl_team_fork(nPE, plp_cfft_q16_batch_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
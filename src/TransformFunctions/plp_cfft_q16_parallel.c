@@ -53,6 +53,7 @@
  * len=1024:  Q1.15 -> Q11.5
  * len=2048:  Q1.15 -> Q12.4
  * len=4096:  Q1.15 -> Q13.3
+ * other lengths (plans only): output scaled by 1/len
  *
  * @param[in]  		S               points to an instance of the 16bit quantized CFFT structure
  * @param[in,out] 	p1           points to the complex data buffer of size <code>2*fftLen</code>.
@@ -71,16 +72,17 @@ void plp_cfft_q16_parallel(const plp_cfft_instance_q16 *S,
                            uint8_t bitReverseFlag,
                            uint32_t deciPoint,
                            uint32_t nPE){
+    PLP_PROFILE_FUNC();
 
-	if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+	if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_cfft_q16(S, p1, ifftFlag, bitReverseFlag, deciPoint);
         return;
     } else {
         plp_cfft_instance_q16_parallel args = {
             .S = S, .p1 = p1, .ifftFlag = ifftFlag, .bitReverseFlag = bitReverseFlag, .deciPoint = deciPoint, .nPE = nPE
         };
 
-        hal_cl_team_fork(nPE, plp_cfft_q16p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_cfft_q16p_xpulpv2, (void *)&args);
     }
 }
 
@@ -55,6 +55,7 @@ void plp_cfft_q32(const plp_cfft_instance_q32 *S,
                       uint8_t ifftFlag,
                       uint8_t bitReverseFlag,
                       uint32_t fracBits){
+    PLP_PROFILE_FUNC();
     // if (fracBits != 31) {
     //     printf("Only Q1.31 fixed point supported currently.\n");
     //     return;
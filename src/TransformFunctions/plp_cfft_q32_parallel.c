@@ -56,16 +56,17 @@ void plp_cfft_q32_parallel( const plp_cfft_instance_q32 *S,
                             uint8_t bitReverseFlag,
                             uint32_t fracBits,
                             uint32_t nPE ){
+    PLP_PROFILE_FUNC();
 
-	if (hal_cluster_id() == ARCHI_FC_CID) {
-        printf("parallel processing supported only for cluster side\n");
+	if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_cfft_q32(S, p1, ifftFlag, bitReverseFlag, fracBits);
         return;
     } else {
         plp_cfft_instance_q32_parallel args = {
             .S = S, .p1 = p1, .ifftFlag = ifftFlag, .bitReverseFlag = bitReverseFlag, .fracBits = fracBits, .nPE = nPE
         };
 
-        hal_cl_team_fork(nPE, plp_cfft_q32p_xpulpv2, (void *)&args);
+        plp_cl_team_fork(nPE, plp_cfft_q32p_xpulpv2, (void *)&args);
     }
 }
 
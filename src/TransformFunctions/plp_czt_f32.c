@@ -0,0 +1,88 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_czt_f32.c
+ * Description:  Floating-point chirp-z transform
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup czt  Chirp-z transform
+  The chirp-z transform evaluates the z-transform of len samples at numBins points of a spiral
+  in the z-plane. On the unit circle this gives numBins bins of the spectrum at the normalized
+  frequencies fStart + k * fStep, for any len and numBins:
+
+  - the DFT of any length, including primes (plp_czt_plan_create_dft_f32),
+  - a zoom FFT, which inspects a narrow band with a fine resolution without computing a giant FFT
+    of the whole spectrum (plp_czt_plan_create_f32).
+
+  Bluestein's algorithm rewrites the transform as a convolution with a chirp, computed with two
+  power-of-two FFTs of at least len + numBins - 1 points. The plan precomputes the chirps and the
+  transformed convolution kernel once:
+
+  <pre>
+      plp_czt_plan_f32 plan;
+      // 64 bins of 0.5 mHz between 0.1 and 0.132 cycles per sample
+      if (plp_czt_plan_create_f32(&plan, 1000, 64, 0.1f, 0.0005f, PLP_FFT_PLAN_L1) == 0) {
+          plp_czt_f32(&plan, pSrc, pBuf, pDst);   // pBuf: 2 * plan.fft.S.fftLen values
+          plp_czt_plan_destroy_f32(&plan);
+      }
+  </pre>
+ */
+
+/**
+  @addtogroup czt
+  @{
+ */
+
+/**
+   @brief  Floating-point chirp-z transform (Bluestein's algorithm).
+   @param[in]   plan    points to the plan
+   @param[in]   pSrc    points to the len complex input samples
+   @param[in]   pBuf    points to a work buffer of 2 * plan->fft.S.fftLen values
+   @param[out]  pDst    points to the numBins complex output bins
+   @return      none
+*/
+void plp_czt_f32(const plp_czt_plan_f32 *plan,
+                 const float32_t *__restrict__ pSrc,
+                 float32_t *__restrict__ pBuf,
+                 float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+    plp_czt_f32s_xpulpv2(plan, pSrc, pBuf, pDst);
+}
+
+/**
+ * @} end of czt group
+ */
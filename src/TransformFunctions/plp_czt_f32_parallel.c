@@ -0,0 +1,75 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_czt_f32_parallel.c
+ * Description:  Floating-point chirp-z transform, parallel version
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup czt
+  @{
+ */
+
+/**
+   @brief  Floating-point chirp-z transform (Bluestein's algorithm), parallel version.
+   @param[in]   plan    points to the plan
+   @param[in]   pSrc    points to the len complex input samples
+   @param[in]   pBuf    points to a work buffer of 2 * plan->fft.S.fftLen values
+   @param[out]  pDst    points to the numBins complex output bins
+   @param[in]   nPE     number of cores, rounded down to a power of two for the FFT
+   @return      none
+*/
+void plp_czt_f32_parallel(const plp_czt_plan_f32 *plan,
+                          const float32_t *__restrict__ pSrc,
+                          float32_t *__restrict__ pBuf,
+                          float32_t *__restrict__ pDst,
+                          uint32_t nPE) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID && plp_fc_cluster_open() != 0) {
+        printf("Parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    /* the FFT of the convolution runs on a power-of-two number of cores */
+    nPE = plp_cfft_f32_parallel_npe(&plan->fft.S, nPE);
+    if (nPE == 1 && hal_cluster_id() != ARCHI_FC_CID) {
+        plp_czt_f32s_xpulpv2(plan, pSrc, pBuf, pDst);
+        return;
+    }
+
+    plp_czt_instance_f32_parallel arg = { plan, pSrc, pBuf, pDst, nPE };
+    plp_cl_team_fork(nPE, plp_czt_f32p_xpulpv2, (void *)&arg);
+}
+
+/**
+ * @} end of czt group
+ */
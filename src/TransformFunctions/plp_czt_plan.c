@@ -0,0 +1,210 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_czt_plan.c
+ * Description:  Plans of the floating-point chirp-z transform
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup czt
+  @{
+ */
+
+#define PLP_CZT_PLAN_2PI 6.28318530717958647692
+
+static void *plp_czt_plan_alloc(uint32_t size, plp_fft_plan_mem mem) {
+    if (mem == PLP_FFT_PLAN_L1) {
+        return hal_cl_l1_malloc(size);
+    } else {
+        return hal_l2_malloc(size);
+    }
+}
+
+static void plp_czt_plan_free(void *chunk, uint32_t size, plp_fft_plan_mem mem) {
+    if (chunk == NULL) {
+        return;
+    }
+
+    if (mem == PLP_FFT_PLAN_L1) {
+        hal_cl_l1_free(chunk, size);
+    } else {
+        hal_l2_free(chunk, size);
+    }
+}
+
+/* Phase, in cycles, of W^(m^2 / 2) with W = exp(-j 2 pi fStep). For the DFT (fStep = 1 / len),
+ * m^2 is reduced modulo 2 len first, so that the phase stays exact for large m. */
+static double plp_czt_plan_chirp_phase(uint32_t m, uint32_t dftLen, double fStep) {
+    if (dftLen != 0) {
+        return (double)((m * m) % (2 * dftLen)) / (double)(2 * dftLen);
+    }
+    return fmod(0.5 * fStep * (double)m * (double)m, 1.0);
+}
+
+/* Stores exp(-j 2 pi phase) */
+static void plp_czt_plan_store(float32_t *pDst, uint32_t idx, double phase) {
+    pDst[2 * idx] = (float32_t)cos(PLP_CZT_PLAN_2PI * phase);
+    pDst[2 * idx + 1] = (float32_t)(-sin(PLP_CZT_PLAN_2PI * phase));
+}
+
+static int32_t plp_czt_plan_create(plp_czt_plan_f32 *plan,
+                                   uint32_t len,
+                                   uint32_t numBins,
+                                   double fStart,
+                                   double fStep,
+                                   uint32_t dftLen,
+                                   plp_fft_plan_mem mem) {
+    uint32_t fftLen = PLP_CFFT_PLAN_MIN_LEN;
+    uint32_t m;
+    double phase;
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return -1;
+    }
+
+    if (len == 0 || numBins == 0 || len + numBins - 1 > PLP_CFFT_PLAN_MAX_LEN_F32) {
+        printf("error: the chirp-z transform supports len + numBins - 1 <= %d\n",
+               PLP_CFFT_PLAN_MAX_LEN_F32);
+        return -1;
+    }
+
+    while (fftLen < len + numBins - 1) {
+        fftLen <<= 1;
+    }
+
+    if (plp_cfft_plan_create_f32(&plan->fft, fftLen, mem) != 0) {
+        return -1;
+    }
+
+    plan->len = len;
+    plan->numBins = numBins;
+    plan->pChirp = plp_czt_plan_alloc(2 * len * sizeof(float32_t), mem);
+    plan->pKernel = plp_czt_plan_alloc(2 * fftLen * sizeof(float32_t), mem);
+    plan->pPost = plp_czt_plan_alloc(2 * numBins * sizeof(float32_t), mem);
+    if (plan->pChirp == NULL || plan->pKernel == NULL || plan->pPost == NULL) {
+        plp_czt_plan_destroy_f32(plan);
+        return -1;
+    }
+
+    /* input chirp A^-n W^(n^2 / 2), with A = exp(j 2 pi fStart) */
+    for (m = 0; m < len; m++) {
+        phase = plp_czt_plan_chirp_phase(m, dftLen, fStep) + fmod(fStart * (double)m, 1.0);
+        plp_czt_plan_store(plan->pChirp, m, phase);
+    }
+
+    /* output chirp W^(k^2 / 2) */
+    for (m = 0; m < numBins; m++) {
+        plp_czt_plan_store(plan->pPost, m, plp_czt_plan_chirp_phase(m, dftLen, fStep));
+    }
+
+    /* circular convolution kernel W^(-m^2 / 2) for -(len - 1) <= m <= numBins - 1, transformed and
+     * divided by fftLen for the inverse FFT */
+    for (m = 0; m < fftLen; m++) {
+        plan->pKernel[2 * m] = 0.0f;
+        plan->pKernel[2 * m + 1] = 0.0f;
+    }
+    for (m = 0; m < numBins || m < len; m++) {
+        phase = -plp_czt_plan_chirp_phase(m, dftLen, fStep);
+        if (m < numBins) {
+            plp_czt_plan_store(plan->pKernel, m, phase);
+        }
+        if (m > 0 && m < len) {
+            plp_czt_plan_store(plan->pKernel, fftLen - m, phase);
+        }
+    }
+    plp_cfft_f32(&plan->fft.S, plan->pKernel, 0, 1);
+    for (m = 0; m < 2 * fftLen; m++) {
+        plan->pKernel[m] /= (float32_t)fftLen;
+    }
+
+    return 0;
+}
+
+/**
+   @brief  Create a chirp-z transform plan, evaluating numBins bins of the spectrum of len samples
+   at the normalized frequencies fStart + k * fStep (in cycles per sample).
+   @param[out]  plan     points to the plan
+   @param[in]   len      number of input samples
+   @param[in]   numBins  number of output bins, len + numBins - 1 <= PLP_CFFT_PLAN_MAX_LEN_F32
+   @param[in]   fStart   frequency of the first bin
+   @param[in]   fStep    distance between the bins
+   @param[in]   mem      memory in which the tables are allocated
+   @return      0 on success, -1 if the dimensions are not supported or the allocation failed
+
+   @par
+   The plan is created on the cluster: it transforms the convolution chirp with plp_cfft_f32.
+*/
+int32_t plp_czt_plan_create_f32(plp_czt_plan_f32 *plan,
+                                uint32_t len,
+                                uint32_t numBins,
+                                float32_t fStart,
+                                float32_t fStep,
+                                plp_fft_plan_mem mem) {
+    return plp_czt_plan_create(plan, len, numBins, fStart, fStep, 0, mem);
+}
+
+/**
+   @brief  Create a chirp-z transform plan computing the DFT of any length (e.g. a prime).
+   @param[out]  plan     points to the plan
+   @param[in]   len      length of the DFT, 2 * len - 1 <= PLP_CFFT_PLAN_MAX_LEN_F32
+   @param[in]   mem      memory in which the tables are allocated
+   @return      0 on success, -1 if the length is not supported or the allocation failed
+
+   @par
+   Equivalent to plp_czt_plan_create_f32(plan, len, len, 0, 1 / len, mem), but with the chirps
+   computed from 1 / len exactly.
+*/
+int32_t plp_czt_plan_create_dft_f32(plp_czt_plan_f32 *plan, uint32_t len, plp_fft_plan_mem mem) {
+    return plp_czt_plan_create(plan, len, len, 0.0, 0.0, len, mem);
+}
+
+/**
+   @brief  Free the tables of a chirp-z transform plan.
+   @param[in]   plan    points to a plan created with plp_czt_plan_create_f32 or
+                        plp_czt_plan_create_dft_f32
+   @return      none
+*/
+void plp_czt_plan_destroy_f32(plp_czt_plan_f32 *plan) {
+    plp_fft_plan_mem mem = plan->fft.mem;
+
+    plp_czt_plan_free(plan->pChirp, 2 * plan->len * sizeof(float32_t), mem);
+    plp_czt_plan_free(plan->pKernel, 2 * plan->fft.S.fftLen * sizeof(float32_t), mem);
+    plp_czt_plan_free(plan->pPost, 2 * plan->numBins * sizeof(float32_t), mem);
+    plp_cfft_plan_destroy_f32(&plan->fft);
+    plan->pChirp = NULL;
+    plan->pKernel = NULL;
+    plan->pPost = NULL;
+}
+
+/**
+ * @} end of czt group
+ */
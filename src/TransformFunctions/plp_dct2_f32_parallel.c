@@ -73,42 +73,46 @@ void plp_dct2_f32_parallel(const plp_fft_instance_f32 *S,
 		  	   const uint32_t nPE,
                   	   float32_t *__restrict__ pBuf,
                   	   float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
-    // 1: reordering (moves input from pSrc to pDst)
     uint32_t N = S->FFTLength;
-    // write odd indices from Src into buffer
-    for (int i=0;i<N/2;i++){
-	pBuf[i] = pSrc[2*i + 1];
-    }
-    // squeeze remaining even indices closer together (decimate signal to odd indices) and write into Dst
-    for (int i=0;i<N/2;i++){
-	pDst[i] = pSrc[2*i];
-    }
-    // reverse and write saved odd indices into second half of Dst
-    for (int i=0;i<N/2;i++){
-	pDst[N/2+i] = pBuf[N/2-1-i];
+    float32_t scale = orthoNorm ? sqrtf(2.f/(float32_t)N) : 2.f;
+    float32_t re, im, c, s;
+
+    // 1: reordering, v[i] = x[2i] and v[N-1-i] = x[2i+1] (moves input from pSrc to pDst)
+    if (pSrc != pDst) {
+	for (int i=0;i<N/2;i++){
+	    pDst[i] = pSrc[2*i];
+	    pDst[N-1-i] = pSrc[2*i + 1];
+	}
+    } else {
+	// in place, the odd indices are saved in the buffer first
+	for (int i=0;i<N/2;i++){
+	    pBuf[i] = pSrc[2*i + 1];
+	}
+	for (int i=0;i<N/2;i++){
+	    pDst[i] = pSrc[2*i];
+	}
+	for (int i=0;i<N/2;i++){
+	    pDst[N-1-i] = pBuf[i];
+	}
     }
     // 2: RFFT of reordered sequence, result written into buffer
     plp_rfft_f32_parallel(S, pDst, nPE, pBuf);
-    // RFFT must be extended to all FFTLength complex coefficients,
-    // using X[k] = X*[-k] for real x[t]
-    for (int i=0;i<N/2-1;i++) {
-	pBuf[2*(N/2+1+i)] = pBuf[2*(N/2-1-i)];
-	pBuf[2*(N/2+1+i)+1] = (-1)*pBuf[2*(N/2-1-i)+1];
+    // 3: shift, real part and scaling in one pass over the bins 0 .. N/2. The bins above N/2 are
+    // the conjugates of the ones below, and Re(shift[N-k] conj(V[k])) = -Im(shift[k] V[k]),
+    // so that each bin gives the outputs k and N-k.
+    for (int k=0;k<=N/2;k++){
+	re = pBuf[2*k];
+	im = pBuf[2*k + 1];
+	c = scale*pShift[k].re;
+	s = scale*pShift[k].im;
+	pDst[k] = c*re - s*im;
+	if (k > 0)
+	    pDst[N-k] = -(c*im + s*re);
     }
-    // 3: shift FFT in place in buffer
-    plp_cmplx_mult_cmplx_f32(pBuf, (float32_t*)pShift, pBuf, N);
-    // 4: take real part, moving from buffer to output
-    for (int i=0;i<N;i++){
-	pDst[i] = pBuf[2*i];
-    }
-    // 5: multiply by 2 or normalise in place in output buffer
-    if (orthoNorm) {
+    if (orthoNorm)
 	pDst[0] *= M_SQRT1_2;
-	plp_scale_f32(pDst, sqrtf(2.f/(float32_t)N), pDst, N);
-    }
-    else
-    	plp_scale_f32(pDst, 2, pDst, N);
 }
 
 /**
@@ -0,0 +1,67 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_dct2_q16.c
+ * Description:  Glue code for the 16-bit fixed-point DCT-II
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief Glue code for the 16-bit fixed-point DCT-II
+ *
+ * The output is scaled by 1/N.
+ *
+ * @param[in]   plan    points to a plan created with plp_dct_plan_create_q16
+ * @param[in]   pSrc    points to the N input values in Q15
+ * @param[in]   pBuf    points to a work buffer of N values, word aligned
+ * @param[out]  pDst    points to the N output values in Q15, may be the same as pSrc
+ * @return      none
+ */
+void plp_dct2_q16(const plp_dct_plan_q16 *plan,
+                  const int16_t *pSrc,
+                  int16_t *__restrict__ pBuf,
+                  int16_t *pDst) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_dct2_q16s_rv32im(plan, pSrc, pBuf, pDst);
+    } else {
+        plp_dct2_q16s_xpulpv2(plan, pSrc, pBuf, pDst);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,75 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_dct2_q16_parallel.c
+ * Description:  Glue code for the parallel 16-bit fixed-point DCT-II
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief Glue code for the parallel 16-bit fixed-point DCT-II
+ *
+ * The passes before and after the FFT are split in blocks across the cores, and the FFT runs on
+ * the whole team. See plp_dct2_q16 for the scaling.
+ *
+ * @param[in]   plan    points to a plan created with plp_dct_plan_create_q16
+ * @param[in]   pSrc    points to the N input values in Q15
+ * @param[in]   nPE     number of parallel processing units
+ * @param[in]   pBuf    points to a work buffer of N values, word aligned
+ * @param[out]  pDst    points to the N output values in Q15, may be the same as pSrc
+ * @return      none
+ */
+void plp_dct2_q16_parallel(const plp_dct_plan_q16 *plan,
+                           const int16_t *pSrc,
+                           uint32_t nPE,
+                           int16_t *__restrict__ pBuf,
+                           int16_t *pDst) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_dct2_q16(plan, pSrc, pBuf, pDst);
+        return;
+    } else {
+        plp_dct_instance_q16_parallel args = {
+            .plan = plan, .pSrc = pSrc, .pBuf = pBuf, .pDst = pDst, .nPE = nPE
+        };
+
+        plp_cl_team_fork(nPE, plp_dct2_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,70 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_dct4_f32.c
+ * Description:  Glue code for the floating-point DCT-IV
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief Glue code for the floating-point DCT-IV
+ *
+ * X[k] = 2 sum_n x[n] cos(pi (2k + 1) (2n + 1) / (4N)), or with the factor sqrt(2/N) instead
+ * of 2 for orthoNorm, which makes the DCT-IV its own inverse.
+ *
+ * @param[in]   plan        points to a plan created with plp_dct_plan_create_f32
+ * @param[in]   orthoNorm   whether to use the orthonormal scaling
+ * @param[in]   pSrc        points to the N input values
+ * @param[in]   pBuf        points to a work buffer of N values
+ * @param[out]  pDst        points to the N output values, may be the same as pSrc
+ * @return      none
+ */
+void plp_dct4_f32(const plp_dct_plan_f32 *plan,
+                  const uint8_t orthoNorm,
+                  const float32_t *pSrc,
+                  float32_t *__restrict__ pBuf,
+                  float32_t *pDst) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+    plp_dct4_f32s_xpulpv2(plan, orthoNorm, pSrc, pBuf, pDst);
+}
+
+/**
+ * @} end of FFT group
+ */
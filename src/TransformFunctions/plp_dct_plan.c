@@ -0,0 +1,301 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_dct_plan.c
+ * Description:  Plans of the fast DCTs
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup fft
+  @{
+
+  @par DCT plans
+  The DCT-II, DCT-III and DCT-IV of N points are computed with a complex FFT of N/2 points. The
+  even and odd samples are reordered while the FFT input is written, and the rotation of the real
+  FFT split stage and the phase shift of the DCT are applied in one pass over the FFT output, so
+  that a frame goes through memory only once before and once after the FFT. A DCT plan holds the
+  CFFT plan and the rotations of these two passes:
+
+  <pre>
+      plp_dct_plan_q16 plan;
+      if (plp_dct_plan_create_q16(&plan, 256, PLP_FFT_PLAN_L2) == 0) {
+          plp_dct2_q16(&plan, pSrc, pBuf, pDst);
+          plp_dct_plan_destroy_q16(&plan);
+      }
+  </pre>
+ */
+
+#define PLP_DCT_PLAN_PI 3.14159265358979323846
+
+typedef enum {
+    PLP_DCT_PLAN_F32,
+    PLP_DCT_PLAN_Q16,
+    PLP_DCT_PLAN_Q32
+} plp_dct_plan_type;
+
+static void *plp_dct_plan_alloc(uint32_t size, plp_fft_plan_mem mem) {
+    if (mem == PLP_FFT_PLAN_L1) {
+        return hal_cl_l1_malloc(size);
+    } else {
+        return hal_l2_malloc(size);
+    }
+}
+
+static void plp_dct_plan_free(void *chunk, uint32_t size, plp_fft_plan_mem mem) {
+    if (chunk == NULL) {
+        return;
+    }
+
+    if (mem == PLP_FFT_PLAN_L1) {
+        hal_cl_l1_free(chunk, size);
+    } else {
+        hal_l2_free(chunk, size);
+    }
+}
+
+/* Fixed-point value of x (-1 <= x <= 1), rounded and saturated */
+static inline int32_t plp_dct_plan_fixed(double x, uint32_t fracBits) {
+    double one = (double)(1U << fracBits);
+    double val = floor(x * one + 0.5);
+
+    return (int32_t)(val > one - 1.0 ? one - 1.0 : val);
+}
+
+/* Stores exp(-j angle) as (cos, -sin) for f32, or (cos, sin) for the fixed-point types */
+static void plp_dct_plan_store(void *pTable, plp_dct_plan_type type, uint32_t idx, double angle) {
+    switch (type) {
+    case PLP_DCT_PLAN_F32:
+        ((float32_t *)pTable)[2 * idx] = (float32_t)cos(angle);
+        ((float32_t *)pTable)[2 * idx + 1] = (float32_t)(-sin(angle));
+        break;
+    case PLP_DCT_PLAN_Q16:
+        ((int16_t *)pTable)[2 * idx] = (int16_t)plp_dct_plan_fixed(cos(angle), 15);
+        ((int16_t *)pTable)[2 * idx + 1] = (int16_t)plp_dct_plan_fixed(sin(angle), 15);
+        break;
+    case PLP_DCT_PLAN_Q32:
+        ((int32_t *)pTable)[2 * idx] = plp_dct_plan_fixed(cos(angle), 31);
+        ((int32_t *)pTable)[2 * idx + 1] = plp_dct_plan_fixed(sin(angle), 31);
+        break;
+    }
+}
+
+/* Size in bytes of each table: pShift has N/2 + 1 entries, the others N/2 */
+static inline uint32_t plp_dct_plan_table_size(uint32_t len, uint32_t elemSize, uint32_t extra) {
+    return 2 * (len / 2 + extra) * elemSize;
+}
+
+static void plp_dct_plan_free_tables(void **pTables,
+                                     uint32_t len,
+                                     uint32_t elemSize,
+                                     plp_fft_plan_mem mem) {
+    uint32_t i;
+
+    for (i = 0; i < 4; i++) {
+        plp_dct_plan_free(pTables[i], plp_dct_plan_table_size(len, elemSize, i == 1), mem);
+        pTables[i] = NULL;
+    }
+}
+
+/* Allocates and fills the tables pSplit, pShift, pPre and pPost (in this order) */
+static int32_t plp_dct_plan_tables(void **pTables,
+                                   plp_dct_plan_type type,
+                                   uint32_t len,
+                                   uint32_t elemSize,
+                                   plp_fft_plan_mem mem) {
+    uint32_t L = len / 2;
+    uint32_t i, k;
+
+    for (i = 0; i < 4; i++) {
+        pTables[i] = plp_dct_plan_alloc(plp_dct_plan_table_size(len, elemSize, i == 1), mem);
+    }
+    if (pTables[0] == NULL || pTables[1] == NULL || pTables[2] == NULL || pTables[3] == NULL) {
+        plp_dct_plan_free_tables(pTables, len, elemSize, mem);
+        return -1;
+    }
+
+    for (k = 0; k <= L; k++) {
+        plp_dct_plan_store(pTables[1], type, k, PLP_DCT_PLAN_PI * k / (2.0 * len));
+        if (k < L) {
+            plp_dct_plan_store(pTables[0], type, k, 2.0 * PLP_DCT_PLAN_PI * k / len);
+            plp_dct_plan_store(pTables[2], type, k, PLP_DCT_PLAN_PI * (4 * k + 1) / (4.0 * len));
+            plp_dct_plan_store(pTables[3], type, k, PLP_DCT_PLAN_PI * k / len);
+        }
+    }
+    return 0;
+}
+
+/* The DCT length must be even, its half is checked by the CFFT plan */
+static int32_t plp_dct_plan_check(uint32_t len) {
+    if (len % 2 != 0) {
+        printf("error: DCT plans support only even lengths\n");
+        return -1;
+    }
+    return 0;
+}
+
+/**
+   @brief  Create a floating-point DCT plan (DCT-III and DCT-IV), generating the twiddle factors of
+   the pre- and post-processing and the CFFT plan of len/2 points.
+   @param[out]  plan    points to the plan
+   @param[in]   len     number of points, len/2 must be a length supported by
+                        plp_cfft_plan_create_f32
+   @param[in]   mem     memory in which the tables are allocated
+   @return      0 on success, -1 if the length is not supported or the allocation failed
+*/
+int32_t plp_dct_plan_create_f32(plp_dct_plan_f32 *plan, uint32_t len, plp_fft_plan_mem mem) {
+    void *pTables[4];
+
+    if (plp_dct_plan_check(len) != 0 || plp_cfft_plan_create_f32(&plan->fft, len / 2, mem) != 0) {
+        return -1;
+    }
+
+    if (plp_dct_plan_tables(pTables, PLP_DCT_PLAN_F32, len, sizeof(float32_t), mem) != 0) {
+        plp_cfft_plan_destroy_f32(&plan->fft);
+        return -1;
+    }
+
+    plan->len = len;
+    plan->pSplit = pTables[0];
+    plan->pShift = pTables[1];
+    plan->pPre = pTables[2];
+    plan->pPost = pTables[3];
+    return 0;
+}
+
+/**
+   @brief  Free the tables of a floating-point DCT plan.
+   @param[in]   plan    points to a plan created with plp_dct_plan_create_f32
+   @return      none
+*/
+void plp_dct_plan_destroy_f32(plp_dct_plan_f32 *plan) {
+    void *pTables[4] = { plan->pSplit, plan->pShift, plan->pPre, plan->pPost };
+
+    plp_dct_plan_free_tables(pTables, plan->len, sizeof(float32_t), plan->fft.mem);
+    plp_cfft_plan_destroy_f32(&plan->fft);
+    plan->pSplit = NULL;
+    plan->pShift = NULL;
+    plan->pPre = NULL;
+    plan->pPost = NULL;
+}
+
+/**
+   @brief  Create a 16-bit fixed-point DCT plan (DCT-II, DCT-III and DCT-IV), generating the
+   twiddle factors of the pre- and post-processing and the CFFT plan of len/2 points.
+   @param[out]  plan    points to the plan
+   @param[in]   len     number of points, len/2 must be a length supported by
+                        plp_cfft_plan_create_q16
+   @param[in]   mem     memory in which the tables are allocated
+   @return      0 on success, -1 if the length is not supported or the allocation failed
+*/
+int32_t plp_dct_plan_create_q16(plp_dct_plan_q16 *plan, uint32_t len, plp_fft_plan_mem mem) {
+    void *pTables[4];
+
+    if (plp_dct_plan_check(len) != 0 || plp_cfft_plan_create_q16(&plan->fft, len / 2, mem) != 0) {
+        return -1;
+    }
+
+    if (plp_dct_plan_tables(pTables, PLP_DCT_PLAN_Q16, len, sizeof(int16_t), mem) != 0) {
+        plp_cfft_plan_destroy_q16(&plan->fft);
+        return -1;
+    }
+
+    plan->len = len;
+    plan->pSplit = pTables[0];
+    plan->pShift = pTables[1];
+    plan->pPre = pTables[2];
+    plan->pPost = pTables[3];
+    return 0;
+}
+
+/**
+   @brief  Free the tables of a 16-bit fixed-point DCT plan.
+   @param[in]   plan    points to a plan created with plp_dct_plan_create_q16
+   @return      none
+*/
+void plp_dct_plan_destroy_q16(plp_dct_plan_q16 *plan) {
+    void *pTables[4] = { plan->pSplit, plan->pShift, plan->pPre, plan->pPost };
+
+    plp_dct_plan_free_tables(pTables, plan->len, sizeof(int16_t), plan->fft.mem);
+    plp_cfft_plan_destroy_q16(&plan->fft);
+    plan->pSplit = NULL;
+    plan->pShift = NULL;
+    plan->pPre = NULL;
+    plan->pPost = NULL;
+}
+
+/**
+   @brief  Create a 32-bit fixed-point DCT plan (DCT-II, DCT-III and DCT-IV), generating the
+   twiddle factors of the pre- and post-processing and the CFFT plan of len/2 points.
+   @param[out]  plan    points to the plan
+   @param[in]   len     number of points, len/2 must be a length supported by
+                        plp_cfft_plan_create_q32
+   @param[in]   mem     memory in which the tables are allocated
+   @return      0 on success, -1 if the length is not supported or the allocation failed
+*/
+int32_t plp_dct_plan_create_q32(plp_dct_plan_q32 *plan, uint32_t len, plp_fft_plan_mem mem) {
+    void *pTables[4];
+
+    if (plp_dct_plan_check(len) != 0 || plp_cfft_plan_create_q32(&plan->fft, len / 2, mem) != 0) {
+        return -1;
+    }
+
+    if (plp_dct_plan_tables(pTables, PLP_DCT_PLAN_Q32, len, sizeof(int32_t), mem) != 0) {
+        plp_cfft_plan_destroy_q32(&plan->fft);
+        return -1;
+    }
+
+    plan->len = len;
+    plan->pSplit = pTables[0];
+    plan->pShift = pTables[1];
+    plan->pPre = pTables[2];
+    plan->pPost = pTables[3];
+    return 0;
+}
+
+/**
+   @brief  Free the tables of a 32-bit fixed-point DCT plan.
+   @param[in]   plan    points to a plan created with plp_dct_plan_create_q32
+   @return      none
+*/
+void plp_dct_plan_destroy_q32(plp_dct_plan_q32 *plan) {
+    void *pTables[4] = { plan->pSplit, plan->pShift, plan->pPre, plan->pPost };
+
+    plp_dct_plan_free_tables(pTables, plan->len, sizeof(int32_t), plan->fft.mem);
+    plp_cfft_plan_destroy_q32(&plan->fft);
+    plan->pSplit = NULL;
+    plan->pShift = NULL;
+    plan->pPre = NULL;
+    plan->pPost = NULL;
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,230 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_dwt2d_q8.c
+ * Description:  8bit Fixed-point 2D Discrete Wavelet Transform and its inverse
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+
+#include "plp_math.h"
+#include "plp_dwt_common.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup dwt
+   @{
+*/
+
+/**
+   @brief  8bit Fixed-point 2D DWT of an image.
+
+   Separable single level decomposition: the 1D DWT is applied to every row and then to every
+   column of the result, with the boundary extension mode along both dimensions. The four outputs
+   have PLP_DWT_OUTPUT_LENGTH(rows, wavelet.length) rows and PLP_DWT_OUTPUT_LENGTH(cols,
+   wavelet.length) columns and follow the naming of pywt.dwt2:
+
+   - pDstA (LL): low pass along the rows and the columns
+   - pDstH (LH): low pass along the rows, high pass along the columns
+   - pDstV (HL): high pass along the rows, low pass along the columns
+   - pDstD (HH): high pass along the rows and the columns
+
+   The image, pTemp and the outputs are expected in L2 and pBuffer in L1. Every row is moved to
+   pBuffer by DMA and the columns are gathered and scattered in tiles of PLP_DWT2D_TILE_COLS
+   adjacent columns with 2D transfers, so the image is never transposed in L2.
+
+   On the fabric controller the lines are accessed directly and the columns are copied to pBuffer
+   by the core, so the buffers can be in any memory there.
+
+   @param[in]   pSrc     points to the input image, row major (L2)
+   @param[in]   rows     number of rows of the image
+   @param[in]   cols     number of columns of the image
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @param[in]   mode     boundary extension mode
+   @param[in]   pBuffer  points to a buffer of PLP_DWT2D_BUFFER_LENGTH(rows, cols, wavelet.length) values (L1)
+   @param[in]   pTemp    points to a buffer of 2*rows*PLP_DWT_OUTPUT_LENGTH(cols, wavelet.length) values (L2)
+   @param[out]  pDstA    points to the Approximate coefficients (LL)
+   @param[out]  pDstH    points to the Horizontal detail coefficients (LH)
+   @param[out]  pDstV    points to the Vertical detail coefficients (HL)
+   @param[out]  pDstD    points to the Diagonal detail coefficients (HH)
+   @return      none
+*/
+void plp_dwt2d_q8(const int8_t *__restrict__ pSrc,
+                  uint32_t rows,
+                  uint32_t cols,
+                  const plp_dwt_wavelet_q8 wavelet,
+                  plp_dwt_extension_mode mode,
+                  int8_t *__restrict__ pBuffer,
+                  int8_t *__restrict__ pTemp,
+                  int8_t *__restrict__ pDstA,
+                  int8_t *__restrict__ pDstH,
+                  int8_t *__restrict__ pDstV,
+                  int8_t *__restrict__ pDstD) {
+   PLP_PROFILE_FUNC();
+
+   if((mode == PLP_DWT_MODE_ANTIREFLECT || mode == PLP_DWT_MODE_REFLECT) && (rows <= 1 || cols <= 1)){
+      printf("F Cannot run [anti]reflect mode on length 1 signal.\n");
+      return;
+   }
+
+   int8_t *dec_hi_l1;
+   int8_t *dec_lo_l1;
+
+   plp_dwt2d_instance_q8 args = {
+      .pSrc = pSrc,
+      .rows = rows,
+      .cols = cols,
+      .wavelet = wavelet,
+      .mode = mode,
+      .nPE = 1,
+      .pBuffer = pBuffer,
+      .pTemp = pTemp,
+      .pDstA = pDstA,
+      .pDstH = pDstH,
+      .pDstV = pDstV,
+      .pDstD = pDstD
+   };
+
+   if (hal_cluster_id() == ARCHI_FC_CID) {
+      plp_dwt2d_q8s_rv32im(&args);
+   } else {
+      switch(wavelet.type) {
+      case PLP_DWT_WAVELET_HAAR:
+      case PLP_DWT_WAVELET_DB1:
+         plp_dwt2d_q8s_xpulpv2(&args);
+         break;
+      default:
+         dec_hi_l1 = plp_l1_scratch_alloc(sizeof(int8_t) * (wavelet.length));
+         dec_lo_l1 = plp_l1_scratch_alloc(sizeof(int8_t) * (wavelet.length));
+
+         copy_coefs_q8(dec_hi_l1, dec_lo_l1, wavelet);
+         args.wavelet = (plp_dwt_wavelet_q8){
+            .length = wavelet.length,
+            .type = wavelet.type,
+            .dec_hi = dec_hi_l1,
+            .dec_lo = dec_lo_l1
+         };
+
+         plp_dwt2d_q8s_xpulpv2(&args);
+
+         plp_l1_scratch_free(dec_hi_l1, sizeof(int8_t) * (wavelet.length));
+         plp_l1_scratch_free(dec_lo_l1, sizeof(int8_t) * (wavelet.length));
+         break;
+      }
+   }
+}
+
+
+/**
+   @brief  8bit Fixed-point inverse 2D DWT.
+
+   Reconstructs an image of PLP_IDWT_OUTPUT_LENGTH(rows, wavelet.length) rows and
+   PLP_IDWT_OUTPUT_LENGTH(cols, wavelet.length) columns from the four outputs of plp_dwt2d_q8.
+   The columns are reconstructed first (A with H and V with D) and then the rows, the wavelet has
+   to be orthogonal as for plp_idwt_q8.
+
+   On the fabric controller the lines are accessed directly and the columns are copied to pBuffer
+   by the core, so the buffers can be in any memory there.
+
+   @param[in]   pSrcA    points to the Approximate coefficients (L2)
+   @param[in]   pSrcH    points to the Horizontal detail coefficients (L2)
+   @param[in]   pSrcV    points to the Vertical detail coefficients (L2)
+   @param[in]   pSrcD    points to the Diagonal detail coefficients (L2)
+   @param[in]   rows     number of rows of each coefficient matrix
+   @param[in]   cols     number of columns of each coefficient matrix
+   @param[in]   wavelet  wavelet structure used for the decomposition
+   @param[in]   pBuffer  points to a buffer of PLP_IDWT2D_BUFFER_LENGTH(rows, cols, wavelet.length) values (L1)
+   @param[in]   pTemp    points to a buffer of 2*PLP_IDWT_OUTPUT_LENGTH(rows, wavelet.length)*cols values (L2)
+   @param[out]  pDst     points to the reconstructed image (L2)
+   @return      none
+*/
+void plp_idwt2d_q8(const int8_t *__restrict__ pSrcA,
+                  const int8_t *__restrict__ pSrcH,
+                  const int8_t *__restrict__ pSrcV,
+                  const int8_t *__restrict__ pSrcD,
+                  uint32_t rows,
+                  uint32_t cols,
+                  const plp_dwt_wavelet_q8 wavelet,
+                  int8_t *__restrict__ pBuffer,
+                  int8_t *__restrict__ pTemp,
+                  int8_t *__restrict__ pDst) {
+   PLP_PROFILE_FUNC();
+
+   if(2 * rows + 2 <= wavelet.length || 2 * cols + 2 <= wavelet.length){
+      printf("error: not enough coefficients for the wavelet length\n");
+      return;
+   }
+
+   int8_t *dec_hi_l1;
+   int8_t *dec_lo_l1;
+
+   plp_idwt2d_instance_q8 args = {
+      .pSrcA = pSrcA,
+      .pSrcH = pSrcH,
+      .pSrcV = pSrcV,
+      .pSrcD = pSrcD,
+      .rows = rows,
+      .cols = cols,
+      .wavelet = wavelet,
+      .nPE = 1,
+      .pBuffer = pBuffer,
+      .pTemp = pTemp,
+      .pDst = pDst
+   };
+
+   if (hal_cluster_id() == ARCHI_FC_CID) {
+      plp_idwt2d_q8s_rv32im(&args);
+   } else {
+      switch(wavelet.type) {
+      case PLP_DWT_WAVELET_HAAR:
+      case PLP_DWT_WAVELET_DB1:
+         plp_idwt2d_q8s_xpulpv2(&args);
+         break;
+      default:
+         dec_hi_l1 = plp_l1_scratch_alloc(sizeof(int8_t) * (wavelet.length));
+         dec_lo_l1 = plp_l1_scratch_alloc(sizeof(int8_t) * (wavelet.length));
+
+         copy_coefs_q8(dec_hi_l1, dec_lo_l1, wavelet);
+         args.wavelet = (plp_dwt_wavelet_q8){
+            .length = wavelet.length,
+            .type = wavelet.type,
+            .dec_hi = dec_hi_l1,
+            .dec_lo = dec_lo_l1
+         };
+
+         plp_idwt2d_q8s_xpulpv2(&args);
+
+         plp_l1_scratch_free(dec_hi_l1, sizeof(int8_t) * (wavelet.length));
+         plp_l1_scratch_free(dec_lo_l1, sizeof(int8_t) * (wavelet.length));
+         break;
+      }
+   }
+}
+
+/**
+   @} end of DWT group
+*/
@@ -88,6 +88,112 @@ uint32_t plp_dwt_dec_len(uint32_t sig_len, uint32_t wavelet_len, uint32_t level)
 }
 
 
+/**
+   @brief  Number of levels plp_dwt_dec_f32 decomposes a signal into
+   @param[in]   sig_len      length of input signal
+   @param[in]   wavelet_len  wavelet length
+   @param[in]   level        requested decomposition level (0 for maximal decomposition)
+   @return      Number of levels of the decomposition output
+*/
+uint32_t plp_dwt_levels(uint32_t sig_len, uint32_t wavelet_len, uint32_t level){
+
+   uint32_t levels = 0;
+   uint32_t quotient = sig_len/(wavelet_len - 1) >> 1;
+
+   do {
+      levels++;
+      level--; // In the case that level was 0, it will underflow, as in plp_dwt_dec_len
+   } while((quotient >>= 1) && level > 0);
+
+   return levels;
+}
+
+
+/**
+   @brief  Length of the coefficient bands of a decomposition level
+   @param[in]   sig_len      length of input signal
+   @param[in]   wavelet_len  wavelet length
+   @param[in]   level        decomposition level, 0 for the signal itself
+   @return      Length of the approximate and detailed coefficients of the level
+*/
+uint32_t plp_dwt_level_len(uint32_t sig_len, uint32_t wavelet_len, uint32_t level){
+
+   while(level-- > 0){
+      sig_len = PLP_DWT_OUTPUT_LENGTH(sig_len, wavelet_len);
+   }
+
+   return sig_len;
+}
+
+
+/**
+   @brief  Scratch memory needed by plp_dwt_f32, plp_dwt_dec_f32, plp_idwt_f32, plp_dwt_rec_f32 and
+           their parallel variants (see plp_l1_arena_use).
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @return      number of bytes
+*/
+uint32_t plp_dwt_f32_get_workspace_size(const plp_dwt_wavelet_f32 wavelet){
+   switch(wavelet.type) {
+   case PLP_DWT_WAVELET_HAAR:
+   case PLP_DWT_WAVELET_DB1:
+      return 0;
+   default:
+      return 2 * PLP_L1_ARENA_SIZE(sizeof(float32_t) * wavelet.length);
+   }
+}
+
+
+/**
+   @brief  Scratch memory needed by plp_dwt_q32, plp_dwt_dec_q32, plp_idwt_q32, plp_dwt_rec_q32 and
+           their parallel variants (see plp_l1_arena_use).
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @return      number of bytes
+*/
+uint32_t plp_dwt_q32_get_workspace_size(const plp_dwt_wavelet_q32 wavelet){
+   switch(wavelet.type) {
+   case PLP_DWT_WAVELET_HAAR:
+   case PLP_DWT_WAVELET_DB1:
+      return 0;
+   default:
+      return 2 * PLP_L1_ARENA_SIZE(sizeof(int32_t) * wavelet.length);
+   }
+}
+
+
+/**
+   @brief  Scratch memory needed by plp_dwt_q16, plp_dwt_dec_q16, plp_idwt_q16, plp_dwt_rec_q16 and
+           their parallel variants (see plp_l1_arena_use).
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @return      number of bytes
+*/
+uint32_t plp_dwt_q16_get_workspace_size(const plp_dwt_wavelet_q16 wavelet){
+   switch(wavelet.type) {
+   case PLP_DWT_WAVELET_HAAR:
+   case PLP_DWT_WAVELET_DB1:
+      return 0;
+   default:
+      return 2 * PLP_L1_ARENA_SIZE(sizeof(int16_t) * wavelet.length);
+   }
+}
+
+
+/**
+   @brief  Scratch memory needed by plp_dwt_q8, plp_dwt_dec_q8, plp_idwt_q8, plp_dwt_rec_q8 and
+           their parallel variants (see plp_l1_arena_use).
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @return      number of bytes
+*/
+uint32_t plp_dwt_q8_get_workspace_size(const plp_dwt_wavelet_q8 wavelet){
+   switch(wavelet.type) {
+   case PLP_DWT_WAVELET_HAAR:
+   case PLP_DWT_WAVELET_DB1:
+      return 0;
+   default:
+      return 2 * PLP_L1_ARENA_SIZE(sizeof(int8_t) * wavelet.length);
+   }
+}
+
+
 /**
    @} end of dwt_common group
 */
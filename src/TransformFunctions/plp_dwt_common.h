@@ -38,9 +38,9 @@ static inline void copy_coefs_q32(int32_t *dec_hi_l1, int32_t *dec_lo_l1, plp_dw
 
    int32_t merge = 0;
 
-   hal_cl_dma_cmd((uint32_t)wavelet.dec_hi, (uint32_t)dec_hi_l1, sizeof(int32_t) * wavelet.length, HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
+   hal_cl_dma_cmd((uintptr_t)wavelet.dec_hi, (uintptr_t)dec_hi_l1, sizeof(int32_t) * wavelet.length, HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
    merge = 1;
-   hal_cl_dma_cmd((uint32_t)wavelet.dec_lo, (uint32_t)dec_lo_l1, sizeof(int32_t) * wavelet.length, HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
+   hal_cl_dma_cmd((uintptr_t)wavelet.dec_lo, (uintptr_t)dec_lo_l1, sizeof(int32_t) * wavelet.length, HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
 
 
    hal_cl_dma_cmd_wait(&copy);
@@ -52,9 +52,9 @@ static inline void copy_coefs_f32(float32_t *dec_hi_l1, float32_t *dec_lo_l1, pl
 
    int32_t merge = 0;
 
-   hal_cl_dma_cmd((uint32_t)wavelet.dec_hi, (uint32_t)dec_hi_l1, sizeof(float32_t) * wavelet.length, HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
+   hal_cl_dma_cmd((uintptr_t)wavelet.dec_hi, (uintptr_t)dec_hi_l1, sizeof(float32_t) * wavelet.length, HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
    merge = 1;
-   hal_cl_dma_cmd((uint32_t)wavelet.dec_lo, (uint32_t)dec_lo_l1, sizeof(float32_t) * wavelet.length, HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
+   hal_cl_dma_cmd((uintptr_t)wavelet.dec_lo, (uintptr_t)dec_lo_l1, sizeof(float32_t) * wavelet.length, HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
 
 
    hal_cl_dma_cmd_wait(&copy);
@@ -66,9 +66,9 @@ static inline void copy_coefs_q16(int16_t *dec_hi_l1, int16_t *dec_lo_l1, plp_dw
 
    int32_t merge = 0;
 
-   hal_cl_dma_cmd((uint32_t)wavelet.dec_hi, (uint32_t)dec_hi_l1, sizeof(int16_t) * wavelet.length, HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
+   hal_cl_dma_cmd((uintptr_t)wavelet.dec_hi, (uintptr_t)dec_hi_l1, sizeof(int16_t) * wavelet.length, HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
    merge = 1;
-   hal_cl_dma_cmd((uint32_t)wavelet.dec_lo, (uint32_t)dec_lo_l1, sizeof(int16_t) * wavelet.length, HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
+   hal_cl_dma_cmd((uintptr_t)wavelet.dec_lo, (uintptr_t)dec_lo_l1, sizeof(int16_t) * wavelet.length, HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
 
 
    hal_cl_dma_cmd_wait(&copy);
@@ -80,9 +80,9 @@ static inline void copy_coefs_q8(int8_t *dec_hi_l1, int8_t *dec_lo_l1, plp_dwt_w
 
    int32_t merge = 0;
 
-   hal_cl_dma_cmd((uint32_t)wavelet.dec_hi, (uint32_t)dec_hi_l1, sizeof(int8_t) * wavelet.length, HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
+   hal_cl_dma_cmd((uintptr_t)wavelet.dec_hi, (uintptr_t)dec_hi_l1, sizeof(int8_t) * wavelet.length, HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
    merge = 1;
-   hal_cl_dma_cmd((uint32_t)wavelet.dec_lo, (uint32_t)dec_lo_l1, sizeof(int8_t) * wavelet.length, HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
+   hal_cl_dma_cmd((uintptr_t)wavelet.dec_lo, (uintptr_t)dec_lo_l1, sizeof(int8_t) * wavelet.length, HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
 
 
    hal_cl_dma_cmd_wait(&copy);
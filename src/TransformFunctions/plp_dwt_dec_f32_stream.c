@@ -0,0 +1,184 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_dwt_dec_f32_stream.c
+ * Description:  Floating-point multilevel DWT streamed through L1 in a single pass
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+#include "plp_dwt_common.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup dwt
+   @{
+*/
+
+#define PLP_DWT_STREAM_TILE_LEN (PLP_STREAM_TILE_SIZE / sizeof(float32_t))
+
+/* Largest number of samples which one step appends to the window of each level, see
+ * plp_dwt_dec_stream_f32p_xpulpv2. A window holds at most 3 * wavelet.length samples besides them. */
+static inline uint32_t plp_dwt_stream_window_len(uint32_t *push, uint32_t in_len, uint32_t wlen) {
+   uint32_t len = (*push < in_len ? *push : in_len) + 3 * wlen;
+
+   *push = ((*push + 2 * wlen) >> 1) + 1;
+   return len;
+}
+
+/**
+   @brief  Scratch memory needed by plp_dwt_dec_f32_stream (see plp_l1_arena_use).
+   @param[in]   length   length of the input signal
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @param[in]   level    levels of wavelet decomposition (0 for maximal decomposition)
+   @return      number of bytes
+*/
+uint32_t plp_dwt_dec_f32_stream_get_workspace_size(uint32_t length,
+                                                   const plp_dwt_wavelet_f32 wavelet,
+                                                   uint32_t level){
+   uint32_t levels = plp_dwt_levels(length, wavelet.length, level);
+   uint32_t push = PLP_DWT_STREAM_TILE_LEN;
+   uint32_t size = 2 * PLP_L1_ARENA_SIZE(PLP_STREAM_TILE_SIZE)
+                 + 2 * PLP_L1_ARENA_SIZE(sizeof(float32_t) * wavelet.length)
+                 + PLP_L1_ARENA_SIZE(sizeof(plp_dwt_stream_level_f32) * levels);
+
+   for(uint32_t l = 0; l < levels; l++){
+      uint32_t in_len = plp_dwt_level_len(length, wavelet.length, l);
+      size += PLP_L1_ARENA_SIZE(sizeof(float32_t) * plp_dwt_stream_window_len(&push, in_len, wavelet.length));
+   }
+
+   return size;
+}
+
+/**
+   @brief  Floating-point n-level DWT streamed through L1 in a single pass.
+
+   Computes the same decomposition as plp_dwt_dec_f32, without a temporary buffer and with a
+   single fork of the cluster team. The input is loaded into L1 in tiles of
+   PLP_STREAM_TILE_SIZE bytes with the cluster DMA, such that it can be larger than L1. Every
+   tile is filtered through all the levels before the next one is processed: each level keeps a
+   window of its input in L1, which is fed with the Approximate coefficients of the level above,
+   so the intermediate Approximate coefficients never go through L2.
+
+   @param[in]   pSrc     points to the input buffer (L2)
+   @param[in]   length   length of input buffer
+   @param[in]   wavelet  wavelet structure for calculating DWT
+   @param[in]   mode     boundary extension mode
+   @param[in]   level    Levels of Wavelet decomposition (0 for maximal decomposition)
+   @param[in]   nPE      Number of cores to use
+
+   @param[out]  pDst     points to ouput buffer with Detailed coefficients and final approximate,
+                         [D1 D2 ... DL AL] of PLP_DWT_DEC_LEN(length, wavelet, level) values
+   @return      none
+*/
+void plp_dwt_dec_f32_stream(const float32_t *__restrict__ pSrc,
+                     uint32_t length,
+                     const plp_dwt_wavelet_f32 wavelet,
+                     plp_dwt_extension_mode mode,
+                     uint32_t level,
+                     uint32_t nPE,
+                     float32_t *__restrict__ pDst){
+   PLP_PROFILE_FUNC();
+   if((mode == PLP_DWT_MODE_ANTIREFLECT || mode == PLP_DWT_MODE_REFLECT) && length <= 1){
+      printf("F Cannot run [anti]reflect mode on length 1 signal.\n");
+      return;
+   }
+
+   if (hal_cluster_id() == ARCHI_FC_CID && plp_fc_cluster_open() != 0) {
+      printf("parallel processing supported only for cluster side\n");
+      return;
+   } else {
+      uint32_t levels = plp_dwt_levels(length, wavelet.length, level);
+      uint32_t ws_size = plp_dwt_dec_f32_stream_get_workspace_size(length, wavelet, level);
+
+      uint8_t *pWs = (uint8_t *)plp_l1_scratch_alloc(ws_size);
+      if (pWs == NULL) {
+         printf("error: not enough L1 memory for streaming\n");
+         return;
+      }
+      uint8_t *pNext = pWs;
+
+      plp_dwt_dec_stream_instance_f32 args = {
+         .pSrc = pSrc,
+         .length = length,
+         .mode = mode,
+         .levels = levels,
+         .nPE = nPE,
+         .tileLen = PLP_DWT_STREAM_TILE_LEN
+      };
+
+      args.pTile[0] = (float32_t *)pNext;
+      pNext += PLP_L1_ARENA_SIZE(PLP_STREAM_TILE_SIZE);
+      args.pTile[1] = (float32_t *)pNext;
+      pNext += PLP_L1_ARENA_SIZE(PLP_STREAM_TILE_SIZE);
+
+      float32_t *dec_hi_l1 = (float32_t *)pNext;
+      pNext += PLP_L1_ARENA_SIZE(sizeof(float32_t) * wavelet.length);
+      float32_t *dec_lo_l1 = (float32_t *)pNext;
+      pNext += PLP_L1_ARENA_SIZE(sizeof(float32_t) * wavelet.length);
+
+      copy_coefs_f32(dec_hi_l1, dec_lo_l1, wavelet);
+      args.wavelet = (plp_dwt_wavelet_f32){
+         .length = wavelet.length,
+         .type = wavelet.type,
+         .dec_hi = dec_hi_l1,
+         .dec_lo = dec_lo_l1
+      };
+
+      args.pLevels = (plp_dwt_stream_level_f32 *)pNext;
+      pNext += PLP_L1_ARENA_SIZE(sizeof(plp_dwt_stream_level_f32) * levels);
+
+      uint32_t push = PLP_DWT_STREAM_TILE_LEN;
+      uint32_t dst_offset = 0;
+
+      for(uint32_t l = 0; l < levels; l++){
+         uint32_t in_len = plp_dwt_level_len(length, wavelet.length, l);
+         uint32_t win_len = plp_dwt_stream_window_len(&push, in_len, wavelet.length);
+
+         args.pLevels[l] = (plp_dwt_stream_level_f32){
+            .pWin = (float32_t *)pNext,
+            .pDstD = pDst + dst_offset,
+            .inLen = in_len,
+            .outLen = PLP_DWT_OUTPUT_LENGTH(in_len, wavelet.length),
+            .fill = wavelet.length - 2 // Reserved for the left edge extension
+         };
+         pNext += PLP_L1_ARENA_SIZE(sizeof(float32_t) * win_len);
+
+         dst_offset += args.pLevels[l].outLen;
+      }
+
+      args.pDstA = pDst + dst_offset;
+
+      plp_cl_team_fork(nPE, plp_dwt_dec_stream_f32p_xpulpv2, (void *)&args);
+
+      plp_l1_scratch_free(pWs, ws_size);
+   }
+}
+
+/**
+   @} end of DWT group
+*/
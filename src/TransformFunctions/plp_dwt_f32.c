@@ -67,6 +67,7 @@ void plp_dwt_f32(const float32_t *__restrict__ pSrc,
                  plp_dwt_extension_mode mode,
                  float32_t *__restrict__ pDstA,
                  float32_t *__restrict__ pDstD) {
+   PLP_PROFILE_FUNC();
 
    if((mode == PLP_DWT_MODE_ANTIREFLECT || mode == PLP_DWT_MODE_REFLECT) && length <= 1){
       printf("F Cannot run [anti]reflect mode on length 1 signal.\n");
@@ -87,8 +88,8 @@ void plp_dwt_f32(const float32_t *__restrict__ pSrc,
          plp_dwt_haar_f32s_xpulpv2(pSrc, length, mode, pDstA, pDstD);
          break;
       default:
-         dec_hi_l1 = hal_cl_l1_malloc(sizeof(float32_t) * (wavelet.length));
-         dec_lo_l1 = hal_cl_l1_malloc(sizeof(float32_t) * (wavelet.length));
+         dec_hi_l1 = plp_l1_scratch_alloc(sizeof(float32_t) * (wavelet.length));
+         dec_lo_l1 = plp_l1_scratch_alloc(sizeof(float32_t) * (wavelet.length));
 
          copy_coefs_f32(dec_hi_l1, dec_lo_l1, wavelet);
          temp_wavelet = (plp_dwt_wavelet_f32){
@@ -100,8 +101,8 @@ void plp_dwt_f32(const float32_t *__restrict__ pSrc,
 
          plp_dwt_f32s_xpulpv2(pSrc, length, temp_wavelet, mode, pDstA, pDstD);
          
-         hal_cl_l1_free(dec_hi_l1, sizeof(float32_t) * (wavelet.length) );
-         hal_cl_l1_free(dec_lo_l1, sizeof(float32_t) * (wavelet.length) );
+         plp_l1_scratch_free(dec_hi_l1, sizeof(float32_t) * (wavelet.length) );
+         plp_l1_scratch_free(dec_lo_l1, sizeof(float32_t) * (wavelet.length) );
          break;
       }
    }
@@ -116,6 +117,7 @@ void plp_dwt_dec_f32(const float32_t *__restrict__ pSrc,
                      uint32_t level,
                      float32_t *__restrict__ pTemp,
                      float32_t *__restrict__ pDst){
+   PLP_PROFILE_FUNC();
    if((mode == PLP_DWT_MODE_ANTIREFLECT || mode == PLP_DWT_MODE_REFLECT) && length <= 1){
       printf("F Cannot run [anti]reflect mode on length 1 signal.\n");
       return;
@@ -143,8 +145,8 @@ void plp_dwt_dec_f32(const float32_t *__restrict__ pSrc,
       case PLP_DWT_WAVELET_DB1:
          break;
       default:
-         dec_hi_l1 = hal_cl_l1_malloc(sizeof(float32_t) * (wavelet.length));
-         dec_lo_l1 = hal_cl_l1_malloc(sizeof(float32_t) * (wavelet.length));
+         dec_hi_l1 = plp_l1_scratch_alloc(sizeof(float32_t) * (wavelet.length));
+         dec_lo_l1 = plp_l1_scratch_alloc(sizeof(float32_t) * (wavelet.length));
          copy_coefs_f32(dec_hi_l1, dec_lo_l1, wavelet);
 
          temp_wavelet = (plp_dwt_wavelet_f32){
@@ -223,8 +225,8 @@ void plp_dwt_dec_f32(const float32_t *__restrict__ pSrc,
       case PLP_DWT_WAVELET_DB1:
          break;
       default:
-         hal_cl_l1_free(dec_hi_l1, sizeof(float32_t) * (wavelet.length) );
-         hal_cl_l1_free(dec_lo_l1, sizeof(float32_t) * (wavelet.length) );
+         plp_l1_scratch_free(dec_hi_l1, sizeof(float32_t) * (wavelet.length) );
+         plp_l1_scratch_free(dec_lo_l1, sizeof(float32_t) * (wavelet.length) );
          break;
       }
       // hal_cl_dma_cmd_wait(&copy);
@@ -66,6 +66,7 @@ void plp_dwt_f32_parallel(const float32_t *__restrict__ pSrc,
                  uint32_t nPE,
                  float32_t *__restrict__ pDstA,
                  float32_t *__restrict__ pDstD) {
+   PLP_PROFILE_FUNC();
 
    if((mode == PLP_DWT_MODE_ANTIREFLECT || mode == PLP_DWT_MODE_REFLECT) && length <= 1){
       printf("F Cannot run [anti]reflect mode on length 1 signal.\n");
@@ -76,7 +77,7 @@ void plp_dwt_f32_parallel(const float32_t *__restrict__ pSrc,
    float32_t *dec_lo_l1;
    plp_dwt_wavelet_f32 temp_wavelet;
 
-   if (hal_cluster_id() == ARCHI_FC_CID) {
+   if (hal_cluster_id() == ARCHI_FC_CID && plp_fc_cluster_open() != 0) {
       printf("parallel processing supported only for cluster side\n");
       return;
    } else {
@@ -93,12 +94,12 @@ void plp_dwt_f32_parallel(const float32_t *__restrict__ pSrc,
       switch(wavelet.type) {
       case PLP_DWT_WAVELET_HAAR:
       case PLP_DWT_WAVELET_DB1:
-         hal_cl_team_fork(nPE, plp_dwt_haar_f32p_xpulpv2, (void *)&args);
+         plp_cl_team_fork(nPE, plp_dwt_haar_f32p_xpulpv2, (void *)&args);
          break;
       default:
 
-         dec_hi_l1 = hal_cl_l1_malloc(sizeof(float32_t) * (wavelet.length));
-         dec_lo_l1 = hal_cl_l1_malloc(sizeof(float32_t) * (wavelet.length));
+         dec_hi_l1 = plp_l1_scratch_alloc(sizeof(float32_t) * (wavelet.length));
+         dec_lo_l1 = plp_l1_scratch_alloc(sizeof(float32_t) * (wavelet.length));
 
          copy_coefs_f32(dec_hi_l1, dec_lo_l1, wavelet);
          temp_wavelet = (plp_dwt_wavelet_f32){
@@ -110,9 +111,9 @@ void plp_dwt_f32_parallel(const float32_t *__restrict__ pSrc,
 
          args.wavelet = temp_wavelet;
 
-         hal_cl_team_fork(nPE, plp_dwt_f32p_xpulpv2, (void *)&args);
-         hal_cl_l1_free(dec_hi_l1, sizeof(float32_t) * (wavelet.length) );
-         hal_cl_l1_free(dec_lo_l1, sizeof(float32_t) * (wavelet.length) );
+         plp_cl_team_fork(nPE, plp_dwt_f32p_xpulpv2, (void *)&args);
+         plp_l1_scratch_free(dec_hi_l1, sizeof(float32_t) * (wavelet.length) );
+         plp_l1_scratch_free(dec_lo_l1, sizeof(float32_t) * (wavelet.length) );
          break;
       }
    }
@@ -130,12 +131,13 @@ void plp_dwt_dec_f32_parallel(const float32_t *__restrict__ pSrc,
                      uint32_t nPE,
                      float32_t *__restrict__ pTemp,
                      float32_t *__restrict__ pDst){
+   PLP_PROFILE_FUNC();
    if((mode == PLP_DWT_MODE_ANTIREFLECT || mode == PLP_DWT_MODE_REFLECT) && length <= 1){
       printf("F Cannot run [anti]reflect mode on length 1 signal.\n");
       return;
    }
 
-   if (hal_cluster_id() == ARCHI_FC_CID) {
+   if (hal_cluster_id() == ARCHI_FC_CID && plp_fc_cluster_open() != 0) {
       printf("error: FC doesn't have FPU\n");
       return;
    } else {
@@ -159,8 +161,8 @@ void plp_dwt_dec_f32_parallel(const float32_t *__restrict__ pSrc,
          case PLP_DWT_WAVELET_DB1:
             break;
          default:
-            dec_hi_l1 = hal_cl_l1_malloc(sizeof(float32_t) * (wavelet.length));
-            dec_lo_l1 = hal_cl_l1_malloc(sizeof(float32_t) * (wavelet.length));
+            dec_hi_l1 = plp_l1_scratch_alloc(sizeof(float32_t) * (wavelet.length));
+            dec_lo_l1 = plp_l1_scratch_alloc(sizeof(float32_t) * (wavelet.length));
             copy_coefs_f32(dec_hi_l1, dec_lo_l1, wavelet);
 
             args.wavelet = (plp_dwt_wavelet_f32){
@@ -203,10 +205,10 @@ void plp_dwt_dec_f32_parallel(const float32_t *__restrict__ pSrc,
          switch(wavelet.type) {
          case PLP_DWT_WAVELET_HAAR:
          case PLP_DWT_WAVELET_DB1:
-            hal_cl_team_fork(nPE, plp_dwt_haar_f32p_xpulpv2, (void *)&args);
+            plp_cl_team_fork(nPE, plp_dwt_haar_f32p_xpulpv2, (void *)&args);
             break;
          default:
-            hal_cl_team_fork(nPE, plp_dwt_f32p_xpulpv2, (void *)&args);
+            plp_cl_team_fork(nPE, plp_dwt_f32p_xpulpv2, (void *)&args);
             break;
          }
          
@@ -237,8 +239,8 @@ void plp_dwt_dec_f32_parallel(const float32_t *__restrict__ pSrc,
       case PLP_DWT_WAVELET_DB1:
          break;
       default:
-         hal_cl_l1_free(dec_hi_l1, sizeof(float32_t) * (wavelet.length) );
-         hal_cl_l1_free(dec_lo_l1, sizeof(float32_t) * (wavelet.length) );
+         plp_l1_scratch_free(dec_hi_l1, sizeof(float32_t) * (wavelet.length) );
+         plp_l1_scratch_free(dec_lo_l1, sizeof(float32_t) * (wavelet.length) );
          break;
       }
    }
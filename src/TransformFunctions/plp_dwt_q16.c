@@ -64,6 +64,7 @@ void plp_dwt_q16(const int16_t *__restrict__ pSrc,
                  plp_dwt_extension_mode mode,
                  int16_t *__restrict__ pDstA,
                  int16_t *__restrict__ pDstD) {
+   PLP_PROFILE_FUNC();
 
    if((mode == PLP_DWT_MODE_ANTIREFLECT || mode == PLP_DWT_MODE_REFLECT) && length <= 1){
       printf("F Cannot run [anti]reflect mode on length 1 signal.\n");
@@ -91,8 +92,8 @@ void plp_dwt_q16(const int16_t *__restrict__ pSrc,
          plp_dwt_haar_q16s_xpulpv2(pSrc, length, mode, pDstA, pDstD);
          break;
       default:
-         dec_hi_l1 = hal_cl_l1_malloc(sizeof(int16_t) * (wavelet.length));
-         dec_lo_l1 = hal_cl_l1_malloc(sizeof(int16_t) * (wavelet.length));
+         dec_hi_l1 = plp_l1_scratch_alloc(sizeof(int16_t) * (wavelet.length));
+         dec_lo_l1 = plp_l1_scratch_alloc(sizeof(int16_t) * (wavelet.length));
 
          copy_coefs_q16(dec_hi_l1, dec_lo_l1, wavelet);
          temp_wavelet = (plp_dwt_wavelet_q16){
@@ -103,8 +104,8 @@ void plp_dwt_q16(const int16_t *__restrict__ pSrc,
          };
 
          plp_dwt_q16s_xpulpv2(pSrc, length, temp_wavelet, mode, pDstA, pDstD);
-         hal_cl_l1_free(dec_hi_l1, sizeof(int16_t) * (wavelet.length) );
-         hal_cl_l1_free(dec_lo_l1, sizeof(int16_t) * (wavelet.length) );
+         plp_l1_scratch_free(dec_hi_l1, sizeof(int16_t) * (wavelet.length) );
+         plp_l1_scratch_free(dec_lo_l1, sizeof(int16_t) * (wavelet.length) );
          break;
       }
    }
@@ -66,6 +66,7 @@ void plp_dwt_q16_parallel(const int16_t *__restrict__ pSrc,
                  uint32_t nPE,
                  int16_t *__restrict__ pDstA,
                  int16_t *__restrict__ pDstD) {
+   PLP_PROFILE_FUNC();
 
    if((mode == PLP_DWT_MODE_ANTIREFLECT || mode == PLP_DWT_MODE_REFLECT) && length <= 1){
       printf("F Cannot run [anti]reflect mode on length 1 signal.\n");
@@ -76,8 +77,8 @@ void plp_dwt_q16_parallel(const int16_t *__restrict__ pSrc,
    int16_t *dec_lo_l1;
    plp_dwt_wavelet_q16 temp_wavelet;
 
-   if (hal_cluster_id() == ARCHI_FC_CID) {
-      printf("parallel processing supported only for cluster side\n");
+   if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+      plp_dwt_q16(pSrc, length, wavelet, mode, pDstA, pDstD);
       return;
    } else {
       plp_dwt_instance_q16 args = {
@@ -93,11 +94,11 @@ void plp_dwt_q16_parallel(const int16_t *__restrict__ pSrc,
       switch(wavelet.type) {
       case PLP_DWT_WAVELET_HAAR:
       case PLP_DWT_WAVELET_DB1:
-         hal_cl_team_fork(nPE, plp_dwt_haar_q16p_xpulpv2, (void *)&args);
+         plp_cl_team_fork(nPE, plp_dwt_haar_q16p_xpulpv2, (void *)&args);
          break;
       default:
-         dec_hi_l1 = hal_cl_l1_malloc(sizeof(int16_t) * (wavelet.length));
-         dec_lo_l1 = hal_cl_l1_malloc(sizeof(int16_t) * (wavelet.length));
+         dec_hi_l1 = plp_l1_scratch_alloc(sizeof(int16_t) * (wavelet.length));
+         dec_lo_l1 = plp_l1_scratch_alloc(sizeof(int16_t) * (wavelet.length));
 
          copy_coefs_q16(dec_hi_l1, dec_lo_l1, wavelet);
          temp_wavelet = (plp_dwt_wavelet_q16){
@@ -109,10 +110,10 @@ void plp_dwt_q16_parallel(const int16_t *__restrict__ pSrc,
 
          args.wavelet = temp_wavelet;
 
-         hal_cl_team_fork(nPE, plp_dwt_q16p_xpulpv2, (void *)&args);
+         plp_cl_team_fork(nPE, plp_dwt_q16p_xpulpv2, (void *)&args);
 
-         hal_cl_l1_free(dec_hi_l1, sizeof(int16_t) * (wavelet.length) );
-         hal_cl_l1_free(dec_lo_l1, sizeof(int16_t) * (wavelet.length) );
+         plp_l1_scratch_free(dec_hi_l1, sizeof(int16_t) * (wavelet.length) );
+         plp_l1_scratch_free(dec_lo_l1, sizeof(int16_t) * (wavelet.length) );
          break;
       }
    }
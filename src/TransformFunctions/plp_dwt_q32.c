@@ -65,6 +65,7 @@ void plp_dwt_q32(const int32_t *__restrict__ pSrc,
                  plp_dwt_extension_mode mode,
                  int32_t *__restrict__ pDstA,
                  int32_t *__restrict__ pDstD) {
+   PLP_PROFILE_FUNC();
    
    if((mode == PLP_DWT_MODE_ANTIREFLECT || mode == PLP_DWT_MODE_REFLECT) && length <= 1){
       printf("F Cannot run [anti]reflect mode on length 1 signal.\n");
@@ -114,8 +115,8 @@ void plp_dwt_q32(const int32_t *__restrict__ pSrc,
          break;
       default:
 
-         dec_hi_l1 = hal_cl_l1_malloc(sizeof(int32_t) * (wavelet.length));
-         dec_lo_l1 = hal_cl_l1_malloc(sizeof(int32_t) * (wavelet.length));
+         dec_hi_l1 = plp_l1_scratch_alloc(sizeof(int32_t) * (wavelet.length));
+         dec_lo_l1 = plp_l1_scratch_alloc(sizeof(int32_t) * (wavelet.length));
 
          copy_coefs_q32(dec_hi_l1, dec_lo_l1, wavelet);
          temp_wavelet = (plp_dwt_wavelet_q32){
@@ -128,8 +129,8 @@ void plp_dwt_q32(const int32_t *__restrict__ pSrc,
 
          plp_dwt_q32s_xpulpv2(pSrc, length, temp_wavelet, mode, pDstA, pDstD);
 
-         hal_cl_l1_free(dec_hi_l1, sizeof(int32_t) * (wavelet.length) );
-         hal_cl_l1_free(dec_lo_l1, sizeof(int32_t) * (wavelet.length) );
+         plp_l1_scratch_free(dec_hi_l1, sizeof(int32_t) * (wavelet.length) );
+         plp_l1_scratch_free(dec_lo_l1, sizeof(int32_t) * (wavelet.length) );
          break;
       }
    }
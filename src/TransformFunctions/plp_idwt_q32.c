@@ -0,0 +1,227 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_idwt_q32.c
+ * Description:  32bit Fixed-point inverse Discrete Wavelet Transform and multilevel reconstruction
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+#include "plp_dwt_common.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup dwt
+   @{
+*/
+
+/**
+   @brief  32bit Fixed-point inverse DWT on real data.
+
+   Reconstructs PLP_IDWT_OUTPUT_LENGTH(length, wavelet.length) samples from one level of
+   coefficients computed by plp_dwt_q32. The reconstruction filters are derived from the
+   decomposition filters, so the wavelet has to be orthogonal (all built-in wavelets are).
+   The extension mode of the decomposition does not affect the reconstruction.
+
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   number of coefficients in each of pSrcA and pSrcD
+   @param[in]   wavelet  wavelet structure used for the decomposition
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
+   @return      none
+*/
+void plp_idwt_q32(const int32_t *__restrict__ pSrcA,
+                  const int32_t *__restrict__ pSrcD,
+                  uint32_t length,
+                  const plp_dwt_wavelet_q32 wavelet,
+                  int32_t *__restrict__ pDst) {
+   PLP_PROFILE_FUNC();
+
+   if(2 * length + 2 <= wavelet.length){
+      printf("error: not enough coefficients for the wavelet length\n");
+      return;
+   }
+
+   uint32_t out_len = PLP_IDWT_OUTPUT_LENGTH(length, wavelet.length);
+
+   int32_t *dec_hi_l1;
+   int32_t *dec_lo_l1;
+   plp_dwt_wavelet_q32 temp_wavelet;
+
+   if (hal_cluster_id() == ARCHI_FC_CID) {
+      switch(wavelet.type) {
+      case PLP_DWT_WAVELET_HAAR:
+      case PLP_DWT_WAVELET_DB1:
+         plp_idwt_haar_q32s_rv32im(pSrcA, pSrcD, out_len, pDst);
+         break;
+      default:
+         plp_idwt_q32s_rv32im(pSrcA, pSrcD, out_len, wavelet, pDst);
+         break;
+      }
+   } else {
+      switch(wavelet.type) {
+      case PLP_DWT_WAVELET_HAAR:
+      case PLP_DWT_WAVELET_DB1:
+         plp_idwt_haar_q32s_xpulpv2(pSrcA, pSrcD, out_len, pDst);
+         break;
+      default:
+         dec_hi_l1 = plp_l1_scratch_alloc(sizeof(int32_t) * (wavelet.length));
+         dec_lo_l1 = plp_l1_scratch_alloc(sizeof(int32_t) * (wavelet.length));
+
+         copy_coefs_q32(dec_hi_l1, dec_lo_l1, wavelet);
+         temp_wavelet = (plp_dwt_wavelet_q32){
+            .length = wavelet.length,
+            .type = wavelet.type,
+            .dec_hi = dec_hi_l1,
+            .dec_lo = dec_lo_l1
+         };
+
+         plp_idwt_q32s_xpulpv2(pSrcA, pSrcD, out_len, temp_wavelet, pDst);
+
+         plp_l1_scratch_free(dec_hi_l1, sizeof(int32_t) * (wavelet.length));
+         plp_l1_scratch_free(dec_lo_l1, sizeof(int32_t) * (wavelet.length));
+         break;
+      }
+   }
+}
+
+
+/**
+   @brief  32bit Fixed-point multilevel wavelet reconstruction on real data.
+
+   Inverse of the multilevel decomposition: pSrc holds the coefficients in the layout of
+   plp_dwt_dec_f32, i.e. [D1 D2 ... DL AL] for a signal of the given length. The levels are
+   reconstructed from L down to 1, ping-ponging between pTemp and pDst, and the output is
+   trimmed to the original signal length.
+
+   @param[in]   pSrc     points to the coefficient buffer [D1 D2 ... DL AL]
+   @param[in]   length   length of the original signal
+   @param[in]   wavelet  orthogonal wavelet structure used for the decomposition
+   @param[in]   level    levels of the decomposition (0 for maximal decomposition)
+   @param[in]   pTemp    points to a temporary buffer of PLP_DWT_OUTPUT_LENGTH(length, wavelet.length) values
+   @param[out]  pDst     points to the output buffer of length values, must not overlap pSrc
+   @return      none
+*/
+void plp_dwt_rec_q32(const int32_t *__restrict__ pSrc,
+                     uint32_t length,
+                     const plp_dwt_wavelet_q32 wavelet,
+                     uint32_t level,
+                     int32_t *__restrict__ pTemp,
+                     int32_t *__restrict__ pDst) {
+   PLP_PROFILE_FUNC();
+
+   uint32_t levels = plp_dwt_levels(length, wavelet.length, level);
+   uint32_t in_len;
+   uint32_t out_len;
+
+   // The final approximation follows the detailed coefficients of all levels
+   uint32_t src_offset = 0;
+   for(uint32_t l = 1; l <= levels; l++){
+      src_offset += plp_dwt_level_len(length, wavelet.length, l);
+   }
+   const int32_t *pA = pSrc + src_offset;
+
+   int32_t *dec_hi_l1;
+   int32_t *dec_lo_l1;
+   plp_dwt_wavelet_q32 temp_wavelet = wavelet;
+
+   if (hal_cluster_id() == ARCHI_FC_CID) {
+      for(uint32_t l = levels; l > 0; l--){
+         in_len = plp_dwt_level_len(length, wavelet.length, l);
+         out_len = plp_dwt_level_len(length, wavelet.length, l - 1);
+         src_offset -= in_len;
+
+         // Alternate the buffers such that the last level is written to pDst
+         int32_t *pOut = ((l - 1) & 1) ? pTemp : pDst;
+
+         switch(wavelet.type) {
+         case PLP_DWT_WAVELET_HAAR:
+         case PLP_DWT_WAVELET_DB1:
+            plp_idwt_haar_q32s_rv32im(pA, pSrc + src_offset, out_len, pOut);
+            break;
+         default:
+            plp_idwt_q32s_rv32im(pA, pSrc + src_offset, out_len, wavelet, pOut);
+            break;
+         }
+
+         pA = pOut; // Next approximation is the current reconstruction
+      }
+   } else {
+      switch(wavelet.type) {
+      case PLP_DWT_WAVELET_HAAR:
+      case PLP_DWT_WAVELET_DB1:
+         break;
+      default:
+         dec_hi_l1 = plp_l1_scratch_alloc(sizeof(int32_t) * (wavelet.length));
+         dec_lo_l1 = plp_l1_scratch_alloc(sizeof(int32_t) * (wavelet.length));
+
+         copy_coefs_q32(dec_hi_l1, dec_lo_l1, wavelet);
+         temp_wavelet = (plp_dwt_wavelet_q32){
+            .length = wavelet.length,
+            .type = wavelet.type,
+            .dec_hi = dec_hi_l1,
+            .dec_lo = dec_lo_l1
+         };
+         break;
+      }
+
+      for(uint32_t l = levels; l > 0; l--){
+         in_len = plp_dwt_level_len(length, wavelet.length, l);
+         out_len = plp_dwt_level_len(length, wavelet.length, l - 1);
+         src_offset -= in_len;
+
+         // Alternate the buffers such that the last level is written to pDst
+         int32_t *pOut = ((l - 1) & 1) ? pTemp : pDst;
+
+         switch(wavelet.type) {
+         case PLP_DWT_WAVELET_HAAR:
+         case PLP_DWT_WAVELET_DB1:
+            plp_idwt_haar_q32s_xpulpv2(pA, pSrc + src_offset, out_len, pOut);
+            break;
+         default:
+            plp_idwt_q32s_xpulpv2(pA, pSrc + src_offset, out_len, temp_wavelet, pOut);
+            break;
+         }
+
+         pA = pOut; // Next approximation is the current reconstruction
+      }
+
+      switch(wavelet.type) {
+      case PLP_DWT_WAVELET_HAAR:
+      case PLP_DWT_WAVELET_DB1:
+         break;
+      default:
+         plp_l1_scratch_free(dec_hi_l1, sizeof(int32_t) * (wavelet.length));
+         plp_l1_scratch_free(dec_lo_l1, sizeof(int32_t) * (wavelet.length));
+         break;
+      }
+   }
+}
+
+/**
+   @} end of DWT group
+*/
@@ -0,0 +1,213 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_idwt_q8_parallel.c
+ * Description:  Parallel 8bit Fixed-point inverse Discrete Wavelet Transform and multilevel reconstruction
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+#include "plp_dwt_common.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup dwt
+   @{
+*/
+
+/**
+   @brief  Parallel 8bit Fixed-point inverse DWT on real data.
+
+   Parallel variant of plp_idwt_q8, the output samples are interleaved between the cores.
+
+   @param[in]   pSrcA    points to the Approximate coefficients
+   @param[in]   pSrcD    points to the Detailed coefficients
+   @param[in]   length   number of coefficients in each of pSrcA and pSrcD
+   @param[in]   wavelet  wavelet structure used for the decomposition
+   @param[in]   nPE      Number of cores to use
+   @param[out]  pDst     points to the output buffer with the reconstructed signal
+   @return      none
+*/
+void plp_idwt_q8_parallel(const int8_t *__restrict__ pSrcA,
+                  const int8_t *__restrict__ pSrcD,
+                  uint32_t length,
+                  const plp_dwt_wavelet_q8 wavelet,
+                  uint32_t nPE,
+                  int8_t *__restrict__ pDst) {
+   PLP_PROFILE_FUNC();
+
+   if(2 * length + 2 <= wavelet.length){
+      printf("error: not enough coefficients for the wavelet length\n");
+      return;
+   }
+
+   int8_t *dec_hi_l1;
+   int8_t *dec_lo_l1;
+   plp_dwt_wavelet_q8 temp_wavelet;
+
+   if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+      plp_idwt_q8(pSrcA, pSrcD, length, wavelet, pDst);
+      return;
+   } else {
+      plp_idwt_instance_q8 args = {
+         .pSrcA = pSrcA,
+         .pSrcD = pSrcD,
+         .length = PLP_IDWT_OUTPUT_LENGTH(length, wavelet.length),
+         .wavelet = wavelet,
+         .nPE = nPE,
+         .pDst = pDst
+      };
+
+      switch(wavelet.type) {
+      case PLP_DWT_WAVELET_HAAR:
+      case PLP_DWT_WAVELET_DB1:
+         plp_cl_team_fork(nPE, plp_idwt_haar_q8p_xpulpv2, (void *)&args);
+         break;
+      default:
+         dec_hi_l1 = plp_l1_scratch_alloc(sizeof(int8_t) * (wavelet.length));
+         dec_lo_l1 = plp_l1_scratch_alloc(sizeof(int8_t) * (wavelet.length));
+
+         copy_coefs_q8(dec_hi_l1, dec_lo_l1, wavelet);
+         temp_wavelet = (plp_dwt_wavelet_q8){
+            .length = wavelet.length,
+            .type = wavelet.type,
+            .dec_hi = dec_hi_l1,
+            .dec_lo = dec_lo_l1
+         };
+
+         args.wavelet = temp_wavelet;
+
+         plp_cl_team_fork(nPE, plp_idwt_q8p_xpulpv2, (void *)&args);
+
+         plp_l1_scratch_free(dec_hi_l1, sizeof(int8_t) * (wavelet.length));
+         plp_l1_scratch_free(dec_lo_l1, sizeof(int8_t) * (wavelet.length));
+         break;
+      }
+   }
+}
+
+
+/**
+   @brief  Parallel 8bit Fixed-point multilevel wavelet reconstruction on real data.
+
+   Parallel variant of plp_dwt_rec_q8, every level is split between the cores.
+
+   @param[in]   pSrc     points to the coefficient buffer [D1 D2 ... DL AL]
+   @param[in]   length   length of the original signal
+   @param[in]   wavelet  orthogonal wavelet structure used for the decomposition
+   @param[in]   level    levels of the decomposition (0 for maximal decomposition)
+   @param[in]   nPE      Number of cores to use
+   @param[in]   pTemp    points to a temporary buffer of PLP_DWT_OUTPUT_LENGTH(length, wavelet.length) values
+   @param[out]  pDst     points to the output buffer of length values, must not overlap pSrc
+   @return      none
+*/
+void plp_dwt_rec_q8_parallel(const int8_t *__restrict__ pSrc,
+                     uint32_t length,
+                     const plp_dwt_wavelet_q8 wavelet,
+                     uint32_t level,
+                     uint32_t nPE,
+                     int8_t *__restrict__ pTemp,
+                     int8_t *__restrict__ pDst) {
+   PLP_PROFILE_FUNC();
+
+   if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+      plp_dwt_rec_q8(pSrc, length, wavelet, level, pTemp, pDst);
+      return;
+   } else {
+      uint32_t levels = plp_dwt_levels(length, wavelet.length, level);
+      uint32_t in_len;
+
+      // The final approximation follows the detailed coefficients of all levels
+      uint32_t src_offset = 0;
+      for(uint32_t l = 1; l <= levels; l++){
+         src_offset += plp_dwt_level_len(length, wavelet.length, l);
+      }
+
+      int8_t *dec_hi_l1 = NULL;
+      int8_t *dec_lo_l1 = NULL;
+
+      plp_idwt_instance_q8 args = {
+         .pSrcA = pSrc + src_offset,
+         .wavelet = wavelet,
+         .nPE = nPE
+      };
+
+      switch(wavelet.type) {
+      case PLP_DWT_WAVELET_HAAR:
+      case PLP_DWT_WAVELET_DB1:
+         break;
+      default:
+         dec_hi_l1 = plp_l1_scratch_alloc(sizeof(int8_t) * (wavelet.length));
+         dec_lo_l1 = plp_l1_scratch_alloc(sizeof(int8_t) * (wavelet.length));
+         copy_coefs_q8(dec_hi_l1, dec_lo_l1, wavelet);
+
+         args.wavelet = (plp_dwt_wavelet_q8){
+            .length = wavelet.length,
+            .type = wavelet.type,
+            .dec_hi = dec_hi_l1,
+            .dec_lo = dec_lo_l1
+         };
+         break;
+      }
+
+      for(uint32_t l = levels; l > 0; l--){
+         in_len = plp_dwt_level_len(length, wavelet.length, l);
+         src_offset -= in_len;
+
+         args.pSrcD = pSrc + src_offset;
+         args.length = plp_dwt_level_len(length, wavelet.length, l - 1);
+         // Alternate the buffers such that the last level is written to pDst
+         args.pDst = ((l - 1) & 1) ? pTemp : pDst;
+
+         switch(wavelet.type) {
+         case PLP_DWT_WAVELET_HAAR:
+         case PLP_DWT_WAVELET_DB1:
+            plp_cl_team_fork(nPE, plp_idwt_haar_q8p_xpulpv2, (void *)&args);
+            break;
+         default:
+            plp_cl_team_fork(nPE, plp_idwt_q8p_xpulpv2, (void *)&args);
+            break;
+         }
+
+         args.pSrcA = args.pDst; // Next approximation is the current reconstruction
+      }
+
+      switch(wavelet.type) {
+      case PLP_DWT_WAVELET_HAAR:
+      case PLP_DWT_WAVELET_DB1:
+         break;
+      default:
+         plp_l1_scratch_free(dec_hi_l1, sizeof(int8_t) * (wavelet.length));
+         plp_l1_scratch_free(dec_lo_l1, sizeof(int8_t) * (wavelet.length));
+         break;
+      }
+   }
+}
+
+/**
+   @} end of DWT group
+*/
@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_imdct_f32.c
+ * Description:  Glue code for the floating-point IMDCT
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief Glue code for the floating-point IMDCT with overlap-add
+ *
+ * y[n] = 2/M sum_k X[k] cos(pi / M (n + 1/2 + M/2) (k + 1/2)), n = 0 .. 2M - 1, is windowed, and
+ * its first half is added to the second half of the previous frame kept in the state. With a
+ * window fulfilling w[n]^2 + w[n+M]^2 = 1 (Princen-Bradley) on both sides, the output is the input
+ * of the MDCT delayed by M samples. The instance is set up with plp_mdct_f32_init.
+ *
+ * @param[in,out]  S      points to the instance
+ * @param[in]      pSrc   points to the M coefficients
+ * @param[in]      pBuf   points to a work buffer of M values
+ * @param[out]     pDst   points to the M output samples
+ * @return         none
+ */
+void plp_imdct_f32(plp_mdct_instance_f32 *S,
+                   const float32_t *__restrict__ pSrc,
+                   float32_t *__restrict__ pBuf,
+                   float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    } else {
+        plp_imdct_f32s_xpulpv2(S, pSrc, pBuf, pDst);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
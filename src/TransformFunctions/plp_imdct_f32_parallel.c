@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_imdct_f32_parallel.c
+ * Description:  Glue code for the parallel floating-point IMDCT
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief Glue code for the parallel floating-point IMDCT
+ *
+ * The passes before and after the FFT are split in blocks across the cores, and the FFT runs on
+ * the whole team. See plp_imdct_f32.
+ *
+ * @param[in,out]  S      points to the instance
+ * @param[in]      pSrc   points to the M coefficients
+ * @param[in]      nPE    number of parallel processing units, rounded down to a power of two
+ *                        when M/2 is a power of two
+ * @param[in]      pBuf   points to a work buffer of M values
+ * @param[out]     pDst   points to the M output samples
+ * @return         none
+ */
+void plp_imdct_f32_parallel(plp_mdct_instance_f32 *S,
+                            const float32_t *__restrict__ pSrc,
+                            uint32_t nPE,
+                            float32_t *__restrict__ pBuf,
+                            float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID && plp_fc_cluster_open() != 0) {
+        printf("Parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    /* the FFT runs on a power-of-two number of cores for the power-of-two lengths */
+    nPE = plp_cfft_f32_parallel_npe(&S->plan->fft.S, nPE);
+    if (nPE == 1 && hal_cluster_id() != ARCHI_FC_CID) {
+        plp_imdct_f32s_xpulpv2(S, pSrc, pBuf, pDst);
+        return;
+    }
+
+    plp_mdct_instance_f32_parallel args = {
+        .S = S, .pSrc = pSrc, .pBuf = pBuf, .pDst = pDst, .nPE = nPE
+    };
+
+    plp_cl_team_fork(nPE, plp_imdct_f32p_xpulpv2, (void *)&args);
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,70 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_imdct_q16.c
+ * Description:  Glue code for the 16-bit fixed-point IMDCT
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief Glue code for the 16-bit fixed-point IMDCT with overlap-add
+ *
+ * The coefficients are scaled by 1/(2M) like the ones of plp_mdct_q16, and the output is not, so
+ * that the output is the input of the MDCT delayed by M samples. The DCT-IV runs on the block
+ * floating point FFT to keep the precision of the quiet coefficients. Outputs beyond the Q15 range
+ * saturate.
+ *
+ * @param[in,out]  S      points to the instance
+ * @param[in]      pSrc   points to the M coefficients in Q15
+ * @param[in]      pBuf   points to a work buffer of M values, word aligned
+ * @param[out]     pDst   points to the M output samples in Q15
+ * @return         none
+ */
+void plp_imdct_q16(plp_mdct_instance_q16 *S,
+                   const int16_t *__restrict__ pSrc,
+                   int16_t *__restrict__ pBuf,
+                   int16_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_imdct_q16s_rv32im(S, pSrc, pBuf, pDst);
+    } else {
+        plp_imdct_q16s_xpulpv2(S, pSrc, pBuf, pDst);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,68 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_irfft_f32_parallel.c
+ * Description:  Floating-point parallel inverse FFT with real output
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief Floating-point inverse FFT with real output data (parallel version).
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer of (FFTLength / 2 + 1) complex values
+   @param[in]   nPE     number of parallel processing units
+   @param[out]  pDst    points to the output buffer of FFTLength real values
+   @return      none
+*/
+void plp_irfft_f32_parallel(const plp_fft_instance_f32 *S,
+                            const float32_t *__restrict__ pSrc,
+                            const uint32_t nPE,
+                            float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID && plp_fc_cluster_open() != 0) {
+        printf("Parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_fft_instance_f32_parallel arg =
+        (plp_fft_instance_f32_parallel){ (plp_fft_instance_f32 *)S, pSrc, nPE, pDst };
+
+    plp_cl_team_fork(nPE, plp_irfft_f32p_xpulpv2, (void *)&arg);
+}
+
+/**
+   @} end of FFT group
+*/
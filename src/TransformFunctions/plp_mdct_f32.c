@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mdct_f32.c
+ * Description:  Glue code for the floating-point MDCT
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief Set up a floating-point MDCT or IMDCT with an empty state
+ *
+ * The first MDCT frame covers M zeros and the first input block, and the first IMDCT output block
+ * only holds the first half of a frame, so that a chain of MDCT and IMDCT delays the signal by M
+ * samples.
+ *
+ * @param[out]  S        points to the instance
+ * @param[in]   plan     points to a DCT plan of M points created with plp_dct_plan_create_f32
+ * @param[in]   pWindow  points to the window of 2M values
+ * @param[in]   pState   points to the state of M values, cleared here
+ * @return      none
+ */
+void plp_mdct_f32_init(plp_mdct_instance_f32 *S,
+                       const plp_dct_plan_f32 *plan,
+                       const float32_t *pWindow,
+                       float32_t *pState) {
+    uint32_t n;
+
+    S->plan = plan;
+    S->pWindow = pWindow;
+    S->pState = pState;
+
+    for (n = 0; n < plan->len; n++) {
+        pState[n] = 0.0f;
+    }
+}
+
+/**
+ * @brief Glue code for the floating-point MDCT
+ *
+ * X[k] = sum_n w[n] x[n] cos(pi / M (n + 1/2 + M/2) (k + 1/2)), n = 0 .. 2M - 1, of the frame x
+ * made of the previous input block and pSrc. The frame is windowed and folded into the DCT-IV of M
+ * points on the way into its FFT of M/2 points, and pSrc becomes the previous block.
+ *
+ * @param[in,out]  S      points to the instance
+ * @param[in]      pSrc   points to the M new input samples
+ * @param[in]      pBuf   points to a work buffer of M values
+ * @param[out]     pDst   points to the M coefficients
+ * @return         none
+ */
+void plp_mdct_f32(plp_mdct_instance_f32 *S,
+                  const float32_t *__restrict__ pSrc,
+                  float32_t *__restrict__ pBuf,
+                  float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    } else {
+        plp_mdct_f32s_xpulpv2(S, pSrc, pBuf, pDst);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mdct_q16.c
+ * Description:  Glue code for the 16-bit fixed-point MDCT
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief Set up a 16-bit fixed-point MDCT or IMDCT with an empty state
+ *
+ * See plp_mdct_f32_init. The IMDCT runs on the block floating point FFT, which needs M/2 to be a
+ * power of two.
+ *
+ * @param[out]  S        points to the instance
+ * @param[in]   plan     points to a DCT plan of M points created with plp_dct_plan_create_q16
+ * @param[in]   pWindow  points to the window of 2M values in Q15
+ * @param[in]   pState   points to the state of M values, cleared here
+ * @return      none
+ */
+void plp_mdct_q16_init(plp_mdct_instance_q16 *S,
+                       const plp_dct_plan_q16 *plan,
+                       const int16_t *pWindow,
+                       int16_t *pState) {
+    uint32_t L = plan->len / 2;
+    uint32_t n;
+
+    if (L < 2 || (L & (L - 1)) != 0) {
+        printf("MDCT Q16 supported only for M/2 a power of two\n");
+        return;
+    }
+
+    S->plan = plan;
+    S->pWindow = pWindow;
+    S->pState = pState;
+
+    for (n = 0; n < plan->len; n++) {
+        pState[n] = 0;
+    }
+}
+
+/**
+ * @brief Glue code for the 16-bit fixed-point MDCT
+ *
+ * The coefficients are the ones of plp_mdct_f32 divided by the frame length 2M, which keeps them
+ * in range for any input.
+ *
+ * @param[in,out]  S      points to the instance
+ * @param[in]      pSrc   points to the M new input samples in Q15
+ * @param[in]      pBuf   points to a work buffer of M values, word aligned
+ * @param[out]     pDst   points to the M coefficients in Q15
+ * @return         none
+ */
+void plp_mdct_q16(plp_mdct_instance_q16 *S,
+                  const int16_t *__restrict__ pSrc,
+                  int16_t *__restrict__ pBuf,
+                  int16_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_mdct_q16s_rv32im(S, pSrc, pBuf, pDst);
+    } else {
+        plp_mdct_q16s_xpulpv2(S, pSrc, pBuf, pDst);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
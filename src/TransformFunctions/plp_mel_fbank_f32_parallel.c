@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mel_fbank_f32_parallel.c
+ * Description:  Parallel floating-point mel filterbank energies
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup feature
+ * @{
+ */
+
+/**
+ * @brief Glue code for the parallel floating-point mel filterbank energies
+ *
+ * The filters are distributed across the cores, see plp_mel_fbank_f32.
+ *
+ * @param[in]   filterBank  points to plp_triangular_filter_f32 instance
+ * @param[in]   pSrc        points to the complex spectrum, e.g., the output of plp_rfft_f32
+ * @param[in]   nPE         number of parallel processing units
+ * @param[out]  pDst        points to the nFilters energies
+ * @return      none
+ */
+void plp_mel_fbank_f32_parallel(const plp_triangular_filter_f32 *filterBank,
+                                const float32_t *__restrict__ pSrc,
+                                uint32_t nPE,
+                                float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID && plp_fc_cluster_open() != 0) {
+        printf("Parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_mel_fbank_instance_f32_parallel args = {
+        .filterBank = filterBank, .pSrc = pSrc, .nPE = nPE, .pDst = pDst
+    };
+
+    plp_cl_team_fork(nPE, plp_mel_fbank_f32p_xpulpv2, (void *)&args);
+}
+
+/**
+ * @} end of feature group
+ */
@@ -0,0 +1,66 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mel_fbank_q16.c
+ * Description:  16-bit fixed-point mel filterbank energies of a complex spectrum
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup feature
+ * @{
+ */
+
+/**
+ * @brief Glue code for the 16-bit fixed-point mel filterbank energies
+ *
+ * The squared magnitude of every Q15 bin is accumulated into the triangular filters in 64 bits.
+ * For the output of plp_rfft_q16, which is scaled by 1/N, the bins add up to less than 1 by
+ * Parseval's theorem, so the Q31 energies only saturate for filter weights above 1.
+ *
+ * @param[in]   filterBank  points to plp_triangular_filter_q16 instance
+ * @param[in]   pSrc        points to the complex spectrum in Q15, word aligned
+ * @param[out]  pDst        points to the nFilters energies in Q31
+ * @return      none
+ */
+void plp_mel_fbank_q16(const plp_triangular_filter_q16 *filterBank,
+                       const int16_t *__restrict__ pSrc,
+                       int32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_mel_fbank_q16s_rv32im(filterBank, pSrc, pDst);
+    } else {
+        plp_mel_fbank_q16s_xpulpv2(filterBank, pSrc, pDst);
+    }
+}
+
+/**
+ * @} end of feature group
+ */
@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mel_fbank_q16_parallel.c
+ * Description:  Parallel 16-bit fixed-point mel filterbank energies
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup feature
+ * @{
+ */
+
+/**
+ * @brief Glue code for the parallel 16-bit fixed-point mel filterbank energies
+ *
+ * The filters are distributed across the cores, see plp_mel_fbank_q16 for the fixed-point formats.
+ *
+ * @param[in]   filterBank  points to plp_triangular_filter_q16 instance
+ * @param[in]   pSrc        points to the complex spectrum in Q15, word aligned
+ * @param[in]   nPE         number of parallel processing units
+ * @param[out]  pDst        points to the nFilters energies in Q31
+ * @return      none
+ */
+void plp_mel_fbank_q16_parallel(const plp_triangular_filter_q16 *filterBank,
+                                const int16_t *__restrict__ pSrc,
+                                uint32_t nPE,
+                                int32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_mel_fbank_q16(filterBank, pSrc, pDst);
+        return;
+    } else {
+        plp_mel_fbank_instance_q16_parallel args = {
+            .filterBank = filterBank, .pSrc = pSrc, .nPE = nPE, .pDst = pDst
+        };
+
+        plp_cl_team_fork(nPE, plp_mel_fbank_q16p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+ * @} end of feature group
+ */
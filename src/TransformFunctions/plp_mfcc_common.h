@@ -0,0 +1,129 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mfcc_common.h
+ * Description:  Fixed-point steps of the MFCC around the FFT and the filterbank
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#ifndef __PLP_MFCC_COMMON_H
+#define __PLP_MFCC_COMMON_H
+
+/* log2(x) for x in [1, 2) as Q30, in Q15, one bit per squaring */
+static inline int32_t plp_mfcc_log2_frac(uint32_t x) {
+    int32_t f = 0;
+    uint32_t b;
+
+    for (b = 0; b < 15; b++) {
+        x = (uint32_t)(((uint64_t)x * x) >> 30);
+        f <<= 1;
+        if (x >= 0x80000000u) {
+            x >>= 1;
+            f |= 1;
+        }
+    }
+    return f;
+}
+
+/* Window a Q15 frame and scale it up to the full range. Returns the left shift applied. */
+static inline uint32_t plp_mfcc_window_q16(const int16_t *pSrc,
+                                           const int16_t *window,
+                                           uint32_t n,
+                                           int16_t *pDst) {
+    uint32_t m = 0;
+    uint32_t shift = 0;
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        int32_t v = ((int32_t)pSrc[i] * window[i] + (1 << 14)) >> 15;
+        if (v > 0x7FFF) {
+            v = 0x7FFF;
+        }
+        pDst[i] = (int16_t)v;
+        m |= (uint32_t)(v ^ (v >> 31));
+    }
+
+    if (m != 0) {
+        shift = __builtin_clz(m) - 17;
+        for (i = 0; i < n; i++) {
+            pDst[i] = (int16_t)(pDst[i] << shift);
+        }
+    }
+    return shift;
+}
+
+/* ln(mel + 2^-20) in Q11, saturated, of energies worth pSrc * 2^exponent. The offset keeps the
+   logarithm finite as the 1e-6 of plp_mfcc_f32. */
+static inline void plp_mfcc_log_q16(const int32_t *pSrc,
+                                    uint32_t nMels,
+                                    int32_t exponent,
+                                    int16_t *pDst) {
+    uint32_t m;
+
+    for (m = 0; m < nMels; m++) {
+        uint64_t v;
+        int32_t e, k, l;
+        uint32_t x;
+
+        /* v * 2^e = pSrc[m] * 2^exponent + 2^-20 */
+        if (exponent <= -20) {
+            v = (uint64_t)pSrc[m] + ((uint64_t)1 << (-20 - exponent));
+            e = exponent;
+        } else {
+            v = ((uint64_t)pSrc[m] << (exponent + 20)) + 1;
+            e = -20;
+        }
+
+        k = (v >> 32) ? 63 - __builtin_clz((uint32_t)(v >> 32)) : 31 - __builtin_clz((uint32_t)v);
+        x = k >= 30 ? (uint32_t)(v >> (k - 30)) : (uint32_t)v << (30 - k);
+        l = ((k + e) << 15) + plp_mfcc_log2_frac(x);
+
+        /* ln(2) in Q15 */
+        l = (int32_t)(((int64_t)l * 22713 + (1 << 18)) >> 19);
+        pDst[m] = (int16_t)(l > 0x7FFF ? 0x7FFF : (l < -0x8000 ? -0x8000 : l));
+    }
+}
+
+/* Q7 MFCCs of Q11 log energies with a Q15 DCT matrix, saturated */
+static inline void plp_mfcc_dct_q16(const int16_t *pDctCoefs,
+                                    const int16_t *pSrc,
+                                    uint32_t nMels,
+                                    uint32_t nDct,
+                                    int16_t *pDst) {
+    uint32_t k, m;
+
+    for (k = 0; k < nDct; k++) {
+        int64_t sum = 0;
+        int32_t c;
+
+        for (m = 0; m < nMels; m++) {
+            sum += (int32_t)pDctCoefs[k * nMels + m] * pSrc[m];
+        }
+        sum = (sum + (1 << 18)) >> 19;
+        c = sum > 0x7FFF ? 0x7FFF : (sum < -0x8000 ? -0x8000 : (int32_t)sum);
+        pDst[k] = (int16_t)c;
+    }
+}
+
+#endif
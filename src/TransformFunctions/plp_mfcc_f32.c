@@ -62,9 +62,10 @@
    @param[in]   orthoNorm   whether to use dct orthonormalisation or not
    @param[in]   pSrc        points to the input buffer (real data, size n_fft)
    @param[out]  pDst        points to the output buffer 
-   			    of length at least 3*n_fft.
-			    pSrc and pDst must not overlap, the calculation can
-			    not be done in place. 
+   			    of length at least 3*n_fft, the minimum for
+			    plp_rfft_f32: 2*n_fft FFT values and the n_fft
+			    windowed samples. pSrc and pDst must not overlap, the
+			    calculation can not be done in place.
 			    MFCCs are returned in the first n_mels spots.
    @return      none
 */
@@ -76,6 +77,7 @@ void plp_mfcc_f32(const plp_fft_instance_f32 *SFFT,
 		  const uint8_t *orthoNorm,
                   const float32_t *__restrict__ pSrc,
                   float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
 
 	// Step 0: Windowing. Stored in buffer space of pDst.
@@ -88,30 +90,13 @@ void plp_mfcc_f32(const plp_fft_instance_f32 *SFFT,
 	plp_rfft_f32(SFFT, fft_in, pDst);
 	
 
-	// Step 2: ||.||^2 of each RFFT point / Take squared magnitude.
-	// Stores result in free buffer space of pDst, right behind
-	// the RFFT's (n_fft+2)-long output. 
-	float32_t *fft_mag = pDst + n_fft+2;
-	plp_cmplx_mag_squared_f32(pDst, fft_mag, n_fft/2 + 1);
-
-
-	// Step 3: Apply triangular filter bank.
-	// results are stored in the beginning of pDst.
-	float32_t *fb_out = pDst;
+	// Step 2: ||.||^2 of each RFFT point and triangular filter bank in one pass.
+	// Results are stored in the windowed input, which is no longer needed.
+	float32_t *fb_out = fft_in;
 	uint16_t n_mels = filterBank->nFilters;
-	float32_t *filter_start = (float32_t*)filterBank->V;
-	for (int i=0;i<n_mels;i++){
-		uint16_t current_length = filterBank->filterLength[i];
-		plp_dot_prod_f32(
-                          fft_mag+filterBank->firstValue[i], 
-                          filter_start,
-                          current_length, 
-                          fb_out+i);
-		filter_start += current_length;
-  	}
-
+	plp_mel_fbank_f32(filterBank, pDst, fb_out);
 
-	// Step 4: Take the log of the computed mel scale. 
+	// Step 3: Take the log of the computed mel scale. 
 	// the offset is copied from pytorch
 	plp_offset_f32(fb_out, 1e-6f, fb_out, n_mels);
 	float32_t *mel_logs = fb_out;
@@ -121,11 +106,10 @@ void plp_mfcc_f32(const plp_fft_instance_f32 *SFFT,
 	}
 
 
-	// Step 5: DCT of log mels
+	// Step 4: DCT of log mels
 	// corresponds to using pytorch MFCC with norm = None
-	float32_t *dct_inout = mel_logs;
 	float32_t *dct_buffer = pDst + n_mels;
-	plp_dct2_f32(SDCT, pShift, orthoNorm, dct_inout, dct_buffer, dct_inout);
+	plp_dct2_f32(SDCT, pShift, *orthoNorm, mel_logs, dct_buffer, pDst);
 }
 
 /**
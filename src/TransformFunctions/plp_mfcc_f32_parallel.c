@@ -63,9 +63,10 @@
    @param[in]   pSrc        points to the input buffer (real data, size n_fft)
    @param[in]   nPE         number of parallel processing units
    @param[out]  pDst        points to the output buffer 
-   			    of length at least 3*n_fft.
-			    pSrc and pDst must not overlap, the calculation can
-			    not be done in place. 
+   			    of length at least 3*n_fft, the minimum for
+			    plp_rfft_f32: 2*n_fft FFT values and the n_fft
+			    windowed samples. pSrc and pDst must not overlap, the
+			    calculation can not be done in place.
 			    MFCCs are returned in the first n_mels spots.
    @return      none
 */
@@ -78,6 +79,7 @@ void plp_mfcc_f32_parallel(const plp_fft_instance_f32 *SFFT,
                   	   const float32_t *__restrict__ pSrc,
                   	   const uint32_t nPE,
                   	   float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
 	// Step 0: Windowing. Stored in buffer space of pDst.
 	uint32_t n_fft = SFFT->FFTLength;
@@ -87,40 +89,22 @@ void plp_mfcc_f32_parallel(const plp_fft_instance_f32 *SFFT,
 	// Step 1: FFT
 	plp_rfft_f32_parallel(SFFT, fft_in, nPE, pDst);
 	
-	// Step 2: ||.||^2 of each RFFT point / Take squared magnitude.
-	// Stores result in free buffer space of pDst, right behind
-	// the RFFT's (n_fft+2)-long output. 
-	float32_t *fft_mag = pDst + n_fft+2;
-	plp_cmplx_mag_squared_f32(pDst, fft_mag, n_fft/2 + 1);
-
-	// Step 3: Apply triangular filter bank.
-	// results are stored in the beginning of pDst.
-	float32_t *fb_out = pDst;
+	// Step 2: ||.||^2 of each RFFT point and triangular filter bank in one pass.
+	// Results are stored in the windowed input, which is no longer needed.
+	float32_t *fb_out = fft_in;
 	uint16_t n_mels = filterBank->nFilters;
-	float32_t *filter_start = (float32_t*)filterBank->V;
-	for (int i=0;i<n_mels;i++){
-		uint16_t current_length = filterBank->filterLength[i];
-		plp_dot_prod_f32(
-		//plp_dot_prod_f32_parallel(
-                          fft_mag+filterBank->firstValue[i], 
-                          filter_start,
-                          current_length, 
-			  //nPE,
-                          fb_out+i);
-		filter_start += current_length;
-  	}
+	plp_mel_fbank_f32_parallel(filterBank, pDst, nPE, fb_out);
 
-	// Step 4: Take the log of the computed mel scale. 
+	// Step 3: Take the log of the computed mel scale. 
 	// the offset is copied from pytorch
 	plp_offset_f32(fb_out, 1e-6f, fb_out, n_mels);
 	float32_t *mel_logs = fb_out;
 	plp_log_f32_parallel(fb_out, n_mels, nPE, mel_logs);
 
-	// Step 5: DCT of log mels
+	// Step 4: DCT of log mels
 	// corresponds to using pytorch MFCC with norm = None
-	float32_t *dct_inout = mel_logs;
 	float32_t *dct_buffer = pDst + n_mels;
-	plp_dct2_f32_parallel(SDCT, pShift, orthoNorm, dct_inout, nPE, dct_buffer, dct_inout);
+	plp_dct2_f32_parallel(SDCT, pShift, *orthoNorm, mel_logs, nPE, dct_buffer, pDst);
 }
 
 /**
@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_mfcc_q16_parallel.c
+ * Description:  Parallel 16-bit fixed-point MFCC on real input data
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_mfcc_common.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup feature
+ * @{
+ */
+
+/**
+ * @brief Parallel 16-bit fixed-point MFCC on real input data
+ *
+ * The FFT and the filterbank run on nPE cores, see plp_mfcc_q16 for the fixed-point formats and
+ * the use of pBuffer.
+ *
+ * @param[in]   SFFT        points to an instance of the 16-bit real FFT
+ *                          structure (with fftLenReal = n_fft).
+ * @param[in]   filterBank  points to plp_triangular_filter_q16 instance with
+ *                          nFilters = n_mels, at most n_fft/2.
+ * @param[in]   window      vector to use for windowing, in Q15
+ * @param[in]   pDctCoefs   points to the nDct x n_mels DCT matrix in Q15, row major,
+ *                          with coefficients of at most 1 in magnitude (e.g. the
+ *                          orthonormal DCT-II)
+ * @param[in]   nDct        number of MFCCs
+ * @param[in]   pSrc        points to the input buffer (real data in Q15, size n_fft)
+ * @param[in]   nPE         number of parallel processing units
+ * @param[in]   pBuffer     points to a word aligned buffer of 2*n_fft + 2 values
+ * @param[out]  pDst        points to the nDct MFCCs in Q7, saturated
+ * @return      none
+ */
+void plp_mfcc_q16_parallel(const plp_rfft_instance_q16 *SFFT,
+                           const plp_triangular_filter_q16 *filterBank,
+                           const int16_t *window,
+                           const int16_t *pDctCoefs,
+                           uint32_t nDct,
+                           const int16_t *__restrict__ pSrc,
+                           uint32_t nPE,
+                           int16_t *__restrict__ pBuffer,
+                           int16_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
+
+    uint32_t n_fft = SFFT->fftLenReal;
+    uint32_t n_mels = filterBank->nFilters;
+    int16_t *fft_in = pBuffer;
+    int16_t *fft_out = pBuffer + n_fft;
+    int32_t *fb_out = (int32_t *)pBuffer;
+    int16_t *mel_logs = pBuffer + n_fft;
+
+    // Step 0: Windowing, scaled up to the full range.
+    uint32_t shift = plp_mfcc_window_q16(pSrc, window, n_fft, fft_in);
+
+    // Step 1: FFT, scaled by 1/n_fft.
+    plp_rfft_q16_parallel(SFFT, fft_in, fft_out, 0, nPE);
+
+    // Step 2: squared magnitude and triangular filter bank in one pass, in Q31.
+    plp_mel_fbank_q16_parallel(filterBank, fft_out, nPE, fb_out);
+
+    // Step 3: log of the mel energies, undoing the scalings of steps 0 and 1.
+    int32_t exponent = -31 + 2 * (31 - __builtin_clz(n_fft)) - 2 * (int32_t)shift;
+    plp_mfcc_log_q16(fb_out, n_mels, exponent, mel_logs);
+
+    // Step 4: DCT of log mels
+    plp_mfcc_dct_q16(pDctCoefs, mel_logs, n_mels, nDct, pDst);
+}
+
+/**
+ * @} end of feature group
+ */
@@ -0,0 +1,77 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft2d_f32_parallel.c
+ * Description:  Parallel floating-point 2D Fast Fourier Transform on Real Input Data
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Glue code for the parallel floating-point 2D fast fourier transform of a real matrix,
+ * see plp_rfft2d_f32.
+ *
+ * @param[in]  SRow     points to the real FFT instance of the row length (number of columns)
+ * @param[in]  SCol     points to the CFFT instance of the column length (number of rows)
+ * @param[in]  pSrc     points to the real matrix of <code>rows*cols</code> values, row major
+ * @param[out] pDst     points to the complex output matrix of <code>2*rows*cols</code> values
+ * @param[in]  pBuffer  points to a buffer of <code>2*rows*nPE</code> values
+ * @param[in]  nPE      number of cores to use
+ */
+
+void plp_rfft2d_f32_parallel(const plp_fft_instance_f32 *SRow,
+                             const plp_cfft_instance_f32 *SCol,
+                             const float32_t *pSrc,
+                             float32_t *pDst,
+                             float32_t *pBuffer,
+                             uint32_t nPE) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID && plp_fc_cluster_open() != 0) {
+        printf("Parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_rfft2d_instance_f32_parallel args = { .SRow = SRow,
+                                              .SCol = SCol,
+                                              .pSrc = pSrc,
+                                              .pDst = pDst,
+                                              .pBuffer = pBuffer,
+                                              .nPE = nPE };
+
+    plp_cl_team_fork(nPE, plp_rfft2d_f32p_xpulpv2, (void *)&args);
+}
+
+/**
+ * @} end of FFT group
+ */
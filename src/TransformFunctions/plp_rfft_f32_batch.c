@@ -0,0 +1,76 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_f32_batch.c
+ * Description:  Batch of floating-point real FFTs distributed across the cores
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief Glue code for a batch of floating-point real FFTs
+ *
+ * The frames are independent transforms of the same length, stored one after the other. When
+ * there are at least nPE frames, every core transforms whole frames without any barrier. With
+ * fewer frames, each frame is split across the cores as in plp_rfft_f32_parallel if nPE is a
+ * power of two, and transformed by one core each otherwise.
+ *
+ * @param[in]   S        points to an instance of the floating-point FFT structure
+ * @param[in]   pSrc     points to nFrames real frames of FFTLength values
+ * @param[in]   nFrames  number of frames
+ * @param[in]   nPE      number of cores to use
+ * @param[out]  pDst     points to nFrames complex output frames of <code>2*FFTLength</code> values
+ * @return      none
+ */
+void plp_rfft_f32_batch(const plp_fft_instance_f32 *S,
+                        const float32_t *__restrict__ pSrc,
+                        uint32_t nFrames,
+                        uint32_t nPE,
+                        float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID && plp_fc_cluster_open() != 0) {
+        printf("Parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_rfft_instance_f32_batch args = {
+        .S = S, .pSrc = pSrc, .pDst = pDst, .nFrames = nFrames, .nPE = nPE
+    };
+
+    plp_cl_team_fork(nPE, plp_rfft_f32_batch_xpulpv2, (void *)&args);
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -50,7 +50,7 @@
    @brief Floating-point FFT on real input data (parallel version).
    @param[in]   S       points to an instance of the floating-point FFT structure
    @param[in]   pSrc    points to the input buffer (real data)
-   @param[in]   nPE     number of parallel processing units
+   @param[in]   nPE     number of parallel processing units, rounded down to a power of two
    @param[out]  pDst    points to the output buffer (complex data)
    @return      none
 */
@@ -58,15 +58,22 @@ void plp_rfft_f32_parallel(const plp_fft_instance_f32 *S,
                            const float32_t *__restrict__ pSrc,
                            const uint32_t nPE,
                            float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
+    if (hal_cluster_id() == ARCHI_FC_CID && plp_fc_cluster_open() != 0) {
         printf("Parallel processing supported only for cluster side\n");
         return;
     }
 
-    plp_fft_instance_f32_parallel arg = (plp_fft_instance_f32_parallel){ S, pSrc, nPE, pDst };
+    /* the radix-2/4/8 kernels distribute the butterflies over a power-of-two number of cores */
+    uint32_t nCores = nPE;
+    while (nCores & (nCores - 1)) {
+        nCores &= nCores - 1;
+    }
+
+    plp_fft_instance_f32_parallel arg = (plp_fft_instance_f32_parallel){ S, pSrc, nCores, pDst };
 
-    hal_cl_team_fork(nPE, plp_rfft_f32p_xpulpv2, (void *)&arg);
+    plp_cl_team_fork(nCores, plp_rfft_f32p_xpulpv2, (void *)&arg);
 }
 
 /**
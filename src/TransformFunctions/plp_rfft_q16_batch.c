@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q16_batch.c
+ * Description:  Batch of 16-bit fixed-point real FFTs distributed across the cores
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief      Glue code for a batch of 16-bit fixed-point real FFTs
+ *
+ * The frames are independent transforms of the same length, stored one after the other: N reals
+ * in and N/2 + 1 complex values out for the forward transform, and the other way round for the
+ * inverse one (see plp_rfft_q16). When there are at least nPE frames, every core transforms whole
+ * frames without any barrier. With fewer frames, each frame is split across the cores as in
+ * plp_rfft_q16_parallel if nPE is a power of two, and
+ * transformed by one core each otherwise.
+ *
+ * @param[in]  S          points to an instance of the 16-bit real FFT structure
+ * @param[in]  pSrc       points to the input frames (modified by the forward transform)
+ * @param[out] pDst       points to the output frames
+ * @param[in]  nFrames    number of frames
+ * @param[in]  ifftFlag   flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]  nPE        number of cores to use
+ */
+void plp_rfft_q16_batch(const plp_rfft_instance_q16 *S,
+                        int16_t *pSrc,
+                        int16_t *pDst,
+                        uint32_t nFrames,
+                        uint8_t ifftFlag,
+                        uint32_t nPE) {
+    PLP_PROFILE_FUNC();
+
+    uint32_t N = S->fftLenReal;
+
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        uint32_t srcLen = ifftFlag ? N + 2 : N;
+        uint32_t dstLen = ifftFlag ? N : N + 2;
+        uint32_t f;
+        for (f = 0; f < nFrames; f++) {
+            plp_rfft_q16(S, pSrc + f * srcLen, pDst + f * dstLen, ifftFlag);
+        }
+        return;
+    } else {
+        plp_rfft_instance_q16_batch args = { .S = S,
+                                             .pSrc = pSrc,
+                                             .pDst = pDst,
+                                             .nFrames = nFrames,
+                                             .ifftFlag = ifftFlag,
+                                             .nPE = nPE };
+
+        plp_cl_team_fork(nPE, plp_rfft_q16_batch_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
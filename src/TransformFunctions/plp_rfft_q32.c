@@ -0,0 +1,73 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q32.c
+ * Description:  Glue code for the 32-bit fixed-point real FFT
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief         Glue code for the 32-bit fixed-point real FFT
+ *
+ * The transform of N real values is computed with the complex FFT of N/2 points and a split
+ * stage, which takes about half the work of the complex FFT of N points.
+ *
+ * Forward (ifftFlag=0): pSrc holds N real values and is used as work buffer, pDst receives the
+ * bins 0 .. N/2 as N/2 + 1 complex values, scaled by 1/N as the complex FFTs
+ * (Q1.31 -> Q(1+log2(N)).(31-log2(N))).
+ * Inverse (ifftFlag=1): pSrc holds the bins 0 .. N/2 and is not modified, pDst receives the
+ * N real values of the inverse DFT, including its 1/N factor (Q1.31 -> Q1.31, saturated).
+ * The imaginary parts of the DC and Nyquist bins are ignored, as for a real sequence. Hence
+ * the inverse of the forward output gives back the input scaled by 1/N.
+ *
+ * @param[in]     S           points to an instance of the 32-bit real FFT structure
+ * @param[in,out] pSrc        points to the input buffer
+ * @param[out]    pDst        points to the output buffer
+ * @param[in]     ifftFlag    flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ */
+
+void plp_rfft_q32(const plp_rfft_instance_q32 *S, int32_t *pSrc, int32_t *pDst, uint8_t ifftFlag) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_rfft_q32s_rv32im(S, pSrc, pDst, ifftFlag);
+    } else {
+        plp_rfft_q32s_xpulpv2(S, pSrc, pDst, ifftFlag);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,74 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q32_parallel.c
+ * Description:  Glue code for the parallel 32-bit fixed-point real FFT
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/**
+ * @brief         Glue code for the parallel 32-bit fixed-point real FFT
+ *
+ * See plp_rfft_q32 for the buffers and the fixed-point formats.
+ *
+ * @param[in]     S           points to an instance of the 32-bit real FFT structure
+ * @param[in,out] pSrc        points to the input buffer
+ * @param[out]    pDst        points to the output buffer
+ * @param[in]     ifftFlag    flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]     nPE         number of cores to use
+ */
+
+void plp_rfft_q32_parallel(const plp_rfft_instance_q32 *S,
+                           int32_t *pSrc,
+                           int32_t *pDst,
+                           uint8_t ifftFlag,
+                           uint32_t nPE) {
+    PLP_PROFILE_FUNC();
+
+    if (hal_cluster_id() == ARCHI_FC_CID && !plp_fc_offload()) {
+        plp_rfft_q32(S, pSrc, pDst, ifftFlag);
+        return;
+    } else {
+        plp_rfft_instance_q32_parallel args = {
+            .S = S, .pSrc = pSrc, .pDst = pDst, .ifftFlag = ifftFlag, .nPE = nPE
+        };
+
+        plp_cl_team_fork(nPE, plp_rfft_q32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -56,6 +56,7 @@
 void plp_rfftfast_f32( const plp_fft_fast_instance_f32 *S,
                         const float32_t *__restrict__ pSrc,
                         float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
 
     if (hal_cluster_id() == ARCHI_FC_CID) {
         printf("F extension is supported only for cluster side\n");
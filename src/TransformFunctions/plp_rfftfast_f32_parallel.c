@@ -57,14 +57,15 @@ void plp_rfftfast_f32_parallel( const plp_fft_fast_instance_f32 *S,
                                  float32_t *__restrict__ pSrc,
                                  float32_t *__restrict__ pDst,
                                  const uint32_t nPE) {
+    PLP_PROFILE_FUNC();
 
-    if (hal_cluster_id() == ARCHI_FC_CID) {
+    if (hal_cluster_id() == ARCHI_FC_CID && plp_fc_cluster_open() != 0) {
         printf("Parallel processing supported only for cluster side\n");
         return;
     }
     plp_fft_fast_instance_f32_parallel arg = (plp_fft_fast_instance_f32_parallel){ S, pSrc, pDst, nPE };
     //plp_thorirfft_f32p_xpulpv2((void *)&arg);
-    hal_cl_team_fork(nPE, plp_rfftfast_f32p_xpulpv2, (void *)&arg);
+    plp_cl_team_fork(nPE, plp_rfftfast_f32p_xpulpv2, (void *)&arg);
 }
 
 /**
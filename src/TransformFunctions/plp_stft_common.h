@@ -0,0 +1,76 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_stft_common.h
+ * Description:  Ring buffer handling of the streaming STFT
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#ifndef __PLP_STFT_COMMON_H
+#define __PLP_STFT_COMMON_H
+
+/* Copy samples of the chunk into the ring buffer until it is full or the chunk is exhausted.
+   Returns the number of samples taken, and the number of frames completed in pFrames. */
+static inline uint32_t plp_stft_f32_fill(plp_stft_instance_f32 *S,
+                                         const float32_t *pSrc,
+                                         uint32_t len,
+                                         uint32_t *pFrames) {
+    uint32_t N = S->S->FFTLength;
+    uint32_t L = S->ringLength;
+    uint32_t n = L - S->nBuffered;
+    uint32_t w = S->readPos + S->nBuffered;
+    uint32_t n0, i;
+
+    if (n > len) {
+        n = len;
+    }
+    if (w >= L) {
+        w -= L;
+    }
+    n0 = L - w;
+    if (n0 > n) {
+        n0 = n;
+    }
+
+    for (i = 0; i < n0; i++) {
+        S->pRing[w + i] = pSrc[i];
+    }
+    for (i = n0; i < n; i++) {
+        S->pRing[i - n0] = pSrc[i];
+    }
+    S->nBuffered += n;
+
+    *pFrames = S->nBuffered < N ? 0 : (S->nBuffered - N) / S->hop + 1;
+    return n;
+}
+
+/* Drop the samples of nFrames transformed frames that no later frame overlaps. */
+static inline void plp_stft_f32_advance(plp_stft_instance_f32 *S, uint32_t nFrames) {
+    uint32_t step = nFrames * S->hop;
+
+    S->readPos = (S->readPos + step) % S->ringLength;
+    S->nBuffered -= step;
+}
+
+#endif
@@ -0,0 +1,163 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_stft_f32.c
+ * Description:  Floating-point streaming STFT on chunks of real input data
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_stft_common.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup feature
+ * @{
+ */
+
+/**
+ * @brief Scratch memory needed by the floating-point streaming STFT
+ *
+ * The ring buffer holds the samples of nPE overlapping frames, and every core needs the windowed
+ * frame and the 2*fftLen output of the real FFT.
+ *
+ * @param[in]  fftLen  frame length
+ * @param[in]  hop     number of samples between the starts of consecutive frames
+ * @param[in]  nPE     number of cores transforming frames together
+ * @return     number of bytes
+ */
+uint32_t plp_stft_f32_get_workspace_size(uint32_t fftLen, uint32_t hop, uint32_t nPE) {
+    return (fftLen + (nPE - 1) * hop + 3 * fftLen * nPE) * sizeof(float32_t);
+}
+
+/**
+ * @brief Set up a floating-point streaming STFT with an empty ring buffer
+ *
+ * Frame k covers the input samples k*hop to k*hop + FFTLength - 1, counted from the first sample
+ * pushed after init. Push FFTLength/2 zeros first to center the frames on the hops.
+ *
+ * @param[out] S           points to the STFT state
+ * @param[in]  SFFT        points to the real FFT instance of the frame length
+ * @param[in]  pWindow     points to the window, FFTLength values
+ * @param[in]  hop         number of samples between frames, 1 to FFTLength
+ * @param[in]  nPE         number of cores transforming frames together
+ * @param[in]  pWorkspace  points to plp_stft_f32_get_workspace_size bytes of memory
+ * @return     0 on success, -1 if the hop or the number of cores is not supported, in which case S
+ *             is left untouched
+ */
+int32_t plp_stft_f32_init(plp_stft_instance_f32 *S,
+                          const plp_fft_instance_f32 *SFFT,
+                          const float32_t *pWindow,
+                          uint32_t hop,
+                          uint32_t nPE,
+                          float32_t *pWorkspace) {
+
+    if (hop == 0 || hop > SFFT->FFTLength) {
+        printf("STFT hop must be between 1 and the frame length\n");
+        return -1;
+    }
+
+    if (nPE == 0) {
+        printf("STFT needs at least one core\n");
+        return -1;
+    }
+
+    S->S = SFFT;
+    S->pWindow = pWindow;
+    S->hop = hop;
+    S->nPE = nPE;
+    S->ringLength = SFFT->FFTLength + (nPE - 1) * hop;
+    S->pRing = pWorkspace;
+    S->pScratch = pWorkspace + S->ringLength;
+    S->readPos = 0;
+    S->nBuffered = 0;
+
+    return 0;
+}
+
+/**
+ * @brief Number of frames the next push of len samples completes, to size its output buffer
+ *
+ * @param[in]  S    points to the STFT state
+ * @param[in]  len  number of samples of the next chunk
+ * @return     number of frames
+ */
+uint32_t plp_stft_f32_get_frame_count(const plp_stft_instance_f32 *S, uint32_t len) {
+    uint32_t total = S->nBuffered + len;
+
+    if (total < S->S->FFTLength) {
+        return 0;
+    }
+    return (total - S->S->FFTLength) / S->hop + 1;
+}
+
+/**
+ * @brief Push a chunk of samples into a floating-point streaming STFT
+ *
+ * The chunk is copied once into the ring buffer, where the overlap with the previous frames stays
+ * in place. Every completed frame is windowed on its way from the ring buffer into the real FFT,
+ * and its FFTLength/2 + 1 complex bins are written to pDst, one frame after the other.
+ *
+ * @param[in,out] S     points to the STFT state
+ * @param[in]     pSrc  points to the chunk
+ * @param[in]     len   number of samples of the chunk, any size
+ * @param[out]    pDst  points to plp_stft_f32_get_frame_count(S, len) * (FFTLength + 2) values
+ * @return        number of frames written to pDst
+ */
+uint32_t plp_stft_f32(plp_stft_instance_f32 *S,
+                      const float32_t *__restrict__ pSrc,
+                      uint32_t len,
+                      float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
+
+    uint32_t frameLen = S->S->FFTLength + 2;
+    uint32_t nOut = 0;
+    uint32_t n, nFrames, f, start;
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return 0;
+    }
+
+    while (len > 0) {
+        n = plp_stft_f32_fill(S, pSrc, len, &nFrames);
+        pSrc += n;
+        len -= n;
+        for (f = 0; f < nFrames; f++) {
+            start = (S->readPos + f * S->hop) % S->ringLength;
+            plp_stft_f32s_xpulpv2(S, start, S->pScratch, pDst);
+            pDst += frameLen;
+        }
+        plp_stft_f32_advance(S, nFrames);
+        nOut += nFrames;
+    }
+
+    return nOut;
+}
+
+/**
+ * @} end of feature group
+ */
@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+ * Project:      PULP DSP Library
+ * Title:        plp_stft_f32_parallel.c
+ * Description:  Floating-point streaming STFT transforming frames in parallel
+ *
+ * $Date:        17. Oct 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+#include "plp_stft_common.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup feature
+ * @{
+ */
+
+/**
+ * @brief Push a chunk of samples into a floating-point streaming STFT, in parallel
+ *
+ * The ring buffer given to plp_stft_f32_init holds nPE overlapping frames, so the chunk is taken
+ * in until nPE frames are complete and each core then transforms a whole frame with a single fork
+ * of the team. Frames still completed at the end of the chunk are transformed right away, with
+ * fewer cores.
+ *
+ * @param[in,out] S     points to the STFT state
+ * @param[in]     pSrc  points to the chunk
+ * @param[in]     len   number of samples of the chunk, any size
+ * @param[out]    pDst  points to plp_stft_f32_get_frame_count(S, len) * (FFTLength + 2) values
+ * @return        number of frames written to pDst
+ */
+uint32_t plp_stft_f32_parallel(plp_stft_instance_f32 *S,
+                               const float32_t *__restrict__ pSrc,
+                               uint32_t len,
+                               float32_t *__restrict__ pDst) {
+    PLP_PROFILE_FUNC();
+
+    uint32_t frameLen = S->S->FFTLength + 2;
+    uint32_t nOut = 0;
+    uint32_t n, nFrames;
+
+    if (hal_cluster_id() == ARCHI_FC_CID && plp_fc_cluster_open() != 0) {
+        printf("Parallel processing supported only for cluster side\n");
+        return 0;
+    }
+
+    while (len > 0) {
+        n = plp_stft_f32_fill(S, pSrc, len, &nFrames);
+        pSrc += n;
+        len -= n;
+        if (nFrames > 0) {
+            plp_stft_instance_f32_parallel args = {
+                .S = S, .nFrames = nFrames, .nPE = nFrames < S->nPE ? nFrames : S->nPE, .pDst = pDst
+            };
+            plp_cl_team_fork(args.nPE, plp_stft_f32p_xpulpv2, (void *)&args);
+            pDst += nFrames * frameLen;
+        }
+        plp_stft_f32_advance(S, nFrames);
+        nOut += nFrames;
+    }
+
+    return nOut;
+}
+
+/**
+ * @} end of feature group
+ */
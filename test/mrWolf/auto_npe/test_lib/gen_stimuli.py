@@ -0,0 +1,38 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if result_parameter.ctype == 'int32_t':
+        a = inputs['srcA'].value.astype(np.int32).reshape((env['len_m'], env['len_n']))
+        b = inputs['srcB'].value.astype(np.int32).reshape((env['len_n'], env['len_o']))
+        result = np.matmul(a, b).astype(np.int32).reshape((env['len_res'], ))
+    elif result_parameter.ctype == 'float':
+        a = inputs['srcA'].value.astype(np.float32).reshape((env['len_m'], env['len_n']))
+        b = inputs['srcB'].value.astype(np.float32).reshape((env['len_n'], env['len_o']))
+        result = np.zeros((env['len_m'], env['len_o']), dtype=np.float32)
+        for m in range(env['len_m']):
+            for o in range(env['len_o']):
+                for n in range(env['len_n']):
+                    result[m, o] = np.float32(result[m, o] + np.float32(a[m, n] * b[n, o]))
+        result = result.reshape((env['len_res'], ))
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    return result
@@ -0,0 +1,39 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if result_parameter.general_name() == 'return_value':
+        return np.int32(0)
+
+    ctype = result_parameter.ctype
+    a = inputs['p1'].value.astype(np.float64)
+    result = np.fft.fft(a[0::2] + 1j * a[1::2])
+    if ctype == 'int16_t':
+        result /= env['len']
+        my_type = np.int16
+    elif ctype == 'float':
+        my_type = np.float32
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
+
+    result = np.stack((result.real, result.imag), axis=1).flatten()
+    if my_type == np.int16:
+        result = np.round(result)
+    return result.astype(my_type)
@@ -0,0 +1,35 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if result_parameter.general_name() == 'return_value':
+        return np.int32(0)
+
+    ctype = result_parameter.ctype
+    if ctype == 'int32_t':
+        my_type = np.int32
+    elif ctype == 'float':
+        my_type = np.float32
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
+
+    a = inputs['pSrcA'].value.astype(np.float64).reshape((env['n_vec'], env['len']))
+    b = inputs['pSrcB'].value.astype(np.float64)
+    return (a @ b).astype(my_type)
@@ -0,0 +1,178 @@
+#! /usr/bin/python3
+
+import os
+import re
+import argparse
+from collections import OrderedDict
+import numpy as np
+
+from bench import read_bench, get_most_recent_bench_filename
+
+# Parallel functions supporting nPE = 0. Each one maps to the name of the model (plp_cost_model_id)
+# and to a function returning (numChunks, chunkSize) for the dimension of the benchmark, as passed
+# to plp_auto_npe by the glue code.
+MODELS = OrderedDict([
+    ('plp_dot_prod_i32_parallel', ('PLP_COST_DOT_PROD_I32', lambda env: (env['len'], 1))),
+    ('plp_dot_prod_q32_parallel', ('PLP_COST_DOT_PROD_Q32', lambda env: (env['len'], 1))),
+    ('plp_dot_prod_f32_parallel', ('PLP_COST_DOT_PROD_F32', lambda env: (env['len'], 1))),
+    ('plp_mult_f32_parallel', ('PLP_COST_MULT_F32', lambda env: (env['len'], 1))),
+    # the integer kernels split the columns of the output (i16 by 2, i8 by 4)
+    ('plp_mat_mult_i32_parallel', ('PLP_COST_MAT_MULT_I32',
+                                   lambda env: (env['len_o'], env['len_m'] * env['len_n']))),
+    ('plp_mat_mult_i16_parallel', ('PLP_COST_MAT_MULT_I16',
+                                   lambda env: ((env['len_o'] + 1) // 2,
+                                                2 * env['len_m'] * env['len_n']))),
+    ('plp_mat_mult_i8_parallel', ('PLP_COST_MAT_MULT_I8',
+                                  lambda env: ((env['len_o'] + 3) // 4,
+                                               4 * env['len_m'] * env['len_n']))),
+    # the fixed-point and float kernels split the rows
+    ('plp_mat_mult_q32_parallel', ('PLP_COST_MAT_MULT_Q32',
+                                   lambda env: (env['len_m'], env['len_n'] * env['len_o']))),
+    ('plp_mat_mult_q16_parallel', ('PLP_COST_MAT_MULT_Q16',
+                                   lambda env: (env['len_m'], env['len_n'] * env['len_o']))),
+    ('plp_mat_mult_q8_parallel', ('PLP_COST_MAT_MULT_Q8',
+                                  lambda env: (env['len_m'], env['len_n'] * env['len_o']))),
+    ('plp_mat_mult_f32_parallel', ('PLP_COST_MAT_MULT_F32',
+                                   lambda env: (env['len_m'], env['len_n'] * env['len_o']))),
+])
+
+OUTPUT_FILE = os.path.join(os.path.dirname(os.path.realpath(__file__)),
+                           "../../src/CommonTables/plp_cost_model.c")
+
+MODEL_RE = re.compile(r"^\s*\[(PLP_COST_\w+)\]\s*=\s*\{\s*(\d+),\s*(\d+),\s*(\d+)\s*\},")
+
+
+def main():
+    """ Main Function """
+    parser = argparse.ArgumentParser(prog='cost_model',
+                                     description='Fit the cost models of plp_auto_npe to benchmarks')
+    parser.add_argument('-b', '--bench-file', type=str, nargs='+',
+                        help='Benchmark CSV files to be read. If unspecified, take the most recent.')
+    parser.add_argument('-d', '--device', type=str, default='riscy',
+                        help='Device of the benchmarks (default: riscy)')
+    parser.add_argument('-o', '--output', type=str, default=OUTPUT_FILE,
+                        help='Generated C file (default: src/CommonTables/plp_cost_model.c)')
+    parser.add_argument('-n', '--dry-run', action='store_true',
+                        help='Only print the fitted models')
+    args = parser.parse_args()
+
+    if args.bench_file is None:
+        cwd = os.path.dirname(os.path.realpath(__file__))
+        bench_files = [os.path.join(cwd, get_most_recent_bench_filename())]
+    else:
+        bench_files = args.bench_file
+
+    runs = [r for f in bench_files for r in read_bench(f) if r.device == args.device]
+
+    # start from the current models, and replace the ones for which there are benchmarks
+    models = read_models(args.output)
+    for function_name, (model_id, chunks) in MODELS.items():
+        samples = []
+        for run in runs:
+            if run.name != function_name:
+                continue
+            env = parse_dimension(run.dimension)
+            # nPE = 0 runs use the model, they cannot be used to fit it
+            if env.get('nPE', 0) == 0:
+                continue
+            num_chunks, chunk_size = chunks(env)
+            samples.append((num_chunks, chunk_size, env['nPE'], run.cycles))
+        if len({(s[0], s[1], s[2]) for s in samples}) < 3:
+            print("{}: not enough benchmarks, keep the current model".format(function_name))
+            continue
+        models[model_id] = fit(samples)
+        print("{}: fixed={}, perCore={}, perUnit={}/256, mean error={:.1f}%".format(
+            function_name, *models[model_id], mean_error(models[model_id], samples) * 100))
+
+    if not args.dry_run:
+        write_models(args.output, models, bench_files)
+
+
+def parse_dimension(dimension):
+    """ parses the dimension column (like "len_m=4; len_n=8; nPE=2") into a dict of integers """
+    env = {}
+    for part in dimension.split(";"):
+        key, _, value = part.strip().partition("=")
+        try:
+            env[key] = int(value)
+        except ValueError:
+            pass
+    return env
+
+
+def predict(model, num_chunks, chunk_size, n_pe):
+    """ same computation as plp_auto_npe_cost """
+    chunks_per_core = (num_chunks + n_pe - 1) // n_pe
+    return model[0] + model[1] * n_pe + (model[2] * chunks_per_core * chunk_size) // 256
+
+
+def fit(samples):
+    """ least-squares fit of (fixed, perCore, perUnit), clamped to non-negative integers """
+    x = np.array([[1.0, n_pe, ((num_chunks + n_pe - 1) // n_pe) * chunk_size / 256.0]
+                  for num_chunks, chunk_size, n_pe, _ in samples])
+    y = np.array([cycles for _, _, _, cycles in samples], dtype=float)
+    coef = np.linalg.lstsq(x, y, rcond=None)[0]
+    return tuple(max(int(round(c)), 0) for c in coef)
+
+
+def mean_error(model, samples):
+    """ mean relative error of the predicted cycles """
+    return np.mean([abs(predict(model, c, s, p) - cycles) / cycles for c, s, p, cycles in samples])
+
+
+def read_models(filename):
+    """ reads the current models from the generated C file """
+    models = OrderedDict((model_id, (0, 0, 0)) for model_id, _ in MODELS.values())
+    if os.path.isfile(filename):
+        with open(filename, "r") as f:
+            for line in f:
+                m = MODEL_RE.match(line)
+                if m:
+                    models[m.group(1)] = (int(m.group(2)), int(m.group(3)), int(m.group(4)))
+    return models
+
+
+def write_models(filename, models, bench_files):
+    """ writes the generated C file """
+    entries = "\n".join(["    [{}] = {{ {}, {}, {} }},".format(model_id, *model)
+                         for model_id, model in models.items()])
+    with open(filename, "w") as f:
+        f.write(HEADER.format(sources=", ".join([os.path.basename(b) for b in bench_files])))
+        f.write("plp_cost_model plp_cost_models[PLP_COST_NB] = {{\n{}\n}};\n".format(entries))
+    print("written to {}".format(filename))
+
+
+HEADER = """\
+/** ==========================================================================
+ * @file     plp_cost_model.c
+ * @brief    Cost models of the parallel functions, used by plp_auto_npe
+ * @version  V0
+ * @date     17. Oct 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Generated by test/mrWolf/cost_model.py from {sources}, do not edit.
+ * { fixed, perCore, perUnit (1/256 cycles) }, see plp_cost_model. */
+
+#include "plp_math.h"
+
+"""
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,36 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    ctype = result_parameter.ctype
+    if ctype != 'float':
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
+
+    # X[k] = sum_n x[n] exp(-j 2 pi f_k n), with f_k = fStart + k fStep, or k / len for the DFT
+    src = inputs['pSrc'].value.astype(np.float64)
+    x = src[0::2] + 1j * src[1::2]
+    n = np.arange(env['n'])
+    k = np.arange(env['bins']).reshape((env['bins'], 1))
+    if env['dft']:
+        f = k / env['n']
+    else:
+        f = np.float32(env['start']) + k * np.float32(env['step'])
+    result = np.exp(-2j * np.pi * f * n) @ x
+    return np.stack((result.real, result.imag), axis=1).flatten().astype(np.float32)
@@ -0,0 +1,45 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def dct2(x):
+    """ X[k] = sum_n x[n] cos(pi k (2n + 1) / (2N)) """
+    n = len(x)
+    k = np.arange(n).reshape((n, 1))
+    return np.cos(np.pi * k * (2 * np.arange(n) + 1) / (2 * n)) @ x
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    n = env['n']
+    ctype = result_parameter.ctype
+    if ctype == 'int16_t' or ctype == 'int32_t':
+        # X[k] = 1/N sum_n x[n] cos(pi k (2n + 1) / (2N)), in the input format
+        my_type = np.int16 if ctype == 'int16_t' else np.int32
+        x = inputs['pSrc'].value.astype(np.float64)
+        return np.round(dct2(x) / n).astype(my_type)
+    elif ctype == 'float':
+        # twice the sum as in scipy.fft.dct, or the orthonormal scaling
+        x = inputs['pSrc'].value.astype(np.float64)
+        result = 2 * dct2(x)
+        if env['ortho']:
+            result *= np.sqrt(1 / (2 * n))
+            result[0] *= np.sqrt(1 / 2)
+        return result.astype(np.float32)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
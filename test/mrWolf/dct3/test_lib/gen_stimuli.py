@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def dct3(x):
+    """ y[n] = x[0] + 2 sum_{k>0} x[k] cos(pi k (2n + 1) / (2N)) """
+    n = len(x)
+    k = np.arange(n)
+    c = np.cos(np.pi * np.arange(n).reshape((n, 1)) * (2 * k + 1) / (2 * n)).T
+    return 2 * (c @ x) - x[0]
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    n = env['n']
+    ctype = result_parameter.ctype
+    if ctype == 'int16_t' or ctype == 'int32_t':
+        # x[n] = 1/N X[0] + 2/N sum_{k>0} X[k] cos(pi k (2n + 1) / (2N)), in the input format
+        my_type = np.int16 if ctype == 'int16_t' else np.int32
+        info = np.iinfo(my_type)
+        x = inputs['pSrc'].value.astype(np.float64)
+        return np.clip(np.round(dct3(x) / n), info.min, info.max).astype(my_type)
+    elif ctype == 'float':
+        # inverse of plp_dct2_f32 with the same scaling, as scipy.fft.idct
+        x = inputs['pSrc'].value.astype(np.float64)
+        if env['ortho']:
+            x = x * np.sqrt(n / 2)
+            x[0] *= np.sqrt(2)
+            return (dct3(x) / n).astype(np.float32)
+        return (dct3(x) / (2 * n)).astype(np.float32)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
@@ -0,0 +1,42 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def dct4(x):
+    """ X[k] = sum_n x[n] cos(pi (2k + 1) (2n + 1) / (4N)) """
+    n = len(x)
+    k = np.arange(n).reshape((n, 1))
+    return np.cos(np.pi * (2 * k + 1) * (2 * np.arange(n) + 1) / (4 * n)) @ x
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    n = env['n']
+    ctype = result_parameter.ctype
+    if ctype == 'int16_t' or ctype == 'int32_t':
+        # X[k] = 1/N sum_n x[n] cos(pi (2k + 1) (2n + 1) / (4N)), in the input format
+        my_type = np.int16 if ctype == 'int16_t' else np.int32
+        x = inputs['pSrc'].value.astype(np.float64)
+        return np.round(dct4(x) / n).astype(my_type)
+    elif ctype == 'float':
+        # factor 2, or sqrt(2/N) for the orthonormal DCT-IV
+        x = inputs['pSrc'].value.astype(np.float64)
+        scale = np.sqrt(2 / n) if env['ortho'] else 2
+        return (scale * dct4(x)).astype(np.float32)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if result_parameter.general_name() == 'return_value':
+        return np.int32(0)
+
+    a = inputs['pSrcA'].value.astype(np.int64)
+    b = inputs['pSrcB'].value.astype(np.int64)
+    n = env['small_len']
+    small = np.dot(a[:n], b[:n])
+    return np.array([small, np.dot(a, b), small], dtype=np.int32)
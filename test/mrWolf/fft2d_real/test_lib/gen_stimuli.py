@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    ctype = result_parameter.ctype
+    if ctype != 'float':
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
+
+    x = inputs['pSrc'].value.astype(np.float64).reshape((env['rows'], env['cols']))
+    result = np.fft.fft2(x)
+    return np.stack((result.real, result.imag), axis=2).flatten().astype(np.float32)
@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    ctype = result_parameter.ctype
+    if ctype == 'int16_t':
+        my_type = np.int16
+    elif ctype == 'float':
+        my_type = np.float32
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
+
+    # the batch matches the frame by frame transforms
+    return np.zeros(env['buf_len'], dtype=my_type)
@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    a = inputs['p1'].value.astype(np.int64)
+    result, exponent = bfp_fft_q16(a[0::2].copy(), a[1::2].copy())
+
+    if "return_value" in result_parameter.name:
+        return exponent
+    else:
+        return result
+
+
+def headroom(*values):
+    """ redundant sign bits of 16-bit values """
+    m = 0
+    for v in values:
+        m |= int(np.bitwise_or.reduce(v ^ (v >> 15), axis=None))
+    h = 0
+    while h < 15 and (m & (0x4000 >> h)) == 0:
+        h += 1
+    return h
+
+
+def bfp_fft_q16(re, im):
+    """ bit exact model of plp_cfft_bfp_q16: radix-2 DIF with the stages shifted down by the
+    missing headroom (2 bits before the twiddled stages, 1 before the last one) """
+    n = len(re)
+    k = np.arange(n // 2)
+    cos = np.minimum(np.floor(np.cos(2 * np.pi * k / n) * 32768), 32767).astype(np.int64)
+    sin = np.minimum(np.floor(np.sin(2 * np.pi * k / n) * 32768), 32767).astype(np.int64)
+
+    exponent = 0
+    h = headroom(re, im)
+    if h > 2:
+        re <<= h - 2
+        im <<= h - 2
+        exponent -= h - 2
+        h = 2
+
+    half = n // 2
+    while half >= 1:
+        shift = max(0, (2 if half > 1 else 1) - h)
+        exponent += shift
+        xr = (re >> shift).reshape(-1, 2, half)
+        xi = (im >> shift).reshape(-1, 2, half)
+        sr = xr[:, 0, :] + xr[:, 1, :]
+        si = xi[:, 0, :] + xi[:, 1, :]
+        dr = xr[:, 0, :] - xr[:, 1, :]
+        di = xi[:, 0, :] - xi[:, 1, :]
+        if half > 1:
+            c = cos[np.arange(half) * (n // 2 // half)]
+            s = sin[np.arange(half) * (n // 2 // half)]
+            dr, di = (dr * c + di * s) >> 15, (di * c - dr * s) >> 15
+        re = np.stack((sr, dr), axis=1).reshape(n)
+        im = np.stack((si, di), axis=1).reshape(n)
+        h = headroom(re, im)
+        half //= 2
+
+    bits = n.bit_length() - 1
+    rev = np.array([int(format(i, '0%db' % bits)[::-1], 2) for i in range(n)])
+    result = np.zeros(2 * n, dtype=np.int16)
+    result[0::2] = re[rev]
+    result[1::2] = im[rev]
+    return result, exponent
@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if result_parameter.ctype in ('int16_t', 'int32_t'):
+        fix = 15 if result_parameter.ctype == 'int16_t' else 31
+        my_type = np.int16 if fix == 15 else np.int32
+        a = inputs['pSrc'].value.astype(np.float64) / 2**fix
+        if env['ifft']:
+            # inverse transform of the bins 0 .. N/2, including the 1/N factor
+            result = np.fft.irfft(a[0::2] + 1j * a[1::2], env['len'])
+        else:
+            # forward transform with the 1/N scaling of plp_rfft_q16 / plp_rfft_q32
+            spectrum = np.fft.rfft(a) / len(a)
+            result = np.zeros(len(a) + 2, dtype=np.float64)
+            result[0::2] = np.real(spectrum)
+            result[1::2] = np.imag(spectrum)
+        result = np.clip(np.round(result * 2**fix), -2**fix, 2**fix - 1).astype(my_type)
+
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    return result
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if result_parameter.general_name() == 'return_value':
+        return np.int32(0)
+    if result_parameter.ctype != 'int32_t':
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    a = inputs['srcA'].value.astype(np.int32)
+    b = inputs['srcB'].value.astype(np.int32)
+    return np.convolve(a, b, mode='full')
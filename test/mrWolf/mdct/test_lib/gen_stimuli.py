@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def mdct(frame, window):
+    """ X[k] = sum_n w[n] x[n] cos(pi / M (n + 1/2 + M/2) (k + 1/2)) """
+    m = len(frame) // 2
+    n = np.arange(2 * m)
+    k = np.arange(m).reshape((m, 1))
+    return np.cos(np.pi / m * (n + 0.5 + m / 2) * (k + 0.5)) @ (window * frame)
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    m = env['M']
+    ctype = result_parameter.ctype
+    x = inputs['pSrc'].value.astype(np.float64)
+    w = inputs['pWindow'].value.astype(np.float64)
+    if ctype == 'int16_t':
+        # the fixed-point coefficients are divided by 2M
+        scale = 1 / (2 * m)
+        w = w / 32768
+        my_type = np.int16
+    elif ctype == 'float':
+        scale = 1
+        my_type = np.float32
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
+
+    if result_parameter.general_name() == 'pCoef':
+        # the first frame starts with M zeros
+        padded = np.concatenate((np.zeros(m), x))
+        result = np.concatenate([mdct(padded[f * m:(f + 2) * m], w) * scale
+                                 for f in range(env['frames'])])
+    else:
+        # the reconstruction is delayed by M samples
+        result = np.concatenate((np.zeros(m), x[:-m]))
+    if my_type == np.int16:
+        result = np.round(result)
+    return result.astype(my_type)
@@ -0,0 +1,42 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    ctype = result_parameter.ctype
+    first = inputs['fbFirst'].value.astype(np.int64)
+    length = inputs['fbLength'].value.astype(np.int64)
+    offset = np.concatenate(([0], np.cumsum(length)))
+    if ctype == 'int32_t':
+        # Q30 squared magnitudes weighted by the Q15 filters, in Q31
+        x = inputs['pSrc'].value.astype(np.int64)
+        v = inputs['fbV'].value.astype(np.int64)
+        power = x[0::2] ** 2 + x[1::2] ** 2
+        result = [(power[first[m]:first[m] + length[m]] * v[offset[m]:offset[m + 1]]).sum() >> 14
+                  for m in range(env['n_mels'])]
+        return np.minimum(np.array(result), 2**31 - 1).astype(np.int32)
+    elif ctype == 'float':
+        x = inputs['pSrc'].value.astype(np.float64)
+        v = inputs['fbV'].value.astype(np.float64)
+        power = x[0::2] ** 2 + x[1::2] ** 2
+        result = [(power[first[m]:first[m] + length[m]] * v[offset[m]:offset[m + 1]]).sum()
+                  for m in range(env['n_mels'])]
+        return np.array(result).astype(np.float32)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def dct2(x):
+    """ X[k] = sum_n x[n] cos(pi k (2n + 1) / (2N)) """
+    n = len(x)
+    k = np.arange(n).reshape((n, 1))
+    return np.cos(np.pi * k * (2 * np.arange(n) + 1) / (2 * n)) @ x
+
+
+def mel_energies(x, window, values, first, length):
+    power = np.abs(np.fft.rfft(x * window)) ** 2
+    offset = np.concatenate(([0], np.cumsum(length)))
+    return np.array([(power[first[m]:first[m] + length[m]] * values[offset[m]:offset[m + 1]]).sum()
+                     for m in range(len(first))])
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    ctype = result_parameter.ctype
+    first = inputs['fbFirst'].value.astype(np.int64)
+    length = inputs['fbLength'].value.astype(np.int64)
+    x = inputs['pSrc'].value.astype(np.float64)
+    window = inputs['window'].value.astype(np.float64)
+    values = inputs['fbV'].value.astype(np.float64)
+    if ctype == 'int16_t':
+        # everything in Q15, ln(mel + 2^-20), the Q15 DCT matrix and Q7 MFCCs
+        mel = mel_energies(x / 32768, window / 32768, values / 32768, first, length)
+        dct = inputs['pDctCoefs'].value.astype(np.float64).reshape((env['n_dct'], env['n_mels']))
+        result = dct / 32768 @ np.log(mel + 2**-20) * 128
+        return np.clip(np.round(result), -32768, 32767).astype(np.int16)
+    elif ctype == 'float':
+        # ln(mel + 1e-6), and the DCT-II of plp_dct2_f32
+        mel = mel_energies(x, window, values, first, length)
+        result = 2 * dct2(np.log(mel + 1e-6))
+        if env['ortho']:
+            result *= np.sqrt(1 / (2 * env['n_mels']))
+            result[0] *= np.sqrt(1 / 2)
+        return result.astype(np.float32)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % ctype)
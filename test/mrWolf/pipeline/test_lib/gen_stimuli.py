@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+####################
+# generate_stimuli #
+####################
+
+
+def generate_stimuli(arg, env):
+    """
+    Function to generate the stimuli
+
+    Arguments
+    ---------
+    arg: Argument for which to generate stimuli (either Argument or ArrayArgument)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    """
+    # name = arg.name
+    # if name == "srcA":
+    #     # generate and return stimuli for srcA
+    # if name == "srcB":
+    #     # generate and return stimuli for srcB
+    # ...
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    # same stages as in makeOps (testset.cfg), each result is truncated to the data type
+    if fix_point is not None:
+        raise RuntimeError("FixPoint is not supported")
+    elif result_parameter.ctype == 'float':
+        x = inputs['pSrc'].value.astype(np.float32)
+        w = inputs['pW'].value.astype(np.float32)
+        x = x * w
+        x = x + np.float32(0.25)
+        x = np.abs(x)
+        x = x * np.float32(-0.5)
+        result = (x - w).astype(np.float32)
+    elif result_parameter.ctype in ('int8_t', 'int16_t'):
+        dtype = np.int8 if result_parameter.ctype == 'int8_t' else np.int16
+        x = inputs['pSrc'].value.astype(dtype)
+        w = inputs['pW'].value.astype(dtype)
+        x = ((x.astype(np.int32) * w.astype(np.int32)) >> 4).astype(dtype)
+        x = (x.astype(np.int32) + 3).astype(dtype)
+        x = np.abs(x.astype(np.int32)).astype(dtype)
+        x = ((x.astype(np.int32) * -3) >> 1).astype(dtype)
+        result = (x.astype(np.int32) - w.astype(np.int32)).astype(dtype)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    return result
@@ -13,11 +13,15 @@ from textwrap import dedent, indent, wrap
 import struct
 import traceback
 import re
+import json
 
 GENERATE_STIMULI = "gen_stimuli"
 # L2_MEM_SIZE_KB = 448
 TEST_MEM_SIZE_KB = 256
 
+# root of the repository, whose lib/host/libplpdsp.a is linked by the tests with TEST_PLATFORM=host
+PLP_DSP_HOME = os.path.abspath(os.path.join(os.path.dirname(os.path.realpath(__file__)), "../.."))
+
 
 class Variable(object):
     """Variable"""
@@ -56,7 +60,7 @@ class DynamicVariable(Variable):
 
 class Argument(object):
     """docstring for argument"""
-    def __init__(self, name, ctype, value=None, use_l1=None, in_function=True):
+    def __init__(self, name, ctype, value=None, use_l1=None, in_function=True, active=None):
         """
         name: name of the argument (in the function declaration)
         ctype: String, one of the following:
@@ -77,6 +81,8 @@ class Argument(object):
         use_l1: if True, use L1 memory. If None, use default value configured in generate_test
         in_function: Boolean, if True, add this argument to the function signature. Set this to
                      False, and use CustomArgument to create struts.
+        active: Function, which maps the version name to a boolean, to use the argument only for
+                some versions (e.g. when the floating-point version takes an additional argument).
         """
         super(Argument, self).__init__()
         self.name = name
@@ -84,6 +90,7 @@ class Argument(object):
         self.value = value
         self.use_l1 = use_l1
         self.in_function = in_function
+        self.active = active if callable(active) else lambda v: True
         if isinstance(self.value, SweepVariable):
             self.value = self.value.name
 
@@ -133,6 +140,12 @@ class Argument(object):
             return np.int16
         if self.ctype == "int32_t":
             return np.int32
+        if self.ctype == "uint8_t":
+            return np.uint8
+        if self.ctype == "uint16_t":
+            return np.uint16
+        if self.ctype == "uint32_t":
+            return np.uint32
         if self.ctype == "float":
             return np.float32
         raise RuntimeError("Unknown type: %s" % self.ctype)
@@ -199,7 +212,8 @@ class Argument(object):
 
 class ArrayArgument(Argument):
     """Array Argument"""
-    def __init__(self, name, ctype, length, value=None, use_l1=None, in_function=True):
+    def __init__(self, name, ctype, length, value=None, use_l1=None, in_function=True,
+                 active=None):
         """
         name: name of the argument
         ctype: String, one of the following:
@@ -225,8 +239,9 @@ class ArrayArgument(Argument):
         use_l1: if True, use L1 memory. If None, use default value configured in generate_test
         in_function: Boolean, if True, add this argument to the function signature. Set this to
                      False, and use CustomArgument to create struts.
+        active: Function, which maps the version name to a boolean, see Argument.
         """
-        super(ArrayArgument, self).__init__(name, ctype, value, use_l1, in_function)
+        super(ArrayArgument, self).__init__(name, ctype, value, use_l1, in_function, active)
         self.length = length
         if isinstance(self.length, SweepVariable):
             self.length = self.length.name
@@ -267,8 +282,8 @@ class ArrayArgument(Argument):
             return dedent(
                 """\
                 {l1_name} = hal_cl_l1_malloc(sizeof({ctype}) * {len});
-                hal_cl_dma_cmd((unsigned int){l2_name},
-                              (unsigned int){l1_name},
+                hal_cl_dma_cmd((uintptr_t){l2_name},
+                              (uintptr_t){l1_name},
                               sizeof({ctype}) * {len},
                               HAL_CL_DMA_DIR_EXT2LOC, 0, &copy);
                 hal_cl_dma_cmd_wait(&copy);
@@ -295,8 +310,8 @@ class ArrayArgument(Argument):
         dtype = self.get_dtype()
         if callable(self.value):
             self.value = call_dynamic_function(self.value, env, version, device)
-        if self.value == GENERATE_STIMULI:
-            self.value = call_dynamic_function(gen_stimuli, env, version, device, variable=self)
+        if isinstance(self.value, str) and self.value == GENERATE_STIMULI:
+            self.value = call_dynamic_function(gen_stimuli, env, version, device, argument=self)
         if isinstance(self.value, str):
             self.value = env[self.value]
         if self.value is None or (isinstance(self.value, (tuple, list)) and len(self.value) == 2):
@@ -591,7 +606,8 @@ class CustomArgument(Argument):
     externally defined variable, struct or array. But it can also be used to create a struct with
     fields, which may point to other arguments.
     """
-    def __init__(self, name, value, as_ptr=False, deref=False, in_function=True):
+    def __init__(self, name, value, as_ptr=False, deref=False, in_function=True, setup=None,
+                 free=None, active=None):
         """
         name: Name of the argument (in the initialization and function declaration)
         value: Function, which should return a string for initializing the CustomVariable.
@@ -615,10 +631,17 @@ class CustomArgument(Argument):
                is passed without dereferencing it.
         in_function: Boolean, if True, add this argument to the function signature. Set this to
                      False, and use CustomArgument to create struts.
+        setup: Function with the same arguments as value, which returns the code to initialize the
+               variable at runtime, before the function is benchmarked (e.g. to create an FFT plan).
+        free: Function with the same arguments as value, which returns the code to release what
+              setup has allocated.
+        active: Function, which maps the version name to a boolean, see Argument.
         """
-        super(CustomArgument, self).__init__(name, None, value, None, in_function)
+        super(CustomArgument, self).__init__(name, None, value, None, in_function, active)
         self.as_ptr = as_ptr
         self.deref = deref
+        self.setup = setup
+        self.free = free
         assert not (self.as_ptr and self.deref)
 
     def apply(self, env, var_type, version, use_l1, idx, device):
@@ -631,8 +654,22 @@ class CustomArgument(Argument):
         self.name = arg_name(self.name)
         self.value = call_dynamic_function(self.value, env, version, device, use_l1=use_l1,
                                            arg_name=arg_name)
+        if self.setup is not None:
+            self.setup = call_dynamic_function(self.setup, env, version, device, use_l1=use_l1,
+                                               arg_name=arg_name)
+        if self.free is not None:
+            self.free = call_dynamic_function(self.free, env, version, device, use_l1=use_l1,
+                                              arg_name=arg_name)
         return self
 
+    def run_test_setup_str(self):
+        """ returns the string for setup the variable """
+        return self.setup
+
+    def run_test_free_str(self):
+        """ string to free up memory for the variable """
+        return self.free
+
     def arg_str(self):
         """ Returns the string to show for funciton argument """
         if not self.in_function:
@@ -780,6 +817,16 @@ class AggregatedTestCase(object):
                 printf("\\n#@# output end\\n");
                 printf("#@# tcdm_cont: %d\\n", hal_perf_read(HAL_PERF_TCDM_CONT));
 
+            #ifdef PLP_TRACE
+                // run 5: record the per-core timeline of the parallel kernels
+                plp_trace_start();
+                t{idx}__do_bench(&perf, 1<<HAL_PERF_CYCLES, 0);
+                plp_trace_stop();
+                printf("\\n#@# trace start\\n");
+                plp_trace_dump();
+                printf("#@# trace end\\n");
+            #endif
+
                 // free up all memory
             {free}
 
@@ -845,6 +892,10 @@ class AggregatedTest(object):
         if self.device_name == "ibex":
             use_l1 = False
 
+        # streaming versions read their operands from L2
+        if version.endswith('stream'):
+            use_l1 = False
+
         # set n_ops function
         if n_ops is None:
             self.n_ops = lambda env: 0
@@ -868,17 +919,21 @@ class AggregatedTest(object):
         else:
             var_type = ['float', 'float']
 
-        # arguments based on if fix-point and parallel is used
-        if not version.startswith('q') and not version.endswith('parallel'):
+        # arguments based on if fix-point and parallel is used (streaming versions also take nPE)
+        parallel = version.endswith('parallel') or version.endswith('stream')
+        if not version.startswith('q') and not parallel:
             arguments = [arg for arg in arguments
                          if not isinstance(arg, (FixPointArgument, ParallelArgument))]
-        if not version.startswith('q') and version.endswith('parallel'):
+        if not version.startswith('q') and parallel:
             arguments = [arg for arg in arguments if not isinstance(arg, FixPointArgument)]
-        if version.startswith('q') and not version.endswith('parallel'):
+        if version.startswith('q') and not parallel:
             arguments = [arg for arg in arguments if not isinstance(arg, ParallelArgument)]
-        if version.startswith('q') and version.endswith('parallel'):
+        if version.startswith('q') and parallel:
             arguments = arguments
 
+        # arguments which are only used by some versions
+        arguments = [arg for arg in arguments if arg.active(version)]
+
         # check fixpoint stuff
         if version.startswith('q'):
             assert len([arg for arg in arguments if isinstance(arg, FixPointArgument)]) == 1
@@ -1023,6 +1078,40 @@ class AggregatedTest(object):
         else:
             raise RuntimeError("Unknown device name: {}".format(self.device_name))
 
+        # the native host build replaces the Makefile of the Pulp-SDK
+        if os.environ.get("TEST_PLATFORM") == "host":
+            self.generate_host_makefile()
+
+    def generate_host_makefile(self):
+        """
+        generate the Makefile for TEST_PLATFORM=host, which links the program with the library
+        built by `make host` (see include/rtos_hal_host.h). The ibex tests run on the emulated
+        fabric controller, the riscy tests on the emulated cluster.
+        """
+        srcs = "test.c" if self.device_name == "ibex" else "test.c cluster.c"
+        with open(os.path.join(self.sub_folder, "Makefile"), "w") as fp:
+            fp.write(dedent(
+                """\
+                PLP_DSP_HOME ?= {home}
+                CFLAGS += -DRTOS_HOST -I$(PLP_DSP_HOME)/include -I. -O3 -g
+                LDLIBS += $(PLP_DSP_HOME)/lib/host/libplpdsp.a -lm -pthread
+                ifdef TFLAGS
+                    CFLAGS += $(TFLAGS)
+                endif
+                ifdef PLP_TRACE
+                    CFLAGS += -DPLP_TRACE
+                endif
+                all: test
+                test: {srcs}
+                \t$(CC) $(CFLAGS) $^ $(LDLIBS) -o $@
+                run: test
+                \t./test
+                clean:
+                \trm -f test
+                .PHONY: all run clean
+                """
+            ).format(home=PLP_DSP_HOME, srcs=srcs))
+
     def generate_ibex_test_program(self, start, end):
         """ generate all files needed for the ibex test """
         with open(os.path.join(self.sub_folder, "test.c"), "w") as fp:
@@ -1043,6 +1132,9 @@ class AggregatedTest(object):
                     {test_entry}
 
                     int main(void) {{
+                    #ifdef RTOS_HOST
+                    plp_host_set_cluster_id(ARCHI_FC_CID);
+                    #endif
                     test_entry();
                     return 0;
                     }}
@@ -1065,6 +1157,9 @@ class AggregatedTest(object):
                 ifdef TFLAGS
                     PULP_CFLAGS += $(TFLAGS)
                 endif
+                ifdef PLP_TRACE
+                    PULP_CFLAGS += -DPLP_TRACE
+                endif
                 include $(PULP_SDK_HOME)/install/rules/pulp_rt.mk
                 PULP_CFLAGS += -D DATA=$(CONFIG_BUILD_DIR)$(BUILD_DIR_EXT)
                 """
@@ -1090,6 +1185,8 @@ class AggregatedTest(object):
                     pi_cluster_open(&cluster_dev);
                     pi_cluster_send_task_to_cl(&cluster_dev, &cluster_task);
                     pi_cluster_close(&cluster_dev);
+                #elif defined(RTOS_HOST)
+                    cluster_entry(NULL);
                 #else
                     rt_cluster_mount(1, 0, 0, NULL);
                     rt_cluster_call(NULL, 0, cluster_entry, NULL, NULL, 0, 0, 0, NULL);
@@ -1150,6 +1247,9 @@ class AggregatedTest(object):
                     ifdef TFLAGS
                         PULP_CFLAGS += $(TFLAGS)
                     endif
+                    ifdef PLP_TRACE
+                        PULP_CFLAGS += -DPLP_TRACE
+                    endif
                     ifeq '$(PULP_RTOS)'  'pmsis'
                     PULP_CFLAGS += -DRTOS_PMSIS
                     include $(RULES_DIR)/pmsis_rules.mk
@@ -1234,6 +1334,9 @@ def check_output(config, output, test_obj):
         if passed:
             bench_output(result, test_obj, case)
 
+    if any([result['trace'] for result in cases_result]):
+        trace_output(cases_result, test_obj)
+
     for case_idx in tests_missing:
         case = test_obj.cases[case_idx]
         status = '\033[93mSKIP:\033[0m'
@@ -1251,6 +1354,7 @@ def parse_output(output):
     cases = []
     current_case = -1
     user_msg_mode = False
+    trace_mode = False
     gvsoc_error_str = []
     gvsoc_error_re = re.compile("^[0-9]*: [0-9]*: \[.*\]")
     for line in output.split('\n'):
@@ -1266,6 +1370,14 @@ def parse_output(output):
                 cases[current_case]['user_msg'].append(line)
             continue
 
+        if trace_mode:
+            # special mode where the events of plp_trace_dump are collected
+            if "#@# trace end" in line:
+                trace_mode = False
+            else:
+                cases[current_case]['trace'].append(line.strip())
+            continue
+
         # normal parsing mode
         line = line.strip()
         if line == "#@# }":
@@ -1282,7 +1394,8 @@ def parse_output(output):
                           'load_stalls': 0,
                           'icache_miss': 0,
                           'tcdm_cont': 0,
-                          'mismatches': []})
+                          'mismatches': [],
+                          'trace': []})
         elif line.startswith('#@# passed:'):
             cases[current_case]['passed'] = line.find('1') != -1
         elif line.startswith('#@# cycles'):
@@ -1299,6 +1412,8 @@ def parse_output(output):
             cases[current_case]['mismatches'].append("Mismatch: %s" % line[13:])
         elif "#@# output start" in line:
             user_msg_mode = True
+        elif "#@# trace start" in line:
+            trace_mode = True
         elif gvsoc_error_re.match(line):
             gvsoc_error_str.append(line[line.find("["):])
         elif line.startswith('#@# error:'):
@@ -1348,6 +1463,74 @@ def bench_output(performance, test_obj, test_case):
         f.write("\n")
 
 
+TRACE_EVENTS = ["fork", "join", "start", "end", "barrier_enter", "barrier_leave"]
+
+
+def trace_output(cases_result, test_obj):
+    """
+    Writes the events recorded by plp_trace (tests built with PLP_TRACE) as a Chrome trace, which
+    can be opened with chrome://tracing or https://ui.perfetto.dev. Each test case is a process and
+    each core a thread. The timestamps are cycles of the cluster timer, shown as microseconds.
+    """
+    events = []
+    for case_idx, result in enumerate(cases_result):
+        case = test_obj.cases[case_idx]
+        dimension = ", ".join(["%s=%s" % (k, str(case.env[k])) for k in test_obj.visible_env])
+        events.append({'name': 'process_name', 'ph': 'M', 'pid': case_idx,
+                       'args': {'name': "%s (%s)" % (test_obj.function_name, dimension)}})
+
+        # collect the events of each fork, per core
+        forks = OrderedDict()
+        names = {}
+        for line in result['trace']:
+            parts = line.split(",")
+            if len(parts) != 5 or parts[2] not in TRACE_EVENTS:
+                continue
+            fork, core, event, time_stamp, kernel = parts
+            fork, core, time_stamp = int(fork), int(core), int(time_stamp)
+            if kernel:
+                names[fork] = kernel
+            forks.setdefault(fork, {}).setdefault(core, []).append((event, time_stamp))
+
+        cores = set()
+        for fork, fork_cores in forks.items():
+            name = "%s #%d" % (names.get(fork, test_obj.function_name), fork)
+            join = max([t for c in fork_cores.values() for e, t in c if e == "join"] or [0])
+            for core, core_events in fork_cores.items():
+                cores.add(core)
+                begin = {}
+                for event, time_stamp in core_events:
+                    if event in ["fork", "start", "barrier_enter"]:
+                        begin[event.split("_")[0]] = time_stamp
+                    elif event == "join" and "fork" in begin:
+                        fork_time = begin.pop("fork")
+                        events.append({'name': "fork " + name, 'cat': 'fork', 'ph': 'X',
+                                       'pid': case_idx, 'tid': core, 'ts': fork_time,
+                                       'dur': time_stamp - fork_time})
+                    elif event == "end" and "start" in begin:
+                        start = begin.pop("start")
+                        events.append({'name': name, 'cat': 'kernel', 'ph': 'X',
+                                       'pid': case_idx, 'tid': core, 'ts': start,
+                                       'dur': time_stamp - start,
+                                       'args': {'idle until join': max(join - time_stamp, 0)}})
+                    elif event == "barrier_leave" and "barrier" in begin:
+                        enter = begin.pop("barrier")
+                        events.append({'name': "barrier", 'cat': 'barrier', 'ph': 'X',
+                                       'pid': case_idx, 'tid': core, 'ts': enter,
+                                       'dur': time_stamp - enter})
+        for core in sorted(cores):
+            events.append({'name': 'thread_name', 'ph': 'M', 'pid': case_idx, 'tid': core,
+                           'args': {'name': "core %d" % core}})
+
+    trace_file = os.path.join(os.path.dirname(os.path.realpath(__file__)),
+                              "trace_{}_{}_{}.json".format(test_obj.function_name,
+                                                           test_obj.device_name,
+                                                           time.strftime("%Y-%m-%d_%H:%M:%S")))
+    with open(trace_file, "w") as f:
+        json.dump({'traceEvents': events, 'displayTimeUnit': 'ns'}, f)
+    print("trace written to %s" % trace_file)
+
+
 class Sweep:
     """ Iterator over all variables and returns the environment"""
     def __init__(self, variables, version):
@@ -1450,7 +1633,7 @@ def tolerance_check_str(acq, exp, tolerance, ctype, indent, target):
         # In case of float: add a tiny absolute offset of 0.0001
         return dedent(
             """\
-            {indent}float __tol = ABS({tol:E} * (float){exp} + 0.0001);
+            {indent}float __tol = ABS({tol:E} * (float){exp}) + 0.0001;
             {indent}if (!({acq} >= ({ty})({exp} - __tol) &&
             {indent}      {acq} <= ({ty})({exp} + __tol))) {{\
             """
@@ -1600,8 +1783,8 @@ def call_dynamic_function(f, env, version, device, arg_name=None, argument=None,
 
     if use_l1 is not None:
         possible_args.update({
-            'l1': (argument, "use_l1: bool"),
-            'use_l1': (argument, "use_l1: bool"),
+            'l1': (use_l1, "use_l1: bool"),
+            'use_l1': (use_l1, "use_l1: bool"),
         })
 
     # __code__.co_varnames returns the list of argument names of the function
@@ -0,0 +1,32 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if result_parameter.ctype == 'int32_t':
+        return np.int32(env['frames'])
+    if result_parameter.ctype != 'float':
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    # frame k covers the samples k*hop .. k*hop + len - 1, N/2 + 1 bins each
+    n, hop = env['len'], env['hop']
+    x = inputs['pSrc'].value.astype(np.float64)
+    w = inputs['pWindow'].value.astype(np.float64)
+    result = np.concatenate([np.fft.rfft(x[k * hop:k * hop + n] * w) for k in range(env['frames'])])
+    return np.stack((result.real, result.imag), axis=1).flatten().astype(np.float32)
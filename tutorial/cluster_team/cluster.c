@@ -0,0 +1,94 @@
+#include "rtos_hal.h"
+#include "stdio.h"
+#include "plp_math.h"
+
+#include "data.h"
+
+typedef struct {
+  uint32_t vlen;
+} bench_args_t;
+
+// The same sequence of small dot products, issued by a single core. Every call forks the team,
+// unless it is executed inside plp_cl_team_run.
+static void dot_prod_calls(void *arg) {
+  uint32_t vlen = ((bench_args_t *)arg)->vlen;
+
+  for (int i = 0; i < NCALLS; i++) {
+    plp_dot_prod_i32_parallel(a_cl[i], b_cl, vlen, NPE, &res_cl[i]);
+  }
+}
+
+static uint32_t stop_cycles(hal_perf_t *perf) {
+  hal_perf_stop(perf);
+  return hal_perf_read(HAL_PERF_CYCLES);
+}
+
+void cluster_entry(void *arg) {
+
+  hal_perf_t perf;
+  hal_perf_init(&perf);
+  hal_perf_conf(&perf, (1<<HAL_PERF_CYCLES));
+
+  for (int i = 0; i < NCALLS; i++) {
+    for (int j = 0; j < VLEN_MAX; j++) {
+      a_cl[i][j] = i + j;
+    }
+  }
+  for (int j = 0; j < VLEN_MAX; j++) {
+    b_cl[j] = j % 7 - 3;
+  }
+
+  printf("vlen, fork per call, persistent team, op list (cycles per call)\n");
+
+  for (uint32_t vlen = 64; vlen <= VLEN_MAX; vlen *= 2) {
+
+    bench_args_t args = { vlen };
+    uint32_t cycles_fork, cycles_team, cycles_oplist;
+
+    // 1. today's path: fork and join on each call
+    hal_perf_reset(&perf);
+    hal_perf_start(&perf);
+    dot_prod_calls(&args);
+    cycles_fork = stop_cycles(&perf);
+
+    // 2. persistent team: one fork, two barriers per call
+    hal_perf_reset(&perf);
+    hal_perf_start(&perf);
+    plp_cl_team_run(NPE, dot_prod_calls, &args);
+    cycles_team = stop_cycles(&perf);
+
+    // 3. op list: all the dot product kernels with a single fork and one barrier per call. The
+    //    final reduction of the glue code is done here.
+    plp_cl_oplist list;
+    plp_cl_oplist_init(&list, ops, NCALLS);
+    for (int i = 0; i < NCALLS; i++) {
+      instances[i].pSrcA = a_cl[i];
+      instances[i].pSrcB = b_cl;
+      instances[i].blkSizePE = vlen / NPE;
+      instances[i].nPE = NPE;
+      instances[i].resBuffer = resBuffers[i];
+      plp_cl_oplist_add(&list, plp_dot_prod_i32p_xpulpv2, &instances[i]);
+    }
+
+    hal_perf_reset(&perf);
+    hal_perf_start(&perf);
+    plp_cl_oplist_run(&list, NPE);
+    int errors = 0;
+    for (int i = 0; i < NCALLS; i++) {
+      int32_t sum = 0;
+      for (int j = 0; j < NPE; j++) {
+        sum += resBuffers[i][j];
+      }
+      errors += sum != res_cl[i];
+    }
+    cycles_oplist = stop_cycles(&perf);
+
+    printf("%d, %d, %d, %d\n", vlen, cycles_fork / NCALLS, cycles_team / NCALLS,
+           cycles_oplist / NCALLS);
+
+    if (errors) {
+      printf("error: op list results differ from the glue code\n");
+    }
+  }
+
+}
@@ -0,0 +1,15 @@
+#include "rtos_hal.h"
+#include "plp_math.h"
+
+#define VLEN_MAX 256 // longest vector length which is benchmarked
+#define NCALLS 32    // number of dot products per measurement
+#define NPE 8        // number of cluster cores
+
+HAL_CL_L1 int32_t a_cl[NCALLS][VLEN_MAX];
+HAL_CL_L1 int32_t b_cl[VLEN_MAX];
+HAL_CL_L1 int32_t res_cl[NCALLS];
+
+// used for the op list
+HAL_CL_L1 plp_dot_prod_instance_i32 instances[NCALLS];
+HAL_CL_L1 int32_t resBuffers[NCALLS][NPE];
+HAL_CL_L1 plp_cl_op ops[NCALLS];
@@ -0,0 +1,20 @@
+#include "rtos_hal.h"
+#include "stdio.h"
+#include "cluster.h"
+
+int main(){
+
+  printf("\nActivating cluster for comparing fork-per-call with the persistent team\n\n");
+
+  // mount the cluster
+  rt_cluster_mount(1, 0, 0, NULL);
+  // assign the job to cluster
+  rt_cluster_call(NULL, 0, cluster_entry, NULL, NULL, 0, 0, 0, NULL);
+  // unmount the cluster
+  rt_cluster_mount(0, 0, 0, NULL);
+
+  printf("\nCluster shut down\n\n");
+
+  return 0;
+
+}